@@ -183,6 +183,7 @@ int main()
     int c,ic;
     rsa_public_key PK;
     pktype st,ca,pt;
+    x509_index ix;
 
     printf("First check signature on self-signed cert and extract CA public key\n");
     OCT_frombase64(&IO,ca_b64);
@@ -227,9 +228,10 @@ int main()
     OCT_output(&H);
     printf("\n");
 
-// show some details
+// index the cert once, then show some details
+    X509_index_cert(&H,&ix);
     printf("Issuer Details\n");
-    ic=X509_find_issuer(&H);
+    ic=ix.issuer;
     c=X509_find_entity_property(&H,&ON,ic,&len);
     print_out("owner=",&H,c,len);
     c=X509_find_entity_property(&H,&CN,ic,&len);
@@ -238,7 +240,9 @@ int main()
     print_out("email=",&H,c,len);
     printf("\n");
 
-    ca=X509_extract_public_key(&H,&CAKEY);
+    ca=ix.keytype;
+    OCT_empty(&CAKEY);
+    OCT_jbytes(&CAKEY,H.val+ix.key,ix.keylen);
 
     if (ca.type==0)
     {
@@ -368,8 +372,9 @@ int main()
     OCT_output(&H);
     printf("\n");
 
+    X509_index_cert(&H,&ix);
     printf("Subject Details\n");
-    ic=X509_find_subject(&H);
+    ic=ix.subject;
     c=X509_find_entity_property(&H,&ON,ic,&len);
     print_out("owner=",&H,c,len);
     c=X509_find_entity_property(&H,&CN,ic,&len);
@@ -378,14 +383,16 @@ int main()
     print_out("email=",&H,c,len);
     printf("\n");
 
-    ic=X509_find_validity(&H);
+    ic=ix.validity;
     c=X509_find_start_date(&H,ic);
     print_date("start date= ",&H,c);
     c=X509_find_expiry_date(&H,ic);
     print_date("expiry date=",&H,c);
     printf("\n");
 
-    pt=X509_extract_public_key(&H,&CERTKEY);
+    pt=ix.keytype;
+    OCT_empty(&CERTKEY);
+    OCT_jbytes(&CERTKEY,H.val+ix.key,ix.keylen);
 
     if (pt.type==0)
     {
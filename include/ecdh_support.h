@@ -29,6 +29,19 @@
 
 #include "amcl.h"
 
+/**
+	@brief HMAC key with precomputed inner and outer hash states
+*/
+
+typedef struct
+{
+    int sha;          /**< hash type */
+    hash256 isha256;  /**< SHA-256 state after absorbing K0 ^ ipad */
+    hash256 osha256;  /**< SHA-256 state after absorbing K0 ^ opad */
+    hash512 isha512;  /**< SHA-384/512 state after absorbing K0 ^ ipad */
+    hash512 osha512;  /**< SHA-384/512 state after absorbing K0 ^ opad */
+} hmac_key;
+
 /* Auxiliary Functions */
 
 /** @brief general purpose hash function w=hash(p|n|x|y)
@@ -61,6 +74,31 @@ extern void HASH(int h,const octet *I,octet *O);
  */
 extern int HMAC(int h,const octet *M,const octet *K,int len,octet *tag);
 
+/**	@brief Precompute the inner and outer hash states of an HMAC key
+ *
+	Absorbs the K0 ^ ipad and K0 ^ opad blocks once, so that repeated MACs under the same key cost two fewer compressions each.
+	@param h is the hash type
+	@param K input key
+	@param HK the precomputed key
+	@return 0 for bad parameters, else 1
+ */
+extern int HMAC_KEY_init(int h,const octet *K,hmac_key *HK);
+/**	@brief HMAC of message M using a precomputed key to create tag of length len in octet tag
+ *
+	M and tag may be the same octet
+	@param HK precomputed key
+	@param M input message octet
+	@param len is output desired length of HMAC tag
+	@param tag is the output HMAC
+	@return 0 for bad parameters, else 1
+ */
+extern int HMAC_KEY_mac(const hmac_key *HK,const octet *M,int len,octet *tag);
+/**	@brief Erase the precomputed states of an HMAC key
+ *
+	@param HK precomputed key
+ */
+extern void HMAC_KEY_clean(hmac_key *HK);
+
 /**	@brief Key Derivation Function - generates key K from inputs Z and P
  *
 	IEEE-1363 KDF2 Key Derivation Function. Uses SHA256 internally.
@@ -80,8 +118,9 @@ extern void KDF2(int h,const octet *Z,const octet *P,int len,octet *K);
 	@param rep Number of times to be iterated.
 	@param len is output desired length
 	@param K is the derived key
+	@return 0 for bad parameters, else 1
  */
-extern void PBKDF2(int h,const octet *P,octet *S,int rep,int len,octet *K);
+extern int PBKDF2(int h,const octet *P,octet *S,int rep,int len,octet *K);
 /**	@brief AES encrypts a plaintext to a ciphtertext
  *
 	IEEE-1363 AES_CBC_IV0_ENCRYPT function. Encrypts in CBC mode with a zero IV, padding as necessary to create a full final block.
@@ -29,18 +29,57 @@
 
 #include "amcl.h"
 
+#define RAND_THREAD_SEED_BYTES 48   /**< Entropy bytes drawn to seed or reseed a per-thread generator */
+#define RAND_THREAD_RESEED 65536    /**< Number of THREAD_CSPRNG calls between reseeds of a per-thread generator */
+
+/**	@brief Entropy source for the per-thread random number generators
+ *
+	@param b is the buffer to fill with truly random bytes
+	@param len is the number of bytes required
+	@return 0 on success, non-zero if entropy could not be obtained
+ */
+typedef int (*csprng_entropy)(char *b,int len);
+
 /**	@brief Initialise a random number generator
  *
 	@param R is a pointer to a cryptographically secure random number generator
 	@param S is an input truly random seed value
  */
 extern void CREATE_CSPRNG(csprng *R,const octet *S);
+/**	@brief Initialise a random number generator of a given type
+ *
+	@param R is a pointer to a cryptographically secure random number generator
+	@param type is the generator type - RAND_MZ, RAND_HMAC_DRBG or RAND_CTR_DRBG
+	@param S is an input truly random seed value
+ */
+extern void CREATE_CSPRNG_TYPE(csprng *R,int type,const octet *S);
 /**	@brief Kill a random number generator
  *
 	Deletes all internal state
 	@param R is a pointer to a cryptographically secure random number generator
  */
 extern void KILL_CSPRNG(csprng *R);
+/**	@brief Set the entropy source used by the per-thread random number generators
+ *
+	Call this before any thread uses THREAD_CSPRNG. Generators already seeded are
+	not affected until their next reseed
+	@param f is the entropy callback, or NULL to read from /dev/urandom
+ */
+extern void SET_CSPRNG_ENTROPY(csprng_entropy f);
+/**	@brief Get the random number generator of the calling thread
+ *
+	The generator is an HMAC_DRBG private to the thread, so it can be used without locking.
+	It is seeded from the entropy source on first use, reseeded every RAND_THREAD_RESEED calls,
+	and reseeded afresh in a child process after fork(). The pointer must not be shared with
+	other threads and should be fetched again rather than kept across a fork()
+	@return the thread's generator, or NULL if no entropy could be obtained
+ */
+extern csprng *THREAD_CSPRNG(void);
+/**	@brief Kill the random number generator of the calling thread
+ *
+	Deletes all internal state. A later THREAD_CSPRNG call seeds a new generator
+ */
+extern void KILL_THREAD_CSPRNG(void);
 
 #endif
 
@@ -39,6 +39,30 @@ typedef struct
     int curve; /**< elliptic curve used or RSA key length in bits  */
 } pktype;
 
+/**
+ * @brief Index of a certificate
+ *
+ * Offsets and lengths of the fields of a certificate, found in one pass over its DER encoding.
+ * Offsets are into the octet that was indexed, and are 0 if the field was not found
+ */
+typedef struct
+{
+    int cert;       /**< start of the certificate clause, inside a signed certificate */
+    int certlen;    /**< length of the certificate clause, including its header */
+    int issuer;     /**< issuer field */
+    int validity;   /**< validity field */
+    int subject;    /**< subject field */
+    int key;        /**< public key, as extracted by X509_extract_public_key */
+    int keylen;     /**< length of the public key */
+    pktype keytype; /**< public key type, as returned by X509_extract_public_key */
+    int ext;        /**< extensions field, if any */
+    int sigalg;     /**< signature algorithm OID */
+    int sigalglen;  /**< length of the signature algorithm OID */
+    pktype sigtype; /**< signature type, as returned by X509_extract_cert_sig */
+    int sig;        /**< signature, the contents of its BIT STRING */
+    int siglen;     /**< length of the signature */
+} x509_index;
+
 
 /* X.509 functions */
 /** @brief Extract certificate signature
@@ -104,6 +128,40 @@ extern int X509_find_start_date(octet *c,int s);
 	@return 0 on failure, or pointer to the expiry date
 */
 extern int X509_find_expiry_date(octet *c,int s);
+/** @brief Index a signed certificate
+ *
+	Fields of the certificate are indexed as offsets into sc
+	@param sc a signed certificate
+	@param x the output index, partly filled on failure
+	@return 0 on failure, including a certificate clause that runs past the end of sc
+*/
+extern int X509_index_signed_cert(octet *sc,x509_index *x);
+/** @brief Index a certificate
+ *
+	@param c an X.509 certificate
+	@param x the output index, partly filled on failure. Signature fields are not used
+	@return 0 on failure
+*/
+extern int X509_index_cert(octet *c,x509_index *x);
+/** @brief Certificate inside a signed certificate, without copying it
+ *
+	The output octet points into sc, which must not change while it is in use.
+	Offsets in the index remain relative to sc
+	@param sc an indexed signed certificate
+	@param x the index of sc
+	@param c the certificate
+	@return 0 on failure
+*/
+extern int X509_view_cert(octet *sc,x509_index *x,octet *c);
+/** @brief
+ *
+	@param c an X.509 certificate
+	@param S is OID of extension we are looking for
+	@param s is a pointer to the extensions field in the cert
+	@param f is pointer to the length of the extension value
+	@return 0 on failure, or pointer to the extension value
+*/
+extern int X509_find_extension(octet *c,octet *S,int s,int *f);
 
 
 #endif
@@ -0,0 +1,241 @@
+#!/usr/bin/env python3
+#
+# addchain.py
+#
+# Generate the fixed exponent addition chains used by FP_YYY_sqrt, and
+# write them into src/rom_field_*.c
+#
+# For p=3 mod 4 the exponent is (p-3)/4, for p=5 mod 8 it is (p-5)/8.
+#
+# Long runs of 1 bits in the exponent are taken from values x^(2^k-1),
+# which are built by doubling and share their intermediate values. The
+# rest of the exponent is covered by sliding windows over a table of odd
+# powers. The run length threshold and the window width are chosen to
+# minimise the cost of the chain, and each chain is checked against pow().
+#
+# The chain is written as a list of steps {dst,src,n,mul}, each meaning
+# t[dst]=t[src]^(2^n).t[mul] (no multiplication if mul<0), with t[0]=x on
+# entry and the result in the dst of the last step.
+#
+# usage: scripts/addchain.py [src/rom_field_XXX.c ...]
+#
+# Fields with a pseudo or generalised Mersenne modulus are skipped, as
+# they have their own hand built chain in FP_YYY_fpow.
+# ------------------------------------------------------------------------------
+
+import glob
+import random
+import re
+import sys
+
+MAXWIDTH = 5      # largest sliding window
+MAXSLOTS = 24     # must not exceed PCHAIN_SLOTS in fp.c.in
+SQRCOST = 0.8     # cost of a squaring relative to a multiplication
+
+BEGIN = "/* Addition chain for the fixed exponent used by FP_sqrt - generated by scripts/addchain.py */"
+END = "/* End of addition chain */"
+
+# Fields whose modulus has a special form
+SPECIAL = ["25519", "256PME", "256PMW", "384PM", "512PM", "C41417", "GOLDILOCKS", "HIFIVE", "NIST521"]
+
+
+def modulus(text):
+    """ Read the modulus from the 64-bit BIG in a rom_field file """
+    m = re.search(r"#if CHUNK==64.*?Base Bits= *(\d+).*?Modulus_\w+ *= *\{([^}]*)\}", text, re.S)
+    base = int(m.group(1))
+    p = 0
+    for i, w in enumerate(m.group(2).split(",")):
+        p += int(w.strip().rstrip("L"), 16) << (base * i)
+    return p
+
+
+def windows(bits, w):
+    """ Split a bit string into the fewest windows of at most w bits, each ending in a 1.
+        Returns [(offset of last bit, odd digit)] """
+    n = len(bits)
+    best = [0] * (n + 1)
+    choice = [0] * (n + 1)
+    for i in range(n - 1, -1, -1):
+        if bits[i] == "0":
+            best[i] = best[i + 1]
+            continue
+        best[i] = None
+        for length in range(1, w + 1):
+            if i + length > n or bits[i + length - 1] == "0":
+                continue
+            c = 1 + best[i + length]
+            if best[i] is None or c < best[i]:
+                best[i] = c
+                choice[i] = length
+    out = []
+    i = 0
+    while i < n:
+        if bits[i] == "0":
+            i += 1
+            continue
+        out.append((i + choice[i] - 1, int(bits[i:i + choice[i]], 2)))
+        i += choice[i]
+    return out
+
+
+class Program:
+    def __init__(self):
+        self.steps = []
+        self.slots = 1       # t[0]=x
+        self.runs = {1: 0}   # x^(2^k-1) -> slot
+        self.odd = {1: 0}    # x^d -> slot
+
+    def new(self):
+        self.slots += 1
+        return self.slots - 1
+
+    def step(self, dst, src, n, mul):
+        self.steps.append((dst, src, n, mul))
+
+    def run(self, k):
+        """ slot holding x^(2^k-1) """
+        if k in self.runs:
+            return self.runs[k]
+        for a in sorted(self.runs, reverse=True):
+            if a < k and (k - a) in self.runs:
+                s = self.new()
+                self.step(s, self.runs[a], k - a, self.runs[k - a])
+                self.runs[k] = s
+                return s
+        if k % 2 == 0:
+            h = self.run(k // 2)
+            s = self.new()
+            self.step(s, h, k // 2, h)
+        else:
+            h = self.run(k - 1)
+            s = self.new()
+            self.step(s, h, 1, 0)
+        self.runs[k] = s
+        return s
+
+    def table(self, top):
+        """ slots holding x^1,x^3,..x^top """
+        if top > 1:
+            x2 = self.new()
+            self.step(x2, 0, 1, -1)
+            prev = 0
+            for d in range(3, top + 1, 2):
+                s = self.new()
+                self.step(s, prev, 0, x2)
+                self.odd[d] = s
+                prev = s
+
+    def cost(self):
+        nsqr = sum(n for _, _, n, _ in self.steps)
+        nmul = sum(1 for _, _, _, m in self.steps if m >= 0)
+        return nsqr, nmul
+
+
+def plan(e, w, threshold):
+    """ Addition chain for x^e, with runs of at least threshold 1s taken whole """
+    bits = bin(e)[2:]
+    tokens = []     # (offset of last bit, ('run',k) or ('odd',d))
+    i = 0
+    seg = 0
+    while i < len(bits):
+        if bits[i] == "1":
+            j = i
+            while j < len(bits) and bits[j] == "1":
+                j += 1
+            if j - i >= threshold:
+                tokens += [(seg + o, ("odd", d)) for o, d in windows(bits[seg:i], w)]
+                tokens.append((j - 1, ("run", j - i)))
+                seg = j
+            i = j
+        else:
+            i += 1
+    tokens += [(seg + o, ("odd", d)) for o, d in windows(bits[seg:], w)]
+
+    P = Program()
+    top = max([d for _, (k, d) in tokens if k == "odd"] + [1])
+    P.table(top)
+    slot = {}
+    for _, (k, v) in tokens:
+        slot[(k, v)] = P.run(v) if k == "run" else P.odd[v]
+
+    acc = P.new()
+    done, first = tokens[0][0], tokens[0][1]
+    P.step(acc, slot[first], 0, -1)
+    for end, tok in tokens[1:]:
+        P.step(acc, acc, end - done, slot[tok])
+        done = end
+    if done < len(bits) - 1:
+        P.step(acc, acc, len(bits) - 1 - done, -1)
+    return P
+
+
+def chain(e):
+    best = None
+    for w in range(1, MAXWIDTH + 1):
+        for threshold in list(range(4, 40)) + [len(bin(e))]:
+            P = plan(e, w, threshold)
+            if P.slots > MAXSLOTS:
+                continue
+            nsqr, nmul = P.cost()
+            c = SQRCOST * nsqr + nmul
+            if best is None or c < best[0]:
+                best = (c, P)
+    return best[1]
+
+
+def check(e, p, P):
+    """ Run the chain as FP_YYY_fpow does, and compare with pow() """
+    for _ in range(8):
+        x = random.randrange(2, p)
+        t = [0] * P.slots
+        t[0] = x
+        for dst, src, n, mul in P.steps:
+            v = t[src]
+            for _ in range(n):
+                v = v * v % p
+            if mul >= 0:
+                v = v * t[mul] % p
+            t[dst] = v
+        assert t[P.steps[-1][0]] == pow(x, e, p)
+
+
+def emit(name, P):
+    nsqr, nmul = P.cost()
+    out = [BEGIN, "// %d squarings and %d multiplications, %d temporaries" % (nsqr, nmul, P.slots)]
+    flat = [len(P.steps)]
+    for s in P.steps:
+        flat += list(s)
+    out.append("const sign16 PChain_%s[]= {%s};" % (name, ",".join(str(v) for v in flat)))
+    out.append(END)
+    return "\n".join(out) + "\n"
+
+
+def process(path):
+    name = re.search(r"rom_field_(\w+)\.c", path).group(1)
+    if name in SPECIAL:
+        return
+    with open(path) as f:
+        text = f.read()
+    p = modulus(text)
+    if p % 4 == 3:
+        e = (p - 3) // 4
+    elif p % 8 == 5:
+        e = (p - 5) // 8
+    else:
+        raise ValueError("%s: p=1 mod 8 is not supported" % name)
+    P = chain(e)
+    check(e, p, P)
+    block = emit(name, P)
+    if BEGIN in text:
+        text = text[:text.index(BEGIN)] + block + text[text.index(END) + len(END) + 1:]
+    else:
+        text = text.rstrip("\n") + "\n\n" + block
+    with open(path, "w") as f:
+        f.write(text)
+    print("%s: %s" % (name, block.splitlines()[1][3:]))
+
+
+if __name__ == "__main__":
+    files = sys.argv[1:] or sorted(glob.glob("src/rom_field_*.c"))
+    for path in files:
+        process(path)
@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+#
+# combtable.py
+#
+# Generate the fixed base comb table used by ECP_ZZZ_genmul on curves of
+# Montgomery or Edwards form, and write it into src/rom_curve_*.c
+#
+# The Montgomery curve y^2=x^3+Ax^2+x is birationally equivalent to the
+# twisted Edwards curve ax^2+y^2=1+dx^2y^2 with a=A+2 and d=A-2, with
+# u=(1+y)/(1-y), and its generator is mapped across. An Edwards curve is
+# used as it is, with a=CURVE_A and d=CURVE_B. The table holds the affine
+# Edwards points (x, y, xy) of i.2^(32j).G for i=1..8 and
+# j=0..ceil(MODBYTES/4)-1. The scalar is recoded as signed radix 16 digits
+# and the digits k, k+8, k+16, ... share one pass of four doublings.
+#
+# usage: scripts/combtable.py [src/rom_curve_XXX.c ...]
+#
+# Weierstrass curves are skipped.
+# ------------------------------------------------------------------------------
+
+import glob
+import re
+import sys
+
+BEGIN = "/* Fixed base comb table for ECP_genmul - generated by scripts/combtable.py */"
+END = "/* End of comb table */"
+
+
+def big(text, name, chunk):
+    """ Read a BIG constant from the given CHUNK section of a rom file """
+    sect = re.search(r"#if CHUNK==%d(.*?)#endif" % chunk, text, re.S).group(1)
+    m = re.search(r"const BIG_(\d+)_(\d+) %s *= *\{([^}]*)\}" % name, sect)
+    base = int(m.group(2))
+    v = 0
+    for i, w in enumerate(m.group(3).split(",")):
+        v += int(w.strip().rstrip("L"), 16) << (base * i)
+    return v
+
+
+def sqrt(a, p):
+    """ Tonelli-Shanks """
+    a %= p
+    if a == 0:
+        return 0
+    assert pow(a, (p - 1) // 2, p) == 1
+    q, s = p - 1, 0
+    while q % 2 == 0:
+        q, s = q // 2, s + 1
+    z = 2
+    while pow(z, (p - 1) // 2, p) != p - 1:
+        z += 1
+    m, c, t, r = s, pow(z, q, p), pow(a, q, p), pow(a, (q + 1) // 2, p)
+    while t != 1:
+        i, t2 = 0, t
+        while t2 != 1:
+            t2, i = t2 * t2 % p, i + 1
+        b = pow(c, 1 << (m - i - 1), p)
+        m, c, t, r = i, b * b % p, t * b * b % p, r * b % p
+    return r
+
+
+class Edwards:
+    def __init__(self, a, d, p):
+        self.a, self.d, self.p = a, d, p
+
+    def add(self, P, Q):
+        a, d, p = self.a, self.d, self.p
+        (x1, y1), (x2, y2) = P, Q
+        t = d * x1 * x2 * y1 * y2 % p
+        x3 = (x1 * y2 + y1 * x2) * pow(1 + t, -1, p) % p
+        y3 = (y1 * y2 - a * x1 * x2) * pow(1 - t, -1, p) % p
+        return (x3, y3)
+
+    def mul(self, e, P):
+        R = (0, 1)
+        while e:
+            if e & 1:
+                R = self.add(R, P)
+            P = self.add(P, P)
+            e >>= 1
+        return R
+
+
+def limbs(v, base, n):
+    mask = (1 << base) - 1
+    return "{" + ",".join("0x%X" % ((v >> (base * i)) & mask) for i in range(n)) + "}"
+
+
+def emit(name, btype, base, nlen, table):
+    out = [BEGIN]
+    out.append("const %s CURVE_Comb_%s[%d][3]=" % (btype, name, len(table)))
+    out.append("{")
+    rows = []
+    for (x, y, t) in table:
+        rows.append("    {%s,%s,%s}" % (limbs(x, base, nlen), limbs(y, base, nlen), limbs(t, base, nlen)))
+    out.append(",\n".join(rows))
+    out.append("};")
+    out.append(END)
+    return "\n".join(out) + "\n"
+
+
+def process(path, params):
+    name = re.search(r"rom_curve_(\w+)\.c", path).group(1)
+    if name not in params or params[name][1] not in ("MONTGOMERY", "EDWARDS"):
+        return
+    field, _, nbytes = params[name]
+    with open(path) as f:
+        text = f.read()
+    with open("src/rom_field_%s.c" % field) as f:
+        ftext = f.read()
+
+    p = big(ftext, "Modulus_%s" % field, 64)
+    A = int(re.search(r"CURVE_A_%s *= *(-?\d+)" % name, text).group(1))
+    r = big(text, "CURVE_Order_%s" % name, 64)
+
+    if params[name][1] == "MONTGOMERY":
+        u = big(text, "CURVE_Gx_%s" % name, 64)
+        E = Edwards(A + 2, A - 2, p)
+        y = (u - 1) * pow(u + 1, -1, p) % p
+        x = sqrt((1 - y * y) * pow(E.a - E.d * y * y, -1, p), p)
+        G = (x, y)
+    else:
+        E = Edwards(A % p, big(text, "CURVE_B_%s" % name, 64) % p, p)
+        G = (big(text, "CURVE_Gx_%s" % name, 64), big(text, "CURVE_Gy_%s" % name, 64))
+    assert E.mul(r, G) == (0, 1)
+
+    table = []
+    for j in range((nbytes + 3) // 4):
+        B = E.mul(1 << (32 * j), G)
+        P = B
+        for i in range(8):
+            table.append((P[0], P[1], P[0] * P[1] % p))
+            P = E.add(P, B)
+
+    for chunk in (16, 32, 64):
+        m = re.search(r"#if CHUNK==%d(.*?)#endif" % chunk, text, re.S)
+        if m is None or "#error" in m.group(1):
+            continue
+        sect = m.group(1)
+        t = re.search(r"const (BIG_(\d+)_(\d+)) CURVE_Order", sect)
+        btype, bits, base = t.group(1), int(t.group(2)), int(t.group(3))
+        nlen = (bits + base - 1) // base
+        block = emit(name, btype, base, nlen, table)
+        if BEGIN in sect:
+            new = sect[:sect.index(BEGIN)] + block + sect[sect.index(END) + len(END) + 1:]
+        else:
+            new = sect.rstrip("\n") + "\n" + block
+        text = text[:m.start(1)] + new + text[m.end(1):]
+
+    with open(path, "w") as f:
+        f.write(text)
+    print("%s: %d points" % (name, len(table)))
+
+
+def parameters():
+    """ Field, curve type and modulus bytes of each curve in AMCLParameters.cmake """
+    params = {}
+    with open("cmake/AMCLParameters.cmake") as f:
+        for line in f:
+            m = re.match(r"set\(AMCL_CURVE_\d+_\w+\s+(.*)\)", line)
+            if m:
+                v = m.group(1).split()
+                params[v[2]] = (v[1], v[8], int(v[3]))
+    return params
+
+
+if __name__ == "__main__":
+    params = parameters()
+    files = sys.argv[1:] or sorted(glob.glob("src/rom_curve_*.c"))
+    for path in files:
+        process(path, params)
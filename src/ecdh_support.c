@@ -148,44 +148,160 @@ void HASH(int sha,const octet *p,octet *w)
     ehashit(sha,p,-1,NULL,w,0);
 }
 
-/* Calculate HMAC of m using key k. HMAC is tag of length olen */
-int HMAC(int sha,const octet *m,const octet *k,int olen,octet *tag)
+/* absorb n bytes of b into the SHA-2 instance selected by sha */
+static void hmac_process(int sha,hash256 *sha256,hash512 *sha512,const char *b,int n)
+{
+    for (int i=0; i<n; i++)
+    {
+        switch(sha)
+        {
+        case SHA256:
+            HASH256_process(sha256,b[i]);
+            break;
+        case SHA384:
+            HASH384_process(sha512,b[i]);
+            break;
+        case SHA512:
+            HASH512_process(sha512,b[i]);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+/* Precompute HMAC inner and outer states for key k */
+int HMAC_KEY_init(int sha,const octet *k,hmac_key *hk)
 {
-    /* Input is from an octet m        *
-     * olen is requested output length in bytes. k is the key  *
-     * The output is the calculated tag */
-    int hlen;
     int b;
-    char h[128];
     char k0[128];
-    octet H= {0,sizeof(h),h};
     octet K0= {0,sizeof(k0),k0};
 
-    hlen=sha;
-    if (hlen>32) b=128;
-    else b=64;
+    if (sha!=SHA256 && sha!=SHA384 && sha!=SHA512) return 0;
 
-    if (olen<4 /*|| olen>hlen*/) return 0;
+    if (sha>32) b=128;
+    else b=64;
 
     if (k->len > b) ehashit(sha,k,-1,NULL,&K0,0);
     else            OCT_copy(&K0,k);
 
     OCT_jbyte(&K0,0,b-K0.len);
 
-    OCT_xorbyte(&K0,0x36);
+    hk->sha=sha;
+    HASH256_init(&hk->isha256);
+    HASH256_init(&hk->osha256);
+    if (sha==SHA384)
+    {
+        HASH384_init(&hk->isha512);
+        HASH384_init(&hk->osha512);
+    }
+    else
+    {
+        HASH512_init(&hk->isha512);
+        HASH512_init(&hk->osha512);
+    }
 
-    ehashit(sha,&K0,-1,m,&H,0);
+    OCT_xorbyte(&K0,0x36);
+    hmac_process(sha,&hk->isha256,&hk->isha512,K0.val,b);
 
     OCT_xorbyte(&K0,0x6a);   /* 0x6a = 0x36 ^ 0x5c */
-    ehashit(sha,&K0,-1,&H,&H,olen);
+    hmac_process(sha,&hk->osha256,&hk->osha512,K0.val,b);
 
-    OCT_empty(tag);
+    OCT_clear(&K0);
 
-    OCT_jbytes(tag,H.val,olen);
+    return 1;
+}
+
+/* Calculate HMAC of m using precomputed key hk. HMAC is tag of length olen */
+int HMAC_KEY_mac(const hmac_key *hk,const octet *m,int olen,octet *tag)
+{
+    int hlen;
+    char h[64];
+    hash256 sha256;
+    hash512 sha512;
+
+    hlen=hk->sha;
+
+    if (olen<4 /*|| olen>hlen*/) return 0;
+
+    /* clone the snapshots rather than rehashing the key blocks */
+    if (hlen==SHA256) sha256=hk->isha256;
+    else              sha512=hk->isha512;
+    hmac_process(hk->sha,&sha256,&sha512,m->val,m->len);
+
+    switch (hk->sha)
+    {
+    case SHA256:
+        HASH256_hash(&sha256,h);
+        sha256=hk->osha256;
+        break;
+    case SHA384:
+        HASH384_hash(&sha512,h);
+        sha512=hk->osha512;
+        break;
+    case SHA512:
+        HASH512_hash(&sha512,h);
+        sha512=hk->osha512;
+        break;
+    default:
+        return 0;
+    }
+
+    hmac_process(hk->sha,&sha256,&sha512,h,hlen);
+
+    switch (hk->sha)
+    {
+    case SHA256:
+        HASH256_hash(&sha256,h);
+        break;
+    case SHA384:
+        HASH384_hash(&sha512,h);
+        break;
+    default:
+        HASH512_hash(&sha512,h);
+        break;
+    }
+
+    OCT_empty(tag);
+    if (olen<=hlen)
+        OCT_jbytes(tag,h,olen);
+    else
+    {
+        OCT_jbyte(tag,0,olen-hlen);
+        OCT_jbytes(tag,h,hlen);
+    }
 
     return 1;
 }
 
+/* Erase precomputed HMAC states */
+void HMAC_KEY_clean(hmac_key *hk)
+{
+    HASH256_init(&hk->isha256);
+    HASH256_init(&hk->osha256);
+    HASH512_init(&hk->isha512);
+    HASH512_init(&hk->osha512);
+    hk->sha=0;
+}
+
+/* Calculate HMAC of m using key k. HMAC is tag of length olen */
+int HMAC(int sha,const octet *m,const octet *k,int olen,octet *tag)
+{
+    /* Input is from an octet m        *
+     * olen is requested output length in bytes. k is the key  *
+     * The output is the calculated tag */
+    int res;
+    hmac_key hk;
+
+    if (olen<4 /*|| olen>hlen*/) return 0;
+
+    if (!HMAC_KEY_init(sha,k,&hk)) return 0;
+    res=HMAC_KEY_mac(&hk,m,olen,tag);
+    HMAC_KEY_clean(&hk);
+
+    return res;
+}
+
 void KDF2(int sha,const octet *z,const octet *p,int olen,octet *key)
 {
     /* NOTE: the parameter olen is the length of the output k in bytes */
@@ -210,35 +326,46 @@ void KDF2(int sha,const octet *z,const octet *p,int olen,octet *key)
 /* Password based Key Derivation Function */
 /* Input password p, salt s, and repeat count */
 /* Output key of length olen */
-void PBKDF2(int sha,const octet *p,octet *s,int rep,int olen,octet *key)
+int PBKDF2(int sha,const octet *p,octet *s,int rep,int olen,octet *key)
 {
     int len;
-    int d=ROUNDUP(olen,sha);
+    int d;
     char f[64];
     char u[64];
     octet F= {0,sizeof(f),f};
     octet U= {0,sizeof(u),u};
+    hmac_key hp;
     OCT_empty(key);
 
+    /* the password keys every iteration, so absorb it only once */
+    if (!HMAC_KEY_init(sha,p,&hp)) return 0;
+    d=ROUNDUP(olen,sha);
+
     for (int i=1; i<=d; i++)
     {
         len=s->len;
         OCT_jint(s,i,4);
 
-        HMAC(sha,s,p,sha,&F);
+        HMAC_KEY_mac(&hp,s,sha,&F);
 
         s->len=len;
         OCT_copy(&U,&F);
         for (int j=2; j<=rep; j++)
         {
-            HMAC(sha,&U,p,sha,&U);
+            HMAC_KEY_mac(&hp,&U,sha,&U);
             OCT_xor(&F,&U);
         }
 
         OCT_joctet(key,&F);
     }
 
+    HMAC_KEY_clean(&hp);
+    OCT_clear(&U);
+    OCT_clear(&F);
+
     OCT_chop(key,NULL,olen);
+
+    return 1;
 }
 
 /* AES encryption/decryption. Encrypt byte array M using key K and returns ciphertext */
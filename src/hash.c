@@ -393,68 +393,155 @@ static const unsign64 RC[24]=
     0x8000000080008081UL,0x8000000000008080UL,0x0000000080000001UL,0x8000000080008008UL
 };
 
+/* One unrolled round of Keccak-f[1600], reading lanes A and writing lanes E.
+   Lanes are named by row (b,g,k,m,s = y 0..4) and column (a,e,i,o,u = x 0..4).
+   The lanes be, bi, go, ki, mi and sa are kept complemented ("lane complementing"
+   transform), which turns most of the NOTs of chi into ORs. Column parities Ca..Cu
+   of the output are accumulated on the fly for the theta step of the next round */
+
+#define KECCAK_ROUND(k,A,E) \
+    Da=Cu^rotl(Ce,1); \
+    De=Ca^rotl(Ci,1); \
+    Di=Ce^rotl(Co,1); \
+    Do=Ci^rotl(Cu,1); \
+    Du=Co^rotl(Ca,1); \
+    \
+    Ba=A##ba^Da; \
+    Be=rotl(A##ge^De,44); \
+    Bi=rotl(A##ki^Di,43); \
+    Bo=rotl(A##mo^Do,21); \
+    Bu=rotl(A##su^Du,14); \
+    E##ba=Ba^(Be|Bi)^RC[k]; \
+    E##be=Be^((~Bi)|Bo); \
+    E##bi=Bi^(Bo&Bu); \
+    E##bo=Bo^(Bu|Ba); \
+    E##bu=Bu^(Ba&Be); \
+    Ca=E##ba; Ce=E##be; Ci=E##bi; Co=E##bo; Cu=E##bu; \
+    \
+    Ba=rotl(A##bo^Do,28); \
+    Be=rotl(A##gu^Du,20); \
+    Bi=rotl(A##ka^Da,3); \
+    Bo=rotl(A##me^De,45); \
+    Bu=rotl(A##si^Di,61); \
+    E##ga=Ba^(Be|Bi); \
+    E##ge=Be^(Bi&Bo); \
+    E##gi=Bi^(Bo|(~Bu)); \
+    E##go=Bo^(Bu|Ba); \
+    E##gu=Bu^(Ba&Be); \
+    Ca^=E##ga; Ce^=E##ge; Ci^=E##gi; Co^=E##go; Cu^=E##gu; \
+    \
+    Ba=rotl(A##be^De,1); \
+    Be=rotl(A##gi^Di,6); \
+    Bi=rotl(A##ko^Do,25); \
+    Bo=rotl(A##mu^Du,8); \
+    Bu=rotl(A##sa^Da,18); \
+    E##ka=Ba^(Be|Bi); \
+    E##ke=Be^(Bi&Bo); \
+    E##ki=Bi^((~Bo)&Bu); \
+    E##ko=(~Bo)^(Bu|Ba); \
+    E##ku=Bu^(Ba&Be); \
+    Ca^=E##ka; Ce^=E##ke; Ci^=E##ki; Co^=E##ko; Cu^=E##ku; \
+    \
+    Ba=rotl(A##bu^Du,27); \
+    Be=rotl(A##ga^Da,36); \
+    Bi=rotl(A##ke^De,10); \
+    Bo=rotl(A##mi^Di,15); \
+    Bu=rotl(A##so^Do,56); \
+    E##ma=Ba^(Be&Bi); \
+    E##me=Be^(Bi|Bo); \
+    E##mi=Bi^((~Bo)|Bu); \
+    E##mo=(~Bo)^(Bu&Ba); \
+    E##mu=Bu^(Ba|Be); \
+    Ca^=E##ma; Ce^=E##me; Ci^=E##mi; Co^=E##mo; Cu^=E##mu; \
+    \
+    Ba=rotl(A##bi^Di,62); \
+    Be=rotl(A##go^Do,55); \
+    Bi=rotl(A##ku^Du,39); \
+    Bo=rotl(A##ma^Da,41); \
+    Bu=rotl(A##se^De,2); \
+    E##sa=Ba^((~Be)&Bi); \
+    E##se=(~Be)^(Bi|Bo); \
+    E##si=Bi^(Bo&Bu); \
+    E##so=Bo^(Bu|Ba); \
+    E##su=Bu^(Ba&Be); \
+    Ca^=E##sa; Ce^=E##se; Ci^=E##si; Co^=E##so; Cu^=E##su;
+
 /* permutation */
 
 static void SHA3_transform(sha3 *sh)
 {
-    unsign64 C[5];
-    unsign64 D[5];
-    unsign64 B[5][5];
-
-    for (int k=0; k<SHA3_ROUNDS; k++)
+    unsign64 Aba,Abe,Abi,Abo,Abu,Aga,Age,Agi,Ago,Agu,Aka,Ake,Aki,Ako,Aku;
+    unsign64 Ama,Ame,Ami,Amo,Amu,Asa,Ase,Asi,Aso,Asu;
+    unsign64 Eba,Ebe,Ebi,Ebo,Ebu,Ega,Ege,Egi,Ego,Egu,Eka,Eke,Eki,Eko,Eku;
+    unsign64 Ema,Eme,Emi,Emo,Emu,Esa,Ese,Esi,Eso,Esu;
+    unsign64 Ba,Be,Bi,Bo,Bu;
+    unsign64 Ca,Ce,Ci,Co,Cu;
+    unsign64 Da,De,Di,Do,Du;
+
+    /* S[x][y], complementing the six lanes on the way in */
+    Aba=sh->S[0][0];
+    Abe=~sh->S[1][0];
+    Abi=~sh->S[2][0];
+    Abo=sh->S[3][0];
+    Abu=sh->S[4][0];
+    Aga=sh->S[0][1];
+    Age=sh->S[1][1];
+    Agi=sh->S[2][1];
+    Ago=~sh->S[3][1];
+    Agu=sh->S[4][1];
+    Aka=sh->S[0][2];
+    Ake=sh->S[1][2];
+    Aki=~sh->S[2][2];
+    Ako=sh->S[3][2];
+    Aku=sh->S[4][2];
+    Ama=sh->S[0][3];
+    Ame=sh->S[1][3];
+    Ami=~sh->S[2][3];
+    Amo=sh->S[3][3];
+    Amu=sh->S[4][3];
+    Asa=~sh->S[0][4];
+    Ase=sh->S[1][4];
+    Asi=sh->S[2][4];
+    Aso=sh->S[3][4];
+    Asu=sh->S[4][4];
+
+    Ca=Aba^Aga^Aka^Ama^Asa;
+    Ce=Abe^Age^Ake^Ame^Ase;
+    Ci=Abi^Agi^Aki^Ami^Asi;
+    Co=Abo^Ago^Ako^Amo^Aso;
+    Cu=Abu^Agu^Aku^Amu^Asu;
+
+    for (int k=0; k<SHA3_ROUNDS; k+=2)
     {
-        C[0]=sh->S[0][0]^sh->S[0][1]^sh->S[0][2]^sh->S[0][3]^sh->S[0][4];
-        C[1]=sh->S[1][0]^sh->S[1][1]^sh->S[1][2]^sh->S[1][3]^sh->S[1][4];
-        C[2]=sh->S[2][0]^sh->S[2][1]^sh->S[2][2]^sh->S[2][3]^sh->S[2][4];
-        C[3]=sh->S[3][0]^sh->S[3][1]^sh->S[3][2]^sh->S[3][3]^sh->S[3][4];
-        C[4]=sh->S[4][0]^sh->S[4][1]^sh->S[4][2]^sh->S[4][3]^sh->S[4][4];
-
-        D[0]=C[4]^rotl(C[1],1);
-        D[1]=C[0]^rotl(C[2],1);
-        D[2]=C[1]^rotl(C[3],1);
-        D[3]=C[2]^rotl(C[4],1);
-        D[4]=C[3]^rotl(C[0],1);
-
-        for (int i=0; i<5; i++)
-            for (int j=0; j<5; j++)
-                sh->S[i][j]^=D[i];  /* let the compiler unroll it! */
-
-        B[0][0]=sh->S[0][0];
-        B[1][3]=rotl(sh->S[0][1],36);
-        B[2][1]=rotl(sh->S[0][2],3);
-        B[3][4]=rotl(sh->S[0][3],41);
-        B[4][2]=rotl(sh->S[0][4],18);
-
-        B[0][2]=rotl(sh->S[1][0],1);
-        B[1][0]=rotl(sh->S[1][1],44);
-        B[2][3]=rotl(sh->S[1][2],10);
-        B[3][1]=rotl(sh->S[1][3],45);
-        B[4][4]=rotl(sh->S[1][4],2);
-
-        B[0][4]=rotl(sh->S[2][0],62);
-        B[1][2]=rotl(sh->S[2][1],6);
-        B[2][0]=rotl(sh->S[2][2],43);
-        B[3][3]=rotl(sh->S[2][3],15);
-        B[4][1]=rotl(sh->S[2][4],61);
-
-        B[0][1]=rotl(sh->S[3][0],28);
-        B[1][4]=rotl(sh->S[3][1],55);
-        B[2][2]=rotl(sh->S[3][2],25);
-        B[3][0]=rotl(sh->S[3][3],21);
-        B[4][3]=rotl(sh->S[3][4],56);
-
-        B[0][3]=rotl(sh->S[4][0],27);
-        B[1][1]=rotl(sh->S[4][1],20);
-        B[2][4]=rotl(sh->S[4][2],39);
-        B[3][2]=rotl(sh->S[4][3],8);
-        B[4][0]=rotl(sh->S[4][4],14);
-
-        for (int i=0; i<5; i++)
-            for (int j=0; j<5; j++)
-                sh->S[i][j]=B[i][j]^(~B[(i+1)%5][j]&B[(i+2)%5][j]);
-
-        sh->S[0][0]^=RC[k];
+        KECCAK_ROUND(k,A,E)
+        KECCAK_ROUND(k+1,E,A)
     }
+
+    sh->S[0][0]=Aba;
+    sh->S[1][0]=~Abe;
+    sh->S[2][0]=~Abi;
+    sh->S[3][0]=Abo;
+    sh->S[4][0]=Abu;
+    sh->S[0][1]=Aga;
+    sh->S[1][1]=Age;
+    sh->S[2][1]=Agi;
+    sh->S[3][1]=~Ago;
+    sh->S[4][1]=Agu;
+    sh->S[0][2]=Aka;
+    sh->S[1][2]=Ake;
+    sh->S[2][2]=~Aki;
+    sh->S[3][2]=Ako;
+    sh->S[4][2]=Aku;
+    sh->S[0][3]=Ama;
+    sh->S[1][3]=Ame;
+    sh->S[2][3]=~Ami;
+    sh->S[3][3]=Amo;
+    sh->S[4][3]=Amu;
+    sh->S[0][4]=~Asa;
+    sh->S[1][4]=Ase;
+    sh->S[2][4]=Asi;
+    sh->S[3][4]=Aso;
+    sh->S[4][4]=Asu;
 }
 
 /* Re-Initialize. olen is output length in bytes -
@@ -482,70 +569,89 @@ void SHA3_process(sha3 *sh,int byt)
     cnt/=8;
     i=cnt%5;
     j=cnt/5;  /* process by columns! */
-    sh->S[i][j]^=((unsign64)byt<<(8*b));
+    sh->S[i][j]^=((unsign64)(byt&0xff)<<(8*b));
     sh->length++;
     if (sh->length%sh->rate==0) SHA3_transform(sh);
 }
 
-/* squeeze the sponge */
+/* process an array of bytes, a whole lane at a time where possible.
+   The rate is always a multiple of 8, so lanes never straddle a block */
+void SHA3_absorb(sha3 *sh,const char *buff,int len)
+{
+    int i=0;
+    int cnt;
+    unsign64 el;
+    const uchar *b=(const uchar *)buff;
+
+    while (i<len && sh->length%8!=0) SHA3_process(sh,b[i++]);
+
+    while (len-i>=8)
+    {
+        el=(unsign64)b[i]|((unsign64)b[i+1]<<8)|((unsign64)b[i+2]<<16)|((unsign64)b[i+3]<<24)|
+           ((unsign64)b[i+4]<<32)|((unsign64)b[i+5]<<40)|((unsign64)b[i+6]<<48)|((unsign64)b[i+7]<<56);
+        cnt=(int)(sh->length%sh->rate)/8;
+        sh->S[cnt%5][cnt/5]^=el;
+        sh->length+=8;
+        i+=8;
+        if (sh->length%sh->rate==0) SHA3_transform(sh);
+    }
+
+    while (i<len) SHA3_process(sh,b[i++]);
+}
+
+/* apply the domain separation byte and pad10*1, leaving the final
+   permutation to the first squeeze */
+static void SHA3_pad(sha3 *sh,int dom)
+{
+    int cnt=(int)(sh->length%sh->rate);
+    int l=cnt/8;
+    sh->S[l%5][l/5]^=((unsign64)dom<<(8*(cnt%8)));
+    l=(sh->rate-1)/8;
+    sh->S[l%5][l/5]^=((unsign64)0x80<<56);
+    sh->length+=sh->rate-cnt;
+}
+
+/* squeeze the sponge. Successive calls continue the output stream,
+   a new permutation is applied whenever a full block has been consumed */
 void SHA3_squeeze(sha3 *sh,char *buff,int len)
 {
-    int done;
     int m=0;
+    int cnt;
     unsign64 el;
-    /* extract by columns */
-    done=0;
-    for (;;)
+
+    while (m<len)
     {
-        for (int j=0; j<5; j++)
+        cnt=(int)(sh->length%sh->rate);
+        if (cnt==0) SHA3_transform(sh);
+        el=sh->S[(cnt/8)%5][cnt/40]>>(8*(cnt%8));
+        if (cnt%8==0 && len-m>=8)
         {
-            for (int i=0; i<5; i++)
+            /* extract by lanes */
+            for (int k=0; k<8; k++)
             {
-                el=sh->S[i][j];
-                for (int k=0; k<8; k++)
-                {
-                    buff[m++]=(el&0xff);
-                    if (m>=len || m%sh->rate==0)
-                    {
-                        done=1;
-                        break;
-                    }
-                    el>>=8;
-                }
-                if (done) break;
+                buff[m++]=(char)(el&0xff);
+                el>>=8;
             }
-            if (done) break;
+            sh->length+=8;
+        }
+        else
+        {
+            buff[m++]=(char)(el&0xff);
+            sh->length++;
         }
-        if (m>=len) break;
-        done=0;
-        SHA3_transform(sh);
     }
 }
 
 void SHA3_hash(sha3 *sh,char *hash)
 {
     /* generate a SHA3 hash of appropriate size */
-    int q=sh->rate-(sh->length%sh->rate);
-    if (q==1) SHA3_process(sh,0x86);
-    else
-    {
-        SHA3_process(sh,0x06);   /* 0x06 for SHA-3 */
-        while ((int)sh->length%sh->rate!=sh->rate-1) SHA3_process(sh,0x00);
-        SHA3_process(sh,0x80); /* this will force a final transform */
-    }
+    SHA3_pad(sh,0x06);   /* 0x06 for SHA-3 */
     SHA3_squeeze(sh,hash,sh->len);
 }
 
 void SHA3_shake(sha3 *sh,char *buff,int len)
 {
     /* SHAKE out a buffer of variable length len */
-    int q=sh->rate-(sh->length%sh->rate);
-    if (q==1) SHA3_process(sh,0x9f);
-    else
-    {
-        SHA3_process(sh,0x1f);   // 0x06 for SHA-3 !!!!
-        while ((int) sh->length%sh->rate!=sh->rate-1) SHA3_process(sh,0x00);
-        SHA3_process(sh,0x80); /* this will force a final transform */
-    }
+    SHA3_pad(sh,0x1f);   /* 0x1f for SHAKE */
     SHA3_squeeze(sh,buff,len);
 }
@@ -68,11 +68,14 @@ int HKDF_SHA256_expand(char *okm, unsigned int okmlen,
     char count = 0x01;
     char tmp[SHA256_HASH_SIZE];
 
-    hmac_sha256 ctx;
-    ret |= HMAC_SHA256_init(&ctx, prk, SHA256_HASH_SIZE);
-    ret |= HMAC_SHA256_update(&(ctx.sha256_ctx), info, infolen);
-    ret |= HMAC_SHA256_update(&(ctx.sha256_ctx), &count, 1);
-    ret |= HMAC_SHA256_final(&ctx, tmp, SHA256_HASH_SIZE);
+    // The PRK is the HMAC key of every block, so only absorb it once
+    hmac_sha256_key key;
+    hash256 ctx;
+    ret |= HMAC_SHA256_key_init(&key, prk, SHA256_HASH_SIZE);
+    ret |= HMAC_SHA256_key_start(&key, &ctx);
+    ret |= HMAC_SHA256_update(&ctx, info, infolen);
+    ret |= HMAC_SHA256_update(&ctx, &count, 1);
+    ret |= HMAC_SHA256_key_final(&key, &ctx, tmp, SHA256_HASH_SIZE);
 
     while (okmlen > SHA256_HASH_SIZE) {
         count++;
@@ -80,15 +83,17 @@ int HKDF_SHA256_expand(char *okm, unsigned int okmlen,
             okm[i] = tmp[i];
         okm     += SHA256_HASH_SIZE;
         okmlen  -= SHA256_HASH_SIZE;
-        ret |= HMAC_SHA256_init(&ctx, prk, SHA256_HASH_SIZE);
-        ret |= HMAC_SHA256_update(&(ctx.sha256_ctx), tmp, SHA256_HASH_SIZE);
-        ret |= HMAC_SHA256_update(&(ctx.sha256_ctx), info, infolen);
-        ret |= HMAC_SHA256_update(&(ctx.sha256_ctx), &count, 1);
-        ret |= HMAC_SHA256_final(&ctx, tmp, SHA256_HASH_SIZE);
+        ret |= HMAC_SHA256_key_start(&key, &ctx);
+        ret |= HMAC_SHA256_update(&ctx, tmp, SHA256_HASH_SIZE);
+        ret |= HMAC_SHA256_update(&ctx, info, infolen);
+        ret |= HMAC_SHA256_update(&ctx, &count, 1);
+        ret |= HMAC_SHA256_key_final(&key, &ctx, tmp, SHA256_HASH_SIZE);
     }
 
     for(i = 0; i < okmlen; i++)
         okm[i] = tmp[i];
 
+    HMAC_SHA256_key_clear(&key);
+
     return ret;
 }
@@ -110,61 +110,133 @@ int HMAC_SHA256_final(hmac_sha256 *ctx, char* out, int outlen)
     return SUCCESS;
 }
 
-int HMAC_SHA256_oneshot(char* out,  int outlen,
-    const char* key,  int keylen,
-    const char* in,  int inlen)
+int HMAC_SHA256_key_init(hmac_sha256_key *key, const char* k, int klen)
 {
-    if (out == NULL || key == NULL || in == NULL)
+    if (key == NULL || k == NULL)
         return ERR_NULLPOINTER_HMAC;
-    if (keylen < SHA256_HASH_SIZE)
+    if (klen < SHA256_HASH_SIZE)
         return ERR_KEYSIZE_HMAC;
-    if (outlen <= 0 || outlen > SHA256_HASH_SIZE || inlen < 0)
-        return ERR_BADARGLEN_HMAC;
 
     int i;
-    hash256 sha256;
     char ipad = 0x36;
     char opad = 0x5c;
     char k0[SHA256_BLOCK_SIZE];
-    char digest[SHA256_HASH_SIZE];
 
-    HASH256_init(&sha256);
+    HASH256_init(&(key->ipad_ctx));
+    HASH256_init(&(key->opad_ctx));
     // Fill k0 with 0s for future padding
     for(i = 0; i < SHA256_BLOCK_SIZE; i++)
         k0[i] = 0x00;
 
     // If the key size is larger than the block size, then hash it
-    if (keylen > SHA256_BLOCK_SIZE) {
-        for(i = 0; i < keylen; i++)
-            HASH256_process(&sha256, key[i]);
-        HASH256_hash(&sha256, k0);
+    if (klen > SHA256_BLOCK_SIZE) {
+        for(i = 0; i < klen; i++)
+            HASH256_process(&(key->ipad_ctx), k[i]);
+        HASH256_hash(&(key->ipad_ctx), k0);
     }
     // Otherwise the key is simply padded with 0s into k0
     else {
-        for(i = 0; i < keylen; i++)
-            k0[i] = key[i];
+        for(i = 0; i < klen; i++)
+            k0[i] = k[i];
     }
 
-    // Compute H((k0 ^ ipad) || in)
-    for(i = 0; i < SHA256_BLOCK_SIZE; i++)
-        HASH256_process(&sha256, k0[i] ^ ipad);
-    for(i = 0; i < inlen; i++)
-        HASH256_process(&sha256, in[i]);
-    HASH256_hash(&sha256, digest);
-
-    // Compute `H((k0 ^ opad ) || H((k0 ^ ipad) || in))`
-    for(i = 0; i < SHA256_BLOCK_SIZE; i++)
-        HASH256_process(&sha256, k0[i] ^ opad);
-    for(i = 0; i < SHA256_HASH_SIZE; i++)
-        HASH256_process(&sha256, digest[i]);
-    HASH256_hash(&sha256, digest);
+    // Snapshot the states after one block of k0 ^ ipad and k0 ^ opad
+    for(i = 0; i < SHA256_BLOCK_SIZE; i++) {
+        HASH256_process(&(key->ipad_ctx), k0[i] ^ ipad);
+        HASH256_process(&(key->opad_ctx), k0[i] ^ opad);
+    }
 
     // Erase the secret key as it is not needed anymore
     for(i = 0; i < SHA256_BLOCK_SIZE; i++)
         k0[i] = 0x00;
 
+    return SUCCESS;
+}
+
+int HMAC_SHA256_key_start(const hmac_sha256_key *key, hash256 *sha256_ctx)
+{
+    if (key == NULL || sha256_ctx == NULL)
+        return ERR_NULLPOINTER_HMAC;
+
+    // Resume from H(k0 ^ ipad || ...
+    *sha256_ctx = key->ipad_ctx;
+
+    return SUCCESS;
+}
+
+int HMAC_SHA256_key_final(const hmac_sha256_key *key, hash256 *sha256_ctx,
+    char* out, int outlen)
+{
+    if (key == NULL || sha256_ctx == NULL || out == NULL)
+        return ERR_NULLPOINTER_HMAC;
+    if (outlen <= 0 || outlen > SHA256_HASH_SIZE)
+        return ERR_BADARGLEN_HMAC;
+
+    int i;
+    char digest[SHA256_HASH_SIZE];
+
+    // Compute H((k0 ^ ipad) || in)
+    HASH256_hash(sha256_ctx, digest);
+
+    // Compute `H((k0 ^ opad ) || H((k0 ^ ipad) || in))`
+    *sha256_ctx = key->opad_ctx;
+    for(i = 0; i < SHA256_HASH_SIZE; i++)
+        HASH256_process(sha256_ctx, digest[i]);
+    HASH256_hash(sha256_ctx, digest);
+
     for(i = 0; i < outlen; i++)
         out[i] = digest[i];
 
     return SUCCESS;
 }
+
+int HMAC_SHA256_key_oneshot(char* out, int outlen,
+    const hmac_sha256_key *key,
+    const char* in, int inlen)
+{
+    if (out == NULL || key == NULL || in == NULL)
+        return ERR_NULLPOINTER_HMAC;
+    if (outlen <= 0 || outlen > SHA256_HASH_SIZE || inlen < 0)
+        return ERR_BADARGLEN_HMAC;
+
+    hash256 sha256;
+
+    HMAC_SHA256_key_start(key, &sha256);
+    for(int i = 0; i < inlen; i++)
+        HASH256_process(&sha256, in[i]);
+
+    return HMAC_SHA256_key_final(key, &sha256, out, outlen);
+}
+
+void HMAC_SHA256_key_clear(hmac_sha256_key *key)
+{
+    if (key == NULL)
+        return;
+
+    HASH256_init(&(key->ipad_ctx));
+    HASH256_init(&(key->opad_ctx));
+}
+
+int HMAC_SHA256_oneshot(char* out,  int outlen,
+    const char* key,  int keylen,
+    const char* in,  int inlen)
+{
+    if (out == NULL || key == NULL || in == NULL)
+        return ERR_NULLPOINTER_HMAC;
+    if (keylen < SHA256_HASH_SIZE)
+        return ERR_KEYSIZE_HMAC;
+    if (outlen <= 0 || outlen > SHA256_HASH_SIZE || inlen < 0)
+        return ERR_BADARGLEN_HMAC;
+
+    int ret;
+    hmac_sha256_key k;
+
+    ret = HMAC_SHA256_key_init(&k, key, keylen);
+    if (ret == SUCCESS)
+        ret = HMAC_SHA256_key_oneshot(out, outlen, &k, in, inlen);
+
+    // Erase the secret key as it is not needed anymore
+    HMAC_SHA256_key_clear(&k);
+
+    return ret;
+}
@@ -23,6 +23,62 @@ under the License.
 #include <string.h>
 #include "amcl.h"
 
+/* hex digit pairs for each byte value */
+static const char HEXPAIRS[513]=
+    "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f"
+    "202122232425262728292a2b2c2d2e2f303132333435363738393a3b3c3d3e3f"
+    "404142434445464748494a4b4c4d4e4f505152535455565758595a5b5c5d5e5f"
+    "606162636465666768696a6b6c6d6e6f707172737475767778797a7b7c7d7e7f"
+    "808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f"
+    "a0a1a2a3a4a5a6a7a8a9aaabacadaeafb0b1b2b3b4b5b6b7b8b9babbbcbdbebf"
+    "c0c1c2c3c4c5c6c7c8c9cacbcccdcecfd0d1d2d3d4d5d6d7d8d9dadbdcdddedf"
+    "e0e1e2e3e4e5e6e7e8e9eaebecedeeeff0f1f2f3f4f5f6f7f8f9fafbfcfdfeff";
+
+/* hex digit values, 0xff if not a hex digit */
+static const unsigned char HEXVAL[256]=
+{
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+};
+
+/* base64 alphabet */
+static const char B64CHARS[65]="ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/* base64 digit values, 0xff if not in the alphabet */
+static const unsigned char B64VAL[256]=
+{
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x3e,0xff,0xff,0xff,0x3f,
+    0x34,0x35,0x36,0x37,0x38,0x39,0x3a,0x3b,0x3c,0x3d,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,
+    0x0f,0x10,0x11,0x12,0x13,0x14,0x15,0x16,0x17,0x18,0x19,0xff,0xff,0xff,0xff,0xff,
+    0xff,0x1a,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x22,0x23,0x24,0x25,0x26,0x27,0x28,
+    0x29,0x2a,0x2b,0x2c,0x2d,0x2e,0x2f,0x30,0x31,0x32,0x33,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+};
+
 /* Output an octet string (Debug Only) */
 
 /* SU= 16 */
@@ -49,6 +105,22 @@ void OCT_output_string(const octet *w)
     }
 }
 
+/* Make an octet that refers to existing memory, rather than owning a copy */
+void OCT_view(octet *y,char *b,int len)
+{
+    y->len=len;
+    y->max=len;
+    y->val=b;
+}
+
+/* Make y refer to len bytes of x starting at offset start */
+int OCT_subview(octet *y,const octet *x,int start,int len)
+{
+    if (start<0 || len<0 || start>x->len-len) return 0;
+    OCT_view(y,x->val+start,len);
+    return 1;
+}
+
 /* Convert C string to octet format - truncates if no room  */
 void OCT_jstring(octet *y,const char *s)
 {
@@ -232,92 +304,127 @@ int OCT_pad(octet *w,int n)
 }
 
 
+/* base64 encode n bytes of w into b, returning the number of characters written */
+static int b64encode(char *b,const char *w,int n)
+{
+    int j;
+    int k=0;
+    unsigned int t;
+    for (j=0; j+3<=n; j+=3)
+    {
+        t=((unsigned int)(unsigned char)w[j]<<16)|((unsigned int)(unsigned char)w[j+1]<<8)|(unsigned int)(unsigned char)w[j+2];
+        b[k]=B64CHARS[(t>>18)&0x3f];
+        b[k+1]=B64CHARS[(t>>12)&0x3f];
+        b[k+2]=B64CHARS[(t>>6)&0x3f];
+        b[k+3]=B64CHARS[t&0x3f];
+        k+=4;
+    }
+    if (j<n)
+    {
+        t=(unsigned int)(unsigned char)w[j]<<16;
+        if (j+1<n) t|=(unsigned int)(unsigned char)w[j+1]<<8;
+        b[k]=B64CHARS[(t>>18)&0x3f];
+        b[k+1]=B64CHARS[(t>>12)&0x3f];
+        b[k+2]=(j+1<n) ? B64CHARS[(t>>6)&0x3f] : '=';
+        b[k+3]='=';
+        k+=4;
+    }
+    return k;
+}
+
 /* Convert an octet string to base64 string */
 /* SU= 56 */
 void OCT_tobase64(char *b,const octet *w)
 {
-    int i;
+    int k=b64encode(b,w->val,w->len);
+    b[k]='\0';  /* dangerous! */
+}
+
+/* Convert an octet string to base64 string, with bounds checking */
+int OCT_tobase64Len(const octet *w,char *b,int blen)
+{
+    int k=4*((w->len+2)/3);
+    if (blen<k+1) return -1;
+    b64encode(b,w->val,w->len);
+    b[k]='\0';
+    return k;
+}
+
+/* Populate an octet from a base64 string of given length, with bounds checking */
+int OCT_frombase64Len(octet *w,const char *b,int blen)
+{
     int j;
-    int k;
-    int rem;
-    int last;
-    int c;
-    int ch[4];
-    unsigned char ptr[3];
-    rem=w->len%3;
-    j=k=0;
-    last=4;
-    while (j<w->len)
+    int k=0;
+    int pads=0;
+    unsigned int t;
+    unsigned int err=0;
+    const unsigned char *ub=(const unsigned char *)b;
+
+    w->len=0;
+    if (blen%4!=0) return -1;
+    if (blen>0 && b[blen-1]=='=') pads++;
+    if (blen>1 && b[blen-2]=='=') pads++;
+    if (3*(blen/4)-pads>w->max) return -1;
+
+    /* whole blocks, with no branches on the data */
+    for (j=0; j+4<=blen-(pads>0?4:0); j+=4)
     {
-        for (i=0; i<3; i++)
-        {
-            if (j<w->len) ptr[i]=w->val[j++];
-            else
-            {
-                ptr[i]=0;
-                last--;
-            }
-        }
-        ch[0]=(ptr[0]>>2)&0x3f;
-        ch[1]=((ptr[0]<<4)|(ptr[1]>>4))&0x3f;
-        ch[2]=((ptr[1]<<2)|(ptr[2]>>6))&0x3f;
-        ch[3]=ptr[2]&0x3f;
-        for (i=0; i<last; i++)
-        {
-            c=ch[i];
-            if (c<26) c+=65;
-            if (c>=26 && c<52) c+=71;
-            if (c>=52 && c<62) c-=4;
-            if (c==62) c='+';
-            if (c==63) c='/';
-            b[k++]=(char)c;
-        }
+        err|=B64VAL[ub[j]]|B64VAL[ub[j+1]]|B64VAL[ub[j+2]]|B64VAL[ub[j+3]];
+        t=((unsigned int)B64VAL[ub[j]]<<18)|((unsigned int)B64VAL[ub[j+1]]<<12)|((unsigned int)B64VAL[ub[j+2]]<<6)|(unsigned int)B64VAL[ub[j+3]];
+        w->val[k]=(char)(t>>16);
+        w->val[k+1]=(char)(t>>8);
+        w->val[k+2]=(char)t;
+        k+=3;
     }
-    if (rem>0) for (i=rem; i<3; i++) b[k++]='=';
-    b[k]='\0';  /* dangerous! */
+    /* final padded block */
+    if (pads>0)
+    {
+        err|=B64VAL[ub[j]]|B64VAL[ub[j+1]];
+        if (pads==1) err|=B64VAL[ub[j+2]];
+        t=((unsigned int)B64VAL[ub[j]]<<18)|((unsigned int)B64VAL[ub[j+1]]<<12);
+        if (pads==1) t|=(unsigned int)B64VAL[ub[j+2]]<<6;
+        w->val[k++]=(char)(t>>16);
+        if (pads==1) w->val[k++]=(char)(t>>8);
+    }
+    if (err&0x80)
+    {
+        OCT_clear(w);
+        return -1;
+    }
+    w->len=k;
+    return k;
 }
 
 /* SU= 56 */
 void OCT_frombase64(octet *w,const char *b)
 {
-    int i;
     int j;
-    int k;
-    int pads;
-    int len=(int)strlen(b);
-    int c;
-    int ch[4];
-    int ptr[3];
+    int n=0;
+    int k=0;
+    unsigned int v;
+    unsigned int t=0;
+    const unsigned char *ub=(const unsigned char *)b;
     OCT_clear(w);
 
-    j=k=0;
-    while (j<len && k<w->max)
+    /* characters outside the alphabet, such as white space and pads '=', are ignored */
+    for (j=0; ub[j]!=0 && k<w->max; j++)
     {
-        pads=0;
-        for (i=0; i<4; i++)
-        {
-            c=80+b[j++];
-            if (c<=112) continue; /* ignore white space */
-            if (c>144 && c<171) c-=145;
-            if (c>176 && c<203) c-=151;
-            if (c>127 && c<138) c-=76;
-            if (c==123) c=62;
-            if (c==127) c=63;
-            if (c==141)
-            {
-                pads++;    /* ignore pads '=' */
-                continue;
-            }
-            ch[i]=c;
-        }
-        ptr[0]=(ch[0]<<2)|(ch[1]>>4);
-        ptr[1]=(ch[1]<<4)|(ch[2]>>2);
-        ptr[2]=(ch[2]<<6)|ch[3];
-        for (i=0; i<3-pads && k<w->max; i++)
-        {
-            /* don't put in leading zeros */
-            w->val[k++]=(char)ptr[i];
-        }
+        v=B64VAL[ub[j]];
+        if (v==0xff) continue;
+        t=(t<<6)|v;
+        if (++n<4) continue;
+        w->val[k++]=(char)(t>>16);
+        if (k<w->max) w->val[k++]=(char)(t>>8);
+        if (k<w->max) w->val[k++]=(char)t;
+        n=0;
+        t=0;
+    }
+    /* final padded block, of 2 or 3 digits */
+    if (n>=2 && k<w->max)
+    {
+        t<<=6*(4-n);
+        w->val[k++]=(char)(t>>16);
+        if (n==3 && k<w->max) w->val[k++]=(char)(t>>8);
     }
     w->len=k;
 }
@@ -364,53 +471,86 @@ void OCT_rand(octet *x,csprng *RNG,int len)
     if (len>x->max) len=x->max;
     x->len=len;
 
-    for (int i=0; i<len; i++) x->val[i]=(char)RAND_byte(RNG);
+    RAND_bytes(RNG,x->val,len);
 }
 
-/* Convert an octet to a hex string */
-void OCT_toHex(const octet *src,char *dst)
+/* hex encode n bytes of src into dst */
+static void hexencode(char *dst,const char *src,int n)
 {
-    int i;
-    const char * hexadecimals = "0123456789abcdef";
-    unsigned char ch;
-    for (i=0; i<src->len; i++)
+    const char *p;
+    for (int i=0; i<n; i++)
     {
-        ch=src->val[i];
-        uint8_t res = ch / 16;
-        uint8_t mod = ch % 16;
-        dst[i*2] = hexadecimals[res];
-        dst[(i*2)+1] = hexadecimals[mod];
+        p=&HEXPAIRS[2*(unsigned char)src[i]];
+        dst[2*i]=p[0];
+        dst[2*i+1]=p[1];
     }
-    dst[i*2] =0;
+    dst[2*n]=0;
+}
+
+/* Convert an octet to a hex string */
+void OCT_toHex(const octet *src,char *dst)
+{
+    hexencode(dst,src->val,src->len);
 }
 
-static int char2int(char input)
+/* Convert an octet to a hex string, with bounds checking */
+int OCT_toHexLen(const octet *src,char *dst,int dlen)
 {
-    if(input >= '0' && input <= '9')
-        return input - '0';
-    if(input >= 'A' && input <= 'F')
-        return input - 'A' + 10;
-    if(input >= 'a' && input <= 'f')
-        return input - 'a' + 10;
-    return 0;
+    if (dlen<2*src->len+1) return -1;
+    hexencode(dst,src->val,src->len);
+    return 2*src->len;
 }
 
-/* Convert from a hex string */
+/* Convert from a hex string - non hex digits are taken as 0 */
 void OCT_fromHex(octet *dst,const char *src)
 {
     int i=0;
     int j=0;
     int len = (int)strlen(src);
+    unsigned int hi;
+    unsigned int lo;
     OCT_clear(dst);
 
     while(j < len && i < dst->max)
     {
-        dst->val[i++] = (char)(char2int(src[j])*16 + char2int(src[j+1]));
+        hi=HEXVAL[(unsigned char)src[j]];
+        lo=HEXVAL[(unsigned char)src[j+1]];
+        hi&=(hi>>7)-1;
+        lo&=(lo>>7)-1;
+        dst->val[i++] = (char)((hi<<4)|lo);
         j += 2;
     }
     dst->len=i;
 }
 
+/* Convert from a hex string of given length, with bounds checking */
+int OCT_fromHexLen(octet *dst,const char *src,int slen)
+{
+    int n=slen/2;
+    unsigned int hi;
+    unsigned int lo;
+    unsigned int err=0;
+    const unsigned char *us=(const unsigned char *)src;
+
+    dst->len=0;
+    if (slen%2!=0 || n>dst->max) return -1;
+
+    for (int i=0; i<n; i++)
+    {
+        hi=HEXVAL[us[2*i]];
+        lo=HEXVAL[us[2*i+1]];
+        err|=hi|lo;
+        dst->val[i]=(char)((hi<<4)|lo);
+    }
+    if (err&0x80)
+    {
+        OCT_clear(dst);
+        return -1;
+    }
+    dst->len=n;
+    return n;
+}
+
 /* Convert an octet to a string */
 void OCT_toStr(const octet *src,char *dst)
 {
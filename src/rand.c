@@ -96,37 +96,229 @@ static unsign32 pack(const uchar *b)
     return ((unsign32)b[3]<<24)|((unsign32)b[2]<<16)|((unsign32)b[1]<<8)|(unsign32)b[0];
 }
 
+/* stir distilled raw randomness into the Marsaglia & Zaman generator */
+static void mz_stir(csprng *rng,int rawlen,const char *raw)
+{
+    int i;
+    char digest[32];
+    uchar b[4];
+    hash256 sh;
+    HASH256_init(&sh);
+    for (i=0; i<rawlen; i++)
+        HASH256_process(&sh,raw[i]);
+    HASH256_hash(&sh,digest);
+
+    /* initialise PRNG from distilled randomness */
+
+    for (i=0; i<8; i++)
+    {
+        b[0]=digest[4*i];
+        b[1]=digest[4*i+1];
+        b[2]=digest[4*i+2];
+        b[3]=digest[4*i+3];
+        sirand(rng,pack(b));
+    }
+    for (i=0; i<32; i++) digest[i]=0;
+}
+
+/* HMAC_DRBG (SP 800-90A 10.1.2) update function, with provided data d of length n */
+static void hmac_drbg_update(csprng *rng,const char *d,int n)
+{
+    char c;
+    hash256 sh;
+    hmac_sha256_key key;
+
+    for (c=0; c<2; c++)
+    {
+        if (c==1 && n==0) break;
+        /* K = HMAC(K, V || c || d) */
+        HMAC_SHA256_key_init(&key,rng->K,32);
+        HMAC_SHA256_key_start(&key,&sh);
+        HMAC_SHA256_update(&sh,rng->V,32);
+        HMAC_SHA256_update(&sh,&c,1);
+        HMAC_SHA256_update(&sh,d,n);
+        HMAC_SHA256_key_final(&key,&sh,rng->K,32);
+        /* V = HMAC(K, V) */
+        HMAC_SHA256_key_init(&key,rng->K,32);
+        HMAC_SHA256_key_oneshot(rng->V,32,&key,rng->V,32);
+    }
+    HMAC_SHA256_key_clear(&key);
+}
+
+/* HMAC_DRBG generate function, n<=DRBG_MAX_REQUEST */
+static void hmac_drbg_generate(csprng *rng,char *b,int n)
+{
+    int i=0;
+    hmac_sha256_key key;
+
+    /* the key is fixed for the whole request, so absorb it once */
+    HMAC_SHA256_key_init(&key,rng->K,32);
+    while (i<n)
+    {
+        HMAC_SHA256_key_oneshot(rng->V,32,&key,rng->V,32);
+        for (int j=0; j<32 && i<n; j++) b[i++]=rng->V[j];
+    }
+    HMAC_SHA256_key_clear(&key);
+    hmac_drbg_update(rng,NULL,0);
+}
+
+/* increment the 128-bit big-endian counter V */
+static void ctr_drbg_inc(csprng *rng)
+{
+    uchar *v=(uchar *)rng->V;
+    for (int i=15; i>=0; i--)
+    {
+        v[i]++;
+        if (v[i]!=0) break;
+    }
+}
+
+/* CTR_DRBG (SP 800-90A 10.2.1.2) update function, with 48 bytes of provided data d, or none if d is NULL */
+static void ctr_drbg_update(csprng *rng,const char *d)
+{
+    int i;
+    char temp[48];
+    amcl_aes a;
+
+    AES_init(&a,ECB,32,rng->K,NULL);
+    for (i=0; i<3; i++)
+    {
+        ctr_drbg_inc(rng);
+        for (int j=0; j<16; j++) temp[16*i+j]=rng->V[j];
+        AES_ecb_encrypt(&a,(uchar *)&temp[16*i]);
+    }
+    AES_end(&a);
+
+    if (d!=NULL)
+        for (i=0; i<48; i++) temp[i]^=d[i];
+
+    for (i=0; i<32; i++) rng->K[i]=temp[i];
+    for (i=0; i<16; i++) rng->V[i]=temp[32+i];
+    for (i=0; i<48; i++) temp[i]=0;
+}
+
+/* CTR_DRBG generate function, n<=DRBG_MAX_REQUEST */
+static void ctr_drbg_generate(csprng *rng,char *b,int n)
+{
+    int i=0;
+    uchar blk[16];
+    amcl_aes a;
+
+    /* one key schedule for the whole request */
+    AES_init(&a,ECB,32,rng->K,NULL);
+    while (i<n)
+    {
+        ctr_drbg_inc(rng);
+        for (int j=0; j<16; j++) blk[j]=(uchar)rng->V[j];
+        AES_ecb_encrypt(&a,blk);
+        for (int j=0; j<16 && i<n; j++) b[i++]=(char)blk[j];
+    }
+    AES_end(&a);
+    for (int j=0; j<16; j++) blk[j]=0;
+    ctr_drbg_update(rng,NULL);
+}
+
+/* reduce raw seed to the 48 byte CTR_DRBG seed length */
+static void ctr_drbg_seed_material(char *sm,int rawlen,const char *raw)
+{
+    int i;
+    hash384 sh;
+    if (rawlen==48)
+    {
+        for (i=0; i<48; i++) sm[i]=raw[i];
+        return;
+    }
+    HASH384_init(&sh);
+    for (i=0; i<rawlen; i++)
+        HASH384_process(&sh,raw[i]);
+    HASH384_hash(&sh,sm);
+}
+
+/* generate n bytes directly from the underlying generator, n<=DRBG_MAX_REQUEST */
+static void generate(csprng *rng,char *b,int n)
+{
+    switch (rng->type)
+    {
+    case RAND_HMAC_DRBG:
+        hmac_drbg_generate(rng,b,n);
+        break;
+    case RAND_CTR_DRBG:
+        ctr_drbg_generate(rng,b,n);
+        break;
+    default:
+        for (int i=0; i<n; i+=32)
+        {
+            fill_pool(rng);
+            for (int j=0; j<32 && i+j<n; j++) b[i+j]=rng->pool[j];
+        }
+        rng->pool_ptr=32;
+        break;
+    }
+}
+
 /* SU= 360 */
 /* Initialize RNG with some real entropy from some external source */
 void RAND_seed(csprng *rng,int rawlen,const char *raw)
+{
+    RAND_seed_type(rng,RAND_MZ,rawlen,raw);
+}
+
+/* Initialize RNG of type t with some real entropy from some external source */
+void RAND_seed_type(csprng *rng,int t,int rawlen,const char *raw)
 {
     /* initialise from at least 128 byte string of raw  *
      * random (keyboard?) input, and 32-bit time-of-day */
     int i;
-    char digest[32];
-    uchar b[4];
-    hash256 sh;
-    rng->pool_ptr=0;
+    char sm[48];
+    rng->type=t;
+    rng->pool_ptr=32; /* pool is empty */
+    rng->rndptr=0;
+    rng->borrow=0;
     for (i=0; i<NK; i++) rng->ira[i]=0;
-    if (rawlen>0)
+    for (i=0; i<32; i++) rng->K[i]=rng->V[i]=0;
+
+    switch (t)
     {
-        HASH256_init(&sh);
-        for (i=0; i<rawlen; i++)
-            HASH256_process(&sh,raw[i]);
-        HASH256_hash(&sh,digest);
+    case RAND_HMAC_DRBG:
+        for (i=0; i<32; i++) rng->V[i]=1;
+        hmac_drbg_update(rng,raw,rawlen);
+        break;
+    case RAND_CTR_DRBG:
+        ctr_drbg_seed_material(sm,rawlen,raw);
+        ctr_drbg_update(rng,sm);
+        for (i=0; i<48; i++) sm[i]=0;
+        break;
+    default:
+        rng->type=RAND_MZ;
+        if (rawlen>0) mz_stir(rng,rawlen,raw);
+        break;
+    }
+}
 
-        /* initialise PRNG from distilled randomness */
+/* Mix further entropy into a seeded RNG */
+void RAND_reseed(csprng *rng,int rawlen,const char *raw)
+{
+    int i;
+    char sm[48];
 
-        for (i=0; i<8; i++)
-        {
-            b[0]=digest[4*i];
-            b[1]=digest[4*i+1];
-            b[2]=digest[4*i+2];
-            b[3]=digest[4*i+3];
-            sirand(rng,pack(b));
-        }
+    switch (rng->type)
+    {
+    case RAND_HMAC_DRBG:
+        hmac_drbg_update(rng,raw,rawlen);
+        break;
+    case RAND_CTR_DRBG:
+        ctr_drbg_seed_material(sm,rawlen,raw);
+        ctr_drbg_update(rng,sm);
+        for (i=0; i<48; i++) sm[i]=0;
+        break;
+    default:
+        if (rawlen>0) mz_stir(rng,rawlen,raw);
+        break;
     }
-    fill_pool(rng);
+
+    /* discard anything generated from the old state */
+    for (i=0; i<32; i++) rng->pool[i]=0;
+    rng->pool_ptr=32;
 }
 
 /* Terminate and clean up */
@@ -137,15 +329,48 @@ void RAND_clean(csprng *rng)
     rng->pool_ptr=rng->rndptr=0;
     for (i=0; i<32; i++) rng->pool[i]=0;
     for (i=0; i<NK; i++) rng->ira[i]=0;
+    for (i=0; i<32; i++) rng->K[i]=rng->V[i]=0;
     rng->borrow=0;
+    rng->type=RAND_MZ;
 }
 
 /* get random byte */
 /* SU= 8 */
 int RAND_byte(csprng *rng)
 {
-    int r;
-    r=rng->pool[rng->pool_ptr++];
-    if (rng->pool_ptr>=32) fill_pool(rng);
-    return (r&0xff);
+    if (rng->pool_ptr>=32)
+    {
+        generate(rng,rng->pool,32);
+        rng->pool_ptr=0;
+    }
+    return (rng->pool[rng->pool_ptr++]&0xff);
+}
+
+/* get len random bytes */
+void RAND_bytes(csprng *rng,char *b,int len)
+{
+    int i=0;
+    int n;
+
+    /* use up whatever is left in the pool first */
+    while (i<len && rng->pool_ptr<32) b[i++]=rng->pool[rng->pool_ptr++];
+
+    if (rng->type==RAND_MZ)
+    {
+        /* keep the pool in step, so the output is that of repeated RAND_byte calls */
+        while (i<len)
+        {
+            fill_pool(rng);
+            for (; i<len && rng->pool_ptr<32; i++) b[i]=rng->pool[rng->pool_ptr++];
+        }
+        return;
+    }
+
+    while (i<len)
+    {
+        n=len-i;
+        if (n>DRBG_MAX_REQUEST) n=DRBG_MAX_REQUEST;
+        generate(rng,&b[i],n);
+        i+=n;
+    }
 }
@@ -17,8 +17,35 @@ specific language governing permissions and limitations
 under the License.
 */
 
+#include <stdio.h>
 #include "randapi.h"
 
+#if defined(_WIN32)
+#include <process.h>
+#define RAND_GETPID() _getpid()
+#else
+#include <unistd.h>
+#define RAND_GETPID() getpid()
+#endif
+
+#if defined(_MSC_VER)
+#define RAND_THREAD_LOCAL __declspec(thread)
+#else
+#define RAND_THREAD_LOCAL __thread
+#endif
+
+/* Per-thread generator state */
+typedef struct
+{
+    csprng R;       /* the generator */
+    int seeded;     /* 1 once seeded */
+    long pid;       /* process that seeded it, to detect fork() */
+    int uses;       /* THREAD_CSPRNG calls since the last (re)seed */
+} thread_csprng;
+
+static csprng_entropy entropy_source=NULL;
+static RAND_THREAD_LOCAL thread_csprng thread_rng;
+
 /* Initialise a Cryptographically Strong Random Number Generator from
    an octet of raw random data */
 
@@ -27,8 +54,84 @@ void CREATE_CSPRNG(csprng *RNG,const octet *RAW)
     RAND_seed(RNG,RAW->len,RAW->val);
 }
 
+/* Initialise a Cryptographically Strong Random Number Generator of a given type */
+
+void CREATE_CSPRNG_TYPE(csprng *RNG,int type,const octet *RAW)
+{
+    RAND_seed_type(RNG,type,RAW->len,RAW->val);
+}
+
 void KILL_CSPRNG(csprng *RNG)
 {
     RAND_clean(RNG);
 }
 
+
+/* Read entropy from the operating system */
+static int urandom_entropy(char *b,int len)
+{
+    FILE *fp=fopen("/dev/urandom","rb");
+    if (fp==NULL) return 1;
+    /* no buffering, so no entropy is left behind in the stream */
+    setvbuf(fp,NULL,_IONBF,0);
+    int n=(int)fread(b,1,(size_t)len,fp);
+    fclose(fp);
+    return (n==len) ? 0 : 1;
+}
+
+static int get_entropy(char *b,int len)
+{
+    csprng_entropy f=entropy_source;
+    if (f==NULL) f=urandom_entropy;
+    return f(b,len);
+}
+
+void SET_CSPRNG_ENTROPY(csprng_entropy f)
+{
+    entropy_source=f;
+}
+
+csprng *THREAD_CSPRNG(void)
+{
+    int fail=0;
+    char raw[RAND_THREAD_SEED_BYTES];
+    thread_csprng *T=&thread_rng;
+    long pid=(long)RAND_GETPID();
+
+    if (!T->seeded || T->pid!=pid)
+    {
+        /* first use in this thread, or a fork()ed child that must not repeat its parent's output */
+        fail=get_entropy(raw,RAND_THREAD_SEED_BYTES);
+        if (!fail)
+        {
+            RAND_seed_type(&T->R,RAND_HMAC_DRBG,RAND_THREAD_SEED_BYTES,raw);
+            T->seeded=1;
+            T->pid=pid;
+            T->uses=0;
+        }
+    }
+    else if (T->uses>=RAND_THREAD_RESEED)
+    {
+        fail=get_entropy(raw,RAND_THREAD_SEED_BYTES);
+        if (!fail)
+        {
+            RAND_reseed(&T->R,RAND_THREAD_SEED_BYTES,raw);
+            T->uses=0;
+        }
+    }
+
+    for (int i=0; i<RAND_THREAD_SEED_BYTES; i++) raw[i]=0;
+    if (fail) return NULL;
+
+    T->uses++;
+    return &T->R;
+}
+
+void KILL_THREAD_CSPRNG(void)
+{
+    thread_csprng *T=&thread_rng;
+    RAND_clean(&T->R);
+    T->seeded=0;
+    T->pid=0;
+    T->uses=0;
+}
@@ -47,6 +47,12 @@ const BIG_384_29 CURVE_Pxa_BLS381= {0x121BDB8,0x402B646,0x16EFBF5,0x18064D50,0x1
 const BIG_384_29 CURVE_Pxb_BLS381= {0x1D042B7E,0xD63E82A,0x51755F9,0x19E22427,0x15049334,0x10DDEE3F,0x186AD769,0x1A132416,0x5596BD0,0x4413A7B,0x1F6B34E8,0x4E33EC0,0x1E02B605,0x9};
 const BIG_384_29 CURVE_Pya_BLS381= {0x8B82801,0xC9AA430,0xB28A278,0x15939877,0xD12C923,0xD34A8B0,0xE9DB50A,0x155197BA,0x1AADFD9B,0x16D171A8,0x3327371,0x4FADC23,0xE5D5277,0x6};
 const BIG_384_29 CURVE_Pyb_BLS381= {0x105F79BE,0x15483AFF,0x1B07686A,0xE1A4EB9,0x99AB3F3,0x955AB97,0xEBC99D2,0xFD0B4EC,0x19CB3E28,0x15E145C,0xCAB34AC,0x1D4E6998,0x6C4A02,0x3};
+// Frobenius endomorphism psi coefficients, in Montgomery form
+const BIG_384_29 CURVE_Psixa_BLS381= {0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+const BIG_384_29 CURVE_Psixb_BLS381= {0x154030C4,0x16ACEB14,0x1814E947,0x1FBA3004,0x2E0FC81,0xFB3DA4F,0x170F2DE1,0xACD4CBC,0x9689A69,0x110B9212,0x533B200,0x1554D884,0xBA917A7,0x0};
+const BIG_384_29 CURVE_Psiya_BLS381= {0x99D9FEE,0x1CFAB983,0x7E0B07E,0x1F87F0F2,0xBC18573,0xCDBE130,0x10DDD19,0x100CBEAF,0x9169C21,0xF93673E,0x11DE55B3,0x97DDC84,0x11FCE827,0xC};
+const BIG_384_29 CURVE_Psiyb_BLS381= {0x16620ABD,0x12FD467C,0xD1F4F6F,0x18780C70,0x3A0BC76,0x1C749A28,0x9EFBFA9,0x91B1F3,0xE4DDB2A,0x286F628,0xE8943A,0x981F0B0,0xE14367C,0x0};
+const BIG_384_29 CURVE_Psi2x_BLS381= {0x1195DFEB,0x1B04E484,0x6026044,0x86070A2,0x1FD68858,0x137E9670,0x6871E67,0x1E736664,0x83B24F6,0x8A70373,0x2A012FD,0x112F94B,0x18A2733C,0x3};
 const BIG_384_29 CURVE_W_BLS381[2]= {{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}};
 const BIG_384_29 CURVE_SB_BLS381[2][2]= {{{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}},{{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}};
 const BIG_384_29 CURVE_WB_BLS381[4]= {{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}};
@@ -73,6 +79,12 @@ const BIG_384_58 CURVE_Pxa_BLS381= {0x8056C8C121BDB8L,0x300C9AA016EFBF5L,0xB647A
 const BIG_384_58 CURVE_Pxb_BLS381= {0x1AC7D055D042B7EL,0x33C4484E51755F9L,0x21BBDC7F5049334L,0x3426482D86AD769L,0x88274F65596BD0L,0x9C67D81F6B34E8L,0x13E02B605L};
 const BIG_384_58 CURVE_Pya_BLS381= {0x193548608B82801L,0x2B2730EEB28A278L,0x1A695160D12C923L,0x2AA32F74E9DB50AL,0x2DA2E351AADFD9BL,0x9F5B8463327371L,0xCE5D5277L};
 const BIG_384_58 CURVE_Pyb_BLS381= {0x2A9075FF05F79BEL,0x1C349D73B07686AL,0x12AB572E99AB3F3L,0x1FA169D8EBC99D2L,0x2BC28B99CB3E28L,0x3A9CD330CAB34ACL,0x606C4A02L};
+// Frobenius endomorphism psi coefficients, in Montgomery form
+const BIG_384_58 CURVE_Psixa_BLS381= {0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L};
+const BIG_384_58 CURVE_Psixb_BLS381= {0x2D59D62954030C4L,0x3F746009814E947L,0x1F67B49E2E0FC81L,0x159A997970F2DE1L,0x221724249689A69L,0x2AA9B108533B200L,0xBA917A7L};
+const BIG_384_58 CURVE_Psiya_BLS381= {0x39F5730699D9FEEL,0x3F0FE1E47E0B07EL,0x19B7C260BC18573L,0x20197D5E10DDD19L,0x1F26CE7C9169C21L,0x12FBB9091DE55B3L,0x191FCE827L};
+const BIG_384_58 CURVE_Psiyb_BLS381= {0x25FA8CF96620ABDL,0x30F018E0D1F4F6FL,0x38E934503A0BC76L,0x12363E69EFBFA9L,0x50DEC50E4DDB2AL,0x1303E1600E8943AL,0xE14367CL};
+const BIG_384_58 CURVE_Psi2x_BLS381= {0x3609C909195DFEBL,0x10C0E1446026044L,0x26FD2CE1FD68858L,0x3CE6CCC86871E67L,0x114E06E683B24F6L,0x225F2962A012FDL,0x78A2733CL};
 const BIG_384_58 CURVE_W_BLS381[2]= {{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L},{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L}};
 const BIG_384_58 CURVE_SB_BLS381[2][2]= {{{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L},{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L}},{{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L},{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L}}};
 const BIG_384_58 CURVE_WB_BLS381[4]= {{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L},{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L},{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L},{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L}};
@@ -47,6 +47,12 @@ const BIG_384_29 CURVE_Pxa_BLS383= {0xD7F2D86,0x1E59DB1,0x17474F85,0x1FB56CF2,0x
 const BIG_384_29 CURVE_Pxb_BLS383= {0x452DE15,0x1ECF20F6,0x1FF9837B,0x95651AA,0xD5D75B5,0x5D44749,0x12277F66,0x1DB3A0B9,0x1D24F498,0x19441B0E,0x1CDE9DC5,0x2C975,0xD78006,0x18};
 const BIG_384_29 CURVE_Pya_BLS383= {0x1408CB41,0x34785DC,0x3586597,0x13DBC9E4,0x1A2E75B4,0x1D65489,0xCF9A25E,0x1ACE7933,0x1B6E990E,0x19FF31A3,0x12527615,0x1A44A68F,0x1792CF93,0x19};
 const BIG_384_29 CURVE_Pyb_BLS383= {0x1F479093,0x16C2321B,0x1889218E,0x87961BC,0x1BC98B01,0x197A24FB,0xA3DEBC2,0x88D67DF,0x1CE0D,0x1E8AD3D7,0x93B9EE9,0x59B18D6,0xE5247DD,0x10};
+// Frobenius endomorphism psi coefficients, in Montgomery form
+const BIG_384_29 CURVE_Psixa_BLS383= {0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+const BIG_384_29 CURVE_Psixb_BLS383= {0x15DBB239,0xE71ACA1,0x11D1BACE,0x14CB3D43,0x1D0F33EE,0x6B02A4A,0x6FCF3D6,0x14D4B633,0x1C746ADA,0x15A1A3D9,0x9037C21,0x11634974,0x5A8300F,0x28};
+const BIG_384_29 CURVE_Psiya_BLS383= {0x18282658,0x1A7B3512,0x1326BAEE,0x18A89DA2,0x1E082D2A,0x3B0E2CF,0x12F5B6E6,0x626BA52,0xFA4FEDE,0x12175A80,0xC41B46F,0xE7B156,0x961E692,0x9};
+const BIG_384_29 CURVE_Psiyb_BLS383= {0xD828A53,0x173DB611,0x5FA9007,0x1FD5B572,0x14471A7D,0x184FD1E0,0x150F9E0,0x1F77B262,0x14FBAE67,0xEE7FA13,0x1BD9B701,0x86F2C14,0xCF382C4,0x21};
+const BIG_384_29 CURVE_Psi2x_BLS383= {0x643B83A,0x1DAD57D2,0x7954544,0xA2E11FE,0xC7C454D,0x5B74F71,0x81D12E6,0x5E03DA6,0x69A4AE7,0x1FD69071,0x1AFFD550,0x6B5711B,0x69052C1,0x0};
 const BIG_384_29 CURVE_W_BLS383[2]= {{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}};
 const BIG_384_29 CURVE_SB_BLS383[2][2]= {{{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}},{{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}};
 const BIG_384_29 CURVE_WB_BLS383[4]= {{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}};
@@ -73,6 +79,12 @@ const BIG_384_58 CURVE_Pxa_BLS383= {0x3CB3B62D7F2D86L,0x3F6AD9E57474F85L,0x1C90F
 const BIG_384_58 CURVE_Pxb_BLS383= {0x3D9E41EC452DE15L,0x12ACA355FF9837BL,0xBA88E92D5D75B5L,0x3B6741732277F66L,0x3288361DD24F498L,0x592EBCDE9DC5L,0x300D78006L};
 const BIG_384_58 CURVE_Pya_BLS383= {0x68F0BB9408CB41L,0x27B793C83586597L,0x3ACA913A2E75B4L,0x359CF266CF9A25EL,0x33FE6347B6E990EL,0x34894D1F2527615L,0x33792CF93L};
 const BIG_384_58 CURVE_Pyb_BLS383= {0x2D846437F479093L,0x10F2C379889218EL,0x32F449F7BC98B01L,0x111ACFBEA3DEBC2L,0x3D15A7AE001CE0DL,0xB3631AC93B9EE9L,0x20E5247DDL};
+// Frobenius endomorphism psi coefficients, in Montgomery form
+const BIG_384_58 CURVE_Psixa_BLS383= {0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L};
+const BIG_384_58 CURVE_Psixb_BLS383= {0x1CE359435DBB239L,0x29967A871D1BACEL,0xD605495D0F33EEL,0x29A96C666FCF3D6L,0x2B4347B3C746ADAL,0x22C692E89037C21L,0x505A8300FL};
+const BIG_384_58 CURVE_Psiya_BLS383= {0x34F66A258282658L,0x31513B45326BAEEL,0x761C59FE082D2AL,0xC4D74A52F5B6E6L,0x242EB500FA4FEDEL,0x1CF62ACC41B46FL,0x12961E692L};
+const BIG_384_58 CURVE_Psiyb_BLS383= {0x2E7B6C22D828A53L,0x3FAB6AE45FA9007L,0x309FA3C14471A7DL,0x3EEF64C4150F9E0L,0x1DCFF4274FBAE67L,0x10DE5829BD9B701L,0x42CF382C4L};
+const BIG_384_58 CURVE_Psi2x_BLS383= {0x3B5AAFA4643B83AL,0x145C23FC7954544L,0xB6E9EE2C7C454DL,0xBC07B4C81D12E6L,0x3FAD20E269A4AE7L,0xD6AE237AFFD550L,0x69052C1L};
 const BIG_384_58 CURVE_W_BLS383[2]= {{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L},{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L}};
 const BIG_384_58 CURVE_SB_BLS383[2][2]= {{{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L},{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L}},{{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L},{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L}}};
 const BIG_384_58 CURVE_WB_BLS383[4]= {{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L},{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L},{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L},{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L}};
@@ -45,6 +45,12 @@ const BIG_464_28 CURVE_Pxa_BLS461= {0x6D0A37C,0x5B50318,0x75DCC46,0xC2E492E,0xD6
 const BIG_464_28 CURVE_Pxb_BLS461= {0x2C1C0AD,0xF85CA8C,0x25CADE9,0x6CD66C4,0xA289609,0xC612951,0xEE2401A,0x529ABEB,0xF65B17D,0xBA09D33,0xD4C5AF5,0x4D4371E,0x46A672E,0xA279D22,0xACEA37C,0x1FB4FE5,0x95C};
 const BIG_464_28 CURVE_Pya_BLS461= {0x2FB006,0xCCD0C1B,0xA12A337,0x3D194A4,0xC92C895,0x4960CFC,0x39FC68B,0x3A9B00F,0xED1BA0F,0xA7DBBC5,0xA9CDFD8,0x27CC2F7,0x4E73ED2,0x6070F4F,0xEBA7E67,0xAC848E7,0x226};
 const BIG_464_28 CURVE_Pyb_BLS461= {0xDF1457C,0xA506ADF,0x4C20A8,0xD6A31DC,0x36E3FB4,0xEA9A8F1,0x92F5668,0x3C3BE44,0x67A1297,0x74BEABA,0x56A20BE,0x4C42E38,0x45157F0,0x2AB1D00,0xBB402EA,0x101B4FA,0xE38};
+// Frobenius endomorphism psi coefficients, in Montgomery form
+const BIG_464_28 CURVE_Psixa_BLS461= {0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+const BIG_464_28 CURVE_Psixb_BLS461= {0x911C3AA,0xD79C615,0x30BC79B,0xA78535E,0x576ECCD,0xBDAE071,0x5F1372B,0x1804DE0,0x4686D6F,0xB3DEEC4,0x97C7955,0xECE7119,0x6B66F7E,0xA77521E,0xC9C863,0xC7DA1B2,0x138D};
+const BIG_464_28 CURVE_Psiya_BLS461= {0x30B3091,0x7160465,0xF1CE0D2,0x8A076D8,0xFE45B9,0x96A062B,0xE0FAD0B,0xB657968,0x9872380,0xD3AF15A,0x833CB7A,0xF0D57E7,0x3ADF93D,0x50232B5,0x435E19B,0x8DCAB36,0xCF2};
+const BIG_464_28 CURVE_Psiyb_BLS461= {0x79F7A1A,0x3A9FBA5,0x62DC9D8,0x75FDE7C,0xF41BA66,0xFAB51C4,0x1FF799E,0x4404863,0x1BB855F,0xA7656EE,0x870129,0x7E48B46,0xE5667F,0x5B368C,0x92473BF,0xC77AA1E,0x862};
+const BIG_464_28 CURVE_Psi2x_BLS461= {0x91203AA,0xD81C615,0x30BC89B,0xA7852DE,0x58EECD1,0xDCEE371,0x2F1242B,0x2D94E96,0x3106934,0x17475E4,0x2F7D5A5,0x93099DB,0xE8482D5,0x9684906,0xCD88C4,0xC7D41EE,0x1381};
 const BIG_464_28 CURVE_W_BLS461[2]= {{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}};
 const BIG_464_28 CURVE_SB_BLS461[2][2]= {{{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}},{{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}};
 const BIG_464_28 CURVE_WB_BLS461[4]= {{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}};
@@ -69,6 +75,12 @@ const BIG_464_60 CURVE_Pxa_BLS461= {0x65B503186D0A37CL,0xA9C2E492E75DCC4L,0x564E
 const BIG_464_60 CURVE_Pxb_BLS461= {0x9F85CA8C2C1C0ADL,0x96CD66C425CADEL,0x1AC612951A2896L,0xB17D529ABEBEE24L,0xC5AF5BA09D33F65L,0x6A672E4D4371ED4L,0xACEA37CA279D224L,0x95C1FB4FE5L};
 const BIG_464_60 CURVE_Pya_BLS461= {0x7CCD0C1B02FB006L,0x953D194A4A12A33L,0x68B4960CFCC92C8L,0xBA0F3A9B00F39FCL,0xCDFD8A7DBBC5ED1L,0xE73ED227CC2F7A9L,0xEBA7E676070F4F4L,0x226AC848E7L};
 const BIG_464_60 CURVE_Pyb_BLS461= {0x8A506ADFDF1457CL,0xB4D6A31DC04C20AL,0x668EA9A8F136E3FL,0x12973C3BE4492F5L,0xA20BE74BEABA67AL,0x5157F04C42E3856L,0xBB402EA2AB1D004L,0xE38101B4FAL};
+// Frobenius endomorphism psi coefficients, in Montgomery form
+const BIG_464_60 CURVE_Psixa_BLS461= {0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L};
+const BIG_464_60 CURVE_Psixb_BLS461= {0x811C60C3BC6E546L,0x1A7808B386A7246L,0x567E8337F53EECBL,0x9AB1CF444DDE3F5L,0x645C82CF84A8E1L,0x57BB92BACA51BD9L,0x1ABDB49C596054BL,0xE31D3D707DL};
+const BIG_464_60 CURVE_Psiya_BLS461= {0x70A045F30B3090DL,0x78A046D8F22E0D2L,0x4BA4E04B40DA45AL,0x482B983C6620727L,0xB85E4E738B1B31AL,0xB1363625481DE4AL,0xB311987FDA78081L,0xF28DD3B368L};
+const BIG_464_60 CURVE_Psiyb_BLS461= {0x3A1FBA179F7A19EL,0xA75FBE7C631C9D8L,0x1F04350CAF29BA5L,0x60B4621FB69F9CBL,0xF46BF93DBD2D828L,0xE2298749D614F40L,0x2293BD2582F1392L,0x62C780A1ECL};
+const BIG_464_60 CURVE_Psi2x_BLS461= {0x819C60C3BCAE546L,0x5A78083386A7346L,0x569DC367F556ECBL,0x5703284503AE3E2L,0x62952B956A49361L,0x38F0FD1CF313554L,0x1E7E158B68CEDC8L,0xD71D37743DL};
 const BIG_464_60 CURVE_W_BLS461[2]= {{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L},{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L}};
 const BIG_464_60 CURVE_SB_BLS461[2][2]= {{{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L},{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L}},{{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L},{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L}}};
 const BIG_464_60 CURVE_WB_BLS461[4]= {{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L},{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L},{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L},{0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L}};
@@ -41,6 +41,12 @@ const BIG_256_13 CURVE_Pxa_BN254= {0x1B2B,0x1F,0x932,0x1C84,0x191E,0x1F86,0x262,
 const BIG_256_13 CURVE_Pxb_BN254= {0xCF3,0x1EAA,0x1079,0x1869,0x10D8,0x25B,0x18DE,0xD75,0xD74,0x18FA,0xA96,0x1305,0x18C5,0x553,0xCC4,0xF06,0x1A73,0x17CD,0x5AA,0xA};
 const BIG_256_13 CURVE_Pya_BN254= {0xB9A,0xE69,0x1E24,0x1C0,0x119F,0x4DE,0x16F8,0x1CD7,0x1D0A,0x194D,0x88,0x1319,0x966,0x870,0xE6A,0x1268,0xBAF,0x1D03,0x625,0x4};
 const BIG_256_13 CURVE_Pyb_BN254= {0xE9B,0x19D6,0x1B1A,0x1A35,0x18A2,0x4AB,0x1CE7,0x1FFA,0x1006,0x1D84,0x34D,0xBE7,0x56F,0x16A2,0x1A3D,0x2A4,0x1C8B,0x1873,0xECA,0x1D};
+// Frobenius endomorphism psi coefficients, in Montgomery form
+const BIG_256_13 CURVE_Psixa_BN254= {0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+const BIG_256_13 CURVE_Psixb_BN254= {0x1446,0x14FE,0x3A1,0x1F8D,0x134E,0x127E,0x15EE,0x271,0x1409,0x3CA,0x117B,0x9AC,0x359,0x1AC8,0xF5D,0x1FDC,0x1FFF,0x1CE3,0x617,0x45};
+const BIG_256_13 CURVE_Psiya_BN254= {0x169F,0x13A3,0x11C5,0x18BB,0x1A85,0x147B,0x1655,0x1CAD,0x1DB4,0xC9,0x9BC,0x15C4,0x1F2C,0x907,0xBBF,0x1C12,0x1115,0xC8,0x1A12,0x23};
+const BIG_256_13 CURVE_Psiyb_BN254= {0x169F,0x13A3,0x11C5,0x18BB,0x1A85,0x147B,0x1655,0x1CAD,0x1DB4,0xC9,0x9BC,0x15C4,0x1F2C,0x907,0xBBF,0x1C12,0x1115,0xC8,0x1A12,0x23};
+const BIG_256_13 CURVE_Psi2x_BN254= {0x140A,0xB01,0x1C5E,0x72,0x1DB1,0x11CD,0xA11,0x1D8E,0x1BF6,0x1028,0xF6F,0x1653,0x1CA6,0x162B,0x167D,0x3B,0x0,0xAFC,0x18E6,0x39};
 const BIG_256_13 CURVE_W_BN254[2]= {{0x3,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x180,0x30C,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x1,0x0,0x0,0x0,0x810,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}};
 const BIG_256_13 CURVE_SB_BN254[2][2]= {{{0x4,0x0,0x0,0x0,0x850,0x1,0x0,0x0,0x180,0x30C,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x1,0x0,0x0,0x0,0x810,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}},{{0x1,0x0,0x0,0x0,0x810,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0xA,0x0,0x0,0x0,0x9D0,0x7,0x0,0x0,0x1E00,0x1CF0,0x1,0x0,0x1800,0x1A26,0x6E8,0x0,0x0,0x412,0x8D9,0x4A}}};
 const BIG_256_13 CURVE_WB_BN254[4]= {{0x0,0x0,0x0,0x0,0x408,0x0,0x0,0x0,0x80,0x104,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x5,0x0,0x0,0x0,0x14A8,0x2,0x0,0x0,0x700,0xE38,0x0,0x0,0x1800,0x1120,0xC4,0x0,0x0,0x0,0x0,0x0},{0x3,0x0,0x0,0x0,0xC58,0x1,0x0,0x0,0x380,0x71C,0x0,0x0,0xC00,0x890,0x62,0x0,0x0,0x0,0x0,0x0},{0x1,0x0,0x0,0x0,0xC18,0x0,0x0,0x0,0x80,0x104,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}};
@@ -66,6 +72,12 @@ const BIG_256_28 CURVE_Pxa_BN254= {0x803FB2B,0xEE4224C,0x8BF0D91,0x8BBB489,0xDB6
 const BIG_256_28 CURVE_Pxb_BN254= {0x7D54CF3,0x8C34C1E,0x784B70D,0x746BAE3,0xA5B1F4D,0x8C5982A,0x3310AA7,0xBA73783,0x516AAF9,0x0};
 const BIG_256_28 CURVE_Pya_BN254= {0x1CD2B9A,0xF0E0789,0xE09BD19,0xAE6BDB,0x22329BD,0x96698C8,0x39A90E0,0x6BAF934,0x21897A0,0x0};
 const BIG_256_28 CURVE_Pyb_BN254= {0xB3ACE9B,0x2D1AEC6,0x9C9578A,0x6FFD73,0xD37B090,0x56F5F38,0x68F6D44,0x7C8B152,0xEBB2B0E,0x0};
+// Frobenius endomorphism psi coefficients, in Montgomery form
+const BIG_256_28 CURVE_Psixa_BN254= {0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+const BIG_256_28 CURVE_Psixb_BN254= {0x344D10E,0xE869FD4,0xE6701FE,0xD7BA4EA,0x16AF2F2,0x645E4AB,0x1D0A3C,0x6E23B89,0xA705C12,0x1};
+const BIG_256_28 CURVE_Psiya_BN254= {0x95D6AC7,0x7167476,0x2E829E7,0xD9568EE,0xE6C93F3,0xA26EC0E,0x24EA945,0x4921A99,0x5BE0817,0x0};
+const BIG_256_28 CURVE_Psiyb_BN254= {0x95D6AC7,0x7167476,0x2E829E7,0xD9568EE,0xE6C93F3,0xA26EC0E,0x24EA945,0x4921A99,0x5BE0817,0x0};
+const BIG_256_28 CURVE_Psi2x_BN254= {0xFB3865D,0x1796033,0x918E2A0,0x284638C,0x7582576,0x1BDB780,0x1EC20DD,0xDDC4771,0x154C291,0x0};
 const BIG_256_28 CURVE_W_BN254[2]= {{0x3,0x0,0x204,0x8000000,0x6181,0x0,0x0,0x0,0x0,0x0},{0x1,0x0,0x81,0x0,0x0,0x0,0x0,0x0,0x0,0x0}};
 const BIG_256_28 CURVE_SB_BN254[2][2]= {{{0x4,0x0,0x285,0x8000000,0x6181,0x0,0x0,0x0,0x0,0x0},{0x1,0x0,0x81,0x0,0x0,0x0,0x0,0x0,0x0,0x0}},{{0x1,0x0,0x81,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0xA,0x0,0xE9D,0x0,0x79E1E,0x8000000,0x1BA344D,0x4000000,0x5236482,0x2}}};
 const BIG_256_28 CURVE_WB_BN254[4]= {{0x0,0x8000000,0x40,0x8000000,0x2080,0x0,0x0,0x0,0x0,0x0},{0x5,0x8000000,0x54A,0x0,0x1C707,0x8000000,0x312241,0x0,0x0,0x0},{0x3,0x8000000,0x2C5,0x8000000,0xE383,0xC000000,0x189120,0x0,0x0,0x0},{0x1,0x8000000,0xC1,0x8000000,0x2080,0x0,0x0,0x0,0x0,0x0}};
@@ -89,6 +101,12 @@ const BIG_256_56 CURVE_Pxa_BN254= {0xEE4224C803FB2BL,0x8BBB4898BF0D91L,0x7E8C61E
 const BIG_256_56 CURVE_Pxb_BN254= {0x8C34C1E7D54CF3L,0x746BAE3784B70DL,0x8C5982AA5B1F4DL,0xBA737833310AA7L,0x516AAF9L};
 const BIG_256_56 CURVE_Pya_BN254= {0xF0E07891CD2B9AL,0xAE6BDBE09BD19L,0x96698C822329BDL,0x6BAF93439A90E0L,0x21897A0L};
 const BIG_256_56 CURVE_Pyb_BN254= {0x2D1AEC6B3ACE9BL,0x6FFD739C9578AL,0x56F5F38D37B090L,0x7C8B15268F6D44L,0xEBB2B0EL};
+// Frobenius endomorphism psi coefficients, in Montgomery form
+const BIG_256_56 CURVE_Psixa_BN254= {0x0L,0x0L,0x0L,0x0L,0x0L};
+const BIG_256_56 CURVE_Psixb_BN254= {0xE869FD4344D10EL,0xD7BA4EAE6701FEL,0x645E4AB16AF2F2L,0x6E23B8901D0A3CL,0x1A705C12L};
+const BIG_256_56 CURVE_Psiya_BN254= {0x716747695D6AC7L,0xD9568EE2E829E7L,0xA26EC0EE6C93F3L,0x4921A9924EA945L,0x5BE0817L};
+const BIG_256_56 CURVE_Psiyb_BN254= {0x716747695D6AC7L,0xD9568EE2E829E7L,0xA26EC0EE6C93F3L,0x4921A9924EA945L,0x5BE0817L};
+const BIG_256_56 CURVE_Psi2x_BN254= {0x1796033FB3865DL,0x284638C918E2A0L,0x1BDB7807582576L,0xDDC47711EC20DDL,0x154C291L};
 const BIG_256_56 CURVE_W_BN254[2]= {{0x3L,0x80000000000204L,0x6181L,0x0L,0x0L},{0x1L,0x81L,0x0L,0x0L,0x0L}};
 const BIG_256_56 CURVE_SB_BN254[2][2]= {{{0x4L,0x80000000000285L,0x6181L,0x0L,0x0L},{0x1L,0x81L,0x0L,0x0L,0x0L}},{{0x1L,0x81L,0x0L,0x0L,0x0L},{0xAL,0xE9DL,0x80000000079E1EL,0x40000001BA344DL,0x25236482L}}};
 const BIG_256_56 CURVE_WB_BN254[4]= {{0x80000000000000L,0x80000000000040L,0x2080L,0x0L,0x0L},{0x80000000000005L,0x54AL,0x8000000001C707L,0x312241L,0x0L},{0x80000000000003L,0x800000000002C5L,0xC000000000E383L,0x189120L,0x0L},{0x80000000000001L,0x800000000000C1L,0x2080L,0x0L,0x0L}};
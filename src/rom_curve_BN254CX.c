@@ -42,6 +42,12 @@ const BIG_256_13 CURVE_Pxa_BN254CX= {0xC74,0x697,0x1BB9,0xA39,0xC08,0x1393,0xF8,
 const BIG_256_13 CURVE_Pxb_BN254CX= {0xFE1,0x114E,0x2CB,0xB1D,0x147A,0x187,0x827,0x1618,0x1B97,0x1FC0,0x5D0,0x11D3,0x137A,0x8E4,0xA80,0x1EC9,0x1E19,0xF61,0x19AE,0x28};
 const BIG_256_13 CURVE_Pya_BN254CX= {0x9F,0x185F,0x1AF3,0x17F9,0x10CF,0xD9,0x11FB,0x7B0,0x1B3,0xB1B,0x1882,0x1B5D,0x157,0xF11,0x1760,0x571,0x1233,0xECB,0x1E7B,0x14};
 const BIG_256_13 CURVE_Pyb_BN254CX= {0xE9D,0x4C7,0x8A2,0x96,0x1ED9,0x16F5,0x74B,0x14AD,0x64E,0xE14,0xD18,0x1B1A,0x512,0x372,0xD7,0x1812,0xCC4,0x1CF,0x583,0xC};
+// Frobenius endomorphism psi coefficients, in Montgomery form
+const BIG_256_13 CURVE_Psixa_BN254CX= {0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+const BIG_256_13 CURVE_Psixb_BN254CX= {0xBFF,0x6E0,0x7F4,0x6D3,0x1CA,0x801,0x154,0xD83,0xBF1,0x1DC2,0x1CF8,0x159B,0x170,0x7D9,0x8A5,0x1B2C,0xD9E,0x4E4,0x1D76,0x20};
+const BIG_256_13 CURVE_Psiya_BN254CX= {0x986,0x1441,0x10C0,0x1906,0xFBC,0x1A9A,0x296,0x19A5,0x1C5C,0x1E4D,0x17B5,0xD76,0x37E,0x1166,0x2A5,0x44A,0x1963,0xB9F,0xE75,0x2A};
+const BIG_256_13 CURVE_Psiyb_BN254CX= {0x986,0x1441,0x10C0,0x1906,0xFBC,0x1A9A,0x296,0x19A5,0x1C5C,0x1E4D,0x17B5,0xD76,0x37E,0x1166,0x2A5,0x44A,0x1963,0xB9F,0xE75,0x2A};
+const BIG_256_13 CURVE_Psi2x_BN254CX= {0x136A,0x1B5B,0x19A3,0x1D75,0x6B3,0x17B3,0xF48,0x1116,0x19B,0xC83,0xF3D,0x1FB2,0xBE,0x1DD4,0x10EF,0x158,0x1CC4,0x1B39,0x289,0x37};
 
 const BIG_256_13 CURVE_W_BN254CX[2]= {{0xB83,0x117F,0x1245,0x8C6,0x5,0x1C09,0xD00,0x1,0x0,0x300,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x561,0x1C01,0x1,0x0,0x800,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}};
 const BIG_256_13 CURVE_SB_BN254CX[2][2]= {{{0x10E4,0xD80,0x1247,0x8C6,0x805,0x1C09,0xD00,0x1,0x0,0x300,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x561,0x1C01,0x1,0x0,0x800,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}},{{0x561,0x1C01,0x1,0x0,0x800,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x13EA,0x5D9,0x1748,0x1ABA,0xBDB,0x75E,0x623,0x1DC0,0x1FD6,0x1321,0x19B4,0x14C6,0x1647,0x1EEF,0x16C2,0x541,0x870,0x0,0x0,0x48}}};
@@ -66,6 +72,12 @@ const BIG_256_28 CURVE_Pxa_BN254CX= {0x4D2EC74,0x851CEEE,0xE2726C0,0x85BFA03,0xB
 const BIG_256_28 CURVE_Pxb_BN254CX= {0xE29CFE1,0xA58E8B2,0x9C30F47,0x97B0C20,0x743F81B,0x37A8E99,0xAA011C9,0x3E19F64,0x466B9EC,0x1};
 const BIG_256_28 CURVE_Pya_BN254CX= {0xF0BE09F,0xFBFCEBC,0xEC1B30C,0xB33D847,0x2096361,0x157DAEE,0xDD81E22,0x72332B8,0xA79EDD9,0x0};
 const BIG_256_28 CURVE_Pyb_BN254CX= {0x898EE9D,0x904B228,0x2EDEBED,0x4EA569D,0x461C286,0x512D8D3,0x35C6E4,0xECC4C09,0x6160C39,0x0};
+// Frobenius endomorphism psi coefficients, in Montgomery form
+const BIG_256_28 CURVE_Psixa_BN254CX= {0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+const BIG_256_28 CURVE_Psixb_BN254CX= {0xED6C32A,0x6D41DF4,0x974BD83,0x263DACB,0x27886B6,0x7BF8C93,0x3B420AD,0x769BF95,0x1C89C32,0x0};
+const BIG_256_28 CURVE_Psiya_BN254CX= {0xDF65FB5,0x99DF327,0x8F3B2F5,0xE73D42C,0xB634A03,0x9DE8FC2,0x25E6CB2,0xBC61F56,0x33F4697,0x1};
+const BIG_256_28 CURVE_Psiyb_BN254CX= {0xDF65FB5,0x99DF327,0x8F3B2F5,0xE73D42C,0xB634A03,0x9DE8FC2,0x25E6CB2,0xBC61F56,0x33F4697,0x1};
+const BIG_256_28 CURVE_Psi2x_BN254CX= {0xBEC33AE,0xEE4B1DF,0x6EED1CB,0xBE1C3C2,0xB57FDBB,0xB88A580,0x25E274D,0x9CE9724,0xE7364F8,0x1};
 
 
 const BIG_256_28 CURVE_W_BN254CX[2]= {{0x62FEB83,0x5463491,0x381200,0xB4,0x6000,0x0,0x0,0x0,0x0,0x0},{0x7802561,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0}};
@@ -91,6 +103,12 @@ const BIG_256_56 CURVE_Pxa_BN254CX= {0x851CEEE4D2EC74L,0x85BFA03E2726C0L,0xF5C34
 const BIG_256_56 CURVE_Pxb_BN254CX= {0xA58E8B2E29CFE1L,0x97B0C209C30F47L,0x37A8E99743F81BL,0x3E19F64AA011C9L,0x1466B9ECL};
 const BIG_256_56 CURVE_Pya_BN254CX= {0xFBFCEBCF0BE09FL,0xB33D847EC1B30CL,0x157DAEE2096361L,0x72332B8DD81E22L,0xA79EDD9L};
 const BIG_256_56 CURVE_Pyb_BN254CX= {0x904B228898EE9DL,0x4EA569D2EDEBEDL,0x512D8D3461C286L,0xECC4C09035C6E4L,0x6160C39L};
+// Frobenius endomorphism psi coefficients, in Montgomery form
+const BIG_256_56 CURVE_Psixa_BN254CX= {0x0L,0x0L,0x0L,0x0L,0x0L};
+const BIG_256_56 CURVE_Psixb_BN254CX= {0x6D41DF4ED6C32AL,0x263DACB974BD83L,0x7BF8C9327886B6L,0x769BF953B420ADL,0x1C89C32L};
+const BIG_256_56 CURVE_Psiya_BN254CX= {0x99DF327DF65FB5L,0xE73D42C8F3B2F5L,0x9DE8FC2B634A03L,0xBC61F5625E6CB2L,0x133F4697L};
+const BIG_256_56 CURVE_Psiyb_BN254CX= {0x99DF327DF65FB5L,0xE73D42C8F3B2F5L,0x9DE8FC2B634A03L,0xBC61F5625E6CB2L,0x133F4697L};
+const BIG_256_56 CURVE_Psi2x_BN254CX= {0xEE4B1DFBEC33AEL,0xBE1C3C26EED1CBL,0xB88A580B57FDBBL,0x9CE972425E274DL,0x1E7364F8L};
 
 
 const BIG_256_56 CURVE_W_BN254CX[2]= {{0x546349162FEB83L,0xB40381200L,0x6000L,0x0L,0x0L},{0x7802561L,0x80L,0x0L,0x0L,0x0L}};
@@ -34,6 +34,75 @@ const BIG_256_29 CURVE_Cof_C25519= {0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
 const int CURVE_A_C25519=486662;
 const BIG_256_29 CURVE_Order_C25519= {0x1CF5D3ED,0x9318D2,0x1DE73596,0x1DF3BD45,0x14D,0x0,0x0,0x0,0x100000};
 const BIG_256_29 CURVE_Gx_C25519= {0x9};
+/* Fixed base comb table for ECP_genmul - generated by scripts/combtable.py */
+const BIG_256_29 CURVE_Comb_C25519[64][3]=
+{
+    {{0x19419,0xB982E34,0x171A47B7,0x291B229,0x8BCB957,0xE14CCBA,0x7988B65,0x15FBCC14,0x2B83BC},{0x6666658,0x13333333,0x19999999,0xCCCCCCC,0x6666666,0x13333333,0x19999999,0xCCCCCCC,0x666666},{0x667A9A6,0xFACF1C3,0x1F48395F,0x1BA7C1BA,0xD63C778,0xB43D6FB,0x12E06F84,0xB2FD676,0x5602FD}},
+    {{0x1AACD788,0x12766135,0x1095B7BD,0x8A7A224,0x8F7D918,0x969564B,0x39EE644,0x6718432,0x488006},{0xAF8A3C9,0x12FA3573,0xE145583,0x121EA2C8,0x1F56973,0xF7464D1,0x7087689,0x1E612465,0x2260CD},{0x14B2340E,0x1D60949A,0x1E7B1367,0x1D877F7C,0xEAD67E4,0xC6F5CF,0x13E15AA5,0x111D9986,0x7B2F29}},
+    {{0xD333A39,0x1895272F,0xFF34FBD,0xC42CFDF,0x97B24BA,0x12D58C21,0x6D870F3,0x1CCF950C,0x590878},{0x18F5B4D4,0x161B4243,0x900C100,0xDD82ECE,0x9EF79F1,0x10C73013,0x6AE849A,0x1A2EFDCD,0x1267B1},{0xA3E72CF,0x4A58F37,0x539E316,0x9513834,0x85FD63B,0x3B57965,0x1ADCD409,0x145E9F44,0x576EDB}},
+    {{0x1D927C76,0x100EE556,0x17F0BDBD,0x18EF5A98,0x1EF0F5B1,0xDDAEE4E,0x1FFACB0B,0x741A608,0x2E1B},{0xA32112F,0x19C55B0E,0xBC3FC37,0x45065D4,0x1716C4CF,0x1C42C06A,0x17851C3A,0x4F962B2,0x47D0E8},{0x1948C9CE,0x1907F32B,0x8FD6ECC,0x1A856755,0x142127D4,0x98FEB0D,0x11AE112D,0x7172CC1,0x1EB841}},
+    {{0x1CA87A99,0xD327689,0xF47B21A,0x2AB2EC7,0xE1A369D,0x15A16C68,0x1F185304,0x6A3F511,0x7345E4},{0x1676C8ED,0x690FC1E,0x10C2D744,0x105D9512,0x4666312,0x170A44C9,0x19BF80B1,0x16531FD5,0x5F4825},{0x9951A01,0x41B043C,0x13C54064,0xE506177,0x12B481F,0x10576ED,0x4283463,0x19C171A5,0x4F11E2}},
+    {{0x44F6497,0xAFCE94,0x766E481,0x4C4482D,0x1BA2ECD6,0x842235E,0x640E3A2,0x1A52001B,0x838D4},{0x19497EF4,0xE93D687,0x135AD830,0x2F80D28,0x17D77F94,0x4D3FEA7,0x28476DC,0x1F8510DB,0x54DE3},{0x1482A99F,0x10579484,0x1840E57F,0x48FEBD8,0x1C3D820B,0xC1CF627,0xFDC8B8,0x1548B1B9,0x652AC5}},
+    {{0x12A57199,0x1399B615,0x339BABB,0x4D39B00,0xB07A5E5,0x166DED35,0x175B97FA,0x134A86F5,0x5067A9},{0x1F4062B8,0x162625AC,0xAFC8F44,0x10568DEF,0xAD41F08,0x12346E9B,0x14BE1F39,0x1C6568FA,0x31C563},{0x160F34A,0x127D371A,0x17FF2A93,0x1586FB2F,0x152496C7,0x136F8E50,0x17D3AD10,0x1E6806DF,0x701653}},
+    {{0x19F5C2FF,0x17450331,0x12357A7E,0x16FCC923,0x63FB656,0x64CE3F1,0x114F762D,0xD4FC441,0x14A3C6},{0x1C37B9B4,0x117ADD4F,0x7B924C7,0x1079F8C4,0xF38F817,0x1784B345,0xDE5BAB5,0x193CAE,0x21D306},{0x295A1C6,0x176399B5,0x2CBA6E0,0x7070F13,0x1ECB31BD,0x7C6693D,0x4DE2295,0x1CA332BA,0x112E8D}},
+    {{0x11905BFC,0x1760717E,0xDC2AFBE,0x3B00784,0xC6D82E3,0x1269C3F8,0x869A9FF,0x32C10F9,0x48230D},{0x10C9B91A,0x270F7D8,0x292E13D,0x1096F6BD,0x8F8C43E,0x9AA5A80,0x16D97314,0x1C93A9C6,0x6D415B},{0x1061926A,0x9D3A995,0x1D55B5F9,0x19AE2857,0x1CB0487A,0x96B8B2B,0x5EDDA34,0xAF1B6DB,0x737598}},
+    {{0xCE4D0E,0x4FEAAB7,0x1F807918,0x1BAED71D,0x102BA7EF,0x6DEB52,0x5DA7DC4,0x1D6EAE21,0x3A4427},{0x9A77CB,0x91DC6F1,0x303E836,0x1D974AF7,0x142ECB6A,0x122C0733,0x48661D6,0x1C16708E,0x739476},{0x9E96BD,0xD37677A,0x14F009A1,0x2466B74,0x1E5DD8E4,0x688C6E7,0x1EBF25E2,0x10CE8CD7,0x792697}},
+    {{0x1108004E,0x127B1EBD,0xE1BAAF6,0xBBA54C8,0x2568A08,0x61BE9E9,0x8A171F3,0x11201B17,0x5AB91E},{0x58A68C1,0x1BB41505,0x19178A9E,0x369ED36,0x1048DD3A,0x13E0D5B8,0xA6D8A4E,0x4101128,0x34A3EF},{0xF28979A,0x12825A6B,0xA32AFDA,0x16E48A72,0x14989676,0x172A0A69,0x19CF42F9,0x1848BF2A,0x45B0F1}},
+    {{0x1CE127C,0x74A4A6B,0xBED885B,0xE2675C5,0xDEF9648,0x47A3A44,0xB505C7E,0x1032C77B,0x80F15},{0x12DA81D9,0x1CEC127D,0x1C426050,0x19DE03A5,0x17D2DF4A,0x1FF88480,0xB967E97,0x1B6C64F9,0x53B120},{0x347847A,0x1D4A6C2D,0x4574D28,0x39C5D5F,0x6021A1C,0x1A9650AD,0x80C9232,0x11C98421,0x899A0}},
+    {{0xD896B84,0x1B819872,0x19F88F14,0x8492287,0xA735277,0x272B5D,0x1C09228F,0x105A764D,0x51F41},{0xCF8AF35,0x521FB0F,0xF8598CF,0x2344C0B,0x36D4B10,0x908B000,0x131EC964,0x5B94BE8,0x7E6C7C},{0x1CBA0EF9,0x1BA32731,0x127B9EAF,0xF578A7D,0x1B6044AF,0x1B85EF73,0x8FBF0A4,0x736F45B,0x4664A9}},
+    {{0x10B6CD15,0x16EDFCD6,0x19435170,0x91115AE,0x1229B6FF,0x1CA9131B,0xAFE612,0x168A5F9B,0x7BA058},{0xC86FB32,0x973599F,0x1EB20AD4,0x1C8EE0D9,0x10C05CE7,0xB5A79B8,0x3337299,0x1A0EA0EF,0x6AB2DD},{0x15A26135,0x26E79B,0x1C8617DD,0xC5CAA68,0xCF17DDD,0x19A69491,0xC8C1397,0x1DECC639,0x12F05D}},
+    {{0x1D0FBF52,0x21B1EA0,0xAAB3BC5,0x8A6A577,0x3D536B8,0xBEF9793,0xDA5D1C3,0xA8202B,0x7AB4BA},{0x9538107,0x71FB42,0x2282541,0xA8FC20E,0x74F7AC3,0x72EE61F,0x1725E747,0x19138185,0x6EB85C},{0x374F515,0xB2354AC,0x104124F5,0x41DF131,0xB835957,0x6A012C2,0x1864689A,0x167B521,0x3F42B6}},
+    {{0x1C469449,0x9C9498B,0x4942C1,0x16F70ACA,0xC47DF82,0xF0218F3,0x511CE4E,0x142220A6,0x5487C3},{0xE1D6245,0x8E157F9,0x1EC96908,0x122B181A,0x17C8FFC3,0x128F3ED2,0xF59168C,0x18B977B5,0x77785E},{0x116AED87,0xBF9E94C,0x346D03,0x41ADE6B,0xADA9598,0x17F8F242,0x2F3486A,0xD7A343E,0x66C726}},
+    {{0x129A209E,0x672FE72,0xB62D572,0x18E2A21C,0xE436CA5,0xB7E2B2F,0x1331C149,0xB1E16BE,0xF960D},{0x2E45313,0x18F7D2BC,0x40AC1A3,0x16C1175,0x17C4F541,0xD76930D,0x9775AF,0x85D49DA,0x325BB},{0x2DF18DB,0x1EB67441,0x8848E32,0x1597748A,0x279629F,0x861455B,0xB72EE82,0x1CAA369,0x3E96B7}},
+    {{0x3984DB,0xAEBCF56,0x76BB70C,0x1BE46154,0x15EC51C3,0x1E66700F,0x1F39D818,0x18CD8491,0x6076C0},{0xF29C9EE,0xC288EF8,0x188373BB,0x12971E58,0x6E904F,0x101B8EB9,0xC532540,0x14E73D9D,0x4D2B97},{0xDDA0E3B,0xC2E8A56,0xBB1BCE4,0x361066D,0x196EB9AE,0xA4469EF,0x93A306A,0x14DC707B,0x48342A}},
+    {{0x193881FC,0x12E0DC45,0x1B62AC4C,0x13F62696,0xA0536AF,0x909C5EA,0x1B644314,0xCEDF93A,0x6C969F},{0x1DD7DE2F,0x32FD1F0,0x1FA3A966,0x161B863,0x1CFD1B39,0x15BDC2F2,0x1E01D8B5,0x146A65E,0x534EF7},{0xC567957,0xD94FC5F,0xC72EA36,0x140B1B2D,0x986402B,0x1D231401,0x17F7AE50,0x1D5DB2F5,0x57FCA5}},
+    {{0xF36954C,0x4888A8C,0x3440CC7,0x1EB77E62,0x1E34E478,0x5150AC5,0x1A992468,0x9BD5330,0x188EA3},{0x1219A417,0x59A388A,0xBAA56D7,0x4016844,0x1857F95,0x11AD5F5C,0x1F220EAF,0x1B054150,0x54BB8C},{0xDACFF46,0x170D8389,0x529335E,0xECCB649,0xD8DD4CD,0x1BFD20BC,0x402C67A,0x86462CB,0x69C96B}},
+    {{0x1995B016,0x9024B95,0x15C1F4CE,0x10F29AD,0x5C6F1BE,0x1DEBD0A0,0x18586736,0x8BC1213,0x3B2A1F},{0x6CE8B8A,0x1E24E5D5,0x186A2A43,0x16AE2FBF,0x1606B4E1,0x1434A9DD,0x1C1551A7,0xD0E22AB,0x50E1CC},{0x9B7F1E,0xAA2CA55,0xDA5BFC6,0x3A5006D,0x14B4B34A,0x99F9D25,0xF67F780,0x69136F,0x4C9783}},
+    {{0x6AE8F1D,0x5CC7233,0x146D6F5B,0x1790B885,0x4DA58B5,0xD8A6650,0x804F3DB,0xBB6DC2,0x5B63ED},{0x1494C782,0x184A4CF2,0xE34FAC0,0x186654C1,0x1EC8E08D,0x5002B54,0x5A320C8,0x153A7A35,0x1C5703},{0x47EED86,0x1C1E6595,0x1C54F0C7,0x12A61768,0x1106DDA0,0x1DF216EF,0x12C24E07,0x19E5B859,0x70190F}},
+    {{0x9547816,0x1DAE5F9F,0x13E12FFB,0x20B8F6B,0x55EC3ED,0x1FE733E3,0xB294E9C,0x1C1A59AC,0x1490F6},{0xD398826,0x194726FF,0xB771DD1,0xB2CAA6B,0x18F43968,0x1A6BA9B6,0x1AC8A3B9,0x7D800EC,0x1E8B23},{0x1E5B8817,0x8B1E5F9,0xFA95190,0x1CE96A6,0x14669D4B,0xC244402,0x98AA774,0xF989389,0x5587C5}},
+    {{0x1C0BD8B9,0x6372669,0x818EDDB,0x1C480F4E,0x905DFE5,0x5C0EF7F,0x1D47BADB,0x425EECD,0x70B024},{0x8CA96C5,0x1F70D116,0x180C79D7,0x6110644,0x32B9CE6,0x1D2EAC22,0x1413926C,0x1DE71DFA,0x19DD4B},{0xEF9BD1F,0x175ED26A,0x1A7C4DC2,0x198E8052,0x15891645,0x574F993,0x16E8B4A8,0x1604ABFD,0x56C39E}},
+    {{0xA67D39C,0xFD950E1,0x129887A4,0xC074FF7,0x8446AE2,0x1260F2DB,0xF31BCBC,0xE2C3592,0x4BAEFF},{0x17863AC1,0x1C203586,0x152F46DF,0x1D00F00F,0xEEB4B12,0xD771C29,0x7CFDBE6,0x111A8DC8,0x35AC95},{0x32745E2,0x54E4B66,0x159E67,0x7AA76B3,0x17903A0B,0x1DB335AB,0x1A288F08,0x994FFF9,0x344761}},
+    {{0xD0D69A1,0x185BDFE0,0xA592657,0x143AC815,0x18E1E7B3,0x19A0ED6,0x14DEB1E2,0x1E28FD69,0xFEC4B},{0x173039E8,0x1FED891B,0x1D0F8F46,0x175CFE9A,0x65B43A5,0xE219D07,0x191D0773,0x1325D1C,0x4C4822},{0x1C48EBA1,0x378ED8B,0xE950E59,0x1CBEB430,0x4147CBC,0x18C3B183,0x130912B7,0x17688782,0x190CB}},
+    {{0x95CCBA5,0x423A840,0x15EE8570,0xFEEF56E,0x19456AFA,0x1EDBC859,0x1F4099D5,0x4387C36,0xDFE7D},{0x1359E934,0x40134EC,0xF333C95,0x70A4B84,0x62C16AE,0x19045382,0x10E685B4,0x10E77150,0x13115F},{0x18184234,0x1B928307,0x523F51D,0x39D3F6F,0x19201E02,0x247A431,0xB6F8693,0x1D810C10,0x37773C}},
+    {{0x2734B80,0x13C38F92,0x6FE4A25,0x19D9E4A,0x10268139,0x143ED595,0x1178158E,0x90F1A90,0x2C85DE},{0x1B6937C5,0x4EE3542,0x1B987F29,0xFD48CD0,0x1D2671CD,0x678FD3E,0x14DA3553,0x1BE01926,0x50676C},{0xF0BF226,0x15E17F9,0x6062BA6,0x1595B381,0x14C8733A,0x1E758A91,0x635E6DE,0xB97CD6B,0x74228B}},
+    {{0xF7A5268,0x1A994980,0x127CD78D,0x46887E6,0xADE90B5,0x174E2C74,0x1822F854,0x8EF6296,0x5D917E},{0x1AA84686,0x1AB16E93,0x10C5431F,0x1D41A3C1,0xBFCD9AC,0xFF00D63,0xA4D6572,0x1B19DBB7,0x5A8A95},{0x17B3FAB0,0x10A4E9BD,0xB2CC5FF,0x12E0CD29,0x1FF387E4,0x1CA97EBA,0x127D5E66,0x3F2A787,0x359A77}},
+    {{0x1D897E75,0x1EC62C70,0x14BC90B9,0x1C08746C,0xE146E1E,0x9681B43,0x484B6FC,0x1B63F66D,0x588F96},{0x11A58D6E,0x34C4B5F,0x1824D36B,0x1E1591D1,0x2DE38A8,0xE31DFF3,0xE30D852,0xD53CECC,0x2765BA},{0x18DFBD92,0xD9616C6,0xDEB7162,0x2E81AD1,0x115E1A03,0x91359F6,0x124D42D3,0x1EB53D86,0x22EA77}},
+    {{0x45D0E32,0x6E892B4,0x1680C700,0x76B8F61,0xB0D4FCA,0x71AD413,0x2931731,0x5962DC,0x73122F},{0x1DD5CBD8,0xF0453E2,0x1D2366A8,0x1FAA5FF,0x1109FAFE,0xE1BCB4D,0x139F912C,0x16C2C4F3,0x653338},{0xE7EC973,0x15172DB9,0x12CA7FA4,0xAF9658D,0x10A1CB89,0x153AFD97,0x1EE07507,0x1562F3FD,0x5B0CEF}},
+    {{0x10CE3DD9,0x37B0C1D,0x1D47B890,0x10C87B9F,0x16E16D97,0x1F81E5DA,0xC400AB,0x1F47CAB4,0x7E3E16},{0x8073393,0xE865256,0x176F6AEC,0x1D58F94F,0x1CCCB453,0x1ADFC883,0x9F72E74,0xB222782,0x5CCF13},{0xF517FFB,0x13427D32,0x1899D6D6,0x1612F775,0x15F91406,0x824C34B,0xE946223,0xB8AA3B4,0x53B891}},
+    {{0x183CC44A,0x10F635BC,0x18F165E9,0x617BCF4,0xAED6AC5,0x77CE785,0x8A61362,0x3745356,0x693344},{0xBF5A66B,0x1DD5E88A,0x9312796,0x17C3CA3,0x9C3A90D,0xF5B1361,0x1F657C4,0x1CCA4DB9,0x5F2C99},{0x16F73AEC,0x19967FA3,0x75789E7,0x105A19AF,0xED4EC7F,0x29A0A50,0xCDF1554,0xE999EB2,0x744D79}},
+    {{0x1FE98CCD,0xDD26D4C,0xC8286F,0xFB68CB1,0x1AEA387E,0x1AEB6C0,0x1CE1810B,0x1619D36B,0x477ADA},{0x63E2736,0x15583896,0x75A6F93,0x18117D67,0x108472A7,0x766EA7E,0x16CD09C,0xEE5E693,0x653A5F},{0x6370C61,0xA0F9F79,0xB7348FA,0xD9D5CBD,0x171A7527,0x36866D0,0xBA2EE95,0x1318DA6F,0x18A1C}},
+    {{0x82AD350,0x15F84DB,0x17A1CA01,0x7A05AF2,0x1C4EA69,0x25F6E20,0x14AB56DA,0x1EEAAA12,0x4B58DB},{0x1F7B062F,0x11A4D1AB,0x1553FC46,0x1054D77D,0x4A1E02A,0xAD8A4C3,0xD4E4D1A,0xE8C04F6,0x6137B0},{0xB4F59B6,0x19426F65,0x149F0A6A,0xBA50CC,0xD06A297,0x180526A4,0x1ACC56FF,0xFDA43B,0x238A6D}},
+    {{0xED8CD9,0xFD89214,0x61CAB43,0x13ABBE95,0x41A3165,0x5EC99A0,0xE637AF,0x213FA5C,0x4745DC},{0x10901700,0x3069F49,0x1CB08C4C,0xA6CF512,0x18339BDA,0xED0A842,0x147505B1,0x800E596,0x500B77},{0xD7500EC,0xBD6189E,0xFE15833,0x1C7C1489,0x199B52ED,0x1ED2D5F2,0x1B19CBB7,0xC3207AB,0x380DBE}},
+    {{0x184D1837,0xDDCF50E,0x1C9FCB09,0xB86CBB,0x1A0D066C,0x1CCF5831,0xC521E19,0x18CA2C82,0x5980A9},{0xC846FC4,0x6A5C195,0xD699911,0x53CA2E6,0x10DA8DC2,0x8C45FEF,0x116E3254,0x1045C30B,0x6C3F24},{0x19D979E,0x4FD7F0D,0x15639E8A,0x75603CF,0x1955B771,0xF1AB7F,0x1988E456,0x69715FA,0xC7B14}},
+    {{0xCF764CA,0x13A4BF27,0x1DE88132,0xDAAEC33,0xD3CB8AE,0x1D753493,0xFA028C,0x251B65A,0x160CC7},{0x17E25B77,0x1BE70E39,0x1EE7E304,0x59C54F6,0x12AB9A34,0xC60544C,0xEC218F3,0xEEEDD3F,0x56F5F7},{0x17E2C946,0x1522D1D8,0x1FBAE39F,0xBA3CFB1,0x18089CCC,0x164D448F,0x8C83F5A,0x11AD5193,0x79F166}},
+    {{0x1D5CA891,0x1C0EDAEE,0x1332828B,0x15995443,0x30BEF0A,0x8157206,0x13854734,0x10406816,0x44DE80},{0x1289B820,0x1013D66,0x1338A492,0x1B961F5F,0x6AAFE36,0x1D4072B0,0xBD4BD09,0xA159E66,0x54333C},{0x1501DB26,0x11C16FC6,0x1D77F35C,0x16320F15,0x18C1D374,0xD06E35D,0x16134472,0x1CEEFEAD,0x209BFF}},
+    {{0x1A1E7851,0xA9CFDEB,0x10D3E3EB,0xCC24A02,0x1428E709,0x1A562D6E,0x1D52A38B,0x1410EFA0,0x284800},{0x5F50246,0xBAE2D7D,0xD516E9B,0x1993FC14,0x18D9122A,0x199CA90,0xC5A2B00,0x3C073E,0x3C530F},{0x87F232F,0x2EB9FB9,0xFF5FA73,0x165F943B,0x1D0CD01C,0x1BBCE70,0x40E16B8,0x1F21C118,0x4495BA}},
+    {{0xE40C0E,0x10855FDD,0xCD33F7C,0x16385389,0x1978409B,0x1B13DB59,0x15FCE150,0x13C68719,0x532C9C},{0x1E59EF20,0x14995D26,0x10BB0B9B,0x85BA934,0x1275846F,0x1C78C15,0x1279A4F6,0x18B6C7DA,0x358FD},{0xAB72E18,0x1FB7A9EE,0x4936DB,0x1285B592,0x1962D141,0x18D13E21,0x1E7D94BE,0x19229E0A,0x5F4F80}},
+    {{0x16BCC5F6,0x296A07E,0x1392D289,0xE29FE89,0xEFBE149,0x1DC019EA,0x1D750A9E,0x112F721,0x554741},{0x17DE3877,0x3A4306,0x1FEA1D3C,0x661CAA9,0x1FB77FF4,0x197F8390,0x1791AC1E,0x33F861C,0x1A36C},{0x1A6EFF6A,0x1D4B032D,0x6E561C3,0xBD8438,0x1C211061,0x14528999,0x11F38226,0x6F41A63,0x737F2}},
+    {{0x1CC2AC1D,0x12CEBEE3,0xC5869B4,0x15ACDD8E,0x13F3295F,0x8D61F49,0xAE34193,0x590ED67,0x4A4A2E},{0x6554DD1,0x1743C8A8,0xE0E36DD,0x1DFA22B9,0x10C8D64A,0x16A31CDF,0x1489EE9,0x1B6F38BB,0x377BD9},{0x3217AC7,0xE8FF7B1,0x1DC13D0E,0x5BB935,0x86FB1FB,0x11D0F4DC,0x5D510E6,0xDB298C,0x4C68AA}},
+    {{0x19A8C361,0x15E8B179,0x1D830C4E,0x26BEABB,0x3E1998A,0x47CE86A,0x479A71B,0x1538C19C,0x60DE83},{0x14B47F1E,0x1C4D8BF3,0xAD68613,0xBBE0CC9,0x6AE0874,0x4877863,0x8E0D493,0x168A861D,0x5452C4},{0x3DE2D7B,0xFD5AC19,0x12C503EE,0x1294BE52,0x73B6708,0x1597E7CE,0xA97C4A0,0x1BC6474D,0x2B33D2}},
+    {{0x15A39428,0x583B3B3,0x13267CF2,0x1B41077,0x17A55A88,0x6706601,0x17007FE9,0xF9EB8CE,0x5BE3D1},{0x98D85B8,0xB2B53DF,0xEF5674E,0x1D83018D,0x1DC51A91,0x77AA112,0x15DD283F,0x23CFD4E,0x65FCDC},{0x1B6F839A,0x1EBC840D,0x74981ED,0xB60DCE4,0x13C7B8AB,0x15CBE61B,0x1215579C,0x14EE38E4,0x4D72D}},
+    {{0x37A141E,0x18EAB16D,0x1B6E2897,0x8A78474,0xF5DA5AF,0xC9728B5,0xD29CABA,0x4A03DD5,0x12142E},{0x5427F5B,0x5425A10,0x72A91CD,0x198AE360,0x1BDDF2B2,0x9EDD80F,0x925DF19,0x928904A,0x10EF5D},{0x1740D731,0x1C2B8E76,0x31B776F,0x33C25AB,0x1809027A,0x13AFEC76,0x682349F,0x171B1646,0x5DEEBC}},
+    {{0x26BCBF8,0x39D2028,0x1DE79AE5,0x1565E18,0x1A8E10A9,0xA0471F7,0x1B1FF89A,0xB4EFACC,0x656CFF},{0xEF8BC11,0x9B23C07,0x15041DF1,0x15DC64FB,0x98FDE48,0xF5785C1,0xBA2FB6B,0x9451D3E,0x2D9279},{0x1271A5C7,0x18E21B3F,0x143F4D5D,0x1F2FBAD8,0x18441D52,0x13C2B752,0x17F0ECC8,0x1636A984,0x758B2A}},
+    {{0x127BB3BE,0x1CEE719,0x1477FAE8,0x11C5AEF6,0x1ADDF91C,0x1A43C667,0x11C4AC7F,0x1DCBC4B1,0x32AF9},{0xE75198B,0x12F0301B,0x3069BDA,0x451A7C7,0x17AB9E0F,0x9F334A1,0x1DFBFB03,0xF6D9572,0x42138E},{0x4D91ECF,0x142B46A6,0xDF4D6B6,0x1341E4C8,0x9EABD0E,0x1B6A9363,0x1513B0BD,0x1C3ECECF,0x626759}},
+    {{0x1E441556,0xF5FF06B,0x1C8C5844,0xFEF9A6F,0x89859C2,0x490F185,0xE8B1390,0xC06C57B,0x7E48C},{0x314833,0x1797B2C8,0x6C9C3F2,0x4FC24C6,0x1C0491D0,0x17C3BCAE,0x1CBDE97B,0x1B0AACC3,0x61D909},{0x15E4C6F1,0x50A807B,0x784E8C5,0xE626007,0x17BE04A6,0x144CF810,0x8CBCA65,0xAA44246,0x1C9D6F}},
+    {{0x10470733,0x964F006,0xA57D409,0xCF691B5,0x1606C3B9,0x6C6603F,0xE323F44,0x53A846B,0x151381},{0x8A3C065,0x17E4AA8C,0x1A1E2525,0x1283161B,0x14858C2C,0x697883A,0x168324AB,0x139BA1ED,0x3D2698},{0x83F005,0xB6BC2E1,0x1EA9708C,0x16A8A43E,0x1C6063CE,0x7F44539,0xF3E23EC,0xF82DAB1,0x8E541}},
+    {{0x1C9C6F60,0x1D86AE9,0x3435F99,0x17AC7282,0x2DF62A7,0x4ECCF99,0x3C9CE2E,0x7BE0B95,0x32CC4D},{0xB704CA1,0x41D0072,0xBE904DC,0x4327171,0xB409652,0x1C032781,0x151B385F,0xF8A1B48,0x4ED18A},{0x1E9C29C1,0x2506680,0x1758F570,0xC8DEDD3,0x12920D1B,0x16D4F3F9,0x7AFC338,0x4ACC459,0x357760}},
+    {{0x120E20C4,0xDF0EEE7,0x191FE178,0x90771C7,0x1B7851B7,0x1D9E485A,0x15BCA670,0x1DA8321,0x7A12D4},{0x35ED926,0x1D17587D,0xDCEC83C,0x1D3DC9A8,0x1533D06C,0x1595D776,0x42892DB,0x1AC1F462,0x3AA47F},{0x95356D,0xFFBC4BA,0x1AEEBB15,0x93ED52,0x23CB236,0x8A43539,0xC8B25B2,0x1F87CCFB,0x1FF25}},
+    {{0x193265AF,0x11A8B167,0x1054D82,0x5E30ABB,0x19E411D,0x19B2A0C2,0x1F47FFC2,0xABA3C5A,0x75628E},{0x9E406CB,0x1F47F709,0x1EA5CB38,0x1A307E88,0xCFB7D40,0x1D6BCD50,0xB3490F6,0x3840076,0x7880CC},{0xFA114BD,0xE08FDB3,0x62EDD0D,0x1230DD20,0x22A8A7F,0x167CC9A3,0x94CD08C,0x1440A9A6,0x651AB4}},
+    {{0x1B94C436,0x6F6DBB3,0x1E6BCBB8,0x1D3E428D,0x14B4CCC1,0x1A3BE9D4,0x1C846F7C,0x8685A74,0x7227D5},{0x1A3CEA68,0x13BCD435,0x681833A,0xFC142E6,0x1EE18498,0x1D5A44ED,0x8E88E12,0x1A213283,0x34518A},{0x8E83F86,0x1AAE124,0x1B584C31,0x69F4085,0x18DA9CEE,0x5821794,0x1B25A5BF,0x15867544,0x441F72}},
+    {{0xA4C9E83,0xEB8EFEE,0xAAC317,0x1C7A8766,0x1F22491F,0x16E74FB,0x19B5BEB7,0x137DBFFD,0x3BE253},{0x1E8CEB88,0x1C40B789,0xEC4A8F9,0x17C94F9B,0x657E43C,0xF7E88E5,0x1F62D0E3,0xD546DB,0x66EF72},{0xE9FC1D9,0xF48DB2F,0x1A00A8A9,0x10C60747,0x15652AA3,0x165E505F,0x1D5C0DD0,0x69FA865,0x25D92}},
+    {{0x4DA0A93,0x1796FF08,0x19115FF2,0xAB00CD5,0x3AEB070,0x188D08F7,0xFA9A258,0x1D8665C8,0x12851F},{0x4C78797,0x809C0E0,0x171D60E,0xC9F947,0x1A225640,0x54A285F,0x914C49B,0xA3A4481,0x165129},{0x3073250,0xC2DC450,0x1B48A19B,0x12AFA55C,0x116D37D4,0x1748ADF4,0xE7C70A,0x1672D0F6,0x569367}},
+    {{0xB934A1E,0x187CD9C,0x1BC042EE,0x147E1BFB,0x27D1267,0x15E70EC9,0xCBD9AF0,0x1DEB6985,0x43D676},{0xE35AB2D,0x1B2E243A,0x90919E5,0x1C7F5A8F,0x131CBF38,0x1162BB8B,0x4F23F5F,0x90AD9B8,0x696CC1},{0x1C3EFEE8,0xD0A0AC9,0xDA23F49,0x1D24B5BC,0x14BC5251,0x1353F0C0,0x10AE64AD,0x126A2635,0x13167B}},
+    {{0xEE2B6A3,0x1636750D,0x178F8448,0x948C98,0x1832AF21,0x13D3FF08,0xD3EECA0,0x196BD8C0,0x3E4EEA},{0xF70BD8E,0x9251814,0x1119D693,0x1E41EFB5,0x17A5B810,0x1B39202,0x1E00A82E,0x96E9FBC,0xD5C9E},{0x171F6857,0x148B813,0x12CD959C,0x1F9BBDA4,0x1E607084,0x142F8B1B,0x13805D7C,0x74C86C8,0x52A336}},
+    {{0x11350E8,0x103E98A0,0x10813BF1,0x1F97479E,0x19795726,0x1C75AE07,0x19B6297C,0x17ECAD4D,0x60F821},{0x930F866,0xD198CD7,0x4FF6378,0xF1E2B7F,0x133FABC2,0x1CBC54D1,0x9FE71DD,0xD284970,0x6CC9F2},{0x27BA99E,0x134747B4,0xC524E30,0x189695E3,0x148F3622,0x72CCF70,0x1A99F656,0x1C5431D0,0x3C81AC}},
+    {{0x1350B86C,0xF89E554,0x18F4BB3C,0x1E0D5D4B,0x19FBDAFB,0x133C4B13,0x104C0EEC,0x1F5567CE,0x215373},{0x1EF14F36,0x99ABA2,0x13C475CA,0x727BD71,0x1B5B805B,0x16F5F4B9,0x1E247866,0x1AA2B161,0x23E38C},{0x159B0DE8,0x1CA0EDB6,0x30F0E2D,0x6E22D38,0xC620322,0x1CC85E77,0x168ED88C,0xC03F83F,0x432E2}},
+    {{0x68A8A36,0xE85C863,0x18A2356F,0xBD2B9B4,0x20035AC,0x1C33F40D,0x10FD504C,0x1BB1CBCD,0x3680D8},{0x1682B3EA,0x17344C03,0x943D55,0xEEBF690,0xBD78AAF,0x6D863F,0xC8D00E6,0x105C11D7,0x5D4BA6},{0x3C4A35D,0xC59C4EA,0x101C8AAC,0x87CEE95,0x1EDAFFAC,0x9D76263,0x53D475D,0x1E260788,0x675852}},
+    {{0x1D93273A,0x1E0EB4E5,0x109133AC,0x19141B38,0xC3731B7,0x1532CA3E,0x257C3CA,0x464023E,0x5C0F48},{0x46C2997,0x6E85A16,0x6D70A70,0xFA12E69,0x638079C,0x1BC7723A,0x1F0AEC0,0x186D8D1D,0x579782},{0x18E890C4,0x9477BBB,0x774BD1A,0x9E18A81,0x1A6CC5AD,0xE79720,0x1F194A07,0xE63D6DE,0x5FBA04}},
+    {{0x49FDEBA,0xD615705,0xD38C0B8,0x582F555,0xDE49AD7,0xE7FB9F3,0x2676003,0x171ECEAA,0x2F81DE},{0x114C514E,0x1DB47C2A,0x1FF7F009,0x3C07083,0x1FA1CEA,0x8ECEC17,0x1FC86E28,0xEE3F532,0x489CF3},{0x2FB612E,0x155CD723,0x15CB18B9,0x1EC06A3B,0x6DE4AA,0x129FCE73,0x1EB29709,0x1A54EA0C,0xFFB3D}},
+    {{0xA0A0653,0x9530BA8,0x23075D1,0x17CB9250,0x840D11A,0x15314029,0x1C10008B,0x2B835C2,0x7DA076},{0x134AF084,0x1FD6B530,0x1D81D1A4,0x1CDAB8FD,0xE7A6F65,0x15037824,0x130643FF,0x13832999,0x534E3C},{0x19B2951C,0xFFE780A,0x8915ECC,0x132AFA57,0x1A96DFE9,0x1949A705,0x1540D61A,0xF3C83B5,0x64F6F2}}
+};
+/* End of comb table */
 #endif
 
 #if CHUNK==64
@@ -42,5 +111,74 @@ const BIG_256_56 CURVE_Cof_C25519= {0x8,0x0,0x0,0x0,0x0};
 const int CURVE_A_C25519=486662;
 const BIG_256_56 CURVE_Order_C25519= {0x12631A5CF5D3ED,0xF9DEA2F79CD658,0x14DE,0x0,0x10000000};
 const BIG_256_56 CURVE_Gx_C25519= {0x9};
+/* Fixed base comb table for ECP_genmul - generated by scripts/combtable.py */
+const BIG_256_56 CURVE_Comb_C25519[64][3]=
+{
+    {{0x7305C680019419,0x48D914DC691EDD,0x2999748BCB9571,0xDE60A1E622D95C,0x2B83BCAF},{0x66666666666658,0x66666666666666,0x66666666666666,0x66666666666666,0x66666666},{0xF59E386667A9A6,0xD3E0DD7D20E57D,0x87ADF6D63C778D,0x7EB3B4B81BE116,0x5602FD59}},
+    {{0x4ECC26BAACD788,0x53D1124256DEF6,0xD2AC968F7D9184,0x8C2190E7B99112,0x48800633},{0x5F46AE6AF8A3C9,0xF51643851560E,0xE8C9A21F569739,0x92329C21DA25E,0x2260CDF3},{0xAC129354B2340E,0xC3BFBE79EC4D9F,0x8DEB9EEAD67E4E,0xECCC34F856A941,0x7B2F2988}},
+    {{0x12A4E5ED333A39,0x2167EFBFCD3EF7,0xAB184297B24BA6,0x7CA861B61C3CE5,0x590878E6},{0xC3684878F5B4D4,0xEC176724030402,0x8E60269EF79F16,0x77EE69ABA126A1,0x1267B1D1},{0x94B1E6EA3E72CF,0xA89C1A14E78C58,0x6AF2CA85FD63B4,0xF4FA26B7350247,0x576EDBA2}},
+    {{0x1DCAADD927C76,0x77AD4C5FC2F6F6,0xB5DC9DEF0F5B1C,0xD3047FEB2C2DB,0x2E1B3A},{0x38AB61CA32112F,0x2832EA2F0FF0DF,0x8580D5716C4CF2,0xCB1595E1470EB8,0x47D0E827},{0x20FE657948C9CE,0x42B3AAA3F5BB33,0x1FD61B42127D4D,0xB9660C6B844B53,0x1EB84138}},
+    {{0xA64ED13CA87A99,0x559763BD1EC869,0x42D8D0E1A369D1,0x1FA88FC614C12B,0x7345E435},{0xD21F83D676C8ED,0x2ECA89430B5D10,0x14899246663128,0x98FEAE6FE02C6E,0x5F4825B2},{0x83608789951A01,0x2830BBCF150190,0xAEDDA12B481F7,0xB8D290A0D18C2,0x4F11E2CE}},
+    {{0x15F9D2844F6497,0x6224169D9B9204,0x8446BDBA2ECD62,0x9000D99038E890,0x838D4D2},{0xD27AD0F9497EF4,0x7C06944D6B60C1,0xA7FD4F7D77F941,0x2886D8A11DB709,0x54DE3FC},{0xAF2909482A99F,0x47F5EC610395FE,0x39EC4FC3D820B2,0x458DC83F722E18,0x652AC5AA}},
+    {{0x7336C2B2A57199,0x69CD800CE6EAEE,0xDBDA6AB07A5E52,0x5437ADD6E5FEAC,0x5067A99A},{0xC4C4B59F4062B8,0x2B46F7ABF23D12,0x68DD36AD41F088,0x2B47D52F87CE64,0x31C563E3},{0x4FA6E34160F34A,0xC37D97DFFCAA4E,0xDF1CA152496C7A,0x4036FDF4EB4426,0x701653F3}},
+    {{0xE8A06639F5C2FF,0x7E6491C8D5E9FA,0x99C7E263FB656B,0x7E220C53DD8B4C,0x14A3C66A},{0x2F5BA9FC37B9B4,0x3CFC621EE4931E,0x9668AF38F8178,0xC9E573796EAD6F,0x21D30600},{0xEC7336A295A1C6,0x8387898B2E9B82,0x8CD27BECB31BD3,0x1995D13788A54F,0x112E8DE5}},
+    {{0xEC0E2FD1905BFC,0xD803C2370ABEFA,0xD387F0C6D82E31,0x6087CA1A6A7FE4,0x48230D19},{0x4E1EFB10C9B91A,0x4B7B5E8A4B84F4,0x54B5008F8C43E8,0x9D4E35B65CC513,0x6D415BE4},{0x3A7532B061926A,0xD7142BF556D7E5,0xD71657CB0487AC,0x8DB6D97B768D12,0x73759857}},
+    {{0x9FD556E0CE4D0E,0xD76B8EFE01E460,0xDBD6A502BA7EFD,0x757109769F7100,0x3A4427EB},{0x23B8DE209A77CB,0xCBA57B8C0FA0D9,0x580E6742ECB6AE,0xB38471219875A4,0x739476E0},{0xA6ECEF409E96BD,0x2335BA53C02685,0x118DCFE5DD8E41,0x7466BFAFC9788D,0x79269786}},
+    {{0x4F63D7B108004E,0xDD2A64386EABDA,0x37D3D22568A085,0xD8BA285C7CCC,0x5AB91E89},{0x7682A0A58A68C1,0xB4F69B645E2A7B,0xC1AB71048DD3A1,0x8089429B6293A7,0x34A3EF20},{0x504B4D6F28979A,0x72453928CABF6A,0x5414D34989676B,0x45F95673D0BE6E,0x45B0F1C2}},
+    {{0xE9494D61CE127C,0x133AE2AFB6216C,0xF47488DEF96487,0x963BDAD4171F88,0x80F1581},{0x9D824FB2DA81D9,0xEF01D2F1098143,0xF109017D2DF4AC,0x6327CAE59FA5FF,0x53B120DB},{0xA94D85A347847A,0xCE2EAF915D34A3,0x2CA15A6021A1C1,0x4C210A03248CB5,0x899A08E}},
+    {{0x70330E4D896B84,0x249143E7E23C53,0x4E56BAA7352774,0xD3B26F0248A3C0,0x51F4182},{0xA43F61ECF8AF35,0x1A2605BE16633C,0x11600036D4B101,0xCA5F44C7B25912,0x7E6C7C2D},{0x7464E63CBA0EF9,0xABC53EC9EE7ABF,0xBDEE7B6044AF7,0xB7A2DA3EFC2937,0x4664A939}},
+    {{0xDDBF9AD0B6CD15,0x888AD7650D45C2,0x522637229B6FF4,0x52FCD82BF984B9,0x7BA058B4},{0x2E6B33EC86FB32,0x47706CFAC82B51,0xB4F3710C05CE7E,0x750778CCDCA656,0x6AB2DDD0},{0x4DCF375A26135,0x2E553472185F74,0x4D2922CF17DDD6,0x6631CB2304E5F3,0x12F05DEF}},
+    {{0x4363D41D0FBF52,0x5352BBAAACEF14,0xDF2F263D536B84,0x41015B697470D7,0x7AB4BA05},{0xE3F6849538107,0x47E10708A09504,0x5DCC3E74F7AC35,0x9C0C2DC979D1CE,0x6EB85CC8},{0x646A958374F515,0xEF898C10493D5,0x402584B8359572,0x3DA90E191A268D,0x3F42B60B}},
+    {{0x3929317C469449,0x7B856501250B05,0x431E6C47DF82B,0x1105314473939E,0x5487C3A1},{0x1C2AFF2E1D6245,0x158C0D7B25A421,0x1E7DA57C8FFC39,0xCBBDABD645A325,0x77785EC5},{0x7F3D29916AED87,0xD6F3580D1B40D,0xF1E484ADA95982,0xD1A1F0BCD21AAF,0x66C7266B}},
+    {{0xCE5FCE529A209E,0x71510E2D8B55C8,0xFC565EE436CA5C,0xF0B5F4CC705256,0xF960D58},{0x1EFA5782E45313,0xB608BA902B068F,0xED261B7C4F5410,0xEA4ED025DD6BDA,0x325BB42},{0xD6CE8822DF18DB,0xCBBA45221238CB,0xC28AB6279629FA,0x551B4ADCBBA090,0x3E96B70E}},
+    {{0x5D79EAC03984DB,0xF230AA1DAEDC31,0xCCE01F5EC51C3D,0x6C248FCE76063C,0x6076C0C6},{0x8511DF0F29C9EE,0x4B8F2C620DCEED,0x371D7206E904F9,0x39ECEB14C95020,0x4D2B97A7},{0x85D14ACDDA0E3B,0xB08336AEC6F391,0x88D3DF96EB9AE1,0xE383DA4E8C1A94,0x48342AA6}},
+    {{0x5C1B88B93881FC,0xFB134B6D8AB132,0x138BD4A0536AF9,0x6FC9D6D910C512,0x6C969F67},{0x65FA3E1DD7DE2F,0xB0DC31FE8EA598,0x7B85E5CFD1B390,0x3532F780762D6B,0x534EF70A},{0xB29F8BEC567957,0x58D96B1CBA8D9,0x462802986402BA,0xED97ADFDEB943A,0x57FCA5EA}},
+    {{0x9111518F36954C,0x5BBF310D10331C,0x2A158BE34E478F,0xEA9986A6491A0A,0x188EA34D},{0xB347115219A417,0xB4222EA95B5C,0x5ABEB81857F952,0x2A0A87C883ABE3,0x54BB8CD8},{0xE1B0712DACFF46,0x665B2494A4CD7A,0xFA4178D8DD4CD7,0x23165900B19EB7,0x69C96B43}},
+    {{0x204972B995B016,0x8794D6D707D339,0xD7A1405C6F1BE0,0xE0909E1619CDBB,0x3B2A1F45},{0xC49CBAA6CE8B8A,0x5717DFE1A8A90F,0x6953BB606B4E1B,0x71155F055469E8,0x50E1CC68},{0x54594AA09B7F1E,0xD28036B696FF19,0x3F3A4B4B4B34A1,0x489B7BD9FDE013,0x4C978303}},
+    {{0xB98E4666AE8F1D,0xC85C42D1B5BD6C,0x14CCA04DA58B5B,0xDB6E12013CF6DB,0x5B63ED05},{0x9499E5494C782,0x332A60B8D3EB03,0x56A9EC8E08DC,0xD3D1A968C8320A,0x1C5703A9},{0x83CCB2A47EED86,0x530BB47153C31F,0xE42DDF106DDA09,0x2DC2CCB09381FB,0x70190FCF}},
+    {{0xB5CBF3E9547816,0x5C7B5CF84BFEF,0xCE67C655EC3ED1,0xD2CD62CA53A73F,0x1490F6E0},{0x28E4DFED398826,0x965535ADDC7747,0xD7536D8F439685,0xC00766B228EE74,0x1E8B233E},{0x163CBF3E5B8817,0xE74B533EA54641,0x4888054669D4B0,0xC49C4A62A9DD18,0x5587C57C}},
+    {{0xC6E4CD3C0BD8B9,0x2407A72063B76C,0x81DEFE905DFE5E,0x2F766F51EEB6CB,0x70B02421},{0xEE1A22C8CA96C5,0x883226031E75F,0x5D584432B9CE63,0x38EFD504E49B3A,0x19DD4BEF},{0xEBDA4D4EF9BD1F,0xC7402969F1370A,0xE9F3275891645C,0x255FEDBA2D2A0A,0x56C39EB0}},
+    {{0xFB2A1C2A67D39C,0x3A7FBCA621E91,0xC1E5B68446AE26,0x61AC93CC6F2F24,0x4BAEFF71},{0x8406B0D7863AC1,0x807807D4BD1B7F,0xEE3852EEB4B12E,0xD46E41F3F6F99A,0x35AC9588},{0xA9C96CC32745E2,0xD53B598056799C,0x666B577903A0B3,0xA7FFCE8A23C23B,0x3447614C}},
+    {{0xB7BFC0D0D69A1,0x1D640AA964995F,0x341DAD8E1E7B3A,0x47EB4D37AC7883,0xFEC4BF1},{0xFDB123773039E8,0xAE7F4D743E3D1B,0x433A0E65B43A5B,0x92E8E64741DCDC,0x4C482209},{0x6F1DB17C48EBA1,0x5F5A183A543964,0x8763064147CBCE,0x443C14C244ADF1,0x190CBBB}},
+    {{0x847508095CCBA5,0xF77AB757BA15C0,0xB790B39456AFA7,0xC3E1B7D026757D,0xDFE7D21},{0x80269D9359E934,0x8525C23CCCF254,0x8A70462C16AE3,0x3B8A8439A16D32,0x13115F87},{0x725060F8184234,0xCE9FB7948FD477,0x8F48639201E021,0x86082DBE1A4C4,0x37773CEC}},
+    {{0x7871F242734B80,0xCECF251BF92896,0x7DAB2B02681390,0x78D4845E0563A8,0x2C85DE48},{0x9DC6A85B6937C5,0xEA46686E61FCA4,0xF1FA7DD2671CD7,0xC935368D54CC,0x50676CDF},{0x2BC2FF2F0BF226,0xCAD9C09818AE98,0xEB15234C8733AA,0xBE6B598D79B7BC,0x74228B5C}},
+    {{0x5329300F7A5268,0x3443F349F35E37,0x9C58E8ADE90B52,0x7B14B608BE152E,0x5D917E47},{0x562DD27AA84686,0xA0D1E0C3150C7F,0xE01AC6BFCD9ACE,0xCEDDBA93595C9F,0x5A8A95D8},{0x149D37B7B3FAB0,0x706694ACB317FE,0x52FD75FF387E49,0x953C3C9F5799B9,0x359A771F}},
+    {{0xD8C58E1D897E75,0x43A3652F242E7,0xD03686E146E1EE,0x1FB369212DBF12,0x588F96DB},{0x69896BF1A58D6E,0xAC8E8E0934DAC,0x63BFE62DE38A8F,0x9E76638C36149C,0x2765BA6A},{0xB2C2D8D8DFBD92,0x740D68B7ADC589,0x26B3ED15E1A031,0xA9EC349350B4D2,0x22EA77F5}},
+    {{0xDD1256845D0E32,0xB5C7B0DA031C00,0x35A826B0D4FCA3,0xCB16E0A4C5CC4E,0x73122F02},{0xE08A7C5DD5CBD8,0xFD52FFF48D9AA1,0x37969B109FAFE0,0x16279CE7E44B1C,0x653338B6},{0xA2E5B72E7EC973,0x7CB2C6CB29FE92,0x75FB2F0A1CB895,0x179FEFB81D41EA,0x5B0CEFAB}},
+    {{0x6F6183B0CE3DD9,0x643DCFF51EE240,0x3CBB56E16D978,0x3E55A031002AFF,0x7E3E16FA},{0xD0CA4AC8073393,0xAC7CA7DDBDABB1,0xBF9107CCCB453E,0x113C127DCB9D35,0x5CCF1359},{0x684FA64F517FFB,0x97BBAE2675B5A,0x4986975F91406B,0x551DA3A51888D0,0x53B8915C}},
+    {{0x1EC6B7983CC44A,0xBDE7A63C597A6,0xF9CF0AAED6AC53,0xA29AB22984D88E,0x6933441B},{0xBABD114BF5A66B,0xBE1E51A4C49E5B,0xB626C29C3A90D0,0x526DC87D95F11E,0x5F2C99E6},{0x32CFF476F73AEC,0x2D0CD79D5E279F,0x3414A0ED4EC7F8,0xCCF59337C55505,0x744D7974}},
+    {{0xBA4DA99FE98CCD,0xDB46588320A1BD,0x5D6D81AEA387E7,0xCE9B5F386042C3,0x477ADAB0},{0xAB0712C63E2736,0x8BEB39D69BE4E,0xCDD4FD08472A7C,0x2F34985B34270E,0x653A5F77},{0x41F3EF26370C61,0xCEAE5EADCD23E9,0xD0CDA171A75276,0xC6D37AE8BBA546,0x18A1C98}},
+    {{0x2BF09B682AD350,0xD02D795E872804,0xBEDC401C4EA693,0x5550952AD5B684,0x4B58DBF7},{0x349A357F7B062F,0x2A6BBED54FF11A,0xB149864A1E02A8,0x6027B353934695,0x6137B074},{0x284DECAB4F59B6,0x5D2866527C29AB,0xA4D48D06A2970,0xED21DEB315BFF0,0x238A6D07}},
+    {{0xFB124280ED8CD9,0xD5DF4A9872AD0D,0xD9334041A31659,0x9FD2E0398DEBCB,0x4745DC10},{0x60D3E930901700,0x367A8972C23130,0xA150858339BDA5,0x72CB51D416C5D,0x500B7740},{0x7AC313CD7500EC,0x3E0A44BF8560CD,0xA5ABE599B52EDE,0x903D5EC672EDFD,0x380DBE61}},
+    {{0xBB9EA1D84D1837,0x5C365DF27F2C25,0x9EB063A0D066C0,0x51641314878679,0x5980A9C6},{0xD4B832AC846FC4,0x9E517335A66444,0x88BFDF0DA8DC22,0x2E185C5B8C9511,0x6C3F2482},{0x9FAFE1A19D979E,0xAB01E7D58E7A28,0xE356FF955B7713,0xB8AFD662391581,0xC7B1434}},
+    {{0x7497E4ECF764CA,0xD57619F7A204CA,0xEA6926D3CB8AE6,0x8DB2D03E80A33A,0x160CC712},{0x7CE1C737E25B77,0xCE2A7B7B9F8C13,0xC0A8992AB9A342,0x76E9FBB0863CD8,0x56F5F777},{0xA45A3B17E2C946,0xD1E7D8FEEB8E7E,0x9A891F8089CCC5,0x6A8C9A320FD6AC,0x79F1668D}},
+    {{0x81DB5DDD5CA891,0xCCAA21CCCA0A2F,0x2AE40C30BEF0AA,0x340B4E151CD10,0x44DE8082},{0x2027ACD289B820,0xCB0FAFCCE29248,0x80E5606AAFE36D,0xACF332F52F427A,0x54333C50},{0x382DF8D501DB26,0x19078AF5DFCD72,0xDC6BB8C1D374B,0x77F56D84D11C9A,0x209BFFE7}},
+    {{0x539FBD7A1E7851,0x612501434F8FAD,0xAC5ADD428E7096,0x877D0754A8E2F4,0x284800A0},{0x75C5AFA5F50246,0xC9FE0A3545BA6D,0x3395218D9122AC,0xE039F3168AC003,0x3C530F01},{0x5D73F7287F232F,0x2FCA1DBFD7E9CC,0x779CE1D0CD01CB,0xE08C10385AE03,0x4495BAF9}},
+    {{0x10ABFBA0E40C0E,0x1C29C4B34CFDF2,0x27B6B3978409BB,0x3438CD7F385436,0x532C9C9E},{0x932BA4DE59EF20,0x2DD49A42EC2E6E,0x8F182B275846F4,0xB63ED49E693D83,0x358FDC5},{0xF6F53DCAB72E18,0x42DAC90124DB6F,0xA27C43962D1419,0x14F0579F652FB1,0x5F4F80C9}},
+    {{0x52D40FD6BCC5F6,0x14FF44CE4B4A24,0x8033D4EFBE1497,0x97B90F5D42A7BB,0x55474108},{0x74860D7DE3877,0x30E554FFA874F0,0xFF0721FB77FF43,0xFC30E5E46B07B2,0x1A36C19},{0xA96065BA6EFF6A,0x5EC21C1B95870F,0xA51333C2110610,0xA0D31C7CE089A8,0x737F237}},
+    {{0x59D7DC7CC2AC1D,0xD66EC73161A6D2,0xAC3E933F3295FA,0x876B3AB8D064D1,0x4A4A2E2C},{0xE8791506554DD1,0xFD115CB838DB76,0x4639BF0C8D64AE,0x79C5D85227BA6D,0x377BD9DB},{0xD1FEF623217AC7,0x2DDC9AF704F439,0xA1E9B886FB1FB0,0xD94C61754439A3,0x4C68AA06}},
+    {{0xBD162F39A8C361,0x35F55DF60C313A,0xF9D0D43E1998A1,0xC60CE11E69C6C8,0x60DE83A9},{0x89B17E74B47F1E,0xDF0664AB5A184F,0xEF0C66AE08745,0x5430EA383524C9,0x5452C4B4},{0xFAB58323DE2D7B,0x4A5F294B140FB9,0x2FCF9C73B67089,0x323A6AA5F1282B,0x2B33D2DE}},
+    {{0xB0767675A39428,0xDA083BCC99F3C8,0xE0CC037A55A880,0xF5C675C01FFA4C,0x5BE3D17C},{0x656A7BE98D85B8,0xC180C6BBD59D39,0xF54225DC51A91E,0xE7EA75774A0FCE,0x65FCDC11},{0xD79081BB6F839A,0xB06E721D2607B7,0x97CC373C7B8AB5,0x71C7248555E72B,0x4D72DA7}},
+    {{0x1D562DA37A141E,0x53C23A6DB8A25F,0x2E516AF5DA5AF4,0x1EEAB4A72AE99,0x12142E25},{0xA84B4205427F5B,0xC571B01CAA4734,0xDBB01FBDDF2B2C,0x4482524977C653,0x10EF5D49},{0x8571CED740D731,0x9E12D58C6DDDBF,0x5FD8ED809027A1,0xD8B231A08D27E7,0x5DEEBCB8}},
+    {{0x73A405026BCBF8,0xAB2F0C779E6B94,0x8E3EFA8E10A90,0x77D666C7FE2694,0x656CFF5A},{0x364780EEF8BC11,0xEE327DD41077C5,0xAF0B8298FDE48A,0x28E9F2E8BEDADE,0x2D92794A},{0x1C4367F271A5C7,0x97DD6C50FD3577,0x856EA58441D52F,0xB54C25FC3B3227,0x758B2AB1}},
+    {{0x39DCE3327BB3BE,0xE2D77B51DFEBA0,0x878CCFADDF91C8,0x5E258C712B1FF4,0x32AF9EE},{0x5E06036E75198B,0x28D3E38C1A6F6A,0xE669437AB9E0F2,0x6CAB977EFEC0D3,0x42138E7B},{0x8568D4C4D91ECF,0xA0F26437D35ADA,0xD526C69EABD0E9,0xF6767D44EC2F76,0x626759E1}},
+    {{0xEBFE0D7E441556,0xF7CD37F2316111,0x21E30A89859C27,0x362BDBA2C4E409,0x7E48C60},{0xF2F65900314833,0x7E12631B270FCA,0x87795DC0491D02,0x55661F2F7A5EEF,0x61D909D8},{0xA1500F75E4C6F1,0x3130039E13A314,0x99F0217BE04A67,0x22123232F29968,0x1C9D6F55}},
+    {{0x2C9E00D0470733,0x7B48DAA95F5025,0x8CC07F606C3B96,0xD4235B8C8FD10D,0x15138129},{0xFC955188A3C065,0x418B0DE8789496,0x2F10754858C2C9,0xDD0F6DA0C92ACD,0x3D26989C},{0x6D785C2083F005,0x54521F7AA5C231,0xE88A73C6063CEB,0x16D58BCF88FB0F,0x8E5417C}},
+    {{0x3B0D5D3C9C6F60,0xD639410D0D7E64,0xD99F322DF62A7B,0xF05CA8F2738B89,0x32CC4D3D},{0x83A00E4B704CA1,0x1938B8AFA41370,0x64F02B4096522,0x50DA4546CE17F8,0x4ED18A7C},{0x4A0CD01E9C29C1,0x46F6E9DD63D5C0,0xA9E7F32920D1B6,0x6622C9EBF0CE2D,0x35776025}},
+    {{0xBE1DDCF20E20C4,0x83B8E3E47F85E1,0x3C90B5B7851B74,0xD4190D6F299C3B,0x7A12D40E},{0xA2EB0FA35ED926,0x9EE4D4373B20F3,0x2BAEED533D06CE,0xFA3110A24B6EB,0x3AA47FD6},{0xFF78974095356D,0x49F6A96BBAEC55,0x486A7223CB2360,0x3E67DB22C96C91,0x1FF25FC}},
+    {{0x35162CF93265AF,0xF1855D8415360A,0x65418419E411D2,0xD1E2D7D1FFF0B3,0x75628E55},{0xE8FEE129E406CB,0x183F447A972CE3,0xD79AA0CFB7D40D,0x2003B2CD243DBA,0x7880CC1C},{0xC11FB66FA114BD,0x186E9018BB7435,0xF9934622A8A7F9,0x54D325334232C,0x651AB4A2}},
+    {{0xDEDB767B94C436,0x9F2146F9AF2EE0,0x77D3A94B4CCC1E,0x42D3A7211BDF34,0x7227D543},{0x779A86BA3CEA68,0xE0A1731A060CEA,0xB489DBEE184987,0x9941A3A2384BA,0x34518AD1},{0x355C2488E83F86,0x4FA042ED6130C4,0x42F298DA9CEE3,0x33AA26C9696FCB,0x441F72AC}},
+    {{0xD71DFDCA4C9E83,0x3D43B302AB0C5D,0xDCE9F7F22491FE,0xEDFFEE6D6FADC2,0x3BE2539B},{0x8816F13E8CEB88,0xE4A7CDBB12A3E7,0xFD11CA657E43CB,0xAA36DFD8B438DE,0x66EF7206},{0xE91B65EE9FC1D9,0x6303A3E802A2A5,0xBCA0BF5652AA38,0xFD432F5703742C,0x25D9234}},
+    {{0xF2DFE104DA0A93,0x58066AE4457FCA,0x1A11EE3AEB0705,0x332E43EA689631,0x12851FEC},{0x1381C04C78797,0x64FCA385C75839,0x9450BFA2256400,0xD2240A453126CA,0x16512951},{0x85B88A03073250,0x57D2AE6D22866D,0x915BE916D37D49,0x9687B039F1C2AE,0x569367B3}},
+    {{0x30F9B38B934A1E,0x3F0DFDEF010BB8,0xCE1D9227D1267A,0x5B4C2B2F66BC2B,0x43D676EF},{0x65C4874E35AB2D,0x3FAD47A4246797,0xC5771731CBF38E,0x56CDC13C8FD7E2,0x696CC148},{0xA141593C3EFEE8,0x925ADE3688FD25,0xA7E1814BC5251E,0x5131AC2B992B66,0x13167B93}},
+    {{0xC6CEA1AEE2B6A3,0x4A464C5E3E1122,0xA7FE11832AF210,0x5EC6034FBB2827,0x3E4EEACB},{0x24A3028F70BD8E,0x20F7DAC4675A4D,0x6724057A5B810F,0x74FDE7802A0B83,0xD5C9E4B},{0x291702771F6857,0xCDDED24B365670,0x5F1637E607084F,0x643644E0175F28,0x52A3363A}},
+    {{0x7D314011350E8,0xCBA3CF4204EFC6,0xEB5C0F9795726F,0x656A6E6D8A5F38,0x60F821BF},{0xA3319AE930F866,0x8F15BF93FD8DE1,0x78A9A333FABC27,0x424B827F9C7779,0x6CC9F269},{0x68E8F6827BA99E,0x4B4AF1B14938C2,0x599EE148F3622C,0xA18E86A67D958E,0x3C81ACE2}},
+    {{0xF13CAA9350B86C,0x6AEA5E3D2ECF1,0x7896279FBDAFBF,0xAB3E741303BB26,0x215373FA},{0x1335745EF14F36,0x93DEB8CF11D728,0xEBE973B5B805B3,0x158B0F891E19AD,0x23E38CD5},{0x941DB6D59B0DE8,0x71169C0C3C38B7,0x90BCEEC6203223,0x1FC1FDA3B62339,0x432E260}},
+    {{0xD0B90C668A8A36,0xE95CDA6288D5BD,0x67E81A20035AC5,0x8E5E6C3F541338,0x3680D8DD},{0xE689807682B3EA,0x75FB480250F556,0xDB0C7EBD78AAF7,0xE08EBB23403980,0x5D4BA682},{0x8B389D43C4A35D,0x3E774AC0722AB1,0xAEC4C7EDAFFAC4,0x303C414F51D753,0x675852F1}},
+    {{0xC1D69CBD93273A,0x8A0D9C4244CEB3,0x65947CC3731B7C,0x2011F095F0F2AA,0x5C0F4823},{0xDD0B42C46C2997,0xD097349B5C29C0,0x8EE474638079C7,0x6C68E87C2BB037,0x579782C3},{0x28EF7778E890C4,0xF0C5409DD2F469,0xCF2E41A6CC5AD4,0x1EB6F7C65281C1,0x5FBA0473}},
+    {{0xAC2AE0A49FDEBA,0xC17AAAB4E302E1,0xFF73E6DE49AD72,0xF6755099D800DC,0x2F81DEB8},{0xB68F85514C514E,0xE03841FFDFC027,0xD9D82E1FA1CEA1,0x1FA997F21B8A11,0x489CF377},{0xAB9AE462FB612E,0x60351DD72C62E6,0x3F9CE606DE4AAF,0xA75067ACA5C265,0xFFB3DD2}},
+    {{0x2A61750A0A0653,0xE5C92808C1D745,0x628052840D11AB,0xC1AE17040022EA,0x7DA07615},{0xFAD6A6134AF084,0x6D5C7EF6074693,0x6F048E7A6F65E,0x194CCCC190FFEA,0x534E3C9C},{0xFFCF0159B2951C,0x957D2BA2457B31,0x934E0BA96DFE99,0xE41DAD503586B2,0x64F6F279}}
+};
+/* End of comb table */
 #endif
 
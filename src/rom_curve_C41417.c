@@ -38,6 +38,115 @@ const BIG_416_29 CURVE_B_C41417= {0xE21,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
 const BIG_416_29 CURVE_Order_C41417= {0x106AF79,0x18738D2F,0x18F3C606,0x1806715A,0x22B36F1,0xA67B830,0xCF32490,0x1FFFFFFD,0x1FFFFFFF,0x1FFFFFFF,0x1FFFFFFF,0x1FFFFFFF,0x1FFFFFFF,0x1FFFFFFF,0x1F};
 const BIG_416_29 CURVE_Gx_C41417= {0x13CBC595,0x7E9C097,0x14DF1931,0x14E7F550,0x1A111301,0x15A6B6B5,0xD526292,0x18FEAFFE,0x1F44C03E,0x1E6A31B4,0x70C9B97,0x43180C6,0x1443300,0x19A4828A,0x68};
 const BIG_416_29 CURVE_Gy_C41417= {0x22,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+/* Fixed base comb table for ECP_genmul - generated by scripts/combtable.py */
+const BIG_416_29 CURVE_Comb_C41417[104][3]=
+{
+    {{0x13CBC595,0x7E9C097,0x14DF1931,0x14E7F550,0x1A111301,0x15A6B6B5,0xD526292,0x18FEAFFE,0x1F44C03E,0x1E6A31B4,0x70C9B97,0x43180C6,0x1443300,0x19A4828A,0x68},{0x22,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x1103EA7,0xD0B9423,0x5A1588A,0x6CE94B6,0x16448638,0x244425,0x4F1177B,0x11D35FCA,0x7218856,0xA1A9A09,0xFACAA2E,0xE931A53,0xB0EC604,0x7D95655,0xEB}},
+    {{0x3A5982B,0x1E685D80,0x9A27B84,0x788FD2A,0xC4F8D74,0x12E7F64E,0x1F2A286F,0x1E8287B5,0x180EC491,0x1D51FF34,0x1C8C2ABA,0x27BAEED,0x1BE42C1D,0x19CF7510,0xC3},{0xBC13345,0xD9D566C,0x1C342F38,0x4B07AF3,0x178A4FB9,0x445CEFF,0xCC217BD,0x11BB537F,0xFB273B1,0x9AB6271,0x13F1528E,0x1BA7F3DD,0xE359A80,0xA6E224F,0xA8},{0x94314BC,0xA784AA9,0xDF7876B,0xD3F700,0x121979D2,0x79F2106,0xBCBC1A9,0xEC6CD38,0x1844DFA1,0xA051751,0x19E8FAA8,0x19E6E500,0x1B2F4EA0,0x16C858E7,0x3C}},
+    {{0x78B5A55,0x23230E6,0xA270722,0x1DF8F27C,0x1B435540,0x5760034,0x592F9E9,0x19EA5C4E,0x15AF3F6F,0x11F7020A,0x12F43B84,0x1B773815,0x6023D1E,0x6BD9102,0xED},{0x119047FB,0x1F225A89,0x66A586,0x1B120FE3,0x144C5803,0x1204E389,0x8492943,0x8C6C308,0x169BD55F,0xC876639,0x61BC54C,0x5BDC5A2,0x158DA8F1,0x1D3C44A1,0x17},{0x13B17788,0xCCB14A7,0x1D9CBC20,0x1B6A4E1,0xA6377B,0x1852FC8F,0x14A23754,0xBFD8F2E,0x1D487EF9,0x61873AF,0xF1474A,0x1370E2C7,0x151BAA55,0x4EECF77,0x80}},
+    {{0x12D79E35,0x1E5F048B,0xA7AD98B,0x4AE16D1,0x16B76A90,0x3B1044E,0xB0C1338,0x18A94921,0x1CE49D73,0x152629AB,0xF9E4CE7,0x156FF00D,0x18912445,0x719B8CB,0xA3},{0x1C0A3223,0x1A8CA34D,0x10F5A301,0x7F833BB,0x1BA553E8,0x13D13267,0x193C3F4F,0xA793B49,0xDC7CEB9,0x12DEA5B4,0x1A39CC96,0x12F2BD8B,0x6B67A2A,0x5A8579,0xE7},{0x1190CCD1,0x26C12C6,0xC9D6AD2,0xA2FF7B8,0x1F20C97E,0x16BA6484,0x1DFD10F8,0x44C45AC,0x1E1760A7,0x1A5385D4,0xEA414B3,0x15BEC56E,0x162E60DA,0xF77B338,0xFD}},
+    {{0xFBEEA05,0xA431B97,0x4D0DF04,0x8B23A39,0x1D86D2E2,0xDD9955A,0x684AECA,0x3CFA6E4,0x1656282B,0x3392934,0x10E5794B,0x19EFCF9E,0x1FAB8FAE,0x1418FA0,0x44},{0x1BE32489,0xE719597,0x198FCCD4,0x1C5DA7A0,0x156CA018,0x11DDE792,0x8DC9EE7,0x8BF3861,0x1C4D6D34,0xF4D642D,0x1CA3BBD6,0x1484E40F,0x8267F0B,0x1645799F,0x43},{0x9E05FB2,0x150B221B,0x4568948,0x9BE91F3,0x5390161,0x152A2834,0x12F112D9,0x72989FF,0x92D05B3,0x1EB8E0FA,0x1AC2340,0x1962BC1B,0x5734567,0xF57FA02,0x76}},
+    {{0x1BB747C2,0x83C0C27,0x5068FB7,0x1ACE9CF5,0x1DD7C8C9,0xD395115,0xCA95467,0x1F7917F6,0x1F2803C,0x1E7E1401,0x2DD3AF9,0x791315E,0x1962C128,0x91A3CCF,0x3A},{0xAB95E58,0x11C1FE59,0x7B78418,0xB846596,0x72AF8E8,0x18EC1A46,0xE40A55A,0x118B49A5,0x195D4131,0x12573AA5,0xB74AE0F,0x1F290AF0,0x828FF71,0x1C3447CD,0x4A},{0x1D0CC6AC,0x1CD7AC3F,0x7E48AB4,0x7E6F7EA,0x176A5055,0x379C375,0xC0688ED,0x6C7932F,0xBC6D1AB,0xED663BE,0x1FDE3A5F,0x16C1B7C6,0xE8A5BAD,0x16F14D6F,0x4}},
+    {{0xA908594,0x4D90478,0x194E7D63,0xF72B1FE,0x6B7101F,0x1297A2AE,0x173AD705,0x45DAC3F,0x1D21B8C9,0x43BFF15,0x4182A51,0x1202A352,0x646D0EA,0x1FBFC699,0xEA},{0x133CBD5E,0x11504235,0xD151FE4,0x11790D4A,0x8FE122D,0x12E6262D,0xF794D42,0x1C23CE6E,0x15BE3450,0x1DCAF13F,0x1ACF2FB6,0x108A4CB0,0x4A67DA9,0x1A601832,0xE},{0x18E56CD8,0xB99FC7F,0x1FF86D46,0x14B7C974,0x1778AA4C,0x1836132,0xA997EA7,0x1D581DB4,0xC485FF,0x1841ABAB,0x2DC06BF,0x1985BA44,0xAAF826B,0x175E8AF4,0xD5}},
+    {{0x6C1A8D3,0x45A68E1,0x12BB20FC,0x15151F8E,0x188CFEBB,0x1F5FCBE8,0x9759BE,0x1A5FBAF5,0x1DFD2713,0x1946381E,0x13A3A000,0x1CCD8EBD,0xA993208,0x658B9CE,0x6},{0x1A6982EF,0x17E11482,0x1EC2E89,0xE518D52,0x133475A9,0xA53804E,0x1965CD0,0x9CC2B1E,0x5AE9B9A,0xEF98CE9,0x390411D,0x1006F68A,0x17FE341A,0x14BF1CFF,0x4F},{0x22F710,0x1123D9B4,0x7824B3F,0x15FA8CD1,0x5E0B20F,0x389C534,0x2377B99,0x1E1EF6CC,0xDA07B0F,0xA9F9A44,0x1539F6A0,0x104205CA,0x68AD298,0x497A406,0x80}},
+    {{0x3C9AAC9,0x1EF80AA,0x118D7DB4,0x1012C171,0x1EA57BDE,0x1518153,0x1A5BA350,0x1383FA57,0x606922D,0x160A9D6B,0x4FC9410,0x69FC73E,0xC210EA1,0x7CAD0E2,0x8F},{0x16B1904,0x184666B5,0x1DF716B0,0xD894FED,0xDA1CE4F,0x18420093,0x1DF1DB8F,0xB3FBD27,0xC5C0030,0xFC1834B,0x9131423,0x1B19C6BC,0x9E94123,0x8FA480A,0x43},{0xBD0ECAC,0x14E4BE0,0xB152625,0x1F666490,0xCBF11C9,0x60AE128,0x14935145,0x10F3C7F7,0x89732C1,0xE9E6A77,0x1A91A31C,0x1C2584D8,0x17A4A7A,0x107B186C,0xF7}},
+    {{0xE9C45C0,0xE32CB03,0x82298BF,0x1A667CCE,0x5A6B4D,0x4AF336A,0xFBE6036,0x1F8DBA49,0x1442A112,0xE9CD314,0x6652FB7,0x1184F31C,0x9EAA799,0x18378B15,0xEC},{0x57D7C87,0x9B0C11C,0x12F25B54,0x184DEA3D,0xB199248,0x84D9DC0,0x2B6951,0x1467ACA2,0x4B2190C,0x5FE9292,0x1C0E8AD,0x5C3F732,0x10830E4D,0x1B0D7B3A,0x86},{0x448FF6E,0x1C6DAA77,0x11CCD07D,0x125D351,0x1907CF1,0x1D46FA88,0x19BE6E3D,0x74AC4C5,0x10A0EB0D,0x191B0691,0xCE803BF,0xBF00545,0x3C81C6,0xEBBBE,0xD9}},
+    {{0xBBA3509,0x189D4547,0x88860F3,0x11E4BB9E,0x5E5B9E,0xB311D0F,0x1297033E,0x1B3935CF,0x7D0F475,0x179D87EA,0x195D6FC6,0x115D6964,0x1BD3672F,0x9D407D1,0x40},{0xEA3335F,0x14E917B4,0x129278FE,0xD131413,0xECFB7DB,0x1B481FF5,0xD23D7FD,0x157AE630,0xAB64C08,0x1173046B,0xE7A4A8A,0xFDEECFA,0x1791EAB0,0xA1CB27A,0x34},{0x335D647,0x17F4F143,0x4F0E8D,0x6208761,0x1353F27D,0xB8102AB,0x119FFFB0,0x4CBA709,0x1F47FB6,0xD93F083,0x9111201,0xFC0AD5E,0x795E4A0,0xE1481D1,0xC3}},
+    {{0x5D31A3D,0xDE777C0,0x1B04FFCE,0x14EBD4AA,0x11030B58,0x150EF8DF,0x7A5577,0xFDFAF5C,0x139DD750,0x102775FB,0x51B8632,0xD503BAF,0xECAEECA,0xC761B4F,0xB1},{0x2C8BEF6,0xFAD1868,0x1F7A6254,0x15A68C01,0x13DD9497,0x89DC096,0x1CE01306,0x7973080,0x1F07FD49,0x478730F,0x184EF04B,0x1F05935A,0x64E8DD6,0x135F9106,0x9F},{0xA9C28FD,0x18B548B6,0x9853D4C,0x15516FE,0x1A52B2C5,0x29A89BB,0x151CE494,0x1B2AD30D,0x20EF07C,0x7BF7B3E,0x92E78E3,0x1A55826B,0x404D7DB,0x12B0ABE0,0x25}},
+    {{0x16AEEB90,0x99E951E,0x8A1C766,0xD88DCA5,0x11594187,0x12635BA2,0xC70B4E9,0x186C3762,0x1C50BA55,0x16A2F2A1,0x11C28327,0x3C28278,0xF3CE503,0x16BE2C18,0x76},{0x990668F,0xCA53025,0x1B20E9F0,0x10F51A30,0x63B6928,0xAB227AD,0x101BBB0F,0x114C51C2,0x74E1581,0xFF5F36E,0x19877615,0x19F2CFB8,0x16158C0,0x11CD6163,0xC},{0x1EF51DC,0x5028FA8,0x1DD41B43,0xDD15B72,0x1D1D897B,0x2C61D93,0x41765BE,0x142764F8,0x8118980,0x15FA9234,0x1F61AFAA,0x83558F4,0x3148F52,0x86BFA91,0x81}},
+    {{0x1FF958F4,0x1D9ABAF9,0x10A7A984,0xCCC984E,0x80075CA,0x1BC6592A,0x16B26A06,0x70EE196,0x1B34A480,0x1DC2E10A,0x1512F08B,0x134A98CE,0x635F1FD,0x10BE0CE4,0x2C},{0x1CF5392A,0x17EAEBCB,0xC42A45B,0x659C3F3,0x120A1D22,0x9674ED1,0x167D9817,0x421B193,0x9EC271D,0x113F5E84,0x136EB1A3,0x10D517D7,0x1230AF7D,0x123AA0ED,0xF4},{0x7D81B6C,0x6113FC5,0xF896F27,0x124D5CD3,0x14FE8FC5,0x1E1DDAA6,0x217CC22,0x1079F0DA,0x13983E4C,0x49D49F3,0x9C652E6,0x15CE41A6,0xDA7B7BF,0xBF7BD2C,0x9F}},
+    {{0x1A485DF9,0x2C88ED6,0x15F20F5C,0x18A8637F,0xE339BBE,0x1C9ED04F,0x1C3399EF,0xAB62F18,0x1A67F31,0x1A7AB8F1,0x10935494,0x1D64FC37,0x188A8F70,0x1CF56544,0xF8},{0xAFE200B,0x18E59AB8,0x229C755,0x69D1584,0x312924C,0x1AAF330E,0x11579377,0x18642535,0x66ED449,0x96B9A7E,0x1D5C4AAE,0xE156BDA,0xB34C30C,0xF38EF7,0x31},{0x7BAFC77,0x384CBEC,0xCB28B3E,0x15569706,0x1B751FBA,0xB827D2C,0x19CCF167,0x14F03055,0x177EF7B5,0x77E018A,0xF7273A4,0x105379EB,0x3C4AF4F,0x17A6E60C,0x76}},
+    {{0x25DC537,0x568A737,0x1B9DABE2,0x13F2000A,0x15DC92C8,0x11F4C673,0x14672AD7,0x837AD85,0xF254551,0x1F23ADE9,0x14E64382,0x4ABB7D2,0xD7A3723,0x176CC5D1,0x9D},{0x1857A3EA,0xD45AE3,0xDA4B95B,0x794405,0x172773BD,0xC9DCCC4,0x163261F4,0x608A724,0xB51BA4A,0xD7D9DEF,0xE7E2C03,0xCC88F6C,0xBE524D7,0x1E4C9344,0x70},{0xB58DD6,0xC1F5C16,0x1C96F33C,0x1DEDB32B,0x14E89CB8,0x1A82EDA6,0x1C7272DA,0x60F2DBF,0x104B5339,0x193DCBBE,0x126E2D74,0xEA57C29,0x160A2123,0x176F397C,0x10}},
+    {{0x1305F713,0xA38B92D,0x95A5E0C,0xA536F6A,0x1BE1B8B8,0x4B4FEB3,0x13832A93,0x1EFA7ABA,0xFCD0065,0x19628915,0x1065B7C0,0x7879FF,0x1060B70E,0x1B9E84E6,0x4F},{0xFC36443,0x7FC4F6A,0xD8D726D,0xF102156,0xFFC5D5F,0xC5D2C22,0x1B157938,0xD1D6F36,0x2B0146B,0x1C4DEC5F,0x1399AEB8,0xA4474C1,0x1C0474E7,0x1F262119,0x71},{0x177C4FD1,0x13E9D5EF,0xD9CBFBB,0xFD21916,0xB92DFA,0x99EF3C3,0x1D56D644,0x660F5EA,0x18350742,0x10F30D30,0x771A442,0x819D211,0x1A279E22,0x139530E2,0x2C}},
+    {{0x18710F0E,0x1E2E0838,0x18928B5C,0x1C40C9D6,0x1584BBCD,0x1E3BC4FC,0x16345813,0x494B21E,0x4191CE,0x19EE2E95,0x14DAA3DC,0xFC8759B,0x280F784,0x19CA4DBD,0xCA},{0xDB93D1C,0x1333D698,0x1B1862B0,0x110C6A25,0x2F03D41,0x58E9A2E,0x1A1526A6,0x46CBC77,0x842B39D,0xA73617D,0x8B797D3,0x1127C2F8,0xAEEFAB2,0x18E5DF9,0xC6},{0x1B18D881,0x1789ADCC,0x1D37E031,0x10736A71,0x1704BA5C,0x1B097C64,0x84D7D30,0x165030BD,0x4DA7686,0x1B0E6788,0x191E2C6D,0xBFCE03F,0xD2B2992,0xAEC0E56,0xC6}},
+    {{0x1202F3E0,0x8DF5D7D,0x998BFCF,0x1B50D4E2,0x1639E76C,0x175BD655,0x1F634911,0x1AE1D0A,0x80CCD88,0x43399A0,0x1C93346E,0x107DF8A1,0x1C372A8F,0x10EC2583,0x82},{0x1F80AE65,0x3F223,0x5BF985,0x1705BC1,0x8054C0F,0x1314717C,0x1F8698D,0x767A5CD,0x184D000E,0x10BC3AFF,0x2977380,0x1FD09BA1,0x11FF9A94,0x66607B7,0x37},{0x2C32F9A,0x155BED2,0xDAEBF08,0x78E1884,0x1C5CB7FE,0x114CA4CB,0x97F6F25,0x9A2916D,0x1A28EBBF,0x1F69024F,0x1C2C4DC5,0x492813,0xB3D9F03,0x55399CA,0x42}},
+    {{0x4695A48,0x13AE7DEA,0xEC1A980,0x17DF7EDF,0x1E5BF720,0x16F567B4,0x9EC280C,0x86DA29D,0x1365D22,0x18CE05A7,0x12151CDF,0x6D6BBC,0x49C759E,0x23FA9F7,0x95},{0x16F4ED1,0x5FAF6CE,0x1653E444,0x10E9AE1D,0x874262D,0x16E14926,0x1CC9C4E5,0x12D724E1,0x1009FFC3,0x977A037,0x5F13AF7,0x7AF20AE,0x51142B1,0x1ABCF29,0x7},{0x1B8493E1,0x12408AF4,0x1C4BC94,0x1D928C60,0x1F79A7D3,0x1B43729B,0x137453F8,0xD0BF9A4,0xAF15D30,0x19129AC4,0x159AA982,0x17F662E,0x1B80EB2B,0xB79EE77,0x2B}},
+    {{0x1653B39B,0x1CAEF489,0xE9E9FE7,0x8686FE1,0xED90E5,0x2DF7A7A,0x1C7B55A9,0x1050BA25,0x1CF2B4BE,0x10054CC1,0xDB9AAF0,0x136B1F33,0xB4305E5,0x117C701E,0xAF},{0x166DCCA6,0x11C6F3F,0x9BC848F,0x3834435,0x11F8165C,0x694FEDD,0x10836891,0x542C4B7,0x15272F3C,0x1A0AEE5A,0x13FD1F8E,0x17E4B9CE,0xE7DABDC,0x18689C77,0x15},{0x1ABA30B0,0x13DF242D,0x588D0E,0x19EF6C23,0x194150C6,0xE0076A1,0x134A8F81,0x1FB4873F,0x9644570,0x17439177,0xD9CFD19,0xF761923,0x8ED48E1,0x11B5BB01,0xCC}},
+    {{0x1069E96A,0x1EC620FD,0x9E5E5D6,0x12CFB6DE,0xACA818C,0x65A93E9,0x13F3C5AE,0x1679CCF1,0x11EB92BF,0xA7CF7FD,0x135254E,0x1115527E,0x3B549A2,0x8845513,0x8D},{0x1A88C1FA,0xE563A05,0xD2F629A,0x941693A,0x1F88F900,0xC2D7662,0xDA6497F,0xF935BC5,0x179D71C0,0x1ADD2F3C,0xE4B6D4,0x11348182,0x141ECDDF,0x1E17A0A7,0x4A},{0xBF898C4,0xC5D18CF,0x1973116C,0x83254FE,0x16673CE2,0x10F4DD77,0x1CE39FF9,0xCED4B1A,0x123C9DD3,0xB120D06,0x4D919AF,0x24CF8EB,0xD8F4C99,0x73A0C7F,0xE0}},
+    {{0x1B0CCD9F,0x1613CCF0,0x7DADEC1,0x17FD1CBF,0x19819EE8,0x338EB81,0x181B3D10,0x134F7E93,0xFC38EAA,0x30E0C08,0x3AE3245,0x8884F10,0x14DC6B5E,0x403AA31,0xD2},{0x130BDB6E,0x7E138E0,0x514836A,0x1B886D1F,0x19B6F2E3,0x103A34B5,0xA86094,0x1842791B,0x14C0A6A6,0x1D86B725,0x1D92EEF,0x872366D,0xE443E81,0x16A0D088,0x32},{0xCE515D5,0xAB8919A,0x1A1C3B1A,0xFA263AB,0xD509912,0x1CE7446A,0x17756507,0x1A2EF80D,0x1D9B4143,0x11CDDDA,0x984C7E0,0x1156B5FA,0x47EC512,0xD86AC79,0x56}},
+    {{0x17BB9126,0x512A6C4,0x7E65477,0xAF58660,0x7910FE0,0xA4174CE,0x1F045653,0x17E73CD2,0x996FEBF,0x3185EB6,0xCEDA07D,0x105F72B,0x38A2BA4,0xFED71D2,0xF8},{0x3F2E603,0x22777D6,0x1685762C,0x57927D7,0x861A51F,0xEE725B9,0xF3E9ED2,0x850136F,0x4BAA0C1,0x1E33A020,0x18CC1B54,0xCFB7DF9,0x17459DA4,0x1C4B3A49,0x38},{0xCE028A0,0x19D6D6B1,0x127915DC,0xE023488,0x1FEB5698,0x1863F194,0x90BE9E2,0x1A5C03E3,0x7F5FE07,0x146848D7,0xF210304,0xABE323A,0x85FF8BD,0x11F77774,0xCA}},
+    {{0x5F5D2D,0x16FF20D4,0x1E58871F,0x1DB8B6D7,0xCB7961D,0x99F89E4,0x139C1CEA,0x1EB731D5,0x108C4899,0x11A6DA17,0xD6BE017,0xAF66F42,0x1E7327E4,0x14E72827,0x29},{0x943ECD4,0x385CB26,0x18787FDB,0x14292FCD,0x19B22F75,0x18FE81E4,0x16B64AAC,0xBC530CE,0x5F467CC,0x17F830EE,0x142975AB,0x199B57BC,0x6C7F196,0xE5C02DE,0xB8},{0x1A6C3C1F,0x13AC83E6,0x17E8D6CE,0x8C3E02B,0x1B74DF03,0x90A1086,0x87A9029,0x8D5FF0C,0x177C3EB6,0x105FBE15,0xBE72C3B,0x158D3C8F,0x12204D2F,0x1D96F4A,0x49}},
+    {{0x30B6D17,0x16F985DC,0x15836A81,0x151F9048,0x1F664F9,0x13CEA0EB,0x73A33A7,0x64D3851,0xFF9EE76,0xE15F2C5,0x1ADDBB46,0x139C6CBE,0x4C9D72F,0x19A9F517,0xF1},{0x57C7716,0x65BE848,0x3F7F914,0x10B6D8E0,0x1E99AB30,0xCAE6E54,0x1B06AE8A,0x11C9A7E8,0xBF601CC,0xDB88905,0x1562C6EA,0x1A3CCA5D,0xF340141,0x133A4CA0,0xFA},{0x10DABB03,0x17A2DAA,0x15C6C6DE,0x150CDFA4,0xD1F566B,0x8EDF2,0x5888755,0xEBEAE66,0x142BD6DB,0x16D8848E,0x15CEE0D3,0x5F130AD,0xA7E5110,0x35DE0DC,0x9B}},
+    {{0x105BE5C1,0xF711A,0x179BC2F1,0x47D7E46,0x67B3383,0x17D354B5,0x2A62C89,0x4FAD83C,0xDE4E4EF,0x16283AA7,0x71FF5D4,0x11737DF2,0x16C986A8,0x2E94193,0xFA},{0x9CD9EA8,0x557BA0E,0xC4A584A,0x80572A0,0x926D5C2,0x698041A,0x37E7D77,0xFEF141C,0x1404FCF,0xB77E153,0x18B4BF87,0x1860DBAF,0x1D68A449,0x1387A11E,0x3C},{0x16A9BCAA,0xD6C889D,0x19044FF3,0x1EC4FA34,0x9E8658,0xC9B0340,0x4B79E92,0xC0B9A09,0x1EA902BE,0x119CF54C,0x1B63EBE9,0x18489771,0x18789B58,0x2086E5B,0xAE}},
+    {{0x275C817,0x15AD6658,0x1362D0C8,0x114589DF,0xBAA7D36,0x1AA89B7D,0x201FB26,0x1C4E2DAE,0xFD15CB2,0xF00A12A,0x1056ED5,0x1977E19F,0xD726F6E,0x46149E9,0xDD},{0x1D8A4FFD,0x1DB4E75F,0x5BE603F,0xBF8012F,0xAD53E1B,0x1A9864C3,0x1218989,0x18DC6478,0x1CF0D235,0x18BC7E59,0x1A63772,0x164BBD,0x1C22FCD7,0x1D07B115,0x32},{0x15749F49,0x85C2541,0xBD98BCA,0x1FB4FB82,0x1D86DB74,0x44630A3,0x13383FD9,0x13FF4EBF,0xD482E06,0x18B54830,0x15759EB1,0x1C367F3E,0x1934FC4D,0x15BF4BF8,0x74}},
+    {{0xD73E871,0xFB75A9E,0x14C54FB5,0x80AD4D7,0x1157A27,0x1E8FBC0E,0x1BF06C0B,0x81C69A0,0x1532BC6E,0x40A351F,0x63D2DBC,0x8CB6D90,0xA415FB5,0x4357FE0,0x29},{0x6E8F3D3,0x121BCC8A,0x61EDA2F,0xAE3D0FC,0xD4BCC1A,0x807E64B,0xE65B25C,0x1667C971,0x640BAFD,0x1D5FC95,0x1F211CD2,0x653A60F,0x19F33B89,0xB76AC56,0xC4},{0x19E26598,0x11B01A7E,0x2033611,0xE73359A,0x300448E,0x54317F3,0x15F2A0B3,0x11AD1A0A,0xAEE84F0,0x1D16AB52,0x1D2DC100,0xB0BE933,0x4991EF4,0x1EE12D00,0xC5}},
+    {{0x15FA52B6,0x8235F57,0xF0F95E7,0xD7339E6,0x1D324A16,0x1C44CAE6,0x577F1A0,0x15E24348,0x188319BC,0x1AA5DA8B,0xFE68294,0x612B1E8,0x1B9E0FDC,0x13C4C847,0xB6},{0x1561A0E8,0x1C476E02,0xEA31274,0x13445F52,0x12571567,0x160013C9,0x1685118B,0x62CCD20,0x1EB49FE4,0x142C4F1B,0x125EBF1A,0x16A7A2D6,0xD6E58E2,0x124291E0,0xEE},{0x1965A339,0x3892976,0x5FEA0CE,0x16D9D70F,0xA1967B7,0x1241AF5C,0xFDEB58E,0x8C0CA7A,0x13DF4E2E,0x42ED46C,0xD3708A7,0xF117FAC,0x13C95380,0x1C56B70B,0x11}},
+    {{0xD7DD4CA,0x151A8704,0x10974771,0x16961BE8,0x115CF583,0x366424C,0x1698EBC1,0x19B97A18,0x1A8BEDB2,0x11257D6F,0x11142FD3,0x1CACF6E5,0x5CB8367,0x16752D0D,0xDA},{0xD211F39,0x1D9DB74A,0xA498CF4,0xB7BCB57,0xE890641,0x9639898,0xF64A3D6,0x2F25FB1,0x1FC88A5D,0x1D57FF37,0xE962C28,0x1394492,0x1E1F3785,0xE98FEB1,0x34},{0x12884E26,0x14241EF0,0xA665AA2,0xEF8C040,0x1EEFC2D1,0xF8D209B,0x783E678,0x1DBCBFB9,0x14454085,0x1F08F455,0x1E98883A,0x1B2216D8,0x9BDDF46,0x11665DA4,0xC5}},
+    {{0xAC12F77,0x1ACD7C5D,0xF3C30B7,0xC81E52,0x1D52E742,0x1F474750,0xA46F7F,0x26067C7,0xEEDC4B3,0x575C5F,0xF9E60B4,0x89E0559,0x1B64E699,0x1063F7A8,0xEE},{0x7981B81,0x106F20BD,0x882F67D,0x8C4DBAB,0x260D108,0xFDBC4C7,0x1893281E,0x5EB1219,0x1372FDBA,0x425CBEC,0x1F719BBD,0x25BE8BC,0xA435CF5,0x5A5ED8F,0x17},{0x1195FCC4,0x4C7169F,0x1AB52EF6,0xC514087,0x1AF3FF9,0x186AAC89,0x6E9AC38,0x1FDBCE8A,0x1D41BC99,0x1C1E067B,0x1C4B2CD4,0x1C7592B0,0x1B937084,0x1549B90D,0x31}},
+    {{0x1FB74005,0x5FB6D0B,0xA19A508,0x1CDBC595,0x1970FCA2,0x13563F85,0xB1A9DC4,0xB0609CC,0x346BCEF,0x47B85A9,0x1E3E3AE,0x9270BD1,0x26B06EC,0x1B4BBF6E,0xAD},{0x979677D,0x1EB3899A,0xDF2D022,0xE903220,0x1B4F2F6F,0x16E489F0,0x1D5B432C,0x9C34214,0x1308F48D,0xAC97C5E,0x8E1D30B,0x1B8B29F9,0x1E57E214,0x1A4AC816,0xA6},{0x1F5C9C28,0xF17C9BE,0x7AA9722,0x18736F83,0x1BE14842,0x1D3E909D,0xF2C8A4B,0x301B33B,0x2B4FDEE,0x1768C063,0xE8C81D7,0x27FDC19,0xEC7036,0x15457C91,0x80}},
+    {{0x41844B9,0x106ECCAB,0xD373147,0x1CDCAC65,0x176B09D1,0x1B5FBF6E,0x1B7FE04E,0x1AD57ECC,0x15781F60,0x195B5C9D,0xCD5E8A5,0x3E8D360,0xDF3747F,0x1418C265,0x3E},{0xEA0FC98,0x8284537,0x8F4C512,0x674BECD,0x13070139,0x1643B29B,0xF5A15A7,0x198F0674,0x9877564,0x1567FB2A,0x19B88939,0x60F15A1,0x1669CE8D,0x1D3F0F8C,0x40},{0xBBB7CE4,0x12FBC8AC,0x10C19D69,0x1BF10D2A,0x1283085E,0x12E9E8BE,0x1F6F9283,0x5914F89,0x1DC04EAC,0xB66B33B,0xF6739EA,0x74CAE8,0x14674E41,0x3134A7F,0x6D}},
+    {{0x1CE6B3CA,0xA959624,0x16353B2E,0x586FF23,0x182230DC,0xDD5EA02,0x115B8741,0xC9F9302,0x1F1446FB,0x1F8DBEDA,0x15FFF46C,0xBCB2B67,0x174AFB16,0x8BBBFF1,0xB1},{0x8BF9AAA,0xACDEE52,0xE341428,0xD0A7FC9,0x1DA98BA5,0x18C3B18E,0xE32645B,0x81738A3,0x13E43C78,0x1FFB394B,0x9A9F09E,0xBE73916,0x16075F31,0x19438973,0x70},{0x1787339B,0x2E27CBA,0x9F05268,0x125AEA46,0x1E80346F,0x16F06260,0x97ACD2A,0xDCDB0ED,0x11CDEE0,0x11D9D685,0x1DAE7FBC,0x154DEA83,0x1E8EE4B7,0x6C59244,0xD7}},
+    {{0x15E64FE7,0x185B8B78,0x3CDA343,0x11C00D66,0x1E01C452,0x14752884,0x96FAB58,0x260A4EA,0x1995FDC,0xF1B5321,0xA5B6C2E,0xE6B83D4,0x1D11E9B,0x17E97404,0xAD},{0x19FE7430,0x1A55FD45,0x1FD65DB2,0x19F24512,0x5286F1A,0x6C23E15,0xF68FA94,0x172B5AE9,0x19DCC6E1,0xD0ADC86,0x12A69D04,0x647CE83,0xA29AC37,0x879B573,0x60},{0x1127A026,0x102A795A,0x513F08E,0x6AA80E9,0xB8FBB95,0x280ABC7,0x17F1218A,0x161D625F,0x149D5854,0xDC05CFB,0xA56CF21,0x52EE178,0x88A1353,0x14FE0893,0x85}},
+    {{0x45C0B2E,0xA9589D4,0x4C421BD,0x6B2BC92,0x6F67FE0,0x1BB843AE,0x7769204,0x1979447B,0xD408E2F,0x39ABF09,0x54F9C88,0x13DDC07D,0xFF94BF0,0x450D4B8,0xED},{0x52DB1D,0x1965FEEF,0x4F9CCAE,0x70666F1,0x19060E9,0xA75E9B6,0x1EE2A3F4,0xCD3541F,0x5B9C114,0x17BB4D48,0x6C5C005,0x1A784B58,0x98F1101,0x2C98540,0xD6},{0x1523E8A5,0x16A91A15,0x17AB12E8,0x1EDC106E,0x15BB8EF,0x136925C8,0xC94E7F9,0x1419460C,0x2E1F15D,0x1FF6B2A1,0xD7EBF8A,0x9EE6FC,0xF415F65,0x6A148ED,0x51}},
+    {{0x106083DE,0x19C2A85C,0x1EFAB5E0,0x18FE3AD3,0x133B138F,0x103B97A0,0x675ACA5,0x15424E5F,0x7DCE1C3,0x7005CBD,0x108FE0C7,0xD9F3AC8,0x1E3BAB90,0x8D52E8C,0x84},{0x1446305D,0x1587B3E4,0x1BDD65B4,0x2D0ADED,0x65CBB1D,0x14CC386B,0xB3D50ED,0x17410C9A,0x5FC9F59,0xE50B3E3,0x183C4836,0x1A979D92,0x1CAB6417,0x4EE051F,0xB6},{0x567C4E5,0xB366E0D,0x1A183645,0x145F1B,0x15CB815E,0x10501923,0x1E0B26CB,0x1D9CD99A,0x1FACBA39,0x980CCE9,0x11CDBB54,0x1761EA6D,0x15D465F7,0xD211E92,0x38}},
+    {{0x1DF7AE44,0x1539CA0B,0x91681D3,0x7BBE7B9,0x1EA1B07D,0x1DAAF643,0x1A1C0E66,0xF05AF9E,0x52A223F,0xCE52115,0x86E3AD8,0x15254B25,0x1451BD09,0x78A6DBD,0xD8},{0x10B67B83,0xFF33324,0x1A782FAA,0xBCD0D99,0xD62C686,0x192B8EC6,0x8C33D5,0x16E38955,0x19634F3C,0x1E743DD8,0x18FFC56E,0x15B83DFF,0x87A99B0,0x1523D198,0xE9},{0x1770630E,0x1D16C490,0x14915E9B,0x8312A12,0x935448C,0x5ED8E5C,0xCC80FC4,0x1D01C8C3,0x160AB71C,0x14B864DB,0x1913C7EC,0xBF8633C,0xEDDED3,0x1E57EE4F,0x90}},
+    {{0x79F2581,0xAA832C2,0xE1E92C0,0x1B2B87AB,0x18BB98D4,0xEBE68E,0x1FA77A95,0x9735496,0x142951E,0x8D9683C,0x1CF12AAF,0x10C97DCB,0xD4C4F47,0x1F21331A,0xAE},{0x355ABDF,0x3F24928,0x840C51F,0x1BB045EA,0x1E3CE45A,0x10A521D6,0x1C8A93A5,0x191A72EB,0x12B91CCC,0x1264EA3E,0x7C74260,0x178DA8E8,0x1B07D039,0x48DC44,0xB9},{0xE044C61,0x1A2D841B,0x25B47F9,0xEB604B1,0x193F91C0,0x1646526B,0xEC571D7,0x74E1567,0x717185D,0x11116913,0x967AE66,0x17327164,0xC23E191,0x1BC5CC62,0x58}},
+    {{0x44F9F5D,0xC8666F9,0x6754BCE,0x1A868069,0x70D1148,0x1C02DBE1,0x50AA566,0x1A319762,0x4A60EC5,0x284E0A8,0x90FB5E9,0x18E29072,0x1A18763A,0xDD0873D,0x95},{0xDDB0C01,0x1AA7D78C,0x1CE07B9B,0x738A018,0x240F57D,0x1C36BDD3,0x1731B51A,0x17BA2AC3,0x10B5E418,0xF183A20,0x85420F4,0x9886886,0x491AC7D,0x1CC8966D,0xD9},{0x410A682,0x15708421,0x11111BED,0x290E34E,0x1BEFB2FB,0xFC15191,0x1D90B47D,0x1DC2CEF5,0x1A92E29F,0x1EA8EB84,0xC38D85C,0x8D7016E,0x11CED4C6,0x673A6ED,0x95}},
+    {{0x22859CA,0x1A8E65E8,0xACAAC63,0x143F7128,0x88BBDDA,0xD1FD262,0xB61FFD3,0x1AF6EFEF,0x3085D22,0x1D312E07,0x12D5F739,0x6E20659,0x1C26C80E,0x19C600E3,0x3A},{0x45A11A,0x1EA1BA3E,0xD42586B,0x19245D26,0x11A5A24,0xDF42B02,0x142D4094,0x193949F1,0x2A25E2F,0xEF0A08B,0x1FE3713E,0x13D237DC,0x13FCDAF8,0x2645A92,0xF0},{0x73AFA0,0x167FCF2A,0x1932B354,0x676CAC6,0xBB65D9,0x12B8AAC3,0x950ABCF,0xA281AB9,0xBCD6D25,0x11B5C3F9,0x1D0AB02F,0x78E0377,0x665817F,0x120609AC,0x3A}},
+    {{0x15371FBA,0x14C9EDDF,0x1FFF4CBC,0x166CAD18,0x4B43A67,0x161BAA6D,0x6DC0E4E,0xFEC2613,0x5EC3D1F,0x1715A6BC,0x1CE4F0AB,0x49B8E9,0x388144F,0xEF39DEA,0x61},{0x1A897E74,0xD11C119,0x93F7191,0xE060252,0x139D601C,0x2FD11E2,0x18392EE,0x6232489,0x1949A8A5,0x1B30B233,0x10BFE88C,0x2F76B30,0x470716A,0x155BDB51,0x7B},{0xD4286BF,0x1148574,0x10479DE5,0xA4309DD,0x6229105,0xF63E8C0,0x12390F01,0xD6CA8AE,0x161AA15B,0x1E3E7491,0x7BE60E1,0x7A5CCE0,0xCE85A70,0x94CE90F,0x6D}},
+    {{0x1A2513D9,0x14B4AE42,0x17663E70,0x48B5AD1,0x1CE9575F,0x10D3ECA1,0xDE24D72,0xE7562E4,0x15396508,0xFDBFF1C,0xD6CA65,0x38E7ED7,0x6AE19BF,0x4C90659,0x7},{0x14F69FF7,0x33BDA57,0x12CEE550,0xBC85897,0x1A3C2A1,0x1BD9C8C5,0xE52569B,0xC0C258F,0x556409A,0x514E59C,0x16A827A0,0xFFF11F,0xBFD87A8,0x11C96EE8,0xE2},{0x1EE5C56C,0xC847EE2,0x101BF5D8,0x16DD3895,0xB31D689,0xDB32F68,0x3BD78C6,0x181B03BA,0xAF5FB63,0xC603E90,0x132EC411,0x1A49E0CC,0x1C8AF3A8,0x1FBC1DAF,0xA9}},
+    {{0x183F14B8,0x19D619D6,0x474900,0xF97F9E0,0x17B8052F,0x14483A68,0xA9A9197,0x10CC2755,0x17969426,0x19F2F08,0x1102903A,0x18EE4A59,0x193E3D40,0x11CCCA10,0x62},{0xF4ED62,0x14DEBF1E,0x18F5CC14,0x1D9530E2,0x157E5ADA,0x5F04EAA,0x1EF296D4,0x2E1D5A9,0x153E0DE5,0xAB0A7AF,0x1A7C6EC,0x50FFD39,0x862B3F2,0x1C3A8530,0x3F},{0x911FA7D,0x20D1E3A,0x4823D48,0x1B3DCDBC,0x1A3B0868,0x1768B47F,0x11DFED9D,0x1BB3CC89,0x198BEF7A,0x1317FC30,0x18348671,0x1603A814,0x4FC894,0xC0F9788,0xC}},
+    {{0x170CA8E7,0xB75955,0x1A504354,0x9F63C49,0x1F0A7350,0x4B3885A,0x1C0C37CE,0x1996A91B,0x166ABC78,0xDFFC7DF,0x135FDE6B,0x5749411,0xC3334AA,0x5F836D9,0x5C},{0x10DF6F73,0x1E022007,0x181BBE2C,0xF026BC7,0x271F646,0x9529012,0x18E89C58,0x1246BA29,0xA394EEB,0x25F1809,0xD4F38FB,0x6ACFCD6,0xF6717B8,0x134E1FA8,0x7},{0xFAE6D11,0x306437,0x1807FAAB,0x1055301A,0x4443FE5,0x1B0E9444,0xC6A1434,0x198953B4,0x18769878,0x14FCE93C,0x8CBEA49,0x1ACB1950,0xE1B7D17,0x19402FD3,0x1D}},
+    {{0x1E1516D6,0x12435C94,0x1F100B57,0xC8FFC05,0x1C5EFED8,0xD9BF8A7,0x1F9D53D8,0xB24F601,0x2D7F67A,0x9345CA2,0x1F9830FD,0x39A3314,0x676824D,0xBE9E39,0xE6},{0x1C587368,0x26B7623,0x9CE5DE8,0x11EF76FF,0xDB6FE51,0x6E1C347,0x16776A97,0x10F7BB9,0x1AB1F829,0x2F6B16B,0x96293D6,0x1D27CEA3,0xB0EAE56,0xCE5AF,0x28},{0x6611835,0xC6A300A,0xEB71C9E,0x90593B4,0x91B2B91,0x12B0948D,0x646B237,0x106FD034,0x1F010F6D,0x1F2A7BF1,0x5CDF516,0x154E24A5,0xBAD34D6,0x15437CF,0x0}},
+    {{0x786CB66,0x1070B88E,0xB737AE7,0x29932EE,0x10F5DDE,0x3AFC212,0x1C42AE1D,0x1D9783AA,0x1BF19017,0xE24A0AF,0x1F6790C8,0xE32DE3A,0x16C4071,0xBB56FE3,0xB},{0xD495DF0,0x116191E,0x6F683D3,0xB26671C,0x16131462,0x1068AEAA,0x1D7F0AC3,0xF77EF9A,0x1FB28E68,0x108B9C8B,0x43E80BF,0x1FB0BF6C,0x147D698F,0x18C20402,0x1D},{0x9DA9275,0x1FDA4A6B,0xF1A758D,0x5C5F2DF,0x127289EB,0x125D5457,0x1ECE576A,0x199899A1,0xA08D8F,0x9C5078F,0x425E8A6,0x23FE753,0xD892426,0x253688,0x4A}},
+    {{0x11C83F4C,0x99CA22E,0x4C41CF,0x10F26DFE,0x10F3910,0x1D09D738,0x1E7354BE,0x39E5518,0x51D4DFC,0x1EE51643,0x1EC8509A,0x59E3909,0xF4A9240,0x1E8E9BA4,0xD3},{0x1AB2E3CA,0x1F121D9,0x18BCE969,0xB932A5E,0x193672F2,0x812ADA7,0x1CFBF4CD,0x15A8DD8,0x9AE03F5,0x15FFC56A,0x152EC756,0x9EAEC5,0xC33458A,0x531CD6C,0x4},{0xFE00E7A,0x1A07BCB8,0x1DCC7353,0x18C4C3FF,0x71D4083,0x1C236441,0x1E8BFB89,0x13BEF2C0,0xD277953,0x1BC7ABC7,0xC46B591,0x1E155828,0x1B4F311C,0xB78BA8C,0x4B}},
+    {{0x9A47DF4,0x1156F128,0x1D31B217,0x1BB11A63,0x1B189B5D,0x1D590BC9,0x6E92D99,0x10C5D3F8,0x1CD3CE6A,0xCF4D38E,0x109E8D05,0x13024F8D,0x69CD61E,0x1F9AA94D,0xF5},{0x9050BD3,0xCE21E2A,0x50570F3,0x391C73A,0x1A179878,0x1978269E,0xD04A010,0xB2BB634,0x1CE8B21D,0x1AFAF62E,0x13927EF5,0x16ACA5EE,0x13E49E,0x5ECBE4A,0xEA},{0xD577961,0x418679D,0x6C159EE,0x18637953,0x17877FD8,0x8A997B2,0x10AF024D,0x3107ADD,0x10764D96,0x99933D0,0x10294BC8,0x1E37A18A,0x30A818F,0x1966F0E3,0x31}},
+    {{0x1E7A52D3,0x1C1E03F9,0x5BEE19,0x11BBC501,0xF024091,0x5FD5462,0x400F1AA,0x1B78D155,0x123626DF,0x1D104E6C,0x33A0005,0xE0C046D,0xE7BB06A,0x13FFAB0A,0x4E},{0x1C3C9142,0x9E3840C,0x116A2F4A,0x1F50DDB4,0x18D1E3EE,0x8FADA9,0x10212C7B,0x362FB25,0x124854E5,0x1BAD9E8C,0x349684D,0xDC7CBBA,0xF8860BD,0x8755B60,0x60},{0xA14DE64,0xBBA6E4A,0x6E56870,0x1008B76E,0x43FAFF1,0x1E1DB93B,0x8B1E484,0xAC888D6,0x1365114,0x1B010DCE,0xFF60F5C,0x518DD5C,0x1D8359E6,0x12C944FB,0xBE}},
+    {{0xA67806,0x11EDB83A,0x17DA23D7,0x420B168,0x158F4CB0,0x15940557,0x70FCE62,0xCCBFC90,0x1F7E260,0x5ED940E,0x1DE2ED02,0x1132F503,0x60B6447,0x1FBF6943,0xF2},{0xE942F68,0x3CB1A36,0x18766658,0x133ABC39,0xDEAC29E,0xBEB1625,0x406AA3F,0x196108D4,0x7D065BF,0x1041FDC0,0x1A89E958,0xB432552,0x8D229CF,0x1DF5774,0x45},{0x162C7C69,0x1613F6EC,0x4B3A690,0x1DEAD1F1,0xAB63A84,0x1D9DB222,0x569E8EA,0xB599D2B,0x88F8493,0xBA33BDF,0x13373B38,0x109B1C98,0x1D8C2A86,0x184385D9,0xF8}},
+    {{0xAD53E52,0x127B6DB1,0x1A0AE6D0,0xC56EE48,0x1259E34C,0xF9F9AFA,0x1E65015B,0x189C1D8B,0x17A8E5CF,0x3F15D52,0x17395224,0x18C9220,0x5E72498,0x11A77E81,0x8B},{0xC6BC777,0x17DF92EE,0x117DB932,0x1B1D539B,0x63BAB46,0x5290A2A,0x761C838,0x1A4070BB,0x6289F82,0x153A028D,0x483E227,0x104DAC54,0x179D3117,0x1031AA6D,0x96},{0xA3A3BD6,0x4313090,0x69E6AAA,0xA758DCD,0x1A421F8B,0x10EBA2B1,0xC37508E,0x1E913B0C,0x7EE6C59,0x11584A27,0x10C624B6,0x731A9DF,0xF8EBF44,0x145FE55F,0xEA}},
+    {{0x1389F756,0x13C75D46,0x10B27506,0xE97950C,0x1CE413AC,0x166E481C,0x17F41BD9,0x1E371BA1,0x1A92A977,0xECEE66,0x11E372D6,0x8327623,0x1A5294E9,0x1F93FE0B,0x10},{0x18735742,0xE6E4C73,0x1B8977AF,0x11F7C6B7,0x3BB3BAF,0xAAE2606,0x1186D4F3,0x9820B1B,0xD9F943D,0xC503508,0x17859B76,0x5138D8C,0x1470F7E3,0xEF91A6,0x3D},{0x1944866F,0x1CEC831E,0xB39D480,0x1A5F9D78,0x10FF89EB,0x6E51BB5,0xCB1BB64,0x23C8ACF,0x103185DD,0x1EC79B95,0x1714B47F,0x16459FEA,0xBF45140,0x1F3AF662,0xC5}},
+    {{0x13D9AC24,0x768BE44,0x3E78A92,0x1229F9BC,0x10629B98,0x2CDCD16,0x114FA008,0x4C4BE0E,0x1B647942,0x7A2F8B3,0x1758C12,0x4B19BDD,0x5AEAF1D,0xE3ED5F2,0x4F},{0xF55495B,0xD774B2E,0x2BFB892,0x37D7F61,0x18CA117C,0x88F7F97,0x10572B9E,0xE349DF7,0x52FDB91,0x10651841,0x12AB78EE,0x1513567E,0x11F23A64,0x10913E90,0x21},{0x14607DB7,0x17938F40,0x1F3F818A,0x163842B7,0x18098D18,0x54DB182,0xE690084,0x2ACC4A,0x1FED6D64,0x15FE1235,0x15C4C7A1,0x1D225C91,0x1522470B,0x130B048B,0x84}},
+    {{0x1E977E86,0x11DF4754,0x7516E4E,0x3ED9B60,0x1DC64191,0x17143507,0x197439CE,0x3D3330A,0x1673071B,0x19B85370,0x541522B,0x1C5C4896,0x1C4563DE,0x12D1F90A,0xF9},{0x1AED47D5,0x132CF05E,0x22F25BD,0x1D6E25F9,0xF03DE7A,0x1ABC9490,0x14B0E9B5,0x13CC56E0,0x6A2B9C0,0x67F1207,0x14B18875,0x2CCA38B,0x1F446B73,0x1263DF09,0x4A},{0x9F13177,0x1BE92137,0x11054CC5,0x1E284789,0x27A467E,0x2979FFE,0x1570FE73,0x8CB8DE5,0x124D3959,0x16B051A7,0x5B4E459,0x102F070E,0x185DB6E5,0xC259D84,0x40}},
+    {{0xC2EC3B2,0x1954525C,0x3A3BCF5,0x19D8E408,0x1EA11482,0x1F8F761A,0x149F7CCC,0x978B263,0xA66654C,0x1ABFFB4B,0x1D166A59,0x53E9C69,0xC90BA80,0xA279B7B,0xE8},{0x137B5E20,0x62ED8B0,0x1ED8EF4E,0x1956563E,0xA59C327,0x301DECF,0x61539D9,0x139B5471,0xD0EF5E6,0x1490FE40,0x13EBC028,0x223F5A9,0x54D6FF9,0x13A6FA4A,0xE1},{0x31768B4,0xCF8E3B1,0x1809699,0xA7EB31E,0x3BEC2AC,0x1723C795,0x187E9364,0x190FDBC3,0x2169B6B,0x1D0CFD07,0x164765F2,0x78FA519,0x154EBAB7,0x3097217,0xE8}},
+    {{0x1E6DAA40,0x1990AAE3,0x1A2FF54A,0x16FE20E5,0x126D7F13,0x7F9C1F5,0x413C2E2,0x76CEBF6,0x142016F8,0xBAAC525,0x94F87,0x12D52A88,0x6E94AA8,0xB10645C,0x41},{0x1D40EA73,0x12ED96D2,0x5BC55C8,0x17491B7B,0xF69940E,0x1F7974CC,0x55A0093,0xCC0120E,0x4F29F4E,0x1EF816C4,0x9DD4AC0,0x20F796C,0x1798595,0x6523A99,0x1C},{0x1167BAAC,0x15A251B6,0x190DE55B,0x125B48A6,0x6BAE9EB,0x1C0A4B02,0x1CED534F,0x156D3F0C,0x1A8FF83,0x9934A59,0x10B1F2F,0x1EFD1742,0x1E898D73,0x18AFA5E0,0x35}},
+    {{0xD0B644E,0x12C31747,0x1447B834,0x11CD6235,0x976C19B,0x1B771E6B,0x1A7DB11,0x18F21EBE,0x509612A,0x192F40A4,0xB23B91D,0xB88062B,0xAF6D0AF,0x1B7543A1,0x9C},{0x1AE715FC,0x1BDE6EE2,0xADD43D0,0x1AC2A52B,0x3424D1,0x1B98FC07,0x3CD5C2B,0x2034093,0x1AB67B3F,0x6C9D9BF,0x145560BB,0x17046ED1,0x62E0515,0x14876DB1,0x1},{0xEAF75E7,0xF1075D,0xB343374,0x156A7F09,0x658CAB2,0x46EFEB0,0x1376ECD6,0x150B71EC,0x1645B091,0x3964D5C,0x1CE46D5C,0xEDC9482,0x33468DE,0xDC76128,0x56}},
+    {{0x5F24909,0x955F424,0x123DA866,0x102D217F,0xA5F1FD4,0x167FA6D,0x1679F237,0xF0003B3,0x6D1A23C,0xEF98F8A,0x1E4685B,0x18F7895B,0x146534F5,0x1F16A2E5,0xB6},{0xEA8F62D,0x19A19201,0x18C1D2BE,0x406E501,0xDB6D757,0x1347E801,0x1B784334,0x1F48BF3C,0x5F236A6,0x1CD61ECC,0x168FCFC7,0xE8CBF4E,0x10D8EC41,0x178722F1,0x57},{0x75D623,0xD0CEE9E,0x2D7845C,0xBFFADF5,0x16365AA4,0xA6B2D90,0x6E193CB,0xD7DEF05,0xC689749,0x10D5A08F,0x185A75C0,0x8E568CF,0x188462F9,0x1C63E398,0x2A}},
+    {{0x9084D16,0x1FE9BE65,0x8FF90CE,0x1EAA890B,0x79645E4,0x631B046,0x6156E32,0x1E9C5E15,0x10A40F7E,0x1CE361AD,0x191E8DE7,0x15B9278E,0x19C5CE5,0x177A6541,0xE0},{0x114C4000,0x19F57A55,0x23968E8,0x1097DB0F,0x1A41F67E,0xCEC520B,0x16144497,0x9C9B3E9,0x4513039,0x1280370,0x1EC5CFB5,0x10E8A248,0x14F847B5,0x3DA5B3A,0xE2},{0x5171865,0x100915AB,0x3E96A62,0xF9EBB65,0x20F11E2,0x1F740D73,0x9568F,0xF7828FA,0x9308DC6,0x20AC728,0x1538DF93,0x663B2C7,0x98A4E2E,0xD9AB0F3,0xE8}},
+    {{0x52A4216,0x14576AB8,0x1EDFA4F5,0x74876F9,0x105F41B9,0x1AE966AC,0x80C4717,0x57B80FE,0x3D94192,0xDFC70EE,0x5EA3F92,0xCC660E1,0x1266A4FD,0xFDA0DC6,0x44},{0x19359345,0xDB926D5,0x1C447256,0x7E09EC1,0x169E188,0x1E9A5916,0x163E8CB,0xFA635C0,0xF5A299D,0xF2BFD7C,0x18227B80,0xBF5B1E2,0x96C1E69,0x10644E2B,0xAF},{0x96EE44D,0x30E91F5,0x3B6AA67,0xD5E122B,0x3D8A305,0x16710393,0x1631DF7D,0x1BB8DFF3,0x2051263,0x1A8BFD6E,0x1EBEC25F,0x13E19BEC,0x1A82D363,0x1BB9E670,0xA7}},
+    {{0x1A4A2E60,0x1055F1CB,0x18584FCD,0x13A98408,0x17721E54,0x11F4EA58,0x148DB161,0x127EA695,0x14F44ED3,0x1E4A5DC4,0xD9CFE30,0x1CAE0634,0x49A2EBA,0xE9D878E,0x5F},{0x1F0D36C2,0x1AC72AE8,0x78C0285,0x1795F584,0xEF56024,0x10F0429D,0xADF826B,0x1D46300A,0x595B7D3,0x13C19EBA,0xCFBA49F,0x1BDF273A,0x99CEBF1,0x48097C5,0x32},{0xF4B6D86,0x1395999F,0x1AE94E32,0x5C7FBD3,0xF3EF1BB,0x153593FB,0xFE2DDA0,0x1B5538B9,0x166DD68D,0x19BA4D49,0x11FBE65E,0xBC5A0E3,0x5D63603,0xA15397E,0x2A}},
+    {{0xE3362E1,0x1AE8C925,0x168C648E,0x1B755998,0x156E05AE,0xE535620,0x16F197FD,0x5EFDD1,0xA00E111,0xABC7D1A,0x4330A1F,0x1CB5179E,0x15649E4C,0xF360800,0xD7},{0x1E1C4852,0x163C7970,0xB3CA920,0x16AFEA41,0x1DB595D,0x74A987,0xF5F1691,0xEF0F752,0x1732B9CA,0x134BFC2E,0xD39EAB5,0x2E10800,0x193ABDF0,0xF5ED7C,0x7D},{0x9480596,0x18D5400E,0xA99FCAD,0x11D2A812,0x25FDD2,0x3963D18,0x1952B90,0x12194F4E,0xDC5E66E,0x437B05D,0x8534224,0x15B0A960,0x120C6C1,0x1F37098E,0x57}},
+    {{0x1833BEA2,0x12E2DC8B,0x150700C7,0x54E9916,0x4E4895,0x2B7A310,0x105218A8,0x1FE2A96,0x98F73C9,0x9296B97,0x1BAE3AB1,0x1850682E,0x5481FDE,0xF1B78B,0x3C},{0x153D85E5,0x1C872CD4,0x1033245,0x1FE7C01E,0x1AB1003A,0xDB094A8,0x163469B7,0x1EB00CD3,0xE940FB3,0xA35F34C,0x89E90BA,0x1AB658A,0x3E0F11F,0x984AC62,0xA8},{0x8A1BFB6,0x15CBCF9A,0x98A08CA,0xF79126F,0x111B4A6B,0x8BAFABA,0x571CF27,0x2B4D7A,0x121F9505,0x1D5989C8,0xB21F394,0xB2F4389,0xFA50EDA,0x6A8D057,0x4F}},
+    {{0x17B63F85,0xCDE442C,0x5DF42C5,0x19DB89DD,0x1FD65E0B,0x4E26DF2,0x1128897F,0xF96EB3A,0xAD990BB,0x2944559,0x16DB4547,0x1BB5861D,0xC46D50E,0x1FB62ADA,0x93},{0x137E08AE,0x1FABE057,0x8417F0C,0x13CE8159,0x149FC39,0x94C58C2,0x1775D0E4,0x5F016E5,0xAE3C8C6,0xA04E854,0x72F8843,0x108461D0,0x3A6499F,0x9A83B07,0xB4},{0x1BF3AA76,0x1DF36DD7,0x5FA945A,0x1134A3B7,0xB13625,0x1D3E5422,0xDD33996,0x1E2D2C45,0x6639600,0x49F4730,0x87A438,0x1D50706C,0x18887A35,0x1FAD4963,0xCA}},
+    {{0xB1DA3B9,0x1D75BF3A,0x1066C46A,0x10ECCD74,0x12B6C8A3,0x181960BC,0x15C9AEEA,0x77F58B4,0x13C7FFF5,0xBB2F1BE,0xD607D58,0x1CBE1333,0x14C01700,0x14081930,0xFB},{0xA902F31,0x11CFF6BF,0x14525095,0x149DB5DA,0x171E0D88,0x10B24173,0xE1DBEAE,0x1D1C962F,0x1C4C44C,0x485B4DF,0x19ADD3F9,0x180B1AA7,0xD8DB3EA,0x1AF86D61,0x63},{0x1C2CB699,0x1A4400FD,0x19221521,0x221876E,0x11E3E478,0x1CCDE656,0x155075F2,0x3FB2CCC,0x121A0150,0x1DB9D9A9,0xB43E18A,0x1A792542,0x7E22B10,0x1D145D97,0x96}},
+    {{0x1C1A7289,0x191704F9,0xB952CA2,0x12957E68,0x327C6E0,0xF57C08E,0x5A3198B,0x1B02F3C9,0x4BE5153,0x2ACAABA,0x6C48CC9,0xDC92CB7,0x595D0A3,0xD63CC5,0x9A},{0xCEF6A5B,0x5E6159,0x18332C87,0x174B3674,0x104CD3FA,0x2A72584,0x178D7C48,0x14190CF1,0x104C7EDF,0x84BBF73,0x43E2DCA,0x17841F5B,0xA58C775,0x1DC553F8,0x6B},{0xB97933F,0x1AFD145,0x195B8B10,0x95264F8,0x1FAC8F6B,0x1DC13EF1,0x14B1DCD1,0x438F74E,0x18FB9A12,0xC4A9ABC,0x12D05CFD,0x1A4CE7F6,0x1529F660,0x16F6D141,0x52}},
+    {{0x949087,0xF6D66C7,0x19055628,0x11DCBA71,0x1233126E,0x8CEBE50,0x4ED90DB,0xBC0AE6E,0x14E14F4D,0x9903DB6,0xDA57A77,0xA1D84,0x160DFDFB,0x78712D8,0x5F},{0x2C777FB,0xF1C5425,0x31CD750,0x15190689,0x1CB59DC8,0x16779F72,0x1FABC4A,0x731F12E,0x29C02,0x1FB74C41,0x15F42D48,0x1A30E459,0x13AE0B34,0x171F9915,0x3F},{0x3C5D9FA,0xDEEB067,0x1399EBE4,0xD00C94,0x1E75460E,0x4ADC6C2,0xC853D22,0x9697C9C,0x155B59A9,0xC32F930,0x1334FA87,0x17EFA6FF,0x1D363A19,0x1A6B10C4,0x35}},
+    {{0xC5FD95D,0x8912309,0xFC8AB8D,0x18EBEA9A,0x44FDEEF,0x2FB00FF,0x10FF4261,0x7B68D6D,0x160F82C4,0xCBE889D,0x8DC1002,0xBFF6BF6,0x1A2921C6,0x18C863CC,0xE2},{0x896FF30,0x625A71B,0x157AAB0C,0x1862D056,0x1E329DAA,0xC8C838E,0x95777AE,0x1C6B1D94,0x1BBD27F6,0x144C385,0x10A01066,0x1E3DFCF3,0xEF1F3E,0x36E9141,0x85},{0xAAE1B40,0x18635D6E,0x5EFB86D,0x18003448,0x7BD6D3A,0x84005AA,0x158A029,0x11218123,0x7B75A4,0x34308B6,0x1C4FF885,0x18955190,0x4E34D7D,0xCCD7BAA,0xA2}},
+    {{0x5C83464,0x12131A27,0x1441DC9,0x1CAA8FB8,0x5677B73,0x1857FF9,0xFB8BFF9,0xE57BC7B,0x12153636,0x171CD99B,0x10B4717,0xD40B1AB,0x50BC5AD,0xD97DEFB,0xB1},{0x94B3570,0xA5259C8,0x531661B,0x8DA5CB6,0x1628DE6C,0x5FADDC9,0x5077599,0x10746355,0xB63D41A,0x168C9BB,0xD6ECEAC,0x1461BAD5,0x1874D877,0xAD1805B,0x40},{0x123A353C,0x4A3527F,0x8BEC9F4,0x1C3E8F40,0x1208C241,0xA4D5C4D,0x17E0E782,0x39713E7,0x1E140D41,0x127ABD78,0x1784B607,0xFE315B,0x1D29B21,0x8B76FDC,0x79}},
+    {{0x192D0E85,0x62F7CBD,0x1309DCAF,0x1ECB38F9,0xFB0F38E,0x11F8B428,0xFB62C4A,0x1FB053EC,0x1AFD352,0xDA2EEFA,0xD49F9A0,0x15DA7E97,0x162ED853,0xE2A8AE9,0xC1},{0x187E1B6C,0x1C4B33D7,0x132EB840,0x1EBC996E,0x1B964792,0x473923B,0x1F660103,0x6774D0D,0x148B7603,0x5518F7,0x187B4B5A,0xDD9781E,0x131A65BD,0x4D2D2A4,0x1A},{0x1247EB63,0xA6909C0,0x114BB2AB,0x170C8E39,0x1C0F61A,0x16E51481,0x2C71B61,0x14B17084,0x1CA53ABF,0x114185AD,0x34C1100,0x8FD671,0x40996F7,0x1844753D,0xAA}},
+    {{0x169F8718,0x17AB7FF,0x81A147D,0x7B7B229,0x14FD16C4,0x1F53130A,0xF4D625E,0x66446A,0x7FBD267,0x6A377FE,0x142F7DB5,0xF963B11,0x3870AFE,0x186EF426,0xFF},{0xF888353,0xECEC70B,0x1E8443F3,0x158DED6C,0x175FC46B,0x13D57308,0x1D434C12,0x2E9961A,0x8E1572D,0x1F767FED,0x1831A204,0x10C35B17,0x38B5F80,0x8E15395,0x33},{0x109C5BBA,0x79F441B,0x175D28DC,0x1095034,0xDEC585D,0x69DDF7B,0x1386DFD9,0xCEBF855,0xA4A565F,0x132A05CE,0x10E07A8C,0x142924C1,0xD48615F,0x220AF74,0x57}},
+    {{0x4980A74,0x93B7D35,0xF1F28D1,0xCBD9592,0x4C63705,0xA096334,0x17142F27,0xBCB9EFA,0xCD45DEE,0x1862718B,0x17A1B64B,0x38F3FEA,0x98D18B3,0x101E281F,0x0},{0x6B22963,0x17718937,0x45F062,0x160D851F,0x1E0D604A,0xF30B6B0,0x1A739AA4,0x1424E2BC,0x291E117,0x4E2B4A9,0x480ADAB,0x17A69632,0x1CF01D63,0xDEA4F17,0xD2},{0xA73057D,0x381874E,0x13095D00,0x9AD0337,0x7A770C1,0x1C5D36C3,0x79D91B0,0x11AC819E,0x1B587DC0,0xCEE1BF2,0x19DAABF5,0x137F7DA3,0x64B2CCB,0x5B8DC0D,0x60}},
+    {{0x955FAE2,0x1E4716B9,0x1F75FC38,0x8877140,0x1D59A6A1,0x15E47ABC,0x1F47D0AF,0x18EEC5A9,0xD30C48C,0x1C67E226,0x1EC8567B,0xE045BAB,0x1F54C8E4,0x17D94A22,0x27},{0x84B1083,0x550EBD9,0x155E1BD0,0x47F6D94,0xF9A7D0A,0x1C746C89,0x1656084,0xAC4B999,0x4780EA3,0x526BDF6,0x6504188,0x116C8BF,0x1D703CC4,0x1E4302EB,0x73},{0x19D5AA7A,0x1B6366F,0x6C3B4FB,0x5243AB8,0x19978B60,0x188F58C5,0x3AC21FA,0xBDB978D,0x15D85B30,0x26058C5,0x5399FBF,0x17B793B7,0x6CB668B,0x35942F9,0x50}},
+    {{0x11252150,0x10397942,0x19C87DA1,0x5C39239,0x1136198E,0x5BBEE25,0x698107A,0x14F78817,0x7AF211A,0x73DD25D,0xCDD16D,0x18F9AE77,0x933960F,0x1F70021B,0x69},{0x13EA8B29,0x73D64B3,0x1DF054E,0x1A94B194,0xD187530,0x1A88C122,0xC47F193,0x1A7BA881,0x369AADD,0x1E86EB5B,0x106494CC,0x1EADA0A0,0x1C7145B,0x5AD0616,0x40},{0x1E47D6E6,0x15BCB0D4,0x1BED5AB1,0x154CD0FB,0x1D5D0040,0xEDADB42,0x7635A6A,0x1192B68B,0xCC7AEA1,0x48163CC,0x41566,0xF2B9738,0x13030D86,0xB12D1C2,0x28}},
+    {{0x1035E4F,0x1A36C0DC,0x19B0D9B2,0x1A7F37B5,0x1BB7289B,0x68DC43,0x125BC5FC,0x5A5AC49,0x8470E8C,0x16E74B26,0x232F6E3,0x1C59EAC0,0x43D6B2F,0xA3F2147,0xC8},{0x9F68379,0x26EE69E,0xD8C717D,0xF401181,0x292BEC2,0x12BD89AA,0x1526B609,0x19E5668B,0x1218B7E,0x1E8A2F14,0x1C996406,0x112D8859,0x39ED14E,0x17264BEB,0x51},{0x1CDDA678,0x1272F4FC,0x175A91E2,0x1E367D28,0xB1F66F1,0x9991E36,0x1B56078E,0x1DAEC6A3,0x1D87BB75,0x13725D8E,0xEC9F6B6,0x2FA5501,0xAC6002F,0xD48B9AD,0xD5}},
+    {{0x17062CE,0x678EB8D,0x14919BE5,0xA04B858,0x1218E710,0x4BA821E,0x1CB78437,0xE4ED3DB,0x14BAA92,0x1AB86D42,0x5916A02,0xFDFAE0E,0x1DC517C8,0x755E670,0x58},{0x15B76ABD,0x1BCC87AF,0x1F7B235F,0x1D3F716A,0x1CDC5A0D,0x23356D5,0xCA2CEE6,0x1EABCC5B,0x1DDD3C1A,0x1186E4E4,0x1B187EA,0x949931B,0x1E21781D,0x15B3C34B,0x60},{0xB51EC17,0x98AFB6F,0x144A30AD,0x5F8C77B,0x1DAE3272,0x82B6F15,0x12B631B5,0xAF4FF21,0xD79777F,0x13BE49BC,0x1DD8FA46,0x82A0C64,0x1A0099E1,0x14E5A7CE,0x33}},
+    {{0x11D082A5,0x1E7F2541,0x19A1EBB0,0x37193E2,0x11F89662,0x2E75340,0x1966D87C,0x135CB48E,0x18B4FA9D,0x133E250D,0xBCA4C21,0xA638068,0x553849E,0x7632A6D,0x4F},{0x1BE5D913,0xEDBCE7,0x98D70CE,0x6E53708,0x1C1D915C,0x1AF88852,0x17CD9D11,0x1AF52416,0x190AB6FE,0x13253633,0x9CAA8B,0x10E8D955,0x14ED1D39,0x11343649,0x6E},{0x112EB543,0x100066CE,0x103B7B6E,0x1A78161B,0x25DB07E,0xDA5345,0x16E8BB61,0x11BB1BF7,0x1739728C,0x5DDFA95,0x156D11B6,0x15CACBAC,0x1706B60A,0x17B1AA59,0xAD}},
+    {{0x1E067889,0x764ADF4,0x1A04F542,0x1E7D6D34,0xE3BEB3F,0x192A9BF3,0x1DFA86F3,0x30B761C,0x42BE3AA,0x1054D5BC,0x1AA8B0CB,0x3C631C7,0x11920EB6,0x1EE8B866,0x9D},{0xB35EE47,0x914AE79,0xD42182D,0x1E55BD6D,0x13F86227,0x1D037719,0x977EF76,0x1BF4D688,0x1DD591E7,0x1E8C9A6,0x18C4172D,0x120DD7C7,0x12794D2,0x1932715A,0xBC},{0x121DF3D4,0x1EF8EACF,0x6182B56,0x165A2348,0xD90769D,0x2E301C4,0x12AD39EF,0x3388C1,0x180E79C8,0x1EDE872,0x11E35808,0x1EE7DAFF,0x1B31EBEC,0x132506F6,0x6C}},
+    {{0xAF6A65,0x6EDC88B,0x15EAA73C,0x94B3AEC,0x16BB8BFA,0x8FBC3D6,0xE399653,0x166893BA,0xFBD7343,0x1D978757,0xDC2B9B1,0x14442A0E,0x3AEF9C0,0xA99B86A,0xE6},{0xE4BDAC4,0x1E826628,0x1845BB80,0x10A41721,0x873A560,0x14E0D821,0xBACEC09,0x14084C17,0x564764E,0x11A251AD,0x1F6C4352,0xA4D92C0,0xD11917C,0x32FBEAA,0x6C},{0x1D628165,0x10612D92,0x10896D40,0xD952641,0x1C0FF784,0x19D015D2,0x794F77B,0x1BA34571,0x1B668D8E,0x34AB707,0xD8EED0E,0xC4D7BE,0x5680E27,0xDF83599,0x42}},
+    {{0x1213BB0B,0x1542C873,0x1236E3BF,0x1C916CE3,0x1F121AF0,0xE172505,0x1C894070,0x1F818AA4,0x1A83B928,0x583B870,0x1D441AB1,0x14CAB8C6,0xB92AF40,0x148A790A,0x9A},{0xF47CC87,0x194D0D35,0x13A7D6C,0xA4997ED,0x164D0B28,0xDF9AA98,0xD13BE69,0x19F8B0C5,0x1F631FF4,0x35975BA,0x91854A9,0x1F02919A,0x2617FA9,0x1F67459F,0xF9},{0xB8E93F5,0xEF0A142,0x3A93BD8,0x1D73CC86,0x14815CED,0x114F250B,0xF86FAF0,0xDA979CD,0xD6C6C40,0xE58B499,0x3C43A1B,0x18377A65,0x7092D61,0x3CBC41B,0x9A}},
+    {{0x1FDCE8C4,0x19D973C5,0xD934C99,0x4DCD138,0xC5BF4C,0x1940EEB5,0xA42B672,0x17B58570,0x11F9B901,0xEF511CF,0xAE708C6,0x10C97198,0xBB04E7B,0xDEC2FCE,0x97},{0x3861942,0x15CB8A7B,0x1068552D,0xCB0C37B,0x1D19B4E3,0xD887067,0xC09C47,0xAD16C3,0x1308B39E,0x1DD1DCD7,0x58A0AC5,0x765B011,0x16A8FA2A,0x28E89C9,0xB},{0x1C276007,0x15EF1843,0x15595490,0x1B0BCDF3,0x14E98D64,0x14EBD642,0x13208CD5,0x169841EC,0x14135084,0x7F5C6DF,0x58BD3A9,0x1ABAB878,0x14D381D2,0x19547DA,0xE3}},
+    {{0x1C819361,0x19987C7E,0x45ECB45,0x53B8546,0xCD3B80E,0x429320F,0xFD971F2,0x1BFC508F,0x64630EF,0x8A53C1,0x1234C7ED,0x6EDDDFA,0x1A4D65C3,0x46F5CD6,0x27},{0xD847581,0xA94F344,0xEB63FC,0x3A0C65C,0x106DCF11,0x15206667,0x14379E70,0xFB8C8A5,0x9214653,0xE8EEB15,0xD8753CF,0x6C21752,0x17A7FC2A,0xFD4F1E3,0x89},{0xCD7B61B,0x1797C2E5,0x1677BDCA,0x1E4D5FBD,0x1C8C0919,0x62D4A61,0x2B57754,0x1F465AB2,0x191582C9,0x1E54310,0x140E0A38,0x1AE84DCB,0x1AA97C3,0x1F0FC6CD,0xC1}},
+    {{0x1FB33671,0x112DFE88,0x1B26FED6,0x21EF80E,0xDF8CCD1,0x73F6D30,0xE7E3E82,0x17A9178B,0x6B76101,0xF5B0A7E,0x11DA16AF,0x4352478,0xEF33115,0x1FCECEA7,0x11},{0x10DFB1C9,0xEE503D,0x131E7E44,0x1216C50C,0x7F9AA8,0x610D1CE,0x8CE8311,0x151F809E,0x6C7F466,0x4C7C1B5,0x11D0B75E,0x1037BA36,0x1158BC8A,0x12847D15,0x10},{0x8BEE2C0,0x49D8CC3,0x1E93E3EA,0x45DE270,0x1D9E8C3,0xFC62912,0x18848F5F,0x4F5DAE1,0x10FD7BF3,0x8B3162A,0x19D1263C,0xFBEDEB9,0x892B468,0x19BEFE9,0x13}},
+    {{0x34FC300,0x1D5EB9A5,0x5D3998A,0x1D2B6A52,0xA5F35FD,0x1852ACEB,0x97B15D2,0x56E80E0,0x1F6141DF,0xA756D5B,0x74D84E3,0x69C34D5,0x1D5060D6,0x14A48175,0x8E},{0x2F11C30,0x1CE1108E,0x11283270,0x1B17E1F5,0xB768CC1,0x14CE8F3,0x1BF8B9B8,0x134AC95B,0x1CAEE0C7,0xDECE7BD,0xC6E58C1,0xC7F4530,0xB51C6E5,0x14F1589B,0x73},{0x192D5116,0x65577CF,0xDFB9684,0x1E5FC9F,0x1E150F73,0x1CB0E8E1,0x125B0898,0x1EC945AF,0x15C33C75,0x2168F04,0x17EF7AA0,0x169625BF,0x5B04FB7,0x1443C8ED,0x1B}},
+    {{0x16E96DA1,0x81FBD33,0xE729C0B,0x1F4A74BE,0x16AE4115,0x84B27F1,0x1C066643,0xABE11DF,0x1D6407EE,0x1F94A71F,0x1186E78B,0xF7CDA20,0xC5C58F2,0x91DC685,0x13},{0x1E88910A,0x129A29B9,0x10B13A9F,0x15B42A7B,0x1A4BF381,0x12740C45,0xBAD85E,0x55FDA7A,0x1DE1090A,0x18620C6C,0x9BC6D0E,0x6EAA8F8,0x8FFE653,0x1CD72877,0x50},{0x1D7D9370,0x1EA2158A,0x467D6BE,0x104FDDD,0x50EB55E,0xBA771F5,0x1B4A88B0,0x2E112AD,0x10B0C323,0x158A3C74,0x185F4922,0x1A531423,0x10A7EA5D,0x1956D037,0x5}},
+    {{0x1EB2832F,0x430AD8,0xF308B47,0x54F9894,0x146E58D7,0x3CEB5ED,0x1AB9F5D7,0x14D64A12,0x1A5B8F3,0x5751D00,0x579685B,0x533308C,0x1E057E66,0xBD80D61,0x26},{0xBB19A39,0x254D1D0,0x2E29817,0x9859A2D,0xE1599FB,0x17AF887E,0xE10311F,0x1C319651,0x32ECF37,0x1D01368C,0x4DD39F2,0xD147827,0xAA7AAE8,0xA8E489E,0x60},{0x899BE44,0x2C4D0DB,0x89CA551,0x6447BD2,0x99FCC99,0xA81FF8D,0xC2078AF,0x540F7BA,0x1C4A53CB,0x175886E,0xFD3BCEB,0x4AE8D33,0x35995B5,0x1DFB0781,0x2C}},
+    {{0xB749736,0x6158656,0x1CFD1843,0xA5B9808,0x8E8D850,0x143CEACE,0xB12D122,0x1C04BF4B,0x2D53D24,0x1FB4754A,0x5E834F3,0x4B8FF1F,0x6596013,0x1764E9F,0x26},{0x111BF6E7,0xE6A7AFF,0x185297DD,0xD912C5C,0x13020311,0x182DBFFE,0x1B791ABA,0x8D3AE87,0x9B3620F,0xB1AC96A,0xAECCFE7,0x94DD7C1,0x1E626E8C,0xFA5ABA8,0x8D},{0xFA65249,0x57B5251,0x9B18D26,0x1E895A04,0x86F00B2,0x1A2CA497,0x1EAB88C7,0x137962BC,0x176B6A56,0x6DCE678,0x6C11D33,0x12633A3B,0x11442106,0x1608FE8A,0xDA}},
+    {{0x1F3DD99,0x483EE1E,0x10C957CC,0x10853B94,0x23E8BD,0x4E3C41C,0xA410FEE,0x1A620C2,0x1F22F6B6,0x9C7700A,0x5577E01,0x146879C,0x1A3922CC,0x7EC066F,0x33},{0x67ADD09,0x10485544,0x1F629FF6,0x166ADE77,0xDA38EAA,0xE5F83E6,0x1C75DD46,0x138F0923,0x1D63CEFA,0x1BE2792B,0xC3DFE1F,0x10E823F2,0x1CD81EE1,0x8FD7BBF,0x6D},{0x58E8C57,0x118938F2,0x15F2284F,0x1F44D186,0x19A101EA,0x1B61BA54,0x1BF22197,0x1D9F7B30,0x149BA551,0x91513FA,0x1F264949,0x8EEF513,0x1FB20448,0xE641405,0x55}},
+    {{0x148C56B8,0x150B2871,0x13342E3B,0xA70DD47,0x1D2E007B,0xD9549AD,0x77015ED,0xBDFD25B,0x14679EC9,0x1835289B,0xFC642A7,0x15EFB5B1,0x1124CD0E,0x1B1E475,0x8C},{0xDFDDFD5,0x4689375,0x1B2FBB2E,0x4A153AE,0xDEC6E71,0x1B102799,0x47E5F0E,0x5E66C8C,0x61BC10F,0x12D599EA,0x1AD24ED8,0xF8FD902,0x15223871,0x218E112,0xBF},{0xE7BF89C,0x1E8FB963,0x81D782F,0x1BE24D5F,0x166A213F,0x663F1BD,0x12F339D9,0x13C3A0CD,0x9AC669,0x19AE51AD,0x15B0F0D0,0x179DF934,0x1F5AD940,0xD6AAD0F,0x60}},
+    {{0x11D1779E,0x1094905D,0xD43DB4,0x16DEB4B,0x19453DF8,0x1C0AA0CC,0x5B1D21F,0x899C625,0x8BD76C0,0xB4B0EF6,0x1E6DDEA,0x1F0C81D2,0x18FF2D9,0x1884A8D6,0x3A},{0x76A4719,0x775B109,0x10DA87D8,0x12E10E3E,0x7D4A931,0xDD7CF2C,0x8F4023B,0xCAA53D0,0x1E85C663,0x11D5093B,0x1DD40862,0xBF31DDB,0x1C6B5500,0x1ACF26F2,0x23},{0x1B2AD719,0x18897D05,0x10FAD727,0x1C6CFE34,0x1C1CCED5,0x117CD684,0x35DA463,0x42B76D8,0x3ABF3B1,0x17CAD019,0xCEC6863,0x3204EFA,0x2594059,0x6A6BE0,0xF0}},
+    {{0x17245523,0x130CE40A,0x93D3005,0xA7E0D66,0x38BA663,0x1A9B86DF,0x192F491D,0x1882061B,0x96F4ED3,0x19808FD8,0x105ABD79,0x873657D,0x3691506,0x4AD9FCD,0x21},{0x1CADCF49,0x15F28ADC,0x31CF3E1,0x146869BD,0x175C5CB9,0x19D0350E,0x116C71E1,0x51AD365,0x713D14A,0xA284A60,0xDA6D1F8,0xB7B98DC,0x1F2D8116,0x1FB7F454,0x31},{0x1F38E3EB,0xF8B0671,0x1EB77E0D,0x11A04807,0x1D20AAC0,0x1FD63574,0xDD7466E,0xFD4FA52,0x17093EFC,0x107EF6B3,0x1F34B843,0x173E7D70,0x1B2396BB,0x1C2EEED7,0xE3}},
+    {{0xB4C6A90,0x156DE1A7,0xD65B0DB,0x12497A50,0xE613DCB,0x15B40386,0x125E3F0F,0x1BB2C761,0xA4AF4D4,0x101DC8E8,0x1D99B4C2,0xC22B604,0x1825074F,0x1B748A8C,0x60},{0x19D44DD9,0x76EEEBF,0x1E05993F,0x1F40F3BD,0x6B0B835,0x19195451,0x9ED40D4,0x8E3577D,0x9E3B661,0xCE4F535,0x5C13239,0x86A5F1,0x1BACDFF0,0x1692AE1,0xD3},{0x7E1AEF4,0xE10F608,0x34930B4,0x1858F6C6,0xAC72D02,0x1180B09D,0x6510BE1,0x15123E61,0x11A2F944,0x12BF6814,0xFFBAD8C,0xEDCE4E9,0x1EF0080F,0xD88D243,0x66}},
+    {{0x1AF6CE4A,0x16A325AF,0x174C21CE,0xA46F50B,0xF885497,0x1A9E530D,0x6C88861,0x11B3F6F1,0x908EF52,0x188AEE87,0x1C6892B1,0x1475F469,0x1045F92,0x17CA62E3,0x2B},{0x18DEC603,0x1BE5B5E0,0x1F958FFF,0x1B2ED6DA,0x804CCB5,0x25BCF7D,0x5CCCE21,0x5545D93,0x3F81979,0x12DC2C8A,0x12EF3DA,0x1BD970C4,0x1F6465C6,0x9BA3233,0x7C},{0x1DFDB368,0x1AA3E6E2,0x4159D2F,0xA6958AC,0x3602A6F,0x10837B44,0x1CEDA905,0x1FAD7B32,0xFA8E679,0x1FA0ABA1,0x7E191F0,0x6456322,0x115F922,0x44D2E07,0x4B}},
+    {{0x14EDB225,0xA1FFE02,0x4FFBCDB,0x880EC0F,0x1A84F5B0,0x1C200B0C,0x1EE386D2,0x175224CF,0x1452A65E,0xD31903C,0x43A47B5,0x1FB91DF5,0x1A2B0FF2,0x156944E2,0x13},{0x9F8BA48,0xB1E6065,0x15F427E9,0x116B8A76,0x10198DA0,0x1C5915C0,0x2458A65,0x5FA9976,0x16F6C9D,0x1806FC0,0x10670677,0x1D51DD09,0x14885D42,0x1A811C72,0xAE},{0x14DF0FDE,0x299CFB,0x923EB85,0x7945F1D,0x1589B81,0x18A32A73,0xE571255,0x1FF6E16E,0x8839747,0x25B3C5C,0x3465332,0x3F6482B,0xC1A683E,0x10AE6F3A,0x80}},
+    {{0x1A12D9B2,0x1DC930C4,0x12BA63CE,0x77EAD97,0x1D263028,0x1A08A31,0x1F1D5A61,0x1D227160,0x68C163F,0xFFA703F,0x1A7C522A,0x1A84A630,0x3447A23,0x25239D,0xB0},{0x1313D776,0x94DE6EB,0xB4B6DA9,0x141B8ED8,0x42FC95D,0x1E26F95B,0x5BCA22C,0x178A05C5,0xFB9C7EF,0x128F02C6,0x5850758,0x103B908D,0x176D4799,0x1151CB8F,0x2D},{0xFDFA4B1,0x9A7CC5,0x193908E6,0x1B1EA280,0x2ED7320,0x5ED6EFC,0x4588B55,0x1EBAB943,0x1141E293,0x19AB74C9,0x6E6ECB4,0x1E662527,0x1FAAE0CE,0x1A22880E,0x62}},
+    {{0x7EE9950,0x1FAA8883,0x1A1B9FA,0x10A40792,0x1CD245DE,0x142A425F,0x19D76702,0x39C103D,0x1A9A7A7D,0x19F4DDCB,0x9E475C7,0xAF9C06B,0xA49BBB,0x733A2B1,0x7C},{0x700274,0xDD319F7,0xB69E8A3,0x14B3C3DF,0x3DA1865,0x1B12E8CF,0x11913D21,0x1434E47D,0x140EA1D0,0x1BB2936E,0x5D6F340,0xA9E724E,0x6EFD77E,0x1D156C58,0x19},{0x130FF776,0x14779FF7,0x1F88DE72,0xFE7A82A,0x19C69B36,0x1652C3D9,0x6A7C3A5,0x45558F0,0x13F893FF,0xCCAE1E1,0x14A7CC44,0x13F2F402,0x1A292CFB,0xBBF3C64,0x62}},
+    {{0x1B107554,0x1160A2B4,0x253D908,0x1E568A35,0x1F95492E,0xA78F280,0x1296A5E1,0xC92FAD2,0xD34964B,0x10DDC3C1,0x187D480F,0x1FD79C3E,0x1C1A0E9,0x4F375A1,0xE3},{0x17292852,0xA3D0CCB,0x22FD437,0x11E52EB0,0xBFCFCF7,0x19BCCD9C,0x2517AB8,0x1F1FDEAB,0x5946104,0x1E474D6F,0x33A751F,0x1969AF51,0x1C077B54,0x11FF763C,0x51},{0x18F2A4D3,0x1B305A7C,0x149490B9,0x159027B2,0xF1B817F,0xCFAAC3E,0x1963DAE5,0xA526E9B,0xC7274B3,0x15C27F9D,0x17160E54,0x643AA9C,0x130FDA73,0x1CECC157,0x89}},
+    {{0x9C0E511,0x596FFD7,0xE1C0CA9,0x1789E50C,0x190A9FFF,0x21B24AD,0x674D71C,0x1427F59F,0xD34171F,0x1B60676A,0xBDA7F9A,0x172CF25B,0x1ED4ECA9,0x11804401,0xAF},{0x18970666,0x14721D5B,0x1FF1890A,0x1066AE5F,0x10932A0D,0xD90D939,0xCC42838,0x17E31FE6,0x137949B3,0x10C016A6,0x16E22B03,0x13328644,0x1EE09798,0x1F88F0AD,0xC0},{0x1D5570F7,0x13BFBACA,0x19B07209,0x1357318C,0x643BF52,0xC04560B,0x19F17E42,0x600AD10,0xC633350,0x45E0B24,0x1F51290B,0x1AABDC31,0x34DD7EB,0x1227EEA3,0x38}},
+    {{0x12960E13,0x4019D26,0x10B27A3A,0x19544EB4,0x14335717,0x122F1582,0x82D4563,0x1789FB03,0xA225DD7,0x1E6BF3C0,0x16D2AF71,0x192520B8,0x17223BB9,0xE3E9E53,0xF6},{0x15575537,0x41F01E6,0xE72037D,0xFC5AC0A,0xBE86EC,0xB3D1BB5,0x9C44F4C,0x18AC1FD2,0x4CEE6C0,0x90E2100,0x14302F46,0x11AB259,0xC198278,0x18AC0B05,0x3A},{0xA5222C5,0x1D2AC6A4,0x1F1FF84E,0x113E7006,0x1A41601B,0x16841965,0x5D296EF,0x9642663,0xFA656F9,0x1A269D6D,0x235C787,0x158DD915,0x1321CA4D,0xE6F98E5,0xAC}},
+    {{0x15DD603C,0xC2C1459,0xF62CEB4,0x5D61D8,0x19B114E9,0x1209A62E,0xD84D0E9,0xAE33A6F,0x867543B,0x1FAB63E2,0x15489C46,0x4340C0B,0x22F0CDA,0x1813C709,0xB3},{0x40269A8,0x17CD9AFD,0x17931273,0x1787C771,0x4886763,0x103592FD,0xFBD2D43,0xA65AE32,0x1EEC66A8,0x8CFE00C,0x1A1E407B,0xCDDE306,0x1E27EDFE,0xC49A479,0xB4},{0x1A0E1676,0x1051DCF0,0x1084BE61,0x1F3A48AA,0x1ED5EA55,0xAC7AB62,0x6BCFD72,0x209A747,0x17BBA34A,0x58841D0,0x12B63538,0x1E59532D,0x1EDA496F,0x10928836,0x6B}},
+    {{0x11EFC201,0x63A604B,0xBEBF9A8,0x1ACB308,0x8E14953,0xF8B9E9E,0x158931B8,0x180F705A,0x1922D70D,0x185DF0C5,0x5A8FD9F,0x11C28801,0x1790BE0B,0xFF4F774,0x5B},{0x7D4A5EC,0x101CC008,0x1121744D,0x1ED3F01D,0x247349C,0x12EB357B,0x95426D5,0x1984AAEB,0x6E54A16,0xDE011CA,0xBCB425,0xA20D665,0xF31DAD4,0x131D93F5,0x45},{0x688ABBF,0xFEC30B7,0x1773FCBD,0xA039533,0xCE1BD0F,0x1ED47A7C,0x11676671,0x183E624E,0xBC5F3CC,0x1875BDE,0x1AEFE15,0x173B6BA1,0x80107DA,0x4CEE011,0xB3}},
+    {{0x160AB897,0xF2202FB,0x8B6E282,0x1F9C64DB,0x161D9DC,0xDC0FBC7,0x14107790,0x1BE3B36A,0x1E534D41,0x11C55DDF,0xC8AC2CF,0x15511C07,0xE0900FD,0xC845798,0x3E},{0x1CEB754B,0xC97FD0F,0x103CDD00,0x9310BD0,0x8D07FF3,0xC4100C,0x133B7B6E,0xDBC44DB,0x17B484AC,0x1C7CAF07,0x7983EF2,0x2493F9,0x22CEA5A,0x1139D8A0,0xD7},{0x20599DB,0x1C11B523,0xA6A9E3B,0xB0CD0F5,0x1451DC00,0x18DC905A,0x12E9D62A,0x1948AAEE,0x177D40E,0x99EA27B,0x3DDF34,0xB68D136,0x186D55A2,0x1CF45327,0x48}}
+};
+/* End of comb table */
 #endif
 
 #if CHUNK==64
@@ -50,5 +159,114 @@ const BIG_416_60 CURVE_B_C41417= {0xE21L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L};
 const BIG_416_60 CURVE_Order_C41417= {0xB0E71A5E106AF79L,0x1C0338AD63CF181L,0x414CF706022B36FL,0xFFFFFFFFEB3CC92L,0xFFFFFFFFFFFFFFFL,0xFFFFFFFFFFFFFFFL,0x7FFFFFFFFFFFFL};
 const BIG_416_60 CURVE_Gx_C41417= {0x4FD3812F3CBC595L,0x1A73FAA8537C64CL,0x4AB4D6D6BA11130L,0x3EC7F57FF35498AL,0xE5FCD46369F44C0L,0x300218C0631C326L,0x1A334905141443L};
 const BIG_416_60 CURVE_Gy_C41417= {0x22L,0x0L,0x0L,0x0L,0x0L,0x0L,0x0L};
+/* Fixed base comb table for ECP_genmul - generated by scripts/combtable.py */
+const BIG_416_60 CURVE_Comb_C41417[104][3]=
+{
+    {{0x4FD3812F3CBC595,0x1A73FAA8537C64C,0x4AB4D6D6BA11130,0x3EC7F57FF35498A,0xE5FCD46369F44C0,0x300218C0631C326,0x1A334905141443},{0x22,0x0,0x0,0x0,0x0,0x0,0x0},{0x9A1728461103EA7,0x83674A5B1685622,0xEC048884B644863,0x568E9AFE513C45D,0x8B9435341272188,0x6047498D29BEB2A,0x3ACFB2ACAAB0EC}},
+    {{0x3CD0BB003A5982B,0x43C47E952689EE1,0xBE5CFEC9CC4F8D7,0x91F4143DAFCA8A1,0xAEBAA3FE6980EC4,0xC1D13DD776F230A,0x30F39EEA21BE42},{0x1B3AACD8BC13345,0x92583D79F0D0BCE,0xF488B9DFF78A4FB,0xB18DDA9BFB3085E,0xA39356C4E2FB273,0xA80DD3F9EECFC54,0x2A14DC449EE359},{0xD4F0955294314BC,0x2069FB8037DE1DA,0xA4F3E420D21979D,0xA1763669C2F2F06,0xAA140A2EA3844DF,0xEA0CF3728067A3E,0xF2D90B1CFB2F4}},
+    {{0x846461CC78B5A55,0xEFC793E289C1C8,0xA4AEC0069B43554,0x6FCF52E27164BE7,0xE123EE04155AF3F,0xD1EDBB9C0ACBD0E,0x3B4D7B22046023},{0xBE44B51319047FB,0x3D8907F1819A961,0xE409C71344C580,0x5F46361842124A5,0x53190ECC7369BD5,0x8F12DEE2D1186F1,0x5FA78894358DA},{0x1996294F3B17788,0xB0DB5270F672F08,0x530A5F91E0A6377,0xF95FEC7975288DD,0xD28C30E75FD487E,0xA559B8716383C51,0x2009DD9EEF51BA}},
+    {{0xFCBE09172D79E35,0x2570B68A9EB662,0xE0762089D6B76A9,0x73C54A490AC304C,0x39EA4C5357CE49D,0x445AB7F806BE793,0x28CE3371978912},{0x7519469BC0A3223,0x83FC19DDC3D68C0,0x3E7A264CFBA553E,0xB953C9DA4E4F0FD,0x25A5BD4B68DC7CE,0xA2A9795EC5E8E73,0x39C0B50AF26B67},{0x84D8258D190CCD1,0xE517FBDC3275AB4,0xE2D74C909F20C97,0xA722622D677F443,0x2CF4A70BA9E1760,0xDAADF62B73A905,0x3F5EEF667162E6}},
+    {{0x1486372EFBEEA05,0x24591D1C93437C1,0x29BB32AB5D86D2E,0x2B1E7D3721A12BB,0x52C672526965628,0xFAECF7E7CF4395E,0x1102831F41FAB8},{0x1CE32B2FBE32489,0x8E2ED3D0663F335,0x9E3BBCF2556CA01,0x3445F9C30A3727B,0xF59E9AC85BC4D6D,0xF0BA427207F28EE,0x10EC8AF33E8267},{0x2A1644369E05FB2,0x14DF48F9915A252,0x66A545068539016,0xB3394C4FFCBC44B,0xD03D71C1F492D05,0x567CB15E0D86B08,0x1D9EAFF4045734}},
+    {{0xD078184FBB747C2,0x9D674E7A941A3ED,0x9DA72A22BDD7C8C,0x3CFBC8BFB32A551,0xBE7CFC28021F280,0x1283C898AF0B74E,0xE9234799F962C},{0x2383FCB2AB95E58,0x85C232CB1EDE106,0x6B1D8348C72AF8E,0x318C5A4D2B90295,0x83E4AE754B95D41,0xF71F9485782DD2B,0x12B8688F9A828F},{0x39AF587FD0CC6AC,0x53F37BF51F922AD,0xB46F386EB76A505,0xAB363C997B01A23,0x97DDACC77CBC6D1,0xBADB60DBE37F78E,0x12DE29ADEE8A5}},
+    {{0xC9B208F0A908594,0xF7B958FF6539F58,0x1652F455C6B7101,0xC922ED61FDCEB5C,0x944877FE2BD21B8,0xEA90151A91060A,0x3ABF7F8D32646D},{0x22A0846B33CBD5E,0xD8BC86A534547F9,0xA5CC4C5A8FE122,0x50E11E7373DE535,0xEDBB95E27F5BE34,0xDA984526586B3CB,0x3B4C030644A67},{0x9733F8FF8E56CD8,0xCA5BE4BA7FE1B51,0x9C306C265778AA4,0xFFEAC0EDA2A65FA,0xAFF08357560C485,0x26BCC2DD220B701,0x356EBD15E8AAF8}},
+    {{0x8B4D1C26C1A8D3,0xBA8A8FC74AEC83F,0xFBEBF97D188CFEB,0x13D2FDD7A825D66,0x328C703DDFD27,0x208E66C75ECE8E8,0x18CB1739CA993},{0x6FC22905A6982EF,0x9728C6A907B0BA2,0x414A7009D33475A,0x9A4E6158F065973,0x475DF319D25AE9B,0x41A8037B450E410,0x13E97E39FF7FE3},{0xE247B368022F710,0xFAFD46689E092CF,0x647138A685E0B20,0xFF0F7B6608DDEE,0xA8153F3488DA07B,0x29882102E554E7D,0x20092F480C68AD}},
+    {{0x3DF01543C9AAC9,0xE80960B8C635F6D,0x402A302A7EA57BD,0x2D9C1FD2BE96E8D,0x42C153AD660692,0xEA134FE39F13F25,0x23CF95A1C4C210},{0x308CCD6A16B1904,0xF6C4A7F6F7DC5AC,0x3F0840126DA1CE4,0x3059FDE93F7C76E,0x8DF830696C5C00,0x123D8CE35E244C5,0x10D1F490149E94},{0x429C97C0BD0ECAC,0x9FB332482C54989,0x14C15C250CBF11C,0xC1879E3FBD24D45,0xC71D3CD4EE89732,0xA7AE12C26C6A468,0x3DE0F630D817A4}},
+    {{0xDC659606E9C45C0,0xDD333E67208A62F,0xD895E66D405A6B4,0x12FC6DD24BEF980,0xEDDD39A629442A1,0x7998C2798E1994B,0x3B306F162A9EAA},{0x1361823857D7C87,0x8C26F51ECBC96D5,0x4509B3B80B19924,0xCA33D65100ADA5,0x2B4BFD25244B219,0xE4D2E1FB990703A,0x21B61AF6750830},{0x78DB54EE448FF6E,0x1092E9A8C73341F,0xF7A8DF5101907CF,0xD3A56262E6F9B8,0xEFF2360D230A0EB,0x1C65F802A2B3A00,0x36401D777C03C8}},
+    {{0xF13A8A8EBBA3509,0xE8F25DCF222183C,0xF96623A1E05E5B9,0x75D9C9AE7CA5C0C,0xF1AF3B0FD47D0F4,0x72F8AEB4B26575B,0x1013A80FA3BD36},{0xA9D22F68EA3335F,0xB6898A09CA49E3F,0xF76903FEAECFB7D,0x8ABD7318348F5F,0xA2A2E608D6AB64C,0xAB07EF767D39E92,0xD143964F5791E},{0x6FE9E286335D647,0xD31043B0813C3A3,0xC17020557353F27,0xB6265D384C67FFE,0x805B27E1061F47F,0x4A07E056AF24444,0x30DC2903A2795E}},
+    {{0x9BCEEF805D31A3D,0x8A75EA556C13FF3,0xDEA1DF1BF1030B5,0x507EFD7AE01E955,0x8CA04EEBF739DD7,0xECA6A81DD7946E1,0x2C58EC369EECAE},{0x1F5A30D02C8BEF6,0x7AD34600FDE9895,0x1913B812D3DD949,0x493CB984073804C,0x12C8F0E61FF07FD,0xDD6F82C9AD613BC,0x27E6BF220C64E8},{0x316A916CA9C28FD,0x50AA8B7F2614F53,0x505351377A52B2C,0x7CD956986D47392,0x38CF7EF67C20EF0,0x7DBD2AC135A4B9E,0x9656157C0404D}},
+    {{0x933D2A3D6AEEB90,0x76C46E52A2871D9,0xA64C6B745159418,0x55C361BB131C2D3,0xC9ED45E543C50BA,0x5031E1413C470A0,0x1DAD7C5830F3CE},{0x194A604A990668F,0x887A8D186C83A7C,0x3D5644F5A63B692,0x818A628E1406EEC,0x855FEBE6DC74E15,0x8C0CF967DC661DD,0x3239AC2C61615},{0xCA051F501EF51DC,0xB6E8ADB977506D0,0xF858C3B27D1D897,0x80A13B27C105D96,0xEAABF5246881189,0xF5241AAC7A7D86B,0x2050D7F5223148}},
+    {{0x3B3575F3FF958F4,0xA6664C27429EA61,0x1B78CB25480075C,0x8038770CB5AC9A8,0x22FB85C215B34A4,0x1FD9A54C67544BC,0xB217C19C8635F},{0xEFD5D797CF5392A,0x232CE1F9B10A916,0x5D2CE9DA320A1D2,0x1D210D8C9D9F660,0x68E27EBD089EC27,0xF7D86A8BEBCDBAC,0x3D247541DB230A},{0xCC227F8A7D81B6C,0x5926AE69BE25BC9,0x8BC3BB54D4FE8FC,0x4C83CF86D085F30,0xB9893A93E73983E,0x7BFAE720D327194,0x27D7EF7A58DA7B}},
+    {{0x5911DADA485DF9,0xEC5431BFD7C83D7,0xBF93DA09EE339BB,0x3155B178C70CE67,0x2534F571E21A67F,0xF70EB27E1BC24D5,0x3E39EACA8988A8},{0x71CB3570AFE200B,0xC34E8AC208A71D5,0xDF55E661C312924,0x49C32129AC55E4D,0xAB92D734FC66ED4,0x30C70AB5ED75712,0xC41E71DEEB34C},{0x870997D87BAFC77,0xAAAB4B8332CA2CF,0x9D704FA59B751FB,0xB5A78182AE733C5,0xE90EFC031577EF7,0xF4F829BCF5BDC9C,0x1DAF4DCC183C4A}},
+    {{0x8AD14E6E25DC537,0x89F900056E76AF8,0x5E3E98CE75DC92C,0x5141BD6C2D19CAB,0xE0BE475BD2F2545,0x723255DBE953990,0x276ED98BA2D7A3},{0xC1A8B5C7857A3EA,0xD03CA202B692E56,0xD193B998972773B,0x4A304539258C987,0xDAFB3BDEB51BA,0x4D766447B639F8B,0x1C3C992688BE52},{0x183EB82C0B58DD6,0x8EF6D995F25BCCF,0x6B505DB4D4E89CB,0x3930796DFF1C9CB,0x5D327B977D04B53,0x123752BE14C9B8B,0x42EDE72F960A2}},
+    {{0x1471725B305F713,0x8529B7B52569783,0x4C969FD67BE1B8B,0x65F7D3D5D4E0CAA,0xF032C5122AFCD00,0x70E03C3CFFC196D,0x13F73D09CD060B},{0x4FF89ED4FC36443,0xF78810AB3635C9B,0xE18BA5844FFC5D5,0x6B68EB79B6C55E4,0xAE389BD8BE2B014,0x4E75223A60CE66B,0x1C7E4C4233C047},{0xE7D3ABDF77C4FD1,0xA7E90C8B3672FEE,0x1133DE7860B92DF,0x423307AF5755B59,0x10A1E61A6183507,0xE2240CE9089DC69,0xB272A61C5A279}},
+    {{0x3C5C10718710F0E,0xDE2064EB624A2D7,0x4FC7789F9584BBC,0xCE24A590F58D160,0xF733DC5D2A04191,0x7847E43ACDD36A8,0x32B3949B7A280F},{0x2667AD30DB93D1C,0x18863512EC618AC,0x98B1D345C2F03D4,0x9D2365E3BE8549A,0xF4D4E6C2FA842B3,0xAB2893E17C22DE5,0x31831CBBF2AEEF},{0x6F135B99B18D881,0xC839B538F4DF80C,0xC3612F8C9704BA5,0x86B28185EA135F4,0x1B761CCF104DA76,0x9925FE701FE478B,0x3195D81CACD2B2}},
+    {{0xD1BEBAFB202F3E0,0xCDA86A712662FF3,0x46EB7ACAB639E76,0x880D70E857D8D24,0x1B8867334080CCD,0xA8F83EFC50F24CD,0x20A1D84B07C372},{0x4007E447F80AE65,0xF0B82DE0816FE61,0x36628E2F88054C0,0xE3B3D2E687E1A6,0xE0217875FF84D00,0xA94FE84DD08A5DC,0xDCCCC0F6F1FF9},{0x2AB7DA42C32F9A,0xE3C70C4236BAFC2,0x962994997C5CB7F,0xBF4D148B6A5FDBC,0x717ED2049FA28EB,0xF030249409F0B13,0x108AA73394B3D9}},
+    {{0x275CFBD44695A48,0xBEFBF6FBB06A60,0x32DEACF69E5BF72,0x22436D14EA7B0A0,0x37F19C0B4E1365D,0x59E036B5DE48547,0x25447F53EE49C7},{0xBF5ED9C16F4ED1,0xD874D70ED94F911,0x96DC2924C874262,0xC396B9270F32713,0xBDD2EF406F009FF,0x2B13D7905717C4E,0x1C3579E525114},{0x248115E9B8493E1,0x3EC946300712F25,0xE3686E537F79A7D,0x30685FCD24DD14F,0x60B2253588AF15D,0xB2B0BFB317566AA,0xAD6F3DCEFB80E}},
+    {{0xF95DE913653B39B,0x543437F0BA7A7F9,0xA45BEF4F40ED90E,0xBE8285D12F1ED56,0xBC200A9983CF2B4,0x5E59B58F99B6E6A,0x2BE2F8E03CB430},{0xC238DE7F66DCCA6,0xC1C1A21AA6F2123,0x44D29FDBB1F8165,0x3C2A1625BC20DA2,0xE3B415DCB55272F,0xBDCBF25CE74FF47,0x570D138EEE7DA},{0xA7BE485BABA30B0,0x6CF7B6118162343,0x5C00ED4394150C,0x70FDA439FCD2A3E,0x466E8722EE96445,0x8E17BB0C91B673F,0x33236B76028ED4}},
+    {{0xBD8C41FB069E96A,0xC967DB6F2797975,0xB8CB527D2ACA818,0xBFB3CE678CFCF16,0x5394F9EFFB1EB92,0x9A288AA93F04D49,0x235108AA263B54},{0x9CAC740BA88C1FA,0x4A0B49D34BD8A6,0xFD85AECC5F88F90,0xC07C9ADE2B69925,0xB535BA5E7979D71,0xDDF89A40C10392D,0x12BC2F414F41EC},{0x18BA319EBF898C4,0x24192A7F65CC45B,0xE61E9BAEF6673CE,0xD3676A58D738E7F,0x6BD6241A0D23C9D,0xC991267C7593646,0x380E7418FED8F4}},
+    {{0x6C2799E1B0CCD9F,0x8BFE8E5F9F6B7B0,0x40671D7039819EE,0xAA9A7BF49E06CF4,0x91461C1810FC38E,0xB5E44427880EB8C,0x34880754634DC6},{0x8FC271C130BDB6E,0x3DC4368F94520DA,0x52074696B9B6F2E,0xA6C213C8D82A182,0xBBFB0D6E4B4C0A6,0xE814391B368764B,0xCAD41A110E443},{0x95712334CE515D5,0x27D131D5E870EC6,0x1F9CE88D4D50991,0x43D177C06DDD594,0xF80239BBB5D9B41,0x5128AB5AFD26131,0x159B0D58F247EC}},
+    {{0xCA254D897BB9126,0x57AC3301F9951D,0x4D482E99C7910FE,0xBFBF39E697C1159,0x1F4630BD6C996FE,0xBA4082FB95B3B68,0x3E1FDAE3A438A2},{0x44EEFAC3F2E603,0xF2BC93EBDA15D8B,0x49DCE4B72861A51,0xC142809B7BCFA7B,0xD53C6740404BAA0,0xDA467DBEFCE3306,0xE389674937459},{0x33ADAD62CE028A0,0x87011A4449E4577,0x8B0C7E329FEB569,0x7D2E01F1A42FA7,0xC128D091AE7F5FE,0x8BD55F191D3C840,0x32A3EEEEE885FF}},
+    {{0xEDFE41A805F5D2D,0xDEDC5B6BF9621C7,0xA933F13C8CB7961,0x99F5B98EACE7073,0x5E34DB42F08C48,0x7E457B37A135AF8,0xA69CE504FE732},{0xC70B964C943ECD4,0x5A1497E6E1E1FF6,0xB31FD03C99B22F7,0xCC5E298675AD92A,0x6AEFF061DC5F467,0x196CCDABDE50A5D,0x2E1CB805BC6C7F},{0xA75907CDA6C3C1F,0x3461F015DFA35B3,0xA5214210DB74DF0,0xB646AFF8621EA40,0xEE0BF7C2B77C3E,0xD2FAC69E47AF9CB,0x1243B2DE952204}},
+    {{0x6DF30BB830B6D17,0x9A8FC824560DAA0,0x9E79D41D61F664F,0x763269C289CE8CE,0xD19C2BE58AFF9EE,0x72F9CE365F6B76E,0x3C7353EA2E4C9D},{0xCB7D09057C7716,0x85B6C700FDFE45,0x2995CDCA9E99AB3,0xCC8E4D3F46C1ABA,0xBA9B71120ABF601,0x141D1E652ED58B1,0x3EA6749940F340},{0x82F45B550DABB03,0xBA866FD2571B1B7,0x54011DBE4D1F566,0xDB75F573316221D,0x34EDB1091D42BD6,0x1102F89856D73B8,0x26C6BBC1B8A7E5}},
+    {{0x401EE23505BE5C1,0x323EBF235E6F0BC,0x26FA6A96A67B338,0xEF27D6C1E0A98B2,0x752C50754EDE4E4,0x6A88B9BEF91C7FD,0x3E85D283276C98},{0x8AAF741C9CD9EA8,0x2402B9503129612,0xDCD300834926D5C,0xCF7F78A0E0DF9F5,0xE1D6EFC2A61404F,0x449C306DD7E2D2F,0xF270F423DD68A},{0xDAD9113B6A9BCAA,0x8F627D1A64113FC,0x49936068009E865,0xBE605CD0492DE7A,0xFA6339EA99EA902,0xB58C244BB8ED8FA,0x2B8410DCB78789}},
+    {{0x2B5ACCB0275C817,0x68A2C4EFCD8B432,0x9B55136FABAA7D3,0xB2E2716D70807EC,0xB55E014254FD15C,0xF6ECBBF0CF8415B,0x3748C293D2D726},{0xFB69CEBFD8A4FFD,0xB5FC009796F980F,0x27530C986AD53E1,0x35C6E323C048626,0xDCB178FCB3CF0D2,0xCD700B25DE8698D,0xCBA0F622BC22F},{0x90B84A835749F49,0x4FDA7DC12F662F2,0x6488C6147D86DB7,0x69FFA75FCCE0FF,0xAC716A9060D482E,0xC4DE1B3F9F55D67,0x1D2B7E97F1934F}},
+    {{0x5F6EB53CD73E871,0x74056A6BD3153ED,0x2FD1F781C1157A2,0x6E40E34D06FC1B0,0x6F08146A3F532BC,0xFB5465B6C818F4B,0xA486AFFC0A415},{0xE43799146E8F3D3,0xA571E87E187B68B,0x7100FCC96D4BCC1,0xFDB33E4B8B996C9,0x3483ABF92A640BA,0xB89329D307FC847,0x3116ED58AD9F33},{0x636034FD9E26598,0xE7399ACD080CD84,0xCCA862FE6300448,0xF08D68D0557CA82,0x403A2D56A4AEE84,0xEF4585F499F4B70,0x317DC25A004991}},
+    {{0xD046BEAF5FA52B6,0x66B99CF33C3E579,0x8388995CDD324A1,0xBCAF121A415DFC6,0xA5354BB51788319,0xFDC30958F43F9A0,0x2DA789908FB9E0},{0x388EDC05561A0E8,0x79A22FA93A8C49D,0x2EC002793257156,0xE431666905A1446,0xC6A8589E37EB49F,0x8E2B53D16B497AF,0x3BA48523C0D6E5},{0x871252ED965A339,0x7B6CEB8797FA833,0x3A4835EB8A1967B,0x2E460653D3F7AD6,0x29C85DA8D93DF4E,0x380788BFD634DC2,0x478AD6E173C95}},
+    {{0x6A350E08D7DD4CA,0x3B4B0DF4425D1DC,0x46CC849915CF58,0xB2CDCBD0C5A63AF,0xF4E24AFADFA8BED,0x367E567B72C450B,0x36ACEA5A1A5CB8},{0x3B3B6E94D211F39,0x15BDE5ABA92633D,0x592C73130E89064,0x5D1792FD8BD928F,0xA3AAFFE6FFC88A,0x78509CA2493A58B,0xD1D31FD63E1F3},{0xA8483DE12884E26,0x177C602029996A8,0xE1F1A4137EEFC2D,0x85EDE5FDC9E0F99,0xEBE11E8AB44540,0xF46D910B6C7A622,0x3162CCBB489BDD}},
+    {{0xF59AF8BAAC12F77,0x20640F293CF0C2D,0xFFE8E8EA1D52E74,0xB313033E38291BD,0x2D00AEB8BEEEDC4,0x69944F02ACBE798,0x3BA0C7EF51B64E},{0x60DE417A7981B81,0x84626DD5A20BD9F,0x79FB7898E260D10,0xBA2F5890CE24CA0,0xEF484B97D9372FD,0xCF512DF45E7DC66,0x5CB4BDB1EA435},{0x898E2D3F195FCC4,0x9628A043EAD4BBD,0xE30D559121AF3FF,0x99FEDE7451BA6B0,0x35383C0CF7D41BC,0x84E3AC958712CB,0xC6A93721BB937}},
+    {{0xBF6DA17FB74005,0x2E6DE2CAA866942,0x126AC7F0B970FCA,0xEF58304E62C6A77,0xEB88F70B52346BC,0x6EC49385E8878F8,0x2B76977EDC26B0},{0xBD671334979677D,0xF748191037CB408,0xB2DC913E1B4F2F6,0x8D4E1A10A756D0C,0xC2D592F8BD308F4,0x214DC594FCA3874,0x29B495902DE57E},{0x9E2F937DF5C9C28,0x2C39B7C19EAA5C8,0x2FA7D213BBE1484,0xEE180D99DBCB229,0x75EED180C62B4FD,0x3613FEE0CBA320,0x202A8AF9220EC7}},
+    {{0xE0DD995641844B9,0x1E6E5632B4DCC51,0x3B6BF7EDD76B09D,0x60D6ABF666DFF81,0x2972B6B93B5781F,0x47F1F469B03357A,0xFA83184CADF37},{0x90508A6EEA0FC98,0x933A5F66A3D3144,0x9EC876537307013,0x64CC7833A3D6856,0x4E6ACFF65498775,0xE8D3078AD0E6E22,0x103A7E1F19669C},{0x65F79158BBB7CE4,0xEDF88695430675A,0xE5D3D17D283085,0xAC2C8A7C4FDBE4A,0x7A96CD6677DC04E,0xE4103A65743D9CE,0x1B462694FF4674}},
+    {{0x952B2C49CE6B3CA,0xC2C37F91D8D4ECB,0x5BABD40582230D,0xFB64FC981456E1D,0x1B3F1B7DB5F1446,0xB165E595B3D7FFD,0x2C51777FE374AF},{0x159BDCA48BF9AAA,0x56853FE4B8D050A,0x6F187631DDA98BA,0x7840B9C51B8C991,0x27BFF672973E43C,0xF315F39C8B26A7C,0x1C328712E76075},{0x5C4F975787339B,0xF92D752327C149A,0xAADE0C4C1E80346,0xE06E6D876A5EB34,0xEF23B3AD0A11CDE,0x4B7AA6F541F6B9F,0x35CD8B2489E8EE}},
+    {{0xF0B716F15E64FE7,0x28E006B30F368D0,0x628EA5109E01C45,0xDC130527525BEAD,0xB9E36A6421995F,0xE9B735C1EA296DB,0x2B6FD2E8081D11},{0xB4ABFA8B9FE7430,0xACF922897F5976C,0x50D847C2A5286F1,0xE1B95AD74BDA3EA,0x411A15B90D9DCC6,0xC37323E741CA9A7,0x1810F36AE6A29A},{0xA054F2B5127A026,0x53554074944FC23,0x28501578EB8FBB9,0x54B0EB12FDFC486,0xC85B80B9F749D58,0x35329770BC295B3,0x2169FC112688A1}},
+    {{0x552B13A845C0B2E,0x3595E49131086F,0x13770875C6F67FE,0x2FCBCA23D9DDA48,0x2207357E12D408E,0xBF09EEE03E953E7,0x3B48A1A970FF94},{0xB2CBFDDE052DB1D,0x9383337893E732B,0xD14EBD36C19060E,0x14669AA0FFB8A8F,0x16F769A905B9C1,0x101D3C25AC1B170,0x3585930A8098F1},{0x2D52342B523E8A5,0xFF6E08375EAC4BA,0xE66D24B9015BB8E,0x5DA0CA30632539F,0xE2BFED65422E1F1,0xF6504F737E35FAF,0x144D4291DAF415}},
+    {{0x338550B906083DE,0xFC7F1D69FBEAD78,0x960772F4133B138,0xC3AA1272F99D6B2,0x31CE00B97A7DCE1,0xB906CF9D64423F8,0x2111AA5D19E3BA},{0x2B0F67C9446305D,0xD16856F6EF7596D,0xB699870D665CBB1,0x59BA0864D2CF543,0xD9CA167C65FC9F,0x417D4BCEC960F12,0x2D89DC0A3FCAB6},{0x566CDC1A567C4E5,0xE00A2F8DE860D91,0x2E0A032475CB815,0x39ECE6CCD782C9B,0xD5130199D3FACBA,0x5F7BB0F536C736E,0xE1A423D255D46}},
+    {{0xEA739417DF7AE44,0xD3DDF3DCA45A074,0x9BB55EC87EA1B07,0x3F782D7CF687039,0xB619CA422A52A22,0xD09A92A592A1B8E,0x360F14DB7B451B},{0x9FE666490B67B83,0x65E686CCE9E0BEA,0x572571D8CD62C68,0x3CB71C4AA8230CF,0x5BBCE87BB19634F,0x9B0ADC1EFFE3FF1,0x3A6A47A33087A9},{0xFA2D8921770630E,0xC418950952457A6,0x10BDB1CB8935448,0x1CE80E461B3203F,0xFB2970C9B760AB7,0xED35FC319E644F1,0x243CAFDC9E0EDD}},
+    {{0x1550658479F2581,0x4D95C3D5B87A4B0,0x541D7CD1D8BB98D,0x1E4B9AA4B7E9DEA,0xABD1B2D07814295,0xF47864BEE5F3C4A,0x2BBE426634D4C4},{0xC7E49250355ABDF,0xADD822F52103147,0x9614A43ADE3CE45,0xCCC8D3975F22A4E,0x9824C9D47D2B91C,0x39BC6D4741F1D0,0x2E4091B889B07D},{0x745B0836E044C61,0x75B0258896D1FE,0x5EC8CA4D793F91C,0x5D3A70AB3BB15C7,0x99A222D22671718,0x191B9938B2259EB,0x16378B98C4C23E}},
+    {{0x990CCDF244F9F5D,0x8D43403499D52F3,0x9B805B7C270D114,0xC5D18CBB1142A95,0x7A4509C1504A60E,0x63AC714839243ED,0x255BA10E7BA187},{0xF54FAF18DDB0C01,0xD39C500C7381EE6,0x6B86D7BA6240F57,0x18BDD1561DCC6D4,0x3D1E3074410B5E4,0xC7D4C4344321508,0x3679912CDA491A},{0x6AE10842410A682,0xB14871A744446FB,0xF5F82A323BEFB2F,0x9FEE1677AF642D1,0x173D51D709A92E2,0x4C646B80B730E36,0x254CE74DDB1CED}},
+    {{0xF51CCBD022859CA,0xAA1FB8942B2AB18,0x4DA3FA4C488BBDD,0x22D7B77F7AD87FF,0xCE7A625C0E3085D,0x80E371032CCB57D,0xEB38C01C7C26C},{0xFD43747C045A11A,0x4C922E93350961A,0x51BE8560411A5A2,0x2FC9CA4F8D0B502,0x4F9DE141162A25E,0xAF89E91BEE7F8DC,0x3C04C8B5253FCD},{0x2CFF9E54073AFA0,0x933B656364CACD5,0x3E57155860BB65D,0x255140D5CA542AF,0xBE36B87F2BCD6D,0x17F3C701BBF42AC,0xEA40C13586658}},
+    {{0x2993DBBF5371FBA,0x7B36568C7FFD32F,0x3AC3754DA4B43A6,0x1F7F613099B7039,0x2AEE2B4D785EC3D,0x44F024DC74F393C,0x185DE73BD43881},{0x5A238233A897E74,0xC703012924FDC64,0xB85FA23C539D601,0xA53119244860E4B,0x2336616467949A8,0x16A17BB59842FFA,0x1EEAB7B6A24707},{0x42290AE8D4286BF,0x552184EEC11E779,0x5EC7D180622910,0x5B6B6545748E43C,0x387C7CE92361AA1,0xA703D2E6701EF98,0x1B5299D21ECE85}},
+    {{0x29695C85A2513D9,0xF245AD68DD98F9C,0xCA1A7D943CE9575,0x873AB172378935,0x995FB7FE3953965,0x9BF1C73F6B835B2,0x1C9920CB26AE1},{0x677B4AF4F69FF7,0x15E42C4BCB3B954,0x6F7B3918A1A3C2A,0x9A60612C7B9495A,0xE80A29CB3855640,0x7A807FF88FDAA09,0x38A392DDD0BFD8},{0x1908FDC5EE5C56C,0x9B6E9C4AC06FD76,0x19B665ED0B31D68,0x63C0D81DD0EF5E3,0x458C07D20AF5FB,0x3A8D24F0664CBB1,0x2A7F783B5FC8AF}},
+    {{0x33AC33AD83F14B8,0xF7CBFCF0011D240,0x5E89074D17B8052,0x2686613AAAA6A46,0xE833E5E1179694,0xD40C77252CC40A4,0x18A399942193E3},{0x29BD7E3C0F4ED62,0xAECA987163D7305,0x50BE09D5557E5AD,0xE5170EAD4FBCA5B,0xBB15614F5F53E0D,0x3F2287FE9C869F1,0xFF8750A60862B},{0x41A3C74911FA7D,0x8D9EE6DE1208F52,0x76ED168FFA3B086,0x7ADD9E644C77FB6,0x9C662FF86198BEF,0x894B01D40A60D21,0x3181F2F1004FC}},
+    {{0x16EB2AB70CA8E7,0x4FB1E24E9410D5,0x3896710B5F0A735,0x78CCB548DF030DF,0x9ADBFF8FBF66ABC,0x4AA2BA4A08CD7F7,0x170BF06DB2C333},{0x3C04400F0DF6F73,0x678135E3E06EF8B,0x612A52024271F64,0xEB9235D14E3A271,0x3EC4BE3012A394E,0x7B83567E6B353CE,0x1E69C3F50F671},{0xC060C86EFAE6D11,0x582A980D601FEAA,0xD361D28884443FE,0x78CC4A9DA31A850,0x9269F9D27987698,0xD17D658CA8232FA,0x772805FA6E1B7}},
+    {{0xE486B929E1516D6,0x8647FE02FC402D5,0x61B37F14FC5EFED,0x7A5927B00FE754F,0x3F5268B9442D7F6,0x24D1CD198A7E60C,0x39817D3C726768},{0x4D6EC47C587368,0x18F7BB7FA73977A,0x5CDC3868EDB6FE5,0x29087BDDCD9DDAA,0xF585ED62D7AB1F8,0xE56E93E751A58A4,0xA0019CB5EB0EA},{0x98D460146611835,0x1482C9DA3ADC727,0xDE561291A91B2B9,0x6D837E81A191AC8,0x45BE54F7E3F010F,0x4D6AA712529737D,0x2A86F9EBAD3}},
+    {{0xE0E1711C786CB66,0xE14C99772DCDEB9,0x7475F842410F5DD,0x17ECBC1D5710AB8,0x321C49415FBF190,0x717196F1D7D9E4,0x2D76ADFC616C4},{0xC22C323CD495DF0,0x2593338E1BDA0F4,0xE0D15D55613146,0x687BBF7CD75FC2B,0x2FE1173917FB28E,0x98FFD85FB610FA0,0x77184080547D6},{0x7FB494D69DA9275,0xB2E2F96FBC69D63,0xAA4BAA8AF27289E,0x8FCCC4CD0FB395D,0x29938A0F1E0A08D,0x42611FF3A99097A,0x12804A6D10D892}},
+    {{0xD339445D1C83F4C,0x87936FF0131073,0xFBA13AE7010F391,0xFC1CF2A8C79CD52,0x26BDCA2C8651D4D,0x2402CF1C84FB214,0x34FD1D3748F4A9},{0x43E243B3AB2E3CA,0x25C9952F62F3A5A,0x350255B4F93672F,0xF50AD46EC73EFD3,0xD5ABFF8AD49AE03,0x58A04F5762D4BB1,0x10A639AD8C334},{0xF40F7970FE00E7A,0x3C6261FFF731CD4,0x27846C88271D408,0x539DF79607A2FEE,0x64778F578ED2779,0x11CF0AAC14311AD,0x12D6F17519B4F3}},
+    {{0xE2ADE2509A47DF4,0xDDD88D31F4C6C85,0x67AB21793B189B5,0x6A862E9FC1BA4B6,0x4159E9A71DCD3CE,0x61E98127C6C27A3,0x3D7F35529A69CD},{0xD9C43C549050BD3,0x81C8E39D1415C3C,0x432F04D3DA17987,0x1D595DB1A341280,0xBD75F5EC5DCE8B2,0x49EB5652F74E49F,0x3A8BD97C94013E},{0x8830CF3AD577961,0x8C31BCA99B0567B,0x351532F657877FD,0x961883D6EC2BC09,0xF2133267A10764D,0x18FF1BD0C540A52,0xC72CDE1C630A8}},
+    {{0x783C07F3E7A52D3,0x18DDE280816FB86,0xA8BFAA8C4F02409,0xDFDBC68AA9003C6,0x17A209CD923626,0x6A70602368CE80,0x13A7FF5614E7BB},{0x93C70819C3C9142,0xEFA86EDA45A8BD2,0xEC11F5B538D1E3E,0xE51B17D92C084B1,0x13775B3D1924854,0xBD6E3E5DD0D25A,0x1810EAB6C0F886},{0x1774DC94A14DE64,0x18045BB71B95A1C,0x13C3B727643FAFF,0x14564446B22C792,0xD736021B9C13651,0x9E628C6EAE3FD83,0x2FA59289F7D835}},
+    {{0xE3DB70740A67806,0x21058B45F688F5,0x8AB280AAF58F4CB,0x60665FE481C3F39,0x408BDB281C1F7E2,0x4478997A81F78BB,0x3CBF7ED28660B6},{0x796346CE942F68,0xE99D5E1CE1D9996,0xFD7D62C4ADEAC29,0xBFCB0846A101AA8,0x562083FB807D065,0x9CF5A192A96A27A,0x1143BEAEE88D22},{0x2C27EDD962C7C69,0x4EF568F892CE9A4,0xABB3B6444AB63A8,0x935ACCE9595A7A3,0xCE174677BE88F84,0xA8684D8E4C4CDCE,0x3E30870BB3D8C2}},
+    {{0x24F6DB62AD53E52,0xC62B7724682B9B4,0x6DF3F35F5259E34,0xCFC4E0EC5F99405,0x8907E2BAA57A8E5,0x4980C649105CE54,0x22E34EFD025E72},{0xAFBF25DCC6BC777,0x6D8EA9CDC5F6E4C,0xE0A52145463BAB4,0x82D20385D9D8720,0x89EA74051A6289F,0x117826D62A120F8,0x25A06354DB79D3},{0x88626120A3A3BD6,0xB53AC6E69A79AAA,0x3A1D74563A421F8,0x59F489D8630DD42,0x2DA2B0944E7EE6C,0xF44398D4EFC3189,0x3AA8BFCABEF8EB}},
+    {{0xA78EBA8D389F756,0xC74BCA8642C9D41,0x66CDC9039CE413A,0x77F1B8DD0DFD06F,0xB581D9DCCDA92A9,0x4E94193B11C78DC,0x43F27FC17A529},{0xDCDC98E78735742,0xF8FBE35BEE25DEB,0xCD55C4C0C3BB3BA,0x3D4C1058DC61B53,0xDD98A06A10D9F94,0x7E3289C6C65E166,0xF41DF234D470F},{0x39D9063D944866F,0xBD2FCEBC2CE7520,0x90DCA376B0FF89E,0xDD11E4567B2C6ED,0x1FFD8F372B03185,0x140B22CFF55C52D,0x317E75ECC4BF45}},
+    {{0x8ED17C893D9AC24,0x8914FCDE0F9E2A4,0x2059B9A2D0629B9,0x422625F07453E80,0x48F45F167B6479,0xF1D258CDEE85D63,0x13DC7DABE45AEA},{0x9AEE965CF55495B,0xC1BEBFB08AFEE24,0x7911EFF2F8CA117,0x9171A4EFBC15CAE,0x3BA0CA308252FDB,0xA64A89AB3F4AADE,0x861227D211F23},{0xAF271E814607DB7,0x8B1C215BFCFE062,0x10A9B63058098D1,0x64015662539A402,0xE86BFC246BFED6D,0x70BE912E48D7131,0x21261609175224}},
+    {{0xA3BE8EA9E977E86,0x11F6CDB01D45B93,0x3AE286A0FDC6419,0x1B1E9998565D0E7,0x8AF370A6E167307,0x3DEE2E244B15054,0x3E65A3F215C456},{0x6659E0BDAED47D5,0xAEB712FC88BC96F,0xD75792920F03DE7,0xC09E62B7052C3A6,0x1D4CFE240E6A2B9,0xB7316651C5D2C62,0x12A4C7BE13F446},{0x77D2426E9F13177,0xEF1423C4C415331,0xCC52F3FFC27A467,0x59465C6F2D5C3F9,0x166D60A34F24D39,0x6E5817838716D39,0x10184B3B0985DB}},
+    {{0x72A8A4B8C2EC3B2,0x2CEC72040E8EF3D,0x33F1EEC35EA1148,0x4C4BC5931D27DF3,0x96757FF696A6665,0xA8029F4E34F459A,0x3A144F36F6C90B},{0x8C5DB16137B5E20,0x7CAB2B1F7B63BD3,0x64603BD9EA59C32,0xE69CDAA389854E7,0xA2921FC80D0EF5,0xFF9111FAD4CFAF0,0x38674DF49454D6},{0x59F1C76231768B4,0xC53F598F06025A6,0x92E478F2A3BEC2A,0x6BC87EDE1E1FA4D,0x7CBA19FA0E2169B,0xAB73C7D28CD91D9,0x3A0612E42F54EB}},
+    {{0xB32155C7E6DAA40,0x3B7F1072E8BFD52,0x88FF383EB26D7F1,0xF83B675FB104F0B,0xE1D7558A4B42016,0xAA896A954400253,0x105620C8B86E94},{0x25DB2DA5D40EA73,0xEBA48DBD96F1572,0x4FEF2E998F69940,0x4E6600907156802,0xB03DF02D884F29F,0x595107BCB627752,0x70CA475321798},{0xEB44A36D167BAAC,0xB92DA4536437956,0x3F81496046BAE9E,0x83AB69F8673B54D,0xCBD32694B21A8FF,0xD73F7E8BA1042C7,0xD715F4BC1E898}},
+    {{0x25862E8ED0B644E,0xB8E6B11AD11EE0D,0x476EE3CD6976C19,0x2AC790F5F069F6C,0x47725E814850961,0xAF5C40315AC8EE,0x2736EA8742AF6D},{0x37BCDDC5AE715FC,0x1D615295AB750F4,0xAF731F80E03424D,0x3F101A0498F3570,0x2ECD93B37FAB67B,0x515B823768D1558,0x690EDB6262E0},{0x1E20EBAEAF75E7,0x2AB53F84ACD0CDD,0x588DDFD60658CAB,0x91A85B8F64DDBB3,0x57072C9AB9645B0,0x8DE76E4A417391B,0x159B8EC2503346}},
+    {{0x92ABE8485F24909,0x481690BFC8F6A19,0xDC2CFF4DAA5F1FD,0x3C78001D9D9E7C8,0x16DDF31F146D1A2,0x4F5C7BC4AD8791A,0x2DBE2D45CB4653},{0xB3432402EA8F62D,0x72037280E3074AF,0xD268FD002DB6D75,0xA6FA45F9E6DE10C,0xF1F9AC3D985F236,0xC417465FA75A3F3,0x15EF0E45E30D8E},{0x1A19DD3C075D623,0x45FFD6FA8B5E117,0x2D4D65B216365AA,0x496BEF7829B864F,0x7021AB411EC6897,0x2F9472B467E169D,0xAB8C7C7318846}},
+    {{0xBFD37CCA9084D16,0x4F554485A3FE433,0xC8C63608C79645E,0x7EF4E2F0A9855B8,0x79F9C6C35B0A40F,0xCE5ADC93C7647A3,0x382EF4CA8219C5},{0x33EAF4AB14C4000,0xE84BED8788E5A3A,0x5D9D8A417A41F67,0x394E4D9F4D85112,0xED425006E045130,0x7B587451247B173,0x3887B4B6754F84},{0xA0122B565171865,0x27CF5DB28FA5A98,0x3FEE81AE620F11E,0xC67BC147D00255A,0xE4C4158E509308D,0xE2E331D963D4E37,0x3A1B3561E698A4}},
+    {{0x68AED57052A4216,0x93A43B7CFB7E93D,0x5F5D2CD5905F41B,0x922BDC07F20311C,0xE49BF8E1DC3D941,0x4FD663307097A8F,0x111FB41B8D266A},{0x9B724DAB9359345,0x83F04F60F111C95,0x2FD34B22C169E18,0x9D7D31AE0058FA3,0xE01E57FAF8F5A29,0xE695FAD8F16089E,0x2BE0C89C5696C1},{0xC61D23EA96EE44D,0x56AF09158EDAA99,0xF6CE207263D8A30,0x63DDC6FF9D8C77D,0x97F517FADC20512,0x3639F0CDF67AFB0,0x29F773CCE1A82D}},
+    {{0x60ABE397A4A2E60,0x49D4C20461613F3,0x863E9D4B17721E5,0xD393F534AD236C5,0x8C3C94BB894F44E,0xEBAE57031A3673F,0x17DD3B0F1C49A2},{0x758E55D1F0D36C2,0x4BCAFAC21E300A1,0xAE1E0853AEF5602,0xD3EA318052B7E09,0x27E7833D74595B7,0xBF1DEF939D33EE9,0xC89012F8A99CE},{0xA72B333EF4B6D86,0xB2E3FDE9EBA538C,0x82A6B27F6F3EF1B,0x8DDAA9C5CBF8B76,0x97B3749A9366DD6,0x6035E2D071C7EF9,0xA942A72FC5D63}},
+    {{0xB5D1924AE3362E1,0xEDBAACCC5A31923,0xF5CA6AC4156E05A,0x1102F7EE8DBC65F,0x87D578FA34A00E1,0xE4CE5A8BCF10CC2,0x35DE6C10015649},{0x2C78F2E1E1C4852,0xDB57F520ACF2A48,0x440E9530E1DB595,0xCA7787BA93D7C5A,0xAD6697F85D732B9,0xDF0170840034E7A,0x1F41EBDAF993AB},{0x71AA801C9480596,0x28E954092A67F2B,0x4072C7A30025FDD,0x6E90CA7A70654AE,0x89086F60BADC5E6,0x6C1AD854B0214D0,0x15FE6E131C120C}},
+    {{0xE5C5B917833BEA2,0x52A74C8B541C031,0xA056F462004E489,0xC90FF154B414862,0xAC5252D72E98F73,0xFDEC2834176EB8E,0xF01E36F165481},{0x790E59A953D85E5,0xAFF3E00F040CC91,0xDDB612951AB1003,0xB3F580669D8D1A6,0x2E946BE698E940F,0x11F0D5B2C5227A4,0x2A130958C43E0F},{0xAB979F348A1BFB6,0xB7BC8937A628232,0x9D175F57511B4A6,0x5015A6BD15C73C,0xE53AB3139121F95,0xEDA597A1C4AC87C,0x13CD51A0AEFA50}},
+    {{0x59BC88597B63F85,0xBCEDC4EE977D0B1,0xFC9C4DBE5FD65E0,0xBB7CB759D44A225,0x51C5288AB2AD990,0x50EDDAC30EDB6D1,0x24FF6C55B4C46D},{0x3F57C0AF37E08AE,0x99E740ACA105FC3,0x91298B184149FC3,0xC62F80B72DDD743,0x10D409D0A8AE3C8,0x99F84230E81CBE2,0x2D1350760E3A64},{0xBBE6DBAFBF3AA76,0x589A51DB97EA516,0x5BA7CA8440B1362,0xF169622B74CE6,0xE093E8E6066396,0xA35EA83836021E9,0x32BF5A92C78887}},
+    {{0xBAEB7E74B1DA3B9,0x387666BA419B11A,0xAB032C1792B6C8A,0xF53BFAC5A5726BB,0x561765E37D3C7FF,0x700E5F0999B581F,0x3EE81032614C01},{0x639FED7EA902F31,0x8A4EDAED5149425,0xBA16482E771E0D8,0x4CE8E4B17B876FA,0xFE490B69BE1C4C4,0x3EAC058D53E6B74,0x18F5F0DAC2D8DB},{0x748801FBC2CB699,0x8110C3B76488548,0xCB99BCCAD1E3E47,0x501FD96665541D7,0x62BB73B35321A01,0xB10D3C92A12D0F8,0x25BA28BB2E7E22}},
+    {{0xB22E09F3C1A7289,0x94ABF342E54B28,0x2DEAF811C327C6E,0x53D8179E4968C66,0x32455955744BE51,0xA36E4965B9B123,0x2681AC798A595D},{0xC0BCC2B2CEF6A5B,0xABA59B3A60CCB21,0x2054E4B0904CD3F,0xDFA0C8678DE35F1,0x7290977EE704C7E,0x775BC20FAD90F8B,0x1AFB8AA7F0A58C},{0x35FA28AB97933F,0xB4A9327C656E2C4,0x47B827DE3FAC8F6,0x1221C7BA752C773,0x3F589535798FB9A,0x660D2673FB4B417,0x14ADEDA283529F}},
+    {{0x1EDACD8E0949087,0xE8EE5D38E41558A,0x6D19D7CA1233126,0x4D5E0573713B643,0x9DD3207B6D4E14F,0xDFB0050EC23695E,0x17CF0E25B160DF},{0x1E38A84A2C777FB,0x8A8C83448C735D4,0x2ACEF3EE5CB59DC,0x2398F89707EAF1,0x523F6E98820029C,0xB34D18722CD7D0B,0xFEE3F322B3AE0},{0x1BDD60CE3C5D9FA,0xE068064A4E67AF9,0x8895B8D85E75460,0xA94B4BE4E3214F4,0xA1D865F26155B59,0xA19BF7D37FCCD3E,0xD74D62189D363}},
+    {{0x51224612C5FD95D,0xFC75F54D3F22AE3,0x845F601FE44FDEE,0xC43DB46B6C3FD09,0x997D113B60F82,0x1C65FFB5FB23704,0x38B190C799A292},{0xC4B4E36896FF30,0xAC31682B55EAAC3,0xB9919071DE329DA,0xF6E358ECA255DDE,0x198289870BBBD27,0xF3EF1EFE79C2804,0x2146DD22820EF1},{0x70C6BADCAAE1B40,0xAC001A2417BEE1B,0xA50800B547BD6D3,0xA4890C091856280,0x214686116C07B75,0xD7DC4AA8C8713FE,0x28999AF7544E34}},
+    {{0x6426344E5C83464,0x3E5547DC0510772,0xE430AFFF25677B7,0x3672BDE3DBEE2FF,0xC5EE39B33721536,0x5AD6A058D5842D1,0x2C5B2FBDF650BC},{0xD4A4B39094B3570,0xC46D2E5B14C5986,0x64BF5BB93628DE6,0x1A83A31AA941DD6,0xAB02D19376B63D4,0x877A30DD6AB5BB3,0x1015A300B7874D},{0x946A4FF23A353C,0x1E1F47A022FB27D,0x949AB89B208C24,0x411CB89F3DF839E,0x81E4F57AF1E140D,0xB2107F18ADDE12D,0x1E516EDFB81D29}},
+    {{0xCC5EF97B92D0E85,0xEF659C7CCC2772B,0x2A3F16850FB0F38,0x52FD829F63ED8B1,0x681B45DDF41AFD3,0x853AED3F4BB527E,0x305C5515D362ED},{0x389667AF87E1B6C,0x2F5E4CB74CBAE10,0xC8E72477B96479,0x333BA686FD9804,0xD680AA31EF48B76,0x5BD6ECBC0F61ED2,0x689A5A54931A6},{0xD4D21381247EB63,0xAB86471CC52ECAA,0x86DCA29021C0F61,0xBFA58B8420B1C6D,0x4022830B5BCA53A,0x6F7047EB388D304,0x2AB088EA7A4099}},
+    {{0x42F56FFF69F8718,0x43DBD914A06851F,0x7BEA626154FD16C,0x6703322353D3589,0x6D4D46EFFC7FBD2,0xAFE7CB1D88D0BDF,0x3FF0DDE84C3870},{0xDD9D8E16F888353,0xBAC6F6B67A110FC,0x4A7AAE61175FC46,0x2D174CB0D750D30,0x813EECFFDA8E157,0xF80861AD8BE0C68,0xCD1C2A72A38B5},{0xF3E883709C5BBA,0xD084A81A5D74A37,0x64D3BBEF6DEC585,0x5F675FC2ACE1B7F,0xA326540B9CA4A56,0x15FA149260C381E,0x15C4415EE8D486}},
+    {{0x5276FA6A4980A74,0x565ECAC93C7CA34,0x9D412C6684C6370,0xEE5E5CF7D5C50BC,0x92F0C4E316CD45D,0x8B31C79FF55E86D,0x203C503E98D1},{0xAEE3126E6B22963,0xAB06C28F8117C18,0x91E616D61E0D604,0x17A12715E69CE6A,0x6AC9C56952291E1,0xD63BD34B191202B,0x349BD49E2FCF01},{0x7030E9CA73057D,0x14D6819BCC25740,0xC38BA6D867A770C,0xC08D640CF1E7646,0xFD59DC37E5B587D,0xCCB9BFBED1E76AA,0x180B71B81A64B2}},
+    {{0x3C8E2D72955FAE2,0x1443B8A07DD7F0E,0xBEBC8F579D59A6A,0x8CC7762D4FD1F42,0x9EF8CFC44CD30C4,0x8E47022DD5FB215,0x9EFB29445F54C},{0xAA1D7B284B1083,0xA23FB6CA55786F4,0x138E8D912F9A7D0,0xA35625CCC859582,0x620A4D7BEC4780E,0xCC408B645F99410,0x1CFC8605D7D703},{0xC36C6CDF9D5AA7A,0x2921D5C1B0ED3E,0xEB11EB18B9978B6,0x305EDCBC68EB087,0xEFC4C0B18B5D85B,0x68BBDBC9DB94E67,0x1406B285F26CB6}},
+    {{0x6072F2851252150,0xE2E1C91CE721F68,0xE8B77DC4B136198,0x1AA7BC40B9A6041,0x5B4E7BA4BA7AF21,0x60FC7CD73B83374,0x1A7EE004369339},{0x8E7AC9673EA8B29,0xD4A58CA077C153,0x4F5118244D18753,0xDDD3DD440B11FC6,0x333D0DD6B6369AA,0x45BF56D05041925,0x100B5A0C2C1C71},{0x6B7961A9E47D6E6,0xAA6687DEFB56AC,0xA9DB5B685D5D004,0xA18C95B459D8D69,0x598902C798CC7AE,0xD86795CB9C00105,0xA1625A3853030}},
+    {{0xB46D81B81035E4F,0xBD3F9BDAE6C366C,0xF00D1B887BB7289,0x8C2D2D624C96F17,0xB8EDCE964C8470E,0xB2FE2CF56008CBD,0x32147E428E43D6},{0x44DDCD3C9F68379,0x27A008C0B631C5F,0x2657B1354292BEC,0x7ECF2B345D49AD8,0x1BD145E281218B,0x14E896C42CF2659,0x146E4C97D639ED},{0xA4E5E9F9CDDA678,0x1F1B3E945D6A478,0x393323C6CB1F66F,0x75ED76351ED581E,0xADA6E4BB1DD87BB,0x2F17D2A80BB27D,0x355A91735AAC60}},
+    {{0x4CF1D71A17062CE,0x5025C2C52466F9,0xDC975043D218E71,0x9272769EDF2DE10,0x80B570DA8414BAA,0x7C87EFD7071645A,0x160EABCCE1DC51},{0xF7990F5F5B76ABD,0xDE9FB8B57DEC8D7,0x98466ADABCDC5A0,0x1AF55E62DB28B3B,0xFAA30DC9C9DDD3C,0x81D4A4C98D86C61,0x182B678697E217},{0x5315F6DEB51EC17,0x22FC63BDD128C2B,0xD5056DE2BDAE327,0x7F57A7F90CAD8C6,0x91A77C9378D7977,0x9E141506327763E,0xCE9CB4F9DA009}},
+    {{0x3CFE4A831D082A5,0x21B8C9F16687AEC,0xF05CEA6811F8966,0x9D9AE5A47659B61,0x8667C4A1B8B4FA,0x49E531C0342F293,0x13CEC654DA5538},{0x81DB79CFBE5D913,0xC3729B842635C33,0x475F110A5C1D915,0xFED7A920B5F3674,0xA2E64A6C6790AB6,0xD398746CAA8272A,0x1BA2686C934ED1},{0xA000CD9D12EB543,0xED3C0B0DC0EDEDB,0x841B4A68A25DB07,0x8C8DD8DFBDBA2ED,0x6D8BBBF52B73972,0x60AAE565D655B44,0x2B6F6354B3706B}},
+    {{0x8EC95BE9E067889,0xFF3EB69A6813D50,0xCF25537E6E3BEB3,0xAA185BB0E77EA1B,0x32E0A9AB7842BE3,0xEB61E318E3EAA2C,0x277DD170CD1920},{0x52295CF2B35EE47,0x7F2ADEB6B50860B,0xDBA06EE333F8622,0xE7DFA6B4425DFBD,0xCB43D1934DDD591,0x4D2906EBE3E3105,0x2F3264E2B41279},{0xBDF1D59F21DF3D4,0xDB2D11A41860AD5,0xBC5C60388D90769,0xC8019C460CAB4E7,0x203DBD0E580E79,0xBECF73ED7FC78D6,0x1B264A0DEDB31E}},
+    {{0xDDB91160AF6A65,0xA4A59D7657AA9CF,0x4D1F787AD6BB8BF,0x43B3449DD38E659,0x6C7B2F0EAEFBD73,0x9C0A221507370AE,0x39953370D43AEF},{0x3D04CC50E4BDAC4,0x8520B90E116EE0,0x269C1B042873A56,0x4EA04260BAEB3B0,0xD4A344A35A56476,0x17C526C9607DB10,0x1B065F7D54D119},{0x20C25B25D628165,0x46CA9320C225B50,0xEF3A02BA5C0FF78,0x8EDD1A2B89E53DD,0x4386956E0FB668D,0xE270626BDF363BB,0x109BF06B325680}},
+    {{0xEA8590E7213BB0B,0xE48B671C8DB8EF,0xC1C2E4A0BF121AF,0x28FC0C552722501,0xAC4B0770E1A83B9,0xF40A655C6375106,0x26A914F214B92A},{0x329A1A6AF47CC87,0x8524CBF684E9F5B,0xA5BF3553164D0B2,0xF4CFC5862B44EF9,0x2A46B2EB75F631F,0xFA9F8148CD24615,0x3E7ECE8B3E2617},{0x1DE14284B8E93F5,0xDEB9E6430EA4EF6,0xC229E4A174815CE,0x406D4BCE6BE1BEB,0x86DCB16932D6C6C,0xD61C1BBD328F10E,0x26879788367092}},
+    {{0x73B2E78BFDCE8C4,0xC26E689C364D326,0xCB281DD6A0C5BF4,0x1BDAC2B8290AD9,0x319DEA239F1F9B9,0xE7B864B8CC2B9C2,0x25DBD85F9CBB04},{0x6B9714F63861942,0x365861BDC1A154B,0x1DB10E0CFD19B4E,0x9E0568B61830271,0xB17BA3B9AF308B3,0xA2A3B2D80896282,0x2C51D13936A8F},{0x2BDE3087C276007,0x4D85E6F9D565524,0x569D7AC854E98D6,0x84B4C20F64C8233,0xEA4FEB8DBF41350,0x1D2D5D5C3C162F4,0x38C32A8FB54D38}},
+    {{0x7330F8FDC819361,0xE29DC2A3117B2D1,0xC8852641ECD3B80,0xEFDFE2847BF65C7,0xFB4114A78264630,0x5C3376EEFD48D31,0x9C8DEB9ADA4D6},{0x1529E688D847581,0x11D0632E03AD8FF,0xC2A40CCCF06DCF1,0x537DC6452D0DE79,0xF3DD1DD62A92146,0xC2A3610BA9361D4,0x225FA9E3C77A7F},{0xAF2F85CACD7B61B,0x9F26AFDED9DEF72,0x50C5A94C3C8C091,0xC9FA32D590AD5DD,0x8E03CA862191582,0x7C3D7426E5D0382,0x307E1F8D9A1AA9}},
+    {{0xA25BFD11FB33671,0x110F7C076C9BFB5,0x8E7EDA60DF8CCD,0x1BD48BC5B9F8FA,0xABDEB614FC6B761,0x11521A923C47685,0x47F9D9D4EEF33},{0x1DCA07B0DFB1C9,0x890B62864C79F91,0x44C21A39C07F9AA,0x66A8FC04F233A0C,0xD7898F836A6C7F4,0xC8A81BDD1B4742D,0x42508FA2B158B},{0x893B19868BEE2C0,0x322EF1387A4F8FA,0x7DF8C52241D9E8C,0xF327AED70E2123D,0x8F11662C550FD7B,0x4687DF6F5CE7449,0x4C337DFD2892B}},
+    {{0xBABD734A34FC300,0xDE95B529174E662,0x4B0A559D6A5F35F,0xDF2B7407025EC57,0x38D4EADAB7F6141,0xD634E1A6A9D361,0x23A94902EBD506},{0x39C2211C2F11C30,0x1D8BF0FAC4A0C9C,0xE0299D1E6B768CC,0xC79A564ADEFE2E6,0x305BD9CF7BCAEE0,0x6E563FA29831B96,0x1CE9E2B136B51C},{0xCAAEF9F92D5116,0x30F2FE4FB7EE5A1,0x63961D1C3E150F7,0x75F64A2D7C96C22,0xA8042D1E095C33C,0xFB7B4B12DFDFBDE,0x6E88791DA5B04}},
+    {{0xD03F7A676E96DA1,0x5FA53A5F39CA702,0xD0964FE36AE411,0xEE55F08EFF01999,0xE2FF294E3FD6407,0x8F27BE6D10461B9,0x4D23B8D0AC5C5},{0xE5345373E88910A,0x1ADA153DC2C4EA7,0x7A4E8188BA4BF38,0xA2AFED3D02EB61,0x43B0C418D9DE109,0x653375547C26F1B,0x1439AE50EE8FFE},{0xBD442B15D7D9370,0xE0827EEE919F5AF,0xC174EE3EA50EB55,0x231708956ED2A22,0x48AB1478E90B0C3,0xA5DD298A11E17D2,0x172ADA06F0A7E}},
+    {{0xC08615B1EB2832F,0x72A7CC4A3CC22D1,0x5C79D6BDB46E58D,0xF3A6B25096AE7D7,0x16CAEA3A001A5B8,0xE66299984615E5A,0x997B01AC3E057},{0xC4A9A3A0BB19A39,0xB4C2CD168B8A605,0x7EF5F10FCE1599F,0x37E18CB28B840C4,0x7CBA026D1832ECF,0xAE868A3C139374E,0x18151C913CAA7A},{0x4589A1B6899BE44,0x93223DE92272954,0xBD503FF1A99FCC9,0xCB2A07BDD3081E2,0x3AC2EB10DDC4A53,0x5B52574699BF4EF,0xB3BF60F023599}},
+    {{0xCC2B0CACB749736,0x52DCC0473F4610,0x8A879D59C8E8D85,0x24E025FA5AC4B44,0x3CFF68EA942D53D,0x1325C7F8F97A0D,0x982EC9D3E6596},{0x5CD4F5FF11BF6E7,0x16C8962E614A5F7,0xEB05B7FFD302031,0xF469D743EDE46A,0xF9D63592D49B362,0xE8C4A6EBE0ABB33,0x235F4B5751E626},{0x8AF6A4A2FA65249,0x2F44AD0226C6349,0x1F459492E86F00B,0x569BCB15E7AAE23,0x4CCDB9CCF176B6A,0x1069319D1D9B047,0x36AC11FD151442}},
+    {{0x907DC3C1F3DD99,0xD8429DCA43255F3,0xB89C78838023E8B,0xB60D3106129043F,0x80538EE015F22F6,0x2CC0A343CE155DF,0xCCFD80CDFA392},{0xA090AA8867ADD09,0xAB356F3BFD8A7FD,0x19CBF07CCDA38EA,0xFA9C78491F1D775,0x87F7C4F257D63CE,0xEE187411F930F7F,0x1B51FAF77FCD81},{0xE31271E458E8C57,0xAFA268C357C8A13,0x5F6C374A99A101E,0x51ECFBD986FC886,0x52522A27F549BA5,0x4484777A89FC992,0x155CC8280BFB20}},
+    {{0xEA1650E348C56B8,0xB5386EA3CCD0B8E,0xB5B2A935BD2E007,0xC95EFE92D9DC057,0xA9F06A51374679E,0xD0EAF7DAD8BF190,0x230363C8EB124C},{0x88D126EADFDDFD5,0x1250A9D76CBEECB,0x3B6204F32DEC6E7,0xF2F3364611F97C,0xB625AB33D461BC1,0x8717C7EC816B493,0x2FC431C2255223},{0xFD1F72C6E7BF89C,0xFDF126AFA075E0B,0x64CC7E37B66A213,0x699E1D066CBCCE7,0x34335CA35A09AC6,0x940BCEFC9A56C3C,0x181AD55A1FF5AD}},
+    {{0x212920BB1D1779E,0x80B6F5A58350F6D,0x7F81541999453DF,0xC044CE31296C748,0x7A96961DEC8BD76,0x2D9F8640E9079B7,0xEB10951AC18FF},{0xEEB621276A4719,0x1970871F436A1F6,0xEDBAF9E587D4A93,0x6365529E823D008,0x18A3AA1277E85C6,0x5005F98EEDF7502,0x8F59E4DE5C6B5},{0xF112FA0BB2AD719,0x5E367F1A43EB5C9,0x8E2F9AD09C1CCED,0xB1215BB6C0D7691,0x18EF95A0323ABF3,0x59190277D33B1A,0x3C00D4D7C02594}},
+    {{0x6619C8157245523,0x353F06B324F4C01,0x775370DBE38BA66,0xD3C41030DE4BD24,0x5E73011FB096F4E,0x506439B2BEC16AF,0x8495B3F9A3691},{0x6BE515B9CADCF49,0x9A3434DE8C73CF8,0x873A06A1D75C5CB,0x4A28D69B2C5B1C7,0x7E145094C0713D1,0x1165BDCC6E369B4,0xC7F6FE8A9F2D8},{0x5F160CE3F38E3EB,0x8D02403FADDF83,0xBBFAC6AE9D20AAC,0xFC7EA7D29375D19,0x10E0FDED677093E,0x6BBB9F3EB87CD2E,0x38F85DDDAFB239}},
+    {{0xEADBC34EB4C6A90,0xB924BD283596C36,0x3EB68070CE613DC,0xD4DD963B0C978FC,0x30A03B91D0A4AF4,0x74F6115B027666D,0x1836E915198250},{0xCEDDDD7F9D44DD9,0x5FA079DEF81664F,0x53232A8A26B0B83,0x61471ABBEA7B503,0x8E59C9EA6A9E3B6,0xFF004352F89704C,0x34C2D255C3BACD},{0x1C21EC107E1AEF4,0x2C2C7B630D24C2D,0x86301613AAC72D0,0x44A891F3099442F,0x63257ED0291A2F9,0x80F76E7274BFEEB,0x199B11A487EF00}},
+    {{0xAD464B5FAF6CE4A,0x75237A85DD30873,0x8753CA61AF88549,0x528D9FB789B2221,0xAC7115DD0E908EF,0xF92A3AFA34F1A24,0xAEF94C5C61045},{0xF7CB6BC18DEC603,0x5D976B6D7E563FF,0x844B79EFA804CCB,0x792AA2EC9973338,0xF6A5B859143F819,0x5C6DECB86204BBC,0x1F13746467F646},{0xF547CDC5DFDB368,0xF534AC56105674B,0x16106F6883602A6,0x79FD6BD9973B6A4,0x7C3F415742FA8E6,0x922322B1911F864,0x12C89A5C0E115F}},
+    {{0xD43FFC054EDB225,0x440760793FEF36,0x4B8401619A84F5B,0x5EBA91267FB8E1B,0xED5A632079452A6,0xFF2FDC8EFA90E91,0x4EAD289C5A2B0},{0x563CC0CA9F8BA48,0x8B5C53B57D09FA,0x978B22B810198DA,0x9D2FD4CBB091629,0x9DC300DF8016F6C,0xD42EA8EE84C19C1,0x2BB50238E54885},{0x405339F74DF0FDE,0x13CA2F8EA48FAE1,0x5714654E61589B8,0x47FFB70B7395C49,0xCC84B678B888397,0x83E1FB24158D194,0x20215CDE74C1A6}},
+    {{0xBB926189A12D9B2,0x83BF56CBCAE98F3,0x843411463D26302,0x3FE9138B07C7569,0x8A9FF4E07E68C16,0xA23D42531869F14,0x2C004A473A3447},{0x529BCDD7313D776,0xDA0DC76C2D2DB6A,0xB3C4DF2B642FC95,0xEFBC502E296F288,0xD6251E058CFB9C7,0x79981DC84696141,0xB62A3971F76D4},{0x8134F98AFDFA4B1,0xD8F514064E4239,0x54BDADDF82ED732,0x93F5D5CA191622D,0x2D3356E993141E2,0xCEF3312939B9BB,0x18B445101DFAAE}},
+    {{0xBF5511067EE9950,0xE85203C90686E7E,0xA85484BFCD245D,0x7D1CE081EE75D9C,0x71F3E9BB97A9A7A,0xBBB57CE035A791D,0x1F0E6745620A49},{0xDBA633EE0700274,0x5A59E1EFADA7A28,0x87625D19E3DA186,0xD0A1A723EC644F4,0xD0376526DD40EA1,0x77E54F3927175BC,0x67A2AD8B06EFD},{0xA8EF3FEF30FF776,0x67F3D4157E2379C,0x96CA587B39C69B3,0xFF22AAC781A9F0E,0x111995C3C33F893,0xCFB9F97A01529F3,0x18977E78C9A292}},
+    {{0x22C14569B107554,0xEF2B451A894F642,0x854F1E501F95492,0x4B6497D694A5A97,0x3E1BB8782D3496,0xE9FEBCE1F61F52,0x38C9E6EB421C1A},{0xD47A19977292852,0x78F2975808BF50D,0xE33799B38BFCFCF,0x4F8FEF558945EA,0x47FC8E9ADE59461,0xB54CB4D7A88CE9D,0x1463FEEC79C077},{0x7660B4F98F2A4D3,0xFAC813D9525242E,0x959F5587CF1B817,0xB3529374DE58F6B,0x952B84FF3AC7274,0xA73321D54E5C583,0x2279D982AF30FD}},
+    {{0x4B2DFFAE9C0E511,0xFBC4F286387032A,0x70436495B90A9FF,0x1FA13FACF99D35C,0xE6B6C0CED4D3417,0xCA9B96792DAF69F,0x2BE3008803ED4E},{0xA8E43AB78970666,0xD833572FFFC6242,0xE1B21B2730932A0,0xB3BF18FF33310A0,0xC0E1802D4D37949,0x79899943225B88A,0x303F11E15BEE09},{0x677F7595D5570F7,0x29AB98C666C1C82,0x9808AC16643BF5,0x50300568867C5F9,0x42C8BC1648C6333,0x7EBD55EE18FD44A,0xE244FDD4634DD}},
+    {{0x88033A4D2960E13,0x7CAA275A42C9E8E,0x8E45E2B05433571,0xD7BC4FD81A0B515,0xDC7CD7E780A225D,0xBB9C92905C5B4AB,0x3D9C7D3CA77223},{0x483E03CD5575537,0xC7E2D60539C80DF,0x3167A376A0BE86E,0xC0C560FE927113D,0xD1921C42004CEE6,0x27808D592CD0C0B,0xEB158160AC198},{0xBA558D48A5222C5,0xB89F38037C7FE13,0xBED0832CBA41601,0xF94B21331974A5B,0xE1F44D3ADAFA656,0xA4DAC6EC8A88D71,0x2B1CDF31CB321C}},
+    {{0x185828B35DD603C,0x902EB0EC3D8B3AD,0xA64134C5D9B114E,0x3B5719D37B61343,0x11BF56C7C486754,0xCDA21A0605D5227,0x2CF0278E1222F0},{0xEF9B35FA40269A8,0x3BC3E3B8DE4C49C,0xE06B25FA488676,0xA8532D7193EF4B5,0x1ED19FC019EEC66,0xDFE66EF18368790,0x2D189348F3E27E},{0x60A3B9E1A0E1676,0x5F9D24554212F98,0xC958F56C5ED5EA5,0x4A104D3A39AF3F5,0x4E0B1083A17BBA3,0x96FF2CA996CAD8D,0x1AE125106DEDA4}},
+    {{0xC74C0971EFC201,0x30D659842FAFE6A,0xE1F173D3C8E1495,0xDC07B82D5624C6,0x67F0BBE18B922D7,0xE0B8E1440096A3F,0x16DFE9EEE9790B},{0x603980107D4A5EC,0xCF69F80EC485D13,0x565D66AF6247349,0x16CC25575A5509B,0x95BC023946E54A,0xAD45106B3282F2D,0x11663B27EAF31D},{0x5FD8616E688ABBF,0xF501CA99DDCFF2F,0xC7DA8F4F8CE1BD0,0xCCC1F3127459D99,0x85430EB7BCBC5F3,0x7DAB9DB5D086BBF,0x2CC99DC0228010}},
+    {{0x9E4405F760AB897,0xCFCE326DA2DB8A0,0x41B81F78E161D9D,0x41DF1D9B55041DE,0xB3E38ABBBFE534D,0xFDAA88E03B22B0,0xF9908AF30E090},{0x192FFA1FCEB754B,0x349885E840F3740,0xB818820188D07FF,0xAC6DE226DCCEDED,0xBCB8F95E0F7B484,0xA5A01249FC9E60F,0x35E273B14022CE},{0xF8236A4620599DB,0x586687AA9AA78E,0xAB1B920B5451DC0,0xECA455774BA758,0xCD133D44F6177D4,0x5A25B4689B00F77,0x1239E8A64F86D5}}
+};
+/* End of comb table */
 #endif
 
@@ -33,6 +33,75 @@ const BIG_256_13 CURVE_B_ED25519= {0x18A3,0x1ACB,0x1284,0x169B,0x175E,0xC55,0x50
 const BIG_256_13 CURVE_Order_ED25519= {0x13ED,0x7AE,0x697,0x4C6,0x581,0xE6B,0xBDE,0x1BD4,0x1EF9,0xA6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20};
 const BIG_256_13 CURVE_Gx_ED25519= {0x151A,0x192E,0x1823,0xC5A,0xC95,0x13D9,0x1496,0xC12,0xCC7,0x349,0x1717,0x1BAD,0x31F,0x1271,0x1B02,0xA7F,0xD6E,0x169E,0x1A4D,0x42};
 const BIG_256_13 CURVE_Gy_ED25519= {0x658,0x1333,0x1999,0xCCC,0x666,0x1333,0x1999,0xCCC,0x666,0x1333,0x1999,0xCCC,0x666,0x1333,0x1999,0xCCC,0x666,0x1333,0x1999,0xCC};
+/* Fixed base comb table for ECP_genmul - generated by scripts/combtable.py */
+const BIG_256_13 CURVE_Comb_ED25519[64][3]=
+{
+    {{0x151A,0x192E,0x1823,0xC5A,0xC95,0x13D9,0x1496,0xC12,0xCC7,0x349,0x1717,0x1BAD,0x31F,0x1271,0x1B02,0xA7F,0xD6E,0x169E,0x1A4D,0x42},{0x658,0x1333,0x1999,0xCCC,0x666,0x1333,0x1999,0xCCC,0x666,0x1333,0x1999,0xCCC,0x666,0x1333,0x1999,0xCCC,0x666,0x1333,0x1999,0xCC},{0x1DA3,0xDBE,0xCE9,0x1D15,0x16DD,0x97A,0x1D45,0x100E,0x109F,0x907,0x18DF,0x957,0x8E6,0x1527,0x159B,0xECC,0x178B,0x187E,0x1D7,0xCF}},
+    {{0xE0E,0x21E,0x138A,0xB42,0x183C,0x122F,0x175E,0x8A2,0xD8E,0x40,0x19EB,0x1067,0x17D1,0x21D,0x10F4,0x8D,0x1F5A,0x264,0xACE,0x6D},{0x3C9,0x17C5,0xB9A,0x1E8D,0xE5,0x8AB,0x10E1,0xA2C,0x190F,0x14B9,0x7D5,0x1344,0xE8C,0x112F,0x876,0x538,0x923,0xF98,0x1833,0x44},{0x1401,0xB4D,0x155B,0x147E,0xB71,0x1201,0x7DC,0x1938,0x19AC,0x1AEB,0xD04,0x607,0x1087,0x12AF,0x1077,0xD1B,0xB2F,0x1C28,0x629,0x49}},
+    {{0x25C,0x1FC7,0x17F4,0x490,0xAC6,0x443,0x589,0x330,0x398,0x131A,0x120E,0x1DB5,0x743,0x1A57,0x47F,0x11E9,0x292,0x251,0xBA7,0xCF},{0x14D4,0x7AD,0x121E,0x6D0,0x2C,0x182,0x1C90,0x2EC,0x16EC,0x1CF8,0x7BD,0x4D,0x18E6,0x1350,0xE84,0xD35,0x17EE,0xE8B,0x19EC,0x24},{0x41A,0x59D,0x1E9E,0x1211,0xCDF,0x1E25,0xC5B,0x117F,0x735,0x1AE1,0x549,0x1B72,0x183A,0x179B,0x3AF,0x12A2,0x11DD,0x12E5,0x1340,0x54}},
+    {{0x1870,0x64F,0x15F1,0x154C,0x1493,0xAA3,0xF38,0x1832,0x139E,0x8D3,0x83E,0x146A,0xB87,0x12EA,0x1A0C,0x1E28,0x16CF,0x6DA,0xF6A,0x40},{0x112F,0x1190,0x1872,0x1156,0xDF3,0x7F8,0x8BC,0x65D,0x1228,0x267,0x1C5B,0x1AA,0x858,0x75C,0x51C,0x12BC,0xB15,0x13E,0x143A,0x8F},{0x1358,0x1450,0x1D9C,0x1E45,0x5F8,0x3E5,0x1B74,0x3D6,0x15E3,0x38C,0xA58,0xCF8,0x6AC,0xA5D,0x11C8,0x4C1,0x1873,0x6C6,0x1E0F,0x44}},
+    {{0x1233,0x1177,0x100C,0x139,0x1914,0x10D2,0x186F,0x1F27,0x819,0x12E1,0x977,0x25B,0xF7D,0x17BE,0xFF3,0xB0F,0xDE3,0x19F5,0x1F69,0x93},{0x8ED,0x13B6,0xF5,0x43F,0x110D,0x5AE,0x50C,0x1951,0x82E,0x1189,0x1199,0x1324,0x148,0x1637,0x1F80,0x15CD,0x18FE,0xD94,0x1209,0xBE},{0x1D0,0x1F40,0xF3C,0x12A1,0x1641,0x135F,0x24,0x10A0,0x194E,0xD7D,0x11FE,0xE6D,0x508,0x1075,0x10C5,0x7A9,0x1C59,0x1164,0x1715,0xE8}},
+    {{0x123D,0xE5F,0x69F,0x14E8,0x1783,0x213,0x11ED,0x104D,0x599,0x150F,0xA6F,0x1A14,0xC0D,0x1756,0x118A,0xC03,0x1A45,0x1DD3,0x5E5,0x99},{0x1EF4,0xA4B,0x143E,0x4F5,0xC1D,0x15B0,0x1135,0xD2,0x17C,0x1FCA,0x1F5D,0x1A9E,0x1A7F,0x1B84,0x476,0x1B14,0x886,0x1FE1,0x1378,0xA},{0x11D2,0x277,0x122D,0x1DAD,0x1C7C,0x44D,0x11F7,0x28F,0xF92,0x5D,0x1731,0x1FCF,0x994,0x2AD,0x1E0A,0xC09,0x9AA,0x1E88,0xCBB,0x78}},
+    {{0x107,0x872,0x6BD,0xB30,0x1585,0x74A,0xFC7,0x1E77,0x809,0x1C1F,0x41,0x163B,0x194,0x11F7,0x1BA7,0x17A9,0x1CF4,0x142F,0x15A1,0x28},{0x2B8,0x1A03,0xD67,0x989,0x112C,0x191E,0x1EAF,0x8DE,0x82B,0xF84,0xB50,0x1A6D,0x68D,0x732,0x1E1F,0x1AA5,0xB47,0x1F19,0x1158,0x63},{0xD1B,0xC3F,0x1595,0x1A8A,0x10B,0x1272,0x1A6A,0x543,0x1463,0x294,0xEAD,0x13AB,0x1C58,0x1416,0xE6F,0xBC3,0x1D16,0x1D88,0x79D,0x23}},
+    {{0x4C8,0x52C,0xF02,0xFFB,0x13B8,0x5CC,0x1A6,0xF70,0x1AC6,0x1F59,0x13E4,0x109D,0x15CF,0x316,0x190A,0xE36,0x17D7,0xAFC,0x10B8,0xCE},{0x19B4,0x1BD,0xA7F,0x1EB7,0x11E2,0x1249,0x87B,0x1F8C,0x183C,0x1C0B,0x1CE3,0xD15,0x1096,0x16B7,0x5BA,0xE6F,0x9E5,0x1006,0x14C1,0x43},{0x11BF,0xD2,0x6B5,0x1DE8,0x16FB,0x15FA,0x1130,0xDA6,0x10CE,0x1A2F,0x1664,0x1167,0x9B3,0x461,0x458,0x1D5C,0xDF7,0xF67,0x13D6,0x58}},
+    {{0xCBB,0x15E0,0x91A,0xF2F,0x1931,0x1796,0xB79,0x20E,0x81C,0x1960,0x3,0x1065,0x276,0x15EA,0x1776,0xB18,0x1361,0xB68,0x784,0x9A},{0x191A,0x64D,0x1EC4,0x1C3D,0xF44,0x5C2,0x1A29,0xF6B,0x84B,0x21F,0x3E3,0xA01,0x154B,0x289,0x1973,0x6B6,0x1D4E,0x1F24,0x1056,0xDA},{0xD71,0x1417,0x16D5,0x491,0x657,0x400,0xF75,0x1DC,0xBC0,0xC0F,0x1E21,0x85C,0xF57,0x14F7,0xBFF,0x1518,0x1F7F,0x1BCF,0x5E5,0xF5}},
+    {{0x1D15,0x93,0x92,0x429,0xCD4,0xA19,0x52F,0xE58,0xA61,0x461,0x18BB,0x9F1,0x452,0x11CA,0x16FB,0xCFB,0x17A8,0x12D3,0x16EB,0x96},{0x17CB,0x4D3,0x1788,0x771,0xD92,0x7D0,0xE30,0x14AF,0xECB,0x5B5,0x10BB,0x1CCE,0x580,0x1AD2,0x661,0xE24,0x1384,0x1705,0x51D,0xE7},{0x3F8,0x763,0x1296,0x7C0,0xFA7,0x100E,0x10DF,0x1498,0x1929,0x887,0x44B,0x393,0x1602,0x1EAF,0x17DD,0xB71,0x13AE,0xAD5,0x1022,0x1C}},
+    {{0x8F9,0x766,0x1686,0xCFC,0x11F1,0x1D2F,0x1CE6,0x10F8,0x1AB,0xD73,0x153C,0x1105,0x759,0x1C2D,0x140,0x49E,0xBE6,0x14F7,0x1807,0x51},{0x8C1,0xC53,0x829,0xD05,0x7B7,0xF15,0xD91,0x1ED3,0x1B4,0xE9D,0x123,0x16E2,0x1C1A,0x9D3,0xD8A,0x853,0x89,0x1904,0x8FB,0x69},{0x1BE3,0x1CDE,0x1993,0x1034,0x85C,0x1D10,0x1131,0x50E,0x1D56,0x1255,0x91D,0x1C,0xA38,0x982,0x523,0x1D44,0x1B6E,0x1B9,0x4E7,0x5A}},
+    {{0x1CDF,0x34F,0x8CA,0x167E,0x1F85,0x121D,0xCDC,0x3BE,0x2D5,0x359,0x634,0x1951,0x1CF6,0x37F,0xF84,0x1BE2,0x1B9,0x866,0xFEA,0x67},{0x1D9,0x16D4,0x13EC,0x1B04,0x1439,0x4C0,0xBC4,0x3A,0xCEF,0xFA5,0x1F4B,0x1202,0x1F10,0x12FF,0x167E,0x195C,0x327,0x6DB,0xC48,0xA7},{0x1CAB,0xECA,0x100A,0x2AB,0xAE9,0x16E4,0xB8F,0xA3,0x1AE1,0x5AD,0x1083,0x172E,0x8E7,0x979,0x1056,0x114F,0x1DC6,0x131F,0x16B9,0x8D}},
+    {{0xC99,0x886,0x1284,0xE16,0x94F,0x163,0x888,0x177B,0xCE2,0x179B,0xECA,0x194D,0x82C,0x17FB,0x1C45,0x1590,0x1D6,0x7CB,0x1669,0xCE},{0xF35,0x7C5,0x187B,0x87E,0x13CA,0xB31,0x16F8,0x4C0,0x11A,0x588,0xDB5,0x0,0x116,0xC89,0x1EC9,0x898,0xA5F,0x16E,0x1B1F,0xFC},{0xB49,0x1913,0xCF1,0xB88,0xE26,0x11C2,0x154D,0x534,0x1D73,0x11A9,0x112F,0xA0C,0x1714,0xE32,0xB,0x4E6,0x372,0xDD3,0x1013,0xCA}},
+    {{0x267,0xF40,0xA6B,0x869,0x1F0D,0x8A,0x1EAA,0x9B8,0x1487,0xF54,0x19DD,0x899,0x49,0x1487,0x1E1D,0xA3C,0x1091,0x1818,0xFB1,0xAD},{0x1B32,0x437,0xCFB,0x1CD6,0x1512,0x415,0x13EB,0xE0D,0x1E47,0xE73,0x301,0x6E2,0xB4F,0x132B,0x1372,0xF19,0x1507,0xE83,0xCB7,0xD5},{0xC,0x168B,0x12E,0x1FC9,0x1972,0x133C,0xD7E,0x114A,0xD79,0xA4D,0x182A,0x1281,0x50D,0x7B9,0xF8A,0x1ACB,0x13C2,0xAB3,0xC93,0xDD}},
+    {{0x2BC,0x13E4,0x14C2,0x17AC,0x420,0x1468,0x17AC,0x14F6,0x1AE0,0x182E,0x1158,0x53,0x17A,0x19D4,0x16B7,0x10CF,0xC60,0x1EE1,0xFBE,0x97},{0x107,0xA9C,0x1A12,0x1C7E,0x1040,0x104A,0x1C22,0x1C20,0x1547,0x1D61,0x1D3D,0x187C,0x5DC,0x8E7,0x5E7,0x5B9,0x1C0C,0x644,0xE17,0xDD},{0x10E4,0x148C,0x1C00,0x1EF8,0x256,0x495,0x5F1,0x414,0x1090,0xE04,0x1A4C,0x1DCC,0x36C,0xCD4,0x163D,0x976,0x16E5,0x10B6,0x37D,0x3D}},
+    {{0xFC6,0x5CF,0xAF0,0x1044,0x11E0,0x1838,0x16CD,0x1386,0x17A,0x490,0x691,0x1ED,0x158B,0xCA,0xA6F,0x1DA0,0x1C2D,0x9A3,0x124A,0x88},{0x245,0x10EB,0x1FCB,0x1855,0x211,0x12D2,0x15EC,0x1181,0x1915,0x1FE1,0x1F23,0x1B4A,0x11E7,0x1192,0x1916,0x157A,0xBBD,0x162E,0x1E17,0xEE},{0x8A9,0x1427,0x2E0,0x8D2,0x1565,0x1123,0x80F,0x19B4,0x15D6,0xEC4,0x2A7,0x1970,0xB12,0x275,0x1597,0xFBD,0xBFF,0x168D,0x858,0xED}},
+    {{0x202,0x76D,0x3FD,0x16D7,0x13E0,0x1AF5,0x1468,0xFDA,0x18DB,0x1003,0x2A5,0x941,0xCFB,0x5B0,0x1751,0x1F3A,0x1F2D,0xC45,0x8AF,0xC4},{0x1313,0x1722,0x15E0,0x1DF4,0x8F1,0x1583,0xA40,0x117,0x10B6,0x1AA0,0x1F13,0xC36,0xED2,0x15ED,0x1775,0x1A04,0xA4E,0x1A17,0x96E,0x6},{0x859,0x13A0,0x1A6D,0x1B25,0x2DF,0x1FC3,0x1312,0x1D3,0xABE,0x1D8,0x1158,0x12,0xE64,0xCC0,0xB1E,0x15C1,0x7D3,0xF16,0x2C2,0xC5}},
+    {{0x597,0x1EDD,0xB62,0x554,0x1114,0x1904,0xE4F,0x1B37,0x406,0xA74,0xA04,0xB41,0x2B2,0xFD3,0x12B9,0x1698,0x84C,0x1D5E,0xEF1,0x4},{0x9EE,0x194E,0x17C3,0xA23,0xED8,0x6E7,0x1188,0x11E5,0x194B,0x827,0x1BA,0x1AE4,0x371,0x810,0x1325,0x1D62,0x19EC,0x1D39,0xAE5,0x9A},{0x139A,0xA2,0xACB,0x1641,0x130F,0x1C05,0x1601,0x1137,0x2B4,0x1E6B,0xEDC,0x1ADB,0x88,0x128D,0x1E5,0xD09,0x17A4,0xDEE,0x1893,0x57}},
+    {{0x1467,0x1931,0x38C,0xEC8,0x800,0x86C,0x13A8,0x14D9,0x8CA,0x1965,0x1877,0x1514,0x149C,0xD45,0x716,0x808,0x1B5C,0x12F6,0xA81,0x26},{0x1E2F,0xEBE,0xF87,0xBF4,0x1986,0x752,0x7FA,0x1B86,0x10B0,0xD9C,0x13F4,0xBCB,0x17B8,0x16B5,0x1D8,0x1EF0,0x1532,0x1851,0x13BD,0xA6},{0x1407,0x1767,0x39C,0x4B6,0x194F,0x14C7,0x170D,0x15E9,0x25C,0xFDC,0x1E3D,0xB8B,0xE67,0x14AB,0x1754,0xB4,0x24E,0x1CC4,0x17A7,0x27}},
+    {{0x1169,0x9CE,0x1EEF,0x1C67,0xC4B,0xE78,0x3BD,0xADE,0x1C68,0x1CBF,0x1211,0xCE5,0x53B,0x552,0x1660,0x1694,0x1137,0x167B,0x1419,0xDA},{0x417,0x10CD,0x454,0x68E,0x15CB,0x14AD,0x8BA,0x1684,0x1200,0x1FCA,0x615,0x1D70,0x15AB,0x15F1,0x20E,0x10F9,0xA0A,0x6C1,0xEE3,0xA9},{0x1C70,0x55B,0x161A,0x11D5,0x38C,0xA51,0x33E,0x1B75,0x1502,0x1854,0x1BC7,0x151C,0x7E2,0xF20,0x1872,0x1FCC,0x10E7,0x1709,0x450,0xC1}},
+    {{0x2CD,0x1826,0x71E,0x485,0x1507,0x593,0x668,0x1F7,0x31,0x1B1E,0x2A3,0x974,0x15A7,0xC10,0x11FD,0xD26,0x1B08,0x1BE6,0x1FE3,0x6B},{0xB8A,0x1674,0xEA9,0x939,0x10FC,0x1454,0x1F86,0x2FB,0x1B57,0x1A70,0x181A,0x776,0x695,0x14F4,0x1551,0xBE0,0x1115,0x343,0x1873,0xA1},{0x3D7,0x187,0xCE3,0x1513,0x1885,0x14C5,0x117F,0x8A9,0x1C3B,0x19FF,0xC6D,0xF6F,0xDD8,0x10BD,0x662,0x52A,0x11B1,0x13F6,0x302,0x66}},
+    {{0x213,0x1170,0x298,0x424,0x12AF,0x2D0,0x11CE,0xC92,0x12BC,0xA00,0xA39,0x1506,0x1079,0x743,0x1DAD,0x164D,0x1F4B,0xE0B,0x18D9,0xD8},{0x782,0x4A6,0x795,0x1293,0x1030,0x9F5,0x2E3,0x54C,0x1C33,0x1046,0x1B23,0xD53,0x5,0x1905,0x320,0x152D,0x13D1,0x1D4E,0x15C0,0x38},{0x450,0x1C78,0x1722,0x424,0x1CBF,0xCCF,0xD26,0x68A,0x1848,0x1160,0x11DC,0x1A6D,0xBDF,0x145B,0x3FF,0x655,0xE23,0xDC0,0x1FD7,0x72}},
+    {{0x7D1,0x1EC4,0x19D6,0x898,0x13B9,0x10C7,0x307,0x309,0x1DE5,0x1A3C,0x1AA0,0x1CF9,0x141B,0x1800,0x12E0,0x1AA5,0xB31,0x528,0xE06,0xD1},{0x826,0x9CC,0x17FB,0x11C9,0x1472,0xE3B,0x16B7,0xAA6,0x596,0x1CB4,0x3D0,0x6DB,0xD75,0x173A,0x8A3,0xCD6,0x7,0x19F6,0x2C8,0x3D},{0x1B42,0x4CA,0x267,0xF2A,0xF4A,0x614,0x1563,0x1B50,0x8EF,0xDA6,0x17C3,0x1232,0x860,0x4AF,0x144E,0x1C53,0x1BA8,0xBA6,0x1C93,0xEC}},
+    {{0x2A9,0xC9B,0xFA1,0x7D1,0x4A7,0x1807,0x16D6,0x1285,0xA50,0x169D,0x1AAC,0x53B,0x1766,0x39D,0x18D0,0x5A9,0x870,0xCD6,0x1985,0xD6},{0x16C5,0x654,0x8B2,0x1C34,0x15FE,0x18F3,0x980,0x1064,0x308,0xE73,0xCAE,0x1088,0x5D5,0xD9D,0x1392,0x1AA0,0x18EF,0x1F79,0x1752,0x33},{0x1DC3,0x1E27,0x15B9,0x6,0x1A35,0x1E59,0x1D3B,0x1ECC,0x1C9B,0x15F9,0x1226,0x118,0xA01,0x9A5,0x1538,0x639,0xDC,0x1667,0x1FEE,0xCC}},
+    {{0x15D0,0x1ABB,0x1ACE,0x8B9,0x561,0x4A8,0x13F,0x1717,0x31E,0x1FA5,0x1D6A,0x153,0x152,0x14A,0x1B6A,0x392,0x199B,0x1C62,0x1D3F,0xA3},{0x1AC1,0x1C31,0xC35,0x80D,0x17F8,0x1E8D,0x1F52,0xF00,0xE80,0x589,0x1BAD,0x10A5,0xEE3,0x1CCD,0xFDB,0x83E,0x146E,0xC46,0xB25,0x6B},{0x911,0x6B6,0x1C2,0x16E4,0x8FD,0x1A58,0x5D,0xAB2,0x31,0x1864,0x19BF,0x44A,0x71B,0x4A3,0xBEE,0x1E5D,0x1A58,0x1AA6,0x80B,0x9B}},
+    {{0x1741,0xDFC,0x1A9C,0x536,0x1EC7,0x1C79,0x19AF,0x1DC,0x96C,0x1D2B,0x1A0B,0x10A4,0x161D,0x40,0x1D8F,0x14C7,0x133C,0x1480,0x379,0xAD},{0x19E8,0x1981,0x8DD,0x1B62,0x11BF,0x1F1E,0x15D0,0xFE9,0x1BAE,0x1D2,0x196D,0x141C,0x433,0xE6E,0x1D07,0x1CC8,0x12E8,0x104C,0x1208,0x98},{0x18EF,0x1854,0x1105,0x1FB7,0x1006,0xCF4,0x184,0x49,0x60E,0x1DA1,0xC99,0x193C,0x1B90,0x1DD9,0x1E1D,0xE7E,0x175E,0x175F,0x43D,0x81}},
+    {{0x1785,0xCFA,0x122D,0x40D,0x19FB,0x1FA3,0xBC0,0x1CDF,0x11A9,0x1CDD,0x59B,0x12FB,0x1A4F,0x4B2,0x9D4,0x14C6,0x1F6C,0x1A3B,0xBD2,0x9E},{0x934,0x1ACF,0x764,0x4D,0x548,0x679,0x8F3,0x4B8,0x385,0xB57,0x18B0,0xE08,0x8A,0x1699,0x685,0x1087,0x1B8A,0x1C39,0x457,0x26},{0x6A6,0x1DA5,0x76E,0xE6C,0x10FD,0x132C,0x1056,0xDDE,0x1295,0x19AC,0x107C,0x1012,0xF6C,0x14B3,0x10C6,0x5E2,0x1C22,0x1F8D,0xB1A,0xC0}},
+    {{0x3DA,0x11A0,0x1119,0x619,0x6E7,0x125E,0x6D4,0xE1F,0x1281,0x74A,0x1F3D,0x1A46,0x9FD,0x35C,0x17BD,0x443,0x1D55,0x38B,0x10B1,0x66},{0x17C5,0x1B49,0xA16,0x1B8D,0xA49,0x10FE,0x1B9,0x8CD,0x17EA,0x18E6,0x1499,0x14FB,0xF1F,0xA66,0x1A35,0x6A6,0xC9,0x6F8,0x19DB,0xA0},{0x18BB,0xA85,0x1EBF,0x1568,0x1923,0x6E9,0xE68,0x6E8,0x1E28,0x96A,0x1197,0x20,0x12C0,0x182,0x126F,0x9FB,0xB4A,0x508,0xF10,0x5A}},
+    {{0xCCB,0xF66,0xE3C,0x161F,0x99F,0xFB7,0x1D23,0xA83,0xFD0,0xFD1,0x1566,0x1511,0xFDB,0x1838,0x2A4,0x9DA,0x13B6,0x4B,0xA90,0x50},{0x686,0x1542,0x149E,0xC5B,0x7F5,0xA86,0x30C,0x1A3C,0xEA0,0xCD6,0xFF3,0x158D,0x1E01,0xE4F,0xD65,0x1752,0xEDD,0xEC6,0x2A5,0xB5},{0x188A,0x7B4,0x1B62,0x97B,0x19C8,0x5FD,0x8F0,0x1D3B,0x1346,0x1D78,0x187,0x61D,0x7B7,0xA83,0xF8A,0x1D61,0x8D4,0x1F3E,0x1F0B,0xF9}},
+    {{0x1BD3,0x14BE,0x7B4,0x53B,0x120C,0x1BB2,0x618,0x11D0,0x1B33,0xA95,0x1562,0x13E1,0xC0A,0x12DE,0x150F,0x1841,0x1F15,0x7AC,0xBD2,0xF5},{0xD6E,0xD2C,0x1AFC,0x1312,0x1AC6,0x9A6,0x382,0x191D,0xF0A,0x1C54,0xB78,0x1FCC,0x63B,0xA4E,0x10D8,0xC71,0x1E76,0x1354,0x196E,0x4E},{0x88,0xB56,0x156C,0x10D,0xFDD,0xBA1,0x9BC,0x319,0xD11,0x1D9C,0xE16,0x783,0x14FA,0x1955,0x6DF,0x1B44,0xECC,0x1BAB,0x1AD,0x7D}},
+    {{0x9B4,0x1119,0x6EA,0x1B2F,0x1BD4,0x1E1C,0x127D,0x99A,0x145F,0x99B,0x564,0x1237,0x558,0xFC6,0x1739,0x86A,0x1D2B,0xC7D,0xD92,0x6},{0xBD8,0xEAE,0x1F17,0x114,0xA1E,0x6CD,0x1FD2,0xA5F,0xFD,0x1D7F,0x427,0xD36,0x379,0x58E,0x1F91,0x139C,0x1627,0x5B0,0xCCE,0xCA},{0x1F4B,0xAC9,0x1752,0xE31,0xE8F,0x11EF,0x182B,0x5E7,0xDC9,0x1E1A,0x921,0x1420,0x19F0,0x17C8,0x44E,0x87,0x96C,0x10B,0x1F83,0x5B}},
+    {{0xD9A,0xA12,0x174A,0x1748,0x6F6,0x554,0x536,0xF72,0x1FD2,0x19B6,0x7B,0xA44,0x1CCC,0x15C6,0x1563,0x1667,0x1C50,0x1C5F,0x5A5,0x67},{0x1393,0x39,0x12B2,0x194,0x1B1D,0x1ED5,0x1F76,0xF94,0x1EAC,0x1A29,0x1332,0x20F,0x1BF9,0xE9A,0x172E,0x24F,0x113C,0x1AC8,0x13C4,0xB9},{0x649,0x758,0x1B6C,0x1E61,0x1788,0x1CDF,0x1D02,0x702,0x187B,0xD14,0x146,0x1920,0x1384,0xE2B,0x68A,0x1497,0x1ED5,0x6E2,0x1AE1,0xB8}},
+    {{0x824,0x5BF,0xB98,0x8F,0x1FC8,0x11F2,0xB9C,0x1938,0x685,0x4C7,0xA68,0x29C,0x184E,0x169C,0x1254,0x1E65,0x1C45,0x1FF9,0x9EB,0x98},{0x66B,0x1FAD,0x452,0x157A,0x5BB,0x24F,0x693,0x3CA,0x10BE,0x1486,0x70E,0xD85,0xB62,0x188F,0x1657,0x190F,0x126D,0xF32,0xB26,0xBE},{0x138A,0x1789,0x1251,0xE63,0x1E9E,0x16D4,0x198E,0x104C,0x1864,0x10A3,0x12DA,0xF24,0x0,0x10AB,0x1F53,0xC05,0xBF4,0x7E8,0x859,0xB}},
+    {{0x85,0x1127,0xD0C,0x1FA3,0x1FCE,0x1134,0x1EFE,0xE51,0x152C,0x7B4,0x1BB9,0xFA,0x1F79,0xAB,0x1E82,0x1B5E,0x13EF,0x1839,0x1AF8,0xF0},{0x736,0x11F1,0x4B1,0x160E,0x4EA,0x14DF,0xE75,0x17D6,0x1C08,0x1953,0x211,0x9FA,0xCDD,0x1387,0xCD0,0x130B,0xF34,0x1BB9,0xE97,0xCA},{0x4C8,0xCFB,0x5DC,0x9D0,0xC,0x1EB7,0x1EEA,0xAAA,0x4EE,0x4B6,0x163B,0x17A7,0x9A5,0x833,0xC36,0x7D1,0xD31,0x169A,0x11CF,0x25}},
+    {{0x7C7,0xC9E,0x27C,0xB95,0x1312,0xCA5,0x1D5B,0x1990,0x4BA,0x1D75,0x1C26,0x1709,0xA58,0x1E9D,0x128B,0x12A3,0x1833,0x157D,0x1061,0x13},{0x62F,0x1BD8,0xD5F,0x934,0x11A3,0x7F8,0x1B55,0xD77,0x82A,0x1015,0x1287,0x130C,0x1B14,0x34A,0xE4D,0x166A,0x27,0x3A3,0xDEC,0xC2},{0x1362,0x1477,0x1043,0x1AC4,0x18B1,0x1691,0xE22,0x87E,0x83B,0x1177,0x82B,0x718,0x6DE,0x102A,0xBB7,0x7B1,0x1F26,0x69B,0xB1E,0xAE}},
+    {{0xA13,0x175,0x1C13,0x1045,0x16CB,0xCD9,0xD34,0xD7D,0x4D0,0x635,0x1767,0x1791,0x1815,0x4AB,0xF7E,0x1526,0x968,0x402,0x1FB9,0x43},{0x1700,0x480,0x1A4C,0x1A7,0x1306,0x118,0x5CB,0xF51,0x536,0xDED,0xCE,0x10B,0x1A15,0x162E,0x1505,0x16A3,0x72C,0x1A00,0x2DD,0xA0},{0x1F8,0xD9C,0x138,0x14B,0xDD8,0xBF8,0x81E,0x2DC,0x671,0x1F52,0x52A,0xBD1,0x1EF0,0x713,0x1A2,0x11FE,0xC18,0x7B4,0x162,0x33}},
+    {{0xF17,0x96A,0x8AC,0x13C7,0x1491,0xCAA,0x1CF2,0x1CB2,0x10C,0x76D,0x127A,0x1913,0x365,0x9F0,0xAE0,0x1C10,0xEE4,0x1CB7,0xB87,0x94},{0xFC4,0x423,0xCAB,0x970,0x44D,0x1332,0xCD6,0xA2E,0x29E,0x6E1,0x36A,0x1FBE,0x188B,0xA88,0xE32,0xB8B,0xE18,0x411,0xFC9,0xD8},{0x1678,0x3CB,0x14D3,0x165,0x152B,0x1C20,0x1691,0x16B7,0x5A2,0xF23,0x892,0x190,0xF12,0xDB6,0x6CA,0x1A4C,0xF8D,0x1667,0x17AE,0x5B}},
+    {{0x1464,0x761,0x7B0,0x289,0xAF4,0x1B50,0x1414,0x1D4D,0x530,0xA31,0x90D,0xD3A,0x1BD8,0x18CA,0x19AB,0x1AE8,0x1494,0x1FCA,0xF4E,0xBB},{0x1B77,0x1F12,0x11CD,0x19C3,0x137,0xFC6,0xDEE,0x54F,0x2CE,0xD1A,0xAAE,0x1132,0xC0A,0x1E6C,0x218,0x1F76,0x16E9,0x1BBB,0x1D7D,0xAD},{0x569,0x1179,0xE8B,0x8C8,0x739,0x5DD,0x2CD,0x1061,0x1D43,0x35D,0x17D8,0x370,0xA2D,0x20F,0x1490,0x1782,0x1B02,0x99D,0x113D,0xB0}},
+    {{0x1685,0x176A,0x171D,0x175,0x1937,0xF08,0x149D,0x35F,0xE01,0x1DAC,0x73A,0x12EE,0x17DF,0x196A,0x3C7,0x1A78,0x575,0x1022,0xDC0,0x96},{0x1820,0x144D,0xB34,0x4F,0x482,0x1149,0x1F33,0x1F5,0xDCB,0x1F1B,0x1AAB,0xAC0,0x80E,0x13D,0x14BD,0x65E,0xCF3,0x285,0xCCF,0xA8},{0x15E8,0xA9,0x168F,0x14E3,0x3D4,0xA76,0x116,0x1508,0x1023,0x19E7,0x1653,0x8,0x1FB8,0x53C,0x1229,0x103B,0x60F,0x6F9,0x73B,0x3A}},
+    {{0x13DF,0xA35,0x1B84,0xE26,0x28B,0xB27,0x775,0x159E,0x18AD,0x61A,0x23E,0x1D29,0x65,0x10CC,0xB92,0x1F6D,0x90A,0x12EA,0x1FA2,0xEF},{0x246,0xFA8,0xBE9,0xB8B,0x6D7,0x2DD,0x8D5,0x1FC1,0xCC9,0x915,0x364,0xA43,0x1339,0x1,0x1A2B,0x1E62,0x39,0x180F,0x14C3,0x78},{0xD2C,0x1A95,0x186,0x1ACD,0xFE2,0x483,0x1600,0x1F52,0x18DC,0x1D6,0x1AD6,0x1F9D,0x63F,0x1279,0x1E14,0x103,0x1726,0xC63,0x8B1,0x4B}},
+    {{0x31,0x100A,0x1594,0x1728,0x285,0x1545,0x194A,0x1B1D,0x50A,0xC68,0xD73,0x1D55,0x382,0x1BD5,0x1E1E,0x57E,0x4FB,0x658,0xF61,0xA8},{0xF20,0x12CF,0x937,0x657,0x6E9,0x1617,0x90B,0x1A93,0x142D,0x237,0x9D6,0x1056,0x18F1,0x1EC1,0x19A4,0x1A93,0x163E,0xE2D,0x163F,0x6},{0x220,0x1CC1,0x1280,0xE4C,0x1E5C,0xAD3,0x1C63,0x13BB,0x15E2,0x1352,0x323,0x19C0,0xA73,0xD03,0x10F2,0xE4D,0x1F4B,0x1661,0x1695,0x8}},
+    {{0x1EA1,0x1B02,0x1ED3,0x1C3,0x16A7,0xA8F,0x53D,0x1681,0x1395,0x11B1,0x71,0x1003,0x1061,0x1392,0x1290,0x496,0x6A4,0x1C,0xB13,0x5},{0x1877,0x1EF1,0x1835,0xE90,0xF00,0x143A,0x13FE,0x1CAA,0x330,0x1FFA,0x1EDD,0xE43,0xFF0,0x3D9,0x11AC,0x1CBC,0x1C30,0xCF,0x8DB,0x3},{0x480,0x5F,0x694,0xAAA,0x1828,0x1401,0x130B,0xE36,0x19E7,0xA3A,0x2BE,0xECE,0x9A6,0x1686,0x4F6,0x68D,0x1E34,0x498,0x1385,0x46}},
+    {{0x19E9,0x1501,0x16D8,0x74D,0xF3B,0x801,0xE62,0x794,0x188C,0xD1B,0x13D6,0x85C,0xF4,0x296,0x1854,0x1FD3,0x240,0x133D,0xB75,0x5A},{0xDD1,0x12AA,0x541,0x10F2,0x176E,0x1C6D,0x12E0,0x22B,0xEFD,0xB25,0x323,0x137E,0x1463,0x1D36,0x89E,0x1B0A,0x19C5,0xEDB,0x1EF6,0x6E},{0x1981,0x731,0x12CC,0x18,0x1D46,0x1E6,0xD64,0xCB7,0x1763,0x654,0x124E,0x152E,0xD7E,0xD35,0x12C2,0xDC0,0xE00,0x90D,0x1E65,0x98}},
+    {{0x513,0x166,0x14EB,0x507,0x17C8,0x1B94,0x1417,0x14,0x1FB6,0xC30,0x1D15,0x1FAD,0x10C2,0x84C,0xD97,0xD73,0xD46,0x218,0x5BE,0x50},{0x1F1E,0x5A3,0x1F9D,0x1362,0x4F8,0xD0C,0x12AD,0xCC,0x5DF,0x43A,0x1AB8,0x18C,0x10EF,0x1264,0xD4,0x1D47,0x1430,0x5A2,0x14B1,0xA8},{0x1752,0x1D9A,0x792,0x1807,0x23E,0x152A,0x21D,0x1C3D,0x1800,0x12C9,0x1A80,0x1879,0x1758,0x72D,0xEC9,0x110D,0x1D0D,0x3AF,0x128F,0x8C}},
+    {{0x1EF3,0x125D,0x1BEE,0x8D4,0x1ADC,0xD00,0x6F3,0x17F7,0x1F47,0xF23,0xFEC,0xAC1,0x1850,0xAC3,0x13EC,0x18B5,0x6A2,0x1378,0xBAE,0x39},{0x5B8,0xC6C,0x1EFA,0xAD4,0x1396,0xACE,0x1AEF,0x1018,0x1EC1,0xD48,0x1714,0x44B,0xF54,0x7E7,0x1D28,0xEAE,0x7EA,0x8F,0x1F37,0xCB},{0x1749,0x1344,0x4EE,0xDE7,0x1799,0x395,0x17CC,0x1D3A,0x9CD,0xC46,0x13C9,0xDA2,0x1D4B,0x193,0xE0B,0x6F6,0xFCC,0x9D2,0x1D80,0x42}},
+    {{0x5C7,0x9AD,0x1546,0x1EB,0xAC5,0x646,0xD32,0x4A,0x19E9,0x1E35,0x259,0x1BA,0xC72,0x275,0x1323,0x1BDE,0x1F5A,0xA95,0x30A,0xC},{0x1F5B,0xA13,0x1081,0x1096,0x134A,0x1523,0x72,0xE36,0xCC5,0x1959,0xF77,0x3F,0x1DBB,0x329,0x5DF,0xA49,0x482,0xA4A,0x1BD7,0x21},{0x4B6,0x1E74,0x1033,0x11B6,0xE7E,0x11E0,0x192C,0x1F3,0x1631,0x14E3,0x1FAD,0x8CB,0x15EA,0x1E17,0x123C,0xDB3,0x17D3,0x1A0,0xCFF,0xDB}},
+    {{0xC00,0xF8,0xD1C,0xA6F,0x45A,0x496,0x5BA,0x122B,0xE35,0xC81,0x147E,0xEC,0x1DCC,0x10AF,0x145A,0x1D2A,0x3F4,0xC49,0x105A,0xBA},{0x1C11,0x17C5,0x3B,0xC8F,0x1C53,0x83B,0x1750,0x64F,0xAEE,0xF24,0x63F,0x1705,0xAF0,0xD6F,0x2FB,0x1E5D,0x8E9,0xA51,0x49E,0x5B},{0xB66,0xB48,0x101B,0x1752,0x34D,0x1FE9,0x1153,0x110A,0x1821,0xFC3,0x1C76,0x146B,0x12ED,0x170F,0x177C,0xB90,0x1278,0x81F,0x1754,0x6}},
+    {{0x1FE9,0x1EE4,0x104F,0x913,0x1744,0x1213,0x307,0x1FF2,0x74A,0x11E5,0x137B,0x1BE9,0x251,0x1FCA,0x198D,0x902,0x4BC,0xFF3,0x1125,0x19},{0x198B,0x13A8,0xDB,0x1C0C,0x16A5,0xD37,0xE30,0x1A7C,0x1228,0xF07,0x1EAE,0x1286,0x1E66,0x69,0x1BFB,0x12EF,0xCAB,0x13DB,0x4E3,0x84},{0x189,0x1DBF,0x1936,0x18C9,0x31C,0xC1E,0x189B,0x153,0x16D7,0x1ADA,0x41F,0x14E2,0x1159,0x426,0x1E08,0x420,0x633,0x6D3,0x2B2,0x7A}},
+    {{0x128D,0x1ED6,0x1131,0x15AC,0xDB7,0x1E93,0x75,0x1C37,0x1DDE,0xBD4,0x5DF,0x18FC,0x371,0x682,0x10B6,0xBCF,0x1818,0x18F1,0x11EB,0x37},{0x833,0x18A,0x1640,0x5EC,0x1CAF,0x1387,0xC6C,0x24C,0x27E,0x8E8,0x1012,0x12BB,0x1877,0xF77,0x1DE9,0x3E5,0x1566,0xEC2,0x1642,0xC3},{0x2C7,0x11B6,0x859,0x108A,0x51B,0x1F7C,0x1B79,0x6CA,0x18F2,0xCDD,0x3EF,0x163E,0xDE4,0x1B32,0x1332,0x1F48,0x14B8,0x1C02,0xD02,0x34}},
+    {{0x354,0x14,0x86,0x1327,0x79,0x13E8,0x36A,0xEBB,0x1A89,0xF97,0x8F6,0x1771,0x15A6,0x141A,0xF48,0xB2D,0x18C2,0x122F,0xF38,0xD},{0x65,0x51E,0x1462,0x192A,0x96F,0x1C4A,0x17A1,0x1161,0x941,0x616,0x1216,0xEA,0x12F1,0x1566,0x324,0xDB4,0x1D0F,0x4E6,0x9A6,0x7A},{0xB17,0x15CA,0x1AE3,0x16CB,0xDF4,0x1363,0x8A5,0x18,0x1C9C,0x8D7,0x190B,0x86B,0x938,0x933,0x98,0x15E2,0x653,0x1307,0x7D8,0xF5}},
+    {{0x62F,0x194B,0x106,0x1B12,0x7EB,0x1777,0x1F75,0x1D6,0x10EF,0x65,0x1F2D,0x4FF,0xC9C,0x1E1D,0x1D90,0x8BD,0xF44,0x455,0x1964,0xEC},{0xCA1,0x1B82,0x392,0x740,0x1708,0x1209,0x2BE,0x717,0x219,0xB29,0xD02,0x1E05,0x64,0xBFC,0x1B38,0x8A8,0x10DA,0x13E2,0x1462,0x9D},{0x13BB,0xF60,0x10EE,0xA86,0x683,0x352,0x6FE,0x1954,0x1D2,0x483,0xC6C,0x5B3,0x1A38,0x600,0x1372,0x17B9,0xD4D,0x1879,0xE73,0xD7}},
+    {{0x14F7,0xB6,0x139B,0x1B2A,0x15D9,0x887,0x8AE,0x1FCA,0x145C,0x729,0x198C,0x1749,0x1F33,0x1A79,0x420,0x955,0x15A0,0x1B75,0x26C,0x14},{0x1926,0x1AF6,0x3E8,0x5D6,0xF3A,0x1D90,0x10DC,0x1C9A,0xE9E,0x836,0x14CF,0x1DDA,0x12BA,0x1B75,0x892,0x221,0xFA3,0x1EB0,0x91F,0x75},{0x53,0x1826,0x131A,0x763,0xFE2,0x15C1,0xCB8,0x93E,0x699,0x179,0x164,0x1FFC,0x842,0xFC0,0x29A,0x11AB,0x1464,0x1DA5,0x1577,0x77}},
+    {{0x135E,0x89B,0x1144,0x19AA,0x919,0x1E90,0x9B9,0x1A57,0x162,0x105D,0x1261,0x1EAC,0x1A8B,0x45A,0xA03,0xDAD,0x38E,0x11BB,0x1C73,0x38},{0x6CB,0xF20,0x184A,0x11FD,0xE3E,0xB96,0x11EA,0x7E8,0xD18,0x1EA0,0x13ED,0x1541,0xD79,0x1EDD,0x1490,0x1659,0x3,0xE1,0x33,0xF1},{0x12AC,0x2C1,0xBBF,0x161D,0x1782,0xF00,0x1771,0x1807,0x395,0x9A7,0xE99,0x1887,0x425,0x1003,0x196E,0xA30,0x1464,0x123B,0xC2,0xF2}},
+    {{0x8D6,0x65E,0x1FDD,0x173C,0x1931,0x1658,0x1214,0x88D,0xE79,0x890,0x13F9,0xB85,0xF89,0x1D41,0x1625,0x5EF,0x1DF,0x1426,0x181E,0x78},{0xA68,0x11E7,0x1AE,0xF35,0xEA7,0x306,0xC68,0x142E,0x7E0,0x24C,0x1B86,0x13B7,0xB48,0x25D,0x88E,0x347,0x994,0x1688,0x1462,0x68},{0x145D,0x11B9,0x1B27,0x1078,0x1158,0x1398,0x242,0x708,0x1D2A,0x1752,0xCE5,0x1307,0x1DDA,0x168D,0xFC3,0xE5E,0x12E5,0xAF1,0x9C1,0xE}},
+    {{0xDA0,0x1DF1,0x5FF,0x15E8,0x310,0x11CE,0x18E3,0xCD4,0x17FC,0x9D0,0x1DFC,0x2DD,0xDD6,0x1C9C,0x18FF,0x178C,0x0,0x681,0x6DB,0x11},{0xB88,0x1467,0x1C4F,0x102D,0x1E78,0x951,0x16EC,0x14F9,0xBE4,0x121E,0x195F,0x394,0xFD1,0x1C6F,0x2D0,0x1BFB,0xA36,0x1035,0x1BDC,0xCD},{0xD28,0xD3B,0xDD3,0x8F0,0x1AFA,0x1885,0x9DE,0x534,0x1A0D,0x1ACD,0x1681,0x17C7,0x1091,0x1879,0xD1D,0x27F,0x1116,0x2FA,0xB16,0x1A}},
+    {{0x1FDB,0x164,0x15BF,0x1D65,0x2E1,0x1D29,0x1C19,0x5B0,0x1286,0x95B,0x41B,0xCEF,0x1434,0x1D5A,0x3E1,0xFAC,0x91,0xADB,0x7A7,0xF},{0x797,0x63C,0x701,0x270,0x390,0x3AC,0xE17,0x1F94,0x64,0xB20,0x889,0x17F,0x945,0x1365,0x14C4,0x148,0x1224,0xA8E,0x144A,0x2C},{0xE2A,0x1DCA,0xECC,0x373,0x1C44,0x10CA,0xE03,0xC71,0x11E4,0x1E7C,0x1F9,0x390,0xBE5,0x5F4,0x4B3,0x1627,0x1580,0xBC4,0x8B3,0x31}},
+    {{0x1C3F,0x182E,0x1072,0x1078,0x23C,0x1602,0x4E0,0x1C73,0x1568,0x1FCA,0xCB4,0x1F8E,0xFAB,0xDEA,0x1974,0x1B9B,0x210,0x1602,0x1650,0xEB},{0xB2D,0x11AD,0x1D3,0xB89,0x1976,0x1233,0x1E90,0x15A8,0xE3F,0x1F9C,0xC72,0xE2E,0xC57,0xBF1,0x123F,0x1827,0x16CD,0xA42,0x1B30,0xD2},{0x204,0xC9E,0x326,0x2B1,0x1158,0xAF1,0x160F,0x310,0xC8A,0x342,0x10CE,0xBEE,0x17FC,0xB69,0x1A84,0x1936,0x686,0x9DC,0x1D4E,0xD0}},
+    {{0xE14,0x2FD,0x1EE2,0x14A,0xDF9,0x1908,0x1A2E,0x48B,0x317,0x51E,0x3F5,0x324,0x11A6,0xD0C,0x1AB5,0x17AE,0x1CD8,0x6E8,0x4B8,0xDA},{0x1D8E,0x1B85,0xA3,0x946,0x4D2,0x13AD,0xB11,0x1EFB,0xF20,0x1C08,0x1E96,0x80A,0x1672,0x5C1,0xA8,0x1CF0,0x14FD,0x125B,0x1727,0x1A},{0x844,0x126D,0x1676,0xCDF,0x1C5D,0x1FBE,0x1982,0x1B6B,0x82E,0xDCC,0x996,0x1F3E,0x1A47,0x10B2,0x5A8,0x16BA,0x755,0x15ED,0x472,0x64}},
+    {{0x17,0xCD8,0xB46,0x173E,0x823,0x168E,0x19AD,0x1689,0x909,0x19FD,0xE67,0x27,0x1851,0xAC8,0x1B17,0x1113,0x16E8,0x1271,0x109,0xFA},{0x1866,0x987,0x6BA,0x663,0x1E1A,0x1EC6,0x1E4F,0x2B7,0x78F,0x15E1,0xCFE,0x1346,0x178A,0x1BBC,0x1E71,0x104F,0x24B,0x134A,0x127C,0xD9},{0x1734,0x1AE7,0x18CB,0x1C44,0x1194,0x1E0A,0xE53,0xC1B,0xA8B,0x171D,0x6C2,0x1886,0x1CB9,0x531,0x16AC,0x1AF,0x496,0xB44,0x1C30,0x6E}},
+    {{0x1594,0x1AFE,0x887,0x17F7,0x1E1E,0x1A03,0x3E0,0x15A4,0x1081,0x831,0x84B,0xB03,0x1369,0x8E7,0x1C2C,0x1835,0x1A2B,0xB64,0x1055,0x2D},{0xF36,0x178A,0x1D17,0x66A,0x1281,0x8EB,0x33C,0x1BD7,0x1393,0x2D,0xD6E,0x12E7,0x1EBE,0xCD6,0x478,0x1F1,0x158B,0x6A8,0x18E3,0x47},{0x828,0xD35,0x8E5,0x198C,0x10E1,0xBEF,0x9AC,0xC6C,0x88C,0x978,0x89F,0x1FCF,0x1503,0xAE2,0x1648,0x16FF,0x95,0xEE1,0xE34,0x53}},
+    {{0x18F5,0x828,0x1CAC,0x235,0xDB2,0x981,0x846,0x1B5,0xBA3,0xB67,0x1635,0x131D,0x1FCE,0x1CB5,0x1A55,0xA18,0x1D1,0x59F,0x8EF,0x2E},{0x13EA,0x1415,0x1D,0xD13,0x156E,0x87A,0x9,0x1F69,0x1775,0x557,0xF5E,0x18FD,0xDB0,0x1CC0,0xD00,0x1764,0x8E,0x1417,0x12E9,0xBA},{0x3DE,0x1101,0x159F,0x1D1F,0x1921,0xF1E,0x1DB3,0x1AE9,0x99E,0x1CE,0x1DF9,0xBF8,0x84F,0x332,0x193C,0x1455,0xD27,0x11FF,0x12B9,0x41}},
+    {{0x1933,0x73B,0x1986,0xE1F,0x1935,0x100A,0xA9E,0x1895,0xFBF,0x182,0x55D,0x12BD,0x14A6,0x2AD,0x391,0x1D60,0x1423,0x1A63,0x1AF7,0x8A},{0x997,0x361,0x10B1,0x1A16,0x1C0D,0xE14,0x126D,0x12E6,0x7D0,0x3CE,0x18E0,0x8E8,0x18EE,0x181B,0x10AE,0x1D0F,0xC68,0x161B,0x5E0,0xAF},{0x8ED,0x10C8,0xC0E,0x17CA,0x1DA5,0x1BF5,0x1952,0x1A23,0x397,0xAC4,0x1B22,0x1DE5,0x1ECA,0x15AA,0xDB1,0x187B,0xDE7,0x1878,0x16B3,0xB}},
+    {{0x193,0x209,0xE7D,0x1D46,0x1852,0xE7A,0xADD,0x1507,0x588,0xC6A,0x791,0xCBB,0x1BB1,0x2B5,0x4ED,0x1442,0x1F0A,0x366,0x1A69,0x44},{0x114E,0xA62,0x154,0xD1F,0x27B,0xFE0,0x7FF,0x708,0x1E0,0xE75,0x7E8,0x105C,0x1D9D,0x508,0x86E,0x12FE,0x1FA9,0x1BB8,0x73C,0x91},{0x644,0x1E62,0x114D,0xE20,0xCC3,0x1B9D,0x17A3,0xBE2,0x1D1A,0x6D7,0x370,0x14B9,0x6D3,0x1776,0x18F5,0x7D4,0x1274,0x6D5,0xA6C,0xCD}},
+    {{0x1E22,0x141D,0x12ED,0x1700,0x436,0xF12,0x7BD,0x1373,0x1CA8,0x92F,0xEE3,0x806,0x2B9,0x139F,0x1A57,0x136E,0x15CC,0x16D8,0x198C,0xCD},{0x1084,0x1A57,0x984,0x15AD,0x93F,0x3A3,0x1BD8,0xB8F,0x1E6D,0x17B2,0x19E9,0x91,0x6F,0x1FF5,0x643,0x1998,0x194C,0x4E0,0x138F,0xA6},{0x1B95,0x6,0x17E2,0x109B,0x253,0xE53,0xEAF,0x887,0x950,0x150F,0x594,0x1CF7,0xF88,0xAB1,0xF13,0x19B8,0xF0C,0x1BFA,0x137B,0xF4}}
+};
+/* End of comb table */
 #endif
 
 #if CHUNK==32
@@ -45,8 +114,75 @@ const BIG_256_29 CURVE_B_ED25519= {0x135978A3,0xF5A6E50,0x10762ADD,0x149A82,0x1E
 const BIG_256_29 CURVE_Order_ED25519= {0x1CF5D3ED,0x9318D2,0x1DE73596,0x1DF3BD45,0x14D,0x0,0x0,0x0,0x100000};
 const BIG_256_29 CURVE_Gx_ED25519= {0xF25D51A,0xAB16B04,0x969ECB2,0x198EC12A,0xDC5C692,0x1118FEEB,0xFFB0293,0x1A79ADCA,0x216936};
 const BIG_256_29 CURVE_Gy_ED25519= {0x6666658,0x13333333,0x19999999,0xCCCCCCC,0x6666666,0x13333333,0x19999999,0xCCCCCCC,0x666666};
-
-
+/* Fixed base comb table for ECP_genmul - generated by scripts/combtable.py */
+const BIG_256_29 CURVE_Comb_ED25519[64][3]=
+{
+    {{0xF25D51A,0xAB16B04,0x969ECB2,0x198EC12A,0xDC5C692,0x1118FEEB,0xFFB0293,0x1A79ADCA,0x216936},{0x6666658,0x13333333,0x19999999,0xCCCCCCC,0x6666666,0x13333333,0x19999999,0xCCCCCCC,0x666666},{0x5B7DDA3,0xEF4559D,0x1454BD5B,0x13F00EE,0x1E37D20F,0x7473255,0x19959BA9,0x1FAF16E,0x67875F}},
+    {{0x843CE0E,0x1E2D0A71,0x15E917E0,0x1B1C8A2B,0x1E7AC080,0x1DBE8C19,0x11B0F410,0x993EB40,0x36AB38},{0xAF8A3C9,0x12FA3573,0xE145583,0x121EA2C8,0x1F56973,0xF7464D1,0x7087689,0x1E612465,0x2260CD},{0xD69B401,0x18D1FAAB,0x1DC900AD,0x13599383,0x1B4135D7,0xF843981,0x3707795,0x10A165ED,0x2498A7}},
+    {{0x13F8E25C,0x31242FE,0x189221AB,0x7303302,0xC83A634,0x173A1F6D,0x1D247FD2,0x9445251,0x67AE9C},{0x18F5B4D4,0x161B4243,0x900C100,0xDD82ECE,0x9EF79F1,0x10C73013,0x6AE849A,0x1A2EFDCD,0x1267B1},{0x18B3A41A,0xFC847D3,0x5BF12B3,0xE6B17F6,0x115275C2,0x1BC1D6DC,0x1443AFBC,0xB963BB2,0x2A4D02}},
+    {{0x4C9F870,0x9D532BE,0x138551D2,0x73D8327,0x120F91A7,0xA5C3D1A,0x51A0C97,0x1B6AD9FE,0x203DA8},{0xA32112F,0x19C55B0E,0xBC3FC37,0x45065D4,0x1716C4CF,0x1C42C06A,0x17851C3A,0x4F962B2,0x47D0E8},{0x128A1358,0x1C7917B3,0x1741F297,0xBC63D6D,0x2960719,0x1D35633E,0x1831C852,0x1B1B0E64,0x22783C}},
+    {{0x122EF233,0xA04E601,0x6F86964,0x1033F27C,0x1A5DE5C2,0x1E7BE896,0x1EFF3BD,0x7D5BC6B,0x49FDA7},{0x1676C8ED,0x690FC1E,0x10C2D744,0x105D9512,0x4666312,0x170A44C9,0x19BF80B1,0x16531FD5,0x5F4825},{0x13E801D0,0xCA85E7,0x249AFD9,0x129D0A00,0xC7F9AFB,0x1528439B,0x1530C583,0x5938B27,0x745C56}},
+    {{0x1DCBF23D,0x1D3A0D3,0x1ED109DE,0xB3304D8,0x29BEA1E,0x16606E85,0x718ABA,0x174F48AC,0x4C9797},{0x19497EF4,0xE93D687,0x135AD830,0x2F80D28,0x17D77F94,0x4D3FEA7,0x28476DC,0x1F8510DB,0x54DE3},{0x144EF1D2,0x1E76B645,0x1F7226F1,0x1F2428F8,0x1DCC40BA,0xD4CA7F3,0x13E0A15,0x1A21354C,0x3C32EF}},
+    {{0x150E4107,0x2ACC0D7,0x1C73A556,0x1013E777,0x1810783E,0x170CA58E,0x153BA78F,0x10BF9E97,0x145686},{0x1F4062B8,0x162625AC,0xAFC8F44,0x10568DEF,0xAD41F08,0x12346E9B,0x14BE1F39,0x1C6568FA,0x31C563},{0x1587ED1B,0x5EA2AB2,0x6A93904,0x8C6543D,0x1BAB4529,0x16E2C4EA,0x186E6FA0,0x1623A2CB,0x119E77}},
+    {{0x8A584C8,0x1C3FEDE0,0x1A62E64E,0x158CF700,0xCF93EB3,0x16AE7C27,0x6D90A18,0xBF2FAEE,0x6742E1},{0x1C37B9B4,0x117ADD4F,0x7B924C7,0x1079F8C4,0xF38F817,0x1784B345,0xDE5BAB5,0x193CAE,0x21D306},{0x141A51BF,0x1DF7A0D6,0x130AFD5B,0x19CDA68,0x1D99345F,0x14D9C59,0xB845823,0x1D9DBEFD,0x2C4F59}},
+    {{0xABC0CBB,0x18BCBD23,0x179BCB64,0x103820E5,0x800F2C0,0xA13B419,0x31776AF,0xDA26C2B,0x4D1E11},{0x10C9B91A,0x270F7D8,0x292E13D,0x1096F6BD,0x8F8C43E,0x9AA5A80,0x16D97314,0x1C93A9C6,0x6D415B},{0x1682ED71,0xB9246DA,0x17520019,0x17801DC7,0x788581E,0x177ABA17,0x30BFFA7,0xF3FEFF5,0x7A9797}},
+    {{0x8127D15,0xA10A412,0x12F50CB3,0x14C2E582,0xE2EC8C2,0xA22927C,0x1F76FB8E,0xB4EF50C,0x4B5BAE},{0x9A77CB,0x91DC6F1,0x303E836,0x1D974AF7,0x142ECB6A,0x122C0733,0x48661D6,0x1C16708E,0x739476},{0x18EC63F8,0x139F0252,0xDF8073E,0x12534988,0x1912D10F,0xFB010E4,0xE37DDF5,0xB5675CB,0xE4089}},
+    {{0x18ECC8F9,0x18B3F2D0,0xE6E97C7,0x3570F8E,0xD4F1AE6,0xD3ACC41,0x13C140E1,0x13DD7CC4,0x28E01E},{0x58A68C1,0x1BB41505,0x19178A9E,0x369ED36,0x1048DD3A,0x13E0D5B8,0xA6D8A4E,0x4101128,0x34A3EF},{0xF9BDBE3,0xE40D332,0x131E8821,0x1AAC50E8,0x24764AB,0x251C007,0x885234C,0x6E76DDD,0x2D139C}},
+    {{0x869FCDF,0x2D9F919,0xDC90EFE,0x5AA3BE6,0x98D06B2,0x1FE7B654,0x1C4F841B,0x198373B,0x33BFA9},{0x12DA81D9,0x1CEC127D,0x1C426050,0x19DE03A5,0x17D2DF4A,0x1FF88480,0xB967E97,0x1B6C64F9,0x53B120},{0x9D95CAB,0x148AAE01,0x18FB722B,0x15C20A35,0x1420CB5B,0x19473DCB,0x9F0564B,0xC7FB8D1,0x46DAE6}},
+    {{0x1110CC99,0x7B85A50,0x880B1A5,0x19C577B4,0xBB2AF36,0x1B416653,0x121C45BF,0x1F2C3AD5,0x6759A4},{0xCF8AF35,0x521FB0F,0xF8598CF,0x2344C0B,0x36D4B10,0x908B000,0x131EC964,0x5B94BE8,0x7E6C7C},{0x7226B49,0x132E219E,0x14D8E138,0x1AE6534A,0x44BE353,0x12B8A283,0x1CC00B71,0x174C6E44,0x65404D}},
+    {{0xDE80267,0x6A1A54D,0xAA0457C,0x90E9B8F,0xE775EA9,0x7024A26,0x79E1DA4,0x62122A,0x56BEC7},{0xC86FB32,0x973599F,0x1EB20AD4,0x1C8EE0D9,0x10C05CE7,0xB5A79B8,0x3337299,0x1A0EA0EF,0x6AB2DD},{0x1AD1600C,0x197F2425,0x17E99E65,0x1AF314A6,0xE0A949A,0x19286CA0,0x196F8A3D,0xACE785A,0x6EB24D}},
+    {{0xA7C82BC,0x105EB298,0x1ACA3410,0x15C14F6B,0x1C56305D,0x140BD014,0x19F6B7CE,0x1B858C10,0x4BBEFB},{0x9538107,0x71FB42,0x2282541,0xA8FC20E,0x74F7AC3,0x72EE61F,0x1725E747,0x19138185,0x6EB85C},{0x29190E4,0xB7BE380,0x1F124A89,0x1204142,0x6931C09,0x141B6773,0xED63D66,0x2DADCA9,0x1E8DF6}},
+    {{0xB9EFC6,0x1041115E,0xCDC1C47,0x2F5386B,0x9A44920,0xAAC587B,0x140A6F06,0x68F85BD,0x444929},{0xE1D6245,0x8E157F9,0x1EC96908,0x122B181A,0x17C8FFC3,0x128F3ED2,0xF59168C,0x18B977B5,0x77785E},{0x284E8A9,0x12A3485C,0xF891D5,0xBAD9B44,0xA9DD89,0x1558965C,0x17B59713,0x1A357FEF,0x76A162}},
+    {{0x14EDA202,0x105B5C7F,0x68D7ACF,0x11B6FDAA,0x8A96007,0x1067DA50,0x757512D,0x1117E5BF,0x6222BD},{0x2E45313,0x18F7D2BC,0x40AC1A3,0x16C1175,0x17C4F541,0xD76930D,0x9775AF,0x85D49DA,0x325BB},{0x16740859,0xFEC974D,0x112FE18B,0x157C1D39,0x145603B0,0x732004,0x182B1E66,0x1C58FA75,0x628B09}},
+    {{0xBDBA597,0xA15516C,0x4FC8244,0x80DB377,0xA8114E8,0x131592D0,0x1312B97E,0x15790996,0x23BC7},{0xF29C9EE,0xC288EF8,0x188373BB,0x12971E58,0x6E904F,0x101B8EB9,0xC532540,0x14E73D9D,0x4D2B97},{0xC14539A,0x7D90559,0x1E02CC,0x569137B,0x1BB73CD6,0xD0446B6,0x121E594,0x17BAF48D,0x2BE24D}},
+    {{0x13263467,0x3B2071,0x1A843620,0x11954D99,0x61DF2CA,0x5A4E545,0x107166A,0xBDB6B88,0x132A06},{0x1DD7DE2F,0x32FD1F0,0x1FA3A966,0x161B863,0x1CFD1B39,0x15BDC2F2,0x1E01D8B5,0x146A65E,0x534EF7},{0x12ECF407,0x792D873,0x10DA63E5,0x4B95E9B,0x1F8F5FB8,0xB733AE2,0x169754A5,0x131049C0,0x13DE9F}},
+    {{0x1D39D169,0x5F19FDD,0x1BD73C31,0x18D0ADE1,0xC84797F,0x1229DB39,0x1296602A,0x19EE26F6,0x6D5066},{0x1219A417,0x59A388A,0xBAA56D7,0x4016844,0x1857F95,0x11AD5F5C,0x1F220EAF,0x1B054150,0x54BB8C},{0x8AB7C70,0x64756C3,0x13E5288E,0xA05B751,0x6F1F0A9,0x3F1547,0x19987279,0x1C261CFF,0x609142}},
+    {{0x1B04C2CD,0x39214E3,0x682C9D4,0x621F73,0xA8F63C,0x10AD3A5D,0x4D1FD60,0xF9B610D,0x35FF8F},{0x6CE8B8A,0x1E24E5D5,0x186A2A43,0x16AE2FBF,0x1606B4E1,0x1434A9DD,0x1C1551A7,0xD0E22AB,0x50E1CC},{0xC30E3D7,0x2D44D9C,0x17FA62E2,0x18768A98,0x1B1B73FF,0x1D6EC3DB,0x5466285,0xFDA3625,0x330C0A}},
+    {{0x22E0213,0x17909053,0x1CE1684A,0x578C928,0x128E5401,0x383CD41,0x9BDAD3A,0x182FE976,0x6C6365},{0x1494C782,0x184A4CF2,0xE34FAC0,0x186654C1,0x1EC8E08D,0x5002B54,0x5A320C8,0x153A7A35,0x1C5703},{0xB8F0450,0x1F9092E4,0x126667F2,0x109068A6,0xC7722C1,0x1B5EFE9B,0xAA3FFA2,0x1701C466,0x397F5D}},
+    {{0x1BD887D1,0x1CA2633A,0x107863CE,0x1BCA3091,0xEA83479,0xA0DF3E,0x14B2E0C0,0x14A1663A,0x68B818},{0xD398826,0x194726FF,0xB771DD1,0xB2CAA6B,0x18F43968,0x1A6BA9B6,0x1AC8A3B9,0x7D800EC,0x1E8B23},{0x1C995B42,0x53CA84C,0x16330A3D,0x11DFB50A,0x15F0DB4C,0xF43048C,0xA744E25,0xE9B751C,0x76724D}},
+    {{0x59362A9,0x139F45F4,0xD6C0392,0x14A1285B,0x1EAB2D3A,0x1DBB314E,0x1538D01C,0x13590E05,0x6B6615},{0x8CA96C5,0x1F70D116,0x180C79D7,0x6110644,0x32B9CE6,0x1D2EAC22,0x1413926C,0x1DE71DFA,0x19DD4B},{0x7C4FDC3,0x1A801AB7,0x13BF2CE8,0x1937ECCE,0x489ABF3,0x5500846,0x735384D,0x199C1B86,0x667FBA}},
+    {{0x1B5775D0,0x10A2E759,0x13F25415,0x63D7170,0x1F5ABF4A,0xA0A9054,0x125B6A0A,0x118B3363,0x51F4FF},{0x17863AC1,0x1C203586,0x152F46DF,0x1D00F00F,0xEEB4B12,0xD771C29,0x7CFDBE6,0x111A8DC8,0x35AC95},{0x8D6C911,0x1EDB9038,0x5DD2C23,0x62AB20,0x166FF0C8,0x338D912,0xBABEE25,0xA9B4B1E,0x4DA02F}},
+    {{0x11BF9741,0x394DB53,0x1AFE3CFB,0x12D81DCC,0x682FA56,0xB0EC29,0x18FD8F02,0x12026794,0x568DE6},{0x173039E8,0x1FED891B,0x1D0F8F46,0x175CFE9A,0x65B43A5,0xE219D07,0x191D0773,0x1325D1C,0x4C4822},{0x170A98EF,0x37EDE20,0x18467A40,0xC1C0490,0x3267B42,0x19DC864F,0xFDE1DEE,0x1D7EEBCE,0x4090F6}},
+    {{0x159F5785,0x1D903645,0x1C0FD1E7,0x353CDF5,0x1966F9BB,0x12D27CBE,0x18C9D425,0x8EFED94,0x4F2F4B},{0x1359E934,0x40134EC,0xF333C95,0x70A4B84,0x62C16AE,0x19045382,0x10E685B4,0x10E77150,0x13115F},{0x1BB4A6A6,0x1EB9B0ED,0x5699643,0x52ADDE8,0x141F3359,0x137B6404,0x1C50C6A5,0x1E378445,0x602C6B}},
+    {{0x63403DA,0x13986623,0xD492F1B,0x502E1F3,0x17CF4E95,0x1C4FEE91,0x877BD1A,0xE2FAAA4,0x3342C4},{0x1B6937C5,0x4EE3542,0x1B987F29,0xFD48CD0,0x1D2671CD,0x678FD3E,0x14DA3553,0x1BE01926,0x50676C},{0x1D50B8BB,0x11D5A3D7,0x68374E4,0x1C506E87,0x465D2D5,0x2960008,0x1F726F0C,0x14216949,0x2D3C40}},
+    {{0x11ECCCCB,0xFD87DC7,0x1237DBA6,0x1FA0A83E,0xD599FA2,0x187EDD44,0x1B42A4C1,0x12E76C9,0x282A40},{0x1AA84686,0x1AB16E93,0x10C5431F,0x1D41A3C1,0xBFCD9AC,0xFF00D63,0xA4D6572,0x1B19DBB7,0x5A8A95},{0x8F6988A,0x425EF6C,0xF02FEE7,0x68DD3B4,0x861FAF1,0x33DB987,0xC2F8A54,0x1CF91A9D,0x7CFC2F}},
+    {{0x1297DBD3,0x614ECF6,0x18DD948,0x16671D03,0xD58952B,0x1E6054F8,0x8350F96,0x1EB3E2B8,0x7AAF48},{0x11A58D6E,0x34C4B5F,0x1824D36B,0x1E1591D1,0x2DE38A8,0xE31DFF3,0xE30D852,0xD53CECC,0x2765BA},{0x116AC088,0xE8436AD,0x1BC5D0BF,0x1A223194,0x1B85BB38,0x15A7D1E0,0x886DFCA,0xEADD99B,0x3E86B7}},
+    {{0xA2329B4,0xA6CBCDD,0x7DF0E6F,0x8BE99A9,0x19591337,0x62AC48D,0xD57397E,0x11F7A568,0x33649},{0x1DD5CBD8,0xF0453E2,0x1D2366A8,0x1FAA5FF,0x1109FAFE,0xE1BCB4D,0x139F912C,0x16C2C4F3,0x653338},{0x9593F4B,0x7B8C6EA,0x2B8F7BA,0x1B925E7C,0x2487C34,0x8CF8508,0x10E44EBE,0x42D2D80,0x2DFE0C}},
+    {{0x9424D9A,0x1B5D22E9,0x1362AA1B,0x1FA4F722,0x1EF36D,0x6E66291,0xCF563AE,0x117F8A16,0x339697},{0x8073393,0xE865256,0x176F6AEC,0x1D58F94F,0x1CCCB453,0x1ADFC883,0x9F72E74,0xB222782,0x5CCF13},{0x10EB0649,0x479876D,0x102E6FDE,0x10F6702E,0x519A29,0xB9C2648,0x12E68A71,0x1B8BDAB4,0x5C6B84}},
+    {{0xB7E824,0x4023D73,0x19C8F97F,0xD0B9385,0x29A098E,0x1CC270A7,0xCB254B4,0x1FE788BE,0x4C27AF},{0xBF5A66B,0x1DD5E88A,0x9312796,0x17C3CA3,0x9C3A90D,0xF5B1361,0x1F657C4,0x1CCA4DB9,0x5F2C99},{0x6F1338A,0xF398E4A,0x18EB6A7A,0x10C904CC,0x4B6A147,0xB0003C9,0xBF5385,0x1FA17E8C,0x5A164}},
+    {{0x1224E085,0x77E8DA1,0xFE89A7F,0xA58E51F,0x16EE4F69,0xBFBC83E,0xBDE8205,0xE67DFB,0x786BE3},{0x63E2736,0x15583896,0x75A6F93,0x18117D67,0x108472A7,0x766EA7E,0x16CD09C,0xEE5E693,0x653A5F},{0x119F64C8,0x62740BB,0xEAF5B80,0x9DCAAAF,0x1D8EC96C,0x134D2DE9,0x1A2C3641,0x1A69A627,0x12C73E}},
+    {{0x1193C7C7,0x92E544F,0x15B652CC,0x975990E,0xF09BAEA,0x1D52C5C2,0x14728BF4,0x15F70672,0x9C186},{0x1F7B062F,0x11A4D1AB,0x1553FC46,0x1054D77D,0x4A1E02A,0xAD8A4C3,0xD4E4D1A,0xE8C04F6,0x6137B0},{0xE8EF362,0x18EB1208,0x22B48E2,0x107687E7,0x20AE2EE,0xA36F1C6,0x162BB781,0x1A6FE4C7,0x572C78}},
+    {{0xC2EAA13,0x5C11782,0x13466CDB,0x9A0D7D6,0xDD9CC6A,0xBC0ADE4,0x4CF7E25,0x10092D15,0x21FEE4},{0x10901700,0x3069F49,0x1CB08C4C,0xA6CF512,0x18339BDA,0xED0A842,0x147505B1,0x800E596,0x500B77},{0x1B381F8,0xC052C27,0x1E5FC37,0xCE22DC4,0x94ABEA4,0x13F782F4,0x1FC1A238,0x1ED18311,0x198588}},
+    {{0x112D4F17,0x8CF1D15,0xF265552,0x219CB2E,0x1C9E8EDA,0x101B2E44,0x20AE04F,0x12DDDC9C,0x4A2E1F},{0xC846FC4,0x6A5C195,0xD699911,0x53CA2E6,0x10DA8DC2,0x8C45FEF,0x116E3254,0x1045C30B,0x6C3F24},{0xC797678,0x1585969A,0x91E1054,0xB456B7B,0x2249E46,0x16789064,0x986CA6D,0x199DF1BA,0x2DDEBA}},
+    {{0xEC3464,0x1A0A24F6,0x14DA82B,0xA61D4DA,0x12435462,0xADEC34E,0x1D19ABC6,0x1F2A929A,0x5DBD3B},{0x17E25B77,0x1BE70E39,0x1EE7E304,0x59C54F6,0x12AB9A34,0xC60544C,0xEC218F3,0xEEEDD3F,0x56F5F7},{0xE2F2569,0x1CA321D1,0xCD2EE9C,0x1A870611,0x5F606BB,0xF5168DC,0x10549010,0x6776057,0x5844F5}},
+    {{0x16ED5685,0x1B85D6E3,0x9D78464,0x1C0235FA,0x11CEBB58,0xABEFCBB,0xF03C7CB,0x88AEBA,0x4B3702},{0x1289B820,0x1013D66,0x1338A492,0x1B961F5F,0x6AAFE36,0x1D4072B0,0xBD4BD09,0xA159E66,0x54333C},{0x1C1535E8,0xA538ED1,0x11653B0F,0x475080,0x594F3CF,0x1CFDC002,0x7722929,0x1BE4C1F0,0x1D1CEC}},
+    {{0x1146B3DF,0x5B89B70,0x1755938A,0x115B59E3,0x88F8C35,0xC032F4A,0xDAB9286,0xBA9215F,0x77FE8A},{0x5F50246,0xBAE2D7D,0xD516E9B,0x1993FC14,0x18D9122A,0x199CA90,0xC5A2B00,0x3C073E,0x3C530F},{0x1B52AD2C,0x116B3430,0x241BF,0x11B9F52B,0xEB583AD,0x1931FFE7,0x7E1493,0x118EE4C1,0x25A2C5}},
+    {{0x12014031,0x2DCA2B2,0x14AAA28A,0xA15B1DC,0xB5CD8D0,0x151C1755,0xFDE1EDE,0x19609F65,0x543D84},{0x1E59EF20,0x14995D26,0x10BB0B9B,0x85BA934,0x1275846F,0x1C78C15,0x1279A4F6,0x18B6C7DA,0x358FD},{0x3982220,0xE393250,0x63569F9,0xBC53BBE,0xC8E6A5,0x3539E70,0x9B0F268,0x1987E96E,0x45A56}},
+    {{0xF605EA1,0x13870FDA,0x13D547DA,0x72B6812,0x181C6363,0x12830C00,0x12D2909C,0x70D484,0x2AC4C},{0x17DE3877,0x3A4306,0x1FEA1D3C,0x661CAA9,0x1FB77FF4,0x197F8390,0x1791AC1E,0x33F861C,0x1A36C},{0x100BE480,0x142AA8D2,0x10BA00E0,0x13CEE369,0x10AF9475,0x64D33B3,0x11A4F6B4,0x1263C686,0x234E14}},
+    {{0x2A039E9,0x1D9D36DB,0x62400BC,0x11187947,0x4F59A37,0x1607A217,0x1A785414,0xCF4481F,0x2D2DD6},{0x6554DD1,0x1743C8A8,0xE0E36DD,0x1DFA22B9,0x10C8D64A,0x16A31CDF,0x1489EE9,0x1B6F38BB,0x377BD9},{0x10E63981,0x3006259,0x1640F375,0xEC6CB76,0x14938CA9,0x156BF54B,0x1812C269,0x435C00D,0x4C7995}},
+    {{0xC2CC513,0x4141E9D,0x17DCA5F,0x1F6C014A,0xF455861,0xC8617EB,0xE6D9742,0x861A8CD,0x2816F8},{0x14B47F1E,0x1C4D8BF3,0xAD68613,0xBBE0CC9,0x6AE0874,0x4877863,0x8E0D493,0x168A861D,0x5452C4},{0xBB35752,0x1F601CF2,0x1DA9508,0x1001C3D1,0xEA02593,0xDBAC61E,0x1AEC939,0xEBFA1B1,0x464A3C}},
+    {{0x1A4BBEF3,0xE23537D,0xF36806B,0x1E8F7F73,0xBFB1E47,0x3C282B0,0x16B3EC56,0xDE0D458,0x1CAEBA},{0x98D85B8,0xB2B53DF,0xEF5674E,0x1D83018D,0x1DC51A91,0x77AA112,0x15DD283F,0x23CFD4E,0x65FCDC},{0x1A689749,0xCB79C9D,0x1CC1CADE,0x139BD3AB,0x14F2588C,0x13EA5B68,0x1ECE0B0C,0x749F986,0x217601}},
+    {{0x1935A5C7,0x287AEA8,0x1323232B,0x13D204A6,0x10967C6B,0x1563906E,0x1BD32313,0xA57EB5B,0x60C29},{0x5427F5B,0x5425A10,0x72A91CD,0x198AE360,0x1BDDF2B2,0x9EDD80F,0x925DF19,0x928904A,0x10EF5D},{0xFCE84B6,0x1F46DA06,0x12C8F039,0xC621F3C,0x1FEB69C7,0x17AF5232,0x16723CF0,0x682FA6D,0x6DB3FC}},
+    {{0x101F0C00,0xD29BDA3,0x1BA24B11,0x1C6B22B2,0x51F9902,0xFEE603B,0x5545A85,0x11247E9D,0x5D4169},{0xEF8BC11,0x9B23C07,0x15041DF1,0x15DC64FB,0x98FDE48,0xF5785C1,0xBA2FB6B,0x9451D3E,0x2D9279},{0xD690B66,0x6DD4A03,0x153FF48D,0x104310A8,0x1F1D9F87,0xF976D1A,0x12177CB8,0x7E4F0B,0x35D51}},
+    {{0x1FDC9FE9,0x2244E09,0x107909DD,0xE95FF21,0xCDEE3CA,0xA128EFA,0x598DFE,0x1FCC9789,0xCC495},{0xE75198B,0x12F0301B,0x3069BDA,0x451A7C7,0x17AB9E0F,0x9F334A1,0x1DFBFB03,0xF6D9572,0x42138E},{0x1BB7E189,0xE632726,0x9B60F0C,0xDAE153C,0x1107F5B5,0x68ACD38,0x41E0821,0x1B4CC664,0x3D0AC8}},
+    {{0x7DAD28D,0x1BD6B226,0x75F49B6,0x1BBDC370,0x177D7A9,0x21B8E3F,0x19F0B634,0x3C7030B,0x1BC7AF},{0x314833,0x1797B2C8,0x6C9C3F2,0x4FC24C6,0x1C0491D0,0x17C3BCAE,0x1CBDE97B,0x1B0AACC3,0x61D909},{0x636C2C7,0xDC2290B,0x179FBE14,0x11E46CAD,0x10FBD9BB,0x126F258F,0x91332D9,0x100A971F,0x1A340B}},
+    {{0x18028354,0x1CCC9C10,0x16A9F401,0x1512EBB1,0xA3D9F2F,0x1AAD35DC,0x5AF48A0,0x8BF184B,0x6BCE2},{0x8A3C065,0x17E4AA8C,0x1A1E2525,0x1283161B,0x14858C2C,0x697883A,0x168324AB,0x139BA1ED,0x3D2698},{0xEB94B17,0x1A5B2F5C,0xA59B1B7,0x19380184,0x1E42D1AF,0x1349C21A,0x1C409849,0xC1CCA75,0x7A9F62}},
+    {{0x1B29662F,0x15EC4820,0x175BBB9F,0x1DE1D6F,0x1FCB40CB,0x1D64E13F,0x17BD90F0,0x1155E888,0x766590},{0xB704CA1,0x41D0072,0xBE904DC,0x4327171,0xB409652,0x1C032781,0x151B385F,0xF8A1B48,0x4ED18A},{0x19EC13BB,0x1AA1A1D,0xFE1A91A,0x3A59543,0x1B1B0906,0xD1C16C,0x17337230,0x1E5A9B7,0x6BB9CF}},
+    {{0xC16D4F7,0xCECAA73,0xAE443D7,0x8B9FCA4,0xE630E53,0x19F99DD2,0xAA420D3,0xDD6B409,0xA09B3},{0x35ED926,0x1D17587D,0xDCEC83C,0x1D3DC9A8,0x1533D06C,0x1595D776,0x42892DB,0x1AC1F462,0x3AA47F},{0xB04C053,0x111D8E63,0xB8AE0BF,0xD3293E6,0x5902F2,0x4217FF,0x15629A7E,0x16968C91,0x3BD5DF}},
+    {{0x1113735E,0xCE6AA28,0x1B9F4824,0x2C5A574,0x49860BA,0x1AD45FAB,0x15AA0322,0x6EC71CD,0x1C71CE},{0x9E406CB,0x1F47F709,0x1EA5CB38,0x1A307E88,0xCFB7D40,0x1D6BCD50,0xB3490F6,0x3840076,0x7880CC},{0x1C5832AC,0x1587577,0x1717805E,0x72B807B,0x1BA6534E,0x3212E21,0x6196E80,0x8EE8C8A,0x79030A}},
+    {{0x14CBC8D6,0x18DCF3FB,0x14B2C64,0x1CF288D9,0xCFE5120,0x17C4AE1,0x1DF625EA,0x10983BE5,0x3C607A},{0x1A3CEA68,0x13BCD435,0x681833A,0xFC142E6,0x1EE18498,0x1D5A44ED,0x8E88E12,0x1A213283,0x34518A},{0x1E37345D,0xC41E364,0x429CC45,0x1A547081,0x1B396EA5,0xDEED4C1,0xBCFC3B4,0xBC65CAE,0x72705}},
+    {{0x1FBE2DA0,0x857A0BF,0xE38E70C,0xFF8CD4C,0xF7F13A1,0x1C6EB0B7,0x1198FFE4,0x1A040017,0x89B6C},{0x1E8CEB88,0x1C40B789,0xEC4A8F9,0x17C94F9B,0x657E43C,0xF7E88E5,0x1F62D0E3,0xD546DB,0x66EF72},{0xDA76D28,0x1D23C1BA,0x1DEC42EB,0x141A5344,0x1DA0759B,0x19848DF1,0xFED1DC3,0xBEA22C2,0xD2C58}},
+    {{0x1C2C9FDB,0x10F596B7,0x19E948B,0x50C5B0E,0x1906D2B7,0x1AA1A33B,0x1583E1EA,0xB6C122F,0x79E9D},{0x4C78797,0x809C0E0,0x171D60E,0xC9F947,0x1A225640,0x54A285F,0x914C49B,0xA3A4481,0x165129},{0x13B94E2A,0x20DCDD9,0x386571,0x3C8C717,0x7E7CF9,0x145F28E4,0x4E4B32F,0xF12B016,0x18A2CD}},
+    {{0xB05DC3F,0x1E41E20E,0xE0B0108,0xAD1C732,0x132D3F95,0xA7D5FE3,0x1379746F,0x1808421B,0x75D942},{0xE35AB2D,0x1B2E243A,0x90919E5,0x1C7F5A8F,0x131CBF38,0x1162BB8B,0x4F23F5F,0x90AD9B8,0x696CC1},{0x1993C204,0xC0AC464,0xF578C5,0x1914310B,0x14338684,0x9BFE2FB,0x6DA845B,0x770D0D9,0x687539}},
+    {{0x85FAE14,0x1C852BDC,0x2EC8437,0x62E48BD,0xFD4A3C,0xC8D30C9,0x15DAB568,0x1BA39B17,0x6D12E0},{0xF70BD8E,0x9251814,0x1119D693,0x1E41EFB5,0x17A5B810,0x1B39202,0x1E00A82E,0x96E9FBC,0xD5C9E},{0x1A4DA844,0xEB37ECE,0x182FDF71,0x105DB6BC,0x12659B98,0x12D23FCF,0x1745A885,0x17B4EAB6,0x3211CA}},
+    {{0x199B0017,0x11DCF968,0x1ADB4720,0x1213689C,0x1B99F3FA,0x8C28809,0x27B1756,0x9C6DD11,0x7D0426},{0x930F866,0xD198CD7,0x4FF6378,0xF1E2B7F,0x133FABC2,0x1CBC54D1,0x9FE71DD,0xD284970,0x6CC9F2},{0xF5CF734,0xA711319,0x53F0546,0x1516C1B7,0x11B0AE3A,0x11E5CE21,0x15F6AC29,0xD1092C1,0x3770C1}},
+    {{0x1F5FD594,0xF5FDD10,0x1E0D01F8,0x1035A41,0x1A12D063,0x79B4AC0,0x6BC2C47,0xD934578,0x16C155},{0x1EF14F36,0x99ABA2,0x13C475CA,0x727BD71,0x1B5B805B,0x16F5F4B9,0x1E247866,0x1AA2B161,0x23E38C},{0x15A6A828,0x10E6311C,0x1AC5F7C3,0x1118C6C4,0x1A27D2F0,0x2A81FF3,0x1FF64857,0x1B8412B6,0x29B8D1}},
+    {{0x110518F5,0x1908D795,0x464C0B6,0x17461B54,0xD8D56CE,0x15FE74C7,0x31A55E5,0x167C3A2A,0x1723BC},{0x1682B3EA,0x17344C03,0x943D55,0xEEBF690,0xBD78AAF,0x6D863F,0xC8D00E6,0x105C11D7,0x5D4BA6},{0x1E2023DE,0x10F47EB3,0x1B378F64,0x133DAE9E,0x77E439C,0x12427AFE,0xAB93C19,0x7FDA4F4,0x20CAE6}},
+    {{0x18E77933,0x1AB87F30,0x9E80564,0x1F7F8955,0x9574304,0xDA534AF,0xC039115,0x98E847D,0x456BDF},{0x46C2997,0x6E85A16,0x6D70A70,0xFA12E69,0x638079C,0x1BC7723A,0x1F0AEC0,0x186D8D1D,0x579782},{0x1A1908ED,0x12DF2981,0x152DFAF6,0x72FA23C,0xEC89588,0xAF65779,0xF6DB1AD,0x1E1BCF8,0x5DACF}},
+    {{0x14412193,0x97519CF,0xDD73D61,0xB115075,0x19E458D4,0x15DD8B2E,0x844ED15,0xD9BE154,0x2269A4},{0x114C514E,0x1DB47C2A,0x1FF7F009,0x3C07083,0x1FA1CEA,0x8ECEC17,0x1FC86E28,0xEE3F532,0x489CF3},{0x17CC4644,0x1B88229,0x1A3DCEB3,0x1A34BE2B,0x8DC0DAF,0x16369D2E,0x1A98F5BB,0x1B564E87,0x66A9B0}},
+    {{0x1683BE22,0x1B5C025D,0x1BD78910,0x19513733,0x13B8D25F,0x1F15CA01,0xDDA579C,0x1B62B993,0x66E632},{0x134AF084,0x1FD6B530,0x1D81D1A4,0x1CDAB8FD,0xE7A6F65,0x15037824,0x130643FF,0x13832999,0x534E3C},{0x800DB95,0x9C26EFC,0xAF72989,0x12A08877,0x19652A1E,0x117C473D,0x170F1355,0xFE9E199,0x7A4DEF}}
+};
+/* End of comb table */
 #endif
 
 #if CHUNK==64
@@ -59,6 +195,74 @@ const BIG_256_56 CURVE_B_ED25519= {0xEB4DCA135978A3L,0xA4D4141D8AB75L,0x797779E8
 const BIG_256_56 CURVE_Order_ED25519= {0x12631A5CF5D3EDL,0xF9DEA2F79CD658L,0x14DEL,0x0L,0x10000000L};
 const BIG_256_56 CURVE_Gx_ED25519= {0x562D608F25D51AL,0xC7609525A7B2C9L,0x31FDD6DC5C692CL,0xCD6E53FEC0A4E2L,0x216936D3L};
 const BIG_256_56 CURVE_Gy_ED25519= {0x66666666666658L,0x66666666666666L,0x66666666666666L,0x66666666666666L,0x66666666L};
-
+/* Fixed base comb table for ECP_genmul - generated by scripts/combtable.py */
+const BIG_256_56 CURVE_Comb_ED25519[64][3]=
+{
+    {{0x562D608F25D51A,0xC7609525A7B2C9,0x31FDD6DC5C692C,0xCD6E53FEC0A4E2,0x216936D3},{0x66666666666658,0x66666666666666,0x66666666666666,0x66666666666666,0x66666666},{0xDE8AB3A5B7DDA3,0x9F80775152F56D,0x8E64ABE37D20F0,0xD78B766566EA4E,0x67875F0F}},
+    {{0xC5A14E2843CE0E,0x8E4515D7A45F83,0x7D1833E7AC080D,0x9F5A046C3D043B,0x36AB384C},{0x5F46AE6AF8A3C9,0xF51643851560E,0xE8C9A21F569739,0x92329C21DA25E,0x2260CDF3},{0x1A3F556D69B401,0xACC9C1F72402B7,0x87303B4135D79,0xB2F68DC1DE55F,0x2498A785}},
+    {{0x62485FD3F8E25C,0x981981624886AC,0x743EDAC83A6343,0x22928F491FF4AE,0x67AE9C4A},{0xC3684878F5B4D4,0xEC176724030402,0x8E60269EF79F16,0x77EE69ABA126A1,0x1267B1D1},{0xF908FA78B3A41A,0x358BFB16FC4ACD,0x83ADB915275C27,0xB1DD9510EBEF37,0x2A4D025C}},
+    {{0x3AA657C4C9F870,0x9EC193CE154749,0xB87A3520F91A73,0x56CFF1468325D4,0x203DA8DB},{0x38AB61CA32112F,0x2832EA2F0FF0DF,0x8580D5716C4CF2,0xCB1595E1470EB8,0x47D0E827},{0x8F22F6728A1358,0xE31EB6DD07CA5F,0x6AC67C29607195,0xD873260C7214BA,0x22783CD8}},
+    {{0x409CC0322EF233,0x19F93E1BE1A591,0xF7D12DA5DE5C28,0xADE3587BFCEF7C,0x49FDA73E},{0xD21F83D676C8ED,0x2ECA89430B5D10,0x14899246663128,0x98FEAE6FE02C6E,0x5F4825B2},{0x1950BCF3E801D0,0x4E85000926BF64,0x508736C7F9AFB9,0x9C593D4C3160EA,0x745C562C}},
+    {{0x3A741A7DCBF23D,0x99826C7B442778,0xC0DD0A29BEA1E5,0x7A45601C62AEAC,0x4C9797BA},{0xD27AD0F9497EF4,0x7C06944D6B60C1,0xA7FD4F7D77F941,0x2886D8A11DB709,0x54DE3FC},{0xCED6C8B44EF1D2,0x92147C7DC89BC7,0x994FE7DCC40BAF,0x9AA604F82855A,0x3C32EFD1}},
+    {{0x55981AF50E4107,0x9F3BBF1CE9558,0x194B1D810783E8,0xFCF4BD4EE9E3EE,0x14568685},{0xC4C4B59F4062B8,0x2B46F7ABF23D12,0x68DD36AD41F088,0x2B47D52F87CE64,0x31C563E3},{0xBD45565587ED1B,0x632A1E9AA4E410,0xC589D5BAB45294,0x1D165E1B9BE82D,0x119E77B1}},
+    {{0x87FDBC08A584C8,0xC67B80698B993B,0x5CF84ECF93EB3A,0x97D771B642862D,0x6742E15F},{0x2F5BA9FC37B9B4,0x3CFC621EE4931E,0x9668AF38F8178,0xC9E573796EAD6F,0x21D30600},{0xBEF41AD41A51BF,0xCE6D344C2BF56F,0x9B38B3D99345F0,0xEDF7EAE11608C2,0x2C4F59EC}},
+    {{0x1797A46ABC0CBB,0x1C1072DE6F2D93,0x276832800F2C08,0x136158C5DDABD4,0x4D1E116D},{0x4E1EFB10C9B91A,0x4B7B5E8A4B84F4,0x54B5008F8C43E8,0x9D4E35B65CC513,0x6D415BE4},{0x7248DB5682ED71,0xC00EE3DD480065,0xF5742E788581EB,0xFF7FA8C2FFE9EE,0x7A979779}},
+    {{0x42148248127D15,0x6172C14BD432CD,0x4524F8E2EC8C2A,0x77A867DDBEE394,0x4B5BAE5A},{0x23B8DE209A77CB,0xCBA57B8C0FA0D9,0x580E6742ECB6AE,0xB38471219875A4,0x739476E0},{0x73E04A58EC63F8,0x29A4C437E01CFA,0x6021C9912D10F9,0xB3AE5B8DF77D5F,0xE40895A}},
+    {{0x167E5A18ECC8F9,0xAB87C739BA5F1F,0x759882D4F1AE61,0xEBE624F050385A,0x28E01E9E},{0x7682A0A58A68C1,0xB4F69B645E2A7B,0xC1AB71048DD3A1,0x8089429B6293A7,0x34A3EF20},{0xC81A664F9BDBE3,0x5628744C7A2085,0xA3800E24764ABD,0x3B6EEA2148D304,0x2D139C37}},
+    {{0x5B3F232869FCDF,0xD51DF337243BF8,0xCF6CA898D06B22,0xC1B9DF13E106FF,0x33BFA90C},{0x9D824FB2DA81D9,0xEF01D2F1098143,0xF109017D2DF4AC,0x6327CAE59FA5FF,0x53B120DB},{0x9155C029D95CAB,0xE1051AE3EDC8AE,0x8E7B97420CB5BA,0xFDC68A7C1592F2,0x46DAE663}},
+    {{0xF70B4A1110CC99,0xE2BBDA2202C694,0x82CCA6BB2AF36C,0x61D6AC87116FF6,0x6759A4F9},{0xA43F61ECF8AF35,0x1A2605BE16633C,0x11600036D4B101,0xCA5F44C7B25912,0x7E6C7C2D},{0x65C433C7226B49,0x7329A5536384E2,0x71450644BE353D,0x6372273002DC65,0x65404DBA}},
+    {{0xD434A9ADE80267,0x874DC7AA8115F0,0x4944CE775EA94,0x109151E787690E,0x56BEC703},{0x2E6B33EC86FB32,0x47706CFAC82B51,0xB4F3710C05CE7E,0x750778CCDCA656,0x6AB2DDD0},{0x2FE484BAD1600C,0x798A535FA67997,0x50D940E0A949AD,0x73C2D65BE28F72,0x6EB24D56}},
+    {{0xBD6530A7C82BC,0xE0A7B5EB28D042,0x17A029C56305DA,0x2C60867DADF3A8,0x4BBEFBDC},{0xE3F6849538107,0x47E10708A09504,0x5DCC3E74F7AC35,0x9C0C2DC979D1CE,0x6EB85CC8},{0x6F7C70029190E4,0x9020A17C492A25,0x36CEE66931C090,0xD6E54BB58F59A8,0x1E8DF616}},
+    {{0x8222BC0B9EFC6,0x7A9C35B370711E,0x58B0F69A449201,0x7C2DED029BC195,0x44492934},{0x1C2AFF2E1D6245,0x158C0D7B25A421,0x1E7DA57C8FFC39,0xCBBDABD645A325,0x77785EC5},{0x54690B8284E8A9,0xD6CDA203E24756,0xB12CB80A9DD895,0xABFF7DED65C4EA,0x76A162D1}},
+    {{0xB6B8FF4EDA202,0xDB7ED51A35EB3E,0xCFB4A08A960078,0xBF2DF9D5D44B60,0x6222BD88},{0x1EFA5782E45313,0xB608BA902B068F,0xED261B7C4F5410,0xEA4ED025DD6BDA,0x325BB42},{0xFD92E9B6740859,0xBE0E9CC4BF862D,0xE6400945603B0A,0xC7D3AE0AC79980,0x628B09E2}},
+    {{0x42AA2D8BDBA597,0x6D9BB93F20911,0x2B25A0A8114E84,0xC84CB4C4AE5FA6,0x23BC7AB},{0x8511DF0F29C9EE,0x4B8F2C620DCEED,0x371D7206E904F9,0x39ECEB14C95020,0x4D2B97A7},{0xFB20AB2C14539A,0xB489BD80780B30,0x88D6DBB73CD62,0xD7A4684879651A,0x2BE24DBD}},
+    {{0x7640E33263467,0xCAA6CCEA10D880,0x49CA8A61DF2CA8,0xDB5C4041C59A8B,0x132A065E},{0x65FA3E1DD7DE2F,0xB0DC31FE8EA598,0x7B85E5CFD1B390,0x3532F780762D6B,0x534EF70A},{0xF25B0E72ECF407,0x5CAF4DC3698F94,0xE675C5F8F5FB82,0x824E05A5D52956,0x13DE9F98}},
+    {{0xBE33FBBD39D169,0x6856F0EF5CF0C4,0x53B672C84797FC,0x7137B4A5980AA4,0x6D5066CF},{0xB347115219A417,0xB4222EA95B5C,0x5ABEB81857F952,0x2A0A87C883ABE3,0x54BB8CD8},{0xC8EAD868AB7C70,0x2DBA8CF94A238,0x7E2A8E6F1F0A95,0x30E7FE661C9E40,0x609142E1}},
+    {{0x72429C7B04C2CD,0x310FB99A0B2750,0x5A74BA0A8F63C0,0xDB0869347F5821,0x35FF8F7C},{0xC49CBAA6CE8B8A,0x5717DFE1A8A90F,0x6953BB606B4E1B,0x71155F055469E8,0x50E1CC68},{0x5A89B38C30E3D7,0x3B454C5FE98B88,0xDD87B7B1B73FFC,0xD1B1295198A17A,0x330C0A7E}},
+    {{0xF2120A622E0213,0xBC64947385A12A,0x79A8328E54012,0x7F4BB26F6B4E87,0x6C6365C1},{0x9499E5494C782,0x332A60B8D3EB03,0x56A9EC8E08DC,0xD3D1A968C8320A,0x1C5703A9},{0xF2125C8B8F0450,0x48345349999FCB,0xBDFD36C7722C18,0xE2332A8FFE8B6,0x397F5DB8}},
+    {{0x944C675BD887D1,0xE51848C1E18F3B,0x41BE7CEA83479D,0xB31D52CB83001,0x68B818A5},{0x28E4DFED398826,0x965535ADDC7747,0xD7536D8F439685,0xC00766B228EE74,0x1E8B233E},{0xA795099C995B42,0xEFDA8558CC28F4,0x8609195F0DB4C8,0xDBA8E29D13895E,0x76724D74}},
+    {{0x73E8BE859362A9,0x50942DB5B00E4A,0x76629DEAB2D3AA,0xC8702D4E34073B,0x6B66159A},{0xEE1A22C8CA96C5,0x883226031E75F,0x5D584432B9CE63,0x38EFD504E49B3A,0x19DD4BEF},{0x500356E7C4FDC3,0x9BF6674EFCB3A3,0xA0108C489ABF3C,0xE0DC31CD4E134A,0x667FBACC}},
+    {{0x145CEB3B5775D0,0x1EB8B84FC95056,0x1520A9F5ABF4A3,0x599B1C96DA8294,0x51F4FF8C},{0x8406B0D7863AC1,0x807807D4BD1B7F,0xEE3852EEB4B12E,0xD46E41F3F6F99A,0x35AC9588},{0xDB720708D6C911,0x3155901774B08F,0x71B22566FF0C80,0xDA58F2EAFB8946,0x4DA02F54}},
+    {{0x729B6A71BF9741,0x6C0EE66BF8F3EC,0x61D852682FA569,0x133CA63F63C081,0x568DE690},{0xFDB123773039E8,0xAE7F4D743E3D1B,0x433A0E65B43A5B,0x92E8E64741DCDC,0x4C482209},{0x6FDBC4170A98EF,0xE02486119E900,0xB90C9E3267B426,0xF75E73F7877BB3,0x4090F6EB}},
+    {{0xB206C8B59F5785,0xA9E6FAF03F479F,0xA4F97D966F9BB1,0x7F6CA632750965,0x4F2F4B47},{0x80269D9359E934,0x8525C23CCCF254,0x8A70462C16AE3,0x3B8A8439A16D32,0x13115F87},{0xD7361DBBB4A6A6,0x956EF415A6590F,0xF6C80941F33592,0xBC222F1431A966,0x602C6BF1}},
+    {{0x730CC4663403DA,0x8170F9B524BC6E,0x9FDD237CF4E952,0x7D55221DEF46B8,0x3342C471},{0x9DC6A85B6937C5,0xEA46686E61FCA4,0xF1FA7DD2671CD7,0xC935368D54CC,0x50676CDF},{0x3AB47AFD50B8BB,0x2837439A0DD392,0x2C0010465D2D5E,0xB4A4FDC9BC305,0x2D3C40A1}},
+    {{0xFB0FB8F1ECCCCB,0xD0541F48DF6E99,0xFDBA88D599FA2F,0x73B64ED0A93070,0x282A4009},{0x562DD27AA84686,0xA0D1E0C3150C7F,0xE01AC6BFCD9ACE,0xCEDDBA93595C9F,0x5A8A95D8},{0x84BDED88F6988A,0x46E9DA3C0BFB9C,0x7B730E861FAF13,0xC8D4EB0BE29506,0x7CFC2FE7}},
+    {{0xC29D9ED297DBD3,0x338E8186376520,0xC0A9F0D58952BB,0x9F15C20D43E5BC,0x7AAF48F5},{0x69896BF1A58D6E,0xAC8E8E0934DAC,0x63BFE62DE38A8F,0x9E76638C36149C,0x2765BA6A},{0xD086D5B16AC088,0x1118CA6F1742FD,0x4FA3C1B85BB38D,0x6ECCDA21B7F2AB,0x3E86B775}},
+    {{0x4D979BAA2329B4,0x5F4CD49F7C39BD,0x55891B95913374,0xBD2B4355CE5F8C,0x336498F},{0xE08A7C5DD5CBD8,0xFD52FFF48D9AA1,0x37969B109FAFE0,0x16279CE7E44B1C,0x653338B6},{0xF718DD49593F4B,0xC92F3E0AE3DEE8,0x9F0A102487C34D,0x696C043913AF91,0x2DFE0C21}},
+    {{0x6BA45D29424D9A,0xD27B914D8AA86F,0xCCC52201EF36DF,0xFC50B33D58EB8D,0x3396978B},{0xD0CA4AC8073393,0xAC7CA7DDBDABB1,0xBF9107CCCB453E,0x113C127DCB9D35,0x5CCF1359},{0x8F30EDB0EB0649,0x7B381740B9BF78,0x384C900519A298,0x5ED5A4B9A29C57,0x5C6B84DC}},
+    {{0x8047AE60B7E824,0x85C9C2E723E5FC,0x84E14E29A098E6,0x3C45F32C952D39,0x4C27AFFF},{0xBABD114BF5A66B,0xBE1E51A4C49E5B,0xB626C29C3A90D0,0x526DC87D95F11E,0x5F2C99E6},{0xE731C946F1338A,0x64826663ADA9E9,0x7924B6A1478,0xBF4602FD4E156,0x5A164FD}},
+    {{0xEFD1B43224E085,0x2C728FBFA269FC,0xF7907D6EE4F695,0x33EFDAF7A08157,0x786BE307},{0xAB0712C63E2736,0x8BEB39D69BE4E,0xCDD4FD08472A7C,0x2F34985B34270E,0x653A5F77},{0xC4E817719F64C8,0xEE5557BABD6E00,0x9A5BD3D8EC96C4,0x4D313E8B0D9066,0x12C73ED3}},
+    {{0x25CA89F193C7C7,0xBACC8756D94B31,0xA58B84F09BAEA4,0xB833951CA2FD3A,0x9C186AF},{0x349A357F7B062F,0x2A6BBED54FF11A,0xB149864A1E02A8,0x6027B353934695,0x6137B074},{0x1D62410E8EF362,0x3B43F388AD238B,0x6DE38C20AE2EE8,0x7F263D8AEDE054,0x572C78D3}},
+    {{0xB822F04C2EAA13,0xD06BEB4D19B36C,0x815BC8DD9CC6A4,0x4968A933DF8957,0x21FEE480},{0x60D3E930901700,0x367A8972C23130,0xA150858339BDA5,0x72CB51D416C5D,0x500B7740},{0x80A584E1B381F8,0x7116E20797F0DD,0xEF05E894ABEA46,0x8C188FF0688E27,0x198588F6}},
+    {{0x19E3A2B12D4F17,0xCE5973C995549,0x365C89C9E8EDA1,0xEEE4E082B813E0,0x4A2E1F96},{0xD4B832AC846FC4,0x9E517335A66444,0x88BFDF0DA8DC22,0x2E185C5B8C9511,0x6C3F2482},{0xB0B2D34C797678,0xA2B5BDA4784152,0xF120C82249E465,0xEF8DD261B29B6C,0x2DDEBACC}},
+    {{0x41449EC0EC3464,0x30EA6D0536A0AF,0xBD869D24354625,0x5494D7466AF195,0x5DBD3BF9},{0x7CE1C737E25B77,0xCE2A7B7B9F8C13,0xC0A8992AB9A342,0x76E9FBB0863CD8,0x56F5F777},{0x94643A2E2F2569,0x438308B34BBA73,0xA2D1B85F606BBD,0xBB02BC1524041E,0x5844F533}},
+    {{0x70BADC76ED5685,0x11AFD275E1193,0x7DF9771CEBB58E,0x4575D3C0F1F2D5,0x4B370204},{0x2027ACD289B820,0xCB0FAFCCE29248,0x80E5606AAFE36D,0xACF332F52F427A,0x54333C50},{0x4A71DA3C1535E8,0x23A8404594EC3D,0xFB8004594F3CF0,0x260F81DC8A4A79,0x1D1CECDF}},
+    {{0xB7136E1146B3DF,0xADACF1DD564E28,0x65E9488F8C358,0x490AFB6AE4A198,0x77FE8A5D},{0x75C5AFA5F50246,0xC9FE0A3545BA6D,0x3395218D9122AC,0xE039F3168AC003,0x3C530F01},{0x2D66861B52AD2C,0xDCFA95800906FE,0x63FFCEEB583AD8,0x7726081F8524F2,0x25A2C58C}},
+    {{0x5B945652014031,0xAD8EE52AA8A28,0x382EAAB5CD8D05,0x4FB2BF787B7AA,0x543D84CB},{0x932BA4DE59EF20,0x2DD49A42EC2E6E,0x8F182B275846F4,0xB63ED49E693D83,0x358FDC5},{0xC7264A03982220,0xE29DDF18D5A7E5,0xA73CE00C8E6A55,0x3F4B726C3C9A06,0x45A56CC}},
+    {{0x70E1FB4F605EA1,0x95B4094F551F6A,0x6180181C63633,0x86A424B4A42725,0x2AC4C03},{0x74860D7DE3877,0x30E554FFA874F0,0xFF0721FB77FF43,0xFC30E5E46B07B2,0x1A36C19},{0x85551A500BE480,0xE771B4C2E80382,0x9A67670AF94759,0x1E3434693DAD0C,0x234E1493}},
+    {{0xB3A6DB62A039E9,0x8C3CA3989002F3,0xF442E4F59A378,0xA240FE9E15052C,0x2D2DD667},{0xE8791506554DD1,0xFD115CB838DB76,0x4639BF0C8D64AE,0x79C5D85227BA6D,0x377BD9DB},{0x600C4B30E63981,0x6365BB5903CDD4,0xD7EA974938CA97,0xAE006E04B09A6A,0x4C799521}},
+    {{0x8283D3AC2CC513,0xB600A505F7297C,0xC2FD6F455861F,0xD466B9B65D099,0x2816F843},{0x89B17E74B47F1E,0xDF0664AB5A184F,0xEF0C66AE08745,0x5430EA383524C9,0x5452C4B4},{0xEC039E4BB35752,0xE1E8876A5423,0x758C3CEA025938,0xFD0D886BB24E5B,0x464A3C75}},
+    {{0xC46A6FBA4BBEF3,0x47BFB9BCDA01AD,0x850560BFB1E47F,0x6A2C5ACFB1587,0x1CAEBA6F},{0x656A7BE98D85B8,0xC180C6BBD59D39,0xF54225DC51A91E,0xE7EA75774A0FCE,0x65FCDC11},{0x96F393BA689749,0xCDE9D5F3072B79,0xD4B6D14F2588C9,0x4FCC37B382C327,0x2176013A}},
+    {{0x50F5D51935A5C7,0xE902534C8C8CAC,0xC720DD0967C6B9,0xBF5ADEF4C8C4EA,0x60C2952},{0xA84B4205427F5B,0xC571B01CAA4734,0xDBB01FBDDF2B2C,0x4482524977C653,0x10EF5D49},{0xE8DB40CFCE84B6,0x310F9E4B23C0E7,0x5EA465FEB69C76,0x17D36D9C8F3C2F,0x6DB3FC34}},
+    {{0xA537B4701F0C00,0x3591596E892C45,0xDCC07651F9902E,0x23F4E95516A15F,0x5D416989},{0x364780EEF8BC11,0xEE327DD41077C5,0xAF0B8298FDE48A,0x28E9F2E8BEDADE,0x2D92794A},{0xDBA9406D690B66,0x21885454FFD234,0x2EDA35F1D9F878,0xF2785C85DF2E1F,0x35D5103}},
+    {{0x4489C13FDC9FE9,0x4AFF90C1E42774,0x251DF4CDEE3CA7,0x64BC4816637F94,0xCC495FE},{0x5E06036E75198B,0x28D3E38C1A6F6A,0xE669437AB9E0F2,0x6CAB977EFEC0D3,0x42138E7B},{0xCC64E4DBB7E189,0xD70A9E26D83C31,0x159A71107F5B56,0x6633210782084D,0x3D0AC8DA}},
+    {{0x7AD644C7DAD28D,0xDEE1B81D7D26DB,0x371C7E177D7A9D,0x38185E7C2D8D04,0x1BC7AF1E},{0xF2F65900314833,0x7E12631B270FCA,0x87795DC0491D02,0x55661F2F7A5EEF,0x61D909D8},{0xB845216636C2C7,0xF23656DE7EF851,0xDE4B1F0FBD9BB8,0x54B8FA44CCB664,0x1A340B80}},
+    {{0x99938218028354,0x8975D8DAA7D007,0x5A6BB8A3D9F2FA,0xF8C2596BD22835,0x6BCE245},{0xFC955188A3C065,0x418B0DE8789496,0x2F10754858C2C9,0xDD0F6DA0C92ACD,0x3D26989C},{0x4B65EB8EB94B17,0x9C00C22966C6DF,0x938435E42D1AFC,0xE653AF10261266,0x7A9F6260}},
+    {{0xBD89041B29662F,0xEF0EB7DD6EEE7E,0xC9C27FFCB40CB0,0xAF4445EF643C3A,0x7665908A},{0x83A00E4B704CA1,0x1938B8AFA41370,0x64F02B4096522,0x50DA4546CE17F8,0x4ED18A7C},{0x354343B9EC13BB,0xD2CAA1BF86A468,0xA382D9B1B09061,0x2D4DBDCCDC8C01,0x6BB9CF0F}},
+    {{0x9D954E6C16D4F7,0x5CFE522B910F5D,0xF33BA4E630E534,0xB5A04AA90834F3,0xA09B36E},{0xA2EB0FA35ED926,0x9EE4D4373B20F3,0x2BAEED533D06CE,0xFA3110A24B6EB,0x3AA47FD6},{0x23B1CC6B04C053,0x9949F32E2B82FE,0x842FFE05902F26,0xB4648D58A69F80,0x3BD5DFB4}},
+    {{0x9CD5451113735E,0x62D2BA6E7D2091,0xA8BF5649860BA1,0x638E6D6A80C8B5,0x1C71CE37},{0xE8FEE129E406CB,0x183F447A972CE3,0xD79AA0CFB7D40D,0x2003B2CD243DBA,0x7880CC1C},{0x2B0EAEFC5832AC,0x95C03DDC5E0178,0x425C43BA6534E3,0x746451865BA006,0x79030A47}},
+    {{0x1B9E7F74CBC8D6,0x79446C852CB193,0xF895C2CFE5120E,0xC1DF2F7D897A82,0x3C607A84},{0x779A86BA3CEA68,0xE0A1731A060CEA,0xB489DBEE184987,0x9941A3A2384BA,0x34518AD1},{0x883C6C9E37345D,0x2A384090A73115,0xDDA983B396EA5D,0x32E572F3F0ED1B,0x727055E}},
+    {{0xAF417FFBE2DA0,0xFC66A638E39C31,0xDD616EF7F13A17,0x2000BC663FF938,0x89B6CD0},{0x8816F13E8CEB88,0xE4A7CDBB12A3E7,0xFD11CA657E43CB,0xAA36DFD8B438DE,0x66EF7206},{0xA478374DA76D28,0xD29A277B10BAF,0x91BE3DA0759BA,0x511613FB4770F3,0xD2C585F}},
+    {{0x1EB2D6FC2C9FDB,0x862D87067A522E,0x434677906D2B72,0x60917D60F87AB5,0x79E9D5B},{0x1381C04C78797,0x64FCA385C75839,0x9450BFA2256400,0xD2240A453126CA,0x16512951},{0x41B9BB33B94E2A,0xE4638B80E195C4,0xBE51C807E7CF91,0x9580B1392CCBE8,0x18A2CD78}},
+    {{0xC83C41CB05DC3F,0x68E399382C0423,0xFABFC732D3F955,0x4210DCDE5D1BD4,0x75D942C0},{0x65C4874E35AB2D,0x3FAD47A4246797,0xC5771731CBF38E,0x56CDC13C8FD7E2,0x696CC148},{0x81588C9993C204,0x8A188583D5E315,0x7FC5F74338684C,0x8686C9B6A116D3,0x6875393B}},
+    {{0x90A57B885FAE14,0x17245E8BB210DF,0x1A61920FD4A3C3,0x1CD8BD76AD5A19,0x6D12E0DD},{0x24A3028F70BD8E,0x20F7DAC4675A4D,0x6724057A5B810F,0x74FDE7802A0B83,0xD5C9E4B},{0xD66FD9DA4DA844,0x2EDB5E60BF7DC5,0xA47F9F2659B988,0xA755B5D16A2165,0x3211CABD}},
+    {{0x3B9F2D199B0017,0x9B44E6B6D1C82,0x851013B99F3FA9,0x36E8889EC5D591,0x7D04264E},{0xA3319AE930F866,0x8F15BF93FD8DE1,0x78A9A333FABC27,0x424B827F9C7779,0x6CC9F269},{0x4E22632F5CF734,0x8B60DB94FC1519,0xCB9C431B0AE3AA,0x84960D7DAB0A63,0x3770C168}},
+    {{0xEBFBA21F5FD594,0x81AD20F83407E1,0x369581A12D0630,0x9A2BC1AF0B11CF,0x16C1556C},{0x1335745EF14F36,0x93DEB8CF11D728,0xEBE973B5B805B3,0x158B0F891E19AD,0x23E38CD5},{0x1CC62395A6A828,0x8C63626B17DF0E,0x503FE7A27D2F08,0x2095B7FD9215C5,0x29B8D1DC}},
+    {{0x211AF2B10518F5,0xA30DAA119302DB,0xFCE98ED8D56CEB,0xE1D150C695796B,0x1723BCB3},{0xE689807682B3EA,0x75FB480250F556,0xDB0C7EBD78AAF7,0xE08EBB23403980,0x5D4BA682},{0x1E8FD67E2023DE,0x9ED74F6CDE3D92,0x84F5FC77E439C9,0xED27A2AE4F0664,0x20CAE63F}},
+    {{0x570FE618E77933,0xBFC4AAA7A01593,0x4A695E9574304F,0x7423EB00E4455B,0x456BDF4C},{0xDD0B42C46C2997,0xD097349B5C29C0,0x8EE474638079C7,0x6C68E87C2BB037,0x579782C3},{0x5BE5303A1908ED,0x97D11E54B7EBDA,0xECAEF2EC895883,0xDE7C3DB6C6B55,0x5DACF0F}},
+    {{0x2EA339F4412193,0x88A83AB75CF585,0xBB165D9E458D45,0xDF0AA2113B456B,0x2269A46C},{0xB68F85514C514E,0xE03841FFDFC027,0xD9D82E1FA1CEA1,0x1FA997F21B8A11,0x489CF377},{0x37104537CC4644,0x1A5F15E8F73ACC,0x6D3A5C8DC0DAFD,0xB2743EA63D6EEC,0x66A9B0DA}},
+    {{0x6B804BB683BE22,0xA89B99EF5E2443,0x2B94033B8D25FC,0x15CC9B7695E73E,0x66E632DB},{0xFAD6A6134AF084,0x6D5C7EF6074693,0x6F048E7A6F65E,0x194CCCC190FFEA,0x534E3C9C},{0x384DDF8800DB95,0x50443BABDCA625,0xF88E7B9652A1E9,0x4F0CCDC3C4D562,0x7A4DEF7F}}
+};
+/* End of comb table */
 #endif
 
@@ -47,6 +47,12 @@ const BIG_256_28 CURVE_Pxa_FP256BN= {0x9C09EFB,0x2616B68,0xF843CD2,0x539A12B,0x1
 const BIG_256_28 CURVE_Pxb_FP256BN= {0x37E6A2B,0x69ED34A,0x3589D2,0x78E287D,0x3B924DD,0xC637D81,0x4DB5AE1,0x738AC05,0xEA66057,0x4};
 const BIG_256_28 CURVE_Pya_FP256BN= {0xEDC27FF,0x9B481B,0x15848E9,0x24758D6,0xE51EFCB,0x75124E3,0x376770D,0xC542A3B,0x2046E7,0x7};
 const BIG_256_28 CURVE_Pyb_FP256BN= {0xAAD049B,0x1281114,0xA98B3E0,0xBE80821,0x29F8B4C,0x49297EB,0x42EEA6,0xD388C29,0x554E3BC,0x0};
+// Frobenius endomorphism psi coefficients, in Montgomery form
+const BIG_256_28 CURVE_Psixa_FP256BN= {0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+const BIG_256_28 CURVE_Psixb_FP256BN= {0x5A0E8A8,0x5ECC91A,0xAADD7C2,0x1239A07,0x66E79FF,0x7891F07,0xE3F714A,0xAC74DC3,0x23C4321,0x7};
+const BIG_256_28 CURVE_Psiya_FP256BN= {0xB684A80,0xB9F0B4,0xB164145,0xAD26833,0x6E2F3DF,0xD114088,0xA20DDD1,0x53D105D,0xF7FBEA0,0xE};
+const BIG_256_28 CURVE_Psiyb_FP256BN= {0x36AE593,0x1D8ED06,0xCF4418E,0xB8D48F5,0xDBC18FC,0x8DDA691,0x3260820,0xAC2BEAF,0x80415F,0x1};
+const BIG_256_28 CURVE_Psi2x_FP256BN= {0x8A0E8A8,0xD9FC1B,0xDD7059E,0xAA44234,0x2D47511,0x1D30FD5,0x9E5FBC,0x79BBC23,0x23C4012,0x7};
 const BIG_256_28 CURVE_W_FP256BN[2]= {{0xB054003,0xF0036E1,0xE78663A,0xFFFFFFF,0xFFFF,0x0,0x0,0x0,0x0,0x0},{0x1615001,0x5EB806,0xD1,0x0,0x0,0x0,0x0,0x0,0x0,0x0}};
 const BIG_256_28 CURVE_SB_FP256BN[2][2]= {{{0xC669004,0xF5EEEE7,0xE78670B,0xFFFFFFF,0xFFFF,0x0,0x0,0x0,0x0,0x0},{0x1615001,0x5EB806,0xD1,0x0,0x0,0x0,0x0,0x0,0x0,0x0}},{{0x1615001,0x5EB806,0xD1,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x606100A,0x3D4FFEB,0xB19B4BB,0x65FB129,0x49D0CDC,0x5EEE71A,0xD46E5F2,0xFFFCF0C,0xFFFFFFF,0xF}}};
 const BIG_256_28 CURVE_WB_FP256BN[4]= {{0xD30A800,0x20678F0,0x4D2CC10,0x5555555,0x5555,0x0,0x0,0x0,0x0,0x0},{0xD7DC805,0xD6764C0,0xBC3AD1A,0x8FBEA10,0x4467DE,0x8061601,0xD105EB,0x0,0x0,0x0},{0xF173803,0xACB6061,0x5E1D6C1,0x47DF508,0x82233EF,0xC030B00,0x6882F5,0x0,0x0,0x0},{0xE91F801,0x26530F6,0x4D2CCE1,0x5555555,0x5555,0x0,0x0,0x0,0x0,0x0}};
@@ -94,6 +100,12 @@ const BIG_256_56 CURVE_Pxa_FP256BN= {0x2616B689C09EFBL,0x539A12BF843CD2L,0x577C2
 const BIG_256_56 CURVE_Pxb_FP256BN= {0x69ED34A37E6A2BL,0x78E287D03589D2L,0xC637D813B924DDL,0x738AC054DB5AE1L,0x4EA66057L};
 const BIG_256_56 CURVE_Pya_FP256BN= {0x9B481BEDC27FFL,0x24758D615848E9L,0x75124E3E51EFCBL,0xC542A3B376770DL,0x702046E7L};
 const BIG_256_56 CURVE_Pyb_FP256BN= {0x1281114AAD049BL,0xBE80821A98B3E0L,0x49297EB29F8B4CL,0xD388C29042EEA6L,0x554E3BCL};
+// Frobenius endomorphism psi coefficients, in Montgomery form
+const BIG_256_56 CURVE_Psixa_FP256BN= {0x0L,0x0L,0x0L,0x0L,0x0L};
+const BIG_256_56 CURVE_Psixb_FP256BN= {0x5ECC91A5A0E8A8L,0x1239A07AADD7C2L,0x7891F0766E79FFL,0xAC74DC3E3F714AL,0x723C4321L};
+const BIG_256_56 CURVE_Psiya_FP256BN= {0xB9F0B4B684A80L,0xAD26833B164145L,0xD1140886E2F3DFL,0x53D105DA20DDD1L,0xEF7FBEA0L};
+const BIG_256_56 CURVE_Psiyb_FP256BN= {0x1D8ED0636AE593L,0xB8D48F5CF4418EL,0x8DDA691DBC18FCL,0xAC2BEAF3260820L,0x1080415FL};
+const BIG_256_56 CURVE_Psi2x_FP256BN= {0xD9FC1B8A0E8A8L,0xAA44234DD7059EL,0x1D30FD52D47511L,0x79BBC2309E5FBCL,0x723C4012L};
 const BIG_256_56 CURVE_W_FP256BN[2]= {{0xF0036E1B054003L,0xFFFFFFFE78663AL,0xFFFFL,0x0L,0x0L},{0x5EB8061615001L,0xD1L,0x0L,0x0L,0x0L}};
 const BIG_256_56 CURVE_SB_FP256BN[2][2]= {{{0xF5EEEE7C669004L,0xFFFFFFFE78670BL,0xFFFFL,0x0L,0x0L},{0x5EB8061615001L,0xD1L,0x0L,0x0L,0x0L}},{{0x5EB8061615001L,0xD1L,0x0L,0x0L,0x0L},{0x3D4FFEB606100AL,0x65FB129B19B4BBL,0x5EEE71A49D0CDCL,0xFFFCF0CD46E5F2L,0xFFFFFFFFL}}};
 const BIG_256_56 CURVE_WB_FP256BN[4]= {{0x20678F0D30A800L,0x55555554D2CC10L,0x5555L,0x0L,0x0L},{0xD6764C0D7DC805L,0x8FBEA10BC3AD1AL,0x806160104467DEL,0xD105EBL,0x0L},{0xACB6061F173803L,0x47DF5085E1D6C1L,0xC030B0082233EFL,0x6882F5L,0x0L},{0x26530F6E91F801L,0x55555554D2CCE1L,0x5555L,0x0L,0x0L}};
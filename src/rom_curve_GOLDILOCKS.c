@@ -38,7 +38,123 @@ const BIG_448_29 CURVE_B_GOLDILOCKS= {0x1FFF6756,0x1FFFFFFF,0x1FFFFFFF,0x1FFFFFF
 const BIG_448_29 CURVE_Order_GOLDILOCKS= {0xB5844F3,0x1BC61495,0x1163D548,0x1984E51B,0x3690216,0xDA4D76B,0xFA7113B,0x1FEF9944,0x1FFFFFFF,0x1FFFFFFF,0x1FFFFFFF,0x1FFFFFFF,0x1FFFFFFF,0x1FFFFFFF,0x1FFFFFFF,0x7FF};
 const BIG_448_29 CURVE_Gx_GOLDILOCKS= {0x15555555,0xAAAAAAA,0x15555555,0xAAAAAAA,0x15555555,0xAAAAAAA,0x15555555,0x152AAAAA,0xAAAAAAA,0x15555555,0xAAAAAAA,0x15555555,0xAAAAAAA,0x15555555,0xAAAAAAA,0x1555};
 const BIG_448_29 CURVE_Gy_GOLDILOCKS= {0xA9386ED,0x1757DE6F,0x13681AF6,0x19657DA3,0x3098BBB,0x12C19D15,0x12E03595,0xE515B18,0x17B7E36D,0x1AC426E,0xDBB5E8,0x10D8560,0x159D6205,0xB8246D9,0x17A58D2B,0x15C0};
-
+/* Fixed base comb table for ECP_genmul - generated by scripts/combtable.py */
+const BIG_448_29 CURVE_Comb_GOLDILOCKS[112][3]=
+{
+    {{0x15555555,0xAAAAAAA,0x15555555,0xAAAAAAA,0x15555555,0xAAAAAAA,0x15555555,0x152AAAAA,0xAAAAAAA,0x15555555,0xAAAAAAA,0x15555555,0xAAAAAAA,0x15555555,0xAAAAAAA,0x1555},{0xA9386ED,0x1757DE6F,0x13681AF6,0x19657DA3,0x3098BBB,0x12C19D15,0x12E03595,0xE515B18,0x17B7E36D,0x1AC426E,0xDBB5E8,0x10D8560,0x159D6205,0xB8246D9,0x17A58D2B,0x15C0},{0x8EEE402,0x14F10051,0x13FEC39E,0x14C8E9DC,0x2C1D5E3,0x1A114DE9,0x2974A49,0x757488A,0x197BA72C,0xAE1AF46,0x769D34B,0x5553A8C,0x170983A1,0x1A5D674E,0x161190CD,0xD2D}},
+    {{0x8BA7F30,0x16721562,0x12784838,0x1DC2F312,0x1D8BA21A,0x1EF8A8AE,0x130C06DE,0x17CE18E9,0x693FDA4,0x1A70448E,0x9568273,0xDF253D4,0x19A1722,0x667160A,0x12F171B0,0x93B},{0xDE51839,0x1711B7C3,0x353D6CC,0x88850BA,0x9472B5D,0x1CBF50E5,0xF070363,0x44F714B,0x5C90DC3,0x1822BEC2,0x72DF00B,0x1C04372F,0x4B33A5D,0x6F2938B,0x1DF92B3,0x1A92},{0x534B0EA,0xE89A4BD,0x1D591EAF,0x6C02C52,0x58A4254,0x13459EE3,0xD66F781,0x118CF138,0x1C9CFDA5,0x1FD85939,0x1D2B021D,0xD16ADCB,0x52493DF,0x138BA92B,0x48A47C4,0x1B80}},
+    {{0xABEF79C,0x3FEBB29,0x1D10EA1E,0x12D84140,0xD12A710,0xE2E0C20,0x12A1D914,0xCA940DC,0xB4AD95F,0x1301DF68,0x199CFEC0,0x12E24BA5,0x349AEBD,0x5B91700,0x8F81126,0xA8A},{0x7C7BCC,0x752E8ED,0x4E3AA63,0x1D99CEED,0x861D2B3,0xDC01427,0x1ADB87FC,0x4491BCE,0x1869C585,0x10D3D890,0x14E89D96,0xCCF7FA0,0x3EC056C,0x1B0E16BA,0x6E7362A,0x7F3},{0x8078D49,0x1B40913A,0x20759FA,0xD309ECF,0xA433EA4,0xE42FD2C,0x5AD2944,0xAD07AA9,0x1C011D71,0x12E655D5,0x40D20A3,0x1FEA9610,0x152AAF09,0x149CD17E,0x11793615,0x1D3A}},
+    {{0x1153BDE0,0x1129C533,0x501ADA5,0x1C447595,0x1C1AD713,0x127C8406,0x11F605A9,0x12ED8996,0x1685DC8B,0x16BDE142,0xDF0238,0xCD7B2F6,0x1FB45D0E,0x1451ADB1,0x6F15483,0x1A3E},{0xE69E09B,0xA75C39E,0x12F23B91,0x1E2CC62C,0x3BA8D89,0x1047B80,0xB4E1AB6,0xF69731D,0x1B7BD94C,0x59D25C9,0x10231ACE,0x9FE8D74,0x7D1F357,0x154DED74,0x193D3A6F,0x18EA},{0xC529F01,0xC5AEBCC,0x1E72C269,0x2D9B03C,0x12A010BA,0x13FE2E97,0xF6F9F2E,0x179060CF,0x1A089AFC,0xBC5274F,0x8DD05B6,0x9A7F7D2,0x9C4364F,0x3823513,0x18346E39,0x768}},
+    {{0x10ED303D,0x1A018B2E,0x48B5CE,0x16CA2314,0x161CE3DA,0x115E402B,0x2B29858,0x1D02E44F,0x34134D3,0x3C3F2E0,0x64D914B,0x18646BEE,0x135D30D1,0x1B208E6E,0x1BE7467,0xEE9},{0x4CDDF67,0xCAA544F,0x3616DAC,0x1CC70285,0xABDC0C7,0xCCBEE0D,0x142FE4F0,0x74D1FEB,0x1BF7EE29,0xD6D0E8,0x1A2B05CE,0x1D29CC31,0xF1F0FE7,0x15F08812,0x1FA82C09,0x9A5},{0x79FBEA0,0xE225F64,0x5FD2CED,0x1E90549E,0x3E85FE1,0x5317FF6,0x336151D,0x1B3894F8,0xC93B2CD,0x18BED4C8,0xF80AD90,0xBD123D5,0x1FEC092D,0x1D6777A2,0x93D9196,0x1E46}},
+    {{0x37DACC4,0x12C783D0,0x1E665DA1,0x1B183CDF,0x1E9136D4,0x46DA42E,0x5A95EC4,0x1F471D92,0xEA1A4BF,0xB483A9E,0x1B950E23,0xD0F34D2,0x18A17D22,0x9D191D2,0x8558865,0x41B},{0x3D41EA7,0xBF220E6,0x1AFAECB4,0x1F72989F,0x1A6C7B42,0x11A3612A,0x1132B476,0x93AFC5B,0x1C23A3FD,0x12C22C24,0x1918C841,0x177CA5CE,0x17344560,0x51E01FF,0x4EEEA4B,0x9BA},{0xE9E6D93,0x1D21DE35,0xCCEDD54,0x13242D7C,0xD0F8A60,0x3CBB3F9,0xCDD9699,0x102EE77A,0x190674A7,0x5F783D6,0x1AC265EF,0x1E47397E,0x191C98B2,0x6A22FC7,0x11CE6DE6,0x15AE}},
+    {{0xE67A9EA,0x1CDA93E3,0x18B27358,0xFC7A726,0x178B3736,0x144656F6,0xDCF935,0xAA796DD,0x1D9E3D34,0x121D5FDC,0x24573FD,0x18CAAADB,0x1F405852,0x1FA08B21,0x1839FAFD,0x191A},{0xCF807C,0x18BF7628,0x1B00D1C3,0xCCA83B2,0xA0EABF7,0xCBE56C9,0xA39F7C8,0x15F92238,0x1C1E7B71,0x1FE40776,0x1741088A,0x19D6E2E3,0x67F6BD4,0x126DB264,0x9EEB8B3,0xCD4},{0x5783FB0,0x7124092,0xA1CC0EB,0xFE7D8C0,0x177D5A11,0x144BBAE,0x1F75254B,0x1F76DAAF,0x1097086A,0x1B864717,0x107BC4DA,0xAA6867F,0xEC40F99,0x18449BF0,0x7D1FA2F,0x1B40}},
+    {{0x9120262,0x1F6DAFDE,0x681DDA3,0x18C60168,0x17ED68C9,0x13C6AD9,0x1BABF5D3,0x13D893F3,0x1D6F5B41,0x13704EAE,0x1A2A4601,0x189E605B,0x9290104,0x174FCB37,0x100BCDB0,0x1BB0},{0x61D7985,0x66F3764,0x11F2A083,0x1EA781DA,0x1C83158E,0x49B6A76,0x10991AF0,0xE495732,0xB9A0193,0x81FDCE1,0x1C285AB3,0xF35FDF5,0xAB8138,0xABB38BA,0xACB4056,0x356},{0x6C1BEE2,0x1A385A3F,0x9C34EB0,0x554FB4E,0x9D3A701,0x1B7DF5CC,0x18A20615,0x14E9394E,0x7EDB406,0x16C7616C,0x5837FE4,0xA5A8B08,0xB52DCA0,0x684544E,0x1107314A,0x1ACA}},
+    {{0x73EC9C3,0xD93D78D,0x1DC3E9C9,0x96CD5B3,0x158CF73E,0xC03B927,0x15E6524D,0x387F9A,0x179DA0CC,0x1E48377D,0x1F484165,0x11AC3D2E,0x12BE703E,0x1B4F66B9,0xA6FDB42,0xDFA},{0x667128E,0x1E532C56,0xB1E1CAC,0xF94006D,0x18535583,0xE64B4C2,0x1A01D73C,0x22B3E77,0x1B03809A,0x38CF8DC,0x13B65CCE,0x14BED103,0xFBE902,0x38F466D,0x11A6D38E,0x9B1},{0x107F3C58,0x1442EA7B,0x12A41F0,0x17D1E547,0x1D24742C,0x301B1D0,0x1DC3FDBC,0xF5BB18F,0xD951C05,0x1651D18B,0xAF4B69B,0xD09C1E0,0x1FF22666,0x7D8ABCA,0xAAE9AAC,0x1DE4}},
+    {{0x145D5A19,0x185424C4,0x11B084C7,0x1A8F5673,0x4F3FC35,0x13AE0141,0x1227BA04,0x1477CEF,0x1B7C90B8,0x149D4248,0x18C68A2A,0x688A72E,0xE816C0B,0x8722A6B,0x1E2FA1DB,0x450},{0x6DB3BF6,0x1F765C52,0x15515DE8,0xA681E52,0x89A00F8,0x3D3BCC3,0x15D2EE45,0x6D308CB,0x17DDA3C7,0x1904A996,0x13C5D412,0x86ADAAE,0x16F4D86E,0x1C43B71A,0xBA3514C,0xE18},{0x16A4A610,0xBF795F,0x1D62A796,0x4C0008B,0xAAC4E30,0x1E27FFCB,0x1117AC48,0x1DE27289,0xF439D1C,0x7092562,0x14BBD1BE,0x1C95B886,0xC36779C,0x13C13C3,0x2535AEB,0x1381}},
+    {{0xF075566,0x1FCED5BD,0x17D5BC62,0x1B09C534,0x1AF64E56,0x169D2622,0x129A9CC0,0xB19E6C8,0x8156B6,0x1297DA04,0x1E73E5AF,0x1E11E67D,0x38CAA2,0xC4A7F49,0x1CB8EC98,0x19F5},{0x224CE3F,0x1F9506DE,0x564BAC9,0x1DA0A01,0x1F95889D,0x1280BA1,0x1E1DF257,0x15351148,0x1FBDD63D,0x14433AA,0xB3F1FBA,0x2772049,0x1020F381,0x173231A5,0xAB31815,0x78B},{0x169E19EA,0x14A5427D,0xAD20BFE,0x14E3E68B,0x1C60B123,0xFE1C374,0x1185F83B,0x9AF0732,0x247F72C,0x8971F9,0x163189DC,0xC7A1E04,0x911AB2E,0x16B93317,0x646F424,0x1C54}},
+    {{0x4010F4E,0x128C2B8B,0xC14DBAF,0x7C16289,0x14887D66,0x7D655D8,0x1B7B7D61,0x14758395,0x18FAF175,0x11E5A1FD,0x1B57E64A,0x11486216,0xAA28517,0xB5FF962,0x65A62F5,0xD39},{0xA4D972E,0x1B9EB1B9,0x1A560E00,0x27AB765,0x18D89158,0x53DFBE8,0x15D5A28D,0x1034B9CB,0x331F45C,0x883385A,0x169C7E5A,0x3D52E4C,0xEB3B07C,0x23E6D8A,0x23ABFB5,0x1BE0},{0x1271A1A,0x1FFA51AE,0x4E97CAF,0x16B4DC52,0x4721A4F,0x1AD0F02,0x1E4F573F,0xA5EA53C,0x11E1A28D,0x4C17D15,0x18FD0CD,0x1B1124D6,0x138AD9EE,0x12B77662,0x1EEB7DA8,0x6AA}},
+    {{0x3CA8CBD,0x128D292,0x18BCC3C2,0x1F0AC8FB,0x1AB3D40B,0x58B24A2,0x7004355,0x10B9336D,0x1FDF1F84,0xE5BB7EC,0x1575DAA8,0xFCAEE85,0x7A8A86C,0x5805E63,0x12CA1999,0x78D},{0x1B425CA5,0xF44ADF4,0x1B5ACEE,0x4DEA7F1,0x188F695A,0x1F7573CB,0x7287D5B,0xB4DD22,0x15CCB545,0x135E25F7,0x19559C77,0xCC62A46,0x118CD028,0x102ABA35,0x193C9814,0xDE4},{0x11F8B562,0x134FCAF3,0x157BD991,0x2000280,0x1A00CBA2,0x1E40E12C,0xD6FC2A,0x1918092F,0x171961DF,0x5E6B0BF,0x19A5AA97,0xC6A86E4,0x179D5F5D,0x44EAC71,0x3C03946,0x1CF7}},
+    {{0xD3FDF7D,0x8BC567E,0xDECD43B,0xF5F327F,0xCA7098D,0xF985DAB,0x1F9206EE,0x10350ADE,0x1BB06CDC,0x344F29D,0x67274CC,0x11411739,0xC964BDC,0x15C956C,0x157F201A,0x1185},{0x225A881,0x404B1B7,0x13CA0CFB,0x62E13D5,0x157B9482,0xA9528F4,0x1FD419D0,0xDC9FD3D,0xA8E14E8,0x581430A,0x1C3D96DB,0x11CB1DB5,0x1911AB24,0xBCA63BB,0xC2AFAAD,0x52C},{0xCE0165A,0xD210079,0x19E9763B,0xD651018,0x16289F77,0xEA4C266,0x19AC6DBD,0x16AF7ACC,0x4F24126,0x10807C66,0x12F7447D,0xA3437AB,0x9CD8757,0x57283EB,0x267AD6E,0x10E8}},
+    {{0xF3044A9,0x8EE52BE,0x16BD13D5,0x162715D5,0x1B171A8B,0xFCA3ADC,0xBB9B48F,0x54015B0,0x1C520781,0x5FF8E6,0x93707CA,0x19C750E9,0x5A27DC4,0x15367A9C,0x1CF5786C,0xB79},{0xA97EEB0,0xA9523DB,0xB543301,0x144BC470,0x1185F0A5,0x1F0C193E,0x438673C,0x1671EFCF,0x33AE780,0x6DF5D71,0x14FA4DDF,0x14EF92F9,0xDB1C6E3,0x18448D07,0x15F8EB04,0x1E41},{0xC2190D,0x72B3A11,0x7AB3880,0xC5AF341,0x493A376,0x60A8A02,0x14DC07E0,0x1347C22F,0xD22FD2E,0x191AF965,0xB7B61DE,0xD350F94,0xF2D7ADA,0x171DD86,0x1A8045F5,0x3B}},
+    {{0x1FACB83C,0x14B15E40,0x15264E2E,0x1029D052,0x7F52D3B,0x17FE3D35,0x6EC930D,0x108E4B45,0x1C0CA548,0x991C642,0xC8EC02C,0xAE38B93,0x70FE0BF,0x1ABC7ECE,0xC66A79D,0x688},{0x9589064,0x19C81BAD,0x1EAEFE6E,0x176BEE76,0xABBB9F4,0x888412B,0x1E04BDF0,0xBF22519,0x1D083E51,0x1BD48125,0xCC69F8F,0x13763552,0x466F67A,0x11AC593B,0xA4D0A4C,0x61},{0x1B9A5B32,0x1CBB976C,0xFD3CA41,0x2501A08,0x11142B38,0x1478CA23,0x84A685D,0x9B1E7AE,0x1BC119F0,0x9B3B6EF,0x1B99D411,0xA35EF1E,0x6B8F400,0x2FCABA1,0x5D602A7,0x1798}},
+    {{0x646CE03,0x4CF7CC3,0x4C39840,0xF42ABF0,0x1729B6B0,0x1DBADF78,0x387781D,0x4D88DE1,0x1C57ED05,0xCD7A97E,0x625868A,0x1275C13B,0x13297B8E,0x8C2CA93,0x156D42B3,0x224},{0x14A6ACDD,0x2BC8CED,0x111475D,0x6E114AF,0x1283F7B,0x102D85E8,0x330F649,0x185D05E8,0xEC82BBD,0xC3955CB,0x1A030593,0xD53243E,0x1883C17A,0x1000F87B,0x191E0E0A,0x186C},{0x11413E63,0x118C18D2,0xB6AD074,0xD6185B0,0xB563ED3,0x4F85BBF,0x99A1D56,0x145C6801,0xF2688A3,0x14EB66DC,0x6AA0DF7,0xB5D9BA4,0x13269F8C,0x1E12159A,0xF79CAAE,0x7EC}},
+    {{0x1AC38939,0xFB478AF,0xBE00430,0x367BAB4,0x10A35F14,0x1A7BD614,0xC9CE215,0x1A5B91E7,0x1E1E95FE,0x3EBF61E,0x114495EB,0xAB58C4A,0x33E664E,0x15D2B37E,0x1A34D20C,0x1A72},{0x1C026448,0xCC0148D,0x14936929,0x1F96424,0x14827A36,0x1DDE53EF,0x17217298,0x67F9872,0xEC8E9F7,0x1B867AB3,0x1A6F5197,0x122D06BD,0x1111372F,0x908F336,0x1B3E4136,0x180C},{0x1D89B469,0x109400DF,0x1C634653,0x86B75AF,0x7AAC4E7,0x1A66E56D,0x9A1C472,0xC5C709D,0x1408EE7F,0x1AAEF279,0x1E17198D,0x12A94D1A,0x55795BE,0x16DEC7D6,0x1A90F9A8,0x154A}},
+    {{0x1815AE38,0x13AAE232,0x158476D5,0x15B87D0,0x1B188DD5,0x3B19CCC,0x2704B64,0x15FFBEEA,0x1DE238B6,0xF392DE7,0x174E5FD,0x12E8A1AE,0x160B944C,0x192DB2F,0x1FF0C9EB,0x110C},{0x13763EFF,0x1976E220,0xCD07ED8,0x11125816,0x1AB3A7F2,0xC59A5C1,0x1B4570BC,0xEF35420,0x1C61BB22,0x17EB905D,0x1CA973EB,0xACAC6FE,0x1B6EF43E,0x13B97ABE,0x1F19ED63,0x19D6},{0x13E26027,0x3A0343E,0x1E8C139C,0x1592268C,0x1862A68,0x13017A3D,0x1999CAEB,0x93CED60,0xCA42B5C,0xE32DDDB,0xDED4566,0x2867A31,0x42E7211,0x1799AF1E,0x4875DBD,0x1284}},
+    {{0x264AD0C,0x21004D3,0x164EFBD,0x2277E57,0x105D4E8B,0xE0E888C,0x103BDEF7,0x59FC7D2,0x75624E6,0x1E650091,0x49075B4,0x156D96CB,0xC70EDB7,0x58E63DE,0x1EBEEDD4,0x1FF3},{0x17FEA84B,0x17B2EF94,0x242C380,0x22F9095,0x19301E82,0x8D49542,0xCBED203,0x9D7DD19,0x18C59C60,0x21B8085,0xFD3A00F,0x1FFE8F7E,0x114247B3,0xD09EB22,0x1772E7C3,0x1898},{0xC0C9169,0x1B51E09C,0xBCC90DD,0x11C3B5B4,0x7C3982C,0x5C5BB56,0xAD364A3,0x1453A0FC,0xA176E9E,0x1714BFC8,0x74813DC,0xE8BEBFE,0x51850E1,0x42A4D40,0x359A170,0x17E0}},
+    {{0x1DD6CB97,0xA390442,0xF01C7EB,0x1756A24,0x556CF85,0x1A7DA7BF,0xEFED94D,0x1079DE2A,0x7382055,0x1EE8B1F5,0x621FBFC,0x2F60365,0x1206DB46,0x1E9A136C,0x19340322,0x3E},{0x110337EC,0x17016E26,0x1FABB2F9,0x139FB20C,0x7E669F0,0x125DE027,0x1C08237C,0x17FBDF2,0x104B01B4,0xAF8F3DC,0x1A3D3592,0x12761AE5,0x1743C2B4,0x1E112E43,0xFB69EAC,0x111},{0x12E04703,0x1382A424,0xFEFA644,0x8ABABC3,0x57C1295,0x1D8F1EB5,0x2D080B8,0x1A2B103E,0x1B2488CA,0x1989CC0,0x30A1FED,0x1F506466,0x1401066A,0x4FD6F02,0xB3AF98B,0x5FE}},
+    {{0x1345936F,0x1D5A7DF6,0x1D23DC69,0xE5E1940,0x15B2CCBF,0x1DC1C4EB,0x1B64AC92,0x6ED2D04,0x1905748F,0x144A6491,0x170241F4,0x16DCA42B,0x1DC8183D,0x2969A6F,0x110C03A,0xC6A},{0x9B35FE5,0x1EFD8EAD,0xC192326,0x1E598D14,0x16D63534,0x12C9A1ED,0xDB26C1C,0xC89DA83,0x4CF9D9A,0x54AC60C,0x1D030B5D,0xFD23BA5,0x12DB34D,0xDE97504,0x1A9F90D2,0x464},{0x1C343C84,0x1A1A352F,0x19520946,0x153A6DD7,0x1CFEEF13,0x12C99073,0x178B9987,0x11E3890E,0x1A0CBAAA,0x1FF3D7EE,0x56EDB87,0x161AD130,0x106FB17E,0x1CE0453D,0xE5B1170,0x909}},
+    {{0x2FA85C,0xF4CF9D3,0x176795CF,0x56108FF,0xB3A026B,0x1E19DF66,0x1938FB26,0xCCC0ADA,0xBEA5A63,0x1FC6CB17,0x14689A8E,0x19894367,0xC1A32BF,0x17AD2E0D,0x70411E7,0x1420},{0x3C2333B,0x1B1A537F,0x3778345,0x142CB41B,0x2ACB67,0x116E485,0x1ED0BCD8,0x7B3BD6F,0x178195E5,0x19CF47F2,0x1E3D8AE6,0x3467B15,0x1BF11261,0x2EE404E,0xDDD7FBA,0x1EB3},{0xDE0179C,0xDED3CD1,0x9C0879A,0x24CD5D5,0xE82F96,0x2A8E06E,0x14F8C1A0,0x12EDB5A2,0x1A1FCB28,0x5E89107,0xB6CF02,0x1EE36EF6,0x1751CBDA,0x1B9F37F2,0x52AD33F,0x1AEF}},
+    {{0x17EDE546,0x3A720C,0x1D1C40AF,0x181504EF,0x1008BE20,0x154FE5A8,0x1F49B2CA,0x299F6D2,0x17E064C3,0x3F7ED61,0xF71716A,0x186BAC05,0x19DA36FF,0x745F2F4,0x8D16347,0x1534},{0x13767553,0x8FF4C0C,0xC9B8B05,0x4DE6E4F,0x1111ECC1,0x1A33E543,0x353FEE4,0x16726C2E,0xBF302A2,0x47DCBF5,0xB34465F,0xD262157,0x1FE7DAFA,0x68AEFA8,0x1146D06A,0xFDC},{0x245DE25,0x7B6C762,0x14D06454,0x14CBB484,0x6C753AC,0x15C7563F,0x8DDF7C2,0xDB96A2F,0x88F26C2,0x742D5FC,0xF294C1D,0xCD860CE,0x13779CDE,0x960F329,0x1E93F34F,0x1B72}},
+    {{0x19F73AEA,0x8AC6736,0x453FD1D,0x106D4EE9,0x4DC0B01,0x486A721,0x120E51BC,0xC585888,0x3FFACDA,0x184BD3EF,0x79AD219,0x1B4E9343,0x14D8DB61,0x1743B284,0x17F663D7,0x13D},{0x1B37226D,0x72307E7,0x5A6FD1C,0x4773A07,0x11247CA2,0x189EA6A8,0x15B1E0B2,0x1278E491,0x1A000AD2,0x13AC88C4,0x50BA2AF,0x19B62489,0xD12BF52,0x56FCFC4,0x118FAEEF,0x6D0},{0xCA1D5D8,0x1C41F53F,0x185A493E,0x3458A4A,0x12095B5F,0xF0E53F7,0x18EFBBD4,0x13144A57,0x14F7C4D9,0x1E1B4B08,0xB789D61,0xB3486D0,0x12F3A4F8,0x163A319B,0x1B321323,0xC2F}},
+    {{0xA450E77,0x172B37FC,0x19A84EAE,0x1616800,0x10CD7DC9,0x6241D28,0x4D7EA73,0xF963440,0x31A80E6,0xD7585B,0x187C0820,0x8F8F869,0x1DC8F4E4,0x1787812B,0x19F45D31,0xF57},{0xB19A576,0x1788AD1D,0x8193283,0x171E08E9,0xB351F99,0x1CCCDDB,0x12DDCFB7,0x2F0AA4A,0x2F427D7,0x17924FB6,0x94CB833,0x9EB3ED0,0x126C2EE3,0x87B8FF0,0xB2BA005,0x3D8},{0x164BD0F8,0x549D97B,0x1197EE6,0x1BB28D9C,0x15B78519,0xE7780AF,0x1B45EF71,0x1330D227,0x19257F5F,0x1ACE8174,0xC5CC691,0x15D3F0B1,0x133E6E57,0x1688C0AB,0x1E1A76B5,0xF}},
+    {{0x13B7C84E,0x5058526,0x1E33CAC0,0x19E26586,0xBEAAA8E,0xF8C940A,0x1E5ED2D7,0x16FCF253,0x8E42D0A,0x6EF8453,0x1EC5ED83,0x2C10295,0x148C7D9C,0x190BBC61,0x5221136,0x1F15},{0xEAA2578,0x66F7EC4,0x1AF43898,0x5EE2FEA,0x131694D0,0xC3BAA70,0x506076F,0x2424A98,0x1D26E5F3,0x1DF86D66,0x17EF3BE1,0x5D57157,0x1972E74E,0x1A125CC2,0x1D88400A,0x2E2},{0x68DE328,0x61E8EEB,0x1CE09C60,0x2D1FF73,0x1E06F2EE,0x105AD3FC,0x3B57FE3,0xDE231E9,0x1E0887A5,0x53CFF27,0xA9FBA1C,0x130A3773,0xA85C061,0x1659C464,0xBFBE80D,0x1781}},
+    {{0x170A54AD,0xC155C1A,0x38EFB1D,0x16B83BDD,0x1454B556,0x107AC1FF,0x67D1879,0x1CF24403,0xA887FC4,0xD6EFB0E,0x1F481DDB,0xC2CC83,0xEDD8EDD,0x1F438063,0xC50957D,0x15F3},{0x9BBE3EC,0x139F8AF2,0x3E2F07E,0xDBA76F1,0x71B8FF8,0x5D92660,0x14906F96,0x1B4D84C1,0xE36B10A,0xC2F60E2,0x825FF6E,0x425ED68,0xC85D47C,0x1C688685,0x64701F5,0x12CE},{0x1D818A25,0xBE60BA7,0x152B9D29,0x81E2BCB,0x1AC76DD2,0x119C269F,0x6F5B98D,0x8D6C806,0x39CC806,0x9456EB0,0x59B0241,0x1D71D9D1,0xBC6180B,0x1136AA,0x848E4E6,0xC66}},
+    {{0x7988A4,0x1BEAFEAA,0x15B30118,0x1C4F5DD2,0xD6B1917,0x19F679BD,0x124273CE,0x7A7D29A,0x1F8A8B7B,0x101F045D,0x149E054,0x995D553,0x1E22350A,0x336DFF,0xDFF6D72,0x554},{0x19503149,0x1A4C41B6,0x42D07EF,0x6B8FFB9,0x13BEAD5,0xAE404C1,0x1A621580,0x1B5A40C,0x1C2033B1,0x1AD9753B,0x583E4A1,0x3305ED3,0x10C347BE,0x830CF7A,0x17953AFC,0xD98},{0x1CCA06A8,0x14BFE639,0x32E49E,0x10CB65A6,0x1F85B3F6,0x14F197E5,0x1D14FC6A,0x1099D1D9,0x1FFEBF04,0x1D9C87EA,0x3B645AB,0x153138B4,0xCC69302,0xEA4BA1B,0x11A85E68,0x478}},
+    {{0x15D7CE29,0x10424EC7,0x5C5DB50,0x1069620E,0x1431ADE0,0xA8C456,0x92A7AC5,0xD43BB2B,0x18ADE44D,0x1DE27DDC,0x1B2D5B3,0xEA45BBE,0x14DB77A5,0x1A42FB09,0x1CEBA7EB,0x142A},{0x1D83CCF6,0x1B3E8E08,0xB7F7E5B,0x1E75BFA4,0x15A282D,0x623552B,0xB618C36,0x1A77383E,0x1B3505BF,0x93423B1,0x51C40DB,0x1CB05B3,0xC6B74ED,0x18A65B46,0xF25F927,0xDE2},{0xB4A1BA2,0xCA757A5,0x104D3973,0x3982F04,0xD6D2C6D,0x155DBFDE,0x129081A3,0x159EF4B0,0x8004ED9,0xA4FED1E,0x63D4CE0,0x38E6059,0x3DC8754,0xCB17A6,0xFE10ED0,0x18DE}},
+    {{0x11AAEFB3,0x14D1DC62,0xFD0DC21,0xB22E58B,0x179FEC56,0x19D35BD5,0xBAEDA43,0xE007D5E,0x8A141E7,0xCB3B32E,0x39495F1,0x10AFCC14,0xFFF2BBE,0x1CED3964,0x1B3C0810,0xE20},{0x1CDDF01F,0x15047A5D,0x78BAA26,0x1D1BA5E5,0xF655218,0x66FF680,0xEED7D9,0x6FDF31F,0x7A7679F,0x6DDC696,0x149150DA,0x1031D12C,0x15C293F9,0x1922E3ED,0xDA21797,0x1C27},{0x13E9DF8C,0x1A589722,0x10BF596B,0x1F4C6A34,0x147F58E3,0xB94A16A,0x1A9102FA,0x1C7F95FF,0x1A98ECAB,0x1D7DE116,0x475B172,0xDAA255F,0x1E5CC0E6,0x153B9828,0x4C515FA,0x1D14}},
+    {{0xC90CA66,0x8CA6930,0x156C29D8,0x1991A36D,0x6FD7A8A,0x18BCB7BE,0x9749BA6,0x9E3F18F,0x9476D7C,0x36B0D26,0xA0F099A,0xA6AABDE,0xBDC2543,0x1598A605,0x357475A,0x79F},{0x8BF658E,0x5AA38B6,0x119DC229,0x247312A,0x15B7707C,0x1B03B9B2,0x14586850,0x18DFB77,0x116909,0x17650653,0x14FC0AAF,0x9A0B664,0x20111DA,0xB29CF55,0xAA8EE90,0xD2F},{0xEF46260,0x1C9E3BDB,0x15B114D9,0x7ED05C0,0x189E6F6E,0x192F3759,0x188E2612,0x8123F03,0x17439E26,0x3BF923,0xA83330C,0x1F28658C,0x1363E70A,0x64CD9ED,0x10369A99,0xE16}},
+    {{0x3E62E2A,0x1617CB3B,0x1ACB6A89,0x4CC302D,0x12DD5F51,0x1A9A8AFE,0x9D5ADB9,0xB1B86DC,0x4674CC6,0x12205EEF,0x218039D,0x14122052,0x451694,0xB4FEF8,0xF2DB3AB,0x8A9},{0x16481EB6,0x1FA64955,0x825D439,0x1B16EF5F,0x116362D6,0x17737A11,0x1BBD4E8E,0x1301A8BB,0xACD7DCF,0x256D63D,0xDFC497B,0x640C519,0xA20AEC0,0x11ADA0F4,0x31FBA8B,0xE83},{0xD78F9FA,0x11C3B3E3,0x80AAC24,0x1841847F,0x1683B9EF,0x10434255,0x112120FB,0x109C302E,0x4EA4B7A,0x29F268,0xB6067F4,0x1EF8D3A4,0x19F12758,0xBDB3D9B,0x1CFEF14C,0xE6F}},
+    {{0x1219379E,0x1722632D,0xEED81FB,0x16422703,0x8B7BC6D,0x146A63A1,0xEDDA8B,0x6374C54,0x1C98BB0B,0x870B94,0xD431AEF,0xF54795D,0x727B018,0x6E7B633,0x14BC3EE4,0x17F3},{0x1184DC6,0xF6349A8,0xC9A63AD,0xFAB1A54,0xDA316B0,0xBD9B36C,0xEC94700,0xFFC3C73,0x1A9ADB15,0x365F225,0xA6A2A2C,0x7C37553,0x6356E47,0xE3687A,0xA3D875A,0x1A4B},{0x38665F4,0x1B7070A5,0x771381A,0x175586EA,0x10294528,0x1603277D,0x7F9F971,0x6DA05A9,0x2E293B1,0x41BDC02,0xDAA5C31,0xA20F6FF,0x1055940,0xF7CD1D4,0x1CE3E6DA,0x13AF}},
+    {{0xC33B4E2,0x77456D7,0x58F3AD1,0xC600CCA,0x1B880B08,0x1478A3B7,0xA255A73,0x12A0E066,0x19A238B5,0xAC1655F,0x1EF09B20,0x2890A02,0x15B568D5,0x14B7A105,0x17C7BE71,0x153E},{0xC8FEC5A,0x8A04E1D,0x1CA3A55E,0xCA82A2D,0x170E1F44,0xB032B9F,0x188C46E,0x1B07C78E,0x11A3C2FF,0x8E0019F,0x3F3299C,0x1F311D01,0x152D07AE,0x12D9B8B3,0xFA6A494,0xBCA},{0x1CD8D30A,0xC0D262D,0x170C9E59,0x74D6BBA,0x6236826,0x145D6A99,0x164D1187,0x8CFD59A,0x53ACED5,0x38523B0,0x1AB7FC72,0x13BFDEBA,0xD099DF9,0x647F90A,0x1E926BC3,0x10DC}},
+    {{0x1562A5ED,0x1A59161D,0x1D71F341,0x10E2242D,0x49BA064,0x17A8FB96,0x4C37A79,0x175821A1,0x19BFDA63,0x15856523,0x956BD4C,0x1E728E45,0x1EB77236,0xE1A46AC,0x161D1119,0xB95},{0x1722B0C1,0x5108CF2,0x13CD0FA9,0xF6CE04C,0x2C19F38,0x1D348878,0xF00E07E,0x3B9FD8B,0xD52C0A,0x5B2FAEF,0x13558DE3,0x17469C8E,0x2727E2,0x1AA097E4,0x1768C566,0x1442},{0x71385DF,0x1F21390E,0x1E70943D,0x96D0497,0x1EB5FB60,0x10919316,0x1DCDC41E,0x17D08A60,0x1A94ECB3,0x14D6F6B0,0x96A250F,0x9061BE0,0x960EA9B,0xCFF5C5,0x1361E4A7,0x1AB9}},
+    {{0x2A75C18,0x1C33F94B,0xCD6AA8F,0x1B7696D1,0x1B0BD1CF,0x5CDD5A,0xADF7246,0x1ADA8BDD,0x144EF0F6,0x70F4204,0x19AEA02B,0x19E774C0,0x10EEEF6F,0xD28ECF8,0xF28184D,0x96A},{0x2DA91D6,0x17AE5336,0x13EE8D09,0x1FEBAE0,0x2E3DBA8,0x711BC21,0x17DEF332,0x15901F9,0x1B52C009,0x1D42F506,0x11CBB010,0xD3C63F2,0xACF74,0x6A8E534,0x270AE2A,0xEB8},{0xCA7090D,0x411E039,0xD9E8A71,0x1828ABFA,0xCD23036,0x173D9FBF,0xA27AEA,0xE10E135,0xCF4305D,0xA86330E,0x1617FB46,0x1A419093,0xDE75CB1,0x1F281296,0x1F6AD6EB,0x18}},
+    {{0x9F370E4,0x14A514C2,0x1B59EF4,0x67E8C3F,0x16843E37,0x790544A,0xBAD184C,0x18CF4D5C,0x1AC87DD3,0x16DE29D5,0x3AA1A11,0xCC8129A,0x1FF3F960,0x13A771D5,0x1A3D36DC,0x5C0},{0x142AAA7C,0x498609B,0xA2618B7,0x1B4915B7,0x19AAE946,0x4BD3420,0x3B200CC,0x44CC28B,0x1CC04F3B,0x5BF1D6,0x5D7AB69,0x1F652A38,0x15127A73,0x3E01FDC,0x8AA9F2F,0x118C},{0x1B655B50,0x2C29D17,0x522F1AE,0x1A44D27E,0xE8AB07,0x1690699E,0x4DE09C8,0x75C279F,0x9844718,0x1D88C6BE,0xB2C5FE4,0x127BBA5,0x116284A0,0x1997E1C,0x7D1B3C8,0x1FB4}},
+    {{0xCB3C340,0x234C119,0x10E4E0A,0x16C6D5E2,0xC757D77,0xF53B88D,0xBEFDD74,0x1462AC6C,0x8D72972,0x1B523F74,0x4BCDC97,0x1508B708,0x13CCDBBC,0x53F0F2,0x1B29A3E3,0xD0C},{0x167E332C,0x16C2E0B7,0x9956A4F,0x139991F8,0x19827875,0xEDCEA36,0x7F9E559,0xEE92765,0x1724A6FF,0x1006DBFD,0x10CD079B,0x6AB0620,0x6D858B9,0x1F8E5FE8,0x72F4E4B,0x1B6E},{0x14957BC3,0x15C3CB4A,0xA9D4E57,0x12E7C29A,0xB8B3329,0x18245E53,0x1C0E817A,0x1C0C3337,0x12186D46,0xCA21F61,0x28F5A78,0x1D2E6DF4,0x1CBEC5A6,0x931CC6E,0x149DA66E,0x1810}},
+    {{0x1D0F2F50,0xC1583E9,0x614C256,0x8F1D015,0x14098975,0xDE5483E,0xE2EF063,0x10F858D8,0x166EB340,0x1027D9D,0x7601861,0x1610DC2D,0x1A7BFC08,0xD607AF,0x12F9B48E,0x100C},{0x68B6318,0x51BA6CA,0xC20E865,0x4CF012D,0x140A3CDE,0x5E15142,0x9870D2,0xF185946,0xC4C24F7,0x1DCB8927,0x18599468,0x73019AB,0x1FD75B87,0x16061ABD,0x17F3FAC6,0xD77},{0x12B3AD0A,0x107EA1A7,0x1110E271,0x1652E9F5,0x1C9B1AD0,0x5ECCCD4,0x1F79C4DE,0x1E2E799A,0x1FA883F3,0xF3A3597,0xB7CF48E,0x18E9B39,0x14BDCF47,0x5FD9A52,0x69BEEAB,0x152D}},
+    {{0x1F171AB7,0xED08AEE,0x5007E4F,0x85BC2F6,0xA40964B,0x1CA80CE,0x1D196E8F,0x102D3A3,0x70090D,0x829A50,0x178A0AFD,0x1B2100B8,0x1E1165F8,0x122B0AEF,0x905B29C,0x104F},{0x33A36C4,0x2D7C442,0x1363B981,0x1F17F4A9,0x19CE290,0x13047E8A,0x30A1ECE,0x1A45B6BD,0x18103CDA,0x5CF2DF4,0x1D2FE04,0x8E62AB7,0x2DE670F,0x32B9572,0x1611FDD,0x443},{0x177034FC,0x2536B75,0x14CC9C33,0x19FE9FB1,0x267148B,0x11C03DEB,0x714FE4E,0x170E2B2D,0x2223D7C,0x10323D5C,0x249C00B,0x9F6B52E,0x6325C2F,0x84F8F93,0xA235958,0x7D4}},
+    {{0x1788FDAB,0x19185D50,0x9F41165,0x15E610C1,0xE99F4CA,0xF5163F6,0x41AB419,0x17B7A73E,0x15D3BEF7,0x101FEC97,0x1EB65B48,0x1C1AC0D3,0x18CAC4D9,0x1189DFF9,0x805C7F6,0x833},{0x572F035,0x2EBBFEC,0xACA0AD0,0x1EB5F33E,0x1B23FACF,0x17B92BE9,0x8D63242,0x55E5DC4,0x7D9B6A5,0x18766134,0x4B0C090,0x1E702811,0xD5E3EC4,0xC5F549A,0x1F5F0EF4,0x1810},{0x3A0FE59,0x12AB10DC,0x10EF10CE,0x1A54D509,0x16C438DB,0x17025CC5,0xF61C77D,0x792B204,0xFC0928B,0x4DFFB18,0x100F2596,0x106BBC1A,0x13CE6FD9,0x1F93C9E3,0x1DCF1640,0x1FAA}},
+    {{0x19A6F90C,0x1462812A,0x183A8DD2,0x4ADCF57,0x256413B,0x1FB3AE39,0x1FA519D4,0xF9A7F82,0x1FE235F,0x15814627,0xF36C0A3,0x1D11C413,0x193A489F,0x18353E87,0x1A8B818D,0x172C},{0x4A30319,0x5B61146,0x1B29B59D,0x14D0D1DF,0x10057311,0x4830853,0x4AEB5FE,0x10210102,0x2C1DD61,0x4515123,0x7FAD63A,0x344A5DB,0x116F3382,0x4155DFF,0xFA585FE,0x1B4A},{0xC62B2AC,0x1438DB26,0x4A9329A,0x1D1FFDDE,0x1D36CF4B,0x1C79CEA6,0x8A449FA,0x9246B02,0xAB5DE60,0x2E04103,0x19E74F95,0x13D77E41,0x7C00836,0x1583936E,0x1AD875E4,0x1BA7}},
+    {{0x569F191,0x1708B54B,0x1935B8A6,0x1767E179,0x1AF51DBA,0x1B185CF0,0x1CCD1B49,0x4E3BA6D,0x1030749A,0x1B8418A8,0x522AD1F,0xD02485E,0x1BCF5585,0x1CDD7452,0x6117B5,0x1170},{0x13894AD1,0x1520217E,0x14AE22F1,0xF05EF03,0xCBE4C39,0xF969A65,0x1AB76672,0x1050E635,0x98EF1D3,0x1E487CAA,0xB87742E,0x9D19574,0x9E95406,0x55CBC44,0x725D86A,0x119B},{0xE65D8,0xA3AC3B4,0x12FFD997,0x19CFFEA4,0x926A547,0xA516EB5,0xB4AF099,0x924C6C0,0x55D7D93,0x95DCC68,0x4DFD279,0x498AAF2,0x1A657C54,0xE694274,0xDA8B13D,0x4F2}},
+    {{0x1B4A4B7E,0xF9D51F1,0x56F7206,0x12C333A7,0x23E537,0x115F5C1E,0x1BA21FF6,0x1C1E51FF,0x8DACE6E,0x14B4E955,0xFBE5396,0xE139FCC,0x31E6849,0x1EAAE0C8,0x1AC9949F,0x145A},{0x121928C6,0x1276A6E1,0x11838CAB,0x13961380,0x326C93A,0x1823DA11,0x2493132,0xD1511EC,0x136438E6,0x16A27343,0x17BCD8CA,0xD2E4DEE,0xB944621,0x133A1475,0x1CDCEAAE,0x1389},{0x1819D52F,0x8C62749,0x1D72C41D,0xC6F5148,0xBE5A2A8,0x121A900F,0xAE67E16,0x456AD8E,0x1DAFDE9D,0x6EC663E,0x14B2B61B,0x115990A1,0xF6F1B44,0x3ABE70,0x1A1C4DC7,0x51B}},
+    {{0x1A02885E,0x18B000AA,0x17F66C13,0xCFCA942,0x1DC9625D,0xDAE7A76,0x11A25A11,0xC502441,0x78761FF,0x23C1E32,0x86092D,0xED0F30B,0x164145B2,0xE3D2FA7,0xD3A533F,0x17E},{0x2E558AC,0x14AAFCFF,0x949ADEE,0xE597FE1,0x166D1675,0x1EEA7EE5,0x87F04B,0xBC64DF9,0x1E187BDD,0x14E7CB6D,0x1B4913BF,0x1CFE6D00,0x9B324B9,0x164BEF5B,0x1D3AD67D,0x7A2},{0x19826BC5,0x4928939,0xE24D10C,0xD1CA0F1,0x10059263,0x14726A4,0x62610A4,0xD120A4F,0x852FBCA,0x1AAE4BBB,0xE58E5F7,0xF1DA8CA,0xAB1E008,0x23389A7,0x1A6FE725,0x1710}},
+    {{0x156C1BB6,0xF00E25F,0x9B12883,0x16884E8D,0x64BE936,0x1B60355E,0xC32348D,0x12717658,0x1A25C0EA,0x10AE8DB8,0xB91C70,0xA6E0274,0x1199041B,0xDF53AEB,0xFAFD2E8,0x171A},{0x1AD006C2,0xC69722D,0x306DB8C,0xF6949CA,0xC55E5BD,0x1C3BD594,0xF520260,0x10AF30F1,0x6BF2560,0x174E4483,0x122482DA,0xAFEF815,0x9E76908,0x15001D3B,0xAD55A3C,0x1F9A},{0x6A24AD3,0x17BF6C3C,0x50B7F5F,0x1D9BCF85,0x1CC3DE18,0x1BA6DA7B,0x1625560F,0x10E217BD,0x179D972C,0xD5A1DC8,0x1BE7F441,0x9274F3B,0x1F97CF59,0x1B463536,0x16657C2B,0x1D82}},
+    {{0x1F0DE5BD,0x14FB3C0D,0x1117A248,0x116E5470,0x12F0E999,0x5E586EE,0xE0CA8D3,0x1050FFD7,0x1709AB6A,0x16D72470,0x7A26E5E,0x1A8AF7F1,0x2EB12C0,0x1CC19D59,0x199824E9,0xA8F},{0x15800209,0x1D57BD4D,0xF6D0029,0xB9FFB3F,0x239ECBE,0x9BFB6E5,0xE454861,0xB4CF3CE,0x15B3A592,0xDECB7AA,0xA90AFC2,0x1D725CE6,0x424E2C,0x14311F1E,0x64DC857,0x395},{0x11F52B53,0x468BC92,0x14E2E006,0x8AD3F51,0x153E6121,0x1EABA11F,0x1067C850,0x81FD40D,0x1F6A7D0B,0xCCF57F3,0x15195635,0x162A7A31,0x2CB1A14,0xDDDBF8D,0xFECC60,0x1AE6}},
+    {{0x1C16DF92,0x10FAA3C4,0xB8FB450,0x30E98C8,0xFA2A9F,0xB34CFB,0x14CFFB3F,0xA77A371,0xD58A3D9,0x1C0ACB41,0x8528DA,0xCCDE2F8,0x21D181A,0xD6C75CB,0x10EACF3C,0xF85},{0x1E529F7C,0xF344461,0xACD54C5,0x1832F6CD,0xA83E31A,0x731DAAC,0x1162471A,0xC0954F7,0x189592E3,0x13360BEC,0x8A44D8D,0x15818EA1,0x14704909,0x50806A9,0x9C9165,0x1ADA},{0x3807C80,0x168B985D,0x16A4E2D4,0x26191E,0x1D3C8A27,0xA32C3BF,0xEA3F6A5,0x1BEEF25F,0xF8B058B,0x51B72B5,0x5CFBDB5,0x1FC5D237,0x1BBCDCCC,0x5995BB5,0x1BCFB479,0xA4E}},
+    {{0x1CB7D458,0x84C0B1,0x1FD6EA0D,0x18256C8B,0x128AF72,0xEB8518C,0x1FBCCB97,0x168BE8E4,0x1510A21,0x1C4BE5D7,0x1E019E14,0x76F5017,0x1402B8F9,0x4ED4C13,0x17E0820D,0x1C70},{0x19589F6E,0x9682A30,0x1B9F0064,0x1AD54B64,0x12BD5574,0x10F3CD70,0x4505239,0x1FEBA27F,0xF13716,0xFBD95F,0x1F9A02EE,0xD390561,0x33C3E25,0x1C59B4BB,0x1C20E1CF,0xD83},{0x8291E40,0x121DAD44,0x58DD539,0xE806A9,0x1E60DCF1,0x1AF525EE,0x93AAFC9,0x386444A,0xABDD768,0x1C3A3645,0x1C125980,0x4FAE12B,0xDFC300D,0x1732A2D3,0x54D6DCE,0x19B5}},
+    {{0x7B6F5DC,0x120ACE7E,0xD24DA52,0x60B4A56,0x1C83B888,0x775A88,0x190AC190,0xFC33AF3,0x1A2738F3,0x16CC7281,0x15E56A52,0x31B461C,0x1C752626,0x1D0C9CC0,0x1B1A4B72,0xD6},{0x4D1B051,0x6B92177,0xCECD431,0x12C4E999,0x1BF54001,0xAB36F85,0x1996B84B,0x1749ACD7,0x1601049C,0x59E7514,0xCE637E1,0x390808E,0x96B75A3,0xBA63EB6,0x5661D0,0x1770},{0xD56C96F,0x155A4B32,0xDD0AF7E,0x663C08F,0x435CB28,0x578B45D,0xB79AC0E,0x11349D25,0x3DF90B0,0x1B561DBB,0x1FF47A69,0x17CCD517,0x114FF375,0x169834A5,0x1C286A5E,0x1309}},
+    {{0x48BF5A4,0x1164B1BF,0x732BC44,0x73FBD83,0x1D5C4202,0x672E6F4,0x821E3C3,0x17530D2C,0xA21FE6E,0x1C5E7CB8,0x1B215399,0x1BA3BEB,0x1F0128D0,0x1FD42333,0x9836C2C,0x1F4E},{0x1B34239B,0xB5E944A,0x14B4A943,0x4099178,0xF6CB23E,0xA8A72AF,0x9CE89E3,0x8CC8818,0xE321930,0x47A589,0x1D917753,0x1D188D5B,0x9984656,0x6A23871,0xDBAB92B,0x1CF6},{0x186D502,0xF1B0BC2,0x1EDE1C4A,0x1103380B,0x9656714,0x433C81F,0x10751EA8,0x16BAA851,0x1A6E6CB0,0x763C21F,0x138DA880,0x138E2A49,0xD3E3E86,0x196BCE0C,0x4C4D4C9,0xC5A}},
+    {{0x14F40CE5,0x5DC4DF3,0x1144BAD6,0x52D48F7,0xF26BF2B,0x85CEDC5,0x33CF45F,0xB8ED7A9,0x1C104C43,0x1B5DAAEC,0x1C56517D,0x110F6E19,0x1455B607,0xE17D377,0x8D0361,0x1F28},{0x9D39F16,0x11561F5,0x4B812F5,0xE963BBE,0x17613A60,0xE845AC1,0xCB5BA6A,0x134E6A14,0x1087DE3A,0x1163E626,0x11C0725E,0x1901DCAC,0x186E0B65,0x1C83EFBA,0x196CD817,0x1C15},{0x1FB1A94B,0x1BDD6ED7,0x195AC376,0x19318C58,0x11427A46,0x75763F3,0xEC171B0,0x1D55053E,0x66FE7D7,0x8A19BEA,0x9065931,0x1624886,0x1CDAEFF5,0x10665B58,0x101B5C42,0x5DD}},
+    {{0x17CDDCA7,0x1EC5BC6A,0x14B6FB56,0x883D4DA,0x1629A81E,0x1D0B18E4,0xD7195AA,0x1924A180,0x1462C8BC,0xA838BB7,0x1BC17553,0x18102618,0x1B2475ED,0x1CD1468D,0x3CD51BA,0x1D79},{0x8CEDCAD,0x1C98198F,0x1D12FF85,0xAC2E5A7,0xB607D5C,0x6902254,0x178E172D,0x72BFF9F,0x136C9877,0xC2ACB40,0x166E0094,0x11BEB22A,0x3D61E68,0x9C5EF08,0x6006604,0x1E0C},{0xADFC46B,0x1EEA1321,0xE710FAB,0x32AA222,0x6EABF7D,0x128F3AAA,0x149D6CDC,0x3F9177C,0x1C5712A,0xE7A8E8D,0x1A14B5B4,0x16E8D722,0x1775470,0x1B97D51,0x17F6A36,0x1DF8}},
+    {{0x15E72E82,0xFD5D901,0x1049D81F,0xA8AF725,0x11E854E9,0x1CDBB2FB,0xF541D2F,0xEAAA81D,0x1A4D5C03,0x3995A74,0x4CEF48F,0x1E4E1F03,0x2DDBBDF,0x116D9510,0x219DA09,0x13AC},{0xA0C6F5B,0x10EDB45F,0xFA988B6,0x7118245,0x1AAEED59,0x1767F724,0x633CDC5,0x18AB66BD,0x8733CFA,0x1F2C7512,0x1054C948,0x60705BC,0xA00713D,0x18B48FD3,0xD9B23F9,0x221},{0x1E9ACD94,0x169412EB,0x28EC820,0x263091D,0x1381A78A,0x1DFB9888,0x15571C91,0x60BB222,0x67F947A,0x8155EC6,0x195C9968,0x7B3E738,0x8C6D629,0x4174E47,0xA9E990F,0x75C}},
+    {{0x1CEC9C04,0x1BA0E3AD,0x1A8E663E,0x10FE31D1,0x12574A4A,0x89787C4,0x10B2B,0x4E84D12,0x1E22132C,0x1BB09643,0x1DA6BEC0,0x1D08E68C,0xE7547A0,0xA95050B,0x3E6570D,0x1549},{0x152121AA,0x198714E6,0x274C94E,0x4006C53,0x41BE148,0x17E36C2A,0x18CE41F7,0x14789A4F,0x1DEA71C5,0x4F3475E,0xDA96110,0xB317B14,0x127BEE5C,0x27E304F,0x1D49294E,0x683},{0xF033CB,0x5E03A05,0xBEFA176,0xF55C2C6,0xEE103BF,0x89B53EC,0xD6B1349,0xDF38C23,0xA6D99EB,0x1982E600,0x4CC24DF,0x278837A,0x5A4E197,0x9A2BBCE,0xB27D505,0xB4B}},
+    {{0x6909EE2,0x10EBB02E,0x2657B22,0x3F89B2E,0x1DCF2B36,0xA96C174,0x1D84897D,0xAA0FE1D,0x13AEE9C,0x1AA51206,0x1479589E,0xAEBA893,0x4A73A44,0x1EB8838B,0x57F6F52,0xC34},{0x1D3A9FE4,0x11834B5C,0x1DF9F8C9,0x10D06118,0xBCE0B8C,0x71D6111,0x64C136E,0x1707DC6,0x3B5E5DB,0x9CF6528,0x173AC719,0xD78F151,0x105E2D25,0x1EABA545,0xF2E2F67,0x1438},{0x3C1FB0E,0x38D7C52,0xC3ED9BC,0xFE0EB21,0x19BACB1F,0xCC6C9C0,0x332E784,0x132DAAFF,0x1CDC2AAA,0x1687C578,0x7C0E2D,0x2585160,0x165EBD0A,0x2CC4CA3,0xAF422CD,0x17BF}},
+    {{0x14BDE3EE,0x3DC4107,0x1C93545C,0x17D4E25D,0xCDF6EC7,0xD28BFC4,0x13E60FAA,0x12562B9D,0x4431A45,0x9F4F777,0x1E13AEC0,0x2BAF0D8,0xCB31F4E,0x1ED09783,0xFF613D3,0xAC0},{0x19E1321F,0xFB3C874,0x9D29302,0x1C4E98CD,0x149A41A4,0xBD25B85,0x176B6945,0x1B8EE017,0xD51BE8,0x1F072A53,0x9D8691D,0x1D59F5F2,0x1C72B027,0x1C8BB330,0x8D00A02,0xA1C},{0x1655E478,0x4F731B2,0x22FB282,0x14152E09,0x374D767,0x419CB44,0x311D229,0x1DB6E7B9,0x11336801,0x52F3E9E,0x1CF8D1A3,0x6124B63,0x5A6564A,0x8026762,0x8009C4D,0x51F}},
+    {{0x19C46FD8,0x1D0F5192,0x1A7EE5BB,0x1BD94245,0x26767AC,0x17C83A5,0x889E1C2,0x11D36009,0x77F3BA,0x15F1C4FC,0x17A4356A,0xB0AC8C7,0xEAAB090,0x55C7986,0xC7A158D,0xE36},{0xAF02AED,0x106F732E,0x1882B094,0x12A0D10D,0x1886B8A5,0x140332FB,0x137CAECC,0x113736F0,0x3ADC6B0,0x1FEA3722,0x18659B09,0x1CE07ABB,0x1265F0FD,0x1A020C,0x11848AD7,0x1DB2},{0x185C7041,0xD5C5121,0x883A469,0xEA4DBFB,0x276D754,0xE4B82D2,0x12B93A59,0xB3BC96F,0x3031100,0xC476FA9,0x1C081F55,0xDBD5A17,0x411CDAC,0xF4865B9,0x126C97BB,0xB74}},
+    {{0x1BF5844B,0xE544267,0x1214933E,0x133BA0B8,0x1936BA88,0x136DFFD0,0x174A79D9,0x11FDF29F,0x1B3EAF4,0xAB1AC7C,0x135454C3,0x13CB2CE6,0x12D14ADF,0xFB09BC5,0x141191CC,0x5F0},{0x199DCB83,0xEB57482,0x186648E,0x1149F13C,0x98F0F95,0x3B20292,0x67309DC,0x1E50CDB,0x1A2F551C,0x4032340,0x34130DC,0x60258F6,0x125B00AC,0x1C4A90C4,0x1FECD537,0x11AA},{0x40163B0,0x15870E08,0x148221A6,0x102CDEDE,0x227A99F,0x1C0439FA,0x1DE2FF6C,0x7D74863,0x29059D9,0x84CF2AC,0x8AF6D47,0x12DE1829,0x19D05A16,0xA19490F,0x12195520,0x1CEF}},
+    {{0xF0CBD72,0x1345D788,0x1786680C,0x14E37E9E,0x195B24CB,0x19FE0CD,0x15789A6B,0x1765F252,0xA6DD1A,0xC8F96FB,0xDCCCA0D,0x1C81D0A4,0x75AFB93,0x590AF69,0x1744F5A8,0x1632},{0x137F3E5A,0x1352C0CF,0x1B276EB8,0x118D0115,0x7736FB4,0x9C343F6,0x733AF94,0xA6C3DA0,0x4CB4BE,0x1964F7EB,0x1EA1836,0xAE8D8E4,0x491F3BC,0x1EC75B72,0x4AF3271,0x57D},{0x19C566B2,0x177840DD,0x11FA0D3F,0x1BDE007F,0xD15BE12,0x864B288,0x8B6142D,0x12F96905,0x8DE6B9C,0x144927DA,0x6226E3C,0x1CB2BC11,0x1B95CC5,0xEF89DDE,0x1F6DEFA4,0x2DC}},
+    {{0x522EC8F,0x91863C4,0x7B6DD17,0x11864FDF,0xF4A8664,0xC22B9AA,0x1B22455D,0x53DD754,0x1D407B62,0x194E5D79,0x61F3EC0,0xEB16EF2,0x161B9EB6,0x75D88FE,0x1FAEAF8D,0x18B7},{0x142D239C,0x1DA715DA,0x1D87F6A8,0x262C3C7,0xF3FD85E,0xEDA1FE8,0x80FDE1B,0x5BC059E,0x4A82783,0x129E2C4E,0x8ADE468,0xC8DB6DB,0xB99EC06,0xDD9BAA1,0x15B28796,0x639},{0x18E2E703,0x67B185,0x18B27E2D,0x1DF10A91,0x299F0AB,0x12784648,0x81549B8,0x13574B0B,0x43EC33A,0xBA303E,0x189D67E,0x1C2922CD,0x9D28149,0x1D936BF6,0x180B828B,0xF8C}},
+    {{0x18614743,0x3170987,0xFA5CFDE,0xA3079EA,0x18FBB985,0x530871F,0x38607FF,0x132B1EB9,0x15F566CA,0xF53DE95,0x7965CA7,0x9AA30D7,0xFBC8618,0xC99E4D5,0x579CC28,0xAE},{0x1C4F342E,0x17A5B196,0x18593AEC,0x2639E25,0x104D97B6,0x4AB656C,0x185B327B,0x1E074B08,0x1D2963B7,0xE63993F,0x14A0EDC7,0x63D7C45,0x7E0EA16,0x5C4686E,0x7309D31,0x1729},{0x1902E1D3,0x1F0E6877,0x12144D32,0x19E2C9D7,0x11FF2FF2,0x199B4317,0xD4ACC64,0xFC46F12,0x10F43F7A,0x8633399,0x7570D7B,0x1E028E80,0x408B118,0xA6B9945,0xCFD705D,0x12D}},
+    {{0x158EB660,0x1FBB4B43,0xACD7A92,0x16EFB5F4,0xEA2101,0x2B2A6C2,0xC64D0C,0x18143EE2,0x8CD0639,0x1EFFC6E3,0x2ED57FF,0x100C050A,0x4B0305B,0xB50330,0x59E4DDA,0x87},{0x13627295,0x1F1BDBC8,0xDE176A7,0xBF4E0E,0x5EE0702,0xA9DAB8F,0x11FE88A4,0x1DFF9CFC,0x7E946C6,0xE2BE815,0xD5D8113,0x18211576,0x307CEC6,0xD173E90,0x51A597C,0x1D01},{0x86E8B42,0x195F9D47,0x1849F145,0x30D3E56,0x1B4F05C,0x13081A51,0x5A20011,0x9CA6DA0,0x4A5CD61,0x512DA6B,0x1CDE3945,0x18313A5A,0xF8F5BF7,0x1D4E8985,0x7E94518,0xFA8}},
+    {{0x170AAB15,0x1221C85E,0x122270FC,0x12822257,0x14D68534,0x1F358144,0x556137,0x10EE2060,0x11B1BA78,0x1E39B9E5,0x1B0A805,0x1FB8A7A5,0x3883C81,0x37E1768,0x1178FEF3,0x77F},{0x1FD6418D,0x169C5637,0x1AFEB627,0xD8CCFD2,0x17EAB4D6,0x9A37A7B,0x13C2444A,0x1AA32980,0x1CF68C48,0x1FA07E84,0x1558F3D,0xC5EDEB6,0x8C4ACD5,0xB2E8605,0x760CDB6,0x1298},{0x1E548335,0x17AC6441,0x1A16539A,0x1FCBA89,0x136415CA,0x10C5CD0B,0x1E4047B,0x14C08DB4,0xB337881,0xEBAE05E,0x301FD2,0x40B3E65,0x1DA52467,0x12200A9E,0x391EAC6,0xF05}},
+    {{0x3D66E88,0x1469A88C,0x6A4740A,0x1FF70C34,0xA7850E5,0x1B4613E1,0x669525B,0x933FAC7,0xAE80800,0x16E290A9,0xBFFF470,0x165CC01C,0x102AFFE8,0x18BAE3AC,0x14B3380E,0xB89},{0x4F57E78,0x1C56BE21,0x185CDBE1,0x14EF9EC0,0x12F85038,0xA943B00,0x1146E5EE,0x191FE650,0x1D5392DF,0x3A9E636,0xD8E9BD4,0x1128E5E2,0xC4471DE,0xD430147,0x3CBDBD1,0xE06},{0xD98FBE4,0x9DEF8A8,0x1C5857CE,0x30CA6BD,0x10F0E3D3,0x183202C,0x132F5135,0x1C051B17,0xAFEA3F4,0x8EA892D,0x1F89D0D1,0x156091ED,0x1A5A154B,0x13DFA37D,0x1D740C2,0x4A9}},
+    {{0x237639D,0xA7BAEFE,0x1076DC0A,0xFCB5AD7,0xEB3D28F,0x4EA1F03,0xD7911E6,0xDD13E77,0x2C01A1A,0x1C7E2135,0x1C70C561,0xE0A67D4,0x184AB1B5,0x1408C53B,0x1A1B9DF2,0x14B3},{0x36AE155,0x16ED899E,0x103546D0,0x1293E3A9,0x29D0551,0xB2A8404,0xF94A460,0x1D841C47,0x1EC67181,0x489A823,0x1711EAB4,0xB44C46F,0x1CE1E2E2,0xDA650E9,0x148834F,0x3BC},{0xBC65C47,0x7B0A106,0xF652026,0xCD8D6E8,0x173036A5,0x8E2F693,0x1BFF4DC3,0xC818C60,0x4F32DD8,0x1F65008A,0x8EA4DCF,0x1489EDE6,0x8213F69,0x1BB614D7,0x18569FF7,0x1134}},
+    {{0x14608F72,0x1E5EDEE6,0xD684F1B,0x3686A44,0x164BB3C2,0x4D324BF,0xC4B057,0x2275E47,0xB36322D,0x1BAFDDFA,0x171B1905,0x1C2A414,0x1967E81E,0x1C388C66,0xCB18F78,0x1301},{0x19AE44A2,0x17D4EDB0,0x85DAF15,0xE0503BA,0x118A7F81,0x187E81B8,0x11504A6C,0xDB3890A,0x4803962,0x135DA1CB,0x143B92B6,0x13186AA0,0x16D67F5D,0x6AF64E0,0x1330C631,0x1EA7},{0x76AFE1C,0x1DD285D0,0x12E1DB1,0x16C5C452,0x182068C9,0x62FE658,0x72C8E1,0xF8A444E,0x145A6A0F,0x1E28BC7A,0xDE08F7B,0x159888F9,0x45DA15,0x17270DB2,0x5EC8F9E,0x153}},
+    {{0x62B1743,0x640B6CE,0x1693D0F2,0x83D1160,0x17CEA06,0x18F13AD8,0x178DC29C,0x66AA5BD,0x8875DC7,0x19D346CB,0x192BD22A,0x690BB6E,0x5AC0810,0x1737C581,0xA816147,0x28},{0xB249CEC,0x87BCDDA,0x14F3CC03,0xB9DCA3B,0x1A10AC68,0x134EC999,0x5B4FD60,0x14566F01,0x19B221AC,0xA337CB3,0xBFB6420,0x1B28D91E,0xB962DC9,0x198B244A,0x1BA065D8,0x99F},{0xCBFD0F0,0x13720BAC,0x1FBB9B37,0x17514898,0xD8C0605,0x195BC69F,0x1C6CAB55,0x1250F0F9,0x1E20F686,0x1090B4FA,0x7159001,0x187FDF1C,0x9667DCE,0x4F7130C,0x450E2D9,0xE54}},
+    {{0x3C9D012,0x17320E42,0x11732764,0x31718E4,0xFA975BF,0x869B426,0x6B0F57F,0x3C5F7C7,0xFDFE6A9,0x15D885DC,0x13626F7E,0x13F877D8,0xCEE963A,0x1AE85637,0x33B7480,0x1F1F},{0xFCBD449,0x1B6869A2,0xDD12F61,0xB6F251A,0x10C472E8,0x1DBC0124,0x1719026A,0x3DFD93A,0x1E59CBA0,0x5AF2E3,0xEF0E32D,0x4102DA3,0xE644B80,0x1F57FB63,0x1641FBDE,0x458},{0x6D61E4,0x2937BD1,0x191DB10D,0x19030793,0xD8A6F4F,0xAE01FE3,0x5C45A5D,0x4A16410,0xF16A780,0x8507828,0xB200D5A,0x1CDC2517,0x1283A0E,0x1116826F,0x16C6725B,0x19B2}},
+    {{0x8C48B4F,0x12020922,0xD6CD6D4,0xF06DD62,0xDB5E63,0x12C6C9A8,0x1C53D1A3,0xA7E6175,0x844CEFC,0x123A6B36,0x135DA0B1,0x9B23E55,0xBE20F8E,0x91DD686,0x14F3496B,0x1CCA},{0x8408938,0x28DD6D0,0x158EA67E,0x9A07C84,0x4E34D07,0x1D252B22,0x1406138B,0x1F38E496,0x1D182536,0x10A775C7,0x11EE7B8C,0x120F3DF6,0x9B905E7,0xD77D39F,0x1A240773,0x1CB0},{0x1888BD38,0x14E65DD8,0x1D1A663D,0x17488AF7,0x1AA38605,0x37F5186,0x10D74B3A,0x16206B5,0xF7431CC,0x14B583B0,0x1C78C731,0x189C7502,0x15E019E6,0x7E12AF5,0x3ABB3E,0xADD}},
+    {{0xDCED2AC,0xD4117CD,0x177FA7DA,0xDCD5230,0x7B54963,0x1A4B9AB2,0x192EE7BB,0xB1BC364,0xFCBBC8D,0x1EC45AFB,0x1EF89849,0x9AB061F,0x1071540C,0x1643CC31,0x6B233D6,0xD6E},{0x19FFEE87,0x1D9F1FB4,0x3D0F551,0x66570DD,0x54EB78,0x193F3A6D,0xF87801D,0x1F21556D,0x1DC7DDF5,0x108DFA50,0x3BFCBD,0x1C506F3,0x184CF3BF,0x30C6B1D,0x24EA5AD,0x164D},{0x1B8B83D0,0x1461F21A,0xC7F3023,0x1C4C15EC,0x122DABA7,0xBC098B8,0x18553B32,0x1A326466,0x2350E76,0x186DDE68,0xCBC2F6B,0x19C358AE,0x8959F9,0x5FBC12B,0x1B90215E,0x15E4}},
+    {{0x11F82C68,0x16F8864B,0x18ED65F9,0x1EF2D743,0xCE718CB,0x40D63BF,0xED043AB,0x1DF902EB,0x1A1BC555,0x102866FC,0x7C5D493,0x1B04D711,0x1E61AE26,0xBECB5F8,0x1AB574BA,0x167E},{0x1F226487,0x14A6E7FC,0x1AF80F77,0x1AC1CC6A,0x1B6A3DD7,0x66D0FC9,0x85E72A4,0x1CBE37CE,0x1131E6BC,0x19F02F69,0x423522B,0xA9F9EA1,0x85C61E5,0x1C699D87,0x18D6E89D,0x1FCF},{0xBFF34C4,0x1BB83AB8,0x1FD863A0,0x1271EC0B,0xE4143A4,0x19B96C0A,0x18542D6F,0x13D15D31,0x2CEC6F2,0xBBC8C78,0x17A3B013,0x1746A31F,0xC04624A,0xEA8329A,0x18A09B97,0xF5B}},
+    {{0x1D0518D1,0x1302A0C5,0x27872F1,0x12646FF0,0x5286C01,0x59BD380,0x182C56BC,0x181E3F61,0x17CAA853,0x1D17E1DC,0xF439AFA,0x5E23E91,0x17C5E6A7,0x1F86472E,0x199B49BA,0xAEB},{0x62EAE3D,0x84CA3BB,0x1E5B2719,0x1CA7E0E9,0x1BB81BAD,0x8B67DFE,0x1F8FFB5F,0x1053169D,0x12338C33,0x1636D508,0xDCD1EE3,0x149FBF11,0x1E4B9504,0xE1CD87,0x17D33CC3,0x5CF},{0x7C2475D,0x14C0C81C,0x2D1C450,0x68FEC58,0x1FA2433,0xB200D64,0x92836D8,0x18F453BC,0x30B9369,0x1355D441,0xC152973,0x4215404,0x18A764C3,0x1CACDA55,0x91EB70A,0x285}},
+    {{0x1964EF8C,0x10596C5E,0x16238AE9,0x1CB53370,0x1204498C,0x12CF493D,0x115D5BAC,0x6D3FE41,0x7B3F277,0xC1CBE61,0x15B51CA5,0x1529E65B,0x6580381,0x37DEE1,0x1BC57BCB,0xE1F},{0x149252CC,0xA8530C8,0x108DAD2E,0x113D6942,0x158E00F7,0x11CD8D90,0xD9BAA70,0xF24F5BA,0x163C3A8E,0x12B77B0B,0x10BF60B3,0x1AEBDA8A,0x17E70CAE,0x16BB5439,0x2B0B514,0x1D94},{0x1EA98C51,0x16265006,0x3A9C670,0x1DAD099B,0xA3296E,0x101C301C,0x10A0742E,0x136E8B63,0x8627780,0x134DDD3,0x8B6B297,0x17025BDB,0x12AFB834,0x8FFF5D2,0x161F896E,0x19E8}},
+    {{0xEDD31B2,0xF011D3,0x167FE19A,0x11EEDA28,0x1617B45C,0x1BCB8382,0x1E07A238,0x1580C240,0x1C8922FA,0x16CC2E28,0x4B889D5,0x131C9BE7,0x1FD0A03C,0x128E4483,0x1D1A94BA,0xC4D},{0x486C8A2,0x7C7BB35,0xA23B463,0x1D189334,0x63C4F0D,0x1B22696E,0x1A1BCA82,0x1FA8FBBC,0x1F84A973,0x404D32A,0x939E1AB,0xAE87CE2,0x61CE8A0,0xE86B4CF,0xEA68C73,0x1BE1},{0x3262B37,0x176198F1,0x15675EF9,0x1A1DC7A9,0x1BABC665,0x3177159,0x19B83DBD,0x17120281,0x1AE7F49E,0x1F8247C0,0x14723004,0x1481D8FD,0xAB3C161,0x1E0EEA14,0x6D098FF,0x4C0}},
+    {{0x1FDDE67E,0x112C5AAE,0x13A1C5E4,0x12C62855,0x77D0887,0x14E9C90A,0x1CB8242,0x1174E17C,0x1DECDE7E,0x1A50355B,0x15AC8372,0x153BA717,0x14860D52,0x1F1B795F,0x3BEAF,0x377},{0x5A93DD0,0x149F9667,0x1DC56411,0x17162E3C,0x1A0E76D8,0x17AB9098,0x4F7BCFC,0x18DB8A6,0xFF2CB51,0x12B9A00A,0xA4895D7,0x412E85C,0x4FD1779,0x115F4EB9,0x74C1C7A,0xD8B},{0x1DB231D7,0x10DF3B09,0x1FD1409A,0x1EA92335,0xB737C3,0x194E5FB1,0x181CB65C,0x1497C3E2,0xB96CB55,0x3F5DB3F,0x1A1E0BCB,0x13A5693C,0x114EB3A5,0xF30F7DE,0x3EDB07C,0x19F4}},
+    {{0xE65CAB,0xA0215A6,0x1F6FA8AE,0x8DDCFC3,0x1975F51,0x176FAF70,0x1F0F603D,0x1033549F,0x1F27CC2E,0x1C1DD4D5,0x107E6F2B,0x1288B9C0,0xA39475F,0xCCD882E,0x3D1E700,0x19BB},{0x334BE7B,0x14263ADB,0x155658EF,0x89AC914,0x1EE13E06,0x614A6A1,0x835B0E7,0x55F7B47,0x2D9FE0F,0x1660E9F1,0xEE0239C,0xA8C3023,0xD61737E,0xA400B52,0x1C34C4D8,0x185},{0x3CC8595,0xEE2A092,0x8FFD860,0x14B5D5F5,0x1D01B677,0x127CE984,0x104EC855,0x3658622,0x174FCF,0x1BAF9827,0x73D1965,0x1BA28AA9,0x1ECD10D8,0x10D2C17D,0x158FDA98,0xF57}},
+    {{0x2893DD1,0xD0988E,0x552147B,0xDD00389,0x18D00577,0x1A2948FF,0x1163A52E,0x641AE3,0xCA1B6,0x17184D67,0x16A548B5,0x756D68,0x1BAAD184,0x162B06E,0x12FA57E7,0x188D},{0xE72148C,0x726DAB1,0x1DDBB0A6,0x12DD919E,0x175D1727,0x16EA19BB,0x1BBC169E,0x1F886318,0xD7AA009,0x1E8B47F4,0xFE308AC,0xCFC1AC4,0xD03BDE3,0x68B1602,0xF6CD336,0x169F},{0xFBF6CCB,0xD87A49F,0x14818653,0x318715B,0x1886E73E,0x85A7760,0xD94FF8A,0x194A93ED,0x16679365,0x141DAB44,0xC26537C,0xE803BBD,0x2FFD561,0x1DB6F3B0,0x12CC51F0,0x195D}},
+    {{0xF09B6,0x6529C72,0xB6544A8,0x2CFBF3B,0x1DA384AA,0x2DAD05B,0x627BED3,0x7FAD690,0x198C220D,0xDDC3B2C,0x5EC1991,0x13574984,0x1D2AEFBC,0x9E800A7,0x4565617,0x1F14},{0xAA6F2FA,0xB386FD0,0xDD39DF0,0xE3B8114,0x1CD0280F,0x246653,0x10340D79,0x547B3D8,0x4C1B252,0x3647C4A,0x218822C,0xF27B942,0x1372E5D1,0x18B503A9,0x1C8E208C,0x2CE},{0x10A2B8A2,0x1A935F4,0x1E28CD04,0x11B7DEC0,0x934527F,0x1760A0BA,0x10A92B07,0x72A7D75,0x247A04B,0xB95A39D,0x1C10CE94,0x1FA2D244,0x14EA426D,0x1E0DE9DB,0x1CF88FA4,0xC8B}},
+    {{0x17DC0F49,0x1B1A0DA6,0x17D1C694,0x1D5FED85,0x15FB8E91,0x1110763C,0x17F0EDED,0x7098F49,0x1F2D3749,0x1974F99F,0x1194E983,0x1EE671F1,0x8AC2EFE,0x477608B,0x51BF390,0x8C},{0x308B0C3,0x4D9CD60,0x4DAE15C,0x1FC065AC,0xDFC4AAC,0xEF703EC,0x12F56907,0x4C15055,0xD27C3D7,0x74DF06F,0x1582E49B,0x183D9CA3,0x17F45806,0x2CE7D17,0x1F1B477B,0x1C6C},{0xBB8E189,0x5528240,0x1A1178A5,0x1AAF5E8B,0xCAE9F12,0x1CB83D28,0x85EC70C,0xE2E1709,0x9CB16F0,0xEECC31B,0x37AAA2C,0x1E9926F9,0x1F24FEE,0x103198E6,0x1061D345,0x819}},
+    {{0x4DE9428,0x182C8824,0x96AF7E5,0x2C40A85,0xDA16A4D,0x1CD5076F,0x71B596E,0x1F3527EE,0x135B8DFA,0x77445F0,0x13955F2A,0x35A3B3E,0x16AA2678,0x24FA644,0xF8C5B1B,0x1A7F},{0x2C34C3D,0x10446C29,0x16EB7FC7,0x1B76DAC8,0x18385450,0x19F18405,0x13142AC7,0xFAB998A,0x6EAC065,0x1602703F,0x165ADFBC,0x3D34F74,0xA8A73A8,0x61AE676,0x1320A1,0x1417},{0xFA39F80,0x1CA0C097,0xC193364,0xEFC0E71,0x4855470,0x14F3B554,0x1DA1AB12,0x1A9779BB,0x1DEA9FA6,0x92CE692,0x4D0B551,0x5ECE12B,0x18176AB7,0x177B06D0,0x19349B75,0xB6F}},
+    {{0x17089DA,0x23F55FF,0x1BB24314,0x25A308C,0x4586153,0x1CD288D5,0xD230E6C,0x105D767A,0xDAF1B52,0xDD50562,0xF9EA76B,0x10DDD44D,0xBA8554D,0x177AC4C9,0xF6DB57C,0xFF9},{0x156863E7,0x99073CD,0x29F738B,0xDD73A18,0x11784CBC,0xDCFA01,0x1B9EB07E,0x12ED1047,0x14F9D874,0x1B7535B7,0x1ED95FE6,0x54F078C,0x17470FEF,0xB711B9A,0xA3D656,0x1E70},{0xEB32E80,0x20FC914,0x13680388,0x8C9C1EE,0x9028DCD,0xC7151C,0x190C14C3,0xD9844B0,0xABA9248,0x100852DD,0x4FF3F82,0x135BFBF2,0xA70C118,0x63DF6D0,0xC9C53C9,0x1715}},
+    {{0x1C1CC4D3,0x16A7037A,0xCAD3C0E,0x1F465C,0xFC4628D,0x8CAB5CD,0x13A4E76B,0x2D2B873,0x1E08A004,0xD51CEA0,0x1C99BEC0,0x681FAFF,0x13D545AF,0x12C26301,0x1550A38D,0x5EC},{0x18DFF960,0xA67D8F,0x136A051D,0x1EE46DFF,0x8D452D0,0xA63533C,0x149DFD82,0xE855A94,0x5A07EEA,0xD51B4EB,0x10E3588A,0x12EC4F8D,0xE098863,0x18A172C8,0x129BACE2,0x6C3},{0x44C90FF,0x82783D3,0xBF83FD4,0x1991BB1E,0x9953550,0x9734407,0x35A27B5,0x369D0A,0xDF85E9,0x18906D0B,0x109721D2,0x13F48BB6,0x1EE041B1,0x80BE9C3,0x103BF58F,0xAF9}},
+    {{0xB1C7E9,0x4F1BFA8,0x15DA3E5F,0x1AF58A33,0x43BAF4,0x4B2D3CB,0xE1B1D32,0x159DE1F8,0x9794DE6,0x249157D,0xA92EC62,0x19A6C47F,0x428ED0D,0x1AC66809,0x5D5FC49,0x14EC},{0x118C1B98,0xEC0A2A7,0x120EEE63,0x178FF7C4,0x184F8C24,0x56AC0BF,0x19295966,0x17D385EB,0x186DB9C0,0x12DAC69,0xFE2A31E,0x72A28C,0x11AD01E1,0x3B1907D,0xD0A053D,0x1063},{0x894EFFD,0x7119999,0x14EFEF9B,0x5E76644,0x6EA6C81,0xDD05AFC,0xDA0724A,0x545B545,0x18E16407,0xA17FB5E,0x1FA3DE17,0x12109CDD,0x22C9190,0x10960C27,0xA7C1A00,0x183A}},
+    {{0x1BF62DA2,0xF084763,0x10C5C642,0x1BE9D09F,0x66AC47A,0xAC3255D,0xD52523B,0xA9941A9,0xD6B5EAC,0x1D7BA472,0x8BC7C5D,0x1723D4C4,0x19B087CC,0x1CBFEAFC,0x38D95EF,0xCA1},{0x10D459A2,0x106EC25B,0x1C1C7B3D,0x1FCCD427,0x1168C1BB,0x9CFA98,0xA59967B,0xCEB80BF,0x2F99BBF,0x33C274C,0x173BAB35,0x56B1DDA,0x969C2E3,0x15093F85,0x7B2ADE8,0x68E},{0x4696324,0x16BF3E49,0x9088C12,0xE10F25C,0x19882F6F,0x648FD46,0x130A4A01,0x14C8463B,0x2F44DE4,0xD798E2,0x1D8F8B33,0xF7A355,0x19DB412C,0x5D54CB8,0x43E2D21,0x1714}},
+    {{0xFD3CFE,0x7543251,0x9A9B9FA,0x1AA2D8D0,0x8FA3744,0xBAD179E,0x7C534A3,0xC9D1CC0,0x1A3AAE6A,0x1A0BB386,0x11E0EB7C,0xFC6F494,0x1F00A70A,0x3861E61,0xECC5730,0xE11},{0x162F803B,0x141DB24A,0x18D3D7D1,0x6863861,0xB6838DF,0xBE4E650,0x167AF5FF,0xE56A357,0x1623644A,0x4DD748D,0x42DA7EC,0x13969025,0x48EE914,0x130FABA0,0xEAF8FF1,0x14BD},{0x10C70792,0x1AE66841,0x105AFE08,0x7F69B60,0x13C148C6,0x7F66971,0x3036B17,0x2B4FA1,0x1BB68755,0x100E3921,0x5FE8C8E,0x84F16B8,0x4A6E6C3,0x1DFEB35B,0xF1F6C85,0x16F4}},
+    {{0x65D22C0,0x26B7F3C,0xBE70AA4,0x1C82AF8A,0xDE917A9,0x193A6C3A,0x15C53316,0x195ABB49,0xFF5E8A5,0x1D1FE24F,0x1E26673E,0x143C0899,0x9FCC249,0x14986E14,0x5F7864C,0x1D},{0x1D6DE601,0x1A449D20,0x1133F9DB,0xA45CBA9,0x1E7C12F5,0x1ED7A54A,0xB7EAB31,0x1042060E,0x38927BB,0xD7D13C5,0x51AB18D,0x5C4DB7F,0x407CBDB,0x7FED324,0x416DA11,0x1D18},{0x17A791B5,0x1DEF55ED,0x5A26B9E,0x18169737,0x6895864,0x10E52B1E,0x308B736,0x1F87F675,0x191F835F,0x7EF0B73,0x9AE2E84,0x11EEA3BF,0xFA6DA12,0xDE8ADB7,0xCFD6B51,0x19A2}},
+    {{0x1B765479,0x42024A0,0x1160DF71,0xBFBD9FE,0x12ADBD46,0x30BCB1B,0x1E4C5660,0x68BF098,0x6B6AAAD,0x1BAB6972,0xD28E12C,0x5A607,0xCD5B392,0xF43A205,0x929F11D,0x9E5},{0x5606FC2,0x1C70ED,0xA70BC14,0x85B0438,0x13F139DB,0x1F603A65,0x19D3B166,0xB3BC5FD,0x1EEA84ED,0x188AD40C,0x18B0FA61,0x783ACB8,0x1440B972,0x1308B975,0x1DD5006F,0x1724},{0x1224C58E,0x135EF5DC,0x18C39A0F,0xDEB1A3B,0x13B23510,0x1CA39D0,0xBAD5F3,0xCE3865C,0x6592A27,0x1E61250C,0x15800C4D,0xE393B9E,0x17F14C80,0xE7C5CC8,0xE7087BB,0x11BA}},
+    {{0x1D0FB585,0x2272528,0x1BC7CF3A,0x1C0108D7,0x1A8E2DE1,0x1A76F79C,0x18CCECE4,0x1108615F,0x10543371,0x192563C5,0x1793268F,0xD481E73,0xDDDC9AE,0x6A881CF,0x55E3AB,0x1E8E},{0x9A2F31A,0x8F1CB4A,0x12C66A2C,0x1191481E,0xC9D239D,0x136EEE88,0x11621F81,0x18DF2E84,0x1113EA28,0x154FEDA8,0x3EF8448,0x4CF6B5E,0x89F36E0,0x1266986,0x103DDD3C,0xF63},{0x132989AB,0x167267AA,0x1E4DDB3C,0xF9736FC,0xDC0BDDC,0xE3D73FB,0xD5758D9,0x148E707C,0xC346EB8,0x1DD89F6B,0xD7FC081,0x1DA52045,0xA1F9273,0xE9713E4,0x1440170F,0x1A08}},
+    {{0x5E6F3DC,0x1C70EF5D,0x101A97FD,0x1F8C6D9E,0x6C80CA0,0x570B958,0x617FEE4,0x106ADB81,0x189A05E,0x16144AE1,0xBB1D586,0x740DBBF,0x17499628,0x6A1D51A,0xC989F9F,0xDBF},{0x12C8CA27,0x1B2BB6F2,0x924063A,0x4D4950E,0x1C5C3434,0x200613A,0x16B4B643,0x189C6900,0x161D8743,0x1F9B28D8,0x166DCC4A,0x1C016773,0x18E20BF7,0x1EBF2EA5,0x6F7DE34,0x1113},{0x17F890D3,0x1034EBDA,0x7EA68C0,0x1536EAF2,0x11BDBA62,0xD917D8C,0x1B654048,0xFA3E3B8,0x12C92FB6,0x1464A5BC,0xC96AB09,0x4ADC376,0x1278A82A,0x57AD835,0xD855AC,0x1331}},
+    {{0x73C92AC,0x1844D9F,0x1E55E9D7,0x1FE7E4,0x19D676F5,0x1C21E9E,0x67525B5,0x149CA8F4,0x1C98E924,0x9134488,0x3E216D5,0x158BF567,0x81183E0,0x4620824,0x13AA771E,0x1959},{0x1E3C6AAD,0xFDF174A,0xACE9B3C,0x34F6732,0x587D78B,0x298176,0x3860984,0x65EB134,0x19786106,0x1931566D,0xA3E48CA,0x142A3C9D,0x194E9C09,0x1C84D908,0xD916126,0x1562},{0x8AF6F42,0x8C34879,0x19D36F3D,0x348B70C,0x10415AAF,0x1378D351,0x9586006,0x18DD736D,0x518D53C,0x1E5B7063,0x11B4E82A,0x16D6F837,0x10729B13,0x158D6ACD,0xA311F2E,0x5F0}},
+    {{0x1DF379A,0x8EA36E9,0x13F213E1,0xD2372D,0x42C242B,0x141A20AB,0x1016AD59,0x9640340,0x16926268,0xEE96BC1,0x12647C35,0x1E562F99,0x1A8A33AC,0x75E02A2,0x12A26E7A,0x2E1},{0x19E1E2A7,0x19273B73,0x1C2E6802,0xDAE77C1,0x3FBD5E2,0x113C4B30,0x1C61B2E3,0x1709B30,0x1864ED59,0x467CE34,0x193E914E,0x10619DD7,0xDBDF1CB,0x871C6FC,0x1B13C9E1,0xFC6},{0x142A59B5,0xE351F8D,0x142B1AB7,0xAC0619E,0x182D9775,0x1BDF74F9,0x1946151E,0x1B9644AA,0xC5D5B5B,0x90763D9,0x45E0E64,0x42A4749,0x7E0CF79,0x15CE84F6,0x9A54D68,0x7D3}},
+    {{0xF5ABF10,0x191D55EF,0x13DC384,0x6F52BDF,0xF266973,0x11029CE2,0x43B3887,0x3F75D50,0x1C493284,0x18CAED47,0xC133B46,0x11881E45,0x7F6FF06,0x1DEE7F11,0x19644296,0xFF8},{0x1F52D5D9,0xE79FF60,0x1D1FBC56,0xA52C97E,0x7ED26F,0x9F71DEB,0x6A34BE6,0x107FE025,0x1A319655,0x430A52C,0xC139393,0xC8638D1,0x7EA1DBB,0xD44AF0A,0x37ED534,0x15A0},{0x1EEA9E04,0x1EDC513B,0x8E33104,0xFA05418,0x14453B77,0x12F3FCBF,0x1E195B0A,0x12A37548,0x15834A8F,0x4246877,0x167457D3,0x12BC2952,0xAE5875C,0x169923BF,0x198BAAE7,0x1D46}},
+    {{0x643B0EC,0x6F9F3E3,0x1F19C9F2,0x137DFE8B,0x1F567A0D,0x1F051730,0x1792F0CB,0x1C0F12BF,0x10CD09EC,0x197E2C7A,0x143F5443,0x17BC35B4,0x3ACC34F,0x13CCE76E,0x1C9ABCA2,0x15FA},{0x18411BE,0x19D35C0D,0x1BE5701,0x1DAFC549,0x50A02DE,0x74917F5,0x6FA6EB5,0x947A80A,0x84FFFDA,0x14FD8D53,0x1B7ECA44,0x6D3C42D,0xB41F34D,0x139F2068,0x1B9DA9A2,0x1DD},{0x127425B5,0x1CD0457,0x13D13078,0x3D630,0x3F410F8,0xF0E9097,0x10CD18B7,0x1755581D,0x1C7D725C,0x2ED40DC,0x14FA570F,0x1A281C42,0x162FD87F,0x692641,0x1FBC84BC,0x614}},
+    {{0x16AC573C,0xA8C899F,0x1F530FCF,0x13B8946B,0x17757AC,0x2A01150,0x150AE7EF,0xC3F0312,0xDECD1E5,0x127313A2,0x97CF2C0,0x14140A42,0xE5A9073,0x1AA114C0,0x1BDCDB73,0x185F},{0x106E4353,0x4537971,0xFDA1350,0x2C682C,0x8F79CFB,0xB2AD702,0x151E66A2,0x19ACB449,0x1705DB7E,0xDC38433,0xC5C7DBA,0x13FDEB31,0x8A5BE27,0x1FBCE6A9,0x8294650,0x291},{0x111CAF5A,0x6F3C206,0x1CCE0E85,0x1A800F01,0x6D61962,0x95D9EE4,0x1F07282B,0xE1DE86A,0x1285471F,0x1FB50277,0x12D45A9C,0x1B72218A,0x456EA1E,0xA59B404,0x8B456F2,0x13B4}},
+    {{0x1A5100E7,0x146611B2,0x2164908,0x604DEA,0x1A3D714D,0x18526F3C,0xFE43F2C,0x141DF41A,0x159474AD,0x850936A,0x9DF250D,0x168BAD1F,0xE570C7C,0xFDFFD40,0xAEE0E61,0x1C08},{0x1FE13DBA,0x1A8E4078,0x133C1575,0xFD59C46,0x1B73F95F,0x4B5C0CB,0x27736FA,0x12D394B5,0x15FDFD98,0x11B90926,0x155A79F2,0x166EF8D2,0x6A8BAB,0xCE72C74,0x1331EEBE,0x1236},{0x14326499,0x1BEA9E9,0x98B90E4,0x18222E09,0x1EBA9C3C,0xA408981,0x9592FE1,0x3CD143A,0x1FAF9C00,0x66AD1A7,0x64DB7E,0xC0D7914,0x184E370E,0x1FC981EF,0x5733CF9,0x2B9}},
+    {{0x182401A,0x19234257,0x10869C1B,0x1E16F383,0x18D8998A,0xFF0EC0F,0x3D2EC1A,0x1555BF0E,0x5CF3DD7,0x7C6ABFC,0x181B9290,0x1542C5B1,0x28C8B55,0x50D0629,0x912AA70,0x1868},{0x168F544E,0x1DAE367C,0xF788EAD,0x194AC0A6,0x47C690,0x13552A89,0x16C4AAAA,0x14041DB4,0x9A751A6,0x13975052,0x1FFCAEA8,0x514DAD9,0x156EBF4C,0x1C524ADB,0x1C1D3985,0x1AE8},{0x39569C4,0x3D430FB,0x879B821,0x1CC34167,0xEA6D5D4,0xB592022,0x16782E57,0x170716E9,0x19C85D10,0x12CB705A,0x17E49679,0x6F715AE,0x1E1EAAED,0x12BEA61B,0x779363E,0x1A79}},
+    {{0x13F66938,0x1839054F,0x1B605277,0x3326AD6,0x19A3D7F6,0x18DC4E20,0xD12E9B8,0x191CCB02,0x161AB936,0x178E8982,0x1DB1036F,0x108E0C4B,0x16A2B6BB,0x835BD96,0x2CA6135,0x795},{0xFB011B0,0xB5FB94D,0xCD1232,0x3860F,0x8083742,0x1C3574A8,0x36881FE,0x153EF035,0x15857562,0xD5E62A6,0xD921631,0x11F936E,0x10353599,0x89C6FDA,0x1DFF658C,0x117E},{0xCE94C48,0x4035BEA,0x187BCB27,0xC69CA44,0x7C0A7F0,0xD553C57,0x11F26FAF,0xE3768B1,0x94C00F9,0x16CB0052,0x1555901D,0x193FBDDF,0x1A292FA3,0xB716135,0x14554274,0x72C}},
+    {{0x19E157E3,0x55CFFF3,0x15137056,0x1F39FC8D,0x1C8A4A3E,0x1421AAA8,0x100EDF8E,0x14EC7159,0xBD49954,0x7B84527,0x4304C65,0x125452A7,0x168B2538,0xD889D15,0x18B08975,0x182C},{0x3A5D2BB,0xE7DD039,0xF30C9F2,0x9FF5EDA,0xBC67E25,0x436318A,0xC4BCC88,0x1C2CCC2C,0x197BEA72,0x117FBC07,0x1D000084,0x153292B5,0xF247578,0x128F1AB1,0x1E68DDF3,0xBE8},{0x6C100E5,0x3F71F65,0x33E984E,0xF4052F6,0x102E8680,0x1312BF9D,0x1581CE32,0x9004A7,0x1EDB0EB1,0x1F7BD07A,0x1C4F6B5A,0x43C88D8,0x165CD0EB,0xF8C439E,0x19D6228E,0x1668}},
+    {{0x1DB25B2,0x1779E78A,0xD46536,0xBE43802,0x1DC76B7F,0x11EFC56C,0x51C0D4F,0x1B6BE15F,0x1409AD8C,0xDEE6822,0x83B7B98,0x9804CD6,0x8193ED6,0x1C1DC0B8,0x1B3BBB9B,0x1A0A},{0x75A0506,0x18B68880,0x13ED421B,0x95CD692,0x13B43D4D,0x146BD93,0x18230F44,0x169690DD,0x1AF8EFD9,0xBEB84D9,0x18BAAA2D,0x14149C85,0x11D5937,0x10AC3734,0x1CA1EE60,0x98D},{0x1976E2B0,0x1C9134AF,0x6B5E503,0xB064B22,0x83B788F,0x198CDCC8,0x57EB200,0xE11ED12,0x188B5C51,0xEBE5138,0xF388404,0x1D846035,0x129C005F,0x17AB6801,0x78457B0,0x8F6}},
+    {{0x6CFAD0F,0x744095B,0x1DCA01CE,0xAC4D363,0x1838138B,0x12F1EA60,0xA106412,0x18AD622C,0x2E65ADF,0x6B41DF4,0x187E31F9,0x1B91FB33,0x19BA549A,0x1C051DB4,0x544A812,0x16AA},{0x1B6837DD,0x4AA1946,0x1597FBB6,0xFAC106C,0xD2C7A34,0x1CF7D34F,0x54909F1,0x1A679EC4,0x5956C28,0x42576F6,0x160763B0,0x2BDC1F1,0xB0E31B5,0x55D509D,0x1D88832F,0x85B},{0x128D00,0x1CB9E57E,0x1765CEFA,0x6653F1B,0x2B7D5F3,0x18291AD7,0x7EEA78A,0x118814D6,0x6B33A44,0x153FD2FE,0x1AEFE4F3,0x12587D4B,0x14CB38C3,0x1A6FE33,0x1C235E75,0x524}},
+    {{0x72B6D7C,0x13854CD5,0x7C05877,0x116D365B,0x12F35DF9,0x3C3C62B,0x1079E0E,0x1CB3AA9E,0x9D9215,0x14A11F8D,0x220FC43,0x1552FA01,0x1F140D58,0xB28B943,0x167396FB,0x48D},{0x1AF52549,0xC118CA,0x1DB04FB1,0x1E36654D,0x3CA1C64,0xC7FC773,0x12223C70,0x1C74476B,0x1E7883F7,0x2AFB4D3,0x951D346,0x19708684,0xBD6CB48,0xB6F75D1,0x1A2B2C,0x8F4},{0x5F420AF,0x12FDA1D4,0x1C04A2BD,0x7649A7F,0xEF7E7EE,0x1F3192B9,0x67334D7,0x297B867,0xAA80D17,0x8A627AE,0x15EE447E,0x1D6578E6,0x369D480,0x6193EA3,0x6254461,0xCA7}},
+    {{0x17A3616A,0x70505F8,0x17E99857,0xEEE783C,0xB2A9832,0x1829EA9C,0xA9072FC,0xA6ADE2A,0x15A932CD,0x1F7FD4B9,0x154D7A82,0x593ADD4,0x555A0C,0xB495D42,0x4C56390,0x6C8},{0x12C90FF7,0xE7A9FD8,0x1BDE54F1,0xCFC9140,0x6E45D2A,0x5F96A23,0x19C61BB8,0x98848E1,0x8AEF9C5,0x14ED0FF1,0x94CC809,0xF25F525,0xA5681A3,0xB50DE0C,0x15292C25,0x1514},{0x1FEC2F88,0xDC10982,0x385DED4,0x48805AE,0xE69557A,0x675DCEB,0x1DADBAB8,0x1A5029D7,0x1BACBC1D,0x10DBAE3E,0x1A44A431,0x1D3FE91A,0x162898D2,0x10CCEC59,0xC8BAA7C,0x1086}},
+    {{0x8F9FA0D,0x1C68E533,0x280BCAF,0x169DB2BB,0x19F630D7,0x8E8CFE3,0x113D1BE9,0x7E0891D,0x1D8623BF,0x14A59B8E,0xAF35943,0x14E1D29F,0x1FCACD90,0x11DB9D79,0x83100F3,0x1EE},{0xD636C3B,0xAC840A6,0x1511A651,0xD9ED251,0xF484A4C,0x112C21D5,0x6BE6D1C,0x1F36B498,0xB36CFB2,0x1201288B,0x13C0CB09,0x543E491,0x59E2741,0x1E2EC668,0x154DA18B,0x10CD},{0xB0BB927,0xC897132,0x1BE1E3FE,0x34969C5,0x198D0CD0,0x7E51807,0x1CB13EB2,0x191F21A3,0x28E66E5,0x32F1106,0xE0F04C8,0x1714CAA,0x52DA1AA,0x164BD765,0x1DC66FEF,0x15E5}},
+    {{0x17C4BB1D,0x2120FB2,0xBD461F1,0x6ACE2E0,0x1F397375,0x6C54A24,0x1CB30303,0x184E5EE,0x1EE58E28,0x14E0DBF7,0xD252D7B,0x54AF664,0xF473114,0x64F791D,0x387758B,0x1018},{0x1675FFE3,0x65E02DF,0x1C96338F,0xCC42B9,0x1928C911,0x162E911,0x8CA9A6F,0x9061C25,0x8076A9F,0xAFAF7AF,0x13B48CA7,0x19E4EF2C,0x1BA58A72,0x19B2EFC0,0x9C35B86,0x71D},{0xCD4C3C7,0xF094D43,0xB3539F5,0x3A41436,0x91DCBB1,0x3F0A7CC,0x12482047,0x76CA009,0x19945F2A,0x2729E9E,0x124E0D6A,0x1FB6D5E3,0x117ADE9A,0x961ABF5,0xC107771,0x5C5}},
+    {{0xC6B0C2F,0x52E29D7,0x9CC4B61,0xD8970E6,0xBC73273,0x7E1BA6,0x1FA4C433,0xA551AF1,0x8665D17,0x193ECC07,0x4B58011,0x4414C4D,0x19280146,0x1F52AE83,0x1FB6E183,0x17A3},{0xB35D111,0x1E5E27C5,0x1CF8CBDD,0x6B7519B,0xDB614B9,0x6EADB8D,0x17CBE202,0x42F6745,0x1C26EF27,0x1804DC4,0x1511F0C,0x15CCAB4A,0x4312986,0x1EA61082,0x80448D9,0x84F},{0x1334A582,0x1C5461B5,0xD3EB0E2,0x90A7CC3,0x8A3CD48,0x1B60572A,0x10A70979,0xE067F2D,0x1BB7D528,0x18C37FD7,0x898DCF2,0x18629C12,0x108B4796,0x19699E63,0xFA35FEC,0x68D}},
+    {{0x1AF4A11D,0x1AF6FE92,0x1E119E0,0x27478A6,0x873EDD3,0x1C590043,0x1B3F83BB,0x18EE9C01,0x12F3DD78,0xF8DD32E,0x190DC666,0xFD15626,0x1E5DDE9A,0x304FD4D,0x11B3A1EA,0x1D62},{0x165353E9,0x3B57EB2,0x17546E87,0x1FF4E047,0x237EDE4,0xDBD04F9,0x1D82E9E8,0x159410A,0x82B9995,0xBD6CB9C,0x99BA941,0x1C93D128,0x4217F55,0xB3CE80E,0x1EE71555,0xD39},{0x120F18C1,0x118254C7,0x762AAF7,0xE4D1D8C,0x16D8AF99,0x1D07D9FA,0x146B3149,0xE2B4FC4,0xFDF79A9,0x1B5891B6,0x4DB12D7,0x1551D29A,0x13957FBB,0x6D89AA2,0x81B1C94,0x1A9F}},
+    {{0xE07C287,0x1D6CC1C9,0x4724AEE,0x1E2F4505,0x12BBDC96,0x64B8014,0x10733641,0x9E66611,0xD5066AF,0xC359816,0x33E00F9,0xF5FAF1F,0x174D4716,0x1B15EF5E,0x1BF3C5A7,0xC0D},{0x1F7071EF,0x1FED5A0,0x1BC9B8E3,0x940673E,0xDA78A89,0x9D3565D,0xDD8DC13,0x142522B4,0xF41E60A,0x171FD563,0x1C8BF887,0x1A6325F3,0x9AF1454,0xDCD8184,0x13500E5A,0xB7},{0x126B1622,0x1B5F6FF,0x4FD05A3,0x189ED045,0x120C09AD,0x1BD2A381,0x158AFCD7,0x15B0F688,0x526A315,0x8D7B497,0x17F76D10,0x140702B1,0x13B93A69,0x155E90B3,0x1DBD469B,0x7F5}},
+    {{0x1481E42,0x1F4720A1,0x151BDF0F,0x188A39B7,0x1C84F3CE,0x115FFC08,0x1650D928,0x4E3E807,0x17016360,0x1CCD6ED,0x41CC4B7,0x13BB69C3,0x33BCBA3,0x1F950227,0xA1E81D4,0xD01},{0x1C3EFAA9,0x11D771C5,0x1E1D4796,0x180E22CE,0x11AF9C9A,0xE1E8557,0x9DE5872,0x109982D7,0x1DA6F9FF,0x10955EB9,0x1F2F6958,0x80077AF,0xC720BCA,0x1B3409E7,0x1B103363,0xCD6},{0x1893B731,0xF848399,0x14182C62,0xCE59437,0x10D729B5,0x795BD54,0x1A79ED3,0x1FEDA0CA,0x14772466,0x199CB4E7,0x13CF3FED,0xB9BE29,0x1D629744,0x9FC9CF4,0x237239,0x1A4C}},
+    {{0x155A5142,0x1B6B6580,0x1FC42926,0x1A9D9E9F,0x84A7C68,0x3E6DA91,0x16AFE045,0x15751F7,0x8C2FDB5,0x8A233F8,0xE61D3C5,0xABD0A62,0x182E9C5B,0x78F261A,0x13E07958,0xE07},{0x128D027F,0x1AE60FF1,0x157DF45B,0x4E4E0C8,0x197095D8,0x1AE749EA,0xBB4DC3B,0x1C6EB328,0x195F1A2D,0xE08945B,0x25F0467,0x8464828,0x237018E,0x161C0AD1,0x1F4084A5,0x1A33},{0x1CAC310A,0x1D576C5,0x6A33C98,0x5E74F44,0xB6696AE,0x1A3B3316,0x1CFDD49F,0x171FAE0F,0xAC1009E,0x5ACE5EF,0xBAB1FA2,0x67625CA,0x16B0BD52,0x95CD760,0x1DCF4C9A,0x1BAB}},
+    {{0x5681292,0x1202C66A,0x11D0D4CA,0xBEF3A96,0xADD931,0x1DEC2738,0x194F4960,0xEE99C83,0x1E2D51EB,0x1F1459CF,0xDE60037,0x15C08EA2,0xC9DB48F,0x8F983F9,0x1BCA34BC,0x1C88},{0x84D4766,0x195B9C18,0x1B5AB052,0x2DE072B,0x161BB48C,0x1BABA01,0x18A9B1A1,0x946D0AC,0xAA34B10,0x3FBAA39,0x4940247,0xBE47CCD,0x89407D7,0x15D7A748,0x1A884860,0x1E23},{0x1DEA493B,0x17F42850,0x1C202C37,0x6F78F82,0x1C511E6C,0x14C4DA85,0x1D345290,0x63406D6,0x1B7FD3B,0x51BD7B7,0x1C538C54,0xAE60D20,0x11E5E8BA,0x89BE3CF,0x1AF17421,0xAA1}}
+};
+/* End of comb table */
 #endif
 
 #if CHUNK==64
@@ -51,6 +167,123 @@ const BIG_448_58 CURVE_B_GOLDILOCKS= {0x3FFFFFFFFFF6756L,0x3FFFFFFFFFFFFFFL,0x3F
 const BIG_448_58 CURVE_Order_GOLDILOCKS= {0x378C292AB5844F3L,0x3309CA37163D548L,0x1B49AED63690216L,0x3FDF3288FA7113BL,0x3FFFFFFFFFFFFFFL,0x3FFFFFFFFFFFFFFL,0x3FFFFFFFFFFFFFFL,0xFFFFFFFFFFL};
 const BIG_448_58 CURVE_Gx_GOLDILOCKS= {0x155555555555555L,0x155555555555555L,0x155555555555555L,0x2A5555555555555L,0x2AAAAAAAAAAAAAAL,0x2AAAAAAAAAAAAAAL,0x2AAAAAAAAAAAAAAL,0x2AAAAAAAAAAL};
 const BIG_448_58 CURVE_Gy_GOLDILOCKS= {0x2EAFBCDEA9386EDL,0x32CAFB473681AF6L,0x25833A2A3098BBBL,0x1CA2B6312E03595L,0x35884DD7B7E36DL,0x21B0AC00DBB5E8L,0x17048DB359D6205L,0x2B817A58D2BL};
+/* Fixed base comb table for ECP_genmul - generated by scripts/combtable.py */
+const BIG_448_58 CURVE_Comb_GOLDILOCKS[112][3]=
+{
+    {{0x155555555555555,0x155555555555555,0x155555555555555,0x2A5555555555555,0x2AAAAAAAAAAAAAA,0x2AAAAAAAAAAAAAA,0x2AAAAAAAAAAAAAA,0x2AAAAAAAAAA},{0x2EAFBCDEA9386ED,0x32CAFB473681AF6,0x25833A2A3098BBB,0x1CA2B6312E03595,0x35884DD7B7E36D,0x21B0AC00DBB5E8,0x17048DB359D6205,0x2B817A58D2B},{0x29E200A28EEE402,0x2991D3B93FEC39E,0x34229BD22C1D5E3,0xEAE91142974A49,0x15C35E8D97BA72C,0xAAA7518769D34B,0x34BACE9D70983A1,0x1A5B61190CD}},
+    {{0x2CE42AC48BA7F30,0x3B85E6252784838,0x3DF1515DD8BA21A,0x2F9C31D330C06DE,0x34E0891C693FDA4,0x1BE4A7A89568273,0xCCE2C1419A1722,0x12772F171B0},{0x2E236F86DE51839,0x1110A174353D6CC,0x397EA1CA9472B5D,0x89EE296F070363,0x30457D845C90DC3,0x38086E5E72DF00B,0xDE527164B33A5D,0x35241DF92B3},{0x1D13497A534B0EA,0xD8058A5D591EAF,0x268B3DC658A4254,0x2319E270D66F781,0x3FB0B273C9CFDA5,0x1A2D5B97D2B021D,0x2717525652493DF,0x370048A47C4}},
+    {{0x7FD7652ABEF79C,0x25B08281D10EA1E,0x1C5C1840D12A710,0x195281B92A1D914,0x2603BED0B4AD95F,0x25C4974B99CFEC0,0xB722E00349AEBD,0x15148F81126},{0xEA5D1DA07C7BCC,0x3B339DDA4E3AA63,0x1B80284E861D2B3,0x892379DADB87FC,0x21A7B121869C585,0x199EFF414E89D96,0x361C2D743EC056C,0xFE66E7362A},{0x368122748078D49,0x1A613D9E20759FA,0x1C85FA58A433EA4,0x15A0F5525AD2944,0x25CCABABC011D71,0x3FD52C2040D20A3,0x2939A2FD52AAF09,0x3A751793615}},
+    {{0x22538A67153BDE0,0x3888EB2A501ADA5,0x24F9080DC1AD713,0x25DB132D1F605A9,0x2D7BC285685DC8B,0x19AF65EC0DF0238,0x28A35B63FB45D0E,0x347C6F15483},{0x14EB873CE69E09B,0x3C598C592F23B91,0x208F7003BA8D89,0x1ED2E63AB4E1AB6,0xB3A4B93B7BD94C,0x13FD1AE90231ACE,0x2A9BDAE87D1F357,0x31D593D3A6F},{0x18B5D798C529F01,0x5B36079E72C269,0x27FC5D2F2A010BA,0x2F20C19EF6F9F2E,0x178A4E9FA089AFC,0x134FEFA48DD05B6,0x7046A269C4364F,0xED18346E39}},
+    {{0x3403165D0ED303D,0x2D944628048B5CE,0x22BC805761CE3DA,0x3A05C89E2B29858,0x787E5C034134D3,0x30C8D7DC64D914B,0x36411CDD35D30D1,0x1DD21BE7467},{0x1954A89E4CDDF67,0x398E050A3616DAC,0x1997DC1AABDC0C7,0xE9A3FD742FE4F0,0x1ADA1D1BF7EE29,0x3A539863A2B05CE,0x2BE11024F1F0FE7,0x134BFA82C09},{0x1C44BEC879FBEA0,0x3D20A93C5FD2CED,0xA62FFEC3E85FE1,0x367129F0336151D,0x317DA990C93B2CD,0x17A247AAF80AD90,0x3ACEEF45FEC092D,0x3C8C93D9196}},
+    {{0x258F07A037DACC4,0x363079BFE665DA1,0x8DB485DE9136D4,0x3E8E3B245A95EC4,0x1690753CEA1A4BF,0x1A1E69A5B950E23,0x13A323A58A17D22,0x8368558865},{0x17E441CC3D41EA7,0x3EE5313FAFAECB4,0x2346C255A6C7B42,0x1275F8B7132B476,0x25845849C23A3FD,0x2EF94B9D918C841,0xA3C03FF7344560,0x13744EEEA4B},{0x3A43BC6AE9E6D93,0x26485AF8CCEDD54,0x79767F2D0F8A60,0x205DCEF4CDD9699,0xBEF07AD90674A7,0x3C8E72FDAC265EF,0xD445F8F91C98B2,0x2B5D1CE6DE6}},
+    {{0x39B527C6E67A9EA,0x1F8F4E4D8B27358,0x288CADED78B3736,0x154F2DBA0DCF935,0x243ABFB9D9E3D34,0x319555B624573FD,0x3F411643F405852,0x3235839FAFD},{0x317EEC500CF807C,0x19950765B00D1C3,0x197CAD92A0EABF7,0x2BF24470A39F7C8,0x3FC80EEDC1E7B71,0x33ADC5C7741088A,0x24DB64C867F6BD4,0x19A89EEB8B3},{0xE2481245783FB0,0x1FCFB180A1CC0EB,0x289775D77D5A11,0x3EEDB55FF75254B,0x370C8E2F097086A,0x154D0CFF07BC4DA,0x308937E0EC40F99,0x36807D1FA2F}},
+    {{0x3EDB5FBC9120262,0x318C02D0681DDA3,0x278D5B37ED68C9,0x27B127E7BABF5D3,0x26E09D5DD6F5B41,0x313CC0B7A2A4601,0x2E9F966E9290104,0x376100BCDB0},{0xCDE6EC861D7985,0x3D4F03B51F2A083,0x936D4EDC83158E,0x1C92AE650991AF0,0x103FB9C2B9A0193,0x1E6BFBEBC285AB3,0x157671740AB8138,0x6ACACB4056},{0x3470B47E6C1BEE2,0xAA9F69C9C34EB0,0x36FBEB989D3A701,0x29D2729D8A20615,0x2D8EC2D87EDB406,0x14B516105837FE4,0xD08A89CB52DCA0,0x3595107314A}},
+    {{0x1B27AF1A73EC9C3,0x12D9AB67DC3E9C9,0x1807724F58CF73E,0x70FF355E6524D,0x3C906EFB79DA0CC,0x23587A5DF484165,0x369ECD732BE703E,0x1BF4A6FDB42},{0x3CA658AC667128E,0x1F2800DAB1E1CAC,0x1CC969858535583,0x4567CEFA01D73C,0x719F1B9B03809A,0x297DA2073B65CCE,0x71E8CDA0FBE902,0x13631A6D38E},{0x2885D4F707F3C58,0x2FA3CA8E12A41F0,0x60363A1D24742C,0x1EB7631FDC3FDBC,0x2CA3A316D951C05,0x1A1383C0AF4B69B,0xFB15795FF22666,0x3BC8AAE9AAC}},
+    {{0x30A8498945D5A19,0x351EACE71B084C7,0x275C02824F3FC35,0x28EF9DF227BA04,0x293A8491B7C90B8,0xD114E5D8C68A2A,0x10E454D6E816C0B,0x8A1E2FA1DB},{0x3EECB8A46DB3BF6,0x14D03CA55515DE8,0x7A7798689A00F8,0xDA611975D2EE45,0x3209532D7DDA3C7,0x10D5B55D3C5D412,0x38876E356F4D86E,0x1C30BA3514C},{0x17EF2BF6A4A610,0x9800117D62A796,0x3C4FFF96AAC4E30,0x3BC4E513117AC48,0xE124AC4F439D1C,0x392B710D4BBD1BE,0x2782786C36779C,0x27022535AEB}},
+    {{0x3F9DAB7AF075566,0x36138A697D5BC62,0x2D3A4C45AF64E56,0x1633CD9129A9CC0,0x252FB40808156B6,0x3C23CCFBE73E5AF,0x1894FE92038CAA2,0x33EBCB8EC98},{0x3F2A0DBC224CE3F,0x3B41402564BAC9,0x2501743F95889D,0x2A6A2291E1DF257,0x2886755FBDD63D,0x4EE4092B3F1FBA,0x2E64634B020F381,0xF16AB31815},{0x294A84FB69E19EA,0x29C7CD16AD20BFE,0x1FC386E9C60B123,0x135E0E65185F83B,0x112E3F2247F72C,0x18F43C0963189DC,0x2D72662E911AB2E,0x38A8646F424}},
+    {{0x251857164010F4E,0xF82C512C14DBAF,0xFACABB14887D66,0x28EB072BB7B7D61,0x23CB43FB8FAF175,0x2290C42DB57E64A,0x16BFF2C4AA28517,0x1A7265A62F5},{0x373D6372A4D972E,0x4F56ECBA560E00,0xA7BF7D18D89158,0x206973975D5A28D,0x110670B4331F45C,0x7AA5C9969C7E5A,0x47CDB14EB3B07C,0x37C023ABFB5},{0x3FF4A35C1271A1A,0x2D69B8A44E97CAF,0x35A1E044721A4F,0x14BD4A79E4F573F,0x982FA2B1E1A28D,0x362249AC18FD0CD,0x256EECC538AD9EE,0xD55EEB7DA8}},
+    {{0x251A5243CA8CBD,0x3E1591F78BCC3C2,0xB164945AB3D40B,0x217266DA7004355,0x1CB76FD9FDF1F84,0x1F95DD0B575DAA8,0xB00BCC67A8A86C,0xF1B2CA1999},{0x1E895BE9B425CA5,0x9BD4FE21B5ACEE,0x3EEAE79788F695A,0x169BA447287D5B,0x26BC4BEF5CCB545,0x198C548D9559C77,0x2055746B18CD028,0x1BC993C9814},{0x269F95E71F8B562,0x400050157BD991,0x3C81C259A00CBA2,0x3230125E0D6FC2A,0xBCD617F71961DF,0x18D50DC99A5AA97,0x89D58E379D5F5D,0x39EE3C03946}},
+    {{0x1178ACFCD3FDF7D,0x1EBE64FEDECD43B,0x1F30BB56CA7098D,0x206A15BDF9206EE,0x689E53BBB06CDC,0x22822E7267274CC,0x2B92AD8C964BDC,0x230B57F201A},{0x809636E225A881,0xC5C27AB3CA0CFB,0x152A51E957B9482,0x1B93FA7BFD419D0,0xB028614A8E14E8,0x23963B6BC3D96DB,0x1794C777911AB24,0xA58C2AFAAD},{0x1A4200F2CE0165A,0x1ACA20319E9763B,0x1D4984CD6289F77,0x2D5EF5999AC6DBD,0x2100F8CC4F24126,0x14686F572F7447D,0xAE507D69CD8757,0x21D0267AD6E}},
+    {{0x11DCA57CF3044A9,0x2C4E2BAB6BD13D5,0x1F9475B9B171A8B,0xA802B60BB9B48F,0xBFF1CDC520781,0x338EA1D293707CA,0x2A6CF5385A27DC4,0x16F3CF5786C},{0x152A47B6A97EEB0,0x289788E0B543301,0x3E18327D185F0A5,0x2CE3DF9E438673C,0xDBEBAE233AE780,0x29DF25F34FA4DDF,0x30891A0EDB1C6E3,0x3C835F8EB04},{0xE5674220C2190D,0x18B5E6827AB3880,0xC151404493A376,0x268F845F4DC07E0,0x3235F2CAD22FD2E,0x1A6A1F28B7B61DE,0x2E3BB0CF2D7ADA,0x77A8045F5}},
+    {{0x2962BC81FACB83C,0x2053A0A55264E2E,0x2FFC7A6A7F52D3B,0x211C968A6EC930D,0x13238C85C0CA548,0x15C71726C8EC02C,0x3578FD9C70FE0BF,0xD10C66A79D},{0x3390375A9589064,0x2ED7DCEDEAEFE6E,0x11108256ABBB9F4,0x17E44A33E04BDF0,0x37A9024BD083E51,0x26EC6AA4CC69F8F,0x2358B276466F67A,0xC2A4D0A4C},{0x39772ED9B9A5B32,0x4A03410FD3CA41,0x28F194471142B38,0x1363CF5C84A685D,0x13676DDFBC119F0,0x146BDE3DB99D411,0x5F957426B8F400,0x2F305D602A7}},
+    {{0x99EF986646CE03,0x1E8557E04C39840,0x3B75BEF1729B6B0,0x9B11BC2387781D,0x19AF52FDC57ED05,0x24EB8276625868A,0x118595273297B8E,0x44956D42B3},{0x57919DB4A6ACDD,0xDC2295E111475D,0x205B0BD01283F7B,0x30BA0BD0330F649,0x1872AB96EC82BBD,0x1AA6487DA030593,0x2001F0F7883C17A,0x30D991E0E0A},{0x231831A51413E63,0x1AC30B60B6AD074,0x9F0B77EB563ED3,0x28B8D00299A1D56,0x29D6CDB8F2688A3,0x16BB37486AA0DF7,0x3C242B353269F8C,0xFD8F79CAAE}},
+    {{0x1F68F15FAC38939,0x6CF7568BE00430,0x34F7AC290A35F14,0x34B723CEC9CE215,0x7D7EC3DE1E95FE,0x156B189514495EB,0x2BA566FC33E664E,0x34E5A34D20C},{0x1980291BC026448,0x3F2C8494936929,0x3BBCA7DF4827A36,0xCFF30E57217298,0x370CF566EC8E9F7,0x245A0D7BA6F5197,0x1211E66D111372F,0x3019B3E4136},{0x212801BFD89B469,0x10D6EB5FC634653,0x34CDCADA7AAC4E7,0x18B8E13A9A1C472,0x355DE4F3408EE7F,0x25529A35E17198D,0x2DBD8FAC55795BE,0x2A95A90F9A8}},
+    {{0x2755C465815AE38,0x2B70FA158476D5,0x7633999B188DD5,0x2BFF7DD42704B64,0x1E725BCFDE238B6,0x25D1435C174E5FD,0x325B65F60B944C,0x2219FF0C9EB},{0x32EDC4413763EFF,0x2224B02CCD07ED8,0x18B34B83AB3A7F2,0x1DE6A841B4570BC,0x2FD720BBC61BB22,0x15958DFDCA973EB,0x2772F57DB6EF43E,0x33ADF19ED63},{0x740687D3E26027,0x2B244D19E8C139C,0x2602F47A1862A68,0x1279DAC1999CAEB,0x1C65BBB6CA42B5C,0x50CF462DED4566,0x2F335E3C42E7211,0x25084875DBD}},
+    {{0x42009A6264AD0C,0x44EFCAE164EFBD,0x1C1D111905D4E8B,0xB3F8FA503BDEF7,0x3CCA012275624E6,0x2ADB2D9649075B4,0xB1CC7BCC70EDB7,0x3FE7EBEEDD4},{0x2F65DF297FEA84B,0x45F212A242C380,0x11A92A859301E82,0x13AFBA32CBED203,0x437010B8C59C60,0x3FFD1EFCFD3A00F,0x1A13D64514247B3,0x3131772E7C3},{0x36A3C138C0C9169,0x23876B68BCC90DD,0xB8B76AC7C3982C,0x28A741F8AD364A3,0x2E297F90A176E9E,0x1D17D7FC74813DC,0x8549A8051850E1,0x2FC0359A170}},
+    {{0x14720885DD6CB97,0x2EAD448F01C7EB,0x34FB4F7E556CF85,0x20F3BC54EFED94D,0x3DD163EA7382055,0x5EC06CA621FBFC,0x3D3426D9206DB46,0x7D9340322},{0x2E02DC4D10337EC,0x273F6419FABB2F9,0x24BBC04E7E669F0,0x2FF7BE5C08237C,0x15F1E7B904B01B4,0x24EC35CBA3D3592,0x3C225C87743C2B4,0x222FB69EAC},{0x270548492E04703,0x11575786FEFA644,0x3B1E3D6A57C1295,0x3456207C2D080B8,0x3313981B2488CA,0x3EA0C8CC30A1FED,0x9FADE05401066A,0xBFCB3AF98B}},
+    {{0x3AB4FBED345936F,0x1CBC3281D23DC69,0x3B8389D75B2CCBF,0xDDA5A09B64AC92,0x2894C923905748F,0x2DB9485770241F4,0x52D34DFDC8183D,0x18D4110C03A},{0x3DFB1D5A9B35FE5,0x3CB31A28C192326,0x259343DB6D63534,0x1913B506DB26C1C,0xA958C184CF9D9A,0x1FA4774BD030B5D,0x1BD2EA0812DB34D,0x8C9A9F90D2},{0x34346A5FC343C84,0x2A74DBAF9520946,0x259320E7CFEEF13,0x23C7121D78B9987,0x3FE7AFDDA0CBAAA,0x2C35A26056EDB87,0x39C08A7B06FB17E,0x1212E5B1170}},
+    {{0x1E99F3A602FA85C,0xAC211FF76795CF,0x3C33BECCB3A026B,0x199815B5938FB26,0x3F8D962EBEA5A63,0x331286CF4689A8E,0x2F5A5C1AC1A32BF,0x284070411E7},{0x3634A6FE3C2333B,0x285968363778345,0x22DC90A02ACB67,0xF677ADFED0BCD8,0x339E8FE578195E5,0x68CF62BE3D8AE6,0x5DC809DBF11261,0x3D66DDD7FBA},{0x1BDA79A2DE0179C,0x499ABAA9C0879A,0x551C0DC0E82F96,0x25DB6B454F8C1A0,0xBD1220FA1FCB28,0x3DC6DDEC0B6CF02,0x373E6FE5751CBDA,0x35DE52AD33F}},
+    {{0x74E4197EDE546,0x302A09DFD1C40AF,0x2A9FCB51008BE20,0x533EDA5F49B2CA,0x7EFDAC37E064C3,0x30D7580AF71716A,0xE8BE5E99DA36FF,0x2A688D16347},{0x11FE98193767553,0x9BCDC9EC9B8B05,0x3467CA87111ECC1,0x2CE4D85C353FEE4,0x8FB97EABF302A2,0x1A4C42AEB34465F,0xD15DF51FE7DAFA,0x1FB9146D06A},{0xF6D8EC4245DE25,0x299769094D06454,0x2B8EAC7E6C753AC,0x1B72D45E8DDF7C2,0xE85ABF888F26C2,0x19B0C19CF294C1D,0x12C1E6533779CDE,0x36E5E93F34F}},
+    {{0x1158CE6D9F73AEA,0x20DA9DD2453FD1D,0x90D4E424DC0B01,0x18B0B11120E51BC,0x3097A7DE3FFACDA,0x369D268679AD219,0x2E8765094D8DB61,0x27B7F663D7},{0xE460FCFB37226D,0x8EE740E5A6FD1C,0x313D4D511247CA2,0x24F1C9235B1E0B2,0x27591189A000AD2,0x336C491250BA2AF,0xADF9F88D12BF52,0xDA118FAEEF},{0x3883EA7ECA1D5D8,0x68B149585A493E,0x1E1CA7EF2095B5F,0x262894AF8EFBBD4,0x3C3696114F7C4D9,0x16690DA0B789D61,0x2C7463372F3A4F8,0x185FB321323}},
+    {{0x2E566FF8A450E77,0x2C2D0019A84EAE,0xC483A510CD7DC9,0x1F2C68804D7EA73,0x1AEB0B631A80E6,0x11F1F0D387C0820,0x2F0F0257DC8F4E4,0x1EAF9F45D31},{0x2F115A3AB19A576,0x2E3C11D28193283,0x3999BB6B351F99,0x5E154952DDCFB7,0x2F249F6C2F427D7,0x13D67DA094CB833,0x10F71FE126C2EE3,0x7B0B2BA005},{0xA93B2F764BD0F8,0x37651B381197EE6,0x1CEF015F5B78519,0x2661A44FB45EF71,0x359D02E99257F5F,0x2BA7E162C5CC691,0x2D11815733E6E57,0x1FE1A76B5}},
+    {{0xA0B0A4D3B7C84E,0x33C4CB0DE33CAC0,0x1F192814BEAAA8E,0x2DF9E4A7E5ED2D7,0xDDF08A68E42D0A,0x582052BEC5ED83,0x321778C348C7D9C,0x3E2A5221136},{0xCDEFD88EAA2578,0xBDC5FD5AF43898,0x187754E131694D0,0x4849530506076F,0x3BF0DACDD26E5F3,0xBAAE2AF7EF3BE1,0x3424B985972E74E,0x5C5D88400A},{0xC3D1DD668DE328,0x5A3FEE7CE09C60,0x20B5A7F9E06F2EE,0x1BC463D23B57FE3,0xA79FE4FE0887A5,0x26146EE6A9FBA1C,0x2CB388C8A85C061,0x2F02BFBE80D}},
+    {{0x182AB83570A54AD,0x2D7077BA38EFB1D,0x20F583FF454B556,0x39E4880667D1879,0x1ADDF61CA887FC4,0x1859907F481DDB,0x3E8700C6EDD8EDD,0x2BE6C50957D},{0x273F15E49BBE3EC,0x1B74EDE23E2F07E,0xBB24CC071B8FF8,0x369B09834906F96,0x185EC1C4E36B10A,0x84BDAD0825FF6E,0x38D10D0AC85D47C,0x259C64701F5},{0x17CC174FD818A25,0x103C579752B9D29,0x23384D3FAC76DD2,0x11AD900C6F5B98D,0x128ADD6039CC806,0x3AE3B3A259B0241,0x226D54BC6180B,0x18CC848E4E6}},
+    {{0x37D5FD5407988A4,0x389EBBA55B30118,0x33ECF37AD6B1917,0xF4FA53524273CE,0x203E08BBF8A8B7B,0x132BAAA6149E054,0x66DBFFE22350A,0xAA8DFF6D72},{0x3498836D9503149,0xD71FF7242D07EF,0x15C8098213BEAD5,0x36B4819A621580,0x35B2EA77C2033B1,0x660BDA6583E4A1,0x10619EF50C347BE,0x1B317953AFC},{0x297FCC73CCA06A8,0x2196CB4C032E49E,0x29E32FCBF85B3F6,0x2133A3B3D14FC6A,0x3B390FD5FFEBF04,0x2A6271683B645AB,0x1D497436CC69302,0x8F11A85E68}},
+    {{0x20849D8F5D7CE29,0x20D2C41C5C5DB50,0x15188AD431ADE0,0x1A87765692A7AC5,0x3BC4FBB98ADE44D,0x1D48B77C1B2D5B3,0x3485F6134DB77A5,0x2855CEBA7EB},{0x367D1C11D83CCF6,0x3CEB7F48B7F7E5B,0xC46AA5615A282D,0x34EE707CB618C36,0x12684763B3505BF,0x3960B6651C40DB,0x314CB68CC6B74ED,0x1BC4F25F927},{0x194EAF4AB4A1BA2,0x7305E0904D3973,0x2ABB7FBCD6D2C6D,0x2B3DE96129081A3,0x149FDA3C8004ED9,0x71CC0B263D4CE0,0x1962F4C3DC8754,0x31BCFE10ED0}},
+    {{0x29A3B8C51AAEFB3,0x1645CB16FD0DC21,0x33A6B7AB79FEC56,0x1C00FABCBAEDA43,0x1967665C8A141E7,0x215F982839495F1,0x39DA72C8FFF2BBE,0x1C41B3C0810},{0x2A08F4BBCDDF01F,0x3A374BCA78BAA26,0xCDFED00F655218,0xDFBE63E0EED7D9,0xDBB8D2C7A7679F,0x2063A25949150DA,0x3245C7DB5C293F9,0x384EDA21797},{0x34B12E453E9DF8C,0x3E98D4690BF596B,0x172942D547F58E3,0x38FF2BFFA9102FA,0x3AFBC22DA98ECAB,0x1B544ABE475B172,0x2A773051E5CC0E6,0x3A284C515FA}},
+    {{0x1194D260C90CA66,0x332346DB56C29D8,0x31796F7C6FD7A8A,0x13C7E31E9749BA6,0x6D61A4C9476D7C,0x14D557BCA0F099A,0x2B314C0ABDC2543,0xF3E357475A},{0xB54716C8BF658E,0x48E625519DC229,0x360773655B7707C,0x31BF6EF4586850,0x2ECA0CA60116909,0x13416CC94FC0AAF,0x16539EAA20111DA,0x1A5EAA8EE90},{0x393C77B6EF46260,0xFDA0B815B114D9,0x325E6EB389E6F6E,0x10247E0788E2612,0x77F2477439E26,0x3E50CB18A83330C,0xC99B3DB363E70A,0x1C2D0369A99}},
+    {{0x2C2F96763E62E2A,0x998605BACB6A89,0x353515FD2DD5F51,0x16370DB89D5ADB9,0x2440BDDE4674CC6,0x282440A4218039D,0x169FDF00451694,0x1152F2DB3AB},{0x3F4C92AB6481EB6,0x362DDEBE825D439,0x2EE6F42316362D6,0x26035177BBD4E8E,0x4ADAC7AACD7DCF,0xC818A32DFC497B,0x235B41E8A20AEC0,0x1D0631FBA8B},{0x238767C6D78F9FA,0x308308FE80AAC24,0x208684AB683B9EF,0x2138605D12120FB,0x53E4D04EA4B7A,0x3DF1A748B6067F4,0x17B67B379F12758,0x1CDFCFEF14C}},
+    {{0x2E44C65B219379E,0x2C844E06EED81FB,0x28D4C7428B7BC6D,0xC6E98A80EDDA8B,0x10E1729C98BB0B,0x1EA8F2BAD431AEF,0xDCF6C66727B018,0x2FE74BC3EE4},{0x1EC693501184DC6,0x1F5634A8C9A63AD,0x17B366D8DA316B0,0x1FF878E6EC94700,0x6CBE44BA9ADB15,0xF86EAA6A6A2A2C,0x1C6D0F46356E47,0x3496A3D875A},{0x36E0E14A38665F4,0x2EAB0DD4771381A,0x2C064EFB0294528,0xDB40B527F9F971,0x837B8042E293B1,0x1441EDFEDAA5C31,0x1EF9A3A81055940,0x275FCE3E6DA}},
+    {{0xEE8ADAEC33B4E2,0x18C0199458F3AD1,0x28F1476FB880B08,0x2541C0CCA255A73,0x1582CABF9A238B5,0x5121405EF09B20,0x296F420B5B568D5,0x2A7D7C7BE71},{0x11409C3AC8FEC5A,0x1950545BCA3A55E,0x1606573F70E1F44,0x360F8F1C188C46E,0x11C0033F1A3C2FF,0x3E623A023F3299C,0x25B3716752D07AE,0x1794FA6A494},{0x181A4C5BCD8D30A,0xE9AD77570C9E59,0x28BAD5326236826,0x119FAB3564D1187,0x70A476053ACED5,0x277FBD75AB7FC72,0xC8FF214D099DF9,0x21B9E926BC3}},
+    {{0x34B22C3B562A5ED,0x21C4485BD71F341,0x2F51F72C49BA064,0x2EB043424C37A79,0x2B0ACA479BFDA63,0x3CE51C8A956BD4C,0x1C348D59EB77236,0x172B61D1119},{0xA2119E5722B0C1,0x1ED9C0993CD0FA9,0x3A6910F02C19F38,0x773FB16F00E07E,0xB65F5DE0D52C0A,0x2E8D391D3558DE3,0x35412FC802727E2,0x2885768C566},{0x3E42721C71385DF,0x12DA092FE70943D,0x2123262DEB5FB60,0x2FA114C1DCDC41E,0x29ADED61A94ECB3,0x120C37C096A250F,0x19FEB8A960EA9B,0x3573361E4A7}},
+    {{0x3867F2962A75C18,0x36ED2DA2CD6AA8F,0xB9BAB5B0BD1CF,0x35B517BAADF7246,0xE1E840944EF0F6,0x33CEE9819AEA02B,0x1A51D9F10EEEF6F,0x12D4F28184D},{0x2F5CA66C2DA91D6,0x3FD75C13EE8D09,0xE2378422E3DBA8,0x2B203F37DEF332,0x3A85EA0DB52C009,0x1A78C7E51CBB010,0xD51CA6800ACF74,0x1D70270AE2A},{0x823C072CA7090D,0x305157F4D9E8A71,0x2E7B3F7ECD23036,0x1C21C26A0A27AEA,0x150C661CCF4305D,0x34832127617FB46,0x3E50252CDE75CB1,0x31F6AD6EB}},
+    {{0x294A29849F370E4,0xCFD187E1B59EF4,0xF20A8956843E37,0x319E9AB8BAD184C,0x2DBC53ABAC87DD3,0x199025343AA1A11,0x274EE3ABFF3F960,0xB81A3D36DC},{0x930C13742AAA7C,0x36922B6EA2618B7,0x97A68419AAE946,0x89985163B200CC,0xB7E3ADCC04F3B,0x3ECA54705D7AB69,0x7C03FB95127A73,0x23188AA9F2F},{0x5853A2FB655B50,0x3489A4FC522F1AE,0x2D20D33C0E8AB07,0xEB84F3E4DE09C8,0x3B118D7C9844718,0x24F774AB2C5FE4,0x332FC3916284A0,0x3F687D1B3C8}},
+    {{0x4698232CB3C340,0x2D8DABC410E4E0A,0x1EA7711AC757D77,0x28C558D8BEFDD74,0x36A47EE88D72972,0x2A116E104BCDC97,0xA7E1E53CCDBBC,0x1A19B29A3E3},{0x2D85C16F67E332C,0x273323F09956A4F,0x1DB9D46D9827875,0x1DD24ECA7F9E559,0x200DB7FB724A6FF,0xD560C410CD079B,0x3F1CBFD06D858B9,0x36DC72F4E4B},{0x2B8796954957BC3,0x25CF8534A9D4E57,0x3048BCA6B8B3329,0x3818666FC0E817A,0x19443EC32186D46,0x3A5CDBE828F5A78,0x126398DDCBEC5A6,0x302149DA66E}},
+    {{0x182B07D3D0F2F50,0x11E3A02A614C256,0x1BCA907D4098975,0x21F0B1B0E2EF063,0x204FB3B66EB340,0x2C21B85A7601861,0x1AC0F5FA7BFC08,0x20192F9B48E},{0xA374D9468B6318,0x99E025AC20E865,0xBC2A28540A3CDE,0x1E30B28C09870D2,0x3B97124EC4C24F7,0xE6033578599468,0x2C0C357BFD75B87,0x1AEF7F3FAC6},{0x20FD434F2B3AD0A,0x2CA5D3EB110E271,0xBD999A9C9B1AD0,0x3C5CF335F79C4DE,0x1E746B2FFA883F3,0x31D3672B7CF48E,0xBFB34A54BDCF47,0x2A5A69BEEAB}},
+    {{0x1DA115DDF171AB7,0x10B785EC5007E4F,0x395019CA40964B,0x205A747D196E8F,0x10534A0070090D,0x3642017178A0AFD,0x245615DFE1165F8,0x209E905B29C},{0x5AF888433A36C4,0x3E2FE953363B981,0x2608FD1419CE290,0x348B6D7A30A1ECE,0xB9E5BE98103CDA,0x11CC556E1D2FE04,0x6572AE42DE670F,0x8861611FDD},{0x4A6D6EB77034FC,0x33FD3F634CC9C33,0x23807BD6267148B,0x2E1C565A714FE4E,0x20647AB82223D7C,0x13ED6A5C249C00B,0x109F1F266325C2F,0xFA8A235958}},
+    {{0x3230BAA1788FDAB,0x2BCC21829F41165,0x1EA2C7ECE99F4CA,0x2F6F4E7C41AB419,0x203FD92F5D3BEF7,0x383581A7EB65B48,0x2313BFF38CAC4D9,0x1066805C7F6},{0x5D77FD8572F035,0x3D6BE67CACA0AD0,0x2F7257D3B23FACF,0xABCBB888D63242,0x30ECC2687D9B6A5,0x3CE050224B0C090,0x18BEA934D5E3EC4,0x3021F5F0EF4},{0x255621B83A0FE59,0x34A9AA130EF10CE,0x2E04B98B6C438DB,0xF256408F61C77D,0x9BFF630FC0928B,0x20D7783500F2596,0x3F2793C73CE6FD9,0x3F55DCF1640}},
+    {{0x28C502559A6F90C,0x95B9EAF83A8DD2,0x3F675C72256413B,0x1F34FF05FA519D4,0x2B028C4E1FE235F,0x3A238826F36C0A3,0x306A7D0F93A489F,0x2E59A8B818D},{0xB6C228C4A30319,0x29A1A3BFB29B59D,0x90610A70057311,0x204202044AEB5FE,0x8A2A2462C1DD61,0x6894BB67FAD63A,0x82ABBFF16F3382,0x3694FA585FE},{0x2871B64CC62B2AC,0x3A3FFBBC4A9329A,0x38F39D4DD36CF4B,0x1248D6048A449FA,0x5C08206AB5DE60,0x27AEFC839E74F95,0x2B0726DC7C00836,0x374FAD875E4}},
+    {{0x2E116A96569F191,0x2ECFC2F3935B8A6,0x3630B9E1AF51DBA,0x9C774DBCCD1B49,0x37083151030749A,0x1A0490BC522AD1F,0x39BAE8A5BCF5585,0x22E006117B5},{0x2A4042FD3894AD1,0x1E0BDE074AE22F1,0x1F2D34CACBE4C39,0x20A1CC6BAB76672,0x3C90F95498EF1D3,0x13A32AE8B87742E,0xAB978889E95406,0x2336725D86A},{0x1475876800E65D8,0x339FFD492FFD997,0x14A2DD6A926A547,0x12498D80B4AF099,0x12BB98D055D7D93,0x93155E44DFD279,0x1CD284E9A657C54,0x9E4DA8B13D}},
+    {{0x1F3AA3E3B4A4B7E,0x2586674E56F7206,0x22BEB83C023E537,0x383CA3FFBA21FF6,0x2969D2AA8DACE6E,0x1C273F98FBE5396,0x3D55C19031E6849,0x28B5AC9949F},{0x24ED4DC321928C6,0x272C27011838CAB,0x3047B422326C93A,0x1A2A23D82493132,0x2D44E68736438E6,0x1A5C9BDD7BCD8CA,0x267428EAB944621,0x2713CDCEAAE},{0x118C4E93819D52F,0x18DEA291D72C41D,0x2435201EBE5A2A8,0x8AD5B1CAE67E16,0xDD8CC7DDAFDE9D,0x22B321434B2B61B,0x757CE0F6F1B44,0xA37A1C4DC7}},
+    {{0x31600155A02885E,0x19F952857F66C13,0x1B5CF4EDDC9625D,0x18A048831A25A11,0x4783C6478761FF,0x1DA1E616086092D,0x1C7A5F4F64145B2,0x2FCD3A533F},{0x2955F9FE2E558AC,0x1CB2FFC2949ADEE,0x3DD4FDCB66D1675,0x178C9BF2087F04B,0x29CF96DBE187BDD,0x39FCDA01B4913BF,0x2C97DEB69B324B9,0xF45D3AD67D},{0x92512739826BC5,0x1A3941E2E24D10C,0x28E4D490059263,0x1A24149E62610A4,0x355C9776852FBCA,0x1E3B5194E58E5F7,0x467134EAB1E008,0x2E21A6FE725}},
+    {{0x1E01C4BF56C1BB6,0x2D109D1A9B12883,0x36C06ABC64BE936,0x24E2ECB0C32348D,0x215D1B71A25C0EA,0x14DC04E80B91C70,0x1BEA75D7199041B,0x2E34FAFD2E8},{0x18D2E45BAD006C2,0x1ED29394306DB8C,0x3877AB28C55E5BD,0x215E61E2F520260,0x2E9C89066BF2560,0x15FDF02B22482DA,0x2A003A769E76908,0x3F34AD55A3C},{0x2F7ED8786A24AD3,0x3B379F0A50B7F5F,0x374DB4F7CC3DE18,0x21C42F7B625560F,0x1AB43B9179D972C,0x124E9E77BE7F441,0x368C6A6DF97CF59,0x3B056657C2B}},
+    {{0x29F6781BF0DE5BD,0x22DCA8E1117A248,0xBCB0DDD2F0E999,0x20A1FFAEE0CA8D3,0x2DAE48E1709AB6A,0x3515EFE27A26E5E,0x39833AB22EB12C0,0x151F99824E9},{0x3AAF7A9B5800209,0x173FF67EF6D0029,0x137F6DCA239ECBE,0x1699E79CE454861,0x1BD96F555B3A592,0x3AE4B9CCA90AFC2,0x28623E3C0424E2C,0x72A64DC857},{0x8D179251F52B53,0x115A7EA34E2E006,0x3D57423F53E6121,0x103FA81B067C850,0x199EAFE7F6A7D0B,0x2C54F4635195635,0x1BBB7F1A2CB1A14,0x35CC0FECC60}},
+    {{0x21F54789C16DF92,0x61D3190B8FB450,0x16699F60FA2A9F,0x14EF46E34CFFB3F,0x38159682D58A3D9,0x199BC5F008528DA,0x1AD8EB9621D181A,0x1F0B0EACF3C},{0x1E6888C3E529F7C,0x3065ED9AACD54C5,0xE63B558A83E31A,0x1812A9EF162471A,0x266C17D989592E3,0x2B031D428A44D8D,0xA100D534704909,0x35B409C9165},{0x2D1730BA3807C80,0x4C323D6A4E2D4,0x1465877FD3C8A27,0x37DDE4BEEA3F6A5,0xA36E56AF8B058B,0x3F8BA46E5CFBDB5,0xB32B76BBBCDCCC,0x149DBCFB479}},
+    {{0x1098163CB7D458,0x304AD917FD6EA0D,0x1D70A318128AF72,0x2D17D1C9FBCCB97,0x3897CBAE1510A21,0xEDEA02FE019E14,0x9DA9827402B8F9,0x38E17E0820D},{0x12D054619589F6E,0x35AA96C9B9F0064,0x21E79AE12BD5574,0x3FD744FE4505239,0x1F7B2BE0F13716,0x1A720AC3F9A02EE,0x38B3697633C3E25,0x1B07C20E1CF},{0x243B5A888291E40,0x1D00D5258DD539,0x35EA4BDDE60DCF1,0x70C889493AAFC9,0x38746C8AABDD768,0x9F5C257C125980,0x2E6545A6DFC300D,0x336A54D6DCE}},
+    {{0x24159CFC7B6F5DC,0xC1694ACD24DA52,0xEEB511C83B888,0x1F8675E790AC190,0x2D98E503A2738F3,0x6368C395E56A52,0x3A193981C752626,0x1ADB1A4B72},{0xD7242EE4D1B051,0x2589D332CECD431,0x1566DF0BBF54001,0x2E9359AF996B84B,0xB3CEA29601049C,0x721011CCE637E1,0x174C7D6C96B75A3,0x2EE005661D0},{0x2AB49664D56C96F,0xCC7811EDD0AF7E,0xAF168BA435CB28,0x22693A4AB79AC0E,0x36AC3B763DF90B0,0x2F99AA2FFF47A69,0x2D30694B14FF375,0x2613C286A5E}},
+    {{0x22C9637E48BF5A4,0xE7F7B06732BC44,0xCE5CDE9D5C4202,0x2EA61A58821E3C3,0x38BCF970A21FE6E,0x37477D7B215399,0x3FA84667F0128D0,0x3E9C9836C2C},{0x16BD2895B34239B,0x81322F14B4A943,0x1514E55EF6CB23E,0x119910309CE89E3,0x8F4B12E321930,0x3A311AB7D917753,0xD4470E29984656,0x39ECDBAB92B},{0x1E361784186D502,0x22067017EDE1C4A,0x867903E9656714,0x2D7550A30751EA8,0xEC7843FA6E6CB0,0x271C549338DA880,0x32D79C18D3E3E86,0x18B44C4D4C9}},
+    {{0xBB89BE74F40CE5,0xA5A91EF144BAD6,0x10B9DB8AF26BF2B,0x171DAF5233CF45F,0x36BB55D9C104C43,0x221EDC33C56517D,0x1C2FA6EF455B607,0x3E5008D0361},{0x22AC3EA9D39F16,0x1D2C777C4B812F5,0x1D08B5837613A60,0x269CD428CB5BA6A,0x22C7CC4D087DE3A,0x3203B9591C0725E,0x3907DF7586E0B65,0x382B96CD817},{0x37BADDAFFB1A94B,0x326318B195AC376,0xEAEC7E71427A46,0x3AAA0A7CEC171B0,0x114337D466FE7D7,0x2C4910C9065931,0x20CCB6B1CDAEFF5,0xBBB01B5C42}},
+    {{0x3D8B78D57CDDCA7,0x1107A9B54B6FB56,0x3A1631C9629A81E,0x32494300D7195AA,0x1507176F462C8BC,0x30204C31BC17553,0x39A28D1BB2475ED,0x3AF23CD51BA},{0x3930331E8CEDCAD,0x1585CB4FD12FF85,0xD2044A8B607D5C,0xE57FF3F78E172D,0x1855968136C9877,0x237D645566E0094,0x138BDE103D61E68,0x3C186006604},{0x3DD42642ADFC46B,0x6554444E710FAB,0x251E75546EABF7D,0x7F22EF949D6CDC,0x1CF51D1A1C5712A,0x2DD1AE45A14B5B4,0x372FAA21775470,0x3BF017F6A36}},
+    {{0x1FABB2035E72E82,0x1515EE4B049D81F,0x39B765F71E854E9,0x1D55503AF541D2F,0x732B4E9A4D5C03,0x3C9C3E064CEF48F,0x22DB2A202DDBBDF,0x2758219DA09},{0x21DB68BEA0C6F5B,0xE23048AFA988B6,0x2ECFEE49AAEED59,0x3156CD7A633CDC5,0x3E58EA248733CFA,0xC0E0B79054C948,0x31691FA6A00713D,0x442D9B23F9},{0x2D2825D7E9ACD94,0x4C6123A28EC820,0x3BF73111381A78A,0xC1764455571C91,0x102ABD8C67F947A,0xF67CE7195C9968,0x82E9C8E8C6D629,0xEB8A9E990F}},
+    {{0x3741C75BCEC9C04,0x21FC63A3A8E663E,0x112F0F892574A4A,0x9D09A240010B2B,0x37612C87E22132C,0x3A11CD19DA6BEC0,0x152A0A16E7547A0,0x2A923E6570D},{0x330E29CD52121AA,0x800D8A6274C94E,0x2FC6D85441BE148,0x28F1349F8CE41F7,0x9E68EBDDEA71C5,0x1662F628DA96110,0x4FC609F27BEE5C,0xD07D49294E},{0xBC0740A0F033CB,0x1EAB858CBEFA176,0x1136A7D8EE103BF,0x1BE71846D6B1349,0x3305CC00A6D99EB,0x4F106F44CC24DF,0x1345779C5A4E197,0x1696B27D505}},
+    {{0x21D7605C6909EE2,0x7F1365C2657B22,0x152D82E9DCF2B36,0x1541FC3BD84897D,0x354A240C13AEE9C,0x15D75127479589E,0x3D7107164A73A44,0x186857F6F52},{0x230696B9D3A9FE4,0x21A0C231DF9F8C9,0xE3AC222BCE0B8C,0x2E0FB8C64C136E,0x139ECA503B5E5DB,0x1AF1E2A373AC719,0x3D574A8B05E2D25,0x2870F2E2F67},{0x71AF8A43C1FB0E,0x1FC1D642C3ED9BC,0x198D93819BACB1F,0x265B55FE332E784,0x2D0F8AF1CDC2AAA,0x4B0A2C007C0E2D,0x598994765EBD0A,0x2F7EAF422CD}},
+    {{0x7B8820F4BDE3EE,0x2FA9C4BBC93545C,0x1A517F88CDF6EC7,0x24AC573B3E60FAA,0x13E9EEEE4431A45,0x575E1B1E13AEC0,0x3DA12F06CB31F4E,0x1580FF613D3},{0x1F6790E99E1321F,0x389D319A9D29302,0x17A4B70B49A41A4,0x371DC02F76B6945,0x3E0E54A60D51BE8,0x3AB3EBE49D8691D,0x39176661C72B027,0x14388D00A02},{0x9EE6365655E478,0x282A5C1222FB282,0x8339688374D767,0x3B6DCF72311D229,0xA5E7D3D1336801,0xC2496C7CF8D1A3,0x1004CEC45A6564A,0xA3E8009C4D}},
+    {{0x3A1EA3259C46FD8,0x37B2848BA7EE5BB,0x2F9074A26767AC,0x23A6C012889E1C2,0x2BE389F8077F3BA,0x1615918F7A4356A,0xAB8F30CEAAB090,0x1C6CC7A158D},{0x20DEE65CAF02AED,0x2541A21B882B094,0x280665F7886B8A5,0x226E6DE137CAECC,0x3FD46E443ADC6B0,0x39C0F5778659B09,0x340419265F0FD,0x3B651848AD7},{0x1AB8A24385C7041,0x1D49B7F6883A469,0x1C9705A4276D754,0x167792DF2B93A59,0x188EDF523031100,0x1B7AB42FC081F55,0x1E90CB72411CDAC,0x16E926C97BB}},
+    {{0x1CA884CFBF5844B,0x26774171214933E,0x26DBFFA1936BA88,0x23FBE53F74A79D9,0x156358F81B3EAF4,0x279659CD35454C3,0x1F61378B2D14ADF,0xBE141191CC},{0x1D6AE90599DCB83,0x2293E278186648E,0x764052498F0F95,0x3CA19B667309DC,0x8064681A2F551C,0xC04B1EC34130DC,0x3895218925B00AC,0x2355FECD537},{0x2B0E1C1040163B0,0x2059BDBD48221A6,0x380873F4227A99F,0xFAE90C7DE2FF6C,0x1099E55829059D9,0x25BC30528AF6D47,0x1432921F9D05A16,0x39DF2195520}},
+    {{0x268BAF10F0CBD72,0x29C6FD3D786680C,0x33FC19B95B24CB,0x2ECBE4A55789A6B,0x191F2DF60A6DD1A,0x3903A148DCCCA0D,0xB215ED275AFB93,0x2C65744F5A8},{0x26A5819F37F3E5A,0x231A022BB276EB8,0x138687EC7736FB4,0x14D87B40733AF94,0x32C9EFD604CB4BE,0x15D1B1C81EA1836,0x3D8EB6E4491F3BC,0xAFA4AF3271},{0x2EF081BB9C566B2,0x37BC00FF1FA0D3F,0x10C96510D15BE12,0x25F2D20A8B6142D,0x28924FB48DE6B9C,0x396578226226E3C,0x1DF13BBC1B95CC5,0x5B9F6DEFA4}},
+    {{0x1230C788522EC8F,0x230C9FBE7B6DD17,0x18457354F4A8664,0xA7BAEA9B22455D,0x329CBAF3D407B62,0x1D62DDE461F3EC0,0xEBB11FD61B9EB6,0x316FFAEAF8D},{0x3B4E2BB542D239C,0x4C5878FD87F6A8,0x1DB43FD0F3FD85E,0xB780B3C80FDE1B,0x253C589C4A82783,0x191B6DB68ADE468,0x1BB37542B99EC06,0xC735B28796},{0xCF630B8E2E703,0x3BE215238B27E2D,0x24F08C90299F0AB,0x26AE961681549B8,0x174607C43EC33A,0x3852459A189D67E,0x3B26D7EC9D28149,0x1F1980B828B}},
+    {{0x62E130F8614743,0x1460F3D4FA5CFDE,0xA610E3F8FBB985,0x26563D7238607FF,0x1EA7BD2B5F566CA,0x135461AE7965CA7,0x1933C9AAFBC8618,0x15C579CC28},{0x2F4B632DC4F342E,0x4C73C4B8593AEC,0x956CAD904D97B6,0x3C0E961185B327B,0x1CC7327FD2963B7,0xC7AF88B4A0EDC7,0xB88D0DC7E0EA16,0x2E527309D31},{0x3E1CD0EF902E1D3,0x33C593AF2144D32,0x3336862F1FF2FF2,0x1F88DE24D4ACC64,0x10C667330F43F7A,0x3C051D007570D7B,0x14D7328A408B118,0x25ACFD705D}},
+    {{0x3F76968758EB660,0x2DDF6BE8ACD7A92,0x5654D840EA2101,0x30287DC40C64D0C,0x3DFF8DC68CD0639,0x20180A142ED57FF,0x16A06604B0305B,0x10E59E4DDA},{0x3E37B7913627295,0x17E9C1CDE176A7,0x153B571E5EE0702,0x3BFF39F91FE88A4,0x1C57D02A7E946C6,0x30422AECD5D8113,0x1A2E7D20307CEC6,0x3A0251A597C},{0x32BF3A8E86E8B42,0x61A7CAD849F145,0x261034A21B4F05C,0x1394DB405A20011,0xA25B4D64A5CD61,0x306274B5CDE3945,0x3A9D130AF8F5BF7,0x1F507E94518}},
+    {{0x244390BD70AAB15,0x250444AF22270FC,0x3E6B02894D68534,0x21DC40C00556137,0x3C7373CB1B1BA78,0x3F714F4A1B0A805,0x6FC2ED03883C81,0xEFF178FEF3},{0x2D38AC6FFD6418D,0x1B199FA5AFEB627,0x1346F4F77EAB4D6,0x354653013C2444A,0x3F40FD09CF68C48,0x18BDBD6C1558F3D,0x165D0C0A8C4ACD5,0x2530760CDB6},{0x2F58C883E548335,0x3F97513A16539A,0x218B9A1736415CA,0x29811B681E4047B,0x1D75C0BCB337881,0x8167CCA0301FD2,0x2440153DDA52467,0x1E0A391EAC6}},
+    {{0x28D351183D66E88,0x3FEE18686A4740A,0x368C27C2A7850E5,0x1267F58E669525B,0x2DC52152AE80800,0x2CB98038BFFF470,0x3175C75902AFFE8,0x17134B3380E},{0x38AD7C424F57E78,0x29DF3D8185CDBE1,0x152876012F85038,0x323FCCA1146E5EE,0x753CC6DD5392DF,0x2251CBC4D8E9BD4,0x1A86028EC4471DE,0x1C0C3CBDBD1},{0x13BDF150D98FBE4,0x6194D7BC5857CE,0x30640590F0E3D3,0x380A362F32F5135,0x11D5125AAFEA3F4,0x2AC123DBF89D0D1,0x27BF46FBA5A154B,0x9521D740C2}},
+    {{0x14F75DFC237639D,0x1F96B5AF076DC0A,0x9D43E06EB3D28F,0x1BA27CEED7911E6,0x38FC426A2C01A1A,0x1C14CFA9C70C561,0x28118A7784AB1B5,0x2967A1B9DF2},{0x2DDB133C36AE155,0x2527C75303546D0,0x1655080829D0551,0x3B08388EF94A460,0x9135047EC67181,0x168988DF711EAB4,0x1B4CA1D3CE1E2E2,0x778148834F},{0xF61420CBC65C47,0x19B1ADD0F652026,0x11C5ED2773036A5,0x190318C1BFF4DC3,0x3ECA01144F32DD8,0x2913DBCC8EA4DCF,0x376C29AE8213F69,0x22698569FF7}},
+    {{0x3CBDBDCD4608F72,0x6D0D488D684F1B,0x9A6497F64BB3C2,0x44EBC8E0C4B057,0x375FBBF4B36322D,0x385482971B1905,0x387118CD967E81E,0x2602CB18F78},{0x2FA9DB619AE44A2,0x1C0A077485DAF15,0x30FD037118A7F81,0x1B6712151504A6C,0x26BB43964803962,0x2630D54143B92B6,0xD5EC9C16D67F5D,0x3D4F330C631},{0x3BA50BA076AFE1C,0x2D8B88A412E1DB1,0xC5FCCB182068C9,0x1F14889C072C8E1,0x3C5178F545A6A0F,0x2B3111F2DE08F7B,0x2E4E1B64045DA15,0x2A65EC8F9E}},
+    {{0xC816D9C62B1743,0x107A22C1693D0F2,0x31E275B017CEA06,0xCD54B7B78DC29C,0x33A68D968875DC7,0xD2176DD92BD22A,0x2E6F8B025AC0810,0x50A816147},{0x10F79BB4B249CEC,0x173B94774F3CC03,0x269D9333A10AC68,0x28ACDE025B4FD60,0x1466F9679B221AC,0x3651B23CBFB6420,0x33164894B962DC9,0x133FBA065D8},{0x26E41758CBFD0F0,0x2EA29131FBB9B37,0x32B78D3ED8C0605,0x24A1E1F3C6CAB55,0x212169F5E20F686,0x30FFBE387159001,0x9EE26189667DCE,0x1CA8450E2D9}},
+    {{0x2E641C843C9D012,0x62E31C91732764,0x10D3684CFA975BF,0x78BEF8E6B0F57F,0x2BB10BB8FDFE6A9,0x27F0EFB13626F7E,0x35D0AC6ECEE963A,0x3E3E33B7480},{0x36D0D344FCBD449,0x16DE4A34DD12F61,0x3B7802490C472E8,0x7BFB275719026A,0xB5E5C7E59CBA0,0x8205B46EF0E32D,0x3EAFF6C6E644B80,0x8B1641FBDE},{0x526F7A206D61E4,0x32060F2791DB10D,0x15C03FC6D8A6F4F,0x942C8205C45A5D,0x10A0F050F16A780,0x39B84A2EB200D5A,0x222D04DE1283A0E,0x33656C6725B}},
+    {{0x240412448C48B4F,0x1E0DBAC4D6CD6D4,0x258D93500DB5E63,0x14FCC2EBC53D1A3,0x2474D66C844CEFC,0x13647CAB35DA0B1,0x123BAD0CBE20F8E,0x39954F3496B},{0x51BADA08408938,0x1340F90958EA67E,0x3A4A56444E34D07,0x3E71C92D406138B,0x214EEB8FD182536,0x241E7BED1EE7B8C,0x1AEFA73E9B905E7,0x3961A240773},{0x29CCBBB1888BD38,0x2E9115EFD1A663D,0x6FEA30DAA38605,0x2C40D6B0D74B3A,0x296B0760F7431CC,0x3138EA05C78C731,0xFC255EB5E019E6,0x15BA03ABB3E}},
+    {{0x1A822F9ADCED2AC,0x1B9AA46177FA7DA,0x349735647B54963,0x163786C992EE7BB,0x3D88B5F6FCBBC8D,0x13560C3FEF89849,0x2C879863071540C,0x1ADC6B233D6},{0x3B3E3F699FFEE87,0xCCAE1BA3D0F551,0x327E74DA054EB78,0x3E42AADAF87801D,0x211BF4A1DC7DDF5,0x38A0DE603BFCBD,0x618D63B84CF3BF,0x2C9A24EA5AD},{0x28C3E435B8B83D0,0x38982BD8C7F3023,0x1781317122DABA7,0x3464C8CD8553B32,0x30DBBCD02350E76,0x3386B15CCBC2F6B,0xBF7825608959F9,0x2BC9B90215E}},
+    {{0x2DF10C971F82C68,0x3DE5AE878ED65F9,0x81AC77ECE718CB,0x3BF205D6ED043AB,0x2050CDF9A1BC555,0x3609AE227C5D493,0x17D96BF1E61AE26,0x2CFDAB574BA},{0x294DCFF9F226487,0x358398D5AF80F77,0xCDA1F93B6A3DD7,0x397C6F9C85E72A4,0x33E05ED3131E6BC,0x153F3D42423522B,0x38D33B0E85C61E5,0x3F9F8D6E89D},{0x37707570BFF34C4,0x24E3D817FD863A0,0x3372D814E4143A4,0x27A2BA638542D6F,0x177918F02CEC6F2,0x2E8D463F7A3B013,0x1D506534C04624A,0x1EB78A09B97}},
+    {{0x2605418BD0518D1,0x24C8DFE027872F1,0xB37A7005286C01,0x303C7EC382C56BC,0x3A2FC3B97CAA853,0xBC47D22F439AFA,0x3F0C8E5D7C5E6A7,0x15D799B49BA},{0x1099477662EAE3D,0x394FC1D3E5B2719,0x116CFBFDBB81BAD,0x20A62D3BF8FFB5F,0x2C6DAA112338C33,0x293F7E22DCD1EE3,0x1C39B0FE4B9504,0xB9F7D33CC3},{0x298190387C2475D,0xD1FD8B02D1C450,0x16401AC81FA2433,0x31E8A77892836D8,0x26ABA88230B9369,0x842A808C152973,0x3959B4AB8A764C3,0x50A91EB70A}},
+    {{0x20B2D8BD964EF8C,0x396A66E16238AE9,0x259E927B204498C,0xDA7FC8315D5BAC,0x18397CC27B3F277,0x2A53CCB75B51CA5,0x6FBDC26580381,0x1C3FBC57BCB},{0x150A619149252CC,0x227AD28508DAD2E,0x239B1B2158E00F7,0x1E49EB74D9BAA70,0x256EF61763C3A8E,0x35D7B5150BF60B3,0x2D76A8737E70CAE,0x3B282B0B514},{0x2C4CA00DEA98C51,0x3B5A13363A9C670,0x203860380A3296E,0x26DD16C70A0742E,0x269BBA68627780,0x2E04B7B68B6B297,0x11FFEBA52AFB834,0x33D161F896E}},
+    {{0x1E023A6EDD31B2,0x23DDB45167FE19A,0x37970705617B45C,0x2B018481E07A238,0x2D985C51C8922FA,0x263937CE4B889D5,0x251C8907FD0A03C,0x189BD1A94BA},{0xF8F766A486C8A2,0x3A312668A23B463,0x3644D2DC63C4F0D,0x3F51F779A1BCA82,0x809A655F84A973,0x15D0F9C4939E1AB,0x1D0D699E61CE8A0,0x37C2EA68C73},{0x2EC331E23262B37,0x343B8F535675EF9,0x62EE2B3BABC665,0x2E2405039B83DBD,0x3F048F81AE7F49E,0x2903B1FB4723004,0x3C1DD428AB3C161,0x9806D098FF}},
+    {{0x2258B55DFDDE67E,0x258C50AB3A1C5E4,0x29D3921477D0887,0x22E9C2F81CB8242,0x34A06AB7DECDE7E,0x2A774E2F5AC8372,0x3E36F2BF4860D52,0x6EE003BEAF},{0x293F2CCE5A93DD0,0x2E2C5C79DC56411,0x2F572131A0E76D8,0x31B714C4F7BCFC,0x25734014FF2CB51,0x825D0B8A4895D7,0x22BE9D724FD1779,0x1B1674C1C7A},{0x21BE7613DB231D7,0x3D52466BFD1409A,0x329CBF620B737C3,0x292F87C581CB65C,0x7EBB67EB96CB55,0x274AD279A1E0BCB,0x1E61EFBD14EB3A5,0x33E83EDB07C}},
+    {{0x14042B4C0E65CAB,0x11BB9F87F6FA8AE,0x2EDF5EE01975F51,0x2066A93FF0F603D,0x383BA9ABF27CC2E,0x2511738107E6F2B,0x199B105CA39475F,0x33763D1E700},{0x284C75B6334BE7B,0x1135922955658EF,0xC294D43EE13E06,0xABEF68E835B0E7,0x2CC1D3E22D9FE0F,0x15186046EE0239C,0x148016A4D61737E,0x30BC34C4D8},{0x1DC541243CC8595,0x296BABEA8FFD860,0x24F9D309D01B677,0x6CB0C4504EC855,0x375F304E0174FCF,0x3745155273D1965,0x21A582FBECD10D8,0x1EAF58FDA98}},
+    {{0x1A1311C2893DD1,0x1BA00712552147B,0x345291FF8D00577,0xC835C7163A52E,0x2E309ACE00CA1B6,0xEADAD16A548B5,0x2C560DDBAAD184,0x311B2FA57E7},{0xE4DB562E72148C,0x25BB233DDDBB0A6,0x2DD4337775D1727,0x3F10C631BBC169E,0x3D168FE8D7AA009,0x19F83588FE308AC,0xD162C04D03BDE3,0x2D3EF6CD336},{0x1B0F493EFBF6CCB,0x630E2B74818653,0x10B4EEC1886E73E,0x329527DAD94FF8A,0x283B56896679365,0x1D00777AC26537C,0x3B6DE7602FFD561,0x32BB2CC51F0}},
+    {{0xCA538E400F09B6,0x59F7E76B6544A8,0x5B5A0B7DA384AA,0xFF5AD20627BED3,0x1BB8765998C220D,0x26AE93085EC1991,0x13D0014FD2AEFBC,0x3E284565617},{0x1670DFA0AA6F2FA,0x1C770228DD39DF0,0x48CCA7CD0280F,0xA8F67B10340D79,0x6C8F8944C1B252,0x1E4F7284218822C,0x316A0753372E5D1,0x59DC8E208C},{0x3526BE90A2B8A2,0x236FBD81E28CD04,0x2EC14174934527F,0xE54FAEB0A92B07,0x172B473A247A04B,0x3F45A489C10CE94,0x3C1BD3B74EA426D,0x1917CF88FA4}},
+    {{0x36341B4D7DC0F49,0x3ABFDB0B7D1C694,0x2220EC795FB8E91,0xE131E937F0EDED,0x32E9F33FF2D3749,0x3DCCE3E3194E983,0x8EEC1168AC2EFE,0x11851BF390},{0x9B39AC0308B0C3,0x3F80CB584DAE15C,0x1DEE07D8DFC4AAC,0x982A0AB2F56907,0xE9BE0DED27C3D7,0x307B3947582E49B,0x59CFA2F7F45806,0x38D9F1B477B},{0xAA50480BB8E189,0x355EBD17A1178A5,0x39707A50CAE9F12,0x1C5C2E1285EC70C,0x1DD986369CB16F0,0x3D324DF237AAA2C,0x206331CC1F24FEE,0x1033061D345}},
+    {{0x305910484DE9428,0x588150A96AF7E5,0x39AA0EDEDA16A4D,0x3E6A4FDC71B596E,0xEE88BE135B8DFA,0x6B4767D3955F2A,0x49F4C896AA2678,0x34FEF8C5B1B},{0x2088D8522C34C3D,0x36EDB5916EB7FC7,0x33E3080B8385450,0x1F5733153142AC7,0x2C04E07E6EAC065,0x7A69EE965ADFBC,0xC35CCECA8A73A8,0x282E01320A1},{0x3941812EFA39F80,0x1DF81CE2C193364,0x29E76AA84855470,0x352EF377DA1AB12,0x1259CD25DEA9FA6,0xBD9C2564D0B551,0x2EF60DA18176AB7,0x16DF9349B75}},
+    {{0x47EABFE17089DA,0x4B46119BB24314,0x39A511AA4586153,0x20BAECF4D230E6C,0x1BAA0AC4DAF1B52,0x21BBA89AF9EA76B,0x2EF58992BA8554D,0x1FF2F6DB57C},{0x1320E79B56863E7,0x1BAE743029F738B,0x1B9F4031784CBC,0x25DA208FB9EB07E,0x36EA6B6F4F9D874,0xA9E0F19ED95FE6,0x16E237357470FEF,0x3CE00A3D656},{0x41F9228EB32E80,0x119383DD3680388,0x18E2A389028DCD,0x1B30896190C14C3,0x2010A5BAABA9248,0x26B7F7E44FF3F82,0xC7BEDA0A70C118,0x2E2AC9C53C9}},
+    {{0x2D4E06F5C1CC4D3,0x3E8CB8CAD3C0E,0x11956B9AFC4628D,0x5A570E73A4E76B,0x1AA39D41E08A004,0xD03F5FFC99BEC0,0x2584C6033D545AF,0xBD9550A38D},{0x14CFB1F8DFF960,0x3DC8DBFF36A051D,0x14C6A6788D452D0,0x1D0AB52949DFD82,0x1AA369D65A07EEA,0x25D89F1B0E3588A,0x3142E590E098863,0xD8729BACE2},{0x104F07A644C90FF,0x3323763CBF83FD4,0x12E6880E9953550,0x6D3A1435A27B5,0x3120DA160DF85E9,0x27E9176D09721D2,0x1017D387EE041B1,0x15F303BF58F}},
+    {{0x9E37F500B1C7E9,0x35EB14675DA3E5F,0x965A796043BAF4,0x2B3BC3F0E1B1D32,0x4922AFA9794DE6,0x334D88FEA92EC62,0x358CD012428ED0D,0x29D85D5FC49},{0x1D81454F18C1B98,0x2F1FEF8920EEE63,0xAD5817F84F8C24,0x2FA70BD79295966,0x25B58D386DB9C0,0xE54518FE2A31E,0x76320FB1AD01E1,0x20C6D0A053D},{0xE233332894EFFD,0xBCECC894EFEF9B,0x1BA0B5F86EA6C81,0xA8B6A8ADA0724A,0x142FF6BD8E16407,0x242139BBFA3DE17,0x212C184E22C9190,0x3074A7C1A00}},
+    {{0x1E108EC7BF62DA2,0x37D3A13F0C5C642,0x15864ABA66AC47A,0x15328352D52523B,0x3AF748E4D6B5EAC,0x2E47A9888BC7C5D,0x397FD5F99B087CC,0x194238D95EF},{0x20DD84B70D459A2,0x3F99A84FC1C7B3D,0x139F531168C1BB,0x19D7017EA59967B,0x6784E982F99BBF,0xAD63BB573BAB35,0x2A127F0A969C2E3,0xD1C7B2ADE8},{0x2D7E7C924696324,0x1C21E4B89088C12,0xC91FA8D9882F6F,0x29908C7730A4A01,0x1AF31C42F44DE4,0x1EF46ABD8F8B33,0xBAA99719DB412C,0x2E2843E2D21}},
+    {{0xEA864A20FD3CFE,0x3545B1A09A9B9FA,0x175A2F3C8FA3744,0x193A39807C534A3,0x3417670DA3AAE6A,0x1F8DE9291E0EB7C,0x70C3CC3F00A70A,0x1C22ECC5730},{0x283B649562F803B,0xD0C70C38D3D7D1,0x17C9CCA0B6838DF,0x1CAD46AF67AF5FF,0x9BAE91B623644A,0x272D204A42DA7EC,0x261F574048EE914,0x297AEAF8FF1},{0x35CCD0830C70792,0xFED36C105AFE08,0xFECD2E33C148C6,0x569F423036B17,0x201C7243BB68755,0x109E2D705FE8C8E,0x3BFD66B64A6E6C3,0x2DE8F1F6C85}},
+    {{0x4D6FE7865D22C0,0x39055F14BE70AA4,0x3274D874DE917A9,0x32B576935C53316,0x3A3FC49EFF5E8A5,0x28781133E26673E,0x2930DC289FCC249,0x3A5F7864C},{0x34893A41D6DE601,0x148B9753133F9DB,0x3DAF4A95E7C12F5,0x20840C1CB7EAB31,0x1AFA278A38927BB,0xB89B6FE51AB18D,0xFFDA648407CBDB,0x3A30416DA11},{0x3BDEABDB7A791B5,0x302D2E6E5A26B9E,0x21CA563C6895864,0x3F0FECEA308B736,0xFDE16E791F835F,0x23DD477E9AE2E84,0x1BD15B6EFA6DA12,0x3344CFD6B51}},
+    {{0x8404941B765479,0x17F7B3FD160DF71,0x61796372ADBD46,0xD17E131E4C5660,0x3756D2E46B6AAAD,0xB4C0ED28E12C,0x1E87440ACD5B392,0x13CA929F11D},{0x38E1DA5606FC2,0x10B60870A70BC14,0x3EC074CB3F139DB,0x16778BFB9D3B166,0x3115A819EEA84ED,0xF0759718B0FA61,0x261172EB440B972,0x2E49DD5006F},{0x26BDEBB9224C58E,0x1BD634778C39A0F,0x39473A13B23510,0x19C70CB80BAD5F3,0x3CC24A186592A27,0x1C72773D5800C4D,0x1CF8B9917F14C80,0x2374E7087BB}},
+    {{0x44E4A51D0FB585,0x380211AFBC7CF3A,0x34EDEF39A8E2DE1,0x2210C2BF8CCECE4,0x324AC78B0543371,0x1A903CE7793268F,0xD51039EDDDC9AE,0x3D1C055E3AB},{0x11E396949A2F31A,0x2322903D2C66A2C,0x26DDDD10C9D239D,0x31BE5D091621F81,0x2A9FDB51113EA28,0x99ED6BC3EF8448,0x24CD30C89F36E0,0x1EC703DDD3C},{0x2CE4CF5532989AB,0x1F2E6DF9E4DDB3C,0x1C7AE7F6DC0BDDC,0x291CE0F8D5758D9,0x3BB13ED6C346EB8,0x3B4A408AD7FC081,0x1D2E27C8A1F9273,0x3411440170F}},
+    {{0x38E1DEBA5E6F3DC,0x3F18DB3D01A97FD,0xAE172B06C80CA0,0x20D5B702617FEE4,0x2C2895C2189A05E,0xE81B77EBB1D586,0xD43AA357499628,0x1B7EC989F9F},{0x36576DE52C8CA27,0x9A92A1C924063A,0x400C275C5C3434,0x3138D2016B4B643,0x3F3651B161D8743,0x3802CEE766DCC4A,0x3D7E5D4B8E20BF7,0x22266F7DE34},{0x2069D7B57F890D3,0x2A6DD5E47EA68C0,0x1B22FB191BDBA62,0x1F47C771B654048,0x28C94B792C92FB6,0x95B86ECC96AB09,0xAF5B06B278A82A,0x26620D855AC}},
+    {{0x3089B3E73C92AC,0x3FCFC9E55E9D7,0x3843D3D9D676F5,0x293951E867525B5,0x12268911C98E924,0x2B17EACE3E216D5,0x8C4104881183E0,0x32B33AA771E},{0x1FBE2E95E3C6AAD,0x69ECE64ACE9B3C,0x5302EC587D78B,0xCBD62683860984,0x3262ACDB9786106,0x2854793AA3E48CA,0x3909B21194E9C09,0x2AC4D916126},{0x118690F28AF6F42,0x6916E199D36F3D,0x26F1A6A30415AAF,0x31BAE6DA9586006,0x3CB6E0C6518D53C,0x2DADF06F1B4E82A,0x2B1AD59B0729B13,0xBE0A311F2E}},
+    {{0x11D46DD21DF379A,0x1A46E5B3F213E1,0x2834415642C242B,0x12C80681016AD59,0x1DD2D7836926268,0x3CAC5F332647C35,0xEBC0545A8A33AC,0x5C32A26E7A},{0x324E76E79E1E2A7,0x1B5CEF83C2E6802,0x227896603FBD5E2,0x2E13661C61B2E3,0x8CF9C69864ED59,0x20C33BAF93E914E,0x10E38DF8DBDF1CB,0x1F8DB13C9E1},{0x1C6A3F1B42A59B5,0x1580C33D42B1AB7,0x37BEE9F382D9775,0x372C8955946151E,0x120EC7B2C5D5B5B,0x8548E9245E0E64,0x2B9D09EC7E0CF79,0xFA69A54D68}},
+    {{0x323AABDEF5ABF10,0xDEA57BE13DC384,0x220539C4F266973,0x7EEBAA043B3887,0x3195DA8FC493284,0x23103C8AC133B46,0x3BDCFE227F6FF06,0x1FF19644296},{0x1CF3FEC1F52D5D9,0x14A592FDD1FBC56,0x13EE3BD607ED26F,0x20FFC04A6A34BE6,0x8614A59A319655,0x190C71A2C139393,0x1A895E147EA1DBB,0x2B4037ED534},{0x3DB8A277EEA9E04,0x1F40A8308E33104,0x25E7F97F4453B77,0x2546EA91E195B0A,0x848D0EF5834A8F,0x257852A567457D3,0x2D32477EAE5875C,0x3A8D98BAAE7}},
+    {{0xDF3E7C6643B0EC,0x26FBFD17F19C9F2,0x3E0A2E61F567A0D,0x381E257F792F0CB,0x32FC58F50CD09EC,0x2F786B6943F5443,0x2799CEDC3ACC34F,0x2BF5C9ABCA2},{0x33A6B81A18411BE,0x3B5F8A921BE5701,0xE922FEA50A02DE,0x128F50146FA6EB5,0x29FB1AA684FFFDA,0xDA7885BB7ECA44,0x273E40D0B41F34D,0x3BBB9DA9A2},{0x39A08AF27425B5,0x7AC613D13078,0x1E1D212E3F410F8,0x2EAAB03B0CD18B7,0x5DA81B9C7D725C,0x345038854FA570F,0xD24C8362FD87F,0xC29FBC84BC}},
+    {{0x1519133F6AC573C,0x277128D7F530FCF,0x54022A017757AC,0x187E062550AE7EF,0x24E62744DECD1E5,0x2828148497CF2C0,0x35422980E5A9073,0x30BFBDCDB73},{0x8A6F2E306E4353,0x58D058FDA1350,0x1655AE048F79CFB,0x3359689351E66A2,0x1B870867705DB7E,0x27FBD662C5C7DBA,0x3F79CD528A5BE27,0x5228294650},{0xDE7840D11CAF5A,0x35001E03CCE0E85,0x12BB3DC86D61962,0x1C3BD0D5F07282B,0x3F6A04EF285471F,0x36E443152D45A9C,0x14B36808456EA1E,0x27688B456F2}},
+    {{0x28CC2365A5100E7,0xC09BD42164908,0x30A4DE79A3D714D,0x283BE834FE43F2C,0x10A126D559474AD,0x2D175A3E9DF250D,0x1FBFFA80E570C7C,0x3810AEE0E61},{0x351C80F1FE13DBA,0x1FAB388D33C1575,0x96B8197B73F95F,0x25A7296A27736FA,0x2372124D5FDFD98,0x2CDDF1A555A79F2,0x19CE58E806A8BAB,0x246D331EEBE},{0x37D53D34326499,0x30445C1298B90E4,0x14811303EBA9C3C,0x79A28749592FE1,0xCD5A34FFAF9C00,0x181AF228064DB7E,0x3F9303DF84E370E,0x5725733CF9}},
+    {{0x324684AE182401A,0x3C2DE7070869C1B,0x1FE1D81F8D8998A,0x2AAB7E1C3D2EC1A,0xF8D57F85CF3DD7,0x2A858B6381B9290,0xA1A0C5228C8B55,0x30D0912AA70},{0x3B5C6CF968F544E,0x3295814CF788EAD,0x26AA5512047C690,0x28083B696C4AAAA,0x272EA0A49A751A6,0xA29B5B3FFCAEA8,0x38A495B756EBF4C,0x35D1C1D3985},{0x7A861F639569C4,0x398682CE879B821,0x16B24044EA6D5D4,0x2E0E2DD36782E57,0x2596E0B59C85D10,0xDEE2B5D7E49679,0x257D4C37E1EAAED,0x34F2779363E}},
+    {{0x30720A9F3F66938,0x664D5ADB605277,0x31B89C419A3D7F6,0x32399604D12E9B8,0x2F1D130561AB936,0x211C1897DB1036F,0x106B7B2D6A2B6BB,0xF2A2CA6135},{0x16BF729AFB011B0,0x70C1E0CD1232,0x386AE9508083742,0x2A7DE06A36881FE,0x1ABCC54D5857562,0x23F26DCD921631,0x1138DFB50353599,0x22FDDFF658C},{0x806B7D4CE94C48,0x18D3948987BCB27,0x1AAA78AE7C0A7F0,0x1C6ED1631F26FAF,0x2D9600A494C00F9,0x327F7BBF555901D,0x16E2C26BA292FA3,0xE594554274}},
+    {{0xAB9FFE79E157E3,0x3E73F91B5137056,0x28435551C8A4A3E,0x29D8E2B300EDF8E,0xF708A4EBD49954,0x24A8A54E4304C65,0x1B113A2B68B2538,0x30598B08975},{0x1CFBA0723A5D2BB,0x13FEBDB4F30C9F2,0x86C6314BC67E25,0x38599858C4BCC88,0x22FF780F97BEA72,0x2A65256BD000084,0x251E3562F247578,0x17D1E68DDF3},{0x7EE3ECA6C100E5,0x1E80A5EC33E984E,0x26257F3B02E8680,0x120094F581CE32,0x3EF7A0F5EDB0EB1,0x87911B1C4F6B5A,0x1F18873D65CD0EB,0x2CD19D6228E}},
+    {{0x2EF3CF141DB25B2,0x17C870040D46536,0x23DF8AD9DC76B7F,0x36D7C2BE51C0D4F,0x1BDCD045409AD8C,0x130099AC83B7B98,0x383B81708193ED6,0x3415B3BBB9B},{0x316D110075A0506,0x12B9AD253ED421B,0x28D7B273B43D4D,0x2D2D21BB8230F44,0x17D709B3AF8EFD9,0x2829390B8BAAA2D,0x21586E6811D5937,0x131BCA1EE60},{0x3922695F976E2B0,0x160C96446B5E503,0x3319B99083B788F,0x1C23DA2457EB200,0x1D7CA27188B5C51,0x3B08C06AF388404,0x2F56D00329C005F,0x11EC78457B0}},
+    {{0xE8812B66CFAD0F,0x1589A6C7DCA01CE,0x25E3D4C1838138B,0x315AC458A106412,0xD683BE82E65ADF,0x3723F66787E31F9,0x380A3B699BA549A,0x2D54544A812},{0x954328DB6837DD,0x1F5820D9597FBB6,0x39EFA69ED2C7A34,0x34CF3D8854909F1,0x84AEDEC5956C28,0x57B83E360763B0,0xABAA13AB0E31B5,0x10B7D88832F},{0x3973CAFC0128D00,0xCCA7E37765CEFA,0x305235AE2B7D5F3,0x231029AC7EEA78A,0x2A7FA5FC6B33A44,0x24B0FA97AEFE4F3,0x34DFC674CB38C3,0xA49C235E75}},
+    {{0x270A99AA72B6D7C,0x22DA6CB67C05877,0x7878C572F35DF9,0x3967553C1079E0E,0x29423F1A09D9215,0x2AA5F402220FC43,0x16517287F140D58,0x91B67396FB},{0x1823195AF52549,0x3C6CCA9BDB04FB1,0x18FF8EE63CA1C64,0x38E88ED72223C70,0x55F69A7E7883F7,0x32E10D08951D346,0x16DEEBA2BD6CB48,0x11E801A2B2C},{0x25FB43A85F420AF,0xEC934FFC04A2BD,0x3E632572EF7E7EE,0x52F70CE67334D7,0x114C4F5CAA80D17,0x3ACAF1CD5EE447E,0xC327D46369D480,0x194E6254461}},
+    {{0xE0A0BF17A3616A,0x1DDCF0797E99857,0x3053D538B2A9832,0x14D5BC54A9072FC,0x3EFFA9735A932CD,0xB275BA954D7A82,0x1692BA840555A0C,0xD904C56390},{0x1CF53FB12C90FF7,0x19F92281BDE54F1,0xBF2D4466E45D2A,0x131091C39C61BB8,0x29DA1FE28AEF9C5,0x1E4BEA4A94CC809,0x16A1BC18A5681A3,0x2A295292C25},{0x1B821305FEC2F88,0x9100B5C385DED4,0xCEBB9D6E69557A,0x34A053AFDADBAB8,0x21B75C7DBACBC1D,0x3A7FD235A44A431,0x2199D8B362898D2,0x210CC8BAA7C}},
+    {{0x38D1CA668F9FA0D,0x2D3B6576280BCAF,0x11D19FC79F630D7,0xFC1123B13D1BE9,0x294B371DD8623BF,0x29C3A53EAF35943,0x23B73AF3FCACD90,0x3DC83100F3},{0x1590814CD636C3B,0x1B3DA4A3511A651,0x225843AAF484A4C,0x3E6D69306BE6D1C,0x24025116B36CFB2,0xA87C9233C0CB09,0x3C5D8CD059E2741,0x219B54DA18B},{0x1912E264B0BB927,0x692D38BBE1E3FE,0xFCA300F98D0CD0,0x323E4347CB13EB2,0x65E220C28E66E5,0x2E29954E0F04C8,0x2C97AECA52DA1AA,0x2BCBDC66FEF}},
+    {{0x4241F657C4BB1D,0xD59C5C0BD461F1,0xD8A9449F397375,0x309CBDDCB30303,0x29C1B7EFEE58E28,0xA95ECC8D252D7B,0xC9EF23AF473114,0x2030387758B},{0xCBC05BF675FFE3,0x1988573C96338F,0x2C5D223928C911,0x120C384A8CA9A6F,0x15F5EF5E8076A9F,0x33C9DE593B48CA7,0x3365DF81BA58A72,0xE3A9C35B86},{0x1E129A86CD4C3C7,0x748286CB3539F5,0x7E14F9891DCBB1,0xED940132482047,0x4E53D3D9945F2A,0x3F6DABC724E0D6A,0x12C357EB17ADE9A,0xB8AC107771}},
+    {{0xA5C53AEC6B0C2F,0x1B12E1CC9CC4B61,0xFC374CBC73273,0x14AA35E3FA4C433,0x327D980E8665D17,0x882989A4B58011,0x3EA55D079280146,0x2F47FB6E183},{0x3CBC4F8AB35D111,0xD6EA337CF8CBDD,0xDD5B71ADB614B9,0x85ECE8B7CBE202,0x3009B89C26EF27,0x2B9956941511F0C,0x3D4C21044312986,0x109E80448D9},{0x38A8C36B334A582,0x1214F986D3EB0E2,0x36C0AE548A3CD48,0x1C0CFE5B0A70979,0x3186FFAFBB7D528,0x30C53824898DCF2,0x32D33CC708B4796,0xD1AFA35FEC}},
+    {{0x35EDFD25AF4A11D,0x4E8F14C1E119E0,0x38B20086873EDD3,0x31DD3803B3F83BB,0x1F1BA65D2F3DD78,0x1FA2AC4D90DC666,0x609FA9BE5DDE9A,0x3AC51B3A1EA},{0x76AFD6565353E9,0x3FE9C08F7546E87,0x1B7A09F2237EDE4,0x2B28215D82E9E8,0x17AD973882B9995,0x3927A25099BA941,0x1679D01C4217F55,0x1A73EE71555},{0x2304A98F20F18C1,0x1C9A3B18762AAF7,0x3A0FB3F56D8AF99,0x1C569F8946B3149,0x36B1236CFDF79A9,0x2AA3A5344DB12D7,0xDB135453957FBB,0x353E81B1C94}},
+    {{0x3AD98392E07C287,0x3C5E8A0A4724AEE,0xC9700292BBDC96,0x13CCCC230733641,0x186B302CD5066AF,0x1EBF5E3E33E00F9,0x362BDEBD74D4716,0x181BBF3C5A7},{0x3FDAB41F7071EF,0x1280CE7DBC9B8E3,0x13A6ACBADA78A89,0x284A4568DD8DC13,0x2E3FAAC6F41E60A,0x34C64BE7C8BF887,0x1B9B03089AF1454,0x16F3500E5A},{0x36BEDFF26B1622,0x313DA08A4FD05A3,0x37A5470320C09AD,0x2B61ED1158AFCD7,0x11AF692E526A315,0x280E05637F76D10,0x2ABD21673B93A69,0xFEBDBD469B}},
+    {{0x3E8E41421481E42,0x3114736F51BDF0F,0x22BFF811C84F3CE,0x9C7D00F650D928,0x399ADDB7016360,0x2776D38641CC4B7,0x3F2A044E33BCBA3,0x1A02A1E81D4},{0x23AEE38BC3EFAA9,0x301C459DE1D4796,0x1C3D0AAF1AF9C9A,0x213305AE9DE5872,0x212ABD73DA6F9FF,0x1000EF5FF2F6958,0x366813CEC720BCA,0x19ADB103363},{0x1F090733893B731,0x19CB286F4182C62,0xF2B7AA90D729B5,0x3FDB41941A79ED3,0x333969CF4772466,0x1737C533CF3FED,0x13F939E9D629744,0x34980237239}},
+    {{0x36D6CB0155A5142,0x353B3D3FFC42926,0x7CDB52284A7C68,0x2AEA3EF6AFE045,0x114467F08C2FDB5,0x157A14C4E61D3C5,0xF1E4C3582E9C5B,0x1C0F3E07958},{0x35CC1FE328D027F,0x9C9C19157DF45B,0x35CE93D597095D8,0x38DD6650BB4DC3B,0x1C1128B795F1A2D,0x108C905025F0467,0x2C3815A2237018E,0x3467F4084A5},{0x3AAED8BCAC310A,0xBCE9E886A33C98,0x3476662CB6696AE,0x2E3F5C1FCFDD49F,0xB59CBDEAC1009E,0xCEC4B94BAB1FA2,0x12B9AEC16B0BD52,0x3757DCF4C9A}},
+    {{0x24058CD45681292,0x17DE752D1D0D4CA,0x3BD84E700ADD931,0x1DD3390794F4960,0x3E28B39FE2D51EB,0x2B811D44DE60037,0x11F307F2C9DB48F,0x3911BCA34BC},{0x32B7383084D4766,0x5BC0E57B5AB052,0x375740361BB48C,0x128DA1598A9B1A1,0x7F75472AA34B10,0x17C8F99A4940247,0x2BAF4E9089407D7,0x3C47A884860},{0x2FE850A1DEA493B,0xDEF1F05C202C37,0x2989B50BC511E6C,0xC680DADD345290,0xA37AF6E1B7FD3B,0x15CC1A41C538C54,0x1137C79F1E5E8BA,0x1543AF17421}}
+};
+/* End of comb table */
 #endif
 
 
@@ -39,6 +39,99 @@ const BIG_336_29 CURVE_B_HIFIVE= {0x2B67,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0
 const BIG_336_29 CURVE_Order_HIFIVE= {0x1E9FA805,0x197CACB9,0x1E4EEA9E,0x17AD70F,0x1FA9850C,0x38A0A,0x0,0x0,0x0,0x0,0x0,0x4000};
 const BIG_336_29 CURVE_Gx_HIFIVE= {0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
 const BIG_336_29 CURVE_Gy_HIFIVE= {0x5FE8632,0x15F63428,0xD976C4,0x1AACA194,0x35B6DB5,0x8E3F7A,0x52D1B0E,0xF0A7A36,0x1C161D00,0x8170C70,0x1185AD59,0x181B};
+/* Fixed base comb table for ECP_genmul - generated by scripts/combtable.py */
+const BIG_336_29 CURVE_Comb_HIFIVE[88][3]=
+{
+    {{0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},{0x5FE8632,0x15F63428,0xD976C4,0x1AACA194,0x35B6DB5,0x8E3F7A,0x52D1B0E,0xF0A7A36,0x1C161D00,0x8170C70,0x1185AD59,0x181B},{0x7EE4A58,0x78A71E2,0xA319138,0x1792F0,0x8492486,0x6AAF9B9,0x1E1D44A8,0x147DBA89,0x11095C05,0x114954A,0x1244202F,0x1214A}},
+    {{0x16BA573C,0xB2F06AF,0x1FF74E24,0x7C393CE,0x7263B6A,0x1865694A,0x19A27937,0x14F3C492,0x2B2FEA5,0x139D392E,0x1030C1C5,0xEBE},{0x1EFDD246,0x1A1C9D3E,0x1939749F,0x9856E08,0x6219A73,0xCF45874,0x196E79B5,0xB2C034E,0x4BDCF7A,0x18B30A7E,0x155F8BA3,0xCB07},{0x7144CF1,0x1A39E9C7,0x11E91507,0xC1BDDA9,0x10CBCBEC,0x779C0B2,0x4F151B3,0x4357BF1,0x1266193D,0x42EBCE7,0x1E0C076,0x172D6}},
+    {{0x15B1D394,0x1D64E101,0x1288ACCE,0x13EBD553,0xA79178C,0x59047EA,0x1AD2371C,0x125C2B5B,0xABAC20,0x1CDC352F,0x56CCE61,0x949},{0x46038AD,0xBDDBDAE,0x708366F,0x14704CF2,0x12D4FAF4,0x1CD8D175,0x1B449969,0x123678CE,0x43AAE98,0xA298740,0x20F127,0x3FB4},{0x18FEB617,0x198EC6D1,0x7FAB786,0xA8CF1FD,0x1712BBED,0x172627A5,0x5675337,0xB1D5BFA,0x746242C,0x196427F1,0x19F348A4,0x2070}},
+    {{0x1F77D6E8,0x1EB85B86,0x1BCB34E0,0xEE77B7B,0x15652899,0x1EA250E3,0x119F3F3D,0x1ABA1F54,0xD63E28A,0x5D27BD8,0x1FB72D5D,0x1451A},{0xA45346B,0x86592AE,0xF12B34D,0x1C1BE937,0x141DFB43,0x1A53310E,0x17395797,0xA78E118,0xFA485C4,0x1170D7F6,0x661F451,0xB3D},{0x2FA244B,0x6DA1109,0x17F7E4AB,0xAA5DF7F,0xB803A1A,0x1995F7B2,0xB115472,0x14ECA0B1,0x1F946497,0x16147DCD,0x1CB0DCAE,0xF13C}},
+    {{0x3F4AF02,0x12174E6E,0x193A04FC,0xBF3D0F9,0x148498AB,0x10955A11,0x1AE9DC70,0x1495FAC7,0x846EDDC,0x1BB63931,0xDD92255,0x7C0B},{0x362EB1F,0x18769929,0xE5ED402,0x13DD0D0B,0x15CBCD39,0x74AD97B,0x1F74115D,0xA8E0A28,0x1E4AFB39,0x1B5FE096,0x1A7EA299,0x14C3C},{0x6B42993,0x1F4D5649,0x16DD713F,0x1C2EDD86,0xCEF60D6,0x12918693,0x14B02A0E,0x1DB7950E,0x7E5AB1E,0xCD0C96E,0x1B169C,0x106A5}},
+    {{0x1575FE84,0x93AEE93,0x1207EFFA,0x1F023DCA,0x17017170,0x121D7BE2,0xB57570B,0x152A1588,0x3D3EF68,0x18C105DE,0x4ECEF,0xCCB},{0x1678E475,0x1E02A7AE,0x1B180EF1,0x1DF4F9B6,0xBB41A37,0x17FF9C8A,0x10796F7B,0x192C58C3,0x10D975A4,0x1A04B921,0x1CC0990A,0xB188},{0x7761173,0x106D4997,0x14E50C4,0xD5BC905,0xC059F52,0x1066483B,0x1BA89AC0,0x12B06CA5,0x16403981,0x1CF969BF,0x123B65E5,0x4AE6}},
+    {{0x1953C343,0x951FF5D,0x6E1E6F0,0x5200109,0x19E8BD02,0x17A466B5,0xF8851DA,0x1144BC0B,0x10DC7A91,0x67C2662,0x11F18D13,0x1EB3},{0x89B7B28,0x32C0718,0x8ABC090,0x15D08F75,0x3D495F7,0x14848F56,0xE6F27D7,0x1361442F,0x2DDAE43,0x1B301365,0x1CA43C66,0x1D696},{0x6D63CF9,0xD9583B5,0xEE4E9,0x1A6F68CE,0x1A46E29E,0x127CC444,0x1052A780,0x1E7FD796,0x1DC1BD6C,0x1BD34BB8,0xD84E81A,0x2716}},
+    {{0x100047D6,0x4BF56F4,0x18B25001,0x1C689882,0x713DB47,0x166090F1,0x10CC1DBD,0x15547144,0x4D101D1,0x1DF2D09F,0x5792C8E,0x1B3CC},{0xEB9409B,0x16EEFC9F,0x15E89415,0xD7DB4F,0x1984609D,0x8CE54E2,0x2BAEC5B,0xB8D0AE2,0xAFE4E6D,0x1C5AAE21,0x19831F5C,0x115},{0x415DFE0,0x41DBC76,0x10F383C5,0x126D39E4,0xE5DE907,0x15556381,0x1FF6A971,0x1387D73C,0x108B1B5C,0x1EE957FE,0xFBBCFFE,0x2F40}},
+    {{0x8AC36E6,0x11CFE8F5,0x839232E,0x17C8574E,0x28B2593,0x1CBCD0D6,0x12DC4A9E,0xF9FD1A5,0x586A7AF,0x489DB1F,0xCA7BBD5,0x18F42},{0x578D79F,0x15D5734C,0x1838EF24,0x148AF0D3,0x151FC183,0xEAF7D7D,0xE01BB2E,0x10727295,0x113DA160,0x1139C07C,0x3422DE8,0xBF3A},{0x1FD977D1,0x1B1878B5,0x39713E,0x6273A12,0x7630186,0x13CE6C23,0x18C46098,0x1226BBEB,0x1EB3D1FE,0x718AA19,0xC17C3C3,0x181BC}},
+    {{0x1FC33E25,0x1AD8411A,0x1CC36CA1,0x5104BE9,0x3360C8B,0x1990E843,0x1E46BED,0x1C94543A,0xB3E1A3,0x7C54030,0x1638B6D8,0x15B2F},{0x10540E96,0x162C3FB2,0x19B59E1A,0x17C286FE,0x17C3349A,0x1547529A,0x71E3D08,0x1F5EF428,0x1CD42A8E,0x10440715,0x358520D,0x1B4E0},{0x169EDB28,0x70222F9,0x48D0496,0x1633D867,0x2F3156E,0xDDF34EF,0x1227434F,0x11842D08,0xFE295C2,0x13B274D9,0x1478DF60,0x102A0}},
+    {{0xED29E78,0xBF3A59F,0x3C628E7,0x9C5EA56,0x1AC7EE47,0x1FA28594,0x6B6CA62,0x1B156CA1,0x12D8C15B,0x1C1EAAB4,0xCE6A4E7,0x1184},{0xDC7B22F,0x1A27D317,0x18B4020F,0xE78B2BA,0x18231D72,0x1A4F600,0x15E239C6,0x9FD1EDF,0xC7A8037,0x18D5BF56,0x1E1E99,0x9A1F},{0x1446380E,0x1753AE78,0x14203E76,0x52EEED9,0x16B0023,0x188A815E,0x1173869B,0x1A76632F,0xBF654CB,0x137C73AD,0x1C5A2C16,0x6D7F}},
+    {{0x149041E9,0x5678957,0xBF66419,0x9925F5A,0xC11FED3,0x1A62AB46,0x1482EDF8,0x119DB15E,0x4438636,0xD49EED1,0x140F5D7E,0x8DDD},{0xF60E399,0x1E4B58D6,0x129F9BFE,0xD3F277E,0x505C4BF,0xC4D2B9F,0x1BBEC6F3,0x1BF0AC0E,0x78E2CA4,0xD50E090,0x670FBC2,0x19478},{0x14422300,0x90CE7FB,0x1BB24C2D,0x50D6886,0x29EB4AF,0x1FF9597,0x17293681,0x1990A92C,0x402A7A3,0x4821ABD,0x108FEDED,0x1A7D1}},
+    {{0x9904480,0x1C0C925A,0x1A6C4AEC,0x1B209391,0x17510EF8,0x19E04680,0x47AE1B8,0x11DE4AC7,0x163FCAAB,0x15C2FD07,0x7EF3AF9,0x1455D},{0x126E33D5,0x4E1B2BE,0x149820E2,0xD988D6,0x8D07D91,0x17DBCB02,0x1E127201,0x4EB045F,0x680A908,0x1E65850D,0xD35C82D,0x1C647},{0x15DB4F51,0xB5F59C6,0x94CA491,0x5A7C830,0x2BC8E13,0x150165FF,0x462BD2,0x15F6BD5C,0x8E3EC4E,0x1DE2E613,0x1A84CD0A,0x12642}},
+    {{0x113C000E,0x1981C8F5,0xD6A375,0x1EC82398,0xC32540F,0xD1454BF,0xCE1D900,0x4EC5F06,0x767162E,0x5BF341F,0x68F7735,0x3DDA},{0x1DA377DD,0x1691681A,0x18305FF2,0x9D86DEA,0xE9A4A39,0x9147EB9,0x1D14F753,0x198DB1C5,0x1CFC90B5,0x111294F6,0x174CF64E,0xAF02},{0x16ED67A7,0xB75C0E4,0x1596307,0x16BDCAB3,0x3E602AD,0xA1A0D67,0x13309BF5,0x58A4E3C,0x1866B39A,0x12C0D34,0x2E522D3,0xCD23}},
+    {{0xE5C11FF,0x4BB7EE2,0x1647ECA7,0x19D42887,0x18F857A5,0x1E7A495F,0x162CEDFC,0x1EF79304,0x86027B,0x125CC521,0x1F6AA226,0x8CE2},{0x60A70B3,0xD8B8301,0x19AAD96A,0x18FBC31C,0xD2AF94F,0x1CCCEA87,0x978F843,0xF878002,0x1B8594A1,0x19616AB3,0x1622D80C,0x1A063},{0x5940B05,0x646B0DE,0xCA9888A,0x91E7BEE,0x3B56EA0,0x485FEAE,0x18DABDE4,0x19372,0x16C47FE6,0x1486079A,0x3F98513,0x19446}},
+    {{0x13F2138A,0x10DF7712,0xC5F4AF3,0x14D55462,0x1A1524B4,0x1E63EF84,0x1AE7175B,0x1C836347,0x113620B0,0x1EC88541,0x135EF35C,0xA523},{0xA955487,0x17235B81,0x1DAF504E,0xC500352,0xF87ACD9,0x10C85587,0xEC87062,0x12BD63CB,0x6464088,0x1481B19E,0x9E0F4E5,0x9EA0},{0xB771649,0x177C3219,0x101D19FF,0xBFD659F,0xC0A4755,0x4E7D586,0x7076127,0xDA96C7B,0x1027DC2C,0x1096C2DF,0x17766763,0x12B48}},
+    {{0x5A5A98B,0x9DB5C46,0x1772D3BE,0x54C62DB,0x1C462E37,0x1A5FBD62,0x1ECB771B,0x17AEF899,0x1A0D4897,0x11BCCCB3,0xDBAFB8F,0x1D967},{0x1D615018,0x100CE32A,0x12158677,0x2EAA07D,0x63CD7E8,0x1A3B6231,0xAB4C237,0x18514A53,0x66DC2BC,0xDB67C45,0x82B1F9A,0x181EC},{0x106325CC,0x94E0A27,0xB70CF34,0x7FFD96A,0x16FA8DE8,0x12D6CB7B,0x11BECFA9,0x1A0B586D,0x1C1F71FC,0x17F1573C,0xFB6DB4C,0x1B394}},
+    {{0x19FEFA82,0x12AAE0DC,0x9A5C5DA,0x70D2AE4,0x73035FC,0x3003F0C,0x1A92FE02,0x15836939,0xB213C14,0xF774900,0x1F82D21D,0x1C07},{0x15FE233C,0x149FAB44,0x1AB30B22,0x150CB754,0xC69AF96,0xA66584B,0x1E467496,0x13FB2676,0x13D92F54,0xE5373E2,0x7EAE29C,0x158F1},{0x1053E6CA,0x33CBEC9,0x3DC8512,0x10CA44F2,0x3C2678F,0x134A3CF1,0x7601898,0x5AC8700,0x1501515D,0x1C702E4D,0xDFC32C7,0xE4D7}},
+    {{0x9E3ACB7,0xA1918F0,0x1A614176,0x4CA57D,0xF70FEA4,0x13B33DED,0x1849EC9B,0x2EC6A5B,0x2539A51,0xCA9FE84,0x1391CC23,0x1D4FC},{0x127E8F4F,0x1A7EE733,0x1454F6C5,0x1D3FA0F0,0x1C1BACEF,0xED18FCB,0x1B57916B,0x10683F1E,0x14D06717,0x18CBA69A,0x8316DE6,0x1F9C},{0xEBBB459,0x871E5DC,0x1EE52BAB,0x1DDA9989,0x119420AC,0xC79D38F,0x1AA4F1C1,0xA3A2890,0x5E82AA4,0x151DA734,0x12C77481,0x3820}},
+    {{0x1EA7C1D0,0x1BC4273D,0xC8127B3,0xDF13631,0x6139637,0xF75223B,0x19972182,0x1C69AED5,0x12A0C012,0xFF49A1D,0x1791CAAF,0x17026},{0x9114281,0x16CE74D3,0x1DD12D3F,0x8D79491,0x9C6DFF4,0x17F57441,0x1EFDBE9B,0x19661C52,0x162835A4,0x8DF7162,0x89DA609,0x164C},{0x4286D1A,0x1111763F,0x409496B,0x7832CB9,0x19B00473,0x18257710,0x10F54199,0x1E86D7BB,0x118AE723,0x1B2E7E50,0x17C69EF9,0x46}},
+    {{0x860BD64,0xF02ED2E,0x11A4DB06,0x5FF6A24,0x1481DEE4,0xE0FF655,0x1AD98A24,0xEE12DB1,0x7464C74,0x5ED9505,0x17310FE6,0x10066},{0x1DA76621,0x9F3FD5E,0x6C5456C,0x19F122F2,0x195C2F0F,0x18B90198,0xEC3026A,0x1503D204,0xD0CE84E,0x3A2C6A1,0x19248213,0x1ACA6},{0x63024F2,0x14BDF208,0x1E4EE069,0xA2CED0F,0x5AD9F9F,0x2D345E6,0x2F1FFED,0x12FBCB50,0x14802DE0,0xC7A3490,0x14725E11,0x7DFC}},
+    {{0x1044128A,0xBCF8DFA,0x17035F6D,0x4BEEC73,0xA63C820,0x1E6DF777,0x1320F1BC,0x16BD3E66,0x8B829CC,0xF64E947,0x126D4584,0xF1AC},{0x1AFA4F16,0x14DEFC44,0x1B98EDF1,0xE598E40,0xA68638D,0x367CC9F,0x132714E4,0x1CEED72B,0xF09FC78,0x1075D7E5,0xCEC32AE,0x9173},{0x10A34661,0xF952EDC,0xBFF61D1,0x1315F421,0x11CA8ECF,0x16BDF37B,0x14707B79,0x515E485,0xF80CD87,0x1F7013C1,0xFFE8B4B,0x3638}},
+    {{0x41D9454,0x1166E77F,0x16B2C15C,0x4EE5B9,0x11EFA41A,0x127FAB46,0x1B5567FA,0x19481930,0x19D353B1,0x130AD6B4,0x134723E6,0x12182},{0x1F70D82A,0x1891D8CC,0x1E98131F,0x10BD8B41,0x14EBFC55,0x317D8EC,0x1497F43E,0x18365DD4,0x1DAFF8BA,0x147F3F7D,0x1DFFBD6C,0x19E63},{0x176D970A,0xA2F498,0x1A585408,0xABB645,0x1B7A3F77,0x122CD7EB,0x169DA17E,0x135500C6,0x142F0E49,0x9513AA1,0x15D487D0,0xE9C2}},
+    {{0x2DC58DA,0x515DACA,0x11A98428,0xEFC4660,0x1EB3FE00,0x6C9AA9F,0x1B2C1EEF,0x82ED3E6,0x1EC94860,0x1BDA186F,0xC65CBEA,0x5A06},{0xB2157C2,0x1565CD0,0x1CEF6A18,0x1DCAE89,0x18720B4,0x1E1001B1,0x1551BFE3,0x21385DE,0x17106C9B,0x1E4090C1,0x157A9D87,0xD465},{0x1563562E,0x1CE51604,0xBC99288,0x9A73929,0x12CE8220,0x47627A5,0x196DEDC1,0x18ECA60E,0xF57810F,0x1A8F0D6C,0xDD39047,0x8D37}},
+    {{0x14122D49,0x16A2223E,0x93EB825,0x182E0392,0x18435F01,0x16E9C765,0x245A0BA,0xF183D5F,0xD8A579F,0x105BFEE5,0xC100FA4,0x160AE},{0x16F2D77A,0x5C56EFC,0x12A1DE39,0x48509FB,0x1A69A6AE,0x1ED0AB0E,0x18AA617B,0x10859BE2,0x126E879,0x17156A05,0x1DFA8A91,0x1E886},{0xB96B247,0x1C26638F,0xE67A445,0x4AF9D23,0x1C82244D,0x1D400C4B,0x1F548A8B,0x19D6AD54,0x9A73E66,0x592AC6C,0x1DFE96A5,0x129F2}},
+    {{0xEA9563F,0x4B1A7D4,0x1F7A7A09,0x1E280DE1,0x3C053B3,0xD92A1C0,0x1E75D4F8,0x1446B35D,0x1F7DAF58,0x99E8EC3,0x1DEE5189,0x812A},{0x1ECEA097,0xD2FE116,0x13DFA093,0x1E2E7B2B,0x1CEEEF14,0x174DC1B9,0x1E595B9A,0x15694AB2,0x113066A0,0x3D11D01,0xA71F1F5,0x15045},{0x64D14AB,0xC5A581B,0x133615DE,0x9D7BAFF,0x15A7A401,0x678D33F,0x10974D78,0x1FBFC217,0x108322E1,0x815638A,0x191357F8,0xD829}},
+    {{0x10919B42,0x7D8283A,0x1EA0DA64,0x1D9EFE5A,0x1F2192C6,0xD2E4F84,0x1BB1F08D,0xD50FE3D,0x1AA728D4,0x346C514,0x12F16AA3,0x1E686},{0x89D4F25,0x3BE4F58,0x174C053,0x1F30F544,0x147C238,0x1DC91B00,0x8B4CB88,0x7D0BC63,0xE976BF0,0xEDF703,0x7B9207A,0x2FE0},{0x70FEEB2,0x2F9829E,0xD8EF6E9,0xCD68268,0x39DCEA6,0xD93EAD2,0xE3BAF1A,0x17C45588,0x16B0582A,0x24EEF83,0xB945605,0x1141B}},
+    {{0x1DC890B7,0x1D60EB74,0x14FC9396,0x19564EB2,0x10F18FC3,0x189A9578,0x10D1F062,0x158CDDAF,0x1CB9FA07,0x1FD26570,0x1094653A,0x86C6},{0x178AE2B2,0x1FDAABFE,0xACF7E48,0x1A82DD86,0x194B0FF4,0xC2C89FE,0x1D5F1F0D,0x19D75CFE,0x18EF0241,0x3C1D113,0x840EDA7,0x1A33E},{0x1E16670E,0x10BCE215,0x737F0F4,0x41695B9,0xC2D960E,0x1B24ABAE,0x1609A504,0xC88AEF4,0x185CF7E5,0x26B398D,0xADA9087,0x1C7BE}},
+    {{0xAA3CE6B,0x187FCA29,0x15ECD899,0x1D8B7CB0,0x1EC2507F,0x1A42B466,0x3141D2B,0x47000A,0x7C409C8,0x1A38F6BD,0x1F071209,0xAB4},{0x18E22E1B,0x3C910A1,0x33271B1,0x1C5334DA,0x14BD9D29,0x18386177,0x1E9D4D1C,0xEF389A9,0x11FF3B54,0x1D99776B,0x39B42DE,0xBEC2},{0x1B97AA3C,0x17C7B334,0x1D1F23BB,0x17F2BAF7,0x7DC36B,0xA469369,0x96C3609,0x3791C07,0x17125DF,0x1A66A6B6,0x162A2052,0x14773}},
+    {{0x2891E76,0x7714AAD,0x1D6BC9BF,0x13501680,0x96A9640,0x1063AF,0x17BFBE16,0xA4A4137,0x117750EF,0x1BB6EA73,0xF3E7DE9,0xA825},{0xB97D64E,0x1959FF1F,0x5D15592,0xC8EDD15,0x7F37818,0x56075D4,0x18D98900,0xF74C5EF,0x1A6549E2,0x66E657E,0x3E1469D,0x18102},{0x19FDA29,0x19C55952,0x6CD5526,0x136F7FDA,0x1B93B264,0x1D04019B,0x198C0FCE,0x13C01AA5,0x31D3B72,0x22E5A36,0x1D3F7B32,0x397A}},
+    {{0x1C226A17,0x18090C31,0x195E057B,0x1946005C,0x183AF9A9,0x2BD9589,0x1C559684,0xF901A53,0x10A7BDBA,0x1C5E9B92,0x1EA67459,0x7E49},{0x1359B7F6,0x1CA49CA5,0x1D45636C,0x1672A56,0x1D51D781,0x9C3C9B6,0xC51219C,0x14ECA567,0x14BD9C34,0x1C76688,0x1EB52BA7,0xE470},{0x1C07531,0x19C1091E,0x182C9F99,0x106956CE,0xDF80F95,0xDAA967B,0x9215893,0x1BB6F2BA,0xC3A7C52,0xFF2FCE3,0x19570DB7,0xF73B}},
+    {{0x189C2C0A,0x1A50B89C,0x1AF23154,0xDF5ECC7,0x146A4E9A,0xF1E9090,0x6327366,0x1E3A4CA7,0x536C4A4,0xACB18B5,0x144410FE,0x70C1},{0x645C017,0xD664F7E,0x1AF32743,0x106D4B36,0xDA9E749,0x7175EE0,0x1A36273E,0x2C38098,0x140925B,0x169A9A4E,0xD8FE973,0x1EFA8},{0x13033334,0x1706A49F,0x10279FE4,0x1E6A89B0,0x1EE4C23B,0x10811ED1,0xB031FEB,0x19911989,0x1804F7C7,0x9A05EDE,0x4AA856F,0x14EE7}},
+    {{0x63021E0,0x20C1F42,0x4797E8F,0x14C51388,0x1AC79236,0x182B4A0B,0x149265E2,0x1F2214DD,0x1294C049,0xAA65244,0xD00BE7C,0x155D2},{0x97DCE2C,0xEDE47C0,0x1DF5A36D,0x17379790,0x16BA51A5,0xFDD0EE4,0x2ED094E,0x1FFB2ED,0xDF5513F,0x1319DCF1,0x13A187CD,0xF4E0},{0xCC3537B,0x10BEDC8C,0x5A568B2,0x10B3CA0B,0xD25646A,0x9FF81B6,0x1E647D0,0x1439EC96,0x19C6F275,0x75B0251,0x1E34460B,0xADE0}},
+    {{0x6C69B42,0xF284F4A,0x1818848B,0x1793A12,0xDA73CBE,0x1CB5579F,0x12198F1A,0x144BBD3A,0x1B4537FD,0x61810E3,0x1892A386,0xA677},{0x332AC3E,0x12CBCD78,0x5BBF6D6,0x1F97E7BB,0x168F10A,0x5D2B666,0x12ED4F96,0x1BB45A7D,0x1C3CED8B,0x36E4D0,0x12F98CAA,0x11EA7},{0x69B31DD,0xBC48858,0x5B50CB5,0x11C2C74D,0xDE4A4BC,0x19D150A0,0x5C14931,0x17C2F2D9,0x13D64C49,0x1742C862,0x1D7460D3,0x1FD5D}},
+    {{0xDDABD93,0x75E047C,0x11886DFB,0x15CF750F,0xC431A74,0x9C92420,0x48E5C39,0xEC3BEE7,0x179CEB33,0x1BBA0D3,0x1BEC3F65,0xAA1A},{0x1134A358,0x156FC358,0x8F39C1D,0x730363B,0x1E2E8910,0xDF53DC8,0x1BB8764,0x53B4E10,0x181C3AC5,0x1BD25B51,0x21A7625,0x11A4C},{0x768D211,0x1B15867C,0x2D34A,0x1FB32A0C,0x191ABEA1,0x3D183B,0x9FC18F7,0x9BB4E1D,0x14485533,0x1847156B,0x1B164FC2,0x13B96}},
+    {{0x8EF20D9,0xB221151,0x78E96B2,0x1F19F391,0x1F1960EE,0x1369047D,0x623190D,0x9010959,0x1C8C4269,0x1C5A62DE,0x1E711C6E,0x19DD9},{0x1B83EFF7,0xD3F9CD3,0x2B66499,0x1F1CEDF,0x1E0CB450,0x670264D,0x1DA375EB,0x1B587192,0x12803EC0,0x10DE079A,0x16013009,0x1929F},{0xBA7C1F7,0x1D5935CF,0x114DEB7F,0x151A2E9B,0xA808C9F,0x193A9A4D,0x140C029E,0x9C63133,0x1C379764,0x928B235,0x1B1129E3,0x1FE5E}},
+    {{0x63D5DE7,0x18D700BC,0x17A5964F,0x17D239F4,0x8CFF278,0xE6F3E3E,0x56EE102,0x2D57738,0x4DCD37D,0xAB6D140,0xD95A0C2,0x15346},{0x1598DB1E,0xC25F1A7,0x12CCD437,0x5839004,0x5EA45AF,0xEB7196D,0x1CA4A163,0x436D01F,0x10F47377,0x16B100FA,0x13FBF252,0x1DB7D},{0x1DB6114E,0x1808C088,0x8FAF544,0xA5F827E,0xBFE9E61,0x8EC8738,0xAD74506,0x16F2C9B6,0x1F82FCD1,0x7B68867,0x108F3D8D,0x4F08}},
+    {{0x12CB50E,0x1F1F85F4,0x161E3394,0x21FD5C3,0x1023AE66,0x56C04B,0x4BAF2B1,0x6C72470,0x457C687,0x2820EDA,0xDB2D4C4,0x9CE7},{0x1A23BAF6,0x1F0007A,0x1F92F75D,0x153025D0,0xA26B4AA,0x340A65,0x11AB1B26,0xDBF0951,0x1623C176,0x525E706,0x65E8897,0x7EE3},{0x19546806,0x601893B,0x174346A5,0x10F8AB24,0x54E572E,0x14119584,0x1065CD09,0xC3ACF5E,0x14F56C31,0xFBEAB0D,0x19EF9779,0x1395B}},
+    {{0x17DD626F,0x889E0B5,0x5490B61,0xC958E67,0xF6AD0E1,0x1B3E7B6,0x612D105,0x4660C28,0xDA3395C,0x7C147F3,0x1A0D4383,0x4708},{0x123DB98E,0x8657C12,0x1352002D,0x2B017A4,0x1E185506,0xD32616D,0x2F99D12,0x14EFC957,0x1C154945,0x14AC3CB2,0x1ED052CB,0x1E9AE},{0x1F696267,0xCE2E2C7,0x578969E,0xF2A578E,0x17B9C20B,0x1723553B,0x1BD78910,0x1D4D9CC5,0x1B2E48A9,0x9B8671A,0x5BD016F,0x19E28}},
+    {{0x3692716,0x1EB9BE9A,0x10F532AD,0x18678002,0x9CE1630,0x1FD57547,0xBBDB1A6,0x14C83275,0x9C1B034,0x145BF912,0xDF0FBBE,0x117E8},{0x9489321,0xD553A68,0x9604B46,0x1958F33F,0x167D1C70,0x126C3361,0x1EC03599,0x1BB4165F,0x1CC68CDE,0x16F99AFD,0xE557777,0x125E3},{0xED58714,0x1EE8DCB6,0x126A23DE,0x5F8D948,0xDD2061,0x5BC41FA,0x7199CFE,0x2FAE166,0x7CC54B3,0x11D9A4FC,0x1A2D2ED0,0x4FC4}},
+    {{0x919BD5A,0x18A0B9A9,0x9CBEE00,0x145FE44,0x3097E77,0x121FE8B4,0xDEEE24B,0x1A7B01FC,0x9AEC7AC,0xDD9CC0,0x1218D80E,0x4BD3},{0x1D2C61E5,0x43F0308,0x89F8DF0,0x119F5CA,0x1EA04C7C,0xCA1B4EB,0xD9A7169,0x13454CFA,0xFB4AA1,0x1D94F4A3,0x1CEAC367,0x10E81},{0x1985A636,0x68B6DD9,0x14A8D148,0x182DBBA2,0x6720BC5,0x1EA02703,0x12BB3A72,0x6C62B06,0x9E42980,0x5B7EFB,0xF3BAFB0,0xD607}},
+    {{0x1B898CC3,0xC2322D5,0x117FF101,0x1B189F58,0xB1600F7,0x9328C11,0x102ADDD2,0x227E548,0x9A8C1F1,0x1668571A,0x17E10773,0xC9C6},{0x1C8E601E,0xC8B6C23,0xE63F2F2,0x15AF6101,0xE4AFA0C,0x12AAFE68,0x19B44379,0xA35C15B,0x189C5A33,0x1ECBE64,0x1ECE341,0xA9D1},{0x1640701C,0x1C59025E,0x12D83A7E,0x2064E87,0x163FD9B2,0x1F0CFC8,0x98C2363,0x54708FF,0x1E988024,0x81C6464,0x5002E71,0x15898}},
+    {{0xED05311,0x17F9B7D0,0x1C017D3E,0x84CD63E,0xD7C6DEB,0x6E2B60,0x4D21C89,0x120C7546,0x97BB1F8,0x7A628E,0x1DC198FA,0x1655},{0x867AEEA,0x138799FD,0x148C4FD,0xCC637D7,0x1AF2CC5E,0x1D606E2C,0x144BB56B,0x1561BAFB,0x1B2C4EB5,0x8CFEA35,0x1CA8E877,0x1198F},{0x1D59E7BC,0x312511F,0x148DDCFE,0x11B63C0,0x1545D940,0x5868C79,0x16C75C85,0x15807AC7,0x1DAA23F6,0x1ABE3979,0x62964E4,0x1E649}},
+    {{0x94B76F4,0x143C085B,0x1B9B75E0,0x1FA0A4CB,0x5C55AC5,0xEF7AF4C,0x131C0627,0x198999F1,0x1713869F,0x1959A85D,0x1074C9CD,0x1FC9},{0x54BFF65,0x7B150BB,0x919B667,0xA817797,0x1B4E2066,0x9830C05,0xD9FF01F,0x7DD7257,0x15B99EF1,0xDB677F6,0x177E5A4B,0x1B9D9},{0xD4F8763,0x6F199FC,0x1C968619,0x6684689,0x1FE17FBF,0x16F125B8,0x17335581,0x111786AF,0x7169D3C,0x1FA0CA1C,0x1393ADE3,0x8656}},
+    {{0x424B328,0x1F5342FE,0xE9C07E9,0x1D1F4E,0x7A08536,0x98EDE7,0x1A9A91F3,0x347FBB,0x118F7B8E,0x1C2AD84C,0x9570E33,0x18133},{0x1A569BD9,0xCE1174B,0x1477C7B0,0x198A545,0x1400FE76,0x91F41C9,0xC95EBDE,0x8345173,0xB5FF762,0x6A76EDE,0xF0E702D,0x156C1},{0x1CA7F5AC,0x1CB1D798,0xFA688E2,0x80DE21,0xB0921DB,0x1929C2FC,0xDD742D8,0x3260B71,0x1C1C759A,0x198F7452,0x1BD9A286,0x11364}},
+    {{0x15A15502,0x1F51EE0C,0x244CB8A,0xDA69D70,0x1A41CEA7,0x1BA363C6,0x1B8F355E,0x10570DE1,0x7F87D0A,0x159503AD,0x697AA1F,0x12715},{0x1D668F31,0x19D4846B,0x134E0A6C,0x9DDFC6A,0x166F7E77,0x1F52FA14,0x561E7E9,0x7CE248,0x3A5E566,0x1CAB5F00,0x4996065,0x382F},{0x11DF79BF,0x93E5FBC,0x1C98D02B,0x12AB937C,0x14A1CBD5,0xD88E0A9,0xE4CAF2C,0xC27F942,0x29DA8F8,0x56A3664,0x10935DF,0x14E5C}},
+    {{0x8D267CF,0x1B67B20,0xBB0C87F,0x1FE73073,0x1233F822,0x9B146C3,0x505385D,0x10B4EEFB,0xEBB8CC1,0x15D8FEED,0x1625E80E,0x1C75F},{0x79AD36D,0xCDFC02,0x4C35F8A,0xFD07571,0x12A0BBDF,0xAC52261,0x8E3AA2B,0x1098101,0x19F77B63,0xBD77D58,0xE6E7E66,0x1468D},{0xB9EF459,0x4D7AF,0x1A7F31B6,0xD2F21BC,0x16ADA54A,0xB4782EC,0x16D922BB,0x14B8A849,0x5BCD2A9,0x1BAE2CA3,0x6C20696,0x1FEB9}},
+    {{0x18901C23,0x40C5B22,0xE9C37CA,0x33644DE,0x13272033,0x1A11FF63,0x1E8C4471,0x931F8AC,0x15A7792F,0x13910FA3,0x5490ED5,0x7040},{0x12D859F0,0xAC5F3ED,0x20270CB,0x1CEA9FCC,0x154EFEE9,0x50A1F69,0x1047D046,0x75D80B,0x6857D8F,0x19EBCE85,0x1942EEC9,0x307E},{0x1EAB7315,0x8D47068,0x6BE17C8,0x13B7009A,0x1F26B91E,0x136DF5ED,0x9FF0B81,0x502354A,0xEE9F43E,0xD6D8307,0x1C657505,0x1701C}},
+    {{0x98A1F80,0x1A98FD94,0x10E41F9D,0x40D7529,0x7BD11A2,0x1361FFF2,0x6CE6FA5,0x1A2BEC9B,0x232F589,0xF9EFC7F,0x1585207E,0x13A56},{0xFEBA277,0x1EAB0C5C,0x1ECA491B,0xC82EEC9,0x135FDC36,0x2AC0168,0xF7E64CD,0x1E1240EB,0x13740487,0xC102C44,0xB9EA6C8,0x10FE1},{0x1FE1F3B1,0x7234EBD,0x3B792D5,0xD575882,0xE425C6E,0x359E65B,0x8F0C7FC,0x17ED619F,0xA82E173,0x18788C70,0x44CE132,0x1BED1}},
+    {{0x2E461D3,0x1346B257,0x604A0F9,0xE8E5A86,0x16FAD24A,0xA02726F,0x19DDF8BB,0xC27929D,0x878FC63,0x401CE73,0xF76E643,0x16389},{0x4E58019,0x175266AA,0x309A629,0x14526D6B,0x17FC5DE1,0x188CFF61,0x1E0CCF96,0x546AF25,0x45E0E26,0x3E120B1,0xD90F0C9,0x28D3},{0xAA1D16A,0x8A45BFD,0x14D9F24E,0x3E0EBE4,0x15F6B9E1,0xED6A96B,0x137E1818,0x11135941,0x32414BF,0x1093561B,0x10303A0C,0xEEF9}},
+    {{0x1B36304D,0x159584F0,0xC7E0DCB,0x1DDE5CB5,0xC5827BC,0x1DB5CE98,0x984E348,0x106CD103,0x513F9CD,0x1B4B5D15,0xFD70C80,0x1B627},{0xFFAF3D2,0x5B0D1EF,0x18560025,0x14C61604,0x17DB01DD,0xBFF0B58,0xC8B36A1,0x11A56CAB,0xB2EBD7B,0xBF5ED4C,0xEE084A,0x1CD37},{0x1A70EFF7,0xFFDA285,0x1099C3A3,0x120FF849,0xFB20B5C,0x6F97DA3,0x1D0498BB,0x3A64279,0x1782077C,0x1909E2E0,0x171B3C12,0x156D3}},
+    {{0x175722B4,0x62D2DFC,0x1173D7EB,0xE6DDE18,0x1BF7812D,0xD3598A2,0x17EA8CCA,0xE14E8FC,0x16250A89,0x150433CC,0x928C2A9,0x1CD52},{0x775B13E,0x78BF2A9,0x174DF5F,0x1668C2CE,0x1CEB50B4,0x1CF7D2C,0x16C2F7A6,0xE1A79B1,0x70FED2D,0xC54D79A,0x179991D5,0x7681},{0x92B6AE1,0x86508D5,0x96D96BE,0x52D4460,0x1B4ED001,0xCE210CE,0x46CB044,0x16A58176,0x268B415,0x14091C06,0x13D11168,0x14B83}},
+    {{0xFC41D51,0x1267A3DD,0x18C93CE3,0x19D30C09,0x190A7A13,0x7C2A5D7,0xE152E1,0x1A6B1894,0x158F7F79,0x12B49A43,0x15CD1860,0x12237},{0x1A579EB3,0x170962EA,0x2D7BAA9,0x17CC536B,0x196A87CA,0x10C14744,0x8908B5E,0x14C0F096,0xEC9BD2D,0x1D681B03,0x1A845E42,0x939B},{0xEF51925,0x8BD36CC,0x1DCF8C54,0x183F979,0xB7CDC34,0x2B9EC61,0x5758A75,0x1B68AB98,0x21F9F2A,0x8AFAEBB,0xE859CD4,0x9414}},
+    {{0xD056D8D,0xDFAF0D8,0x1173771F,0x48F7BF,0x1AC1D703,0x5C6F7A2,0x1530572A,0x1F4845E4,0x1A448229,0x4E0A0EE,0x195480C6,0x1BCBD},{0xCDA64DD,0x5DD1C5A,0xA1A1FBE,0x18CD9CB4,0x14024E9A,0x646284D,0x83C9ADC,0x132D0C7C,0xCF9511E,0xA3C0BFD,0xBD6D4FA,0x16081},{0xCD79D22,0x11AFCBA6,0x19D89E3E,0x15316CAD,0x11A20404,0x158EA242,0x136B6056,0x1BDEF82F,0xBFDEED6,0x1325D666,0x1A6B2E0E,0x1C0EF}},
+    {{0x199E940F,0x3D1A727,0xCE8ADAF,0xE0FD3BF,0xDE84FC3,0x1070234A,0x1F48A62F,0xAFD3AA,0x12D8205F,0xA860985,0xDB12EC5,0xEA6C},{0x1D026080,0x16140AF1,0x9F5FAC8,0x19102CA6,0x1A05D449,0x7980997,0x7D24B14,0x1F56DC00,0x16FF9FA3,0x9A64FDB,0x869EE52,0x1A8BC},{0x16C9757E,0x9972ED2,0xAF75C,0x5E22693,0x15244834,0x18E85CE6,0xB315175,0xE1418CD,0x127CB360,0x19E3A31A,0xED65EB5,0xB1FE}},
+    {{0xD5F7EAF,0xDDF6393,0x1BDDB0D9,0x4E76648,0x88325A1,0x362046E,0x3059C63,0x1ADBD98A,0x13021885,0x10840DD6,0xBD189DC,0x4267},{0x49F7765,0x15ACA719,0x1508848F,0xE082636,0xCC16FB1,0x14156068,0x366A1CA,0x701ED,0x3EA30EC,0x8F46E93,0x1AE333CB,0x1BF01},{0x19FB6863,0x1B636FD1,0x17689260,0x1F51D461,0x1E03BEB2,0x75845F7,0xCE5743E,0x42F9257,0xB6FF169,0xE7FEB1D,0x196BC324,0x99C9}},
+    {{0xCF7F1EE,0x16EA166F,0x2266C76,0x12C83C74,0x2016087,0x13282C8F,0x3EB3B52,0x28E6C6B,0x1A6B47AE,0x1BFACE1,0x1BD3F28F,0x19B09},{0x1ED57F1F,0x154A95CF,0xD505195,0x245CEF6,0xC052EA,0xEE821A4,0x1F91EDC6,0x1C16CBCC,0x11E224C6,0xB49DA60,0xE3137D5,0x279C},{0x146732F2,0x1BF3ED96,0x1E4F4B07,0xE181CD9,0x2CF4F2E,0xCA5D5D4,0xF6D48B0,0x54A0348,0x195D878,0xE2BED71,0x88B9635,0x102CF}},
+    {{0x1EDB4F4B,0x163414DF,0x1A4380C6,0xC8947A5,0x13BEB3E3,0xE4FD282,0x15E71A0A,0x18264CBE,0x1C8227E1,0x1FE38369,0x8E70E65,0xACCD},{0x1DCF041F,0x1659DEF3,0xADCF7B5,0xB92F676,0x14BCF4DB,0xA4E7380,0x1590018A,0x1F091EA0,0x14599B0F,0x8CF850F,0xBA6FA45,0xFAFD},{0x14F6CCDA,0x1B71FBCC,0x530AD84,0x27882A7,0x5957BC,0xFEF56C2,0x8631A73,0x8A7FCD9,0x1295D64,0x176F0C7F,0x29AC562,0x10CF3}},
+    {{0xBE951CC,0x4A0CCEA,0x3F3C80C,0x1E259792,0x1D70596F,0xF97859,0x93CCA81,0x10C40874,0xACFF570,0xAE8708C,0xA8BCCD8,0x1F83B},{0xAB93743,0xDEA601E,0x1107DE1,0x9629B44,0x1AFEA0E6,0x17B12D2D,0x9216691,0x15256E53,0x12C6D684,0x180ABC0,0x16292C22,0xC05D},{0xAA77FC1,0xE81456E,0x1D3701E0,0x277731A,0xBC5E3CF,0x423168F,0x148FF5E9,0x1361DAEC,0x50D34AA,0xC2DA775,0xB0AF1AC,0x1108A}},
+    {{0x1EF39390,0x180C83C8,0x179CFE46,0xD332C0B,0xF04431F,0x928BB71,0x11E29958,0x87BB8EF,0xF7EAB13,0x2661321,0x1DEDCCA2,0x108DE},{0xA4BDB0,0x61903DD,0x191B1DA8,0xE65F7DA,0x1C4EA0C1,0x19A4131C,0xCAC834E,0x117B5586,0x3563B6A,0x13F9264,0x1D7BFC0C,0x1EB34},{0x10153C0B,0x43E0867,0xC145006,0x15AA126B,0x140FEB81,0xA024B98,0x10DBF17A,0x1FC3E5EB,0x6D54871,0x1711AE6F,0xD12E2F1,0x1AAA0}},
+    {{0x14D2BE47,0x802F020,0x9A2EF0A,0x1C17620C,0xC7421EB,0x1A6642C2,0x15E774E5,0x933CEA0,0x1917EEE5,0x1692A2D4,0x10AD49AC,0x1F9BF},{0x124F9FC2,0x53DC0A2,0x567E0C5,0xB8E15EA,0xF928748,0xC0F932F,0xD4166A3,0x11CB3958,0xFB4DECC,0x119517E,0xDD03C48,0xF946},{0x106BC66,0x3D8D8C3,0x122C17D6,0xD4F64B7,0x1A417CBC,0x6A4237,0x1392FA69,0x1FDE5AB2,0x10553517,0x18670F21,0x10038D26,0x13395}},
+    {{0x153B9D52,0x126F2C1B,0x360790F,0x1465D1FE,0x13068A16,0x19DC7FA3,0x16E599F8,0x2A21401,0xF25EA1D,0xADF850,0x1CDC1B2B,0x13F17},{0xFCCDBC,0xDCE6D10,0xB2C1D26,0x1141BC58,0x18FA6E42,0xA1C6E82,0x192E42A4,0x1B5A3D66,0xDB1EE1D,0x8D21858,0xD0E968D,0x259D},{0x360E187,0x7838396,0xB84F1E8,0x14F98A96,0x28E770D,0x1E9D5E6A,0x4A9060D,0x13195051,0x8787B2D,0xCEB7FCB,0x568822D,0x45}},
+    {{0xD800BC0,0x174B2580,0x1A4708A6,0x1761A80F,0x915C3C4,0x1C9BB20B,0x1AE07014,0x1A808B8B,0x1BBF7E4,0x1013B5EC,0xD998CAE,0x32A0},{0x15AE1838,0xADB3BDA,0x63A8814,0x4A5ED20,0x190367B5,0x1771D092,0x18DA4559,0xA293B33,0x27B9917,0x10C7841D,0x1BE533AD,0x39B},{0x1ED83120,0x5A610B6,0x91043E8,0x1EFF7F2E,0x1182F8E6,0x1694D18E,0x3BB3753,0x197E240A,0x33BA14D,0xD56D401,0xBC13FD2,0x17F5F}},
+    {{0xD633C4B,0x1E640910,0x184139CF,0x1527AD71,0x1AA7A5E0,0x30470DD,0x1AF517D,0x1E4026D7,0x831F5E0,0x63C3E4,0x466E7E5,0x11FE1},{0xF14F80F,0x1E3F370A,0x1AC756CB,0x2C3698,0x13D2D8DD,0x1E5C940C,0x14CB8E93,0x5C84489,0x1DC3ED11,0xE622E6B,0x6252125,0x1DBB8},{0x1017941C,0x62F16AE,0xD6E350A,0x843B628,0x110F214B,0x17CCFC01,0xDC8E39B,0x2E7A49D,0xA537737,0x1B6D4178,0x1FA3F1CA,0x1550}},
+    {{0x1CCBA284,0x5327AAB,0x1314AC79,0x10A4836E,0x1372881C,0x131BC51,0xF5ECACE,0x18E8B3A1,0xC903844,0x1B511460,0x18EEED66,0x29B9},{0x103A90E6,0x17489697,0xCC8341E,0xAD0F35F,0x181F8DB2,0x76D0DDA,0x5964E51,0x1F4B1736,0x95A6F0,0x7E63E3E,0x11052C69,0x5366},{0x50509ED,0xD09D5B7,0x1C281274,0x7DB5902,0x1843CB9C,0x1C1C7083,0x99C39F9,0x4969631,0x547E3DF,0x202E27C,0x13EE6478,0x982B}},
+    {{0x1DEDC765,0x81E136C,0x10147BCA,0x1E98EBC5,0x587E1E8,0x1E9A2B0,0x186842B8,0x3AE0A05,0xEF79A07,0xBF40B1E,0xD815E69,0x1F0D8},{0xC008E91,0x14DEE5B3,0x1699CC8A,0xE70FD32,0x1715C843,0xD7E25EE,0x1824EED1,0xBF8E982,0x131B37ED,0x9E5C675,0x11A8EE1D,0xA9BD},{0x1167AB55,0x10658CFC,0x170EC7EF,0x8975388,0x1E5D2938,0x142DCF55,0x85AE879,0xF1732BA,0x1D510B33,0x173C8ECE,0x817F073,0xF796}},
+    {{0x4FBFF0A,0x108A4511,0x10DFE6AC,0x1D42D31E,0xFA365AD,0x4FC1552,0x192F36F,0xE4C6885,0xE9E49EC,0x1B40950E,0xA8DA0C9,0x4E9F},{0x10505C63,0x27BBA61,0xA1A00D0,0xFF0FE7A,0x990A18B,0x2A015D3,0x9B473B8,0x93C7B01,0x162BBAA7,0x3E417B1,0x123C2411,0x5390},{0xCB13234,0x17B196C2,0xBE00EA0,0x1989AF2D,0x1115BD26,0x9A9193,0x1222CF3E,0x15DF2F98,0x1B4A30AD,0x63772C4,0x14F14E8F,0x10433}},
+    {{0x35DBB6C,0xEDBA204,0xFD6B551,0xCEA1E0E,0x1FA37566,0x154B1D21,0x152EEC1,0x3A43E6E,0x1B88BBA6,0x315278B,0x513A787,0x13E1},{0xA6E7B97,0x222B17D,0x6466E70,0x35EBE02,0x13EEB54B,0xDEB2F96,0xF2FC306,0xB01F73,0xCC37202,0x8FA274E,0x8D8D62E,0x1E2DB},{0x2918101,0x104031FF,0xC49C9C,0x14998685,0x18D18071,0x12652E86,0x8D28726,0x829F488,0x5166F30,0x1F660D60,0x120CB6CC,0x1BB96}},
+    {{0x59905FD,0x16CAABD3,0x107D0EBA,0x1E542D86,0x1F5C0F30,0x90A75DD,0x48CE5C6,0x798DAF2,0x15E39D27,0x6C9BDAD,0xCFBC3AD,0xD84A},{0x1714B3A2,0xE70AF9A,0x1680A01F,0x1F45D03,0x10AFCBEC,0x42B26B0,0xE7983D5,0x3BE7174,0x1176D97A,0x1D380EA1,0x1F79F5C1,0x4AD8},{0x7B4966A,0x14C643FB,0xA360831,0x10B851A4,0x11513F6A,0xB93FA31,0x1F79526E,0x17271787,0x1199743D,0x1C1B7AF,0x129274BA,0x13FF}},
+    {{0x227E03B,0xE9DB85E,0x1CE62C5,0xFE9C921,0xFFA093B,0x453B8E6,0x5E872FA,0xA49A66C,0x4DECB1D,0x45FB1AD,0x1FCF41C3,0x2588},{0x1274ACE2,0x5054311,0x138FE82,0x8DA77B4,0xED3CCAC,0x132AD0C7,0x1F15836F,0x10E25891,0xE544274,0x13DFA910,0x6F246D4,0x12CC0},{0x17D45821,0x13F7A3F7,0xD88B815,0x1E362352,0x1861003,0x1C1A0599,0x1039ADB,0xE8C3F5,0xE6EBDBD,0x17A400E8,0x681E7F5,0x18A9C}},
+    {{0x1DDC335F,0x10106680,0x43865B0,0x102AE851,0x192DBB0C,0x1CD17075,0x8D09F15,0x49F168B,0x59C66F1,0xBFF3F5D,0x19F78B7,0x489},{0xF0863A6,0xED1942E,0x13CB23AC,0xDB6D17E,0x1016D16D,0x1780B334,0x2D4D3DD,0x187F53F8,0x1681D630,0x2E296E1,0x6A26014,0x162EF},{0x4F458CD,0x1DE6EB82,0x3BEC120,0x4CF272E,0x1244D84F,0x1FB9DBB1,0x6274DD6,0x931D071,0xEBF5CC8,0x9DFA6C4,0x18D7BEF4,0x3705}},
+    {{0x102207BB,0xFE89674,0x6DA8721,0x11AE2C30,0xEB93579,0x10780C8E,0x55BC26A,0x1005C267,0x1EF16F77,0xA428EA1,0x835B09,0x1A970},{0xE127F3C,0x664E3A4,0x297EB13,0x1A92B375,0x754C7DB,0x15D945F1,0x1F02B04E,0x19B1EE57,0x1A0EBB53,0x1DF08696,0x13CD0007,0x2DC5},{0x1EF35E10,0x115EF285,0x6CC682B,0x16131F93,0x1D48E49E,0xFC57D10,0xC0F3659,0x129D6B8,0xEAFD570,0xB284F36,0x1CF5BEA5,0xA6E6}},
+    {{0x4AF327C,0xC8B67DC,0x1D440E5E,0xC28FB2F,0xCDC409A,0x1BC9BAAC,0x285D7C5,0xC57C0C5,0x1EEF00EB,0x1D3F78CE,0x2618B29,0x1EE70},{0x1ED793CE,0x1BE50A36,0x49C53F2,0x16E93C70,0x7BD2CFE,0x96A7D64,0x146EDC42,0x10271276,0xBCBC76E,0x17F08E1C,0x996162,0x1E56F},{0x14A74DB4,0x3750092,0x5DAB50B,0x994E4C2,0xE04BE02,0xE4E4DA6,0x1192FBCA,0x129659F2,0x1008743E,0x120DAF9E,0x107578E1,0xAEB5}},
+    {{0xF9B191F,0x19459621,0x1A71D253,0x1DE50609,0x1B96BA82,0x18F37AE4,0xF0302DF,0x17BC469F,0x1E170ACD,0xD7AD32,0xF1C0CE4,0x1E423},{0xBDC7FF0,0xF28A9B6,0x1DF5D434,0x379DABD,0x17C02284,0x17C692C,0x112AEB8E,0x16E74691,0x15CF41C,0x1FBA049F,0x75C0D2,0x13EA8},{0x63E1AA9,0xE96B8FE,0x1F0D6584,0x1AA888FF,0x1C8591B7,0x1943D230,0x116B79F0,0x1AF9EED8,0x1EF70979,0xD591C81,0x1DAE82B1,0x16764}},
+    {{0x14827D54,0x14F2E45,0xFC409FD,0xB86AF78,0x12431FC9,0x15CE5B4E,0xB9B54B4,0xA9AD1E6,0x738668,0x1ACA47E8,0x363AE46,0x8C52},{0x12D07C71,0x123C0579,0x192A125C,0x1ADFE6ED,0x10CD49FB,0x1F41540F,0x124CF2ED,0x17976D75,0x424316,0x1D9A566D,0x1854AA59,0x5041},{0x14495297,0x1BB63BC5,0x6E6E065,0x1A7A852A,0x4C06A85,0x10600E2D,0x195E7632,0x65B25CB,0x1C48D9BE,0x1A5F2F3A,0xA438B11,0x19C88}},
+    {{0x72F6F4E,0x61B8F82,0xFED5024,0x1C5DBDB4,0x1ACF9BFD,0x358BE3C,0x4FA850,0xE6B957C,0xDC1348D,0x8C8D50A,0x123515EB,0x10B08},{0x1373E70C,0xF9E9532,0x37ACFB4,0x184CE0AB,0xF81228B,0x1ED02E58,0xFAE98ED,0x285A50F,0xAE72E99,0x188E9D5B,0x13521117,0x9EF8},{0x34F6695,0x8B45F32,0x1A5132F,0x77C7EB2,0x8E09ABD,0x1C84E7BE,0x60F3C20,0x1EF3CCE6,0xEEAE713,0x7F82335,0x1A1BC886,0x4973}},
+    {{0x92934AE,0xC091D08,0x426AE6B,0x1F586960,0xFCED505,0x7E9CE2E,0xFED9BC5,0x1A15643D,0x15BA4FCF,0xBF3DDBB,0x714A1B5,0x5903},{0x310C51F,0x11E58D74,0x1690B1D9,0x9C74EC2,0x1675F776,0x196B35A,0x1E3FFCD2,0x1E41178B,0x1F984095,0x1A5C9DD0,0x89C9ED0,0x153EF},{0x14924E4E,0x1259045A,0x661D146,0x1F775EB0,0x5AA8846,0x1084A9FE,0x1C39B8D5,0x12893BBB,0x98A2826,0x1303D911,0x143B23F8,0x94BC}},
+    {{0xFA7230B,0x1763250A,0x430A835,0x148F430B,0xE05BED1,0x19A44BE3,0x5D0DC05,0x7D7918B,0xF0E744,0xC8B7F42,0xA44314E,0x428D},{0x49AAA5B,0x1452EA9C,0x102DCF06,0x1F4E11EA,0x1CAFBFAD,0x1C1EA5F7,0x5C149CD,0x1AD3358B,0x13D5D907,0x1F873B81,0x10D51EAF,0x1C765},{0x12A213D4,0x15C16F0A,0x21544B7,0x3D2A1C0,0x1DA8846C,0x1EB63D0A,0x1D78720B,0x2E020E0,0x11971729,0xE816DE3,0x1634AED5,0x16C8E}},
+    {{0x12F7B3FF,0x1606296A,0x1636448B,0x1BA471C8,0x15A6D361,0x1762422D,0x1C9B8F36,0x19A89F26,0xE020DCD,0x6EB30ED,0xF68814A,0x1A52F},{0x1A2806B3,0xFE6CE1E,0x861B6DD,0x1F1C19E3,0x12F39C0D,0x57B5279,0x9E13F4,0x4FD4BE0,0xB85A874,0x140A6B62,0x1F5663F4,0x1E412},{0x19A83833,0x1D05FFD7,0x1B8D504,0x19F1E5D4,0xDB3CB,0x199D677D,0xB0A4A99,0x14025000,0x1CDA217A,0x2443612,0x7636EEA,0x1896D}},
+    {{0x7DB1F4E,0x1515C742,0x1D2923E6,0x13637821,0x5C34FD4,0x196BFFF0,0xA23A1CF,0x5B89DBA,0xCFC2C60,0xA9E2E05,0x8DB292A,0x2345},{0x1594114,0xA09B93C,0xB58EB6D,0xE921434,0x56B6470,0x19755A48,0x187CD120,0x55334ED,0x11905A33,0x54B84DD,0xC80F180,0x15428},{0xD9323B,0x3F1FE29,0x1E243345,0x1E7B5BD9,0x6991FA8,0x1A1FC638,0x1BBC4098,0x1EE6DF36,0x1F011094,0xFDEA751,0x7BB16BE,0xD157}},
+    {{0x11D736C3,0x8C45A5F,0x3761804,0x10BCFD3E,0x1E6A229F,0x1796D6FC,0xC12D6FD,0x160BE7B8,0x155D2FF2,0x143692FF,0x4FEF678,0xCEF6},{0x48C113A,0xE3AC637,0xDEA9211,0x1A9B7213,0xEBF1BD5,0x1FADB995,0xCA49707,0x160037B,0x8B360A,0xDD45E9A,0x105333AC,0xD732},{0x1361DDB4,0xBA3BD0B,0x1DB21DAF,0x123D0AB4,0x164932EE,0x1A1E9FF5,0xA839653,0x3B5D824,0x156609B9,0x18C48BAA,0x64EF4BC,0x19385}},
+    {{0xA5D316C,0x1A9E6197,0xB0AFF6F,0x8FA76D5,0x19810851,0x1C964A13,0x15B3FED2,0x72AE958,0x80EF6F6,0xC61781E,0x135E5F28,0x1511B},{0x17F737BF,0xEB8EEAF,0x14FA2191,0x14BE7215,0xBF35DA1,0x16711290,0x3A52B3B,0xCF2975D,0x4F7CE69,0x6C236DA,0x1238AD79,0xE501},{0x15E93DCE,0x1B1F9FDD,0x1D4CD,0x11B4653A,0xB124244,0x1D1A9922,0x17C084EE,0x1942CCB3,0x18F25A8B,0xEB8E073,0x135924EE,0x55E1}},
+    {{0xACF5430,0x7E467FE,0xEAD0497,0x14EE465E,0xC5ED6B3,0x11C55CFA,0x4D8B485,0xFFA3019,0xFDA0747,0x1ACE7297,0x73F309A,0xCBA2},{0xEB72482,0xF930E1C,0x1DDF1BF6,0x1635D0D1,0x8372C35,0x6A414BB,0x6C24AF9,0x1B69F032,0x4ED2104,0xACA3DBE,0x1D06340D,0xDC2D},{0x13AAC882,0xF62F436,0x17297B77,0x153786EE,0x13142C48,0x17A338FE,0xF5DBF1E,0x1292EE22,0xD9C4DC5,0x16EAE295,0x16C50053,0xAD36}},
+    {{0x28CB47B,0xA438646,0x10FBE561,0x1C31B0E3,0x1A76CBE2,0xA629E58,0x61807D,0x1597924,0x9D9FE7D,0x1CFCF553,0x469B59B,0x682F},{0x1BA63F48,0x19A2A5B7,0x334ABEE,0x15AC2068,0x14C4B593,0xFAD02FB,0xF033552,0xF4534AD,0x5687A35,0x470B4C8,0x1E693E3F,0x9D62},{0x13829FBD,0x1D66B0B1,0x2BFCA8F,0x1BC1680A,0x4E093B8,0xD29BD77,0x580DA52,0x104DEE7D,0x1B38BF56,0x7244554,0x1B228F56,0x17B67}},
+    {{0x1D8D83FD,0xF444562,0x1EEE5D23,0x1A2DDEEF,0x1FE1C70,0x11FBA14,0x1DDC5ED3,0x1C5DCDDA,0x679D51,0x1295B97C,0x7F0C905,0x1F202},{0x1C49C758,0x3A04D2E,0x1CA8597C,0x1E60F557,0x10C9C015,0x1FFB73F2,0xE80C038,0xEDAA311,0x130AE981,0x620AEB9,0x10EFD6F7,0x25E5},{0xD94F8C0,0x11856D8A,0x144F5DF9,0x13D5677A,0x1073376E,0x19481296,0x8D355BD,0x13882B65,0x1A56A41E,0x19C0D49B,0x3EB9862,0x19795}},
+    {{0x1CEFCA35,0x1612B752,0x15288B57,0x1CF9CB6D,0x13995379,0x1BBD4AE4,0xE25D1BF,0x1D81F8AF,0x135C741,0x11F91978,0x1A9D6A84,0x6A8E},{0x14FE8501,0x13B9B827,0xA8DAA9D,0x8F29EF,0x541C789,0x14823EEC,0xFB918B1,0x1A90420C,0x1E2A1E4B,0xB8432D9,0x25DA0E1,0x7347},{0x50CEA84,0x18704685,0xD478AAE,0x1388EF35,0x93E6A13,0x11A09E31,0x1E653614,0xC339BE2,0x839CAD0,0x495D73D,0x1E2D3484,0xAB16}},
+    {{0x513C523,0x184FAC69,0xDB29C4A,0x5739FA2,0xD035CA7,0x1C6C5088,0x18AD2790,0xD14AD60,0x1084AA9D,0x4F2770E,0xFC370E3,0xAFBC},{0x39DA919,0x1B1E532A,0x6A1986A,0xD6DA223,0x88AE68D,0xD439EC9,0x30793B7,0x1D60713,0x942684A,0x1246E6F4,0x6DA8638,0x161C4},{0x1C640856,0x16F796C0,0x1891CC30,0x44190F9,0x4758E7B,0x1A0C4B18,0x15FF5344,0x1DBD8964,0xCFDCD45,0x2BB4967,0x10C83AE1,0x9300}},
+    {{0x1BAE6AB5,0x3FA5540,0x3EAF1D4,0x30D37DA,0xAB5177F,0x9892A1B,0xC30E9CE,0x147BFF5C,0x19E9E23D,0x6F0BC52,0x1FBEAACF,0x14D5E},{0x681CB7B,0x15511195,0xBBEBC0F,0x19DFE8E3,0x589AD67,0xEF59E8F,0x2388B83,0x1563D835,0xD2774A2,0x10D53EEE,0xBC0C250,0x125B1},{0x1E89CB00,0x1406FB41,0x12B7C862,0x1F846D7,0x1EE41A15,0x82A0FCD,0x1FB01E21,0x10DCE47F,0x151A02FA,0x45EAB08,0x19AB6673,0x1083D}}
+};
+/* End of comb table */
 #endif
 
 #if CHUNK==64
@@ -51,6 +144,99 @@ const BIG_336_60 CURVE_B_HIFIVE= {0x2B67L,0x0L,0x0L,0x0L,0x0L,0x0L};
 const BIG_336_60 CURVE_Order_HIFIVE= {0xB2F95973E9FA805L,0xC0BD6B87F93BAA7L,0x71415FA9850L,0x0L,0x0L,0x200000000L};
 const BIG_336_60 CURVE_Gx_HIFIVE= {0xCL,0x0L,0x0L,0x0L,0x0L,0x0L};
 const BIG_336_60 CURVE_Gy_HIFIVE= {0x2BEC68505FE8632L,0x5D5650CA0365DB1L,0x3811C7EF435B6DBL,0x7853D1B14B46CL,0x56502E18E1C161DL,0xC0DC616BL};
+/* Fixed base comb table for ECP_genmul - generated by scripts/combtable.py */
+const BIG_336_60 CURVE_Comb_HIFIVE[88][3]=
+{
+    {{0xC,0x0,0x0,0x0,0x0,0x0},{0x2BEC68505FE8632,0x5D5650CA0365DB1,0x3811C7EF435B6DB,0x7853D1B14B46C,0x56502E18E1C161D,0xC0DC616B},{0xF14E3C47EE4A58,0x600BC97828C644E,0xA0D55F372849248,0x5A3EDD44F87512,0xBC2292A951095C,0x90A549108}},
+    {{0x165E0D5F6BA573C,0xA3E1C9E77FDD389,0xDF0CAD2947263B6,0xA5A79E2496689E4,0x71673A725C2B2FE,0x75F40C30},{0xF4393A7DEFDD246,0x34C2B70464E5D27,0xD59E8B0E86219A7,0x7A59601A765B9E6,0xE8F16614FC4BDCF,0x6583D57E2},{0xF473D38E7144CF1,0xC60DEED4C7A4541,0xCCEF381650CBCBE,0x3D21ABDF893C546,0x1D885D79CF26619,0xB96B07830}},
+    {{0xBAC9C2035B1D394,0xC9F5EAA9CA22B33,0x70B208FD4A79178,0x2092E15ADEB48DC,0x9879B86A5E0ABAC,0x4A495B33},{0xD7BB7B5C46038AD,0x4A3826791C20D9B,0xA79B1A2EB2D4FAF,0x9891B3C676D1265,0x49D4530E8043AAE,0x1FDA0083C},{0xB31D8DA38FEB617,0xD54678FE9FEADE1,0xDEE4C4F4B712BBE,0x2C58EADFD159D4C,0x2932C84FE274624,0x103867CD2}},
+    {{0x3D70B70DF77D6E8,0x9773BDBDEF2CD38,0xF7D44A1C7565289,0x8AD5D0FAA467CFC,0x574BA4F7B0D63E2,0xA28D7EDCB},{0x50CB255CA45346B,0x3E0DF49BBC4ACD3,0x5F4A6621D41DFB4,0xC453C708C5CE55E,0x1462E1AFECFA485,0x59E9987D},{0xCDB422122FA244B,0xA552EFBFDFDF92A,0xCB32BEF64B803A1,0x97A765058AC4551,0x2BAC28FB9BF9464,0x789E72C37}},
+    {{0x242E9CDC3F4AF02,0xB5F9E87CE4E813F,0xC212AB42348498A,0xDCA4AFD63EBA771,0x95776C7262846ED,0x3E05B7648},{0xB0ED3252362EB1F,0x99EE8685B97B500,0x74E95B2F75CBCD3,0x3954705147DD045,0xA676BFC12DE4AFB,0xA61E69FA8},{0xFE9AAC926B42993,0x6E176EC35B75C4F,0x3A5230D26CEF60D,0x1EEDBCA8752C0A8,0xA719A192DC7E5AB,0x8352806C5}},
+    {{0x9275DD27575FE84,0xF811EE5481FBFE,0x2E43AF7C5701717,0x68A950AC42D5D5C,0x3BF1820BBC3D3EF,0x6658013B},{0x7C054F5D678E475,0x7EFA7CDB6C603BC,0xEEFFF3914BB41A3,0xA4C962C61C1E5BD,0x42B40972430D975,0x58C473026},{0x20DA932E7761173,0x26ADE4828539431,0x20CC9076C059F5,0x819583652EEA26B,0x7979F2D37F64039,0x257348ED9}},
+    {{0x12A3FEBB953C343,0x229000849B879BC,0x6AF48CD6B9E8BD0,0x918A25E05BE2147,0x44CCF84CC50DC7A,0xF59C7C63},{0x6580E3089B7B28,0x7AE847BAA2AF024,0x5E9091EAC3D495F,0x439B0A217B9BC9F,0x19B66026CA2DDAE,0xEB4B7290F},{0x5B2B076A6D63CF9,0xED37B467003B93A,0x24F98889A46E29,0x6CF3FEBCB414A9E,0x6B7A69771DC1BD,0x138B3613A}},
+    {{0x497EADE900047D6,0x7E344C4162C9400,0xF6CC121E2713DB4,0xD1AAA38A2433076,0x23BBE5A13E4D101,0xD9E615E4B},{0x6DDDF93EEB9409B,0xD06BEDA7D7A2505,0x6D19CA9C5984609,0x6D5C685710AEBB1,0xD738B55C42AFE4E,0x8AE60C7},{0x483B78EC415DFE0,0x79369CF243CE0F1,0xC6AAAC702E5DE90,0x5C9C3EB9E7FDAA5,0xFFBDD2AFFD08B1B,0x17A03EEF3}},
+    {{0xA39FD1EA8AC36E6,0x3BE42BA720E48CB,0x7B979A1AC28B259,0xAF7CFE8D2CB712A,0xF54913B63E586A7,0xC7A1329EE},{0x2BAAE698578D79F,0x3A457869E0E3BC9,0xB9D5EFAFB51FC18,0x60839394AB806EC,0x7A227380F913DA1,0x5F9D0D08B},{0xB630F16BFD977D1,0x63139D0900E5C4F,0x6279CD846763018,0xFE9135DF5E31182,0xF0CE315433EB3D1,0xC0DE305F0}},
+    {{0x75B08235FC33E25,0xB28825F4F30DB28,0xB7321D0863360C8,0xA3E4A2A1D0791AF,0xB60F8A80600B3E1,0xAD97D8E2D},{0xAC587F650540E96,0xABE1437F66D6786,0x22A8EA5357C3349,0x8EFAF7A141C78F4,0x8360880E2BCD42A,0xDA700D614},{0x8E0445F369EDB28,0xEB19EC339234125,0x3DBBE69DE2F3156,0xC28C21684489D0D,0xD82764E9B2FE295,0x815051E37}},
+    {{0xD7E74B3EED29E78,0x74E2F52B0F18A39,0x8BF450B29AC7EE4,0x5BD8AB6509ADB29,0x39F83D55692D8C1,0x8C2339A9},{0xF44FA62EDC7B22F,0x273C595D62D0083,0x18349EC018231D7,0x374FE8F6FD788E7,0xA671AB7EACC7A80,0x4D0F80787},{0xAEA75CF1446380E,0x3297776CD080F9D,0x6F11502BC16B002,0xCBD3B3197C5CE1A,0x5A6F8E75ABF654,0x36BFF168B}},
+    {{0x4ACF12AF49041E9,0x34C92FAD2FD9906,0xE34C5568CC11FED,0x368CED8AF520BB7,0x5F9A93DDA244386,0x46EED03D7},{0xBC96B1ACF60E399,0xF69F93BF4A7E6FF,0xCD89A573E505C4B,0xA4DF856076EFB1B,0xF09AA1C12078E2C,0xCA3C19C3E},{0x5219CFF74422300,0xF286B4436EC930B,0x43FF2B2E29EB4A,0xA3CC854965CA4DA,0x7B4904357A402A7,0xD3E8C23FB}},
+    {{0x381924B49904480,0x8D9049C8E9B12BB,0xE33C08D017510EF,0xAB8EF256391EB86,0xBE6B85FA0F63FCA,0xA2AE9FBCE},{0x89C3657D26E33D5,0x106CC46B5260838,0x6FB796048D07D9,0x8275822FF849C8,0xB7CCB0A1A680A9,0xE323B4D72},{0x56BEB38D5DB4F51,0x32D3E4182532924,0x4AA02CBFE2BC8E1,0x4EAFB5EAE0118AF,0x42BBC5CC268E3EC,0x93216A133}},
+    {{0x730391EB13C000E,0xFF6411CC035A8DD,0x1A28A97EC32540,0x2E2762F83338764,0xCD4B7E683E76716,0x1EED1A3DD},{0xAD22D035DA377DD,0x94EC36F560C17FC,0x4D228FD72E9A4A3,0xB5CC6D8E2F453DD,0x93A22529EDCFC90,0x57815D33D},{0xD6EB81C96ED67A7,0xDB5EE55985658C1,0xD54341ACE3E602A,0x9A2C5271E4CC26F,0xB4C2581A69866B3,0x66918B948}},
+    {{0xC976FDC4E5C11FF,0x5CEA1443D91FB29,0xF3CF492BF8F857A,0x7BF7BC98258B3B7,0x89A4B98A4208602,0x46717DAA8},{0x9B17060260A70B3,0xFC7DE18E66AB65A,0xF999D50ED2AF94,0xA17C3C00125E3E1,0x332C2D567B8594,0xD031D88B6},{0x8C8D61BC5940B05,0x48F3DF732A6222,0x9090BFD5C3B56EA,0xE6000C9B9636AF7,0x44E90C0F356C47F,0xCA230FE61}},
+    {{0xE1BEEE253F2138A,0x4A6AAA31317D2BC,0x6FCC7DF09A1524B,0xB0E41B1A3EB9C5D,0xD73D910A8313620,0x5291CD7BC},{0xAE46B702A955487,0x962801A976BD413,0x8A190AB0EF87ACD,0x8895EB1E5BB21C1,0x396903633C64640,0x4F502783D},{0xEEF86432B771649,0x55FEB2CFC07467F,0x9C9CFAB0CC0A475,0x2C6D4B63D9C1D84,0xD8E12D85BF027DC,0x95A45DD99}},
+    {{0x93B6B88C5A5A98B,0x72A6316DDDCB4EF,0x6F4BF7AC5C462E3,0x97BD77C4CFB2DDC,0xE3E3799967A0D48,0xECB3B6EBE},{0xE019C655D615018,0x8175503EC85619D,0xDF476C46263CD7E,0xBCC28A529AAD308,0xE69B6CF88A66DC2,0xC0F620AC7},{0x129C144F06325CC,0x83FFECB52DC33CD,0xA65AD96F76FA8DE,0xFCD05AC36C6FB3E,0xD32FE2AE79C1F71,0xD9CA3EDB6}},
+    {{0xA555C1B99FEFA82,0xC38695722697176,0x86007E1873035F,0x14AC1B49CEA4BF8,0x875EEE9200B213C,0xE03FE0B4},{0xA93F56895FE233C,0x6A865BAA6ACC2C8,0x594CCB096C69AF9,0x549FD933B7919D2,0xA71CA6E7C53D92F,0xAC789FAB8},{0x86797D93053E6CA,0xF86522790F72144,0x6269479E23C2678,0x5D2D643801D8062,0xB1F8E05C9B50151,0x726BB7F0C}},
+    {{0x943231E09E3ACB7,0x402652BEE98505D,0x6E7667BDAF70FEA,0x51176352DE127B2,0x8D953FD082539A,0xEA7E4E473},{0x74FDCE6727E8F4F,0xFE9FD0785153DB1,0xADDA31F97C1BACE,0x178341F8F6D5E45,0x79B1974D354D067,0xFCE20C5B},{0xD0E3CBB8EBBB459,0xCEED4CC4FB94AEA,0x58F3A71F19420A,0xA451D14486A93C7,0x206A3B4E685E82A,0x1C104B1DD}},
+    {{0xF7884E7BEA7C1D0,0x76F89B18B2049EC,0x9EEA4476613963,0x12E34D76AE65C86,0xABDFE9343B2A0C0,0xB8135E472},{0xED9CE9A69114281,0x446BCA48F744B4F,0x6EFEAE8829C6DFF,0xA4CB30E297BF6FA,0x8251BEE2C562835,0xB2622769},{0xE222EC7E4286D1A,0x33C1965C902525A,0x6704AEE219B0047,0x23F436BDDC3D506,0xBE765CFCA118AE7,0x235F1A7}},
+    {{0x9E05DA5C860BD64,0x42FFB51246936C1,0x91C1FECAB481DEE,0x7477096D8EB6628,0xF98BDB2A0A7464C,0x80335CC43},{0x13E7FABDDA76621,0xFCF891791B1515B,0xAB172033195C2F0,0x4EA81E9023B0C09,0x84C7458D42D0CE8,0xD65364920},{0x697BE41063024F2,0xF5167687F93B81A,0xB45A68BCC5AD9F9,0xE097DE5A80BC7FF,0x8458F469214802D,0x3EFE51C97}},
+    {{0x579F1BF5044128A,0x25F7639DC0D7DB,0xF3CDBEEEEA63C82,0xCCB5E9F334C83C6,0x611EC9D28E8B829,0x78D649B51},{0x69BDF889AFA4F16,0xD72CC7206E63B7C,0x906CF993EA68638,0x78E776B95CC9C53,0xABA0EBAFCAF09FC,0x48B9B3B0C},{0x5F2A5DB90A34661,0xF98AFA10AFFD874,0xE6D7BE6F71CA8EC,0x8728AF242D1C1ED,0xD2FEE02782F80CD,0x1B1C3FFA2}},
+    {{0x22CDCEFE41D9454,0xA02772DCDACB057,0xEA4FF568D1EFA41,0xB1CA40C986D559F,0xF9A615AD699D353,0x90C14D1C8},{0xF123B199F70D82A,0x585EC5A0FA604C7,0xF862FB1D94EBFC5,0xBAC1B2EEA525FD0,0x5B28FE7EFBDAFF8,0xCF31F7FEF},{0x145E93176D970A,0x7055DB22E961502,0xFA459AFD7B7A3F7,0x499AA80635A7685,0xF412A2754342F0E,0x74E157521}},
+    {{0xA2BB5942DC58DA,0x77E233046A610A,0xBCD93553FEB3FE0,0x6041769F36CB07B,0xFAB7B430DFEC948,0x2D0331972},{0x2ACB9A0B2157C2,0x40EE5744F3BDA86,0x8FC20036218720B,0x9B109C2EF5546FF,0x61FC8121837106C,0x6A32D5EA7},{0x39CA2C09563562E,0x4D39C94AF264A2,0x48EC4F4B2CE822,0xFC76530765B7B7,0x11F51E1AD8F5781,0x469BB74E4}},
+    {{0x6D44447D4122D49,0x1C1701C924FAE09,0xEADD38ECB8435F0,0x9F78C1EAF891682,0xE920B7FDCAD8A57,0xB05730403},{0x4B8ADDF96F2D77A,0xE24284FDCA8778E,0xEFDA1561DA69A6A,0x79842CDF162A985,0xA46E2AD40A126E8,0xF44377EA2},{0x784CC71EB96B247,0xD257CE91B99E911,0x2FA801897C82244,0x66CEB56AA7D522A,0xA94B2558D89A73E,0x94F977FA5}},
+    {{0x49634FA8EA9563F,0x3F1406F0FDE9E82,0xE1B2543803C053B,0x58A2359AEF9D753,0x62533D1D87F7DAF,0x409577B94},{0xDA5FC22DECEA097,0x4F173D95CF7E824,0x6AE9B8373CEEEF1,0xA0AB4A55979656E,0x7D47A23A0313066,0xA822A9C7C},{0x98B4B03664D14AB,0x14EBDD7FCCD8577,0xE0CF1A67F5A7A40,0xE1FDFE10BC25D35,0xFE102AC71508322,0x6C14E44D5}},
+    {{0xFB050750919B42,0x6ECF7F2D7A83699,0x35A5C9F09F2192C,0xD46A87F1EEEC7C2,0xA8C68D8A29AA728,0xF3434BC5A},{0xC77C9EB089D4F25,0x8F987AA205D3014,0x23B923600147C23,0xF03E85E31A2D32E,0x1E81DBEE06E976B,0x17F01EE48},{0x45F3053C70FEEB2,0x666B4134363BDBA,0x69B27D5A439DCEA,0x2ABE22AC438EEBC,0x81449DDF076B058,0x8A0DAE515}},
+    {{0xBAC1D6E9DC890B7,0x3CAB275953F24E5,0x8B1352AF10F18FC,0x7AC66ED7C347C1,0x4EBFA4CAE1CB9FA,0x436342519},{0x3FB557FD78AE2B2,0x4D416EC32B3DF92,0x3585913FD94B0FF,0x41CEBAE7F757C7C,0x69C783A2278EF02,0xD19F2103B},{0x2179C42BE16670E,0xE20B4ADC9CDFC3D,0x13649575CC2D960,0xE5644577A582694,0x21C4D6731B85CF7,0xE3DF2B6A4}},
+    {{0x70FF9452AA3CE6B,0xFEC5BE5857B3626,0xAF48568CDEC2507,0xC802380050C5074,0x827471ED7A7C409,0x55A7C1C4},{0x479221438E22E1B,0x9E299A6D0CC9C6C,0x73070C2EF4BD9D2,0x54779C4D4FA7534,0xB7BB32EED71FF3B,0x5F610E6D0},{0xEF8F6669B97AA3C,0xBBF95D7BF47C8EE,0x2548D26D207DC36,0xDF1BC8E03A5B0D8,0x14B4CD4D6C17125,0xA3B9D8A88}},
+    {{0xCEE2955A2891E76,0x9A80B4075AF26F,0x58020C75E96A964,0xEF525209BDEFEF8,0x7A776DD4E717750,0x5412BCF9F},{0xB2B3FE3EB97D64E,0x86476E8A9745564,0xAC0EBA87F3781,0xE27BA62F7E36624,0xA74CDCCAFDA6549,0xC0810F851},{0xB38AB2A419FDA29,0x49B7BFED1B35549,0x3BA080337B93B26,0x729E00D52E6303F,0xCC845CB46C31D3B,0x1CBD74FDE}},
+    {{0xF0121863C226A17,0x9CA3002E657815E,0x1057B2B1383AF9A,0xBA7C80D29F1565A,0x1678BD37250A7BD,0x3F24FA99D},{0x3949394B359B7F6,0x10B3952B75158DB,0x71387936DD51D78,0x34A7652B3B14486,0xE9C38ECD114BD9C,0x72387AD4A},{0x7382123C1C07531,0x5834AB6760B27E6,0x4DB552CF6DF80F9,0x52DDB795D248562,0x6DDFE5F9C6C3A7C,0x7B9DE55C3}},
+    {{0x34A1713989C2C0A,0xA6FAF663EBC8C55,0x99E3D212146A4E9,0xA4F1D265398C9CD,0x3F9596316A536C4,0x3860D1104},{0xDACC9EFC645C017,0x9836A59B6BCC9D0,0xF8E2EBDC0DA9E74,0x5B161C04C68D89C,0x5CED35349C14092,0xF7D4363FA},{0x2E0D493F3033334,0xBF3544D8409E7F9,0xAE1023DA3EE4C23,0xC7CC88CC4AC0C7F,0x5BD340BDBD804F7,0xA77392AA1}},
+    {{0xC4183E8463021E0,0x6A6289C411E5FA3,0x8B0569417AC7923,0x49F910A6ED24997,0x9F154CA489294C0,0xAAE93402F},{0x5DBC8F8097DCE2C,0x5B9BCBC877D68DB,0x39FBA1DC96BA51A,0x3F0FFD9768BB425,0xF36633B9E2DF551,0x7A704E861},{0xA17DB918CC3537B,0xA859E5059695A2C,0x413FF036CD25646,0x75A1CF64B07991F,0x82CEB604A39C6F2,0x56F078D11}},
+    {{0xDE509E946C69B42,0xE0BC9D096062122,0x6B96AAF3EDA73CB,0xFDA25DE9D48663C,0xE18C3021C7B4537,0x533BE24A8},{0xA5979AF0332AC3E,0xAFCBF3DD96EFDB5,0x58BA56CCC168F10,0x8BDDA2D3ECBB53E,0x2A806DC9A1C3CED,0x8F53CBE63},{0x578910B069B31DD,0xC8E163A696D432D,0xC73A2A140DE4A4B,0x49BE1796C970524,0x34EE8590C53D64C,0xFEAEF5D18}},
+    {{0xCEBC08F8DDABD93,0x4AE7BA87C621B7E,0xE53924840C431A7,0x33761DF73923970,0xD9437741A779CEB,0x550D6FB0F},{0x6ADF86B1134A358,0x3981B1DA3CE707,0x91BEA7B91E2E891,0xC529DA70806EE1D,0x8977A4B6A381C3A,0x8D260869D},{0xB62B0CF8768D211,0x1FD99506000B4D2,0xDC07A307791ABEA,0x334DDA70EA7F063,0xF0B08E2AD744855,0x9DCB6C593}},
+    {{0x964422A28EF20D9,0xEF8CF9C89E3A5AC,0x366D208FBF1960E,0x6948084AC988C64,0x1BB8B4C5BDC8C42,0xCEECF9C47},{0x5A7F39A7B83EFF7,0xF8E76F8AD9926,0xACCE04C9BE0CB45,0xC0DAC38C9768DD7,0x261BC0F352803E,0xC94FD804C},{0xFAB26B9EBA7C1F7,0xFA8D174DC537ADF,0x7B275349AA808C9,0x644E31899D0300A,0x78D251646BC3797,0xFF2F6C44A}},
+    {{0xF1AE017863D5DE7,0x8BE91CFA5E96593,0x9CDE7C7C8CFF27,0x7D16ABB9C15BB84,0x30956DA2804DCD3,0xA9A336568},{0xD84BE34F598DB1E,0xF2C1C8024B3350D,0x8DD6E32DA5EA45A,0x7721B680FF29285,0x94AD6201F50F473,0xEDBECFEFC},{0x30118111DB6114E,0x152FC13F23EBD51,0x191D90E70BFE9E6,0xD1B7964DB2B5D14,0x634F6D10CFF82FC,0x2784423CF}},
+    {{0x3E3F0BE812CB50E,0x610FEAE1D878CE5,0xC40AD8097023AE6,0x87363923812EBCA,0x3105041DB4457C6,0x4E73B6CB5},{0x43E000F5A23BAF6,0xAA9812E87E4BDD7,0x9806814CAA26B4A,0x766DF84A8C6AC6C,0x25CA4BCE0D623C1,0x3F71997A2},{0x4C0312779546806,0xE87C55925D0D1A9,0x268232B0854E572,0x3161D67AF419734,0xDE5F7D561B4F56C,0x9CADE7BE5}},
+    {{0x5113C16B7DD626F,0x164AC73395242D8,0x14367CF6CF6AD0E,0x5C2330614184B44,0xE0CF828FE6DA339,0x238468350},{0x50CAF82523DB98E,0x61580BD24D4800B,0x49A64C2DBE18550,0x45A77E4AB8BE674,0xB2E9587965C1549,0xF4D77B414},{0x99C5C58FF696267,0xB7952BC715E25A7,0x42E46AA777B9C20,0xA9EA6CE62EF5E24,0x5BD370CE35B2E48,0xCF1416F40}},
+    {{0x7D737D343692716,0xC33C00143D4CAB,0x9BFAAEA8E9CE163,0x34A64193AAEF6C6,0xEFA8B7F2249C1B0,0x8BF437C3E},{0x9AAA74D09489321,0xCAC799FA5812D1,0x664D866C367D1C7,0xDEDDA0B2FFB00D6,0xDDEDF335FBCC68C,0x92F1B955D},{0xBDD1B96CED58714,0x12FC6CA449A88F7,0xF8B7883F40DD206,0xB317D70B31C6673,0xB423B349F87CC54,0x27E268B4B}},
+    {{0x31417352919BD5A,0x70A2FF22272FB80,0x2E43FD1683097E7,0xACD3D80FE37BB89,0x381BB39809AEC7,0x25E9C8636},{0x87E0611D2C61E5,0xC08CFAE5227E37C,0xA594369D7EA04C7,0xA19A2A67D3669C5,0xD9FB29E9460FB4A,0x8740F3AB0},{0xD16DBB3985A636,0x5C16DDD152A3452,0xCBD404E066720BC,0x8036315834AECE9,0xEC00B6FDF69E429,0x6B03BCEEB}},
+    {{0x584645ABB898CC3,0x7D8C4FAC45FFC40,0x492651822B1600F,0xF1113F2A440AB77,0xDCECD0AE349A8C1,0x64E35F841},{0x9916D847C8E601E,0xCAD7B080B98FCBC,0xE6555FCD0E4AFA0,0x3351AE0ADE6D10D,0xD043D97CC989C5A,0x54E887B38},{0xB8B204BD640701C,0x21032743CB60E9F,0x8C3E19F9163FD9B,0x242A3847FA6308D,0x9C5038C8C9E9880,0xAC4C1400B}},
+    {{0xAFF36FA0ED05311,0xB4266B1F7005F4F,0x240DC56C0D7C6DE,0xF89063AA3134872,0x3E80F4C51C97BB1,0xB2AF7066},{0x670F33FA867AEEA,0xE6631BEB852313F,0xAFAC0DC59AF2CC5,0xB5AB0DD7DD12ED5,0x1DD19FD46BB2C4E,0x8CC7F2A3A},{0x8624A23FD59E7BC,0x8DB1E0523773F,0x14B0D18F3545D94,0xF6AC03D63DB1D72,0x39357C72F3DAA23,0xF32498A59}},
+    {{0x287810B694B76F4,0x5FD05265EE6DD78,0x9DDEF5E985C55AC,0x9FCC4CCF8CC7018,0x7372B350BB71386,0xFE4C1D32},{0xCF62A17654BFF65,0x6540BBCBA466D99,0x7D306180BB4E206,0xF13EEB92BB67FC0,0x92DB6CEFED5B99E,0xDCECDDF96},{0x4DE333F8D4F8763,0xF3342344F25A186,0x6DE24B71FE17FB,0x3C88BC357DCCD56,0x78FF4194387169D,0x432B4E4EB}},
+    {{0x7EA685FC424B328,0x600E8FA73A701FA,0xCC131DBCE7A0853,0x8E01A3FDDEA6A47,0x8CF855B09918F7B,0xC099A55C3},{0x19C22E97A569BD9,0x60CC52A2D1DF1EC,0x7923E8393400FE7,0x6241A28B9B257AF,0xB4D4EDDBCB5FF7,0xAB60BC39C},{0xB963AF31CA7F5AC,0xB0406F10BE9A238,0x6325385F8B0921D,0x9A19305B8B75D0B,0xA1B31EE8A5C1C75,0x89B26F668}},
+    {{0xBEA3DC195A15502,0x76D34EB809132E2,0x7B746C78DA41CEA,0xA82B86F0EE3CD5,0x87EB2A075A7F87D,0x938A9A5EA},{0x33A908D7D668F31,0x74EEFE354D3829B,0xA7EA5F42966F7E7,0x6603E712415879F,0x197956BE003A5E5,0x1C1792658},{0xD27CBF791DF79BF,0x5955C9BE726340A,0xB1B11C1534A1CBD,0xF8613FCA13932BC,0x77CAD46CC829DA8,0xA72E0424D}},
+    {{0xC36CF6408D267CF,0x2FF39839AEC321F,0x753628D87233F82,0xC185A777D9414E1,0x3ABB1FDDAEBB8C,0xE3AFD897A},{0x819BF80479AD36D,0xF7E83AB8930D7E2,0xAD58A44C32A0BBD,0x63084C080A38EA8,0x9997AEFAB19F77B,0xA346B9B9F},{0x8009AF5EB9EF459,0xA69790DE69FCC6D,0xED68F05D96ADA54,0xA9A5C5424DB648A,0xA5B75C59465BCD2,0xFF5C9B081}},
+    {{0x8818B6458901C23,0x319B226F3A70DF2,0xC7423FEC7327203,0x2F498FC567A3111,0xB567221F475A779,0x382015243},{0xD58BE7DB2D859F0,0x9E754FE60809C32,0x18A143ED354EFEE,0x8F03AEC05C11F41,0xB273D79D0A6857D,0x183F650BB},{0x11A8E0D1EAB7315,0xE9DB804D1AF85F2,0x66DBEBDBF26B91,0x3E2811AA527FC2E,0x415ADB060EEE9F4,0xB80E7195D}},
+    {{0x7531FB2898A1F80,0x2206BA94C3907E7,0x966C3FFE47BD11A,0x89D15F64D9B39BE,0x1F9F3DF8FE232F5,0x9D2B56148},{0xFD5618B8FEBA277,0x66417764FB29246,0x3455802D135FDC3,0x87F092075BDF993,0xB21820588937404,0x87F0AE7A9},{0x4E469D7BFE1F3B1,0xE6ABAC410EDE4B5,0xF06B3CCB6E425C6,0x73BF6B0CFA3C31F,0x4CB0F118E0A82E1,0xDF6891338}},
+    {{0x668D64AE2E461D3,0xA7472D43181283E,0xED404E4DF6FAD24,0x63613C94EE777E2,0x90C8039CE6878FC,0xB1C4BDDB9},{0x6EA4CD544E58019,0x1A2936B58C2698A,0x5B119FEC37FC5DE,0x262A35792F8333E,0x3247C2416245E0E,0x1469B643C},{0x9148B7FAAA1D16A,0x11F075F25367C93,0x61DAD52D75F6B9E,0xBF889ACA0CDF860,0x832126AC3632414,0x777CC0C0E}},
+    {{0xEB2B09E1B36304D,0xCEEF2E5AB1F8372,0x23B6B9D30C5827B,0xCD8366881A6138D,0x203696BA2A513F9,0xDB13BF5C3},{0x4B61A3DEFFAF3D2,0xDA630B026158009,0x857FE16B17DB01D,0x7B8D2B655B22CDA,0x1297EBDA98B2EBD,0xE69B83B82},{0xDFFB450BA70EFF7,0xC907FC24C2670E8,0xECDF2FB46FB20B5,0x7C1D3213CF41262,0x4B213C5C178207,0xAB69DC6CF}},
+    {{0xCC5A5BF975722B4,0xD736EF0C45CF5FA,0x29A6B3145BF7812,0x8970A747E5FAA33,0xAA6A0867996250A,0xE6A924A30},{0xCF17E552775B13E,0x4B34616705D37D7,0x9839EFA59CEB50B,0x2D70D3CD8DB0BDE,0x7558A9AF3470FED,0x3B40DE664},{0x90CA11AA92B6AE1,0x1296A23025B65AF,0x119C4219DB4ED00,0x15B52C0BB11B2C1,0x5A2812380C268B4,0xA5C1CF444}},
+    {{0xE4CF47BAFC41D51,0x3CE98604E324F38,0x84F854BAF90A7A1,0x79D358C4A03854B,0x182569348758F7F,0x911BD7346},{0x6E12C5D5A579EB3,0xABE629B58B5EEAA,0x7A1828E8996A87C,0x2DA60784B22422D,0x90BAD03606EC9BD,0x49CDEA117},{0x117A6D98EF51925,0x40C1FCBCF73E315,0xD4573D8C2B7CDC3,0x2ADB455CC15D629,0x35115F5D7621F9F,0x4A0A3A167}},
+    {{0xDBF5E1B0D056D8D,0x30247BDFC5CDDC7,0xA8B8DEF45AC1D70,0x29FA422F254C15C,0x3189C141DDA4482,0xDE5EE5520},{0x8BBA38B4CDA64DD,0xAC66CE5A28687EF,0x70C8C509B4024E9,0x1E996863E20F26B,0x3E947817FACF951,0xB040AF5B5},{0xA35F974CCD79D22,0x4A98B656E76278F,0x5AB1D44851A2040,0xD6DEF7C17CDAD81,0x83A64BACCCBFDEE,0xE077E9ACB}},
+    {{0xC7A34E4F99E940F,0x3707E9DFB3A2B6B,0xBE0E04694DE84FC,0x5F057E9D57D2298,0xB1550C130B2D820,0x753636C4B},{0x2C2815E3D026080,0x9C88165327D7EB2,0x50F30132FA05D44,0xA3FAB6E001F492C,0x94934C9FB76FF9F,0xD45E21A7B},{0x132E5DA56C9757E,0x42F11349802BDD7,0xD71D0B9CD524483,0x6070A0C66ACC545,0xAD73C7463527CB3,0x58FF3B597}},
+    {{0x5BBEC726D5F7EAF,0x1273B3246F76C36,0x8C6C408DC88325A,0x85D6DECC50C1671,0x7721081BAD30218,0x2133AF462},{0xEB594E3249F7765,0x1704131B5422123,0x2A82AC0D0CC16FB,0xEC00380F68D9A87,0xF2D1E8DD263EA30,0xDF80EB8CC},{0x36C6DFA39FB6863,0x2FA8EA30DDA2498,0xF8EB08BEFE03BEB,0x69217C92BB395D0,0xC91CFFD63AB6FF1,0x4CE4E5AF0}},
+    {{0xADD42CDECF7F1EE,0x79641E3A0899B1D,0x4A650591E201608,0xAE14736358FACED,0xA3C37F59C3A6B47,0xCD84EF4FC},{0x6A952B9FED57F1F,0xA122E77B3541465,0x19DD043480C052E,0xC6E0B65E67E47B7,0xF55693B4C11E224,0x13CE38C4D},{0xF7E7DB2D46732F2,0xE70C0E6CF93D2C1,0xC194BABA82CF4F2,0x782A501A43DB522,0x8D5C57DAE2195D8,0x8167A22E5}},
+    {{0xAC6829BFEDB4F4B,0x3644A3D2E90E031,0x29C9FA5053BEB3E,0xE1C13265F579C68,0x997FC706D3C8227,0x5666A39C3},{0x6CB3BDE7DCF041F,0xB5C97B3B2B73DED,0x2949CE7014BCF4D,0xFF848F50564006,0x91519F0A1F4599B,0x7D7EAE9BE},{0x36E3F7994F6CCDA,0xC13C415394C2B61,0xCDFDEAD8405957B,0x64453FE6CA18C69,0x58AEDE18FE1295D,0x86798A6B1}},
+    {{0x94199D4BE951CC,0xFF12CBC90FCF203,0x41F2F0B3D70596,0x70862043A24F32A,0x3615D0E118ACFF5,0xFC1DAA2F3},{0x5BD4C03CAB93743,0x64B14DA20441F78,0x46F625A5BAFEA0E,0x84A92B729A4859A,0x8830157812C6D6,0x602ED8A4B},{0x1D028ADCAA77FC1,0xF13BB98D74DC078,0xA48462D1EBC5E3C,0xAA9B0ED76523FD7,0x6B185B4EEA50D34,0x88452C2BC}},
+    {{0xB0190791EF39390,0xF6999605DE73F91,0x6125176E2F04431,0x1343DDC77C78A65,0x2884CC2642F7EAB,0x846F77B73},{0xC3207BA0A4BDB0,0x1732FBED646C76A,0x3B3482639C4EA0C,0x6A8BDAAC332B20D,0x3027F24C83563B,0xF59A75EFF},{0x887C10CF0153C0B,0x1AD50935B051401,0xE9404973140FEB8,0x71FE1F2F5C36FC5,0xBC6E235CDE6D548,0xD550344B8}},
+    {{0x9005E0414D2BE47,0xBE0BB106268BBC2,0x974CC8584C7421E,0xE5499E750579DD3,0x6B2D2545A9917EE,0xFCDFC2B52},{0x4A7B814524F9FC2,0x85C70AF5159F831,0x8D81F265EF92874,0xCC8E59CAC35059A,0x120232A2FCFB4DE,0x7CA33740F},{0x87B1B186106BC66,0xC6A7B25BC8B05F5,0xA40D4846FA417CB,0x17FEF2D594E4BE9,0x49B0CE1E4305535,0x99CAC00E3}},
+    {{0xE4DE583753B9D52,0x6A32E8FF0D81E43,0xE33B8FF473068A1,0x1D1510A00DB9667,0xCAC15BF0A0F25EA,0x9F8BF3706},{0x9B9CDA200FCCDBC,0x28A0DE2C2CB0749,0x91438DD058FA6E4,0x1DDAD1EB364B90A,0xA351A430B0DB1EE,0x12CEB43A5},{0xF07072C360E187,0xDA7CC54B2E13C7A,0x37D3ABCD428E770,0x2D98CA82892A418,0x8B59D6FF968787B,0x2295A20}},
+    {{0xAE964B00D800BC0,0x4BB0D407E91C229,0x539376416915C3C,0xE4D4045C5EB81C0,0x2BA0276BD81BBF7,0x195036663},{0x15B677B55AE1838,0x5252F69018EA205,0x66EE3A12590367B,0x175149D99E36915,0xEB618F083A27B99,0x1CDEF94C},{0xB4C216DED83120,0x6F7FBF9724410FA,0x4ED29A31D182F8E,0x4DCBF12050EECDD,0xF49AADA80233BA1,0xBFAFAF04F}},
+    {{0xFCC81220D633C4B,0xA93D6B8E104E73,0xF4608E1BBAA7A5E,0xE0F20136B86BD45,0xF940C787C8831F5,0x8FF0919B9},{0xFC7E6E14F14F80F,0xD0161B4C6B1D5B2,0x4FCB928193D2D8D,0x112E42244D32E3A,0x495CC45CD7DC3ED,0xEDDC18948},{0x8C5E2D5D017941C,0xB421DB1435B8D42,0x6EF99F80310F214,0x37173D24EB7238E,0x72B6DA82F0A5377,0xAA87E8FC}},
+    {{0x4A64F557CCBA284,0xC85241B74C52B1E,0x3826378A3372881,0x44C7459D0BD7B2B,0x59B6A228C0C9038,0x14DCE3BBB},{0xAE912D2F03A90E6,0x256879AFB320D07,0x44EDA1BB581F8DB,0xF0FA58B9B165939,0x1A4FCC7C7C095A6,0x29B34414B},{0x1A13AB6E50509ED,0xC3EDAC8170A049D,0xE7838E107843CB9,0xDF24B4B18A670E7,0x1E0405C4F8547E3,0x4C15CFB99}},
+    {{0x903C26D9DEDC765,0x8F4C75E2C051EF2,0xE03D34560587E1E,0x71D70502E1A10A,0x9A57E8163CEF79A,0xF86C36057},{0xA9BDCB66C008E91,0x37387E995A67322,0x45AFC4BDD715C84,0xED5FC74C16093BB,0x8753CB8CEB31B37,0x54DEC6A3B},{0xE0CB19F9167AB55,0x844BA9C45C3B1FB,0xE685B9EABE5D293,0x3378B995D216BA1,0x1CEE791D9DD510B,0x7BCB205FC}},
+    {{0x21148A224FBFF0A,0xDEA1698F437F9AB,0xBC9F82AA4FA365A,0xEC7263442864BCD,0x3276812A1CE9E49,0x274FAA368},{0x4F774C30505C63,0xB7F87F3D2868034,0xE05402BA6990A18,0xA749E3D80A6D1CE,0x447C82F6362BBA,0x29C848F09},{0x2F632D84CB13234,0x6CC4D796AF803A8,0xF81352327115BD2,0xADAEF97CC488B3C,0xA3CC6EE589B4A30,0x8219D3C53}},
+    {{0x5DB7440835DBB6C,0x66750F073F5AD54,0x6A963A43FA3756,0xA61D21F37054BBB,0xE1C62A4F17B88BB,0x9F0944E9},{0x44562FAA6E7B97,0xB1AF5F011919B9C,0x19BD65F2D3EEB54,0x20580FB9BCBF0C,0x8B91F44E9CCC372,0xF16DA3635},{0x208063FE2918101,0x1A4CC3428312727,0x9A4CA5D0D8D1807,0x30414FA44234A1C,0xB33ECC1AC05166F,0xDDCB4832D}},
+    {{0xAD9557A659905FD,0xF2A16C341F43AE,0x19214EBBBF5C0F3,0x273CC6D79123397,0xEB4D937B5B5E39D,0x6C2533EF0},{0xDCE15F35714B3A2,0xC0FA2E81DA02807,0x548564D610AFCBE,0x7A1DF38BA39E60F,0x707A701D43176D9,0x256C7DE7D},{0x698C87F67B4966A,0xA85C28D228D820C,0xB9727F4631513F6,0x3DB938BC3FDE549,0x2E83836F5F19974,0x9FFCA49D}},
+    {{0x5D3B70BC227E03B,0xB7F4E49087398B1,0xE88A771CCFFA093,0x1D524D33617A1CB,0x70C8BF635A4DECB,0x12C47F3D0},{0x8A0A8623274ACE2,0xC46D3BDA04E3FA0,0xBE655A18EED3CCA,0x748712C48FC560D,0xB527BF5220E5442,0x96601BC91},{0x67EF47EF7D45821,0x3F1B11A93622E05,0x6F8340B32186100,0xBD07461FA840E6B,0xFD6F4801D0E6EBD,0xC54E1A079}},
+    {{0x2020CD01DDC335F,0xC815742890E196C,0x579A2E0EB92DBB0,0xF124F8B45A3427C,0x2DD7FE7EBA59C66,0x244867DE},{0x1DA3285CF0863A6,0xD6DB68BF4F2C8EB,0x76F016669016D16,0x30C3FA9FC0B534F,0x505C52DC3681D6,0xB1779A898},{0x3BCDD7044F458CD,0xF26793970EFB048,0x5BF73B763244D84,0xC8498E838989D37,0xBD13BF4D88EBF5C,0x1B82E35EF}},
+    {{0x5FD12CE902207BB,0x98D716181B6A1C8,0xAA0F0191CEB9357,0x77802E133956F09,0xC254851D43EF16F,0xD4B8020D6},{0xCCC9C748E127F3C,0xBD4959BA8A5FAC4,0x3ABB28BE2754C7D,0x53CD8F72BFC0AC1,0x1FBE10D2DA0EBB,0x16E2CF340},{0xE2BDE50BEF35E10,0xEB098FC99B31A0A,0x65F8AFA21D48E49,0x70094EB5C303CD9,0xA956509E6CEAFD5,0x537373D6F}},
+    {{0x9916CFB84AF327C,0xA6147D97F510397,0x177937558CDC409,0xEB62BE0628A175F,0xCA7A7EF19DEEF00,0xF73809862},{0xB7CA146DED793CE,0xEB749E3812714FC,0x92D4FAC87BD2CF,0x6E813893B51BB71,0x58AFE11C38BCBC7,0xF2B782658},{0xC6EA01254A74DB4,0x24CA7261176AD42,0x29C9C9B4CE04BE0,0x3E94B2CF9464BEF,0x38641B5F3D00874,0x575AC1D5E}},
+    {{0xF28B2C42F9B191F,0x2EF28304E9C7494,0x7F1E6F5C9B96BA8,0xCDBDE234FBC0C0B,0x3901AF5A65E170A,0xF211BC703},{0x1E51536CBDC7FF0,0x41BCED5EF7D750D,0x382F8D2597C0228,0x1CB73A348C4ABAE,0x34BF74093E15CF4,0x9F5401D70},{0x1D2D71FC63E1AA9,0x7D54447FFC35961,0xC3287A461C8591B,0x79D7CF76C45ADE7,0xAC5AB23903EF709,0xB3B276BA0}},
+    {{0x429E5C8B4827D54,0x95C357BC3F1027F,0xD2B9CB69D2431FC,0x6854D68F32E6D52,0x91B5948FD007386,0x46290D8EB},{0x24780AF32D07C71,0xBD6FF376E4A8497,0xB7E82A81F0CD49F,0x16BCBB6BAC933CB,0x967B34ACDA04243,0x2820E152A},{0x776C778B4495297,0x5D3D42951B9B819,0xCA0C01C5A4C06A8,0xBE32D92E5E579D8,0xC474BE5E75C48D9,0xCE44290E2}},
+    {{0xC371F0472F6F4E,0xDE2EDEDA3FB5409,0x406B17C79ACF9BF,0x8D735CABE013EA1,0x7AD191AA14DC134,0x858448D45},{0x1F3D2A65373E70C,0xBC2670558DEB3ED,0xB7DA05CB0F81228,0x99142D287BEBA63,0x45F11D3AB6AE72E,0x4F7C4D484},{0xD168BE6434F6695,0xD3BE3F5906944CB,0x83909CF7C8E09AB,0x13F79E673183CF0,0x218FF0466AEEAE7,0x24B9E86F2}},
+    {{0xD8123A1092934AE,0x5FAC34B0109AB9A,0x14FD39C5CFCED50,0xCFD0AB21EBFB66F,0x6D57E7BB775BA4F,0x2C819C528},{0x63CB1AE8310C51F,0x64E3A7615A42C76,0x4832D66B5675F77,0x95F208BC5F8FFF3,0xB434B93BA1F9840,0xA9F7A2727},{0xA4B208B54924E4E,0x6FBBAF581987451,0x5610953FC5AA884,0x269449DDDF0E6E3,0xFE2607B22298A28,0x4A5E50EC8}},
+    {{0x6EC64A14FA7230B,0x1A47A18590C2A0D,0x1734897C6E05BED,0x443EBC8C5974370,0x539916FE840F0E7,0x2146A910C},{0xA8A5D53849AAA5B,0xDFA708F540B73C1,0x3783D4BEFCAFBFA,0x7D699AC5970527,0xABFF0E77033D5D9,0xE3B2C3547},{0xEB82DE152A213D4,0xC1E950E0085512D,0x2FD6C7A15DA8846,0x29170107075E1C8,0xB55D02DBC719717,0xB64758D2B}},
+    {{0xEC0C52D52F7B3FF,0x1DD238E458D9122,0xDAEC4845B5A6D36,0xCDCD44F93726E3C,0x528DD661DAE020D,0xD297BDA20},{0x5FCD9C3DA2806B3,0xDF8E0CF1A186DB7,0xD0AF6A4F32F39C0,0x7427EA5F002784F,0xFD2814D6C4B85A8,0xF2097D598},{0x3A0BFFAF9A83833,0xBCF8F2EA06E3541,0x6733ACEFA00DB3C,0x7AA0128002C292A,0xBA84886C25CDA21,0xC4B69D8DB}},
+    {{0xAA2B8E847DB1F4E,0x49B1BC10F4A48F9,0x3F2D7FFE05C34FD,0x602DC4EDD288E87,0x4A953C5C0ACFC2C,0x11A2A36CA},{0x541372781594114,0x7490A1A2D63ADB,0x832EAB49056B647,0x332A99A76E1F344,0x600A9709BB1905A,0xAA143203C},{0x47E3FC520D9323B,0x8F3DADECF890CD1,0x6343F8C706991FA,0x94F736F9B6EF102,0xAF9FBD4EA3F0110,0x68AB9EEC5}},
+    {{0x1188B4BF1D736C3,0xF85E7E9F0DD8601,0xF6F2DADF9E6A229,0xF2B05F3DC304B5B,0x9E286D25FF55D2F,0x677B13FBD},{0x5C758C6E48C113A,0x5D4DB909B7AA484,0x1FF5B732AEBF1BD,0xA0B001BDB2925C,0xEB1BA8BD3408B36,0x6B99414CC},{0xD7477A17361DDB4,0xE91E855A76C876B,0x4F43D3FEB64932E,0xB91DAEC122A0E59,0x2F3189175556609,0xC9C2993BD}},
+    {{0xF53CC32EA5D316C,0x147D3B6AAC2BFDB,0x4B92C9427981085,0xF639574AC56CFFB,0xCA18C2F03C80EF6,0xA88DCD797},{0x5D71DD5F7F737BF,0x1A5F390AD3E8864,0xEECE22520BF35DA,0x696794BAE8E94AC,0x5E4D846DB44F7CE,0x7280C8E2B},{0x763F3FBB5E93DCE,0x48DA329D0007533,0xBBA353244B12424,0x8BCA16659DF0213,0x3B9D71C0E78F25A,0x2AF0CD649}},
+    {{0xCFC8CFFCACF5430,0x3A77232F3AB4125,0x1638AB9F4C5ED6B,0x477FD180C9362D2,0x26B59CE52EFDA07,0x65D11CFCC},{0x9F261C38EB72482,0x5B1AE868F77C6FD,0xE4D4829768372C3,0x4DB4F8191B092B,0x355947B7C4ED21,0x6E16F418D},{0xDEC5E86D3AAC882,0x8A9BC3775CA5EDD,0x7AF4671FD3142C4,0xC594977113D76FC,0x14EDD5C52AD9C4D,0x569B5B140}},
+    {{0x54870C8C28CB47B,0x2E18D871C3EF958,0xF54C53CB1A76CBE,0x7D0ACBC92018601,0x66F9F9EAA69D9FE,0x341791A6D},{0xB3454B6FBA63F48,0x3AD610340CD2AFB,0x49F5A05F74C4B59,0x357A29A56BC0CD5,0x8FC8E169905687A,0x4EB179A4F},{0xFACD61633829FBD,0x8DE0B4050AFF2A3,0x49A537AEE4E093B,0x56826F73E960369,0xD58E488AA9B38BF,0xBDB3EC8A3}},
+    {{0xDE888AC5D8D83FD,0xD16EF77FBB9748,0x4C23F74281FE1C7,0x51E2EE6ED77717B,0x41652B72F80679D,0xF9011FC32},{0x7409A5DC49C758,0x5F307AABF2A165F,0xE3FF6E7E50C9C01,0x8176D5188BA0300,0xBDCC415D7330AE9,0x12F2C3BF5},{0x630ADB14D94F8C0,0xE9EAB3BD513D77E,0xF7290252D073376,0x1E9C415B2A34D56,0x18B381A937A56A4,0xCBCA8FAE6}},
+    {{0xEC256EA5CEFCA35,0x9E7CE5B6D4A22D5,0xFF77A95C9399537,0x41EC0FC57B89746,0xA123F232F0135C7,0x35476A75A},{0x6773704F4FE8501,0x904794F7AA36AA7,0xC69047DD8541C78,0x4BD4821063EE462,0x38570865B3E2A1E,0x39A389768},{0xB0E08D0A50CEA84,0x39C4779AB51E2AB,0x523413C6293E6A1,0xD0619CDF17994D8,0x21092BAE7A839CA,0x558B78B4D}},
+    {{0xB09F58D2513C523,0x72B9CFD136CA712,0x438D8A110D035CA,0x9D68A56B062B49E,0x38C9E4EE1D084AA,0x57DE3F0DC},{0xB63CA65439DA919,0xD6B6D1119A8661A,0xDDA873D9288AE68,0x4A0EB03898C1E4E,0x8E248DCDE894268,0xB0E21B6A1},{0x2DEF2D81C640856,0xB220C87CE24730C,0x1341896304758E7,0x45EDEC4B257FD4D,0xB8457692CECFDCD,0x49804320E}},
+    {{0x7F4AA81BAE6AB5,0xF1869BED0FABC75,0x393125436AB5177,0x3DA3DFFAE30C3A7,0xB3CDE178A59E9E2,0xA6AF7EFAA},{0xEAA2232A681CB7B,0x7CEFF471AEFAF03,0xDDEB3D1E589AD6,0xA2AB1EC1A88E22E,0x9421AA7DDCD2774,0x92D8AF030},{0xA80DF683E89CB00,0x50FC236BCADF218,0x850541F9BEE41A1,0xFA86E723FFEC078,0x9CC8BD561151A02,0x841EE6AD9}}
+};
+/* End of comb table */
 #endif
 
 
@@ -32,7 +32,75 @@ const BIG_256_13 CURVE_B_NUMS256E= {0x355,0x1FFE,0x1FFF,0x1FFF,0x1FFF,0x1FFF,0x1
 const BIG_256_13 CURVE_Order_NUMS256E= {0xAF5,0x16EA,0x43B,0xF63,0x11A4,0x1CD,0x1D65,0x14A5,0x155A,0x20C,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80};
 const BIG_256_13 CURVE_Gx_NUMS256E= {0x13DA,0x1768,0x40B,0x1D81,0xA0D,0x1AC3,0xC20,0x1DC,0x198A,0x1061,0x6F5,0x1241,0x15F6,0xF1E,0x1734,0x46F,0xAEA,0x7DB,0x1D45,0x114};
 const BIG_256_13 CURVE_Gy_NUMS256E= {0x9E6,0xC54,0x19DE,0xC2D,0x12FA,0x1769,0x215,0x1B02,0x1F61,0x38A,0x4,0xC97,0x1D9A,0xB32,0x1F3A,0x4B8,0x19D9,0x14FE,0x154F,0x89};
-
+/* Fixed base comb table for ECP_genmul - generated by scripts/combtable.py */
+const BIG_256_13 CURVE_Comb_NUMS256E[64][3]=
+{
+    {{0x13DA,0x1768,0x40B,0x1D81,0xA0D,0x1AC3,0xC20,0x1DC,0x198A,0x1061,0x6F5,0x1241,0x15F6,0xF1E,0x1734,0x46F,0xAEA,0x7DB,0x1D45,0x114},{0x9E6,0xC54,0x19DE,0xC2D,0x12FA,0x1769,0x215,0x1B02,0x1F61,0x38A,0x4,0xC97,0x1D9A,0xB32,0x1F3A,0x4B8,0x19D9,0x14FE,0x154F,0x89},{0x11FB,0x3,0x1E43,0xFFD,0x5D5,0x430,0x5C0,0x1B30,0x1CC2,0x1B9F,0x1DAF,0x1D22,0x12A6,0x521,0x10DD,0x1026,0x19F4,0x120A,0x23F,0xB4}},
+    {{0x1558,0x161D,0xD81,0x21,0x15FA,0x5F8,0x1E76,0x1C8A,0x599,0x2AC,0x5FC,0x12C8,0x1B21,0x49D,0x1C49,0x19C0,0x1DBA,0x18B2,0x15EB,0x19C},{0x1BBE,0x1988,0x1080,0xA84,0x1D0B,0x812,0x1BBC,0xA3C,0x38B,0x6FD,0x19A5,0x101,0xA51,0xED6,0xF72,0x315,0x1B3F,0x3E5,0x947,0x13D},{0xB53,0xDAF,0xB64,0x1BDB,0xA05,0xAB,0xF8C,0x110A,0x16A0,0x1A26,0x20A,0xFBA,0x1C20,0x159,0x1C27,0x1D92,0x3A4,0x192B,0x1B73,0xB5}},
+    {{0x3FE,0xF5E,0x1AC,0x12B,0xAAF,0xEA6,0x11E7,0x452,0x19D0,0xEDF,0x1E39,0x1A0E,0x14BC,0xFE3,0x2B7,0x20,0x933,0x1FA7,0x115F,0x14},{0x1FA5,0x150A,0xB52,0x1054,0x814,0x1D13,0x5E2,0xAC0,0x1B55,0x1E5D,0xBDC,0x1B8A,0x27D,0x1D3D,0x10A2,0x1567,0x10A8,0x1F5D,0x2BA,0xC4},{0x1B2F,0x145A,0x1B88,0x1FBD,0x1017,0x156F,0x51F,0x1184,0x148,0xC3F,0xE43,0x1B23,0xCB8,0x182C,0x6A3,0xD58,0xB99,0xDCA,0x1830,0x1D8}},
+    {{0x1179,0xB02,0x17E,0x1438,0x1CD3,0x7A5,0x1B02,0x5EE,0x95D,0xC26,0x79C,0x1489,0xB1B,0x955,0x1118,0x18D9,0x5B6,0xA3B,0xE8,0xA8},{0x1ED9,0x106C,0x168A,0x5D8,0xAA1,0x1E3A,0x16F0,0x1C8B,0x1C43,0x398,0x1352,0xF7,0xA62,0x76,0x1972,0x1311,0x6B9,0x99B,0xEB6,0x1A3},{0x153B,0x3F1,0x129E,0x1B19,0x533,0x203,0x6C5,0x765,0x10F0,0xC5A,0x153F,0x19CE,0x14EB,0x172E,0x191,0x1252,0x1137,0x18CD,0x6EB,0x89}},
+    {{0x7AF,0x1650,0x435,0x64F,0xD6,0xBF7,0x7EA,0x1F6E,0x1366,0xC1C,0x10EE,0x1D0D,0xEB1,0x1BE,0x1456,0x994,0x112C,0x376,0xB7C,0x8F},{0x1832,0x1580,0x252,0x14BB,0x156B,0x1725,0x5B0,0xC01,0x2FB,0x1C6B,0xC6,0xE9D,0x3E9,0x60E,0x83A,0x1C42,0x1E86,0x622,0x795,0x18},{0x18AC,0xE68,0x1DE,0x26D,0xCC1,0x1167,0x12D1,0xF43,0x707,0x5DF,0xBED,0x99B,0x325,0x1E0D,0x10B7,0x159A,0x7B9,0x1374,0x1CD7,0x73}},
+    {{0x1C8B,0xCBC,0x1589,0x7E0,0x519,0x144B,0x6CB,0x362,0x71B,0x23B,0x184D,0xC7,0xDB4,0x26A,0xA8B,0x9F0,0x13FD,0x658,0x8B3,0x17},{0x123F,0xE94,0x939,0x1AEF,0x11C0,0x1D24,0x15CB,0x3E0,0x5FA,0x27,0xA09,0x887,0xA69,0xF3F,0x1A12,0x145E,0x183C,0x11,0x493,0xBA},{0x1CC5,0x1E2,0x79C,0x83F,0x613,0x1CA7,0xA47,0x4E1,0xD56,0xABB,0x15FB,0x9EA,0x1E9C,0x807,0x1E82,0xDC3,0x181B,0xBC0,0x16BD,0x168}},
+    {{0xAD8,0x1E93,0xF2C,0x1EA5,0x1DD6,0x18EB,0xB70,0xB89,0x608,0x643,0x1A13,0x1A98,0xD11,0x1D04,0x14BC,0x5F1,0x412,0x1BA2,0x1FB5,0x98},{0x2EA,0x1794,0x45A,0x842,0xB6F,0x186F,0x936,0x14AD,0x100A,0x688,0xCC2,0x108D,0xC51,0x1109,0x1153,0x160B,0x866,0x120C,0x1414,0xE1},{0x187B,0x659,0xA34,0xCB4,0xD51,0x1D79,0xE14,0x14A1,0x16D4,0x17C5,0xF51,0x441,0x109E,0x1D4C,0xFF9,0x1948,0x7F3,0x1F97,0x1DD0,0x1D6}},
+    {{0x1E4A,0x190C,0x42B,0xBD7,0xC2F,0x1BAE,0x16D9,0xCE1,0x4C7,0x1F36,0x12A6,0x5B8,0x19F5,0x1B54,0x1B8B,0x197A,0x1482,0x26E,0xE85,0x72},{0x1462,0x1898,0x103C,0x1B32,0x3BA,0x27B,0x6EC,0x4C4,0x4A,0x3A2,0x1D3C,0x29B,0x38C,0x1CD3,0xA96,0x171A,0x1F84,0x1C9B,0x1A71,0x194},{0x1821,0x1731,0x1F2D,0x1965,0xCF,0x138A,0x402,0x4B1,0xFAF,0x1FBF,0x1A26,0x37B,0x1021,0x76B,0x172F,0x172A,0x1C35,0x88B,0x1866,0xAF}},
+    {{0x1823,0x429,0x1F36,0xF16,0x1EB6,0xDA8,0x17B7,0x147E,0x126D,0x122A,0xD98,0x90E,0xD2E,0x338,0x701,0x5FC,0x1C2E,0x1B53,0x219,0x191},{0x755,0x11B0,0x1AB3,0x1142,0x10E2,0x641,0x1FF7,0x16E5,0x1F59,0x16F0,0x1E17,0xD9A,0x1ED8,0x14C2,0x14A0,0xB14,0x198E,0x127F,0x1AD2,0x4B},{0x14B0,0x130D,0x86F,0x1FF7,0x1647,0x141C,0x5BA,0x108F,0x19FC,0x17B6,0x38E,0x218,0xA7F,0xF08,0x1CDB,0x1826,0x11EE,0xC5A,0x597,0x1C4}},
+    {{0x14D,0x3D3,0x93E,0x27C,0x37F,0x256,0xEB1,0x98E,0xA83,0xABF,0x185A,0x25A,0x12FA,0x94C,0x12F0,0x16C5,0x1F40,0x11C,0x1007,0x56},{0x182C,0x1A6F,0x16B5,0x3A8,0xED3,0x14B3,0x19AC,0x1B6F,0xF0A,0xDE3,0xDAE,0xB87,0x15F2,0xE63,0x5CB,0x4AD,0x3AE,0x17CD,0x1248,0x193},{0xE68,0xBC0,0x1DFD,0xA2C,0x1EA2,0xD60,0x180C,0x755,0x1C60,0x189B,0xB94,0x9FC,0xFE8,0x7BD,0xF55,0x5D,0x199F,0x1F2,0x1DEE,0x1A9}},
+    {{0xE11,0x1C51,0x4B5,0x1447,0x18A5,0x1F21,0x409,0x1070,0x108D,0x1D0E,0x17B5,0xD0C,0x14DD,0x1014,0x1A79,0x1BC4,0x828,0x1293,0xF51,0x1D1},{0x1CD0,0xA1A,0x159,0x15B2,0x19B,0xC88,0xA84,0xB12,0x575,0x587,0x1248,0x76B,0x1589,0x1946,0xDAE,0x6F2,0x1CA4,0x1076,0x1B8A,0x3F},{0x1824,0x1714,0xA5D,0x197A,0x1E22,0x108,0x890,0x1DD3,0xE54,0xFD8,0x1C7,0x635,0xE73,0x1626,0xE70,0x11C,0xC88,0x308,0x1A34,0x147}},
+    {{0x497,0x1106,0x123F,0x13B5,0x17D3,0x1B8E,0x10BC,0x1AD,0x1C09,0xFDF,0xFA6,0x442,0x12EC,0x993,0x1C53,0x1A92,0x1120,0x133A,0x1138,0x1A0},{0x1ABD,0x1D14,0xB89,0x16AF,0x17D4,0x855,0x149A,0x1053,0x74F,0x15F5,0x1105,0xF73,0x1E74,0x64F,0x16AE,0xA71,0x79C,0xFE0,0x50B,0xEB},{0x543,0x534,0x2DA,0x1B6E,0x478,0x1D6E,0xCE3,0x61,0x12D7,0xD44,0x97F,0x1CC9,0x1040,0x115F,0x1483,0x725,0x1D28,0x1A6A,0x1561,0x3D}},
+    {{0x1233,0x752,0x1824,0xB56,0x1684,0xB0,0x20B,0x1977,0x1AC7,0x13EA,0xC76,0x1F42,0x1A91,0x1C3A,0x121A,0x20B,0xDB3,0x11CC,0xDED,0x9F},{0x9DA,0x1E1F,0xD25,0x693,0x17C3,0x6DA,0x174C,0x12F2,0x6E8,0x966,0x1B4A,0x483,0x1EAA,0x1C6E,0x151B,0x7E7,0x1848,0x1754,0x1117,0x1DA},{0x1F00,0xBB4,0xFD1,0x1AFA,0x14BC,0x185F,0xD10,0x12D9,0x1578,0x1F45,0x1DE3,0x233,0x1698,0x1BF5,0x712,0x7D8,0x1500,0x1D3,0x13AE,0xC8}},
+    {{0xFD6,0x1559,0x8CB,0x499,0x10E,0x192D,0x1F94,0x46D,0x1B09,0x1319,0x1E28,0xA7E,0x54,0x1ED,0x120E,0x882,0x1E79,0x1218,0x1816,0x1FB},{0x5C6,0x1279,0x1B8C,0xAA6,0x1850,0x1C62,0x689,0x14F6,0xA86,0x15EB,0x894,0x1E03,0x1854,0x1692,0x1921,0x6D0,0x250,0x806,0x1ECB,0x3B},{0x706,0x594,0x1AE4,0xD11,0x477,0x51C,0x230,0x1298,0x1289,0x4F2,0x13F2,0x1F3A,0x146E,0x9A7,0xFE5,0x1C76,0x191,0x1C3,0xEF,0x107}},
+    {{0x1D2E,0x13FD,0x12DD,0x1BAE,0x1DFF,0x1F3C,0x12D3,0x58F,0x84,0xF47,0x1642,0x13C,0xB89,0x689,0x4DF,0x1DF8,0xAC3,0x371,0xE52,0x13B},{0x58,0x757,0xDB6,0x1C47,0x16B0,0x1943,0x5E4,0x168C,0x18DD,0x1809,0xD20,0x9A6,0xC98,0xC8F,0x1E90,0x3A0,0x1FF7,0x12B2,0x16CF,0x127},{0x11C7,0x10CB,0xB90,0x6F0,0xAD0,0x1BAF,0xB77,0x125D,0x112C,0x12C6,0x2BE,0x1B05,0x26,0x10CE,0x33A,0x6D4,0xF8F,0x1E29,0xE71,0x92}},
+    {{0x2AB,0xF33,0x4C7,0xA50,0x24,0x1AD8,0xA04,0x18C7,0x10A7,0x10E0,0x100,0x485,0x1D0,0xF23,0x1A5E,0x1BDF,0x801,0x183C,0x1438,0xCB},{0x1B6C,0xD1E,0x117A,0x1370,0x1EB7,0x88D,0xD11,0x19AF,0x12B,0xDA1,0x772,0x13AC,0x1FFE,0x1D3E,0x15EF,0x1412,0x10F4,0x7A8,0x6BE,0x1FB},{0x1A7C,0x1079,0x17CA,0x65E,0x2CD,0x1615,0x1328,0xF67,0x1222,0x1DA5,0x3A2,0x132B,0x817,0x5CC,0x1898,0x89F,0x1654,0x1357,0x137D,0x193}},
+    {{0x1905,0x174,0x2F6,0x7D1,0xD75,0xB7F,0x269,0x980,0xBEA,0xBBA,0xFB9,0x1A0,0x1743,0x16B5,0x8CB,0x1C77,0x1E3,0x1989,0x13B1,0x126},{0x8A3,0x1C81,0x326,0x1DA1,0x1DFD,0x193E,0x94E,0x325,0x5CF,0xE57,0x857,0x195B,0xC4A,0x638,0x1A74,0x78E,0xD62,0xD0B,0x163A,0x12E},{0x12BF,0x128F,0x16CB,0x15D1,0x1E1C,0x1B37,0xA19,0x1666,0x1454,0x1A07,0xF3F,0x6BE,0xE68,0x16FB,0x1670,0xABA,0x1B4D,0x1718,0x1B2,0x41}},
+    {{0x5D0,0x4B,0x603,0x75B,0x1A5B,0x7EB,0xE89,0x174,0x154A,0x1245,0x6A7,0x1998,0x1017,0x1577,0x711,0x1334,0x296,0x1108,0x21E,0xFF},{0xAB6,0x4CB,0x1FEF,0xE38,0x1233,0xDD1,0x431,0xAF9,0x13E3,0x1A4A,0x10F9,0x6AE,0x1063,0xD8E,0x14E4,0x133,0xA66,0x190E,0x1680,0x1A5},{0x18EC,0x1F22,0x356,0x47D,0x173F,0x1C71,0x1969,0x1981,0x9DA,0xDFE,0x101B,0x12A6,0xD52,0x6B3,0xC76,0x1FAD,0x4CD,0x88D,0xB53,0x16A}},
+    {{0x1381,0xD6,0x1BF8,0x46F,0x13CD,0xFDA,0x615,0x5E0,0x107B,0x19B3,0x384,0x1C24,0x966,0x124D,0x1E42,0x841,0x1A82,0x866,0x35F,0xF4},{0x1A9C,0x22C,0x1537,0x15EC,0x1D89,0x285,0x425,0x72A,0x188A,0x1848,0x169E,0x1D2B,0x830,0x1A72,0x10AB,0x18C8,0x271,0x13A5,0xDBF,0x175},{0x65E,0x14F7,0x4C6,0x3D9,0x43C,0x1F75,0x1ED7,0x1F49,0x1F47,0x92B,0x1CAE,0x1B11,0xF7A,0x1CF,0xD93,0x1614,0x94B,0x794,0x156A,0x18A}},
+    {{0xC9B,0x1A9F,0x1292,0xD57,0x4EE,0x1B13,0x1D4B,0x1626,0x9CF,0x1E0B,0x17EB,0xA07,0x1524,0x5AE,0x1B4,0xCA4,0x1046,0x19FE,0xCCC,0x113},{0x893,0x1B05,0x1FB1,0x1909,0x17AE,0xD25,0x1D68,0x17E1,0x125E,0x1D25,0xDDE,0x17F7,0x652,0x891,0x1119,0x1D20,0x1BDD,0xBB2,0x1006,0x74},{0x1497,0x17DB,0x11F9,0xD18,0xF83,0xA69,0x1597,0x2BF,0x4C8,0x104F,0x1838,0x1229,0x169B,0xBFC,0x7C2,0x1225,0x106E,0x178F,0x1466,0x18A}},
+    {{0x12C,0x2CF,0x1D90,0x8AB,0x1937,0xBCC,0x538,0x1AD1,0x103B,0x18FA,0x91E,0x3B3,0x156,0xD91,0x1BE9,0x641,0xC1C,0x2F9,0x759,0xA6},{0x1F68,0x1F33,0x1680,0x52A,0xE5C,0x155,0xD25,0x1BD8,0x1899,0xEF0,0x1F1A,0x1F97,0xEEC,0x1BC0,0x1434,0x7A0,0x909,0x149D,0xC4B,0x153},{0x130B,0xC25,0x1A85,0x1492,0x1479,0x9A2,0x3AF,0x14C4,0xEE6,0x11E,0xFA0,0x206,0x1ACC,0x1CA6,0x1A09,0xA7C,0x1F89,0x1911,0xB32,0x18B}},
+    {{0x138C,0x86,0xB36,0x1C5A,0xFA0,0x1332,0x191F,0x1256,0x129,0xAC,0x8D5,0x1189,0x1D27,0x1DCE,0x1C8D,0x1235,0x1525,0xDA2,0x1590,0xC7},{0x7E8,0xDA5,0xDC8,0x112C,0x118C,0x7A3,0xF34,0x215,0x105E,0xCEE,0x1DAC,0xBB4,0x98E,0x1A19,0x1BFC,0x192D,0x15CE,0x1EBC,0xF9,0x15A},{0x1519,0x1F6F,0x1EAF,0x1A1,0x144,0xDA2,0xC0C,0x187A,0xF4C,0x187A,0xF11,0x1D9B,0x1903,0xBFA,0x607,0x1651,0x7E9,0x9C1,0x10FE,0x12A}},
+    {{0x17E8,0x1AED,0x1D55,0x1A9D,0xA51,0x170A,0x1F0,0xBB3,0x123A,0xE54,0x40D,0x99D,0x1DC2,0x10D4,0x1987,0xB98,0xAF1,0xF85,0x1694,0x7D},{0xF31,0x1BDB,0x15D6,0x703,0x708,0x6C5,0x223,0xCEE,0x1EDE,0x18B2,0x1773,0xE98,0x1076,0xB23,0x1014,0xCF6,0x1F5D,0x97F,0xAA2,0x4},{0xA52,0x828,0x742,0xBB4,0x66F,0xF35,0xC8F,0x11F9,0xACC,0x593,0x1AC0,0xC40,0x1208,0x11,0x1101,0xA4D,0x17C2,0xE25,0x2E8,0x4}},
+    {{0x5CD,0x409,0x9D0,0x17A7,0x1BC7,0x1927,0x1F22,0x12E5,0x1A33,0xB2B,0x1F25,0xA43,0xA4F,0x1D81,0x1FDB,0x1BD,0x1C4,0x1AF3,0x97C,0xF1},{0x1519,0x18E6,0x1520,0x10CE,0x1B7A,0xAE7,0x165C,0x16B2,0x1445,0xE91,0x10B1,0x399,0xEB1,0x4BD,0xD33,0xA05,0x1837,0x133E,0x1A9D,0xBE},{0xFAB,0x147,0x11FE,0xDE1,0x9F9,0x24A,0x27F,0x5F4,0xB80,0xBFB,0x394,0xE16,0x15D1,0xE4,0x1B39,0x1065,0xC00,0x7F1,0x1A10,0x1}},
+    {{0x1EF0,0x1C8D,0x169D,0x1BF5,0x237,0x9E1,0x1375,0xE9F,0x1C8,0x1A2C,0x1D95,0xD28,0x1BF6,0x420,0x1980,0x10,0x128,0x1AF7,0x3C0,0x13D},{0x1025,0x842,0x1B3A,0x179E,0x5C8,0x1FBF,0x583,0x9ED,0x1C63,0x1089,0x9FB,0x1667,0x1659,0x1460,0xA9,0x185F,0x58E,0x354,0x1633,0x1B1},{0x65A,0xB5B,0xDE9,0x871,0x1F1E,0x4C5,0x19F2,0x2DA,0x1F1F,0x1246,0xEC,0x16E8,0x12D2,0x100B,0xE7A,0x1FAD,0x59,0x1046,0xA56,0x160}},
+    {{0x492,0x8EC,0x1AB3,0x43E,0x18B3,0x6C6,0x1EA6,0xA30,0xD1,0x1809,0xFC,0x15A4,0x453,0x1580,0x8C1,0x1B65,0xDFA,0x1DAA,0x1985,0x147},{0x72D,0x76B,0x155E,0x1634,0x1A5F,0x1C33,0xCB9,0x161D,0xCBF,0x1BF7,0xDBC,0xC79,0x1B5D,0x1B8C,0x655,0x1288,0xD14,0xF40,0x1328,0xEC},{0x1B3F,0xE2,0x14B9,0x16D3,0x1E9F,0xEB0,0x125E,0x128D,0x1E9A,0x1DA5,0x1E7F,0x9E6,0x1EA8,0xDC9,0x6B3,0xF3B,0x1AEA,0x1B1D,0x10DF,0x1BD}},
+    {{0xA1E,0xF95,0x16D,0x12E3,0xCE4,0x8EA,0x1001,0xD40,0x1806,0xCD4,0x1C3D,0x6E3,0x4F4,0x699,0xB2C,0x196B,0x141E,0x1004,0x7D4,0xE8},{0x17F8,0x61F,0xC5B,0x19CF,0x1606,0xF2D,0x1F61,0x141C,0x62,0x19B,0x980,0x1291,0xD75,0x10C5,0x1B82,0x8E8,0x1383,0x19BF,0x249,0x1B7},{0x675,0x178D,0x191,0x543,0xE8E,0x1709,0xF73,0xD64,0x1FCE,0x335,0x11D6,0xACE,0xDC4,0x647,0xB0A,0x1E99,0x111E,0x6FF,0x11BA,0xB}},
+    {{0xDCF,0x90D,0xC18,0x12CB,0x9DC,0x320,0x7A,0x642,0x188E,0x2D4,0x861,0x774,0x796,0x2A3,0xE2E,0xC70,0x1876,0x1EFE,0x877,0x3},{0xDBB,0xB0D,0x148D,0xA83,0x2E5,0x1B8D,0x7BB,0x15CD,0x1221,0x1025,0x10E,0x697,0x93A,0xB0E,0xB92,0x753,0x75A,0x98D,0xDFF,0x114},{0x1A78,0x1EEB,0x506,0x1DF3,0x7D2,0xFC4,0x8DE,0x1E0,0x1C2C,0x280,0x1D5B,0x2EC,0x1B17,0x266,0xA79,0x2B4,0x31,0x681,0x64A,0x13C}},
+    {{0x1025,0x47E,0x1777,0x148,0xAD3,0x429,0x1B54,0xA85,0x261,0xBDA,0xCCF,0xB15,0x89E,0x13A,0x13CB,0xB74,0x1B4D,0xCFD,0xEF6,0xE1},{0x15D5,0x31C,0xFDA,0x1E1,0xD78,0xE50,0x6F0,0x12A4,0x1507,0x17BD,0x14BC,0x64F,0x1175,0x8C6,0x123B,0xED6,0xD69,0x1785,0x81B,0x9},{0x394,0x1E48,0x1DD3,0x1F84,0x13B7,0x16E1,0x6A1,0x5E7,0xC82,0x10CC,0x2F4,0x504,0x523,0x1DF7,0x57F,0x1646,0x1815,0x1EBB,0x1586,0x157}},
+    {{0x307,0x1EE3,0x7EF,0xBB6,0x16D8,0x5E1,0x608,0x975,0x909,0x1176,0x10CE,0x1E01,0x422,0x19B1,0x1380,0x276,0x17AB,0x1ED2,0xD23,0x116},{0x1E38,0x1A3E,0x9BC,0x138D,0x1728,0x1DB,0x109,0x4D1,0x531,0x6C9,0xA8A,0x1577,0x9AD,0x15CA,0xBC2,0x1AE6,0x1B32,0xFAA,0x12F8,0xCF},{0x1218,0xB02,0x1A3F,0x1DB6,0x1443,0x1DA7,0xC00,0x18A,0xB6E,0x149F,0x1A7F,0x1A94,0x90A,0xE6D,0x70A,0x10E3,0xAA0,0x199B,0x1487,0x191}},
+    {{0x519,0xE09,0xBA3,0x13BC,0x1AB9,0xD76,0x1FAD,0x370,0x1439,0x182B,0xD24,0x6E5,0x163A,0x673,0x131D,0x1B3D,0x1BA6,0x84,0xC14,0x168},{0xD72,0x853,0xA22,0x1855,0x1150,0x1318,0x36D,0x1B5,0x3B4,0xE2A,0x3B0,0x1588,0x272,0xF9B,0x1FF7,0x947,0x1ABC,0x1378,0x15BE,0x17C},{0x1CC1,0x16CA,0x17E7,0x2F6,0xA84,0x475,0x599,0xF2D,0x147,0x101E,0x57A,0xD0A,0x9CC,0x690,0x480,0xA36,0x869,0x16C9,0x163B,0x6F}},
+    {{0x161A,0x87,0x8EE,0xFFA,0x38C,0x1A56,0x13A,0x9A7,0x86F,0x536,0x3B6,0xB0,0x19B8,0x1980,0x1905,0x19,0x11F2,0x16F0,0x1990,0x16F},{0xA5C,0x1E8E,0x16FC,0xDF4,0x3B8,0x176A,0x52E,0x1519,0x46A,0x1898,0x1A0B,0x21,0xDFE,0x829,0x1421,0x1E5F,0x122F,0x905,0x1906,0xB1},{0x8F5,0x58,0x147B,0x155C,0x19F1,0x10FB,0x1E4B,0xDA7,0x5CC,0x5F9,0xEC6,0xF0F,0x1F32,0xC59,0x30B,0x2A6,0xF09,0x8F4,0x1521,0x1E}},
+    {{0x178,0x1EE2,0xDEB,0x41B,0xAF1,0xA78,0x6D8,0x115A,0x129,0xA0E,0x898,0x1780,0x17DC,0xFC0,0x535,0x5CD,0x1C38,0x4F4,0x11D4,0x105},{0xD3E,0x775,0x91F,0x1650,0x11CF,0xA62,0xFBB,0x1B31,0x785,0x149B,0xB7C,0x1EBF,0xB0F,0x1B17,0x1DCB,0x1EE4,0x5D2,0x1A71,0x114D,0x1BB},{0x1EFB,0x1C7B,0xEBF,0x1CBF,0x1F20,0x1E9D,0x13AC,0xD71,0x652,0x8DA,0x1742,0x1A1D,0x5D0,0x1348,0x1CC9,0x260,0x118,0x1EEA,0x1107,0xDF}},
+    {{0x19EF,0x76C,0x1FDD,0x174E,0x15D8,0x5CC,0x1319,0x91,0x1D81,0x1E29,0x1648,0x956,0x10C4,0x1318,0x19E,0x1AD1,0xA64,0x1B29,0x8A0,0x199},{0xFDD,0x1814,0x715,0x1829,0x51F,0x7C0,0x145A,0x1B57,0x173F,0x9C7,0x1A29,0x32D,0x1D3D,0x7C4,0x106D,0x1D9D,0x1573,0x14F3,0x238,0x1D8},{0x192D,0x18E9,0x1084,0x168B,0xC78,0xC8,0x1370,0x116B,0x2D4,0xBF2,0x125D,0x733,0x1992,0x32A,0x17E8,0x1505,0x6C3,0x1DCF,0xC4D,0x1ED}},
+    {{0xCE1,0x1C0,0x3AA,0x1CDA,0x25A,0xF1B,0x1FD7,0x1AC0,0xC28,0x1D90,0x1DB9,0x1D2A,0x1F0C,0x1F25,0x1550,0xC14,0x129B,0x1FA2,0xCD7,0x16},{0x1D2E,0x2F1,0xC5B,0xC26,0x18F1,0x515,0x12F,0x9CA,0xB50,0x1C36,0x1DA6,0x5C4,0xD79,0x1D08,0x1FE4,0xAEB,0xAB0,0x392,0xAC8,0x4D},{0xC05,0x1990,0x1635,0x1C26,0x129B,0x6C0,0x1BF8,0xEE8,0x1B68,0x1B3E,0x173A,0x3BB,0xACC,0x10E4,0x663,0x6C7,0x918,0x34B,0x26E,0x1A0}},
+    {{0x12CF,0x1C4,0x1128,0x1251,0x16E9,0x1935,0x16AB,0xA23,0xAD8,0xDC6,0x1F3F,0x1386,0x11A,0xA6F,0x1B7F,0x1C57,0x787,0x799,0xDB1,0xDA},{0x9CB,0x176F,0xD14,0x190E,0xE73,0x14AE,0x4E4,0x125B,0xDAC,0x133D,0x1DF,0x14A4,0x1884,0x1289,0x674,0xB27,0xE6D,0xE1E,0x1C3B,0x81},{0x5EB,0x157E,0x16F7,0x1CFB,0x101E,0x16E3,0x376,0x6B3,0x1AFB,0xB94,0xE7E,0x13E8,0xF4F,0xA4A,0x14B7,0x84D,0x172A,0xCD,0xE50,0x16C}},
+    {{0xC8E,0x192B,0xBA3,0x281,0xD2A,0x685,0x12BF,0x12EA,0x30C,0xF6C,0xF80,0x10EC,0xED8,0x46C,0x12B5,0x1153,0x1A96,0x17B4,0x1777,0x1C3},{0x1327,0xB6F,0x35,0x16BD,0x243,0x105F,0x166B,0x1AD5,0x1BF3,0xA6E,0x23F,0xF64,0xEF9,0x951,0x18F8,0x4F0,0x1BCB,0x1490,0x66B,0x83},{0xA36,0x1F29,0x1240,0xE59,0x19CB,0x1C6A,0xCF4,0x850,0xF94,0x635,0x200,0xCAF,0x2B9,0xA78,0x1BC3,0x1DC3,0x14A1,0xBD5,0x327,0xDC}},
+    {{0x1B03,0x5B3,0x39F,0xCCD,0x284,0x6A9,0x1B75,0x1EA5,0xE0F,0x1381,0xF2B,0x1A5F,0x76C,0x120C,0xA8F,0x1C3F,0x1954,0x6FC,0x119B,0xC},{0xC94,0x372,0x38D,0xE81,0xB19,0x15AC,0x12DD,0x12BD,0x1F20,0x52A,0x1137,0x19CB,0x1CAC,0x10AB,0xA38,0xBD2,0xA3B,0xFF7,0x689,0xF3},{0x1770,0x29B,0xBDC,0x1FE2,0x158,0x1F33,0x33B,0x15FC,0x1FC0,0x24B,0x4B6,0xB21,0x1F2B,0x1C95,0x1CA,0x1037,0x1D18,0x1A85,0x326,0x132}},
+    {{0x1722,0xE62,0x291,0x12E1,0x1B26,0x1883,0x4D5,0x82,0x670,0x1DD5,0x144,0x15EA,0xEB2,0x906,0x1FCA,0x857,0x1B76,0x90E,0xD42,0x194},{0xA4B,0x6B7,0x132B,0x107F,0x1D2C,0x572,0xA83,0x273,0x46C,0x88A,0x178C,0x1C08,0xB7,0x75C,0x177E,0x133A,0xB2B,0x814,0x108B,0x1CF},{0x711,0xF9B,0x1BF6,0x63D,0x1DCB,0x442,0xA1B,0x962,0x149B,0x1756,0x98D,0x14DD,0x152D,0x692,0x1E9F,0x18B6,0x1471,0x8C9,0x975,0x12D}},
+    {{0xF64,0x1713,0x1E13,0xD83,0x1D33,0x41C,0x6F0,0x5AE,0xF25,0x7A8,0x560,0xD03,0x80E,0x175C,0xC43,0x23D,0xB8E,0x130C,0xD6E,0x9},{0x7E7,0x1378,0x497,0x1777,0x1FC1,0x1C1E,0xEAF,0x1060,0x1521,0x1E66,0x264,0x1D1A,0x132F,0x268,0x1752,0x145A,0x1946,0x1477,0x14AF,0x1BE},{0x1AD3,0xE06,0x931,0xF24,0x107B,0x159E,0x1364,0x1E34,0x172E,0x162E,0x1C66,0x12BD,0x207,0xDE,0xA06,0x1781,0xC28,0xBB2,0x642,0x139}},
+    {{0x2E,0xB56,0x1D6A,0x175F,0xE96,0x1F75,0x13E8,0xF14,0x1E8B,0xA01,0x2BF,0x165F,0x300,0xB7D,0x484,0x1E7,0x554,0x5E8,0xCB8,0xDE},{0x672,0x190F,0x1EB5,0x113C,0xC87,0xBCB,0x76,0x16B9,0x1AFF,0x3EC,0x1096,0xB00,0x149F,0x1C80,0xA68,0x876,0x1F4D,0x258,0x88F,0x121},{0x1149,0x140B,0xB20,0x50B,0x1CE4,0x1D3A,0xEB4,0x1E45,0xB97,0x1661,0x1C3D,0xA9C,0x1A63,0xD3F,0x1FEA,0x768,0xE1E,0x1399,0x593,0x1D6}},
+    {{0xE1A,0x10E1,0x1598,0x671,0x1C74,0x583,0x1DA8,0x1008,0x1C04,0x1AEE,0x1FB,0x1BD,0x35,0x1097,0xD77,0x87D,0x1A3A,0x10B,0x1079,0x63},{0x129C,0x12E6,0x1A55,0x1A39,0x20F,0x114C,0x9C5,0x103,0x1DC7,0xFF1,0x638,0x1E80,0x1DAC,0x1573,0x1D4B,0x1559,0xF14,0xB83,0x1F5A,0x1A9},{0x188,0x1BE7,0x437,0x8DD,0x1D2,0x1812,0x1E11,0xE34,0x11E0,0x10AB,0x1317,0xA5D,0xB5C,0x10F6,0x194C,0x13AB,0x19A4,0xE9F,0x1086,0x30}},
+    {{0x185B,0x1906,0x1E85,0x197A,0xA1,0x1BDE,0x935,0x1768,0x151F,0x43D,0x1AB1,0x828,0xB6C,0x11CB,0x1B16,0x13DA,0x109F,0xB6F,0x13A0,0x185},{0x1018,0xEEB,0x1C01,0x191B,0x3F2,0x142D,0xC27,0x21B,0x1ACD,0x154F,0xA07,0x488,0x1AD1,0x84E,0x1087,0x1B49,0x7E,0x1D35,0x805,0x10C},{0x1AF5,0x1A28,0x1F2F,0x1190,0x11F3,0xF55,0x11B5,0x1E5D,0xA19,0x1320,0x10F3,0x1321,0x811,0x7C8,0xBB9,0x1F20,0x170C,0x7F7,0xA3,0x198}},
+    {{0x1EF8,0x1EC8,0x1687,0x1461,0x1A4A,0x1399,0x491,0x1630,0x1D0E,0x7E0,0x131,0x1557,0x3A3,0x1D7A,0x1882,0x189B,0x13AD,0x209,0xDBB,0x1D1},{0x1B17,0x1FB1,0x160F,0x1B50,0xC02,0x14A8,0x1019,0x1391,0x424,0xDD8,0x1BF0,0x19DE,0xCB8,0xA0D,0x1B15,0xD25,0x1E8,0x1BB,0x10C4,0x19},{0x10C0,0x16B3,0x1561,0x901,0x1BD4,0x7E7,0x10C9,0x1589,0x138E,0x27D,0x18C6,0x451,0x199F,0xB95,0x95D,0x11B1,0x1B17,0x1553,0x1622,0x40}},
+    {{0x1D5A,0xEBD,0x1864,0x1892,0x1CB5,0xDE5,0x6BA,0x283,0x535,0x1746,0x463,0x59E,0xB85,0xF15,0xD41,0x5D9,0x183,0xCBD,0x191E,0x13C},{0x1CFC,0xBA9,0x79B,0x8BD,0x14B4,0x19F8,0xF78,0x166E,0x4C6,0xB72,0x1042,0x1950,0x161B,0x183C,0x10B2,0xC89,0x1EFB,0x15AA,0x5B5,0x14E},{0x916,0x1A1D,0x5B3,0xE8,0x5FD,0x331,0x16A,0x16D4,0x9C7,0x1BCF,0xB2A,0x6A0,0xD,0x133B,0xC0E,0xC04,0x1587,0x35C,0x1ED9,0x19}},
+    {{0x145C,0x681,0x444,0x12B8,0xECA,0x14C,0x1D99,0x1327,0x47F,0xEC3,0x659,0x254,0x179F,0x1A0B,0x1601,0x16FB,0x1339,0xB79,0x1BC5,0x3E},{0x75,0x135C,0x398,0x1AF,0x198F,0x104B,0xBDF,0x1B25,0x15BB,0x470,0x137,0x13BD,0x11E6,0xBFE,0x1223,0x1B3C,0xA32,0x159B,0x422,0x1D9},{0x16A2,0x170,0x1EAA,0x85,0x8F8,0x1763,0x1D33,0x895,0x1D07,0xC5B,0xC53,0x363,0x16C0,0x1F9C,0x942,0x8B4,0x1CF4,0xE3,0xD0,0x5}},
+    {{0x8FB,0xC5B,0x1B77,0x1DF9,0x16FA,0x1D78,0x62A,0xBFE,0x61,0xEDB,0x1E12,0x334,0xCF7,0x148F,0x4C8,0xFC0,0x15E8,0x61E,0x12CC,0x185},{0xDDA,0x11DC,0x198D,0xC2E,0x92E,0x17E0,0x87F,0x8D6,0x10B2,0x1A3F,0x1B46,0x6A,0xF2C,0x19FD,0x14DB,0x1848,0x61,0x1D5C,0x1E34,0xC9},{0x171,0x703,0x2A9,0x1565,0x908,0x1C42,0xF80,0xF4B,0x19A7,0xBC8,0x1C79,0x20E,0x342,0x29F,0x19D7,0x19A,0x1D74,0x6F2,0x79A,0xBC}},
+    {{0x121F,0x87C,0xC83,0x1411,0x12C3,0x15A3,0x6D8,0x11F,0x1C72,0x1B63,0x183F,0x860,0x9DD,0x1BB2,0x171F,0x54F,0x11EC,0x4AC,0x16CE,0x1E5},{0x11AC,0xEAE,0x11E6,0x127,0x1ED7,0x67C,0xF2C,0x18EE,0x8E6,0xDBC,0x592,0xA44,0xEE1,0x11BC,0x11A2,0x1C9B,0x17FC,0x351,0x1D39,0x1AA},{0x84D,0xAE9,0xF5D,0x180,0x12E3,0x18F1,0x1A3A,0x1505,0x9BB,0x13C2,0x274,0x1BCF,0x1B05,0x18CC,0xA76,0x159E,0x1FFC,0x1145,0x127F,0x1A0}},
+    {{0x1882,0x13D2,0x1F8D,0x4B6,0x461,0x6FC,0x1110,0xD14,0x15A3,0x199F,0xF5A,0x1F1C,0x1B8F,0x1DB6,0x5C2,0x122,0xE7,0x610,0x1A9,0x1E2},{0x1335,0x1D8A,0x1428,0x1ADC,0xD20,0xE55,0x1474,0x1E23,0x2E7,0x1601,0xC95,0x908,0x1CD0,0x37D,0x1F83,0x6E9,0x1BE5,0x1CA4,0x10CC,0x135},{0x2C0,0x1ED8,0x26D,0x1498,0x1C0,0x489,0x583,0x97A,0x1995,0x11FC,0x2F4,0x1977,0x1CF,0x18F4,0x17A6,0xB2B,0x254,0xC34,0x9C2,0x12A}},
+    {{0x1D1C,0x15F7,0x18CE,0xE15,0x1FB7,0x1FA0,0x1FFE,0x1477,0x258,0x1C0C,0x886,0x1B75,0x1AA6,0xE67,0xFF4,0x12E7,0xA04,0x8DC,0xFCD,0x1F6},{0x1B21,0x99C,0xB12,0x8F1,0x3B3,0x1A65,0x97B,0x1F72,0x191,0x1493,0x574,0x538,0x3F3,0x177,0x1FB5,0x1CA1,0xA61,0x43B,0x1752,0x119},{0x5D5,0x1707,0x141F,0x18E2,0xF9E,0xD35,0x571,0x1C7B,0x173,0x1C25,0x15F1,0x59F,0xC2,0x9A1,0xC2A,0x136F,0x90B,0x1C83,0x1794,0x1CF}},
+    {{0x1B78,0x17B2,0x6AD,0x2AF,0x4E0,0x156A,0x125F,0x1629,0x1680,0xA33,0x1194,0x1B66,0x4AD,0xFCE,0xA49,0x1469,0x1C97,0x996,0x1D23,0x9B},{0x1663,0x1C67,0x1A6D,0xFC7,0x1EC3,0x403,0x1248,0x124D,0x1E1D,0x37C,0x1B2C,0x3CF,0x13F2,0x1E5E,0xC74,0x1596,0x14A9,0x1F49,0x11B1,0x1DA},{0x1C41,0x1671,0xE0C,0x199A,0x18E8,0xC24,0x1AAA,0xB82,0x1DD4,0x167E,0x8E4,0x14B0,0x783,0x1B1C,0xB3C,0x15D7,0x11CE,0x176E,0xBD5,0x1A5}},
+    {{0x1FFD,0x1551,0xB4E,0x35,0xFBD,0x18E0,0x1C16,0x85D,0x1166,0x63F,0x324,0x42E,0x139A,0xA06,0x188F,0x1B93,0xB89,0x60A,0x1F46,0x25},{0x104A,0x11AD,0xE24,0x187F,0x1809,0x195F,0x2B9,0x62C,0x750,0x1182,0x17D7,0x1B67,0x1C2A,0x838,0x17B9,0xAFB,0x2A4,0xCD,0x1F1A,0xB6},{0xEAB,0x96F,0x13DF,0x1B2D,0x1543,0xBBB,0xF5,0x4E5,0x10C5,0x68A,0x2D1,0x1A4E,0xB0C,0x1AA5,0x12B8,0x1E15,0x1F5,0x17A0,0xF5F,0x1CD}},
+    {{0x1C5B,0x1D50,0x8F1,0x189B,0x60E,0x1C2A,0xA2C,0x1142,0x180F,0xA62,0x1187,0x16F2,0x158F,0xE75,0x1A63,0x1FCC,0x126,0x167,0x39C,0x1EE},{0x173A,0x86A,0x4E3,0x19D5,0xCD7,0x147A,0x100A,0xF44,0xD0D,0x8E3,0x2F4,0x3AE,0x790,0x770,0x16BC,0xC2D,0x1352,0x11FF,0xDCC,0x16C},{0x1863,0x1B5E,0xF7A,0xF73,0x15F6,0x1961,0x1D3,0x107C,0x9B0,0x1183,0x2F6,0x1260,0x424,0x100F,0x1207,0x1C78,0x106,0x3DA,0x5C9,0x1B4}},
+    {{0x836,0xC4A,0x313,0x7F6,0x1E15,0x363,0x159,0x57A,0x11DD,0x1297,0x52C,0x441,0x1506,0x12A8,0x1F78,0x33A,0x812,0xBFF,0xB39,0x15B},{0x437,0x534,0x5ED,0xB1F,0x99F,0xA6F,0xF9D,0xDD5,0xF48,0x73E,0x1DAC,0x539,0x2CD,0xA17,0x1666,0xD3A,0x898,0x671,0x593,0x97},{0x151A,0x119E,0x2DE,0x19F5,0x182F,0x1E2F,0x9CF,0x137A,0x1002,0x1770,0x19A0,0x1AF3,0x295,0x1CA3,0x72A,0x10B0,0x73A,0x6AF,0x1AB7,0x8D}},
+    {{0x1DA5,0xD16,0x1E7C,0x9B7,0x18E7,0x10B1,0x17D4,0x822,0x473,0x171B,0x1FFD,0xE78,0x6E4,0x9CF,0xF41,0x1DA5,0x112,0x171A,0xE19,0x189},{0x1F31,0x18EE,0x1906,0xC70,0x1EC2,0x199E,0x8E6,0x6B6,0x1C56,0x13B2,0x540,0x1066,0xAB3,0x144B,0x1627,0x17E3,0x1706,0x1928,0x1237,0xCC},{0x150C,0x308,0x1ABD,0xB70,0x11E7,0x50C,0x215,0xA9E,0x19E2,0x172A,0x1E59,0xE52,0x212,0x164E,0x1F82,0x1ED4,0x127F,0x1B8E,0xE13,0x1C0}},
+    {{0x1574,0x1169,0x962,0x713,0x25B,0x1F6E,0xBB0,0xAAC,0xBF4,0x1767,0x1B23,0x40F,0x1F3,0x196E,0x1F17,0xA95,0x1FD4,0x140E,0xAB,0x33},{0x1A38,0x1C3A,0x1C1A,0x80C,0x1D9B,0x8D2,0x11AE,0x6E6,0x194F,0x1161,0x1BA,0x1871,0x124A,0xE5B,0x19E5,0x7A5,0xF35,0x1907,0x82F,0xD5},{0x1783,0x7E2,0xFCE,0x132F,0x8FB,0x115F,0x1E64,0xEB9,0xE37,0xBB1,0x4AF,0x1CB5,0xCEF,0x89A,0x1C7C,0x1AA6,0x814,0x19B0,0x126D,0xC8}},
+    {{0xFDA,0x415,0x1F3B,0xB1C,0x7AB,0xF8C,0x1EC7,0xCFB,0x14B3,0x46F,0xD0F,0x1AA9,0x51B,0x1CEC,0x1336,0x825,0x1F0,0x14A9,0x11E0,0x7D},{0x7F5,0x1983,0xB96,0x1FD0,0xDC3,0xAF7,0x2CE,0xAB4,0xF72,0x3A7,0x1326,0x173,0x19C4,0x16D8,0x6A9,0xA2B,0x1C1A,0x907,0x670,0xBF},{0xDE8,0x3B9,0x2A4,0x1BBD,0x815,0x2A1,0x197D,0xB24,0x944,0x7D0,0x11EE,0x1AC5,0x451,0xE44,0x1E1A,0xD43,0x9FC,0x1543,0x946,0x155}},
+    {{0x6E4,0x770,0x10C0,0x3BF,0x1241,0x13AE,0x13C9,0x584,0x10C8,0x11DE,0x104C,0x424,0x9F7,0x1AA8,0x16D9,0x12BE,0x197C,0x1E26,0x1E47,0x75},{0x181A,0x1B84,0x14DB,0x9EC,0x1AFA,0xC41,0x443,0x1691,0x10A5,0x80C,0x8E8,0x10EC,0x163,0x1E45,0x1C8F,0x360,0xDC8,0x63A,0x11D9,0x19A},{0xE2B,0x1EF9,0x161,0x1D7C,0x135B,0xD5D,0x128D,0x11A7,0x178C,0x10FF,0x16BE,0xD2F,0x1CB0,0x3B0,0x1627,0x31F,0xE8D,0xF06,0xA69,0x1B0}},
+    {{0x1296,0x1E83,0x136C,0x1E56,0x19CF,0x1757,0x1BFE,0x19ED,0x1563,0x187,0x13D9,0x10CE,0x1D54,0x1AC9,0x273,0x49D,0x1FE6,0x3C,0x1FD9,0x1AF},{0x1BB3,0x19C2,0x109D,0x1DEC,0x19F8,0x1C37,0xA80,0x1CD9,0x1B9A,0xB59,0x1AB7,0x46A,0x13CD,0x136,0x2C5,0xFCA,0x1CFC,0x1B99,0x1BF7,0xD4},{0x1B32,0x152B,0xAD1,0xCB0,0x289,0xBC5,0xC90,0x1D5D,0xA4B,0x1D78,0x275,0x1D5F,0xA02,0x1E26,0x19B2,0x4BB,0x1FA,0x18C1,0x1F2E,0xBE}},
+    {{0x1A04,0xADB,0x64,0x897,0x976,0x1003,0x577,0xBC0,0x164A,0x96D,0x26D,0x12D,0x9D1,0x1870,0x764,0x91B,0x1241,0x7D2,0xC8C,0x4},{0xE26,0x148E,0xDED,0xF11,0x1AD8,0x1E90,0x1854,0x10F,0x1A5,0x342,0x148F,0x16B4,0x7CA,0x1944,0x1024,0xDBF,0x1147,0x10DE,0x9B6,0x157},{0x149E,0xB55,0x164D,0xA0E,0xA3E,0x1924,0xF2B,0x669,0xCC6,0xFF7,0xCB7,0x1EF7,0x147D,0xE36,0xCC8,0x609,0x1B71,0x14F3,0x54E,0x49}},
+    {{0x12B2,0x1A3,0x111C,0x19C8,0x76D,0x1596,0x1E7,0x16BC,0x741,0x134C,0x1CC,0x1985,0x1648,0x39B,0x17F6,0x1745,0x15FB,0x129D,0x7DB,0x100},{0xF4,0x1A33,0x161F,0x1218,0x1F31,0x12AF,0x135E,0x1FB8,0x15D8,0x1C9A,0x73C,0x1E19,0x1FC,0x1DDC,0x1EC2,0x6AF,0x14DF,0x8F8,0x1B94,0x1BE},{0xE77,0x788,0x4C9,0x116E,0xBAE,0xEDA,0xD8C,0x3B6,0x1356,0x19E5,0x135C,0x549,0x13F5,0x628,0x3C,0xA1F,0x1E1E,0xD49,0x1C16,0xF5}},
+    {{0x12C8,0x114E,0xA3A,0x14ED,0x14E5,0xC67,0x107B,0xCCE,0xABA,0x1D32,0x1E38,0x14B7,0x1ECD,0x1FD1,0x1BA1,0x1BF0,0x1DB6,0x1ADF,0x1A55,0xED},{0x90C,0x7C0,0x54A,0x1001,0x16D0,0x1706,0x1CE0,0x11FD,0x601,0x1696,0x1284,0x2A0,0x684,0xEAC,0x1AC4,0xB62,0xE3E,0x10C1,0x1620,0x108},{0x1084,0xA90,0x1ECD,0x1E75,0xAB8,0x1C63,0x11C0,0x7E1,0x122C,0x1076,0xBE1,0x1329,0x1E39,0xE89,0x160B,0xA4D,0x212,0x1D0B,0x47,0x117}},
+    {{0xA52,0xD65,0x15E4,0x99F,0x1898,0x121,0x54E,0x1D95,0x1821,0x117B,0xE30,0x168A,0x9AD,0xC11,0x1DCE,0x1CD2,0xAD4,0x8C8,0x164E,0x58},{0x15A3,0x1FA3,0x37,0x19AD,0x15E3,0x1634,0x21E,0xEFD,0xA69,0x1C2D,0x19A3,0x1281,0x1F6E,0x347,0x97A,0x2D9,0x899,0x5E6,0x1F2C,0x122},{0x155C,0x176,0xC57,0x88A,0x3D3,0x4C9,0x874,0xB71,0x4C1,0x882,0x152C,0x1F4C,0x13E4,0x9DB,0x1EC3,0x68,0x952,0x6E8,0x59E,0x1BD}},
+    {{0x1F2A,0x5F4,0x1FB,0x1D8B,0xA0B,0x1CB0,0x54F,0x985,0x1E5F,0x14A7,0x496,0x199A,0xE8B,0x1F40,0x18CE,0x1E43,0xEA7,0xD88,0x135F,0x8A},{0x1B00,0x1C70,0x1D73,0x1740,0x218,0x1E20,0x6B7,0x194D,0xDC3,0x1E03,0xF70,0x1096,0x1AB1,0x63,0xB80,0xCAE,0x19F3,0x12D5,0xAAF,0x133},{0x6D3,0x198B,0x18DD,0x1C6F,0x1F3B,0x1BF8,0x1066,0x1F14,0x921,0xC59,0x1F0A,0x1948,0xCE7,0x17FE,0x1980,0x1FA0,0x321,0x2C9,0x1C91,0xDE}}
+};
+/* End of comb table */
 #endif
 
 #if CHUNK==32
@@ -45,7 +113,75 @@ const BIG_256_29 CURVE_B_NUMS256E= {0x1FFFC355,0x1FFFFFFF,0x1FFFFFFF,0x1FFFFFFF,
 const BIG_256_29 CURVE_Order_NUMS256E= {0xEDD4AF5,0x123D8C87,0x1650E6C6,0xAB54A5E,0x419,0x0,0x0,0x0,0x400000};
 const BIG_256_29 CURVE_Gx_NUMS256E= {0xEED13DA,0x6F60481,0x20D61A8,0x13141DC6,0x9BD60C3,0x1EAFB490,0xDF73478,0x1F6D5D44,0x8A7514};
 const BIG_256_29 CURVE_Gy_NUMS256E= {0x198A89E6,0x1D30B73B,0x15BB4CB,0x1EC3B021,0x18010715,0x12ECD325,0x171F3A59,0x13FB3B24,0x44D53E};
-
+/* Fixed base comb table for ECP_genmul - generated by scripts/combtable.py */
+const BIG_256_29 CURVE_Comb_NUMS256E[64][3]=
+{
+    {{0xEED13DA,0x6F60481,0x20D61A8,0x13141DC6,0x9BD60C3,0x1EAFB490,0xDF73478,0x1F6D5D44,0x8A7514},{0x198A89E6,0x1D30B73B,0x15BB4CB,0x1EC3B021,0x18010715,0x12ECD325,0x171F3A59,0x13FB3B24,0x44D53E},{0xC0071FB,0xABFF7C8,0x1C021817,0x1985B302,0x176BF73F,0x1953748,0x4D0DD29,0x82B3E90,0x5A08FE}},
+    {{0x6C3B558,0x1D0085B0,0x762FC57,0xB33C8AF,0x17F0558,0x1DD90CB2,0x181C4924,0x2CBB759,0xCE57AF},{0x3311BBE,0x5AA1210,0x1BC40974,0x716A3CD,0xE694DFA,0x16528840,0x2AF7276,0xF9767E3,0x9EA51C},{0x11B5EB53,0x2EF6D6C,0x18C055A8,0xD4110A7,0x1082B44D,0x19E103EE,0x125C270A,0x4AC749D,0x5AEDCF}},
+    {{0x11EBC3FE,0x1784AC35,0x1E77532A,0x13A04528,0x178E5DBF,0x3A5E683,0x402B77F,0x1E9D2660,0xA457F},{0xAA15FA5,0xA41516A,0x1E2E89A0,0x16AAAC02,0x12F73CBB,0x1D13EEE2,0xCF0A2E9,0x1D761515,0x620AEB},{0x28B5B2F,0xBFEF771,0x11FAB7C0,0x2911842,0x1B90D87E,0xC65C6C8,0xB06A3C1,0x1729732D,0xEC60C1}},
+    {{0x19605179,0x9D0E02F,0x1023D2F3,0x12BA5EED,0x9E7184C,0x1558DD22,0x1B31184A,0x8ECB6D8,0x5403A1},{0xA0D9ED9,0x109762D1,0xF0F1D2A,0x1887C8BB,0x1CD48731,0x1653103D,0x2397203,0x66CD733,0xD1BAD9},{0x187E353B,0x19EC6653,0xC510194,0x1E07653,0x154FD8B5,0xEA75E73,0xA4191B9,0x33626F2,0x449BAF}},
+    {{0x16CA07AF,0xB193C86,0x1EA5FB83,0x6CDF6E3,0xC3B9839,0x1E758F43,0x1294560D,0xDDA2589,0x47ADF0},{0xAB01832,0x15D2EC4A,0x1B0B92D5,0x5F6C012,0x831B8D6,0xE1F4BA7,0x8483A30,0x188BD0DC,0xC1E54},{0x19CD18AC,0x89B43B,0xD18B3B3,0xE0EF439,0x1AFB4BBE,0xD192A66,0x1350B7F0,0xDD0F735,0x39F35E}},
+    {{0x5979C8B,0xC9F82B1,0xCBA2594,0xE363623,0x1E134476,0xA6DA031,0x1E0A8B13,0x19627FA9,0xBA2CC},{0x5D2923F,0x6BBD27,0x1CBE9247,0xBF43E0A,0x1A82404E,0x1F534A21,0xBDA1279,0x470794,0x5D124C},{0x103C5CC5,0x9A0FCF3,0x47E5398,0x1AAC4E15,0x157ED576,0x7F4E27A,0x187E8240,0xF03036D,0xB45AF5}},
+    {{0x13D26AD8,0xB7A95E5,0x170C75F7,0xC10B895,0x684CC86,0x4688EA6,0x1E34BCE8,0xE888245,0x4C7ED7},{0xAF282EA,0x17A1088B,0x136C37AD,0x154AD4,0xB308D11,0x9628C23,0x1715388,0x8310CD6,0x70D052},{0x10CB387B,0x8B2D146,0x14EBCB5,0xDA94A17,0xBD46F8B,0xC84F110,0x90FF9EA,0x1E5CFE79,0xEB7743}},
+    {{0xF219E4A,0x17AF5C85,0xD9DD730,0x98ECE1B,0x4A9BE6C,0x14CFA96E,0xF5B8BDA,0x9BA9059,0x393A14},{0x13131462,0x1D6CCA07,0xEC13D8E,0x944C43,0x1F4F0744,0x131C60A6,0x34A96E6,0x126FF097,0xCA69C7},{0x16E63821,0x7E597E5,0x29C503,0x1F5E4B12,0x1E89BF7E,0xB8108DE,0x5572F3B,0x22F86B7,0x57E199}},
+    {{0x18853823,0x1B3C5BE6,0x1B76D47A,0x4DB47EB,0x13662455,0x18697243,0x1F870119,0xD4F85C5,0xC88867},{0xE360755,0x11450B56,0x1F7320C3,0x1EB36E5F,0x1785EDE1,0x2F6C366,0x294A0A6,0x9FF31CB,0x25EB4A},{0x1E61B4B0,0x3FFDD0D,0x1BAA0E59,0x13F908F2,0xE3AF6D,0x853F886,0x4DCDB78,0x116A3DD8,0xE2165D}},
+    {{0x187A614D,0x1F89F127,0xB112B0D,0x150698E7,0x1616957E,0xC97D096,0x18B2F04A,0x473E816,0x2B401C},{0x174DF82C,0x98EA2D6,0x1ACA59BB,0x1E15B6FC,0x1B6B9BC6,0x3AF92E1,0x15A5CB73,0x1F3475C4,0xC9C922},{0x15780E68,0x1128B3BF,0xC6B07A,0x18C0755C,0x2E53137,0x1D7F427F,0xBAF553D,0x7CB33E0,0xD4F7B8}},
+    {{0x178A2E11,0x12D11C96,0x9F90E2,0x11B0702,0x5ED7A1D,0x14A6EB43,0x189A7980,0xA4D051B,0xE8BD46},{0x5435CD0,0xDD6C82B,0x8464406,0xAEAB125,0x1C920B0E,0x6AC49DA,0x1E4DAECA,0x1DB9486,0x1FEE2A},{0x16E29824,0x1165E94B,0x9008478,0x1CA9DD34,0x871DFB0,0x673998D,0x38E70B1,0xC219101,0xA3E8D0}},
+    {{0x1E20C497,0x9CED647,0xBCDC75F,0x18121AD8,0x13E99FBF,0x13976110,0x125C534C,0xCEA241A,0xD044E2},{0x7A29ABD,0xA5ABD71,0x9A42ADF,0xE9F053A,0x1C416BEA,0xFF3A3DC,0xE36AE32,0x1F80F38A,0x75942D},{0x8A68543,0x1C6DB85B,0xE3EB711,0x5AE0616,0xA5FDA89,0x1F820732,0x4B4838A,0x9ABA507,0x1ED587}},
+    {{0x10EA5233,0x22D5B04,0xB0585A,0x158F9771,0x131DA7D5,0x1AD48FD0,0x1721AE1,0x731B662,0x4FB7B6},{0x17C3E9DA,0x19A4DA4,0x14C36D5F,0xDD12F2B,0x1ED292CC,0xEF55120,0x1CF51BE3,0x1D530907,0xED445E},{0x5769F00,0x1E6BE9FA,0x110C2FD2,0xAF12D96,0x1F78FE8B,0x15B4C08C,0x1B0712DF,0x74EA007,0x644EB8}},
+    {{0xEAB2FD6,0x7126519,0x194C9684,0x161246DF,0x178A2633,0xD02A29F,0x10520E0F,0x863CF28,0xFDE05A},{0x124F25C6,0x82A9B71,0x89E3161,0x150D4F63,0x1A252BD6,0x12C2A780,0x1A1921B4,0x184A06,0x1DFB2D},{0x10B28706,0x1BB4475C,0x3028E11,0x5132981,0x14FC89E5,0x7A377CE,0xECFE54D,0x70C323C,0x8383BC}},
+    {{0x167FBD2E,0x1FEEBA5B,0xD3F9E77,0x10858F9,0x5909E8E,0x95C484F,0x1F04DF34,0xDC5587D,0x9DB948},{0x18EAE058,0x18711DB6,0x1E4CA1DA,0x11BB68C2,0x13483013,0xF64C269,0x141E9064,0xACBFEE3,0x93DB3E},{0x21971C7,0x81BC172,0x177DD7AB,0x25925D5,0x8AFA58D,0xE0136C1,0x1A833A86,0x18A5F1E6,0x4939C7}},
+    {{0x1DE662AB,0x12294098,0x4D6C00,0x14F8C75,0x84021C1,0x30E8121,0x1BFA5E79,0xF1003B,0x65D0E3},{0x9A3DB6C,0x1BCDC22F,0x111446FA,0x2579AF6,0x1DC9B42,0x1EFFF4EB,0x255EFE9,0x1EA21E94,0xFD9AF8},{0xA0F3A7C,0x6997AF9,0x128B0A8B,0x444F679,0x18E8BB4B,0xC40BCCA,0x13F8982E,0xD5ECA88,0xC9CDF6}},
+    {{0x182E9905,0x1A9F445E,0x695BFB5,0x17D49801,0x3EE5774,0x15BA1868,0xEE8CBB5,0x6243C7C,0x934EC7},{0x1B9028A3,0x1EF68464,0x14EC9F77,0xB9E3254,0x1A15DCAE,0x18625656,0x11DA7431,0x142DAC47,0x9758E9},{0xE51F2BF,0xE5746D9,0x19D9BF8,0x8A96665,0x13CFF40F,0x1B7341AF,0x175670B7,0x1C6369AA,0x2086CA}},
+    {{0xC0965D0,0xD9D6CC0,0x893F5E9,0xA941747,0x1A9E48B,0x1780BE66,0x68711AB,0x42052D3,0x7F887A},{0x1C996AB6,0x19B8E3FD,0x316E8C8,0x7C6AF92,0x143E7495,0xE8319AB,0x674E46C,0x4394CC1,0xD2DA03},{0x1BE458EC,0x1F91F46A,0x169E38DC,0x13B5981C,0x1406DBFC,0x136A94A9,0x15AC7635,0x23499BF,0xB52D4D}},
+    {{0x1AD381,0x691BF7F,0x157ED4F,0xF65E03,0xE13367,0xD4B3709,0x83E4292,0x19B5048,0x7A0D7D},{0x1C459A9C,0x4D7B2A6,0x25142F6,0x111472A2,0x1DA7B091,0x1241874A,0x1910ABD3,0xE944E38,0xBAB6FE},{0x1A9EE65E,0x1E0F6498,0xD7FBA90,0x1E8FF49F,0xF2B9257,0xF7BD6C4,0x28D930E,0x1E512976,0xC555A8}},
+    {{0xB53EC9B,0x17355E52,0x14BD8993,0x139F626E,0x1DFAFC16,0xEA92281,0x1481B42D,0x7FA08CC,0x89B333},{0x760A893,0x176427F6,0x168692DE,0x4BD7E1E,0x1B77BA4B,0x113295FD,0x4111944,0xECB7BBD,0x3A4019},{0x6FB7497,0x1B4623F,0x197534BE,0x9902BFA,0xE0E209E,0x1CB4DC8A,0x4A7C25F,0x1E3E0DD2,0xC5519A}},
+    {{0x59E12C,0x1BA2AFB2,0x1385E664,0x77AD12,0x1A47B1F5,0x110AB0EC,0x83BE96C,0xBE58386,0x531D64},{0x3E67F68,0xE14AAD0,0x1250AAB9,0x1133BD86,0x1FC69DE1,0x7767E5,0x141434DE,0x12752127,0xA9B12E},{0x1584B30B,0x1CD24B50,0x1AF4D151,0x1DCD4C41,0x13E8023C,0x6D66081,0xF9A09E5,0x447F12A,0xC5ACCB}},
+    {{0x1810D38C,0x10716966,0x11F9993E,0x253256C,0xA354158,0xEE93C62,0x6BC8DEE,0x168AA4B2,0x63D641},{0x1B4A7E8,0x644B1B9,0x1343D1C6,0xBC2157,0x76B19DD,0x194C72ED,0x5BBFCD0,0x1AF2B9D9,0xAD03E7},{0x1FEDF519,0x20687D5,0xC6D105,0x1E9987A6,0x1BC470F4,0x1AC81F66,0xA26075F,0x704FD36,0x9543F9}},
+    {{0x175DB7E8,0x8EA77AA,0x1F0B8529,0x474BB30,0x9035CA9,0x14EE1267,0x13198786,0x1E155E2B,0x3EDA51},{0x1B7B6F31,0x41C0EBA,0x233629C,0x1DBCCEE1,0x5DCF165,0x383B3A6,0x1ED01459,0x5FFEBAC,0x22A89},{0x9050A52,0x17AED0E8,0x8F79A99,0x15991F96,0x6B00B26,0x11904310,0x9B10100,0x1896F84A,0x20BA1}},
+    {{0x8125CD,0x3DE9D3A,0x122C93EF,0x14672E5F,0x1FC95657,0x1527A90,0x17BFDBEC,0xBCC3881,0x78A5F3},{0x31CD519,0x1D433AA4,0x5C573ED,0x88B6B2B,0xC2C5D23,0x1D7588E6,0xAD3325,0xCFB06EA,0x5F6A76},{0x1828EFAB,0x1CB7863F,0x7F12527,0x17005F41,0x10E517F6,0x4AE8B85,0xCBB3907,0x1FC58010,0xE840}},
+    {{0x1791BEF0,0x1BEFD6D3,0x1754F088,0x390E9F9,0x7657458,0xDFB34A,0x2198021,0xBDC2500,0x9E8F03},{0x9085025,0x45E7B67,0x183FDF97,0x18C69ED2,0x1A7EE113,0xB2CD99,0xBE0A9A3,0xD50B1D8,0xD8D8CC},{0x56B665A,0xF21C5BD,0x1F2262FC,0x1E3E2DAC,0x3B248D,0xB9695BA,0x15AE7A80,0x1180B3F,0xB0295A}},
+    {{0xD1D8492,0x1990FB56,0xA636362,0x1A2A30F,0x3F3012,0x229D69,0xCA8C1AC,0x16A9BF5B,0xA3E617},{0x18ED672D,0xFD8D2AB,0xB9E19E9,0x197F61D6,0xB6F37EE,0xCDAEB1E,0x110655DC,0x1D01A292,0x764CA1},{0x41C5B3F,0xFDB4E97,0x5E7587A,0x1D3528D9,0x179FFB4B,0x9F54279,0x766B36E,0xC775D4F,0xDEC37F}},
+    {{0x15F2AA1E,0x124B8C2D,0x147533,0x100CD408,0x1F0F59A9,0x1927A1B8,0xD6B2C34,0x1283D9,0x741F52},{0xCC3F7F8,0x3673D8B,0x161796D8,0xC541CF,0xA600336,0x56BACA4,0x1D1B8286,0x6FE7068,0xDB8927},{0x6F1A675,0x7150C32,0x173B84BA,0x1F9CD647,0x1475866B,0x76E22B3,0x132B0A32,0x1BFE23DE,0x5C6E8}},
+    {{0x121ADCF,0xE4B2D83,0x7A19027,0x111C6420,0x21845A9,0x33CB1DD,0xE0E2E15,0x1BFB0ECC,0x1A1DF},{0x1561ADBB,0x12AA0E91,0x1BBDC68B,0x4435CD3,0x1843A04B,0xE49D1A5,0xA6B9258,0x634EB47,0x8A37FD},{0x1BDD7A78,0x977CCA0,0xDE7E21F,0x18581E04,0x756C501,0x6D8B8BB,0x168A7913,0x1A040622,0x9E1928}},
+    {{0x1C8FD025,0x98522EE,0x154214AB,0x4C2A85D,0xB33D7B4,0x1A44F2C5,0xE93CB09,0x13F769AB,0x70BBD9},{0x86395D5,0x1C0785FB,0xF072835,0xA0F2A43,0x1D2F2F7B,0x68BA993,0x1AD23B46,0x1E15AD2E,0x4A06E},{0xFC90394,0x1BFE13BA,0xA1B70CE,0x19045E73,0xBD2198,0x17291941,0x8C57FEF,0x1AEF02B6,0xABD61B}},
+    {{0x1FDC6307,0xC2ED8FD,0x82F0DB,0x12129753,0xC33A2EC,0x11211780,0xED380CD,0x1B4AF562,0x8B348F},{0x1347DE38,0x144E3537,0x1090EDDC,0xA624D10,0x1AA28D92,0xA4D6D5D,0x1CCBC2AE,0x1EAB665A,0x67CBE1},{0x1D605218,0x1F6DB47,0xED3D1,0x16DC18A6,0x69FE93E,0xD4856A5,0x1C670A73,0x66D5410,0xC8D21F}},
+    {{0xDC12519,0x1CCEF174,0x1AD6BB6A,0x872370F,0xB493057,0x13B1D1B9,0x7B31D33,0x21374DB,0xB43050},{0x90A6D72,0x8615544,0x16D98C45,0x7681B51,0xEC1C54,0x1B139562,0x8FFF77C,0xDE35789,0xBE56FA},{0x1ED95CC1,0x20BDAFC,0x19923AAA,0x28EF2D2,0x115EA03C,0x104E6342,0x6C48034,0x1B250D2A,0x37D8EE}},
+    {{0x1810F61A,0x63FE91D,0x13AD2B0E,0x10DE9A70,0xED8A6C,0xCDC02C,0x33905CC,0x1BC23E40,0xB7E642},{0x13D1CA5C,0x1C37D2DF,0x12EBB50E,0x8D55192,0xE82F130,0x96FF008,0xBF42141,0x41645FE,0x58E419},{0xC0B08F5,0x18D5728F,0x4B87DE7,0xB98DA7F,0x1BB18BF2,0x19F993C3,0x14C30B62,0x3D1E122,0xF5485}},
+    {{0xFDC4178,0x18906DBD,0xD853C2B,0x25315A3,0x226141C,0xBEE5E0,0x19A5357E,0x13D38705,0x82C750},{0x1CEEAD3E,0x7D94123,0x1BB53147,0xF0BB317,0x1ADF2936,0x17587FAF,0x1C9DCBD8,0x9C4BA5E,0xDDC537},{0x1F8F7EFB,0x1072FDD7,0x1ACF4EFC,0xCA4D719,0xDD091B4,0x82E8687,0xC1CC99A,0x1BA82302,0x6FC41F}},
+    {{0x14ED99EF,0xC5D3BFB,0x1192E657,0x1B020919,0x15923C53,0x18862255,0x1A219E98,0xCA54C9A,0xCCA283},{0x17028FDD,0xFE0A4E2,0x5A3E014,0xE7FB57A,0xE8A538F,0x4E9E8CB,0x13B06D3E,0x13CEAE7D,0xEC08E2},{0x131D392D,0x1C5A2E10,0x17006431,0x5A916B9,0x1C9757E4,0xACC91CC,0xB7E819,0x173CD875,0xF6B137}},
+    {{0x8380CE1,0xD736875,0x1D778D89,0x1851AC0F,0x176E7B20,0x5F8674A,0x29550F9,0x1E8A536C,0xB335F},{0xC5E3D2E,0x18B0998B,0x12F28AE3,0x16A09CA0,0x769B86C,0x86BC971,0x1D7FE4E8,0xE49560A,0x26AB20},{0x17320C05,0xDF09AC6,0x1F83604A,0x16D0EE8D,0x1DCEB67D,0x45660EE,0x18E66387,0xD2D2306,0xD009B8}},
+    {{0x3892CF,0x14C94625,0xABC9ADB,0x15B0A23B,0x17CFDB8C,0xF08D4E1,0xAFB7F53,0x1E64F0FC,0x6D36C4},{0x12EDE9CB,0x19E439A2,0xE4A5739,0x1B5925B2,0x77E67A,0x9C42529,0x4E67494,0x1879CDAB,0x40F0ED},{0x1EAFC5EB,0xF73EEDE,0x176B71C0,0x15F66B31,0x39F9729,0xA7A7CFA,0x9B4B752,0x336E548,0xB63940}},
+    {{0xF256C8E,0x150A0574,0xBF342B4,0x6192EA9,0x3E01ED8,0xC76C43B,0xA72B523,0x1ED352D1,0xE1DDDE},{0x156DF327,0x1DAF406,0x6B82F89,0x17E7AD5B,0x8FD4DD,0x1177CBD9,0x1E18F84A,0x12437964,0x4199AE},{0x3E52A36,0x5B96648,0xF4E3567,0x1F288506,0x18800C6A,0x1815CB2B,0x187BC353,0xF56943D,0x6E0C9D}},
+    {{0x1CB67B03,0x2333473,0x1753548A,0x1C1FEA5D,0x1BCAE702,0xC3B6697,0x7EA8F90,0x1BF32A9C,0x6466C},{0x146E4C94,0xCBA0471,0xDDAD62C,0x1E412BD9,0x1C4DCA55,0xBE56672,0x1A4A3885,0x1FDD476B,0x799A25},{0x10537770,0xC7F897B,0x13BF9985,0x1F815FC1,0x92D8497,0x15F95AC8,0x6E1CAE4,0xA17A310,0x990C9B}},
+    {{0x5CC5722,0x134B8452,0xD5C41EC,0xCE00822,0x10513BAA,0x675957A,0xAFFCA48,0x43B6EC8,0xCA3509},{0xCD6EA4B,0x1641FE65,0x832B974,0x8D82735,0x5E31114,0x1C05BF02,0x7577E3A,0x516573,0xE7C22D},{0x19F36711,0x598F77E,0x1B22177,0x9369625,0xA636EAD,0x12A96D37,0x16DE9F34,0x3268E38,0x96A5D5}},
+    {{0xEE26F64,0x19B60FC2,0xF020E74,0x1E4A5AE3,0x19580F50,0x1C407340,0x7AC43BA,0xC3171C2,0x4B5BA},{0x1E6F07E7,0xDDDC92,0xAFE0F7F,0xA430607,0x10993CCD,0x8997F46,0xB575213,0x11DF28D4,0xDF52BE},{0x5C0DAD3,0x1DBC9126,0x164ACF41,0xE5DE349,0xF19AC5D,0x1E103CAF,0x102A0606,0xEC98517,0x9C9909}},
+    {{0x96AC02E,0xB5D7FAD,0x1E8FBABA,0x1D16F149,0x18AFD403,0x1D180597,0x1CE4845B,0x17A0AA81,0x6F32E0},{0x1721E672,0x3C4F3D6,0x765E5B2,0x15FF6B90,0x42587D9,0xA4FAC0,0xECA68E4,0x963E9A8,0x90A23C},{0x2817149,0x12142D64,0xB4E9D73,0x172FE457,0x70F6CC2,0x1FD31AA7,0xD1FEA69,0xE65C3C7,0xEB164E}},
+    {{0x21C2E1A,0x1A19C6B3,0x1A82C1F1,0x1809008E,0x87EF5DD,0x1701A86F,0xFAD7784,0x42F4748,0x31C1E4},{0x165CD29C,0x7E8E74A,0x1C58A608,0x1B8E1034,0x18E1FE3,0x13ED67A0,0xB3D4BAB,0xE0DE295,0xD4FD69},{0x1F7CE188,0x9237486,0x11C0907,0x3C0E34F,0xCC5E157,0x165AE297,0x15794C87,0x1A7F3493,0x184219}},
+    {{0x1720D85B,0x10E5EBD0,0x135DEF02,0xA3F7684,0x6AC487B,0xB5B620A,0x1B5B168E,0xDBE13F3,0xC2CE81},{0x5DD7018,0x19646F80,0x27A168F,0x159A21B6,0x281EA9F,0xED68922,0x9308742,0x14D40FDB,0x862017},{0x1F451AF5,0x19C643E5,0x1B57AAC7,0x1433E5D8,0xC3CE640,0x8408CC8,0x40BB93E,0x1FDEE19F,0xCC028C}},
+    {{0x1FD91EF8,0x55186D0,0x919CCE9,0x1A1D6302,0x184C4FC1,0x1A1D1D55,0x137882EB,0x82675B8,0xE8B6EC},{0x1FF63B17,0x16D42C1,0x19A5430,0x8493918,0x16FC1BB0,0xD65C677,0x4BB1550,0x6EC3D0D,0xCC310},{0x6D670C0,0xA2406AC,0xC93F3EF,0x71D5898,0xE3184FB,0x15CCF914,0x16295D5C,0x154F62F1,0x20588A}},
+    {{0x11D7BD5A,0x1AE24B0C,0xBA6F2F2,0xA6A2833,0x1118EE8C,0x155C2967,0x1B2D4178,0x12F43065,0x9E6479},{0xD753CFC,0x1A22F4F3,0x178CFC52,0x98D66E7,0x41096E4,0x1CB0DE54,0x1130B2C1,0x16ABDF6C,0xA716D6},{0xF43A916,0x1E83A0B6,0x16A19897,0x138F6D40,0x2CAB79E,0x1B0069A8,0x8C0E99,0xD72B0EC,0xCFB64}},
+    {{0x10D0345C,0x54AE088,0x1990A63B,0x8FF327E,0x1965D86,0xBBCF895,0x1F7601D0,0xDE66736,0x1F6F15},{0x26B8075,0x786BC73,0x1DF825E6,0xB77B255,0x84DC8E1,0x1E8F34EF,0x792235F,0x166D465B,0xEC908A},{0x82E16A2,0x1C0217D5,0x133BB1A3,0x1A0E895E,0x1B14D8B7,0x1CB600D8,0x168942FC,0x38F9E88,0x28340}},
+    {{0x1D8B68FB,0x1D77E76E,0x2AEBC5B,0xC2BFE3,0x7849DB6,0xF67B8CD,0x1804C8A4,0x187ABD0F,0xC2CB30},{0x163B8DDA,0x1730BB31,0x7FBF024,0x1648D64,0x16D1B47F,0x1D79601A,0x914DBCF,0x15700C38,0x64F8D3},{0x4E06171,0x4559455,0x180E2124,0x134EF4B7,0x171E5791,0x1F1A1083,0x1359D714,0x1BCBAE81,0x5E1E68}},
+    {{0xD0F921F,0x1D04590,0xD8AD1CB,0x18E411F3,0x60FF6C7,0x124EEA18,0x9F71FDD,0x12B23D85,0xF2DB38},{0x19D5D1AC,0xB849E3C,0x12C33E7B,0x11CD8EE7,0x1649B78,0x1C770A91,0x1371A28D,0xD46FF9C,0xD574E4},{0x155D284D,0x118601EB,0x3AC78CB,0x1377505D,0x189D2784,0xCD82EF3,0x13CA76C6,0x517FF95,0xD049FE}},
+    {{0x167A5882,0x1092DBF1,0x11037E11,0xB46D148,0x3D6B33F,0x16DC7FC7,0x445C2ED,0x18401CE1,0xF106A4},{0x3B15335,0x106B7285,0x7472AB4,0x5CFE23A,0x3256C02,0x1DE68242,0x1D3F831B,0x12937CA6,0x9AC333},{0x17DB02C0,0x52604D,0x18324487,0x132A97A2,0x18BD23F9,0x140E7E5D,0x577A6C7,0x10D04A8B,0x952709}},
+    {{0x1ABEFD1C,0x1BB85719,0x1FEFD07E,0x4B1477F,0xA21B818,0x7D536DD,0x1CEFF473,0x3714092,0xFB3F35},{0x9339B21,0x19A3C562,0x17BD328E,0x323F724,0x15D2926,0x171F994E,0x143FB50B,0x10ED4C3C,0x8CDD48},{0x1EE0E5D5,0xF638A83,0x17169ABE,0x2E7C7B2,0x1D7C784A,0x1061167,0xDEC2A4D,0x120D2173,0xE7DE53}},
+    {{0x16F65B78,0x100ABCD5,0x5FAB513,0xD016299,0x14651467,0xE256ED9,0xD2A497E,0x65B92F4,0x4DF48D},{0x178CF663,0x1BF1F4D,0x48201FB,0x1C3B24D9,0x1ECB06F9,0x1E9F90F3,0x12CC74F2,0x1D269535,0xED46C7},{0x12CE3C41,0x146669C1,0xAA61263,0x1BA8B82D,0x2392CFD,0x1C3C1D2C,0x1AEB3CD8,0x1DBA39D5,0xD2AF56}},
+    {{0x1AAA3FFD,0x1E80D569,0x16C703E,0x2CC85DE,0x10C90C7F,0x69CD10B,0x12788F50,0x1829713B,0x12FD18},{0x1235B04A,0x4E1FDC4,0xB9CAFE0,0xEA062C1,0x1DF5E304,0x18E156D9,0x1F77B941,0x334548A,0x5B7C68},{0x1D2DEEAB,0x1ECB67B,0xF55DDD5,0x18A4E50,0x10B44D15,0x5586693,0x2B2B8D5,0x1E803EBE,0xE6BD7E}},
+    {{0x7AA1C5B,0x7626D1E,0x2CE1518,0x101F1425,0x1461D4C5,0x15AC7DBC,0x199A6373,0x59C24DF,0xF70E70},{0xD0D573A,0xBE7549C,0xAA3D33,0x1A1AF448,0x10BD11C6,0x103C80EB,0x5B6BC3B,0x7FE6A4C,0xB63732},{0xB6BD863,0x1B3DCDEF,0x1D3CB0D7,0x136107C0,0xBDA306,0xF212498,0xF120780,0xF6820DC,0xDA1724}},
+    {{0xD894836,0xA9FD862,0x1591B1F8,0x3BA57A0,0x94B252F,0x8A83110,0x75F7895,0xFFD0243,0xADACE5},{0x14A68437,0xFAC7CBD,0x19D537A6,0x1E90DD57,0xF6B0E7C,0x1716694E,0x7566650,0x19C5130D,0x4B964C},{0x1A33D51A,0x17E7D45B,0x1CFF17E0,0x537A4,0x1E682EE1,0x314AEBC,0x16072AE5,0x1ABCE750,0x46EADC}},
+    {{0x11A2DDA5,0x13A6DFCF,0x1D4858E3,0x8E6822B,0x7FF6E36,0xF37239E,0x14AF414E,0x1C68225D,0xC4B866},{0x1B1DDF31,0x131C320,0xE6CCF7B,0x18AC6B64,0x11502765,0xB559C19,0x1C7627A2,0x4A2E0D7,0x6648DF},{0x1461150C,0x13ADC357,0x1528647,0x13C4A9E1,0x17966E55,0xE109394,0x1A9F82B2,0xE3A4FFE,0xE0384F}},
+    {{0xA2D3574,0xD9C4D2C,0x1B0FB709,0x17E8AAC5,0x1EC8EECE,0xE0F9903,0x12BF17CB,0x103BFA8A,0x1982AE},{0xB875A38,0xDA03383,0x1AE46976,0x129E6E68,0x86EA2C3,0x1B92561C,0x14B9E572,0x41DE6A7,0x6AA0BF},{0x18FC5783,0x1DCCBDF9,0x648AFA3,0x1C6EEB9F,0x92BD762,0x1A677F2D,0x14DC7C44,0x6C1029A,0x6449B7}},
+    {{0xC82AFDA,0x15AC73E7,0xC77C61E,0x966CFBF,0xB43C8DF,0xC28DEAA,0x4B336E7,0x12A43E08,0x3EC782},{0x1B3067F5,0x1FF4172,0xCE57BB7,0x1EE4AB41,0x1CC9874E,0x18CE205C,0x566A9B6,0x41F834A,0x5F99C1},{0x10772DE8,0xAEEF454,0x17D150A0,0x1288B24C,0xC7B8FA0,0x4228EB1,0x87E1A72,0x150D3F8D,0xAAA51A}},
+    {{0xEE06E4,0x8EFE18,0x1C99D749,0x1905849,0x41323BD,0x84FB909,0x17D6D9D5,0x189B2F92,0x3AF91F},{0xF70981A,0x1D27B29B,0x43620EB,0x14B6912,0x23A1019,0x50B1C3B,0xC1C8FF2,0x18E9B903,0xCD4764},{0x7DF2E2B,0xDF5F02C,0x8D6AECD,0xF191A79,0x1DAFA1FF,0x10E5834B,0x3F6271D,0x1C19D1A3,0xD829A5}},
+    {{0x13D07296,0x7F95A6D,0x1FEBABE7,0xAC79EDD,0x14F6430F,0x9EAA433,0x13A273D6,0xF3FCC4,0xD7FF64},{0x17385BB3,0x1C77B213,0x80E1BE7,0x1735CD95,0x16ADD6B3,0x169E691A,0x1942C509,0xE679F8F,0x6A6FDF},{0x6A57B32,0x4B2C15A,0x905E28A,0x1497D5D6,0x189D7AF0,0x6501757,0x1779B2F1,0x3043F44,0x5F7CBB}},
+    {{0x115B7A04,0x1B225C0C,0x177801A5,0xC94BC02,0x89B52DB,0x104E884B,0x36764C3,0x1F4A4829,0x23230},{0x1691CE26,0xC3C45BD,0x54F486B,0x34A10FC,0x523C684,0x43E55AD,0x17F024CA,0x37A28ED,0xABA6DA},{0x156AB49E,0x1F283AC9,0x12BC9228,0x198C6697,0x1B2DDFEE,0x16A3EFBD,0x12CC871,0x13CF6E26,0x24953A}},
+    {{0x103472B2,0x16E72223,0x1E7ACB1D,0xE836BC0,0x8732698,0x1BB24661,0x8B7F61C,0xA76BF77,0x801F6E},{0x1F4660F4,0x18C862C3,0x15E957FC,0xBB1FB89,0x9CF3935,0x1C0FE786,0x15FEC2EE,0x3E29BE6,0xDF6E51},{0x4F10E77,0x1745B899,0x18C76D2E,0x6AC3B66,0xCD733CB,0x89FA952,0x3E03C31,0x1527C3CA,0x7AF059}},
+    {{0xA29D2C8,0x12D3B547,0x7B633D3,0x1574CCE8,0x1F8E3A64,0x11F66D2D,0x1E1BA1FE,0xB7FB6DB,0x76E957},{0x8F8090C,0x84004A9,0xE0B835B,0xC031FDE,0x4A12D2C,0xC3420A8,0xC5AC475,0x305C7CB,0x845882},{0x15521084,0x1C79D7D9,0x1C0E31AA,0x4587E18,0xAF860ED,0x9F1CCCA,0x9B60B74,0x142C424A,0x8B811F}},
+    {{0x11ACAA52,0xC267EBC,0x14E090E2,0x1043D952,0x138C22F7,0x114D6DA2,0x1A5DCE60,0x3215A9C,0x2C5939},{0x1FF475A3,0x11E6B406,0x1EB1A57,0x14D2EFD1,0xE68F85A,0x7FB74A0,0x1B297A1A,0x17991322,0x917CB0},{0x1C2ED55C,0x9A2298A,0x742648F,0x982B714,0x54B1104,0x1B9F27D3,0xD1EC34E,0x1BA12A40,0xDE9678}},
+    {{0xCBE9F2A,0x5F62C3F,0x14FE5828,0x1CBE9852,0x1125A94F,0x745E66,0x878CEFA,0x1621D4FE,0x454D7D},{0xF8E1B00,0xC5D03AE,0xB7F1008,0x1B8794D3,0x13DC3C06,0x3D58C25,0x15CB8003,0xB573E6C,0x99AABE},{0x173166D3,0x1DF1BF1B,0x66DFC7C,0x1243F148,0x7C298B2,0x1E673E52,0x141980BF,0xB24643F,0x6F7244}}
+};
+/* End of comb table */
 #endif
 
 #if CHUNK==64
@@ -58,5 +194,73 @@ const BIG_256_56 CURVE_B_NUMS256E= {0xFFFFFFFFFFC355L,0xFFFFFFFFFFFFFFL,0xFFFFFF
 const BIG_256_56 CURVE_Order_NUMS256E= {0x47B190EEDD4AF5L,0x5AA52F59439B1AL,0x4195L,0x0L,0x40000000L};
 const BIG_256_56 CURVE_Gx_NUMS256E= {0xDEC0902EED13DAL,0x8A0EE3083586A0L,0x5F69209BD60C39L,0x6AEA237DCD1E3DL,0x8A7514FBL};
 const BIG_256_56 CURVE_Gy_NUMS256E= {0xA616E7798A89E6L,0x61D810856ED32FL,0xD9A64B8010715FL,0xD9D925C7CE9665L,0x44D53E9FL};
-
+/* Fixed base comb table for ECP_genmul - generated by scripts/combtable.py */
+const BIG_256_56 CURVE_Comb_NUMS256E[64][3]=
+{
+    {{0xDEC0902EED13DA,0x8A0EE3083586A0,0x5F69209BD60C39,0x6AEA237DCD1E3D,0x8A7514FB},{0xA616E7798A89E6,0x61D810856ED32F,0xD9A64B8010715F,0xD9D925C7CE9665,0x44D53E9F},{0x57FEF90C0071FB,0xC2D9817008605D,0x2A6E9176BF73FC,0x59F48134374A43,0x5A08FE41}},
+    {{0xA010B606C3B558,0x99E4579D8BF15F,0xB2196417F05585,0x5DBACE0712493B,0xCE57AF16},{0xB5424203311BBE,0x8B51E6EF1025D0,0xA51080E694DFA3,0xBB3F18ABDC9DAC,0x9EA51C7C},{0x5DEDAD91B5EB53,0xA08853E30156A0,0xC207DD082B44D6,0x63A4EC9709C2B3,0x5AEDCF25}},
+    {{0xF09586B1EBC3FE,0xD0229479DD4CAA,0x4BCD0778E5DBF9,0xE9330100ADDFC7,0xA457FF4},{0x482A2D4AA15FA5,0x55560178BA2681,0x27DDC52F73CBBB,0xB0A8AB3C28BA7A,0x620AEBEB},{0x7FDEEE228B5B2F,0x488C2147EADF01,0xCB8D91B90D87E1,0x4B996AC1A8F058,0xEC60C1B9}},
+    {{0x3A1C05F9605179,0x5D2F76C08F4BCD,0xB1BA449E7184C9,0x65B6C6CC4612AA,0x5403A147},{0x12EC5A2A0D9ED9,0x43E45DBC3C74AA,0xA6207BCD48731C,0x66B9988E5C80EC,0xD1BAD933},{0x3D8CCA787E353B,0xF03B29B1440653,0x4EBCE754FD8B50,0xB1379290646E5D,0x449BAF19}},
+    {{0x632790D6CA07AF,0x66FB71FA97EE0D,0xEB1E86C3B98393,0xD12C4CA515837C,0x47ADF06E},{0xBA5D894AB01832,0xFB60096C2E4B56,0x3E974E831B8D62,0x5E86E2120E8C1C,0xC1E54C4},{0x11368779CD18AC,0x77A1CB462CECC,0x3254CDAFB4BBE7,0x87B9ACD42DFC1A,0x39F35E6E}},
+    {{0x93F05625979C8B,0x1B1B11B2E89651,0xDB4063E1344767,0x13FD4F82A2C4D4,0xBA2CCCB},{0xD77A4E5D2923F,0xFA1F0572FA491C,0xA69443A82404E5,0x383CA2F6849E7E,0x5D124C02},{0x341F9E703C5CC5,0x56270A91F94E61,0xE9C4F557ED576D,0x181B6E1FA0900F,0xB45AF578}},
+    {{0x6F52BCB3D26AD8,0x85C4ADC31D7DD,0xD11D4C684CC866,0x44122F8D2F3A08,0x4C7ED774},{0xF421116AF282EA,0xAA56A4DB0DEB6,0xC51846B308D110,0x8866B05C54E212,0x70D05241},{0x165A28D0CB387B,0xD4A50B853AF2D5,0x9E220BD46F8B6,0xE7F3CA43FE7A99,0xEB7743F2}},
+    {{0xF5EB90AF219E4A,0xC7670DB6775CC2,0x9F52DC4A9BE6C4,0xD482CBD6E2F6A9,0x393A144D},{0xAD9940F3131462,0x4A2621BB04F63B,0x38C14DF4F07440,0x7F84B8D2A5B9A6,0xCA69C793},{0xFCB2FCB6E63821,0xAF258900A7140C,0x211BDE89BF7EF,0x7C35B955CBCED7,0x57E19911}},
+    {{0x678B7CD8853823,0x6DA3F5EDDB51EB,0xD2E48736624552,0x7C2E2FE1C04670,0xC888676A},{0x28A16ACE360755,0x59B72FFDCC830E,0xED86CD785EDE1F,0xF98E58A5282985,0x25EB4A4F},{0x7FFBA1BE61B4B0,0xFC84796EA83964,0xA7F10C0E3AF6D9,0x51EEC13736DE10,0xE2165D8B}},
+    {{0xF13E24F87A614D,0x834C73AC44AC37,0x2FA12D616957EA,0x9F40B62CBC1299,0x2B401C23},{0x31D45AD74DF82C,0xADB7E6B2966ED,0x5F25C3B6B9BC6F,0xA3AE256972DCC7,0xC9C922F9},{0x251677F5780E68,0x603AAE031AC1EA,0xFE84FE2E53137C,0x599F02EBD54F7A,0xD4F7B83E}},
+    {{0x5A2392D78A2E11,0x8D8381027E438A,0x4DD6865ED7A1D0,0x6828DE269E6029,0xE8BD4652},{0xBAD90565435CD0,0x755892A1191019,0x5893B5C920B0E5,0xDCA437936BB28D,0x1FEE2A0E},{0x2CBD2976E29824,0x54EE9A240211E2,0xE7331A871DFB0E,0xC8808E39C2C4C,0xA3E8D061}},
+    {{0x39DAC8FE20C497,0x90D6C2F371D7D,0x2EC2213E99FBFC,0x5120D49714D327,0xD044E267},{0x4B57AE27A29ABD,0x4F829D2690AB7D,0xE747B9C416BEA7,0x79C538DAB8C9F,0x75942DFC},{0x8DB70B68A68543,0xD7030B38FADC47,0x40E64A5FDA892,0x5D28392D20E2BF,0x1ED5874D}},
+    {{0x45AB6090EA5233,0xC7CBB882C16168,0xA91FA131DA7D5A,0x8DB3105C86B875,0x4FB7B639},{0x3349B497C3E9DA,0xE89795D30DB57C,0xEAA241ED292CC6,0x98483F3D46F8DD,0xED445EEA},{0xCD7D3F45769F00,0x7896CB4430BF4B,0x698119F78FE8B5,0x75003EC1C4B7EB,0x644EB83A}},
+    {{0xE24CA32EAB2FD6,0x9236FE5325A10,0x5453F78A2633B,0x1E7944148383DA,0xFDE05A43},{0x5536E324F25C6,0x86A7B1A278C585,0x854F01A252BD6A,0xC2503686486D25,0x1DFB2D00},{0x7688EB90B28706,0x8994C08C0A3847,0x46EF9D4FC89E52,0x6191E3B3F9534F,0x8383BC38}},
+    {{0xFDD74B767FBD2E,0x842C7CB4FE79DF,0xB8909E5909E8E0,0x2AC3EFC137CD12,0x9DB9486E},{0xE23B6D8EAE058,0xDDB4617932876B,0xC984D334830138,0x5FF71D07A4191E,0x93DB3E56},{0x3782E421971C7,0x2C92EADDF75EAD,0x26D828AFA58D1,0x2F8F36A0CEA19C,0x4939C7C5}},
+    {{0x4528131DE662AB,0xA7C63A8135B002,0x1D024284021C10,0x8801DEFE979E46,0x65D0E307},{0x79B845E9A3DB6C,0x2BCD7B44511BEB,0xFFE9D61DC9B421,0x10F4A0957BFA7D,0xFD9AF8F5},{0xD32F5F2A0F3A7C,0x227B3CCA2C2A2C,0x8179958E8BB4B2,0xF65444FE260B98,0xC9CDF66A}},
+    {{0x53E88BD82E9905,0xEA4C009A56FED7,0x7430D03EE5774B,0x21E3E3BA32ED6B,0x934EC731},{0xDED08C9B9028A3,0xCF192A53B27DDF,0xC4ACADA15DCAE5,0x6D623C769D0C70,0x9758E9A1},{0xCAE8DB2E51F2BF,0x54B33286766FE1,0xE6835F3CFF40F4,0x1B4D55D59C2DF6,0x2086CAE3}},
+    {{0xB3AD980C0965D0,0x4A0BA3A24FD7A5,0x17CCC1A9E48B5,0x29699A1C46AEF,0x7F887A21},{0x371C7FBC996AB6,0xE357C90C5BA323,0x6335743E74953,0xCA66099D391B1D,0xD2DA0321},{0xF23E8D5BE458EC,0xDACC0E5A78E373,0xD52953406DBFC9,0xA4CDFD6B1D8D66,0xB52D4D11}},
+    {{0xD237EFE01AD381,0x7B2F01855FB53C,0x966E120E133670,0xDA82420F90A49A,0x7A0D7D0C},{0x9AF654DC459A9C,0x8A395109450BD8,0x830E95DA7B0918,0xA271C6442AF4E4,0xBAB6FE74},{0xC1EC931A9EE65E,0x47FA4FB5FEEA43,0xF7AD88F2B9257F,0x894BB0A364C39E,0xC555A8F2}},
+    {{0xE6ABCA4B53EC9B,0xCFB13752F6264E,0x524503DFAFC169,0xD04665206D0B5D,0x89B3333F},{0xEC84FEC760A893,0x5EBF0F5A1A4B7A,0x652BFBB77BA4B2,0x5BDDE904465122,0x3A401976},{0x368C47E6FB7497,0xC815FD65D4D2F8,0x69B914E0E209E4,0xF06E9129F097F9,0xC5519AF1}},
+    {{0x7455F64059E12C,0x3BD6894E179993,0x1561D9A47B1F50,0x2C1C320EFA5B22,0x531D645F},{0xC2955A03E67F68,0x99DEC34942AAE5,0xEECFCBFC69DE18,0xA9093D050D3780,0xA9B12E93},{0x9A496A1584B30B,0xE6A620EBD34547,0xACC1033E8023CE,0x3F8953E682794D,0xC5ACCB22}},
+    {{0xE2D2CD810D38C,0x2992B647E664FA,0xD278C4A3541581,0x552591AF237B9D,0x63D641B4},{0xC8963721B4A7E8,0x5E10ABCD0F4718,0x98E5DA76B19DD0,0x95CEC96EFF3432,0xAD03E7D7},{0x40D0FABFEDF519,0x4CC3D3031B4414,0x903ECDBC470F4F,0x27E9B28981D7F5,0x9543F938}},
+    {{0x1D4EF5575DB7E8,0x3A5D987C2E14A5,0xDC24CE9035CA92,0xAAF15CC661E1A9,0x3EDA51F0},{0x8381D75B7B6F31,0xDE677088CD8A70,0x7674C5DCF165E,0xFF5D67B4051647,0x22A892F},{0xF5DA1D09050A52,0xCC8FCB23DE6A66,0x2086206B00B26A,0xB7C2526C404023,0x20BA1C4}},
+    {{0x7BD3A7408125CD,0x33972FC8B24FBC,0xA4F521FC95657A,0x61C40DEFF6FB02,0x78A5F35E},{0xA86754831CD519,0x45B5959715CFB7,0xEB11CCC2C5D234,0xD837502B4CC97A,0x5F6A7667},{0x96F0C7F828EFAB,0x802FA09FC4949F,0x5D170B0E517F6B,0x2C00832ECE41C9,0xE840FE}},
+    {{0x7DFADA7791BEF0,0xC874FCDD53C223,0xBF669476574581,0xE1280086600841,0x9E8F035E},{0x8BCF6CE9085025,0x634F6960FF7E5C,0x659B33A7EE113C,0x858EC2F82A68C1,0xD8D8CC6A},{0xE438B7A56B665A,0x1F16D67C898BF1,0x2D2B7403B248DF,0xC059FD6B9EA017,0xB0295A08}},
+    {{0x321F6ACD1D8492,0xD15187A98D8D8B,0x453AD203F30120,0x4DFADB2A306B00,0xA3E617B5},{0xFB1A5578ED672D,0xBFB0EB2E7867A5,0xB5D63CB6F37EEC,0xD149441957719,0x764CA1E8},{0xFB69D2E41C5B3F,0x9A946C979D61E9,0xEA84F379FFB4BE,0xBAEA79D9ACDB93,0xDEC37F63}},
+    {{0x497185B5F2AA1E,0x66A040051D4CE,0x4F4371F0F59A98,0x941ECB5ACB0D32,0x741F5200},{0x6CE7B16CC3F7F8,0x62A0E7D85E5B60,0xD75948A6003360,0xF3834746E0A18A,0xDB892737},{0xE2A18646F1A675,0xCE6B23DCEE12E8,0xDC4567475866BF,0xF11EF4CAC28C8E,0x5C6E8DF}},
+    {{0xC965B06121ADCF,0x8E32101E86409D,0x7963BA21845A98,0xD87663838B8546,0x1A1DFDF},{0x5541D23561ADBB,0x21AE69EEF71A2E,0x93A34B843A04B2,0xA75A3A9AE4961C,0x8A37FD31},{0x2EF9941BDD7A78,0x2C0F02379F887D,0xB17176756C501C,0x203115A29E44CD,0x9E1928D0}},
+    {{0x30A45DDC8FD025,0x61542ED50852AD,0x89E58AB33D7B42,0xBB4D5BA4F2C274,0x70BBD99F},{0x80F0BF686395D5,0x79521BC1CA0D7,0x175327D2F2F7B5,0xAD6976B48ED18D,0x4A06EF0},{0x7FC2774FC90394,0x822F39A86DC33B,0x5232820BD2198C,0x7815B2315FFBEE,0xABD61BD7}},
+    {{0x85DB1FBFDC6307,0x94BA9820BC36D,0x422F00C33A2EC9,0x57AB13B4E03362,0x8B348FDA},{0x89C6A6F347DE38,0x3126884243B772,0x9ADABBAA28D925,0x5B32D732F0AB94,0x67CBE1F5},{0x3EDB68FD605218,0x6E0C53003B4F44,0x90AD4A69FE93EB,0x6AA08719C29CDA,0xC8D21F33}},
+    {{0x99DE2E8DC12519,0x391B87EB5AEDAB,0x63A372B4930574,0x9BA6D9ECC74CE7,0xB4305010},{0xC2AA8890A6D72,0xB40DA8DB663115,0x272AC40EC1C543,0x1ABC4A3FFDDF36,0xBE56FA6F},{0x417B5F9ED95CC1,0x4779696648EAA8,0x9CC68515EA03C1,0x286951B1200D20,0x37D8EED9}},
+    {{0xC7FD23B810F61A,0x6F4D384EB4AC38,0x9B80580ED8A6C8,0x11F200CE417301,0xB7E642DE},{0x86FA5BF3D1CA5C,0x6AA8C94BAED43B,0xDFE010E82F1304,0xB22FF2FD085052,0x58E41920},{0x1AAE51EC0B08F5,0xCC6D3F92E1F79F,0xF32787BB18BF25,0x8F091530C2D8B3,0xF54851E}},
+    {{0x120DB7AFDC4178,0x298AD1B614F0AF,0x7DCBC0226141C1,0x9C382E694D5F81,0x82C7509E},{0xFB28247CEEAD3E,0x85D98BEED4C51C,0xB0FF5FADF29367,0x25D2F72772F62E,0xDDC5374E},{0xE5FBAFF8F7EFB,0x526B8CEB3D3BF2,0x5D0D0EDD091B46,0x41181307326690,0x6FC41FDD}},
+    {{0x8BA77F74ED99EF,0x81048CC64B995D,0xC44AB5923C53D,0x2A64D68867A631,0xCCA28365},{0xFC149C57028FDD,0x3FDABD168F8051,0xD3D196E8A538F7,0x7573ECEC1B4F89,0xEC08E29E},{0x8B45C2131D392D,0xD48B5CDC0190C7,0x992399C9757E42,0xE6C3A82DFA0655,0xF6B137B9}},
+    {{0xAE6D0EA8380CE1,0x28D607F5DE3625,0xF0CE9576E7B20C,0x529B60A5543E4B,0xB335FF4},{0x1613316C5E3D2E,0x504E504BCA2B8F,0xD792E2769B86CB,0x4AB0575FF93A10,0x26AB2072},{0xBE1358D7320C05,0x687746FE0D8129,0xACC1DDDCEB67DB,0x6918363998E1C8,0xD009B869}},
+    {{0x9928C4A03892CF,0xD8511DAAF26B6E,0x11A9C37CFDB8CA,0x2787E2BEDFD4DE,0x6D36C4F3},{0x3C873452EDE9CB,0xAC92D939295CE7,0x884A52077E67AD,0xCE6D59399D2513,0x40F0EDC3},{0xEE7DDBDEAFC5EB,0xFB3598DDADC701,0xF4F9F439F9729A,0xB72A426D2DD494,0xB6394019}},
+    {{0xA140AE8F256C8E,0xC9754AFCD0AD2,0xED88763E01ED83,0x9A968A9CAD48D8,0xE1DDDEF6},{0x3B5E80D56DF327,0xF3D6AD9AE0BE24,0xEF97B208FD4DDB,0x1BCB27863E12A2,0x4199AE92},{0xB72CC903E52A36,0x9442833D38D59C,0x2B96578800C6AF,0xB4A1EE1EF0D4F0,0x6E0C9D7A}},
+    {{0x46668E7CB67B03,0xFF52EDD4D5228,0x76CD2FBCAE702E,0x9954E1FAA3E418,0x6466CDF},{0x97408E346E4C94,0x2095ECB76B58B1,0xCACCE5C4DCA55F,0xEA3B5E928E2157,0x799A25FE},{0x8FF12F70537770,0xC0AFE0CEFE6615,0xF2B59092D8497F,0xBD1881B872B92B,0x990C9B50}},
+    {{0x69708A45CC5722,0x700411357107B2,0xEB2AF50513BAA6,0xDB7642BFF2920C,0xCA350921},{0xC83FCCACD6EA4B,0x6C139AA0CAE5D2,0xB7E045E311144,0x8B2B99D5DF8EB8,0xE7C22D02},{0xB31EEFD9F36711,0x9B4B1286C885DC,0x52DA6EA636EAD4,0x3471C5B7A7CD25,0x96A5D519}},
+    {{0x36C1F84EE26F64,0x252D71BC0839D3,0x80E6819580F50F,0x8B8E11EB10EEB8,0x4B5BA61},{0x1BBB925E6F07E7,0x218303ABF83DFC,0x32FE8D0993CCD5,0xF946A2D5D484D1,0xDF52BE8E},{0xB79224C5C0DAD3,0x2EF1A4D92B3D07,0x20795EF19AC5D7,0x4C28BC0A8181BC,0x9C990976}},
+    {{0x6BAFF5A96AC02E,0x8B78A4FA3EEAE9,0x300B2F8AFD403E,0x5540F392116FA,0x6F32E0BD},{0x789E7AD721E672,0xFFB5C81D9796C8,0x49F58042587D9A,0x1F4D43B29A3901,0x90A23C4B},{0x4285AC82817149,0x97F22BAD3A75CE,0xA6354E70F6CC2B,0x2E1E3B47FA9A7F,0xEB164E73}},
+    {{0x4338D6621C2E1A,0x480476A0B07C7,0x350DE87EF5DDC,0x7A3A43EB5DE12E,0x31C1E421},{0xFD1CE9565CD29C,0xC7081A71629820,0xDACF4018E1FE3D,0x6F14AACF52EAE7,0xD4FD6970},{0x246E90DF7CE188,0xE071A78470241D,0xB5C52ECC5E1571,0xF9A49D5E5321EC,0x184219D3}},
+    {{0x1CBD7A1720D85B,0x1FBB424D77BC0A,0xB6C4146AC487B5,0xF09F9ED6C5A396,0xC2CE816D},{0x2C8DF005DD7018,0xCD10DB09E85A3F,0xAD1244281EA9FA,0xA07EDA4C21D09D,0x862017A6},{0x38C87CBF451AF5,0x19F2EC6D5EAB1F,0x811990C3CE640A,0xF70CF902EE4F90,0xCC028CFE}},
+    {{0xAA30DA1FD91EF8,0xEB181246733A4,0x3A3AAB84C4FC1D,0x33ADC4DE20BAF4,0xE8B6EC41},{0x2DA8583FF63B17,0x249C8C066950C0,0xCB8CEF6FC1BB04,0x61E8692EC5541A,0xCC31037},{0x4480D586D670C0,0x8EAC4C324FCFBD,0x99F228E3184FB3,0x7B178D8A57572B,0x20588AAA}},
+    {{0x5C496191D7BD5A,0x351419AE9BCBCB,0xB852CF118EE8C5,0xA1832ECB505E2A,0x9E647997},{0x445E9E6D753CFC,0xC6B373DE33F14B,0x61BCA841096E44,0x5EFB644C2CB079,0xA716D6B5},{0xD07416CF43A916,0xC7B6A05A86625F,0xD3502CAB79E9,0x9587602303A676,0xCFB646B}},
+    {{0xA95C1110D0345C,0x7F993F664298EC,0x79F12A1965D864,0x3339B7DD807417,0x1F6F156F},{0xF0D78E626B8075,0xBBD92AF7E09798,0x1E69DE84DC8E15,0x6A32D9E488D7FD,0xEC908AB3},{0x8042FAA82E16A2,0x744AF4CEEC68F,0x6C01B1B14D8B7D,0x7CF445A250BF39,0x283401C}},
+    {{0xAEFCEDDD8B68FB,0x615FF18ABAF16F,0xCF719A7849DB60,0xD5E87E0132291E,0xC2CB30C3},{0xE61766363B8DDA,0xB246B21FEFC092,0xF2C0356D1B47F0,0x8061C24536F3FA,0x64F8D3AB},{0x8AB28AA4E06171,0xA77A5BE0388490,0x34210771E57919,0x5D740CD675C53E,0x5E1E68DE}},
+    {{0x3A08B20D0F921F,0x7208F9B62B472C,0x9DD43060FF6C7C,0x91EC2A7DC7F764,0xF2DB3895},{0x7093C799D5D1AC,0xE6C773CB0CF9ED,0xEE15221649B788,0x37FCE4DC68A378,0xD574E46A},{0x30C03D755D284D,0xBBA82E8EB1E32E,0xB05DE789D27849,0xBFFCACF29DB199,0xD049FE28}},
+    {{0x125B7E367A5882,0xA368A4440DF846,0xB8FF8E3D6B33F5,0xE7091170BB6D,0xF106A4C2},{0xD6E50A3B15335,0xE7F11D1D1CAAD2,0xCD04843256C022,0x9BE5374FE0C6FB,0x9AC33394},{0xA4C09B7DB02C0,0x954BD160C9121C,0x1CFCBB8BD23F99,0x8254595DE9B1E8,0x95270986}},
+    {{0x770AE33ABEFD1C,0x58A3BFFFBF41FB,0xAA6DBAA21B8182,0x8A04973BFD1CCF,0xFB3F351B},{0x3478AC49339B21,0x91FB925EF4CA3B,0x3F329C15D29261,0x6A61E50FED42EE,0x8CDD4887},{0xEC71507EE0E5D5,0x73E3D95C5A6AF9,0xC22CFD7C784A1,0x690B9B7B0A9342,0xE7DE5390}},
+    {{0x1579AB6F65B78,0x80B14C97EAD44E,0x4ADDB346514676,0xDC97A34A925F9C,0x4DF48D32},{0x37E3E9B78CF663,0x1D926C920807EC,0x3F21E7ECB06F9E,0x34A9ACB31D3CBD,0xED46C7E9},{0x8CCD3832CE3C41,0xD45C16AA98498E,0x783A582392CFDD,0xD1CEAEBACF3638,0xD2AF56ED}},
+    {{0xD01AAD3AAA3FFD,0x6642EF05B1C0FB,0x39A2170C90C7F1,0x4B89DC9E23D40D,0x12FD18C1},{0x9C3FB89235B04A,0x503160AE72BF80,0xC2ADB3DF5E3047,0xA2A457DDEE5071,0x5B7C6819},{0x3D96CF7D2DEEAB,0xC527283D577754,0xB0CD270B44D150,0x1F5F0ACAE354A,0xE6BD7EF4}},
+    {{0xEC4DA3C7AA1C5B,0xF8A128B385460,0x58FB79461D4C58,0xE126FE6698DCEB,0xF70E702C},{0x7CEA938D0D573A,0xD7A2402A8F4CD,0x7901D70BD11C6D,0xF352616DAF0EE0,0xB637323F},{0x67B9BDEB6BD863,0xB083E074F2C35F,0x4249300BDA3069,0x4106E3C481E01E,0xDA17247B}},
+    {{0x53FB0C4D894836,0xDD2BD05646C7E1,0x50622094B252F1,0xE81219D7DE2551,0xADACE57F},{0xF58F97B4A68437,0x486EABE754DE99,0x2CD29CF6B0E7CF,0x289869D599942E,0x4B964CCE},{0xFCFA8B7A33D51A,0x29BD273FC5F82,0x295D79E682EE10,0xE73A8581CAB946,0x46EADCD5}},
+    {{0x74DBF9F1A2DDA5,0x734115F521638E,0x6E473C7FF6E364,0x4112ED2BD0539E,0xC4B866E3},{0x2638641B1DDF31,0x5635B239B33DEC,0xAB38331502765C,0x1706BF1D89E896,0x6648DF25},{0x75B86AF461150C,0xE254F0854A191E,0x2127297966E559,0xD27FF6A7E0AC9C,0xE0384F71}},
+    {{0xB389A58A2D3574,0xF45562EC3EDC25,0x1F3207EC8EECEB,0xDFD454AFC5F2DC,0x1982AE81},{0xB406706B875A38,0x4F37346B91A5D9,0x24AC3886EA2C39,0xEF353D2E795CB7,0x6AA0BF20},{0xB997BF38FC5783,0x3775CF9922BE8F,0xCEFE5A92BD762E,0x814D5371F1134,0x6449B736}},
+    {{0xB58E7CEC82AFDA,0xB367DFB1DF187A,0x51BD54B43C8DF4,0x21F0412CCDB9D8,0x3EC78295},{0x3FE82E5B3067F5,0x7255A0B395EEDC,0x9C40B9CC9874EF,0xFC1A5159AA6DB1,0x5F99C120},{0x5DDE8A90772DE8,0x4459265F454281,0x451D62C7B8FA09,0x69FC6A1F869C88,0xAAA51AA8}},
+    {{0x11DFC300EE06E4,0xC82C24F2675D24,0x9F721241323BD0,0xD97C95F5B67550,0x3AF91FC4},{0xA4F6536F70981A,0xA5B48910D883AF,0x16387623A10190,0x4DC81B0723FC8A,0xCD4764C7},{0xBEBE0587DF2E2B,0x8C8D3CA35ABB35,0xCB0697DAFA1FF7,0xCE8D18FD89C761,0xD829A5E0}},
+    {{0xFF2B4DB3D07296,0x63CF6EFFAEAF9C,0xD548674F6430F5,0x9FE624E89CF593,0xD7FF6407},{0x8EF64277385BB3,0x9AE6CAA0386F9F,0x3CD2356ADD6B3B,0x3CFC7E50B1426D,0x6A6FDF73},{0x96582B46A57B32,0x4BEAEB24178A28,0xA02EAF89D7AF0A,0x21FA25DE6CBC4C,0x5F7CBB18}},
+    {{0x644B81915B7A04,0x4A5E015DE00697,0x9D109689B52DB6,0x524148D9D930E0,0x23230FA},{0x8788B7B691CE26,0xA5087E153D21AD,0x7CAB5A523C6841,0xD1476DFC093288,0xABA6DA1B},{0xE50759356AB49E,0xC6334BCAF248A3,0x47DF7BB2DDFEEC,0x7B71304B321C6D,0x24953A9E}},
+    {{0xDCE444703472B2,0x41B5E079EB2C76,0x648CC287326987,0xB5FBBA2DFD8737,0x801F6E53},{0x190C587F4660F4,0xD8FDC4D7A55FF3,0x1FCF0C9CF39355,0x14DF357FB0BBB8,0xDF6E511F},{0xE8B71324F10E77,0x561DB3631DB4BA,0x3F52A4CD733CB3,0x3E1E50F80F0C51,0x7AF059A9}},
+    {{0x5A76A8EA29D2C8,0xBA66741ED8CF4E,0xECDA5BF8E3A64A,0xFDB6DF86E87FA3,0x76E9575B},{0x8009528F8090C,0x18FEF382E0D6D,0x6841504A12D2C6,0x2E3E5B16B11D58,0x84588218},{0x8F3AFB35521084,0x2C3F0C7038C6AB,0xE39994AF860ED2,0x6212526D82DD13,0x8B811FA1}},
+    {{0x84CFD791ACAA52,0x21ECA953824389,0x9ADB4538C22F78,0xAD4E697739822,0x2C593919},{0x3CD680DFF475A3,0x6977E887AC695E,0xF6E940E68F85AA,0xC89916CA5E868F,0x917CB0BC},{0x3445315C2ED55C,0xC15B8A1D09923D,0x3E4FA654B11044,0x9520347B0D3B7,0xDE9678DD}},
+    {{0xBEC587ECBE9F2A,0x5F4C2953F960A0,0xE8BCCD125A94FE,0xEA7F21E33BE80,0x454D7DB1},{0x8BA075CF8E1B00,0xC3CA69ADFC4021,0xAB184B3DC3C06D,0xB9F36572E000C7,0x99AABE5A},{0xBE37E3773166D3,0x21F8A419B7F1F3,0xCE7CA47C298B29,0x2321FD06602FFC,0x6F724459}}
+};
+/* End of comb table */
 #endif
@@ -38,6 +38,107 @@ const BIG_384_29 CURVE_B_NUMS384E= {0x1FFFD19F,0x1FFFFFFF,0x1FFFFFFF,0x1FFFFFFF,
 const BIG_384_29 CURVE_Order_NUMS384E= {0x6A3897D,0x5CEE627,0xD721E48,0x8AAB556,0x1E1CF61E,0xD0E5A35,0x1FFF891C,0x1FFFFFFF,0x1FFFFFFF,0x1FFFFFFF,0x1FFFFFFF,0x1FFFFFFF,0x1FFFFFFF,0x1F};
 const BIG_384_29 CURVE_Gx_NUMS384E= {0xC206BDE,0x6AA0723,0x116504D4,0x52562CA,0x163406FF,0x1FD47998,0x10015D8F,0x8DCB7C9,0x15B30BF4,0x14D72AED,0x102DA884,0xB524CD9,0x1B111FB4,0x30};
 const BIG_384_29 CURVE_Gy_NUMS384E= {0x10729392,0xC681F0F,0x1B123727,0x561F28D,0x1964B007,0xC7BFB22,0x1D5A0C3E,0xE9E284B,0x1716AD82,0x11D886E,0x1CE2C69,0x134DDD61,0x983E67B,0x41};
+/* Fixed base comb table for ECP_genmul - generated by scripts/combtable.py */
+const BIG_384_29 CURVE_Comb_NUMS384E[96][3]=
+{
+    {{0xC206BDE,0x6AA0723,0x116504D4,0x52562CA,0x163406FF,0x1FD47998,0x10015D8F,0x8DCB7C9,0x15B30BF4,0x14D72AED,0x102DA884,0xB524CD9,0x1B111FB4,0x30},{0x10729392,0xC681F0F,0x1B123727,0x561F28D,0x1964B007,0xC7BFB22,0x1D5A0C3E,0xE9E284B,0x1716AD82,0x11D886E,0x1CE2C69,0x134DDD61,0x983E67B,0x41},{0x4062021,0x10B4D855,0x1C4618D9,0x1A3F3A8F,0x13C6566D,0x13A75E6C,0x618AC26,0x493B986,0x2827BD3,0x18A78A90,0x66E4175,0xDACC908,0x1C0ACC5E,0x2}},
+    {{0xCBB1E5E,0xCE2786C,0x1E64143F,0xA958808,0x42035C6,0x17A6EFB2,0x18B89BA5,0x13DA1B25,0x1EC341C3,0x18D046CF,0x14AD887A,0x1AAB830D,0x103AA1E7,0x5C},{0x3B3D964,0x597DC4B,0x1EA7761,0x2918AB4,0x1942EB91,0xFD1FB7E,0x37D235,0xC1CEA64,0xFD44E99,0x36EC890,0x21ECE39,0xFA661A2,0x1D22DB61,0x77},{0x6A23FEF,0x1F3E4111,0x1576CECF,0x19994453,0x10D303D3,0x1849F037,0x1FC9D66A,0x871E2B1,0x1F79326C,0x3F62F74,0x19930D7A,0x1775E8FE,0xD26396,0xD}},
+    {{0xF713EE8,0xE91D29C,0x13B6049B,0x168D2C98,0xF4ABB7E,0x5B1FC4,0xBDBAA1C,0x19B682FD,0x501EB25,0x6CDBB90,0x18073326,0x180693FB,0x10F7D531,0x62},{0x1CFD22E3,0x1F97842D,0x2639E4B,0x790C102,0x10622F8D,0x102ADD75,0xC8A54FD,0x4CF1B56,0x73AF42E,0xA02E7C2,0x1DAE14B,0x298CE43,0x15FF7011,0x1E},{0x16C26521,0x162F27D9,0x1DF38D44,0xAE28C56,0xD419DAF,0xD762D9A,0xB1B162,0x17B46FF,0x14177E70,0x1ED4AC01,0xE059CC0,0x1BA8002,0x8B7FB38,0x49}},
+    {{0x564676F,0x17CF5972,0x93FE4AD,0x188D2410,0x18A2F821,0x1E24FE8,0x11E9D3B0,0x1694251B,0xB23FA03,0x66D9336,0x46AFBD8,0x2629D8C,0x9B6EB75,0x73},{0xAC613E3,0x15EDAF28,0x1D62FE25,0x2A8BCED,0x1036E9D9,0x12384210,0x10A52A7E,0xDB522DD,0x15F9B8DF,0x138FD3D2,0x7DA5D9F,0x8AF5439,0x767E40B,0x6B},{0x1FF2A637,0xD7C9F52,0xE6A709B,0x1B0636F3,0xA8406E4,0x9D63BA9,0x11A7585D,0x9469AB1,0xAA7D2FC,0xFA97310,0x7EA248E,0xA9BA1F4,0xFF071A,0xB}},
+    {{0x11A27235,0x1EECB0A6,0x15F5E224,0xB0A479A,0xB18F444,0xACA5BF6,0x1E46EABE,0x156D8670,0xC0E4441,0x156002D3,0x478BE7E,0x4952F58,0x116DE6A7,0xC},{0x9F9E10F,0x17F58003,0x1FAFD4E4,0xDF46D4E,0x13BEFB7E,0x13DEDC,0x1184400,0x64030FE,0x17A948DE,0x60F0B95,0x3BAC5E2,0x1E7CA53,0xA70D6AA,0x44},{0x304F558,0x1900343,0x1C022B06,0xA3796E2,0x71F02B9,0x8DB4D8A,0x283C176,0x8763B02,0xF82AEEC,0xBD8E44A,0x1820B23B,0xF82EAAE,0xEB33B31,0x2C}},
+    {{0x155AF858,0x3D30AEB,0x2542940,0x3D09CFC,0x1D71AE5B,0x13B3B275,0x1486D3B2,0xB33E881,0x6651748,0x18511072,0x17F259D2,0x57716F5,0x19B58AB6,0x2A},{0x1B30CBA9,0x5254237,0xD8B1BB8,0xE521D41,0x817FE8C,0x13C392E2,0x2598812,0x1FC24AA1,0x1EB618CD,0xCACB086,0xF861852,0x1EA7F697,0x65ADF5,0x3A},{0x78DC078,0x1A4A17DE,0x134480E9,0x1E03B7B3,0x8042629,0x2A39D6,0xBA72AA2,0x97AE8AE,0x59A65E4,0x1D9A58FF,0x147476F7,0x530F425,0x1938B6B,0x40}},
+    {{0x6F92195,0xAA2ACA8,0x1CCC08A7,0x98A53CE,0x17DF1DBD,0x899753E,0x2D08E1,0xDB78070,0x1B73F809,0xAB4433B,0x117A2E77,0xDDD1EE7,0x60DCC87,0x66},{0x1EC42F2B,0x43235FC,0x28709C2,0x160EABED,0xAFF2C6C,0x87FD67B,0x7B50277,0x1CE059F9,0x114E5D59,0x5D06937,0x10CE30C8,0x1F0C371A,0x2627D13,0x59},{0x1E1AEC9B,0xC2A8161,0x7046EFB,0xE476C16,0xCACF77E,0x1DD67365,0x1AB00752,0x16ECA9B1,0x1317C773,0xD7D6C11,0x1B935BAD,0xEF7653A,0x283E8B4,0x2B}},
+    {{0x6F31C5E,0x117B2AEE,0x1B495C50,0x1CD7A120,0xF8900AA,0x1FDE902D,0x1C32F34B,0x118647DB,0x8476BA,0x1B6BE14,0x1F248093,0xE567AB6,0xEB0736C,0x35},{0x14CA9424,0x10CEF838,0x16F648CE,0xD6CB84C,0x196C69E8,0xDBDFE1B,0x118A5CEC,0xD4A1745,0x1603E2C6,0x197FD3B1,0x18A9BD31,0x105BEC09,0xA114173,0x3B},{0x79F231D,0x6D94588,0x10483C78,0x179CFD09,0x1F75FA3,0x173A6B24,0x1D21A80D,0x8E5EE02,0x1554A79F,0x5473607,0x1EDDC631,0x1447CE03,0x145FF622,0xC}},
+    {{0xCF3A86C,0xDF46A04,0x15F382EC,0x92607D3,0x7AAA2A0,0x14EA234C,0x2EBBD9B,0x8D36685,0xCD83E67,0x3C15ACF,0x43A2171,0x1EB9612D,0xE638EC0,0x49},{0x4E46254,0x1B489755,0x61F7161,0x14D8C55A,0x1B4AFC72,0x16C393D5,0x128FD2F6,0x18D56AB9,0x1EE3C773,0x4730801,0x9084C00,0x1F4C31A4,0x1EA40428,0x41},{0x6AC931,0x9BD706F,0xED30E5,0x1B899135,0x1EDD6A4E,0x2D85B8D,0x1425C330,0x16C6CB14,0x17E8649A,0xFB0CB94,0xA530E7,0x1F66914B,0x161D123F,0x31}},
+    {{0x1F972AC9,0x9F4C2C5,0x1505DB54,0xAE5C640,0x132BF2F0,0x49E7026,0x19AC863,0x3AC3C4D,0x183B9966,0x10995F6D,0x1C463323,0x1BE31109,0x1D9AD6CD,0x5B},{0x1463011F,0x1549FF2A,0x19472CEF,0x1C7F69CA,0x2A5BFF9,0x6E75D1,0x1C27766D,0x146015B3,0x2662887,0x17EB7065,0x1E69FB1D,0x150C2796,0x1A19CBDE,0x1B},{0x11267939,0x113693CB,0x1AE2B122,0x17DEBC2B,0x126189EA,0x37E2059,0x70DD64C,0x1928C9C1,0xE1C1A9D,0x102E4CC1,0x1E12998A,0x99BBE47,0x87E32F0,0x2F}},
+    {{0x129F2864,0x1DB21817,0x170C56FD,0x1CE85F61,0x17C974AD,0x8B07A6A,0x1962CEC,0x1A4E23D8,0x145A5447,0x14B755F9,0x19E088F3,0x16952763,0x9F327C2,0x58},{0x46EE4F9,0x140174CB,0x1D2B873D,0x109C5EB5,0x3B5B09D,0xC698B5B,0x18507E9C,0x10846332,0x189B2DCA,0x1C957FCB,0x2F7E326,0x18E85595,0xFCD744A,0x16},{0x8D0D2C5,0x17F9FD8B,0x94DC794,0x8767106,0x1B3D225,0x137FA819,0x3C65297,0x1E67B341,0x1BDFFA81,0xD549638,0x153F1997,0x1FA5EA00,0xD47C37C,0x60}},
+    {{0xDE8DD29,0x14C12D7C,0x858BE67,0x18B32F6A,0xCA4567D,0x11559CD2,0x9D98C15,0xB7864D3,0x2B5C1F3,0x1F88851A,0x1817E838,0x18B8D9E7,0x3FF8DD7,0x6C},{0x178CA66D,0x12E211CA,0x183442A2,0x1F0408E3,0x160C99D7,0xA9DF86E,0x609487,0x18895B06,0x130FE3ED,0x117B86F5,0xA203AEC,0x1CA4E165,0x1BFAD598,0x68},{0x1273CA2A,0x46D7714,0x12EF45C3,0x52FC98F,0x4A7F9D,0x17BCFF2,0x12DEA99D,0x13B1B495,0xBEBDD0E,0x77E3428,0x1FAB2CFD,0x84B3E0B,0x8AF5B47,0x60}},
+    {{0x154D713B,0x15D64229,0x1064F898,0x106BD206,0x1011CEE6,0x44FF13C,0x1FA6117A,0x1040B3CE,0x1E091D34,0xEE4E022,0x13B771C1,0x15D7AA9E,0x2B774A9,0x61},{0xCD73F61,0x1AD57EB9,0xD6902F2,0xA227F2E,0x700D8CE,0xDFDA5C5,0x445E8D3,0x55F3B14,0xA930F6D,0x78A4A79,0x13B8F756,0x146B9B93,0x15B0819A,0x70},{0x4598429,0xCDE54B0,0x1C0F786A,0xC1185AB,0x1E90790F,0x1795DD7E,0x1517004B,0x56D4D51,0x193970EF,0x1721858E,0x141BA5CE,0x6CCD61F,0xC5B7CE8,0x22}},
+    {{0x1896689B,0x2376A02,0x12012121,0x3ACECB8,0xE66F78C,0xB9AE8C6,0x146D445A,0x9EDE013,0x18D6A9A6,0x5ADD965,0x843D333,0x60E2FD7,0x12004C89,0x4B},{0x8442B3C,0x4703406,0x82A9038,0x929AEFF,0x123F3E06,0xCE60A46,0xEB9A36A,0x1CFFD6C0,0x1E3E67A,0x12EE0432,0xCFE74B3,0x177C93F8,0xCD9DB35,0x20},{0x1D808D63,0x145F1699,0x1F704C91,0x188864C1,0xD28A909,0x18F28254,0x130F8259,0x894FAE0,0xA7BAD6C,0x421445D,0x3994C67,0x1133C964,0x43E79CC,0x2A}},
+    {{0xBE88BA4,0x2B1B19E,0x10742402,0x90BB394,0x187896F3,0x26F87D8,0x16CADEC4,0xBE7989B,0xAAEFE41,0x7BF52BA,0x18E32AB8,0xF9C97F5,0x1055D6BB,0x6A},{0xFD1F14E,0xEB750DE,0x1D9B1A13,0x1E45E1A3,0x1CE51325,0x104FB016,0x537A659,0x1D1F7041,0x6ECC8AC,0x15382D7D,0x14B1FC4,0xC0690DD,0x229F271,0x35},{0x1F0AE18C,0xDE462CF,0x17BC940B,0x179704B2,0xAF49C36,0x1E385290,0x1B25EB12,0x1BDE4568,0x63BDDA2,0x1F0AAF12,0xAC56AD3,0x1E13E651,0xF5E3E51,0x79}},
+    {{0x163D9FFE,0x24DCF7E,0xE07A91C,0xA25B8DD,0xED1A48D,0x1B12A3C3,0x937CB92,0x13A50E03,0x93F3EB9,0x587EE16,0xAF44931,0x82FFD8B,0x7D8E593,0x4C},{0xCC808DA,0xD3D28B9,0x980CC8D,0x18100FFA,0x164B4811,0xEC7D4A2,0xD7CD619,0x1AD51726,0x18E97259,0x1B2C07E1,0x1DD3E13B,0xBA0FDBA,0x1FA6CDD5,0x15},{0xC9F4A7A,0xB32A89B,0x19F882D8,0x15C54DC7,0x9E2B393,0xF1E59F6,0x1055DFBB,0x10F675DA,0x11C8BC6C,0x141A3E0,0xD36A4C4,0x1469676C,0x3A7122C,0x32}},
+    {{0x15FC2591,0x1338B2B1,0xDAC52DF,0x15D3C9FA,0x9E4593D,0x1C86CBD5,0xC11E825,0x464E419,0x113DD2E8,0x1EED9C96,0x1B2B54FD,0x11F9D18B,0x182FA97,0x32},{0xA9EC4C8,0x9610CFE,0x138C36CB,0x9B35E26,0x1E5A338E,0x1B1796B2,0x16182850,0xBCA0311,0x777A0E7,0x1AD62EBD,0x1633913F,0x5307B37,0x219ECCD,0x52},{0x140D88A,0x1F0DA98F,0x614E320,0xC354050,0xDD3320F,0x1D200352,0xA3466A7,0xBB04D2C,0x174EDE58,0xF695098,0x128AC60,0x1FCED769,0x9E11D2F,0x2}},
+    {{0x1A11AD64,0x1C7B8EB0,0x1CE796F7,0xD786861,0xB5C8416,0xCD4EE6B,0x30F064B,0xC07EDD5,0xE60B15A,0x33E9C28,0xE4AC73F,0x1B58BCD5,0x1690D4B0,0x4},{0x1FD1D280,0x11E5002A,0x15B1359D,0x1CF2720A,0x151E8CD7,0x745069,0x11056350,0x195B43EE,0x679DE1B,0xB248E02,0x155B23BE,0x5461143,0xCA6A7F1,0xE},{0x17E9198C,0x14636239,0x1ED961F9,0x12C7E9D4,0x1F97B99,0x13BF9032,0x12EBF889,0x1C7A342,0x91C4DAC,0x1AC31D21,0xE7770A4,0xD794599,0x619703A,0x10}},
+    {{0xA65D5A4,0xC23F87F,0xCA46850,0x183CB646,0x1E3A49F8,0x413FE8B,0x11A08267,0xDDDA28A,0x3ED3385,0x1548C635,0x112C36DC,0x1B32144A,0x74C756B,0x27},{0xB7C439E,0x18172CDA,0x253F351,0x8F58240,0x14DFDF02,0x1F674F3E,0x10608F13,0x175EDDF3,0x131D8EA8,0x138B8DC5,0x1AB80FF1,0xEA1C08F,0xD6B9A0,0x55},{0x12758C7,0x18148B,0xCB8452D,0x1A5FCC40,0x3E74A3C,0x9E9DA76,0x1897BADB,0x185A5F6D,0x1199797,0xB219903,0x108E0BE8,0x1F5A9BD4,0x17854184,0x7C}},
+    {{0x1A085FF4,0x19AAA516,0x1B19BE8B,0x820971D,0x1509BDED,0x1182F0E,0xD66CEB3,0x1F0ECEF0,0x18F8BC84,0x18E8A72B,0x26F2CAC,0x93DDD5D,0x9265A4F,0x1A},{0x17765A5D,0x53AC0EF,0x16C26174,0x151D6BE8,0xCC15730,0xD4A5416,0xF8548B5,0x144DA401,0xA558FB,0x1992240B,0x24EBB2C,0x768C3C5,0xAF6C76E,0x2D},{0x12019A2F,0xFEE63FB,0x1443528C,0xE7E8777,0x12DA7FC8,0x1CB18F4,0x1CB19D71,0x6289FD1,0x1D341D25,0xE34D99D,0x9E531B9,0x16E8D11A,0x1735998,0x5D}},
+    {{0x1D69EF3C,0x3F54F19,0xD396BED,0x90E017A,0x10DFB7C9,0x2FB910C,0x1063F60C,0x1B6203FD,0xEB3C4C2,0xC062FD0,0xB52D813,0x8EBFEAB,0x1C43C592,0x47},{0x1D5C6342,0xF370154,0x1621B743,0x14CBCA37,0x1EE3F6A2,0x51799A7,0x71E2A01,0x182E3021,0x10671772,0xCD31023,0x5360FD1,0x15056C4A,0x9AD82D4,0x73},{0x12E6B099,0xA0232B6,0x16C1F6,0x18B0B353,0x1FA08319,0x1B03BF15,0x7D267F8,0x1DA6D71E,0x11A820FF,0x1CEBF576,0x10F67456,0x15AA7A53,0x41923BE,0x6D}},
+    {{0x6B08C7C,0x1D5F9900,0x1CD6B19,0x1AACA763,0x490E735,0x1D1F3466,0x124A82EC,0x77BFF28,0x14CE4C07,0x14A536B4,0x1E22CEF0,0x7C6DE08,0x171AA9DB,0x26},{0x1D0FE793,0x1C3DDF58,0x1792C1F2,0x18DEA5DC,0x1CEF15FA,0x18FD274B,0xB5942B1,0x1C2A0241,0x68497B4,0x1BDB839A,0x1CD62271,0x1B891348,0xB63ABBA,0x40},{0xDF64878,0x119597FB,0x137F9DB3,0x2CD7831,0x1091F96D,0xDD1BC24,0x164F12E6,0x1808D622,0x23BB6AF,0x81B1272,0x528808A,0x1FC0766C,0x125759DE,0x45}},
+    {{0x1E8F4E3B,0xA5BB6FF,0x5F95EDE,0x16F48404,0xFBA2635,0x13A312F,0x1DDAB078,0x26C7BEE,0x198B17DA,0xFD74089,0xC62F408,0x46AF420,0x1D559133,0x7},{0x2B5E6B,0x153D3356,0x597F489,0x609D7EF,0x181DE29B,0x169EC596,0x9AC764A,0xF74AA51,0x4A2F3D8,0x17CAE78,0x1F5120E6,0x1D5729D4,0xAC1FBE4,0x2A},{0xD64E2E6,0x4FD11FD,0x1C38059,0x14C01BDE,0x1CA3943C,0x1690FAAA,0x13B3D2F0,0xAACDAC7,0x1A9C1467,0x15E6223F,0x8B4AF6,0x9CEDE10,0xC9468B7,0x3C}},
+    {{0xAB6C038,0x152FC9BF,0x1600A2F,0x1689BBC1,0xEE223E5,0xD68A212,0x1066C29C,0xE6C720,0x1A09A9D9,0x851AD8D,0x12477DB8,0x25A9D88,0x15AB8D0F,0x20},{0x1CFF7BDE,0x1DA5191C,0x6E3C9D4,0x17A0E092,0xBC48BD7,0x2283934,0x1FBBD560,0x1E95440A,0x1B6692D,0xFFEB545,0x179C3B4B,0x15942252,0x1D5102EF,0x6},{0x787E1E7,0x7200A1D,0x12A2ADDD,0x1753472E,0x19251712,0xD8161EA,0x1B415FB3,0x332901A,0xAC66392,0x1B2EBEA,0x1DBCB76A,0x1A0F10FC,0x1732ECC5,0x1E}},
+    {{0x13DC8747,0x1C206A56,0x4F945F2,0x334BB5D,0x5AE358F,0x1518E77,0x270646B,0x1E9A462D,0x1569367E,0x40CE068,0x37BC8FC,0x1A6174C6,0x1209B7A7,0x4D},{0x1A601D59,0x1C0D548A,0xD8D2F10,0x16AE4F89,0x189AE27C,0x1485160B,0x3D95064,0x18FB332A,0x19890FBC,0x1C47ED76,0x19751FC4,0x93D4514,0x124A6C5,0x75},{0x1F524F4D,0x1E0C9B77,0x110B2FA2,0xF109DA2,0xADB1E2D,0x317AF61,0x10CF41D,0xA223D,0x151F059D,0xC3EC33A,0x1A53B1EB,0x1C065EE,0x1264F5C2,0x73}},
+    {{0x1DF54649,0x126F43D8,0x19CBFBFF,0xBC08AD2,0x1F54FE12,0x6AA879C,0x8B1F1A2,0xAD116B8,0x117191B5,0x1B06A1FE,0x19E120DC,0xB7506DC,0x151BF3B4,0x13},{0xD07143A,0x1C376279,0x156D1F87,0x698044B,0x13B399AE,0x5476105,0x1D473377,0x147E1FC0,0x1B42E613,0x19FF4E1A,0x287AF5F,0x1285D6EE,0x15938748,0x7B},{0xD14F595,0xB05B170,0xD24AF09,0xB89D64A,0x11376272,0x1DEF84AB,0x12C40A6F,0x349627C,0x11F0122D,0x9BE251B,0x1D023BB,0x513761D,0x1ACD040A,0x9}},
+    {{0xB22773D,0x1613064E,0x1F48AA1,0x162B37F2,0x19CAC909,0xBD8CC5B,0x5C470F9,0x143F2B0A,0xE8D37E0,0x13CE4600,0x1B6BE524,0x1D9593D0,0x1F97BA26,0x32},{0x1D05D26D,0x1DA13553,0x1C09DC4,0x19032932,0x117D5EAC,0x688CAA,0x1B573C21,0x11F72322,0x1BA01F2A,0x436D15B,0x1E36C50E,0x11354CA1,0xB404B38,0x4C},{0x15187A5A,0x9484F81,0x12DC156A,0x70BD364,0x1B49DC30,0x9725E1C,0x1D0DF672,0x1331C4CF,0xF274A38,0x39BF7B7,0x14309DB9,0x16CCDD27,0xD9BAD1C,0x2B}},
+    {{0x31739B0,0x199E6ADB,0xF5A5C2E,0x18B69C1B,0x1FB62DB4,0x173BD219,0x1BEFA7E7,0x187419F1,0xF08B416,0x18596611,0xF360631,0xDA97C8A,0x69DB240,0xA},{0x678E0EE,0x18758F93,0x1F0C2A63,0xA4398E9,0xCEC9A8,0x86EFD04,0x8DB98D4,0x10AC266D,0x56B169E,0x6B352C9,0x119B6C7A,0x7211702,0xC536FAB,0x3A},{0xE009D51,0x51BD767,0xFDE77F9,0x139B4389,0x19C9E7C1,0x155CCFCF,0x4E576E5,0x9EF977,0x10AAD77,0xE604690,0x1960DF66,0x1852CA89,0x105E76D4,0x1}},
+    {{0x1BC31F1D,0xC2E63B4,0x7CCE591,0x1FB9829A,0x18BFDD9D,0x1A4323BB,0xE88F7BB,0x14C4FFC9,0x6B00E0E,0xCDEEAC4,0x1F77DF02,0x1E17145A,0x4E23517,0xE},{0x77AE8D,0x12419B04,0x1C07534B,0x12692F6D,0x1B86FCAE,0x5AF1146,0xED13AB3,0x6E1E8D3,0x1242663A,0x43A0525,0xC6165E5,0x720B4CD,0x153FE700,0x5B},{0xF83A9A8,0x1C3CBDCB,0x12E75664,0x3852809,0xD169ECA,0x1B41F5FF,0x5880C59,0x3B01555,0x753066F,0x1A0E52F2,0x47C5291,0x9EBF97C,0x1E246482,0x16}},
+    {{0x512284E,0x1624B55,0x3B96F35,0x2643D18,0xA16BB80,0x8070D4E,0x810F561,0x7C45EED,0x7815DF7,0x1CC26750,0x7641477,0x11E60630,0xEA06774,0x46},{0x1BB1D674,0x19E9B07F,0x3F5FA0D,0x1F38891D,0x1896C82C,0x1D032DC4,0x8C4D840,0x18DCC80F,0x1240CE05,0x1A6C8619,0x19B723A8,0x1CE7108A,0x67620D5,0x3C},{0x596A7DB,0xB6AF449,0x108BC06A,0x3365CE5,0xBBC8BEC,0xC452327,0xE1106F7,0x12F9491C,0x22B0321,0x1C0D280F,0x1450F849,0x56124CB,0x15EEFD6F,0x3F}},
+    {{0xDAB2B03,0x12869614,0x326B410,0x18F37AB1,0x1240BA6F,0xDAD4EE4,0x15BE9332,0x9FEA834,0x99FEBDC,0x27E6B81,0x1DC19E61,0x14EBACAF,0x11A7C43B,0x38},{0x91F793F,0xE20C18D,0xF5B48C2,0x392830B,0x23BC965,0x1D674D22,0x35BDEA9,0xEC8BEC5,0x11836BE1,0xFAF6898,0x1D2B0DD2,0x2A584BD,0x1998B8C9,0x7E},{0x762CEA2,0x132B664E,0x13BD2610,0x1D12C447,0x8E6FD3E,0x59B41CE,0x3D75AF4,0x929FCA8,0x101A6ADA,0x1445204E,0xF88A598,0xC8B867,0x150EFC45,0x69}},
+    {{0x1AAFF649,0x15FA050D,0x152D191A,0x82CF658,0x2B52328,0xB9E5735,0x1531DC16,0x5AB1FAA,0x8C6E45B,0x1BE76EBF,0x18B54B55,0x56BC042,0x8FBB82D,0x57},{0xAD2FBE5,0x496E21D,0x209D15E,0x1572C765,0xCE600D,0x977B81B,0x1BA807BB,0x17F865A2,0x10F5572E,0xAFC7A02,0x1BB51998,0x15CE5BCD,0x4A9DFDB,0x6C},{0x6E983AC,0x171F3245,0x119E4FF0,0x1BE68E52,0xF662B73,0x1F2963A5,0x10C115DB,0xA00FB42,0x1B7C6970,0x18930CD6,0xAB5D01B,0x42EEE4,0x206F6F8,0x7A}},
+    {{0x15F80C2A,0x8017BAB,0xF5C8708,0x4C265C5,0x4B14778,0x1D9DDF17,0x1DCE4FA1,0x1E748439,0x23DDA8F,0xBD2A8E8,0x15FA45E1,0x116A42B3,0x16B8AC14,0x36},{0x10730393,0xC9413A3,0x116D95BC,0x144804D6,0x12FD9E00,0xB07C853,0x9EA846A,0xB18D0BB,0x19193DFB,0x892579B,0x12363CFC,0x17A54FEF,0x174D2662,0x62},{0x1CD6BB36,0x5DD9D6F,0x39388CE,0x96DEBBC,0x10138008,0xADA7787,0x92CD2F7,0x1E31508A,0x9A0807E,0xB39103A,0x133366EF,0x3DAB040,0x195CA4B8,0x6B}},
+    {{0xC1A3725,0x5B9DE46,0x1A6031B4,0x783FFD5,0x1DD9B31D,0x12437BDA,0x1532F62B,0x98BC0BE,0x1AB3B863,0x1AF03C05,0x11970B05,0x4B8B8EC,0x6164735,0x65},{0x2A1F86A,0x18650F32,0x1CDBCB83,0x3B52B4E,0x141D789C,0x1947CFE6,0xFCF2F02,0x143C5E1A,0x18985674,0x13CA436D,0x1628C70D,0x5E52095,0x515BFA0,0x10},{0xCF7DE2D,0x1EFF6730,0x13156908,0x341EC8,0x13D30A42,0x12A53D6C,0x4F924E6,0x18A6CB51,0xCA62F9D,0xF9541C4,0x1A78B526,0x18E81B1E,0x1A6A84F0,0x9}},
+    {{0x10A156C1,0x1CE5F1F0,0x6104BB1,0xFEEE513,0x944B02D,0x2B28801,0x17C425FA,0x13E9AEFD,0x1A52195F,0x1F0C19D5,0xE77BB04,0x10877293,0x6AE3153,0x6A},{0x136E47A5,0xDF88E84,0x2EC723C,0xF536113,0x2BC6913,0x2CB7CEC,0x13597203,0x1E13DCFB,0x18EC72ED,0x1B5FBED6,0xC989E2F,0x8F132FA,0x109101B7,0x2A},{0xD7AEF43,0x1F03E47,0xF9CCFA1,0x110E24AF,0x1513D05F,0xCBFE746,0x5A49F5F,0x15426FF9,0xDEB82FD,0x6D76B70,0x9E5BD8B,0x1BAB80E0,0x2222FA1,0x53}},
+    {{0x158A2AAE,0x91549CC,0x18670D30,0x9A5D9A1,0x18E4299F,0xE21D25,0xE7545D5,0x14496E36,0x11C65ECE,0x147924B7,0x1BAC6537,0x1ED47287,0x10B88D6D,0x36},{0x1BC1965B,0x1C96F74C,0x128C0AA6,0xB5871A4,0x1B7E0E,0x13882471,0x1F788681,0x20043E3,0x1F005D76,0xECF4D59,0x10609EB1,0x1E5C314A,0x130BEFB,0x62},{0x14B7D283,0x115E2F67,0x1E8604CC,0x510A71A,0x117B8150,0x4E3F935,0x128619E7,0x1D111F11,0xAA11203,0x1D368750,0x199C56BB,0xBE7C504,0xF48B6D8,0x6D}},
+    {{0x6331AEA,0x1B8A267D,0xC7D7A2A,0xDAE6CA2,0x9083E68,0x1D7BC74F,0xC11588F,0x11A914D3,0x120B0CF9,0xF53E9A2,0x1458CAFF,0x912DCE,0x1876C51D,0x59},{0x1EA9D479,0x110DD2D0,0x1E0FF285,0xEEF2086,0xECC05CC,0xEC425F3,0x54D5030,0x123CDB58,0x7426418,0x534D479,0x11C2A17C,0x18D9E0AD,0xFA29DE4,0x47},{0x1BDC5558,0x1C87DAE3,0x109CDCB8,0xEAC78C8,0x830A496,0x10B72350,0x11C77A95,0xCCEF512,0x1AB5E8AB,0x11326BF1,0x46FCA9C,0x14310DF7,0x151CCEEF,0x29}},
+    {{0x15F083E9,0x1739C440,0x9F5B2AB,0x154E9B42,0x1C430D56,0x1CD65CDF,0x6639C13,0x3FD62A6,0xB950F7,0x19B58670,0x191760F5,0x1A1A35B8,0x16288FFA,0x4},{0x1C27DE4F,0x5113DC7,0x18D1F53B,0x76D69B4,0x9DF8696,0x826646D,0x17433C04,0xA2B4570,0x7B000BD,0x347BD61,0x1832CC97,0x15830864,0x15FD29E0,0x3E},{0x12E085ED,0x175AFEBE,0xE341A2D,0xAE31E74,0x370B,0x15F54AE6,0x1C7BA878,0x462B294,0x1BDD40C1,0x11247BF4,0xFB7AE7E,0xE2A6EBC,0x49CF7C9,0x7B}},
+    {{0xBAC32F6,0x14FBEB2A,0x10FA8197,0x1E900B01,0x2ABA433,0x11137173,0x1F7EB20C,0xD7C4547,0x10A3398D,0x1EFAD8D0,0x37F8ADE,0x1907DDE9,0x1FA65C97,0x76},{0x188FD02F,0x1ED352DD,0x128A3968,0x4743842,0x1A5BA3D2,0x1155863A,0x126DFA1B,0xE0AA31D,0x16D88D15,0x2FFFAE3,0x18D0CFE7,0xF1F54C5,0x1D3E8ABA,0x5},{0xBDE378B,0x10629211,0x1924D433,0x8DCCE06,0x12FBD149,0x8A3AEBE,0xDA9B354,0x18D65054,0x1A033850,0x29D2247,0x1B5895F9,0x1E61F877,0x15FB0541,0x30}},
+    {{0x2D5BD87,0x6B3DC92,0x133FC40F,0xF1262F3,0xD4FA418,0x13FB77AB,0x1FF5AFB,0xEF2ECD6,0x3B9B2F6,0x151B96C7,0x4AB7834,0x14A03917,0x1B3C1960,0x14},{0x5A01FE2,0x105E62DD,0x1F80C77C,0x117B911A,0x1126F35A,0xF3651A2,0xED37B7E,0x1531A83D,0xE566CF1,0x12333D0A,0x1AC9CCF9,0x157EA97B,0x811EDF,0x36},{0x75E862A,0x22605C5,0x44FBDB4,0x9E2BFDC,0x4F6B4C6,0x1CD78935,0xEE792E2,0xA9ED4E3,0x1F9F41BD,0x48FE033,0xEDB9357,0x2AF6848,0x16A951A2,0x4D}},
+    {{0x16756F2E,0x1FB4EBE3,0x864A8E9,0xA32040A,0x16A6C9F6,0xDF74BBD,0x120481CE,0x14552DC6,0x113A7AE9,0x982F8D6,0x193022D4,0x1D26E794,0x1836030E,0x3D},{0x1B8BFF9,0x10B186DB,0xE5AA142,0x18A383F2,0x1F8849B5,0x1F35502,0x12658CC9,0xA1AEA31,0x2173758,0x1DCD4FE1,0x18D0AC83,0x4B1DE17,0x1B783010,0x12},{0xDC6C5B9,0x5811D60,0x1EC64748,0xE0BC98,0x1AF12C95,0x1BABD90C,0x1C169EE8,0x1D719521,0x1734AA90,0x344814,0xB2500F7,0x1FCE29A8,0x1058D140,0x13}},
+    {{0x4C5E4C,0xD54AA96,0x1E712176,0x2859EB4,0x9B2F4BE,0xF2D6185,0x702893D,0x1324B455,0xE8A2B0D,0x2F8F6F9,0xA704C08,0x1C718896,0x13E3B30B,0x32},{0x1AC7C113,0x2D1810E,0x19D35C2D,0x182B2A47,0xCAE0EC3,0x12F7801F,0x12463A2C,0x1F21A1B0,0xC1AF1FB,0x3C6BC13,0x163DB4C3,0x1704AC25,0xEFB5011,0x6D},{0x9319283,0x191EF730,0x1CF6C8CF,0x11D7135B,0x17F79FF0,0x1E212EB2,0x1D921B31,0x12CFD8F8,0x72491D1,0xAC7F89,0x6C77EF3,0x106002E5,0x794B958,0x30}},
+    {{0x1E0602E4,0x132634A2,0x1628E1C6,0x1B803F79,0xED427CB,0x12AAA928,0xDFBD9B,0x19B5CF1B,0xA946ECF,0x15E9557D,0x157EAF4,0x109188E2,0x1B53CED8,0x62},{0x13AE7540,0x18AB8C06,0x380C85E,0xC966011,0x821C239,0x1D0B28EC,0x16E68767,0x1E152F55,0x18B1ECF2,0x15A4C023,0xF48B5A1,0x1EF29A01,0x192B32A3,0x61},{0x34373C1,0x9D8FB38,0x13F13AD9,0xBED35BC,0x19AB28B3,0x14BE1D8,0xFB16C76,0x148C3B95,0x290F345,0x17624D21,0x745656C,0x1D2DD427,0x1A015C43,0x6E}},
+    {{0x166D381E,0x1FB2F99B,0x310C8B,0x8BBD80C,0x1CCC1BA6,0x5F6A13F,0x1B03FFB4,0x17EE579,0x63F897E,0x136DBC52,0x1F0186B5,0x37CA1D,0xA92B1C6,0x3B},{0x3625881,0xD3DFAA,0xDA7CFF4,0x1B865A2D,0x4992D74,0x620CF12,0x1DA96D6F,0xE4D8341,0x1BC42F8B,0xCC2B41C,0x1E42ECA7,0x1457C83E,0x1E988930,0x29},{0x1A7553CB,0x16390331,0x172EAE6E,0x892C4AE,0x92EE0E4,0xAFBCC75,0x133A29D7,0x1BDF16F5,0x1D75192,0x9752460,0x1E892956,0x1E292676,0x779F9F1,0x4C}},
+    {{0x34640D,0x11919546,0xF501AAC,0x16161EC5,0x147D150F,0x1A19E3F2,0x9B08456,0x1F51F465,0x1C0363DD,0x1AA4ED9E,0x11B17E22,0xA45C771,0x6D1C978,0x40},{0x124861C9,0x8ADE253,0x5ECDC9F,0x195C1E1C,0x16DCCD0A,0xD629317,0xC67EF3B,0xFED3B1B,0x135EC501,0x1E63A1F5,0x1E3F788D,0x1D76975B,0xD13416,0x7B},{0xD17C37A,0x11960B2C,0xF0C17FE,0x974AF6F,0x1BB634C1,0x15194D83,0xC1B5919,0x1CF2DEF7,0x152DE7AD,0x180F5C18,0x1AEC4ABA,0x16BCB8D0,0xDED840E,0x16}},
+    {{0x7FCD1EA,0x1D4FC2C,0x979C633,0xAE7C1DA,0x59F1CD9,0x1E566506,0x4616155,0x10A92925,0xDFD6C66,0x78E3ABD,0x254BE87,0x1B5EB20D,0x6757AD0,0x5A},{0x1B3C97CF,0x370586E,0x18B5952B,0x5A2AF82,0x1B44A925,0x1AEBAE1B,0x1133080,0x3A726C0,0xA8B797B,0xC3369F0,0x10F3F5A8,0x14133B52,0x1488399,0xE},{0x1F1CBD80,0x1A981BFF,0x4CA95A1,0xAC7976F,0xF2EAF04,0x16CA2232,0x53E8DE,0x2BA9978,0x134E4A0F,0xDB41B28,0x1D944B49,0x18549927,0x5935363,0x24}},
+    {{0x18C799D1,0x152BD51E,0x1C055591,0x7AE8E89,0x14C374F3,0x168F9F55,0x1358FFBE,0x14F8649B,0x1CEADDE8,0xDB5D4DA,0x1BE96909,0x1B305EC9,0x126611AA,0x35},{0x18A31A60,0x15A38A48,0xF80FA87,0x5D0A2CB,0xB24E817,0xCEE4CF7,0xFB249CB,0x18A912D4,0x109EC727,0x50DAFA,0x45F819B,0x13C37A3B,0x10270D6F,0x74},{0x5073B9E,0x1051D5CA,0x188C895C,0x1961A0F2,0x14A0B7D,0xD2153ED,0x1E4CAB85,0xD2C7C01,0xF887C45,0x8C055E9,0xF59164B,0x20C9A04,0x19C71B63,0x6E}},
+    {{0x1DAE1C73,0x14D1A8BB,0xD7F031C,0x5FC264F,0x13CE7E5C,0xD2563BF,0x24C0E41,0x2E02B15,0xA9D7005,0x1818AE20,0x107478A4,0x1A2866C8,0x122B5543,0xD},{0x3E888D3,0x8B5B6F7,0x1CD270D5,0x151D30EB,0x11E16DFA,0xB12ED5,0x1501F0BC,0x8C61E23,0x12C46290,0xC8341CE,0x184F2079,0xED9BF3A,0xD6087C0,0x7B},{0x11C63574,0x19A88722,0x6C8929E,0x1439F5EF,0x174822AC,0x13D0DA04,0x107F42BC,0x5A65EDC,0xD4547F8,0xCBC6870,0x17587B18,0x8B5B6F1,0x1E067791,0x57}},
+    {{0x1321907F,0x184C1D5,0x7875024,0x963FDE9,0x1C164242,0x1AD3FFDD,0x1A291DBB,0x1E2DA773,0x58B797,0x1B34ED7A,0xE404463,0xB534402,0x4CED9B1,0x41},{0x2F8B9CB,0x17C7135D,0x5380180,0x1F334CFC,0x194617BD,0x13109253,0xAD8F4D1,0x5DB8EA4,0x189E778,0xE7CA8CE,0x106BAB89,0xE03AC27,0x95533A3,0x7D},{0x1568FC01,0xE1E4369,0x1B99EDED,0x192A7D5D,0x9F01B3C,0x16DAE65,0x139C4CFE,0x6B73412,0xC816E8,0x93186B,0x1946B10C,0x1172F952,0x23AE9DC,0x52}},
+    {{0x233BA10,0x872B0E6,0x1F3BBFC9,0x457263E,0x14B70492,0xAEE94EC,0xACF6FCA,0x141C5DBC,0x14275AF8,0xC0EB5D2,0x1C6B8C8D,0x18A6ACDD,0x14A4F502,0x45},{0x730C740,0x17FBA9A2,0x33FE187,0x2BB6180,0x62EB77F,0x92ADAAD,0x16969CBF,0x1E59C507,0x1F48C1A8,0x104C807D,0x8E4E694,0x15C2A9D6,0x192E0E1C,0x23},{0x63672E4,0x82634A6,0x1F658A40,0x1449E553,0x346DFD4,0x5DC635E,0xB963CB8,0xDFCFE4A,0x1755600F,0x26F6FA0,0x8DADDD4,0x5E9E57A,0xFE3F41D,0x5D}},
+    {{0x147B056A,0x10541741,0x1AD964BF,0x195528AE,0x9FEDC10,0x169E4764,0xB72D4D7,0x1CB1A507,0x14A77475,0x1AF2D0FC,0x15ED5466,0xA0B4846,0x1EACF4EA,0x67},{0x1325FF57,0x6F19FB0,0x1E851FAA,0xAB1824E,0x18720EC4,0x13348900,0x6BE0E6B,0xD98D839,0x1CDD030,0x535726A,0x125E0EE2,0x10F78EE3,0x3DA1C61,0x39},{0x898B07B,0x1B51770B,0x19CA94CA,0xBEAECD1,0xA815A60,0x72F81B9,0x1C760B38,0x1DB53F06,0xC400E0,0x19E14ACB,0x383F331,0xA3EB03A,0x8B94251,0x8}},
+    {{0x1B43893E,0x1CBD7299,0x14480060,0xEF114C9,0xE2F1CE2,0xDF02DCA,0x195D0A86,0x905374,0xAFA31EC,0x48DC498,0x787DFAA,0x47D0CA,0x48C7DF,0x6D},{0x1590D7A1,0xCFFC2F9,0x1586006,0xAB840B2,0x17E0A235,0x14E8885,0x83FDCDB,0x164E50E6,0x1D2FF503,0x2017B64,0x49C5E2E,0x12C6FE89,0x660E778,0x1E},{0xB82C7A1,0x88549AD,0xA0861DE,0x11BE3B0E,0x1C3AB32,0x132DE028,0x846B782,0x1A56B980,0xF1488B8,0xAD5B8F4,0x1A96A50C,0xF8A6F90,0x15B6D056,0x32}},
+    {{0x15C5494A,0x1BC984DE,0x16870D89,0x16D8986E,0x9D4A1E5,0x8297004,0xEA3C7C1,0xD3D73D,0x5262DE6,0x723CAE,0x10225EC1,0x11B9B88E,0x164A13E1,0x3C},{0x352C637,0x12C171F8,0x1E9D6954,0x5FB6C28,0xAC7935F,0x10CF438C,0x4C172CF,0x11BCE8D,0x1D80842,0x111F9DB6,0x1B89FDD8,0xDF3CFEF,0x18C0651F,0x41},{0x806D086,0x491499B,0x1891987,0x83AAF72,0xBAF5460,0x198C0D4B,0xE5F1B85,0x3CAE3AF,0x1F9526E8,0x1273D46E,0x19DE9FCC,0xEEEA9C9,0xA3FAB51,0x62}},
+    {{0x18565BF1,0xD686A68,0x61E3979,0xC0C9EA,0x1D730A32,0x17650C04,0x19DD7EED,0x6FF1C97,0x1DE62F3A,0xD14EF64,0x4B22D54,0xBCF7404,0x147ABF63,0x69},{0x15593C27,0x18E78B93,0x151EB134,0x25192A5,0x1DF9AA75,0x16EE3E30,0xBDFB817,0x1AF156E4,0x1CE1FE56,0x15A08BED,0xFA838EA,0xA5585C7,0x7EA271D,0x10},{0x58112B0,0x15D289E5,0x126AA140,0x1BBBFF49,0xA818F19,0xEC392B6,0x7AA9473,0xB342E8D,0x12C4E150,0xD3929AF,0x18154B67,0x19CFD782,0xD42AAE3,0xC}},
+    {{0x1E227A43,0x18EB1A5B,0x1BB82C17,0x1855B867,0xE3CBAE2,0x4D1ACFE,0x1934FE42,0xBE192E2,0x15F8E19C,0x18CA6461,0x1D23AF38,0x1A01A635,0xFB23C98,0x59},{0xE21504E,0x1A97D9BB,0x1A978B07,0x40CCECC,0x6E7C06,0xDA1051B,0x146D8FA6,0x1334EC36,0xA5AD905,0x66D1A82,0x1E472FB1,0x114ED27A,0x1E5FC22A,0xD},{0x1283B6F1,0x1B545E39,0x171DF392,0x149DB149,0xE1F8B66,0x19EA43A2,0xE147C01,0x7B85E4F,0x76D37DA,0x1B2706D,0xA35C01F,0x1359043E,0x67A13CB,0x6}},
+    {{0x1F5E31F,0x10BDCC68,0x10F6CBFD,0x2B95F48,0x1639A3BD,0x87C7E7E,0x5463A4A,0x247AB16,0xC9C3AA6,0x7B4ED5E,0x18026F3F,0xA465874,0x70D7E7F,0x7C},{0x1E8E2B69,0xC7788DB,0xCF1DE5C,0x840E539,0x18A0C675,0x1007C0A1,0x1AA0479,0x5227F9A,0x1A6647F1,0xC781887,0x1C788FD2,0xD9E05B2,0x1A84DA8D,0x2B},{0x1560233B,0x18A6735E,0x178FAFD8,0x4D8DBB5,0x1F96A61B,0xF25CD40,0x16682E0E,0xB8267F7,0x5D92D0C,0x11D4E8A1,0x3118211,0xC1F52CD,0x2755C5E,0x9}},
+    {{0x6FDA631,0xF0E6F9C,0x732112F,0x15DE0DC8,0x1020CA75,0x5713BE4,0x1981B6FE,0x1BAC5A91,0xDD4276A,0x80C3432,0xF5A9588,0xCB0996B,0x1CA14D2E,0x7B},{0xC791BCA,0xD9AF955,0x107979CE,0x1B2CD872,0x1E4EF25C,0x2186E94,0x51ACAEC,0x168F3E50,0xFA7FEE7,0x8931273,0x16B71EF,0x12F3E23C,0xBD0D60A,0x4B},{0x42901FC,0x1D95EE5A,0x1F132770,0x1567AA70,0xA7918F6,0xDBC5010,0x12DA05B5,0x19114C62,0x11FC336E,0x131F952C,0xBF55255,0x4E86B34,0x1DAE3174,0x6C}},
+    {{0x17ED007A,0x586F5FC,0xFD22F2A,0xDCA106E,0xBF1C63A,0x17B8FFD3,0x162439C0,0x1C573910,0x1ECC96BC,0x1A7055BA,0x104E961D,0x1F764AEA,0xCA65C4F,0x9},{0x1E8BE6AE,0xCCC58EF,0x19BB9F6,0xBD82298,0x16FEAB0,0x18C77DA8,0x1A368D05,0x371EDC5,0x1A7BCA92,0xC2C6B61,0x1273CD2E,0x5587E5B,0x701F11C,0x0},{0x1EA9AE13,0x1EE6C7F8,0x47ECB90,0x2B5D24F,0x263C350,0x1CBD4F56,0x15309602,0x1A6CD1C9,0x1E448127,0x15D8A2F0,0x1CDA2BF,0x1B96A9F5,0xB7DC320,0x79}},
+    {{0x6FEFA8F,0x18F2DD9E,0x18526CE7,0x1315058D,0x102B7410,0x518823,0x1DBF1BC,0x1C2F1068,0x1518701A,0x11DA1DEE,0x171273B7,0x18AFEA51,0x10E9258D,0x53},{0xB43FAF7,0xF2A2173,0x10A96FCD,0x19127B6D,0x5BC7F4C,0x7E6E314,0x417AE8F,0xDB9F30C,0xA308530,0x681E1B7,0x4CBBD0C,0x1575AACE,0x134A6C4E,0x4F},{0x865A1C3,0x17096139,0x1381C77C,0x548D58C,0x104A4869,0x1AAB8D50,0x706721F,0x5733C24,0x9282B23,0x54CB866,0xC32A945,0x1460046E,0xEEC131E,0x53}},
+    {{0x1CE2AE44,0x1811AC55,0x175AADB8,0x103D3781,0x199986DE,0x1384C391,0xA955947,0x1726BFC,0x15D8429F,0x9669E5A,0x16FC9C52,0x1932C79C,0x193F0FE4,0x6},{0xDC1FCD2,0x1049AA50,0xCA3F255,0x12252B74,0xE59EBC9,0x19D3FE8F,0x1B649E0B,0x1CD98F5F,0x14EBB611,0x7AA6F46,0x1EC0FAD4,0xF451801,0xCF7D2A,0x9},{0x1B772BD8,0xD8731E4,0x2103FD9,0xBE1C288,0xDB3E099,0x14FCCF1D,0x9BA7AB2,0x4F8D45E,0xAAFB3A9,0x1B91EDC7,0x91D1364,0xFA0299F,0x5DB056D,0x25}},
+    {{0x18064B58,0x1254FC7D,0xBA4A3BE,0xF9BC005,0x1D9EC3C7,0x7423819,0x1B9B8B50,0x17C291BB,0x7A776AB,0xC329858,0x726E42E,0x12CC10BA,0x1D023E5F,0x52},{0x47E4D4B,0x1FFDE260,0x6903E0C,0x373704E,0xAAC1465,0x124BF320,0x1CB1377,0x21A50BB,0x100B3DFD,0xC72CA13,0x1620FCAC,0x11736846,0x1D1CC5BA,0x22},{0x1D4AA634,0x12D32F6,0xDCD2142,0x1067DA38,0x10A96442,0x1608C3D7,0x1994C68A,0x10F6664,0xC77BAC1,0x8DCA7F9,0x76808D5,0x6553544,0x885DF67,0x8}},
+    {{0x15076A7F,0x1BC4EE33,0x121575E1,0x1D3E54C7,0xCDF5370,0x887C825,0x19F93685,0x5C79C77,0x1CBDD65A,0x6792511,0x1CD45A83,0x17D03040,0xDEF889C,0x39},{0x3BC8447,0x1A460B42,0x5D33F35,0x657EBD2,0x16EBD8F9,0x98A9D0F,0x1EEE58C0,0x75FFEA1,0x5658D74,0x1001DD7D,0x806EE3C,0xD0040BA,0x54DD565,0x3C},{0x1ABA8BB8,0x3BA42FD,0x13993D6E,0xEE1696A,0xC7529FB,0x56415B7,0x1A23380C,0x164048E0,0x15602E96,0xDF9B6F,0x216ADC6,0x1D44D838,0x61F5F54,0x24}},
+    {{0xB9C3D5C,0x80E87D,0x13B3E9F5,0x7B46DBC,0x12D145,0xF2D27B0,0x3D31A74,0x1C86C307,0x7F1E72F,0xB886F80,0x17023E36,0x18CF269E,0x1875A374,0x18},{0xF3F60F,0x9185581,0xD908F68,0x116B1E6C,0x172EEFF3,0x144092F4,0x180D7683,0x1D00DE5,0x1AE8E8DC,0x11A742B1,0x1C4AB147,0x1BF9AF40,0xF693FE8,0x1B},{0x1A856E3B,0x172027D1,0x132C8674,0x1A323A7C,0xA1EEA44,0x11D644A4,0x19E50904,0x51E800C,0x1753B45F,0x84910C4,0x16876BCE,0x5E6731E,0x156856E3,0x27}},
+    {{0x1EA14E22,0xE06034C,0x1E017FB5,0x34DD71B,0xC7A12E1,0x11DA623A,0x3A021D1,0x119C4D4E,0xDEFE512,0x655B416,0x114A6640,0x120E4872,0x17CAED01,0x4B},{0x1A795627,0x15F8CFCC,0x1B413423,0x14696F6C,0x84E9F0A,0xC628B22,0x93711DD,0x1D366D6C,0x56BD3F3,0x159325BD,0x8B25F1D,0x7C464F,0x5521786,0xF},{0x1BB1D348,0x1D13943E,0x67A8091,0x92627AA,0x2806320,0x17A5C3DF,0x188749A9,0x847255C,0x6678161,0xF83E86A,0xF575A27,0x1A712B7D,0x19DE8905,0x42}},
+    {{0x1346D90A,0xE4229EE,0x1CB92E02,0x1140C8C4,0x1465F233,0xB684422,0x5B72514,0x4F270D9,0x4BA5E71,0xD08F1E8,0x245E9F7,0x19E7FA63,0x1E5AC60F,0x37},{0xF7E6AE9,0x9F23CF1,0x1B68BA02,0x12C449ED,0xAA0F2A1,0x176122DB,0x1965E7A8,0x1AB53615,0x1ED8D2BA,0x1447C5CF,0x1798F82F,0xFC07EF0,0x18548899,0x55},{0x18BE1DB0,0x11E0A5CA,0x85BDB8A,0x186A6CA5,0x41D5770,0x1F33652F,0xA259048,0x1EAF78A1,0x19F82031,0x13A7B38D,0x2BE5447,0x4CA0101,0xD44EF99,0x14}},
+    {{0xA2B7496,0x755B3DF,0x1D6CEE1,0xA7EFE7C,0x15337E70,0x1F6C3E49,0x77A07D4,0x1532AC38,0x1F5B5B75,0x56D9B7E,0x9132B5C,0x1E9D3A87,0x1306DF76,0x7B},{0xD2FD8C,0xC0BB049,0x78D9995,0x2B328F2,0xDCA7C2B,0x1B029046,0x180BD028,0x1C038F5B,0x1B4BC026,0xC4DA943,0x10EC8371,0x1DFB7F05,0x196C201C,0x4D},{0x13B06E96,0x19F0CB89,0x1D875602,0xE13D16B,0x1346453,0x1DA790FA,0xA525096,0x2CC8F72,0x680E763,0x942D730,0x60B7946,0xB68DB5F,0xA520170,0x79}},
+    {{0x14728D93,0x17A79BB4,0x863FB9D,0x11EBAD62,0x7615928,0x188504A9,0x111569F9,0x1AB33CCD,0x1F6175C9,0xA2E89DF,0x89F70F,0x1E756892,0xA4D4A06,0x5},{0x581B1B2,0x1DFC669F,0x159A4CB4,0x1F1787D2,0x1090E67D,0x1ECDCDA5,0xB06D173,0xE03ED6A,0x1DA6FEBB,0x12C63A2F,0x35E43C,0x1718692F,0x6925B6,0x66},{0x149065E5,0x1472505F,0x4CE2224,0xDD40674,0x9C8053C,0x1CC07225,0x12B90CE6,0xBC7BCF1,0x4FBA119,0xD1934CA,0x16D865C6,0x1550FF0F,0xB184DCF,0x5E}},
+    {{0x603617E,0x4D08FF8,0x103C68D6,0x182B2A0B,0x1274369,0x43A3964,0x1C35E395,0x650E936,0x1E0AE301,0x4F0DC72,0x19AB0E89,0x1441B1DC,0x1F67FD26,0x2D},{0x3F70673,0x9C6A79B,0x8FEB641,0xC8025DB,0x35648D9,0x542AA60,0x10D5DEE5,0x18D13C4,0x1F54B281,0xBF16F62,0x13A71D99,0x23F002F,0x1A38984E,0x4B},{0xE6A845A,0x1BE20D59,0x17B949CD,0x14D4C05D,0x14FDE8FF,0x5295488,0x141E21D4,0x481E296,0xC8E3939,0x472EBEB,0xED795DE,0xEDB2080,0x1C6584F,0x66}},
+    {{0x1BB6A889,0x1FAE16D0,0x1C2CAB53,0x2712D6F,0x1157234E,0x90CE916,0x1F1D7A0F,0x1CE99E8F,0xF501DF2,0x1084050C,0xBE7C014,0x11239B4F,0x19649B39,0xC},{0x1243F1C3,0x1FF601FB,0x1C5289B9,0x1C3268AF,0x1E6D302B,0xD918DE4,0x11B79BA6,0x12E15645,0xD4DD5A0,0x1262AACC,0x4C628D5,0x11EBBE27,0x442FAC8,0x1B},{0xF2C5BB9,0x7C93600,0x1AA4C56,0x18C2A1F5,0x126911F0,0x1424A53D,0xB4CB9B2,0x89EFE98,0x4CEE02F,0x13C4C9AA,0xB9B246D,0x1A37256,0x6359ED3,0x1A}},
+    {{0x16618E3C,0x11D66BF0,0xA11DE9F,0x4F4417B,0x165B8C3A,0x932C52A,0x1EED138B,0x137359E7,0x197E3ADC,0x1DB1E2B4,0xC4555E6,0x1611C55A,0x1F0068F8,0x65},{0x43EE839,0x1041E52B,0xAA721D5,0x1D00D215,0x1455FECF,0x19F0D4C4,0xB00DF97,0x1C90B346,0x5BD7A18,0xB84404F,0x18C6095E,0x104E5E59,0x1DB325C8,0x47},{0x30CB7FA,0x40770DA,0x12C6EA37,0x1031F365,0x16A5D065,0x1CF7F37,0xA01CE6B,0x1A7177D9,0x80E3754,0x4C88ADE,0x692A6C1,0x15610A07,0xC691A85,0xF}},
+    {{0x17DA5C91,0x17F1B11B,0x18FA9EBE,0xBEA9CB8,0x76A48F9,0x7143C39,0x125B8C8F,0xF474FBB,0x89BFC99,0x9BCFB40,0x1EF0AF6F,0x148538B9,0x18E912BA,0x41},{0x724382,0x1E4193AC,0x1F68AC71,0x1BF1AFA6,0xCE67AC,0xAF36266,0xE9C1C99,0xA7FA9F1,0x1221B757,0x40084E6,0xC0FF66E,0x1D7F21AD,0x1435D10,0x5},{0x2C1BABD,0xA6007C9,0x4432ED4,0xC356,0xFEEAB48,0x1D365DE9,0xF4B551C,0xF1BD012,0x160AC419,0x18ACD142,0x7CD6CC7,0x1CC88607,0x16A08092,0x11}},
+    {{0x76A5426,0x18A1BC62,0x10BD3ABE,0xA44704F,0x4AC9E63,0x115B3550,0x1C32F2B0,0x14CCEEC6,0xAE0166B,0x5C84004,0x5B3CD25,0x108A7F80,0x5199A61,0x6},{0x18CA74B4,0x10748632,0x4E3DE8C,0xA14A610,0x158EB81D,0x6696286,0x70DFD87,0x1EC6CA7A,0xC1682EC,0x2DAE5E8,0x455DFC,0xBC54F18,0x103105B4,0x70},{0x18F3080F,0x13025279,0x1B757CB,0xF36AEC5,0x1EEB75DB,0x6953BE6,0xE286123,0x8F8514F,0x174EC283,0x49CB3A0,0x112366E,0x11238BF0,0x1471E472,0x56}},
+    {{0x507365,0x15E9E30C,0x291563,0x10C20355,0x1526281D,0x981824A,0x15EC699F,0x1B39EF6D,0xF80D781,0x134A6C5F,0x1FD44C37,0xF1ACFFA,0x1F6B3814,0x69},{0x1FD245D9,0xBA57B7B,0x1319E5BD,0x14B9D3EE,0x14B1861A,0xD246D77,0x1F48DA9D,0x9A8926C,0x3FD8758,0x503C461,0x1091993C,0x1914C4A7,0x6D3AF38,0x67},{0x39982BE,0xAE034AC,0x18C65ECF,0xD55F74E,0x3ED9525,0x7B53F3F,0x147EB1C4,0x3876880,0x1DF5E3FC,0x1268B6E8,0xFA1FFFA,0x1761E0CD,0xA0AD6E5,0x68}},
+    {{0x1B0117DC,0x1CF045E7,0x5E6E018,0x21DCA8,0x1FF88BDD,0x1C5CEE32,0x1DAD1944,0x1F38FB61,0x1B276806,0xD245593,0x163EBDE4,0x590B33A,0x198C78FD,0x63},{0x1CF17F72,0x14799216,0xD2B40F1,0xA05EDDE,0xC6615D5,0xB88744E,0x226FEFF,0x197CA7F8,0xC21136D,0x102D139D,0xB13EC23,0xF98E18B,0x13FEBB76,0x1D},{0x10745A84,0x1BF07DF8,0x48A1DD5,0x112F8761,0xB5943F2,0x1FF1BE9C,0x4BC41F4,0x62CC911,0x739AE0D,0x253CE3,0x823A436,0x10820B71,0x17B0E6C1,0x44}},
+    {{0x16F7F14,0x9E2BD0D,0x1378C095,0x1BF3BBD0,0x1FD3F40,0x407F1C1,0xDEC02AC,0x1B3EB502,0x18AD9543,0x17D04E62,0x1C0DB1FF,0x114C5C42,0x103FF9BA,0x2E},{0x12F108F2,0x1BD7C2B1,0x1BBD135C,0xC4CA7B9,0x18B341BB,0x115BD2CE,0x4D6F2E4,0x7351FE4,0x1BE29A1E,0xCDC170B,0x10F43AD9,0x19DC59D3,0x16C07B2A,0x75},{0x1A81D013,0x1040C3B6,0x1C3CFC90,0x1DFB045F,0xBB783A0,0xFD2548E,0x1AB50CAB,0x81DF9E8,0x15A67869,0x1A8DDAF3,0xE7B45EB,0x9523BB7,0xB8CDD6,0x68}},
+    {{0x12983FEF,0xE6621D1,0x1CAD3108,0x1668A336,0x8FE564E,0xC2942,0x1BA5C31C,0x2B9AC23,0x86D6779,0x22FCC4,0x7D2FD02,0xE3339C6,0x170D0DC0,0x2F},{0x2EAD06A,0x14C7FB1F,0xEB56275,0x19BAB7D2,0x11A6FAE4,0xB1B7ABB,0x72CD60F,0xC5B5346,0xE0A6396,0x19283074,0x1B6014E6,0x12E589C7,0xB1E9549,0x29},{0x19C453E5,0xBB4A266,0x10F55A8C,0x1D21A8A,0x1862D99A,0x19B96A14,0x127051FC,0x12D1227F,0x29C33E1,0x16522E84,0xF5F3BE3,0x1AE75AEC,0xFC178DD,0x24}},
+    {{0x198862FA,0x1AB4AC65,0x2110DF4,0x189BE28,0x7B11D3F,0x186AC546,0xA6F0C00,0x17AC48EF,0x16B11698,0x15A996FB,0xF9332F2,0x1CF0323E,0xD94D6D9,0x52},{0x1A346F13,0x1A8F8F5C,0xDC38FF2,0x19300EA0,0x7365D1B,0xCF38AD,0x75380A8,0x108F9FEA,0xEE78D6C,0x1BBF7C64,0x6FC846F,0x13A2CBCE,0x39F0B28,0x52},{0x101EDC2E,0x15AFF850,0x6EBA175,0x40A79F8,0xC0ABEE8,0x1F460180,0x5B15846,0x11629038,0xA490EE8,0xADA182,0x46517F,0x1B8148B8,0x28E46E5,0x77}},
+    {{0x5996810,0x19C16C26,0x1A9986DE,0x1B590C45,0x86FB1AD,0x1D3B0AC8,0x21C3763,0xE0F61FC,0xBCF4BA4,0x5972EB,0x1D66C81E,0xC00B707,0x23266A9,0x51},{0x1EF89696,0x10202EC7,0x7FE8E65,0xB4095AE,0x1786DA43,0x4692BDB,0x273A303,0xFD76EED,0x10372C87,0x14147246,0x1A6401D8,0xCD0C27E,0x8268576,0x5E},{0x8F382AC,0x1CE974EF,0x177E4321,0xD5AB4CF,0xBAB6917,0xFF569A9,0x97A31B1,0x199B3AC4,0x1B59E3F,0x388A75A,0x81B3883,0x1646F01A,0x1E2026F7,0x58}},
+    {{0xCD2123A,0xCCDAC67,0xAD6F0D9,0x118D951E,0x149F095E,0x149C3B39,0x3A6FBD3,0x1CB98427,0x1ED918E8,0x10B95062,0x2B45C49,0xE214DCA,0x179C6531,0x16},{0x16D8AABB,0xD139C4A,0x116D5B6E,0x19E74F01,0x17311715,0x1E67D0B,0x18E409CF,0x1DEAF0B9,0xF088709,0x87650ED,0x1C9D9A2F,0x186E1E96,0xC44BA02,0x73},{0xFB11C1B,0xA37B4B4,0x9804F1A,0x1D851CBD,0x14578746,0x256AD16,0x929C4F2,0x14739790,0xDFB2C7,0x31C024,0xADBA896,0x1D6B1A14,0xEF2FD9B,0x4F}},
+    {{0xB6DFE53,0x1CF98A0B,0x175634F6,0x12B3CAA5,0x5E4B69D,0x9D0FE6A,0x15E0F095,0xDEB8716,0x13DBA536,0x1A823002,0xB9D0A0C,0xE8583CD,0x99CED43,0x38},{0x1F85EB79,0x72279E6,0xF08ACA1,0xD57C693,0x1F585D3E,0xF15E30,0x17B25A76,0x1C8A0778,0x358C321,0x1CF3E83A,0x1A650037,0x71B2DBC,0x185BB1AC,0x4C},{0x198E8F0D,0x17DB5C2B,0x1835AEF,0x495CDC5,0x8EEFC2C,0x18B577D6,0x57FDF45,0x81FCDCA,0x149AF462,0x4A4A2C5,0x9B3F91,0x2C17485,0x4880675,0x58}},
+    {{0x7DE2226,0x1CB87929,0xAE8D822,0x718484B,0x10F00801,0x430A419,0x21F086D,0x72C2971,0xE6B9DAC,0x33703DC,0x1192E7B3,0xA44A1D8,0xBDC982A,0x55},{0x1A6167F9,0xC56D5D8,0x1B4FF1A4,0x1E6C4FFE,0xE701CB1,0x1C6BE334,0x79AB691,0x302F942,0x19C0EFB9,0x1B15AA6,0x7049327,0xEED1CE,0x1737918D,0x5A},{0x1D9EC40A,0x7E260B6,0x11877D87,0x1F305D5F,0x1ADB30ED,0x8D9E51E,0x1554E1B,0x1E21D0DB,0xF6E572,0x1B265686,0x189A1D86,0x109AFA90,0x3A18142,0x32}},
+    {{0x10AC2E21,0x797787F,0x12B54FB8,0x53D577,0x8E2A4B3,0x179B7E4,0x4D7C94A,0xABA1900,0x514FA8D,0x19AF9F06,0xF63CEAE,0x7EDA5D1,0x1AF2E4CE,0x2A},{0x10CF2D1,0xBF056B9,0x18E24316,0x75642C8,0x6E8A68C,0xC2ACB3F,0xC2B2E46,0x3E8888,0x93C0F90,0x15C83AC8,0x8E8A43D,0x179433BD,0x4D02C39,0x57},{0x1FC85D5D,0x1685AA69,0x93A5D69,0x86F9F6C,0x81ED6BB,0xF9A68A6,0xCE70E35,0x1DA1AE95,0x1C194773,0x19199F4B,0x146BDA1,0x27B5503,0x1EAB4030,0x55}},
+    {{0x1FA59CB2,0xFDB71E5,0x4911A56,0x18CF5C31,0x162C1B1A,0x1A4B74ED,0x10BC9D6D,0x1A30770C,0x52AB429,0x855E61D,0x1AC83BA4,0xDA3422F,0x565960D,0x77},{0x18D610,0x1ACD8E26,0xC8FA459,0x12439EC0,0x70FAAFC,0x34BB1FE,0x87A9315,0x129CD640,0x1DFA5E6F,0x1F2624F2,0x11A5FA6,0x10C1B846,0xA6A53FD,0x3F},{0x1A153385,0x10A7ADA0,0xF3CB24A,0x16960D59,0x12A213,0x6A10BF8,0x1851FF93,0x1C0C7583,0x6110B59,0x3D0C49A,0x179544AD,0x1AB72D05,0x15E76C25,0x5A}},
+    {{0x152FFECE,0xD144A6B,0xE94AFAF,0x22A8C42,0x4F67F5E,0x960616,0x1ADCBEF3,0xF0DDE8B,0x56BBE4,0x135134B6,0x17E60E34,0x100FFC2B,0x3DCD94,0x6E},{0x6999C9F,0xC1414E9,0x5858147,0x16CCDBB0,0x34B2135,0x14F1EDDF,0xB772DE4,0x18C5B372,0x12E615FC,0x37FE71C,0x19E1D090,0x18F3B241,0x1753FBFB,0x1A},{0x5013C0E,0x101B77E9,0x1383B534,0x17F08D7C,0x1E7BB39E,0x7AD8D44,0x4DF4E45,0x13FC2E5C,0x5E923E,0x5019415,0x11BD0699,0x17F9AE7E,0x9A78D76,0x16}},
+    {{0xC499FE4,0x9541EA3,0x1BF62B56,0x41AE62B,0x1DFAAF78,0x9D821C9,0xC28D292,0xBDF99A2,0x39A616E,0x19134614,0x3E7E0EE,0x1C14170E,0x47A22E5,0x6F},{0x32FE5BD,0xA4F9B88,0xD783507,0x9422EA1,0x20CFA8B,0xB45CCA2,0xB665CE4,0xE1FD961,0x1C49F80D,0x1602233F,0x174CE371,0x16230475,0x738FB32,0x1},{0x18FCC1F3,0xA3760AA,0x16F0276B,0xAA93F2B,0xF19E3D5,0x1329581D,0xC3450AE,0x49D676C,0x4C76D1C,0x175F2EC0,0x3235B23,0x809282C,0x71F8A59,0x1C}},
+    {{0x19E9B09F,0x5175CBA,0x1F3463D6,0x1F738685,0xC88E2DD,0x8CCCA85,0x9C7FCC7,0xCB88EB,0xC9E541A,0x12858034,0x12FAE6D6,0xF8A7595,0xF230CA3,0x15},{0xD6CA61D,0x96E247,0x2AD24A7,0x1684D1A1,0x8513279,0x1978815A,0x147C1D80,0xEC01111,0x9219482,0x1303EC3B,0x1215E05E,0x1C6A3652,0x139360,0x66},{0xAD0139B,0x8F8955D,0x1EE93639,0xF9AF180,0x186CB0ED,0x376138B,0x15253782,0x1318EA7B,0x1E8E200B,0x11E72D82,0x10EFAE,0xCC5D0E,0x8727648,0x64}},
+    {{0x1B317DF3,0x1C894E58,0xA1ED62A,0x1D2E5A2C,0x19570A2E,0x1FB781E,0x18CD4536,0x9AD8E03,0x1E8E9F70,0x1031D363,0x45C38ED,0xD04A334,0x1F68D28A,0x7},{0x1F0F321D,0xE3DEFBD,0xC498129,0x7061894,0x6CB2A62,0xA02CF34,0x2097ABA,0x92F7733,0x513C0D0,0xC57A5E1,0x19F8561C,0x190B19B8,0x1A77E75A,0x1},{0x1EA8B26D,0x17920416,0x88A2532,0x417EAEE,0x115757CC,0x1B65C8FD,0x1C349B9C,0xEC88AEA,0x4037032,0x1EE6C3DF,0x175D12B0,0xA8F081,0x1E83BD6A,0x79}},
+    {{0x19549B4B,0x32E992A,0xAA3119A,0x16577B7C,0xE3EBC90,0x1EC52E50,0xE831DE0,0x42624C,0x196A9F06,0xCA6ED30,0x19634578,0x10B06E85,0xD62A12E,0x3C},{0xD4EE529,0x1976239D,0x16C9CE34,0x50DEBED,0x631ED4B,0xBA0714A,0x14D8053,0x8430C11,0x16D32CF6,0x1BE629C6,0x1AC435FD,0x5E61309,0x26248DA,0x55},{0x16EDC91A,0x70266E9,0x685D089,0x18FC3FA2,0x15E27668,0xCD7F68A,0x17377118,0x12BD3AF5,0x2513D74,0x103CD960,0x1FE2A5F6,0x127EF73F,0xAC9F132,0x3C}},
+    {{0x142C8C1F,0x16619F5F,0x174C3654,0x1DB21596,0x5CD6340,0x78E83B2,0x1639E352,0x1774FF27,0x1CCBE3C0,0x1A2AF9B8,0x10DDB415,0x1C088DF1,0x1707A8F5,0x51},{0x4B46C87,0x8EB050A,0x3EB1A77,0x1D163F3D,0x1B9B2226,0x399DE5A,0xD6F031,0x1A3E4AEC,0x7E198E8,0x163A2F30,0x11D6919D,0x1CD10C54,0x6459E7C,0x37},{0x18771C2C,0xF6FD7DB,0x45E6DA7,0xF4F1015,0x15D2B1AC,0x13A696F7,0x12B23F22,0x2B1B45A,0x214B2DF,0x3031A6A,0x1A3DB58B,0x5125ACC,0x3BA5E53,0x70}},
+    {{0x8231B8D,0x166A25D9,0x1E3704D4,0x2913F02,0xF953EF6,0xAA390BB,0x1432DEAB,0x1B36B059,0x48C27BE,0xA28FF7,0x185BFF4,0x1D7A0182,0x8D48035,0x59},{0x5C12CD6,0x15F85F53,0x12CDB1B7,0x19F77F65,0x20CB236,0x1A7A1723,0x1559BB12,0x159A9609,0x12A4F53C,0xC2028AA,0xA664BF5,0x1B3C0314,0x8F4A662,0x37},{0x1B7C9924,0x1DBAC5E,0x5F796F3,0xAF9FBC0,0x38AF4EC,0x16B1592B,0x18363829,0x136C441D,0x198E522D,0xB61384A,0xBBBE475,0xAD50980,0x1B420CFF,0x57}},
+    {{0x1FB348A7,0x1B1BD613,0x1BC00FBD,0xD77E096,0x168B7971,0x14F4E76A,0xFFB3FE6,0xA241B6A,0x61D9466,0x1826A0D1,0x94242AA,0x1C67D2,0xFA20A3E,0x1A},{0x1540590E,0x1EF439D5,0xE42D6F6,0x127B3D86,0xF2E89A8,0x436492E,0xC4AC2F3,0x1ACF7088,0x12DE45BB,0x1ACBA059,0xAD681C5,0x93ABD50,0x128E084C,0xC},{0x105BCEDA,0x189371EC,0x55B6B39,0xE68F83C,0x14414343,0x14893E4B,0x13B60A74,0x1AAAB81F,0x15172FC6,0x14E64ADB,0x32987C7,0x4CCC495,0xA43450F,0x12}},
+    {{0x1309CD89,0x138AD4E1,0x946F1FD,0xFEDDA17,0x108ABA92,0x4EB1CBF,0x1A14A489,0x18677E8D,0x1CFAEBBB,0x1F9E026,0x1ED467E,0x22A5E27,0x2078F61,0x28},{0x1AC84892,0x1CEA826E,0x26F0D40,0x17146E5A,0x10B64CB6,0x12AD8FDD,0x629179D,0xF38D237,0x256C91C,0x2ADF267,0x1908B948,0x762E507,0x51A099E,0x6B},{0x9F9FDF2,0x1F3A1455,0xD07DF02,0x196DE1DC,0xB5E9A50,0xD6A971B,0x1C28705B,0xA71E6F1,0xA6DE45F,0x1B379C1D,0x15443B99,0x11651C3,0x10B10AE,0x7E}},
+    {{0x2BE225,0x1A8FE40D,0x163BC57A,0x9A2D265,0x1F8D9E39,0x18E3F10C,0x1FE5257B,0x1FCBDE0A,0x2951E27,0x1DCACA3D,0x1B35C597,0x1953B6DB,0x1576C2F8,0x7B},{0x99DAB52,0x11E59401,0xE217AE2,0x8A8CF6A,0x1FE8CC22,0x5B0F1BC,0x112F2CCF,0x9F0BC7,0xDC35471,0x1A257706,0x2CC6479,0x34F51D0,0x1969808A,0x5},{0x2165DAF,0x1ADCD152,0x15BB50CC,0x1FBD63E0,0x9756A5A,0x1FBEB5F4,0x12761BF1,0x2CD0E52,0x14B7634C,0x1A6A49A7,0x19342F87,0x1012B6CB,0x141A39A6,0x4A}},
+    {{0x13E30FD,0x13FB668B,0x544F671,0x103C694,0x4D80687,0x18F0220F,0x6E9103D,0xB4F38FC,0xD627212,0x1BAE8D50,0x1BC79239,0x9A495D,0x1CB83421,0x5A},{0x95357FD,0x269A1AE,0x8E645C,0x989C6F5,0x1DEB4643,0xE384C06,0x14C76EF6,0x196F7F5D,0x1FE578E4,0x12F78995,0x13CC5EB7,0x30F9E4F,0x1FA8A415,0x10},{0x270D727,0x19D4CB9,0x18DFCA45,0xA53B9A0,0x18B55472,0xD86D4DE,0x57E2A0B,0x6A351D4,0x76A21E9,0x1B39C65E,0x1EE50001,0x1C588FE7,0xD4EDE82,0x61}},
+    {{0x171385F5,0xC2D94A6,0x11A46E49,0x1655C1BA,0x1BEE39F9,0x1564B351,0xE60A896,0x1512C18F,0x55A08FA,0x1F10C8E4,0xFD3C18E,0x41A68BA,0x44AEEA6,0x47},{0x1A0ED48,0x83765A1,0x19BA681D,0xD16347F,0x6F39EBB,0x511ED87,0xDDE5C11,0xAC22E4C,0x1EBEE453,0x4A6903E,0xF42EC38,0xC885BF8,0x1DC9103,0x26},{0x176AB809,0xE45EC94,0x109D6D70,0xCB10762,0x15FC6614,0x5DFA249,0x152FBDBB,0x1F3D194E,0x9330864,0x990E784,0xD7591A7,0x15CBA02F,0x684A6D8,0x54}},
+    {{0xF8AB757,0xEF8C36E,0x1BB92C58,0x46D13C4,0x538B0B3,0xCBD3022,0xAF48176,0x1C18F58D,0x63E0BF2,0xC49E5B4,0x14EBA1A8,0x77863EA,0x1A0D9F6D,0x69},{0x1D86BA83,0x15345BA8,0x152B0C8D,0x4080B58,0x6189087,0x4A86B8B,0x1BD17ED7,0x119396FB,0x131A6742,0xEA58FC4,0xA2B22AA,0x11318820,0x15B83A37,0x31},{0xFC16C4B,0x40579,0x113130FA,0x1C6BA348,0x1D9C6B08,0x99571C0,0x1901BE61,0x1503E332,0x2E99781,0xC1D4351,0x1D97E463,0x121FC1D4,0x5B2B930,0x7E}}
+};
+/* End of comb table */
 #endif
 
 #if CHUNK==64
@@ -50,4 +151,105 @@ const BIG_384_56 CURVE_B_NUMS384E= {0xFFFFFFFFFFD19FL,0xFFFFFFFFFFFFFFL,0xFFFFFF
 const BIG_384_56 CURVE_Order_NUMS384E= {0xB9DCC4E6A3897DL,0x555AAB35C87920L,0x1CB46BE1CF61E4L,0xFFFFFFFFE2471AL,0xFFFFFFFFFFFFFFL,0xFFFFFFFFFFFFFFL,0x3FFFFFFFFFFFL};
 const BIG_384_56 CURVE_Gx_NUMS384E= {0xD540E46C206BDEL,0x92B16545941350L,0xA8F33163406FF2L,0xE5BE4C005763FFL,0xE55DB5B30BF446L,0x266CC0B6A2129AL,0x61B111FB45A9L};
 const BIG_384_56 CURVE_Gy_NUMS384E= {0x8D03E1F0729392L,0xB0F946EC48DC9DL,0xF7F645964B0072L,0xF1425F56830F98L,0xB10DD716AD8274L,0xEEB08738B1A423L,0x82983E67B9A6L};
+/* Fixed base comb table for ECP_genmul - generated by scripts/combtable.py */
+const BIG_384_56 CURVE_Comb_NUMS384E[96][3]=
+{
+    {{0xD540E46C206BDE,0x92B16545941350,0xA8F33163406FF2,0xE5BE4C005763FF,0xE55DB5B30BF446,0x266CC0B6A2129A,0x61B111FB45A9},{0x8D03E1F0729392,0xB0F946EC48DC9D,0xF7F645964B0072,0xF1425F56830F98,0xB10DD716AD8274,0xEEB08738B1A423,0x82983E67B9A6},{0x169B0AA4062021,0x1F9D47F1186366,0x4EBCD93C6566DD,0x9DCC31862B09A7,0xF15202827BD324,0x648419B905D714,0x5C0ACC5E6D6}},
+    {{0x9C4F0D8CBB1E5E,0x4AC404799050FD,0x4DDF6442035C65,0xD0D92E2E26E96F,0x8D9FEC341C39E,0xC186D2B621EB1A,0xB903AA1E7D55},{0xB2FB8963B3D964,0x48C55A07A9DD84,0xA3F6FD942EB911,0xE753200DF48D5F,0xD9120FD44E9960,0x30D1087B38E46D,0xEFD22DB617D3},{0xE7C82226A23FEF,0xCCA229D5DB3B3F,0x93E06F0D303D3C,0x8F158FF2759AB0,0xC5EE9F79326C43,0xF47F664C35E87E,0x1A0D26396BBA}},
+    {{0xD23A538F713EE8,0x46964C4ED8126D,0xB63F88F4ABB7EB,0xB417EAF6EA8700,0xB7720501EB25CD,0x49FDE01CCC98D9,0xC50F7D531C03},{0xF2F085BCFD22E3,0xC86081098E792F,0x55BAEB0622F8D3,0x78DAB322953F60,0x5CF8473AF42E26,0x6721876B852D40,0x3D5FF701114C},{0xC5E4FB36C26521,0x71462B77CE3512,0xEC5B34D419DAF5,0xDA37F82C6C589A,0x958034177E700B,0x400138167303DA,0x928B7FB380DD}},
+    {{0xF9EB2E4564676F,0x46920824FF92B6,0xC49FD18A2F821C,0xA128DC7A74EC03,0xB266CB23FA03B4,0x4EC611ABEF60CD,0xE69B6EB75131},{0xBDB5E50AC613E3,0x545E76F58BF896,0x708421036E9D91,0xA916EC294A9FA4,0xFA7A55F9B8DF6D,0xAA1C9F69767E71,0xD6767E40B457},{0xAF93EA5FF2A637,0x831B79B9A9C26D,0xAC7752A8406E4D,0x34D58C69D61753,0x2E620AA7D2FC4A,0xD0FA1FA89239F5,0x160FF071A54D}},
+    {{0xDD9614D1A27235,0x8523CD57D78893,0x94B7ECB18F4445,0x6C338791BAAF95,0x5A6C0E4441AB,0x97AC11E2F9FAAC,0x1916DE6A724A},{0xFEB00069F9E10F,0xFA36A77EBF5392,0x27BDB93BEFB7E6,0x187F046110000,0xE172B7A948DE32,0xE5298EEB1788C1,0x88A70D6AA0F3},{0x3200686304F558,0x1BCB717008AC18,0xB69B1471F02B95,0xB1D810A0F05D91,0x1C894F82AEEC43,0x75576082C8ED7B,0x58EB33B317C1}},
+    {{0x7A615D755AF858,0xE84E7E0950A500,0x6764EBD71AE5B1,0x9F440D21B4ECA7,0x220E4665174859,0x8B7ADFC9674B0A,0x559B58AB62BB},{0xA4A846FB30CBA9,0x290EA0B62C6EE0,0x8725C4817FE8C7,0x125508966204A7,0x9610DEB618CDFE,0xFB4BBE18614995,0x74065ADF5F53},{0x4942FBC78DC078,0x1DBD9CD1203A7,0x5473AC8042629F,0xD74572E9CAA880,0x4B1FE59A65E44B,0x7A12D1D1DBDFB3,0x801938B6B298}},
+    {{0x54559506F92195,0xC529E77330229D,0x32EA7D7DF1DBD4,0xBC03800B423851,0x88677B73F8096D,0x8F73C5E8B9DD56,0xCC60DCC876EE},{0x8646BF9EC42F2B,0x755F68A1C2708,0xFFACF6AFF2C6CB,0x2CFC9ED409DD0,0xD26F14E5D59E7,0x1B8D4338C320BA,0xB22627D13F86},{0x85502C3E1AEC9B,0x23B60B1C11BBED,0xACE6CACACF77E7,0x654D8EAC01D4BB,0xAD823317C773B7,0xB29D6E4D6EB5AF,0x56283E8B477B}},
+    {{0x2F655DC6F31C5E,0x6BD0906D257142,0xBD205AF8900AAE,0x323EDF0CBCD2FF,0xD7C2808476BA8C,0x3D5B7C92024C36,0x6AEB0736C72B},{0x19DF0714CA9424,0xB65C265BD9233A,0x7BFC3796C69E86,0x50BA2C62973B1B,0xFA763603E2C66A,0xF604E2A6F4C72F,0x76A11417382D},{0xDB28B1079F231D,0xCE7E84C120F1E0,0x74D6481F75FA3B,0x2F7017486A036E,0xE6C0F554A79F47,0xE701FB7718C4A8,0x1945FF622A23}},
+    {{0xBE8D408CF3A86C,0x9303E9D7CE0BB1,0xD446987AAA2A04,0x9B3428BAEF66E9,0x2B59ECD83E6746,0xB09690E885C478,0x92E638EC0F5C},{0x6912EAA4E46254,0x6C62AD187DC587,0x8727ABB4AFC72A,0xAB55CCA3F4BDAD,0x61003EE3C773C6,0x18D2242130008E,0x83EA40428FA6},{0x37AE0DE06AC931,0xC4C89A83B4C395,0xB0B71BEDD6A4ED,0x3658A50970CC05,0x197297E8649AB6,0x48A58294C39DF6,0x6361D123FFB3}},
+    {{0x3E9858BF972AC9,0x72E32054176D51,0x3CE04D32BF2F05,0x61E26866B218C9,0x2BEDB83B99661D,0x8884F118CC8E13,0xB7D9AD6CDDF1},{0xA93FE55463011F,0x3FB4E5651CB3BE,0xDCEBA22A5BFF9E,0xAD9F09DD9B40,0x6E0CA2662887A3,0x13CB79A7EC76FD,0x37A19CBDEA86},{0x26D27971267939,0xEF5E15EB8AC48A,0xFC40B326189EAB,0x464E09C3759306,0xC9982E1C1A9DC9,0xDF23F84A662A05,0x5E87E32F04CD}},
+    {{0xB64302F29F2864,0x742FB0DC315BF7,0x60F4D57C974ADE,0x711EC0658B3B11,0xEABF345A5447D2,0x93B1E78223CE96,0xB09F327C2B4A},{0x802E99646EE4F9,0x4E2F5AF4AE1CF6,0xD316B63B5B09D8,0x231996141FA718,0xAFF9789B2DCA84,0x2ACA8BDF8C9B92,0x2CFCD744AC74},{0xFF3FB168D0D2C5,0x3B388325371E52,0xFF50321B3D2254,0x3D9A08F194A5E6,0x92C71BDFFA81F3,0xF50054FC665DAA,0xC0D47C37CFD2}},
+    {{0x9825AF8DE8DD29,0x5997B52162F99E,0xAB39A4CA4567DC,0xC3269A76630562,0x10A342B5C1F35B,0x6CF3E05FA0E3F1,0xD83FF8DD7C5C},{0x5C4239578CA66D,0x820471E0D10A8A,0x3BF0DD60C99D7F,0x4AD830182521D5,0x70DEB30FE3EDC4,0x70B2A880EBB22F,0xD1BFAD598E52},{0x8DAEE29273CA2A,0x97E4C7CBBD170C,0xF79FE404A7F9D2,0x8DA4ACB7AA6742,0xC6850BEBDD0E9D,0x9F05FEACB3F4EF,0xC08AF5B47425}},
+    {{0xBAC845354D713B,0x35E9034193E262,0x9FE279011CEE68,0x59E77E9845E88,0x9C045E091D3482,0xD54F4EDDC705DC,0xC22B774A9AEB},{0x5AAFD72CD73F61,0x113F9735A40BCB,0xFB4B8A700D8CE5,0xF9D8A1117A34DB,0x494F2A930F6D2A,0xCDC9CEE3DD58F1,0xE15B0819AA35},{0x9BCA9604598429,0x8C2D5F03DE1A9,0x2BBAFDE90790F6,0x6A6A8D45C012EF,0x30B1D93970EF2B,0x6B0FD06E973AE4,0x44C5B7CE8366}},
+    {{0x46ED405896689B,0xD6765C48048484,0x35D18CE66F78C1,0x6F009D1B511697,0xBB2CB8D6A9A64F,0x17EBA10F4CCCB5,0x972004C89307},{0x8E0680C8442B3C,0x94D77FA0AA40E0,0xCC148D23F3E064,0xFEB603AE68DA99,0xC08641E3E67AE7,0x49FC33F9D2CE5D,0x40CD9DB35BBE},{0x8BE2D33D808D63,0x443260FDC13246,0xE504A8D28A909C,0xA7D704C3E09671,0x288BAA7BAD6C44,0xE4B20E65319C84,0x5443E79CC899}},
+    {{0x563633CBE88BA4,0x85D9CA41D09008,0xDF0FB187896F34,0x3CC4DDB2B7B104,0xEA574AAEFE415F,0x4BFAE38CAAE0F7,0xD5055D6BB7CE},{0xD6EA1BCFD1F14E,0x22F0D1F66C684D,0x9F602DCE51325F,0xFB82094DE99660,0x5AFA6ECC8ACE8,0x486E852C7F12A7,0x6A229F271603},{0xBC8C59FF0AE18C,0xCB82595EF2502D,0x70A520AF49C36B,0xF22B46C97AC4BC,0x55E2463BDDA2DE,0xF328AB15AB4FE1,0xF2F5E3E51F09}},
+    {{0x49B9EFD63D9FFE,0x12DC6EB81EA470,0x254786ED1A48D5,0x28701A4DF2E4B6,0xFDC2C93F3EB99D,0xFEC5ABD124C4B0,0x987D8E593417},{0xA7A5172CC808DA,0x807FD26033235,0x8FA94564B4811C,0xA8B9335F35865D,0x80FC38E97259D6,0x7EDD774F84EF65,0x2BFA6CDD55D0},{0x6655136C9F4A7A,0xE2A6E3E7E20B61,0x3CB3EC9E2B393A,0xB3AED41577EEDE,0x347C11C8BC6C87,0xB3B634DA931028,0x643A7122CA34}},
+    {{0x67165635FC2591,0xE9E4FD36B14B7E,0xD97AA9E4593DA,0x2720CB047A0979,0xB392D13DD2E823,0xE8C5ECAD53F7DD,0x64182FA978FC},{0x2C219FCA9EC4C8,0xD9AF134E30DB2D,0x2F2D65E5A338E4,0x50188D860A1436,0xC5D7A777A0E75E,0x3D9BD8CE44FF5A,0xA4219ECCD298},{0xE1B531E140D88A,0x1AA02818538C83,0x4006A4DD3320F6,0x8269628D19A9FA,0x2A13174EDE585D,0x6BB484A2B181ED,0x49E11D2FFE7}},
+    {{0x8F71D61A11AD64,0xBC3430F39E5BDF,0xA9DCD6B5C84166,0x3F6EA8C3C192D9,0xD3850E60B15A60,0x5E6AB92B1CFC67,0x9690D4B0DAC},{0x3CA0055FD1D280,0x79390556C4D676,0xE8A0D351E8CD7E,0xDA1F744158D400,0x91C04679DE1BCA,0x8A1D56C8EF964,0x1CCA6A7F12A3},{0x8C6C4737E9198C,0x63F4EA7B6587E6,0x7F20641F97B999,0x3D1A14BAFE2267,0x63A4291C4DAC0E,0xA2CCB9DDC29358,0x20619703A6BC}},
+    {{0x847F0FEA65D5A4,0x1E5B233291A141,0x27FD17E3A49F8C,0xED1454682099C8,0x18C6A3ED33856E,0xA2544B0DB72A9,0x4E74C756BD99},{0x2E59B4B7C439E,0x7AC120094FCD47,0xCE9E7D4DFDF024,0xF6EF9C1823C4FE,0x71B8B31D8EA8BA,0xE047EAE03FC671,0xAA0D6B9A0750},{0x30291612758C7,0x2FE62032E114B4,0xD3B4EC3E74A3CD,0xD2FB6E25EEB6D3,0x332061199797C2,0x4DEA42382FA164,0xF97854184FAD}},
+    {{0x3554A2DA085FF4,0x104B8EEC66FA2F,0x305E1D509BDED4,0x76778359B3ACC2,0x14E578F8BC84F8,0xEEAE89BCB2B31D,0x349265A4F49E},{0xA7581DF7765A5D,0x8EB5F45B0985D0,0x94A82CCC15730A,0x6D200BE1522D5A,0x448160A558FBA2,0x61E2893AECB332,0x5AAF6C76E3B4},{0xFDCC7F72019A2F,0x3F43BBD10D4A31,0x9631E92DA7FC87,0x44FE8F2C675C43,0x9B33BD341D2531,0x688D2794C6E5C6,0xBA1735998B74}},
+    {{0x7EA9E33D69EF3C,0x8700BD34E5AFB4,0xF722190DFB7C94,0x101FEC18FD8305,0xC5FA0EB3C4C2DB,0xFF55AD4B604D80,0x8FC43C592475},{0xE6E02A9D5C6342,0x65E51BD886DD0D,0x2F334FEE3F6A2A,0x718109C78A804A,0x620470671772C1,0xB62514D83F459A,0xE69AD82D4A82},{0x404656D2E6B099,0x5859A9805B07D9,0x77E2BFA08319C,0x36B8F1F499FE36,0x7EAED1A820FFED,0x3D29C3D9D15B9D,0xDA41923BEAD5}},
+    {{0xABF32006B08C7C,0x5653B18735AC67,0x3E68CC490E735D,0xDFF94492A0BB3A,0xA6D694CE4C073B,0x6F04788B3BC294,0x4D71AA9DB3E3},{0x87BBEB1D0FE793,0x6F52EE5E4B07CB,0xFA4E97CEF15FAC,0x50120AD650AC71,0x7073468497B4E1,0x89A4735889C77B,0x80B63ABBADC4},{0x32B2FF6DF64878,0x66BC18CDFE76CE,0xA37849091F96D1,0x46B11593C4B99B,0x624E423BB6AFC0,0x3B3614A2022903,0x8B25759DEFE0}},
+    {{0x4B76DFFE8F4E3B,0x7A420217E57B79,0x74625EFBA2635B,0x63DF7776AC1E02,0xE811398B17DA13,0x7A10318BD021FA,0xFD559133235},{0xA7A66AC02B5E6B,0x4EBF7965FD226,0x3D8B2D81DE29B3,0xA5528A6B1D92AD,0x95CF04A2F3D87B,0x94EA7D4483982F,0x54AC1FBE4EAB},{0x9FA23FAD64E2E6,0x600DEF070E0164,0x21F555CA3943CA,0x66D63CECF4BC2D,0xC447FA9C146755,0x6F08022D2BDABC,0x78C9468B74E7}},
+    {{0xA5F937EAB6C038,0x44DDE0858028BE,0xD14424EE223E5B,0x36390419B0A71A,0x35B1BA09A9D907,0x4EC4491DF6E10A,0x415AB8D0F12D},{0xB4A3239CFF7BDE,0xD070491B8F2753,0x507268BC48BD7B,0xAA2057EEF55804,0xD6A8A1B6692DF4,0x11295E70ED2DFF,0xDD5102EFACA},{0xE40143A787E1E7,0xA9A3974A8AB774,0x2C3D59251712B,0x9480D6D057ECDB,0x5D7D4AC6639219,0x887E76F2DDA836,0x3D732ECC5D07}},
+    {{0x840D4AD3DC8747,0x9A5DAE93E517CB,0xA31CEE5AE358F1,0xD231689C191AC2,0x9C0D1569367EF4,0xBA630DEF23F081,0x9B209B7A7D30},{0x81AA915A601D59,0x5727C4B634BC43,0xA2C1789AE27CB,0xD99950F6541929,0xFDAED9890FBCC7,0xA28A65D47F1388,0xEA124A6C549E},{0xC1936EFF524F4D,0x884ED1442CBE8B,0x2F5EC2ADB1E2D7,0x5111E8433D0746,0xD867551F059D00,0x32F7694EC7AD87,0xE7264F5C20E0}},
+    {{0x4DE87B1DF54649,0xE04569672FEFFE,0x550F39F54FE125,0x88B5C22C7C688D,0xD43FD17191B556,0x836E6784837360,0x2751BF3B45BA},{0x86EC4F2D07143A,0x4C0225D5B47E1F,0x8EC20B3B399AE3,0xF0FE0751CCDDCA,0xE9C35B42E613A3,0xEB770A1EBD7F3F,0xF75938748942},{0x60B62E0D14F595,0xC4EB253492BC25,0xDF095713762725,0x4B13E4B1029BFB,0xC4A371F0122D1A,0xBB0E87408EED37,0x13ACD040A289}},
+    {{0xC260C9CB22773D,0x159BF907D22A86,0xB198B79CAC909B,0xF95851711C3E57,0xC8C00E8D37E0A1,0xC9E86DAF949279,0x65F97BA26ECA},{0xB426AA7D05D26D,0x81949907027713,0xD1195517D5EACC,0xB91916D5CF0840,0xDA2B7BA01F2A8F,0xA650F8DB143886,0x98B404B3889A},{0x2909F035187A5A,0x85E9B24B7055A9,0xE4BC39B49DC303,0x8E267F437D9C92,0x7EF6EF274A3899,0x6E93D0C276E473,0x56D9BAD1CB66}},
+    {{0x33CD5B631739B0,0x5B4E0DBD6970BB,0x77A433FB62DB4C,0xA0CF8EFBE9F9EE,0x2CC22F08B416C3,0xBE453CD818C70B,0x1469DB2406D4},{0xEB1F26678E0EE,0x21CC74FC30A98F,0xDDFA080CEC9A85,0x61336A36E63510,0x6A59256B169E85,0x8B81466DB1E8D6,0x74C536FAB390},{0xA37AECEE009D51,0xCDA1C4BF79DFE4,0xB99F9F9C9E7C19,0xF7CBB9395DB96A,0x8D2010AAD7704,0x6544E5837D99CC,0x305E76D4C29}},
+    {{0x85CC769BC31F1D,0xDCC14D1F339645,0x8647778BFDD9DF,0x27FE4BA23DEEF4,0xDD5886B00E0EA6,0x8A2D7DDF7C099B,0x1C4E23517F0B},{0x4833608077AE8D,0x3497B6F01D4D2E,0x5E228DB86FCAE9,0xF469BB44EACCB,0x40A4B242663A37,0x5A66B185979487,0xB753FE700390},{0x8797B96F83A9A8,0xC29404CB9D5993,0x83EBFED169ECA1,0x80AAA962031676,0xCA5E4753066F1D,0xFCBE11F14A4741,0x2DE2464824F5}},
+    {{0x2C496AA512284E,0x321E8C0EE5BCD4,0xE1A9CA16BB801,0x22F76A043D5850,0x4CEA07815DF73E,0x3181D9051DF98,0x8CEA067748F3},{0x3D360FFBB1D674,0x9C448E8FD7E837,0x65B89896C82CF,0xE6407A3136103A,0x90C33240CE05C6,0x884566DC8EA34D,0x7867620D5E73},{0x6D5E892596A7DB,0x9B2E72C22F01A9,0x8A464EBBC8BEC1,0xCA48E38441BDD8,0xA501E22B032197,0x9265D143E12781,0x7F5EEFD6F2B0}},
+    {{0x50D2C28DAB2B03,0x79BD588C9AD042,0x5A9DC9240BA6FC,0xF541A56FA4CC9B,0xCD70299FEBDC4F,0xD657F70679844F,0x711A7C43BA75},{0xC41831A91F793F,0xC94185BD6D2309,0xCE9A4423BC9651,0x45F628D6F7AA7A,0xED1311836BE176,0xC25EF4AC3749F5,0xFD998B8C9152},{0x656CC9C762CEA2,0x896223CEF49842,0x36839C8E6FD3EE,0x4FE540F5D6BD0B,0xA409D01A6ADA49,0x5C33BE22966288,0xD350EFC45064}},
+    {{0xBF40A1BAAFF649,0x167B2C54B4646A,0x3CAE6A2B523284,0x58FD554C770597,0xEDD7E8C6E45B2D,0xE02162D52D577C,0xAE8FBB82D2B5},{0x92DC43AAD2FBE5,0xB963B288274578,0xEF70360CE600DA,0xC32D16EA01EED2,0x8F4050F5572EBF,0x2DE6EED466615F,0xD84A9DFDBAE7},{0xE3E648A6E983AC,0xF3472946793FC2,0x52C74AF662B73D,0x7DA14304576FE,0x619ADB7C697050,0x77722AD7406F12,0xF4206F6F8021}},
+    {{0x2F7575F80C2A,0x6132E2BD721C21,0x3BBE2E4B147782,0xA421CF7393E87B,0x551D023DDA8FF3,0x2159D7E917857A,0x6D6B8AC148B5},{0x92827470730393,0x24026B45B656F1,0xF90A72FD9E00A,0xC685DA7AA11A96,0x4AF379193DFB58,0xA7F7C8D8F3F112,0xC574D2662BD2},{0xBBB3ADFCD6BB36,0xB6F5DE0E4E2338,0xB4EF0F01380084,0x8A84524B34BDD5,0x220749A0807EF1,0x58204CCD9BBD67,0xD795CA4B81ED}},
+    {{0xB73BC8CC1A3725,0xC1FFEAE980C6D0,0x86F7B5DD9B31D3,0x5E05F54CBD8AE4,0x780BAB3B8634C,0x5C76465C2C175E,0xCA616473525C},{0xCA1E642A1F86A,0xDA95A7736F2E0F,0x8F9FCD41D789C1,0xE2F0D3F3CBC0B2,0x486DB8985674A1,0x904AD8A31C3679,0x20515BFA02F2},{0xDFECE60CF7DE2D,0x1A0F644C55A423,0x4A7AD93D30A420,0x365A893E4939A5,0xA8388CA62F9DC5,0xD8F69E2D499F2,0x13A6A84F0C74}},
+    {{0x9CBE3E10A156C1,0xF7728998412EC7,0x651002944B02D7,0x4D77EDF1097E85,0x833ABA52195F9F,0xB949B9DEEC13E1,0xD46AE3153843},{0xBF11D0936E47A5,0xA9B0898BB1C8F1,0x96F9D82BC69137,0x9EE7DCD65C80C5,0xF7DAD8EC72EDF0,0x997D326278BF6B,0x5509101B7478},{0x3E07C8ED7AEF43,0x871257BE733E84,0x7FCE8D513D05F8,0x137FC96927D7D9,0xED6E0DEB82FDAA,0xC0702796F62CDA,0xA62222FA1DD5}},
+    {{0x22A939958A2AAE,0xD2ECD0E19C34C1,0xC43A4B8E4299F4,0x4B71B39D517541,0x2496F1C65ECEA2,0x3943EEB194DE8F,0x6D0B88D6DF6A},{0x92DEE99BC1965B,0xAC38D24A302A9B,0x1048E201B7E0E5,0x21F1FDE21A067,0xE9AB3F005D7610,0x18A541827AC5D9,0xC4130BEFBF2E},{0x2BC5ECF4B7D283,0x88538D7A181332,0xC7F26B17B81502,0x88F88CA18679C9,0xD0EA0AA11203E8,0xE28266715AEFA6,0xDAF48B6D85F3}},
+    {{0x7144CFA6331AEA,0xD7365131F5E8AB,0xF78E9E9083E686,0x48A69B045623FA,0x7D34520B0CF98D,0x96E751632BFDEA,0xB3876C51D048},{0x21BA5A1EA9D479,0x779043783FCA16,0x884BE6ECC05CC7,0xE6DAC153540C1D,0x9A8F2742641891,0xF056C70A85F0A6,0x8EFA29DE4C6C},{0x90FB5C7BDC5558,0x563C64427372E3,0x6E46A0830A4967,0x77A89471DEA561,0x4D7E3AB5E8AB66,0x86FB91BF2A7226,0x5351CCEEFA18}},
+    {{0xE7388815F083E9,0xA74DA127D6CAAE,0xACB9BFC430D56A,0xEB153198E704F9,0xB0CE00B950F71F,0x1ADC645D83D736,0x96288FFAD0D},{0xA227B8FC27DE4F,0xB6B4DA6347D4EC,0x4CC8DA9DF86963,0x5A2B85D0CF0110,0xF7AC27B000BD51,0x843260CB325C68,0x7D5FD29E0AC1},{0xEB5FD7D2E085ED,0x718F3A38D068B6,0xEA95CC000370B5,0x1594A71EEA1E2B,0x8F7E9BDD40C123,0x375E3EDEB9FA24,0xF649CF7C9715}},
+    {{0x9F7D654BAC32F6,0x480580C3EA065E,0x26E2E62ABA433F,0xE22A3FDFAC8322,0x5B1A10A3398D6B,0xEEF48DFE2B7BDF,0xEDFA65C97C83},{0xDA6A5BB88FD02F,0x3A1C214A28E5A3,0xAB0C75A5BA3D22,0x5518EC9B7E86E2,0xFF5C76D88D1570,0xAA62E3433F9C5F,0xBD3E8ABA78F},{0xC52422BDE378B,0x6E6703649350CE,0x475D7D2FBD1494,0xB282A36A6CD511,0xA448FA033850C6,0xFC3BED6257E453,0x615FB0541F30}},
+    {{0xD67B9242D5BD87,0x893179CCFF103C,0xF6EF56D4FA4187,0x9766B07FD6BEE7,0x72D8E3B9B2F677,0x1C8B92ADE0D2A3,0x29B3C1960A50},{0xBCC5BA5A01FE2,0xBDC88D7E031DF2,0x6CA345126F35A8,0x8D41EBB4DEDF9E,0x67A14E566CF1A9,0x54BDEB2733E646,0x6C0811EDFABF},{0x44C0B8A75E862A,0xF15FEE113EF6D0,0xAF126A4F6B4C64,0xF6A71BB9E4B8B9,0xFC067F9F41BD54,0xB4243B6E4D5C91,0x9B6A951A2157}},
+    {{0xF69D7C76756F2E,0x1902052192A3A7,0xEE977B6A6C9F65,0xA96E348120739B,0x5F1AD13A7AE9A2,0x73CA64C08B5130,0x7B836030EE93},{0x1630DB61B8BFF9,0x51C1F9396A850A,0xE6AA05F8849B5C,0xD7518C99633243,0xA9FC2217375850,0xEF0BE342B20FB9,0x25B783010258},{0xB023AC0DC6C5B9,0x705E4C7B191D20,0x57B219AF12C950,0x8CA90F05A7BA37,0x89029734AA90EB,0x14D42C9403DC06,0x27058D140FE7}},
+    {{0xAA9552C04C5E4C,0x42CF5A79C485D9,0x5AC30A9B2F4BE1,0x25A2A9C0A24F5E,0x1EDF2E8A2B0D99,0xC44B29C130205F,0x653E3B30BE38},{0x5A3021DAC7C113,0x159523E74D70B4,0xEF003ECAE0EC3C,0xD0D84918E8B25,0xD7826C1AF1FBF9,0x5612D8F6D30C78,0xDAEFB5011B82},{0x23DEE609319283,0xEB89ADF3DB233F,0x425D657F79FF08,0x7EC7C76486CC7C,0x8FF1272491D196,0x1729B1DFBCC15,0x60794B958830}},
+    {{0x64C6945E0602E4,0xC01FBCD8A3871A,0x555250ED427CBD,0xAE78D837EF66E5,0x2AAFAA946ECFCD,0xC471055FABD2BD,0xC5B53CED8848},{0x157180D3AE7540,0x4B30088E03217B,0x1651D8821C2396,0xA97AADB9A1D9FA,0x980478B1ECF2F0,0x4D00BD22D686B4,0xC392B32A3F79},{0x3B1F67034373C1,0xF69ADE4FC4EB65,0x97C3B19AB28B35,0x61DCABEC5B1D82,0x49A42290F345A4,0xEA139D1595B2EC,0xDDA015C43E96}},
+    {{0xF65F33766D381E,0x5DEC0600C4322F,0xED427FCCC1BA64,0xF72BCEC0FFED0B,0xB78A463F897E0B,0xE50EFC061AD66D,0x76A92B1C601B},{0x1A7BF543625881,0xC32D16B69F3FD0,0x419E244992D74D,0x6C1A0F6A5B5BCC,0x56839BC42F8B72,0xE41F790BB29D98,0x53E988930A2B},{0xC720663A7553CB,0x4962575CBAB9BA,0xF798EA92EE0E44,0xF8B7ACCE8A75D5,0xA48C01D75192DE,0x933B7A24A5592E,0x98779F9F1F14}},
+    {{0x3232A8C034640D,0xB0F62BD406AB2,0x33C7E547D150FB,0x8FA32A6C2115B4,0x9DB3DC0363DDFA,0xE3B8C6C5F88B54,0x806D1C978522},{0x15BC4A724861C9,0xAE0F0E17B3727D,0xC5262F6DCCD0AC,0x69D8DB19FBCEDA,0x743EB35EC5017F,0x4BADF8FDE237CC,0xF60D13416EBB},{0x32C1658D17C37A,0xBA57B7BC305FFA,0x329B07BB634C14,0x96F7BB06D6466A,0xEB83152DE7ADE7,0x5C686BB12AEB01,0x2CDED840EB5E}},
+    {{0x3A9F8587FCD1EA,0x73E0ED25E718CC,0xACCA0C59F1CD95,0x4949291858557C,0xC757ADFD6C6685,0x59068952FA1CF1,0xB46757AD0DAF},{0x6E0B0DDB3C97CF,0xD157C162D654AC,0xD75C37B44A9252,0x39360044CC2035,0x6D3E0A8B797B1D,0x9DA943CFD6A186,0x1C1488399A09},{0x53037FFF1CBD80,0x63CBB7932A5687,0x944464F2EAF045,0xD4CBC014FA37AD,0x8365134E4A0F15,0x4C93F6512D25B6,0x485935363C2A}},
+    {{0xA57AA3D8C799D1,0xD74744F0155646,0x1F3EAB4C374F33,0xC324DCD63FEFAD,0xBA9B5CEADDE8A7,0x2F64EFA5A425B6,0x6B26611AAD98},{0xB4714918A31A60,0xE85165BE03EA1E,0xDC99EEB24E8172,0x4896A3EC9272D9,0x1B5F509EC727C5,0xBD1D917E066C0A,0xE90270D6F9E1},{0xA3AB945073B9E,0xB0D07962322572,0x42A7DA14A0B7DC,0x63E00F932AE15A,0xABD2F887C4569,0x4D023D64592D18,0xDD9C71B63106}},
+    {{0x9A35177DAE1C73,0xFE1327B5FC0C72,0x4AC77F3CE7E5C2,0x158A89303905A,0x15C40A9D700517,0x336441D1E29303,0x1B22B5543D14},{0x16B6DEE3E888D3,0x8E9875F349C355,0x625DAB1E16DFAA,0x30F11D407C2F01,0x6839D2C4629046,0xDF9D613C81E590,0xF6D6087C076C},{0x3510E451C63574,0x1CFAF79B224A7B,0xA1B40974822ACA,0x32F6E41FD0AF27,0x8D0E0D4547F82D,0xDB78DD61EC6197,0xAFE06779145A}},
+    {{0x30983AB321907F,0xB1FEF49E1D4090,0xA7FFBBC1642424,0x6D3B9E8A476EF5,0x9DAF4058B797F1,0xA2013901118F66,0x824CED9B15A9},{0xF8E26BA2F8B9CB,0x99A67E14E00602,0x2124A794617BDF,0xDC7522B63D3466,0x9519C189E7782E,0xD613C1AEAE25CF,0xFA95533A3701},{0xC3C86D3568FC01,0x953EAEEE67B7B5,0xDB5CCA9F01B3CC,0xB9A094E7133F82,0x630D60C816E835,0x7CA9651AC43012,0xA423AE9DC8B9}},
+    {{0xE561CC233BA10,0x2B931F7CEEFF25,0xDD29D94B704922,0xE2EDE2B3DBF295,0xD6BA54275AF8A0,0x566EF1AE323581,0x8B4A4F502C53},{0xFF75344730C740,0x5DB0C00CFF861E,0x55B55A62EB77F1,0xCE283DA5A72FD2,0x900FBF48C1A8F2,0x54EB23939A5209,0x4792E0E1CAE1},{0x4C694C63672E4,0x24F2A9FD962901,0xB8C6BC346DFD4A,0xE7F252E58F2E0B,0xEDF41755600F6F,0xF2BD236B77504D,0xBAFE3F41D2F4}},
+    {{0xA82E8347B056A,0xAA94576B6592FE,0x3C8EC89FEDC10C,0x8D283ADCB535ED,0x5A1F94A77475E5,0xA42357B5519B5E,0xCFEACF4EA505},{0xDE33F61325FF57,0x58C1277A147EA8,0x6912018720EC45,0xC6C1C9AF839AE6,0xAE4D41CDD0306C,0xC771C9783B88A6,0x723DA1C6187B},{0x6A2EE16898B07B,0xF57668E72A532B,0x5F0372A815A605,0xA9F8371D82CE0E,0x295960C400E0ED,0x581D0E0FCCC73C,0x108B9425151F}},
+    {{0x97AE533B43893E,0x788A64D1200183,0xE05B94E2F1CE27,0x829BA65742A19B,0xB8930AFA31EC04,0xE8651E1F7EA891,0xDA048C7DF023},{0x9FF85F3590D7A1,0x5C205905618019,0x9D110B7E0A2355,0x7287320FF736C2,0x2F6C9D2FF503B2,0x7F44927178B840,0x3C660E778963},{0x10A935AB82C7A1,0xDF1D8728218779,0x5BC0501C3AB328,0xB5CC0211ADE0A6,0xB71E8F1488B8D2,0x37C86A5A94315A,0x655B6D0567C5}},
+    {{0x79309BD5C5494A,0x6C4C375A1C3627,0x52E0089D4A1E5B,0x9EB9EBA8F1F050,0x4795C5262DE606,0xDC4740897B040E,0x7964A13E18DC},{0x582E3F0352C637,0xFDB6147A75A552,0x9E8718AC7935F2,0xDE7469305CB3E1,0xF3B6C1D8084208,0xE7F7EE27F76223,0x838C0651F6F9},{0x9229336806D086,0x1D57B90624661C,0x181A96BAF54604,0x571D7B97C6E173,0x7A8DDF9526E81E,0x54E4E77A7F324E,0xC4A3FAB51777}},
+    {{0xAD0D4D18565BF1,0x6064F51878E5E5,0xCA1809D730A320,0xF8E4BE775FBB6E,0x9DEC9DE62F3A37,0xBA0212C8B551A2,0xD347ABF635E7},{0x1CF17275593C27,0x28C952D47AC4D3,0xDC7C61DF9AA751,0x8AB722F7EE05ED,0x117DBCE1FE56D7,0xC2E3BEA0E3AAB4,0x207EA271D52A},{0xBA513CA58112B0,0xDDFFA4C9AA8502,0x87256CA818F19D,0xA17469EAA51CDD,0x2535F2C4E15059,0xEBC160552D9DA7,0x18D42AAE3CE7}},
+    {{0x1D634B7E227A43,0x2ADC33EEE0B05F,0xA359FCE3CBAE2C,0xC97164D3F9089,0x4C8C35F8E19C5F,0xD31AF48EBCE319,0xB2FB23C98D00},{0x52FB376E21504E,0x667666A5E2C1F,0x420A3606E7C062,0xA761B51B63E99B,0xA3504A5AD90599,0x693D791CBEC4CD,0x1BE5FC22A8A7},{0x6A8BC73283B6F1,0x4ED8A4DC77CE4B,0xD48744E1F8B66A,0xC2F27B851F0073,0x4E0DA76D37DA3D,0x821F28D7007C36,0xC67A13CB9AC}},
+    {{0x17B98D01F5E31F,0x5CAFA443DB2FF6,0xF8FCFD639A3BD1,0x3D58B1518E9290,0x9DABCC9C3AA612,0x2C3A6009BCFCF6,0xF870D7E7F523},{0x8EF11B7E8E2B69,0x20729CB3C77971,0xF81438A0C6754,0x13FCD06A811E60,0x310FA6647F129,0x2D971E23F498F,0x57A84DA8D6CF},{0x14CE6BD560233B,0x6C6DDADE3EBF63,0x4B9A81F96A61B2,0x133FBD9A0B839E,0x9D1425D92D0C5C,0xA9668C4608463A,0x122755C5E60F}},
+    {{0xE1CDF386FDA631,0xEF06E41CC844BD,0xE277C9020CA75A,0x62D48E606DBF8A,0x86864DD4276ADD,0x4CB5BD6A562101,0xF7CA14D2E658},{0xB35F2AAC791BCA,0x966C3941E5E739,0x30DD29E4EF25CD,0x79F28146B2BB04,0x624E6FA7FEE7B4,0xF11E05ADC7BD12,0x96BD0D60A979},{0xB2BDCB442901FC,0xB3D5387C4C9DC3,0x78A020A7918F6A,0x8A6314B6816D5B,0xF2A591FC336EC8,0x359A2FD5495663,0xD9DAE3174274}},
+    {{0xB0DEBF97ED007A,0xE508373F48BCA8,0x71FFA6BF1C63A6,0xB9C885890E702F,0xAB75ECC96BCE2,0x2575413A58774E,0x12CA65C4FFBB},{0x998B1DFE8BE6AE,0xEC114C066EE7D9,0x8EFB5016FEAB05,0x8F6E2E8DA34171,0x8D6C3A7BCA921B,0x3F2DC9CF34B985,0x701F11C2AC},{0xDCD8FF1EA9AE13,0x5AE92791FB2E43,0x7A9EAC263C3501,0x668E4D4C2580B9,0x145E1E448127D3,0x54FA87368AFEBB,0xF2B7DC320DCB}},
+    {{0x1E5BB3C6FEFA8F,0x8A82C6E149B39F,0xA3104702B74109,0x78834076FC6F00,0x43BDD518701AE1,0xF528DC49CEDE3B,0xA70E9258DC57},{0xE5442E6B43FAF7,0x893DB6C2A5BF35,0xCDC6285BC7F4CC,0xCF986105EBA3CF,0x3C36EA3085306D,0xD567132EF430D0,0x9F34A6C4EABA},{0xE12C272865A1C3,0xA46AC64E071DF2,0x571AA104A48692,0x99E121C19C87F5,0x970CC9282B232B,0x23730CAA514A9,0xA6EEC131EA30}},
+    {{0x2358ABCE2AE44,0x1E9BC0DD6AB6E3,0x9872399986DE8,0x935FE2A55651E7,0xD3CB55D8429F0B,0x63CE5BF271492C,0xD93F0FE4C99},{0x9354A0DC1FCD2,0x1295BA328FC956,0xA7FD1EE59EBC99,0xCC7AFED92782F3,0x4DE8D4EBB611E6,0x8C00FB03EB50F5,0x120CF7D2A7A2},{0xB0E63C9B772BD8,0xF0E1440840FF65,0xF99E3ADB3E0995,0xC6A2F26E9EACA9,0x3DB8EAAFB3A927,0x14CFA4744D9372,0x4A5DB056D7D0}},
+    {{0x4A9F8FB8064B58,0xCDE002AE928EFA,0x847033D9EC3C77,0x148DDEE6E2D40E,0x530B07A776ABBE,0x85D1C9B90B986,0xA5D023E5F966},{0xFFBC4C047E4D4B,0xB9B8271A40F833,0x97E640AAC14651,0xD285D872C4DDE4,0x5942700B3DFD10,0xB4235883F2B18E,0x45D1CC5BA8B9},{0x25A65EDD4AA634,0x33ED1C37348508,0x1187AF0A964428,0x7B33266531A2AC,0x94FF2C77BAC108,0x9AA21DA023551B,0x10885DF6732A}},
+    {{0x789DC675076A7F,0x9F2A63C855D787,0xF904ACDF5370E,0x3CE3BE7E4DA151,0x24A23CBDD65A2E,0x182073516A0CCF,0x72DEF889CBE8},{0x48C16843BC8447,0x2BF5E9174CFCD7,0x153A1F6EBD8F93,0xFFF50FBB963013,0x3BAFA5658D743A,0x205D201BB8F200,0x7854DD565680},{0x77485FBABA8BB8,0x70B4B54E64F5B8,0xC82B6EC7529FB7,0x2470688CE030A,0xF36DF5602E96B2,0x6C1C085AB7181B,0x4861F5F54EA2}},
+    {{0x101D0FAB9C3D5C,0xDA36DE4ECFA7D4,0x5A4F60012D1453,0x361838F4C69D1E,0xDF007F1E72FE4,0x934F5C08F8D971,0x31875A374C67},{0x230AB020F3F60F,0xB58F3636423DA1,0x8125E972EEFF38,0x806F2E035DA0E8,0xE8563AE8E8DC0E,0xD7A0712AC51E34,0x36F693FE8DFC},{0xE404FA3A856E3B,0x191D3E4CB219D2,0xAC8948A1EEA44D,0xF4006679424123,0x22189753B45F28,0x398F5A1DAF3909,0x4F56856E32F3}},
+    {{0xC0C0699EA14E22,0xA6EB8DF805FED5,0xB4C474C7A12E11,0xE26A70E8087463,0xB682CDEFE5128C,0x243945299900CA,0x977CAED01907},{0xBF19F99A795627,0x34B7B66D04D08E,0xC5164484E9F0AA,0xB36B624DC47758,0x64B7A56BD3F3E9,0x2327A2C97C76B2,0x1E552178603E},{0xA27287DBB1D348,0x9313D519EA0247,0x4B87BE28063204,0x392AE621D26A6F,0x7D0D4667816142,0x95BEBD5D689DF0,0x859DE8905D38}},
+    {{0xC8453DD346D90A,0xA0646272E4B809,0xD08845465F2338,0x9386C96DC94516,0x1E3D04BA5E7127,0xFD318917A7DDA1,0x6FE5AC60FCF3},{0x3E479E2F7E6AE9,0x6224F6EDA2E809,0xC245B6AA0F2A19,0xA9B0AE5979EA2E,0xF8B9FED8D2BAD5,0x3F785E63E0BE88,0xAB85488997E0},{0x3C14B958BE1DB0,0x353652A16F6E2A,0x66CA5E41D5770C,0x7BC50A8964123E,0xF671B9F82031F5,0x808AF9511E74,0x28D44EF99265}},
+    {{0xEAB67BEA2B7496,0x3F7F3E075B3B84,0xD87C935337E705,0x9561C1DE81F53E,0xB36FDF5B5B75A9,0x9D43A44CAD70AD,0xF7306DF76F4E},{0x81760920D2FD8C,0x5994791E366655,0x5208CDCA7C2B1,0x1C7ADE02F40A36,0xB5287B4BC026E0,0xBF82C3B20DC589,0x9B96C201CEFD},{0x3E197133B06E96,0x9E8B5F61D580B,0x4F21F413464537,0x647B92949425BB,0x5AE60680E76316,0x6DAF982DE51928,0xF2A5201705B4}},
+    {{0xF4F37694728D93,0xF5D6B1218FEE76,0xA095276159288,0x99E66C455A7E71,0xD13BFF6175C9D5,0xB4490227DC3D45,0xAA4D4A06F3A},{0xBF8CD3E581B1B2,0x8BC3E9566932D3,0x9B9B4B090E67DF,0x1F6B52C1B45CFD,0xC745FDA6FEBB70,0x349780D790F258,0xCC06925B6B8C},{0x8E4A0BF49065E5,0xEA033A13388892,0x80E44A9C8053C6,0x3DE78CAE4339B9,0x269944FBA1195E,0x7F87DB619719A3,0xBCB184DCFAA8}},
+    {{0x9A11FF0603617E,0x159505C0F1A358,0x7472C81274369C,0x8749B70D78E548,0x1B8E5E0AE30132,0xD8EE66AC3A249E,0x5BF67FD26A20},{0x38D4F363F70673,0x4012EDA3FAD905,0x8554C035648D96,0x689E243577B94A,0x2DEC5F54B2810C,0x8017CE9C76657E,0x97A38984E11F},{0x7C41AB2E6A845A,0x6A602EDEE52737,0x52A9114FDE8FFA,0xF14B50788750A,0x5D7D6C8E393924,0x90403B5E57788E,0xCC1C6584F76D}},
+    {{0xF5C2DA1BB6A889,0x3896B7F0B2AD4F,0x19D22D157234E1,0x4CF47FC75E83D2,0x80A18F501DF2E7,0xCDA7AF9F005210,0x199649B39891},{0xFEC03F7243F1C3,0x193457F14A26E7,0x231BC9E6D302BE,0xAB22C6DE6E99B,0x55598D4DD5A097,0xDF139318A3564C,0x36442FAC88F5},{0xF926C00F2C5BB9,0x6150FA86A93158,0x494A7B26911F0C,0xF7F4C2D32E6CA8,0x993544CEE02F44,0xB92B2E6C91B678,0x346359ED30D1}},
+    {{0x3ACD7E16618E3C,0x7A20BDA8477A7E,0x658A5565B8C3A2,0x9ACF3FBB44E2D2,0x3C56997E3ADC9B,0xE2AD3115579BB6,0xCBF0068F8B08},{0x83CA5643EE839,0x80690AAA9C8756,0xE1A989455FECFE,0x859A32C037E5F3,0x8809E5BD7A18E4,0x2F2CE318257970,0x8FDB325C8827},{0x80EE1B430CB7FA,0x18F9B2CB1BA8DC,0x9EFE6F6A5D0658,0x8BBECA80739AC3,0x115BC80E3754D3,0x85039A4A9B0499,0x1EC691A85AB0}},
+    {{0xFE362377DA5C91,0xF54E5C63EA7AFA,0x28787276A48F95,0x3A7DDC96E323CE,0x9F68089BFC997A,0x9C5CFBC2BDBD37,0x838E912BAA42},{0xC8327580724382,0xF8D7D37DA2B1C7,0xE6C4CC0CE67ACD,0xFD4F8BA7072655,0x109CD221B75753,0x90D6B03FD9B880,0xA1435D10EBF},{0x4C00F922C1BABD,0x61AB110CBB51,0x6CBBD2FEEAB480,0xDE8093D2D5473A,0x9A28560AC41978,0x43039F35B31F15,0x236A08092E64}},
+    {{0x14378C476A5426,0x223827C2F4EAFB,0xB66AA04AC9E635,0x6776370CBCAC22,0x8008AE0166BA6,0x3FC016CF3494B9,0xC5199A61845},{0xE90C658CA74B4,0xA5308138F7A32,0xD2C50D58EB81D5,0x3653D1C37F61CC,0x5CBD0C1682ECF6,0xA78C011577F05B,0xE103105B45E2},{0x604A4F38F3080F,0x9B576286DD5F2E,0x2A77CDEEB75DB7,0xC28A7B8A1848CD,0x9674174EC28347,0xC5F80448D9B893,0xAD471E472891}},
+    {{0xBD3C6180507365,0x6101AA80A4558E,0x30495526281D8,0xCF7B6D7B1A67D3,0x4D8BEF80D781D9,0x67FD7F5130DE69,0xD3F6B381478D},{0x74AF6F7FD245D9,0x5CE9F74C6796F5,0x48DAEF4B1861AA,0x449367D236A75A,0x788C23FD87584D,0x6253C24664F0A0,0xCE6D3AF38C8A},{0x5C0695839982BE,0xAAFBA763197B3D,0x6A7E7E3ED95256,0x3B44051FAC710F,0x16DD1DF5E3FC1C,0xF066BE87FFEA4D,0xD0A0AD6E5BB0}},
+    {{0x9E08BCFB0117DC,0x10EE54179B8063,0xB9DC65FF88BDD0,0xC7DB0F6B465138,0x8AB27B276806F9,0x599D58FAF791A4,0xC798C78FD2C8},{0x8F3242DCF17F72,0x2F6EF34AD03C6,0x10E89CC6615D55,0xE53FC089BFBFD7,0xA273AC21136DCB,0x70C5AC4FB08E05,0x3B3FEBB767CC},{0x7E0FBF10745A84,0x97C3B092287757,0xE37D38B5943F28,0x6648892F107D3F,0xA79C6739AE0D31,0x5B8A08E90D804,0x897B0E6C1841}},
+    {{0x3C57A1A16F7F14,0xF9DDE84DE30255,0xFE3821FD3F40D,0xF5A8137B00AB08,0x9CC58AD9543D9,0x2E217036C7FEFA,0x5D03FF9BA8A6},{0x7AF85632F108F2,0x2653DCEEF44D73,0xB7A59D8B341BB6,0xA8FF2135BCB922,0x82E17BE29A1E39,0x2CE9C3D0EB659B,0xEB6C07B2ACEE},{0x81876DA81D013,0xFD822FF0F3F242,0xA4A91CBB783A0E,0xEFCF46AD432ADF,0xBB5E75A6786940,0x1DDBB9ED17AF51,0xD00B8CDD64A9}},
+    {{0xCCC43A32983FEF,0x34519B72B4C421,0x1852848FE564EB,0xCD611EE970C700,0x5F98886D677915,0x9CE31F4BF40804,0x5F70D0DC0719},{0x98FF63E2EAD06A,0xDD5BE93AD589D6,0x36F5771A6FAE4C,0xDA9A31CB3583D6,0x60E8E0A639662,0xC4E3ED80539B25,0x52B1E9549972},{0x76944CD9C453E5,0xE90D4543D56A31,0x72D429862D99A0,0x8913FC9C147F33,0x45D0829C33E196,0xAD763D7CEF8ECA,0x48FC178DDD73}},
+    {{0x56958CB98862FA,0xC4DF14084437D3,0xD58A8C7B11D3F0,0x62477A9BC30030,0x32DF76B11698BD,0x191F3E4CCBCAB5,0xA4D94D6D9E78},{0x51F1EB9A346F13,0x980750370E3FCB,0x9E715A7365D1BC,0x7CFF51D4E02A01,0xEF8C8EE78D6C84,0x65E71BF211BF77,0xA439F0B289D1},{0xB5FF0A101EDC2E,0x53CFC1BAE85D6,0x8C0300C0ABEE82,0x1481C16C5611BE,0xB4304A490EE88B,0xA45C011945FC15,0xEE28E46E5DC0}},
+    {{0x382D84C5996810,0xAC8622EA661B7B,0x76159086FB1ADD,0x7B0FE0870DD8FA,0x2E5D6BCF4BA470,0x5B83F59B20780B,0xA223266A9600},{0x405D8FEF89696,0xA04AD71FFA3996,0xD257B7786DA435,0xBB77689CE8C0C8,0x8E48D0372C877E,0x613F6990076282,0xBC8268576668},{0x9D2E9DE8F382AC,0xAD5A67DDF90C87,0xEAD352BAB69176,0xD9D6225E8C6C5F,0x14EB41B59E3FCC,0x780D206CE20C71,0xB1E2026F7B23}},
+    {{0x99B58CECD2123A,0xC6CA8F2B5BC365,0x38767349F095E8,0xCC2138E9BEF4E9,0x2A0C5ED918E8E5,0xA6E50AD1712617,0x2D79C6531710},{0xA2738956D8AABB,0xF3A780C5B56DB9,0xCCFA177311715C,0x5785CE390273C3,0xCA1DAF088709EF,0xF4B727668BD0E,0xE6C44BA02C37},{0x46F6968FB11C1B,0xC28E5EA6013C69,0xAD5A2D4578746E,0x9CBC824A713C84,0x380480DFB2C7A3,0x8D0A2B6EA25806,0x9EEF2FD9BEB5}},
+    {{0x9F31416B6DFE53,0x59E552DD58D3DB,0xA1FCD45E4B69D9,0x5C38B5783C2553,0x460053DBA5366F,0xC1E6AE74283350,0x7099CED43742},{0xE44F3CDF85EB79,0xABE349BC22B284,0xE2BC61F585D3E6,0x503BC5EC969D81,0x7D074358C321E4,0x96DE699400DF9E,0x9985BB1AC38D},{0xFB6B85798E8F0D,0x4AE6E2860D6BBE,0x6AEFAC8EEFC2C2,0xFE6E515FF7D171,0x9458B49AF46240,0xBA42826CFE4494,0xB04880675160}},
+    {{0x970F2527DE2226,0x8C2425ABA3608B,0x6148330F008013,0x614B8887C21B48,0xE07B8E6B9DAC39,0x50EC464B9ECC66,0xAABDC982A522},{0x8ADABB1A6167F9,0x3627FF6D3FC691,0xD7C668E701CB1F,0x17CA11E6ADA478,0x2B54D9C0EFB918,0x68E71C124C9C36,0xB5737918D077},{0xFC4C16DD9EC40A,0x982EAFC61DF61C,0xB3CA3DADB30EDF,0xE86D8555386D1,0xCAD0C0F6E572F1,0x7D486268761B64,0x643A1814284D}},
+    {{0xF2EF0FF0AC2E21,0x29EABBCAD53EE0,0xF36FC88E2A4B30,0xD0C80135F25282,0xF3E0C514FA8D55,0xD2E8BD8F3ABB35,0x55AF2E4CE3F6},{0x7E0AD7210CF2D1,0xAB216463890C59,0x55967E6E8A68C3,0xF444430ACB9198,0x759093C0F9001,0x19DEA3A290F6B9,0xAE4D02C39BCA},{0xD0B54D3FC85D5D,0x37CFB624E975A6,0x34D14C81ED6BB4,0xD74AB39C38D5F,0x33E97C194773ED,0xAA81851AF68723,0xABEAB403013D}},
+    {{0xFB6E3CBFA59CB2,0x67AE1892446959,0x96E9DB62C1B1AC,0x83B8642F275B74,0xBCC3A52AB429D1,0xA117EB20EE910A,0xEE565960D6D1},{0x59B1C4C018D610,0x21CF60323E9167,0x9763FC70FAAFC9,0xE6B2021EA4C546,0xC49E5DFA5E6F94,0xDC2304697E9BE4,0x7EA6A53FD860},{0x14F5B41A153385,0x4B06ACBCF2C92A,0x4217F0012A213B,0x63AC1E147FE4CD,0x189346110B59E0,0x9682DE5512B47A,0xB55E76C25D5B}},
+    {{0xA2894D752FFECE,0x1546213A52BEBD,0x2C0C2C4F67F5E1,0x6EF45EB72FBCC1,0x2696C056BBE478,0xFE15DF9838D26A,0xDC03DCD94807},{0x82829D26999C9F,0x666DD81616051D,0xE3DBBE34B2135B,0x2D9B92DDCB7929,0xFCE392E615FCC6,0xD920E78742406F,0x35753FBFBC79},{0x36EFD25013C0E,0xF846BE4E0ED4D2,0x5B1A89E7BB39EB,0xE172E137D3914F,0x3282A05E923E9F,0xD73F46F41A64A0,0x2C9A78D76BFC}},
+    {{0x2A83D46C499FE4,0xD7315EFD8AD59,0xB04393DFAAF782,0xFCCD130A34A493,0x68C2839A616E5E,0xB870F9F83BB22,0xDE47A22E5E0A},{0x49F371032FE5BD,0xA11750B5E0D41D,0x8B994420CFA8B4,0xFECB0AD9973916,0x4467FC49F80D70,0x823ADD338DC6C0,0x2738FB32B11},{0x46EC1558FCC1F3,0x549F95DBC09DAD,0x52B03AF19E3D55,0xEB3B630D142BA6,0xE5D804C76D1C24,0x94160C8D6C8EEB,0x3871F8A59404}},
+    {{0xA2EB9759E9B09F,0xB9C342FCD18F58,0x99950AC88E2DDF,0x5C475A71FF31D1,0xB0068C9E541A06,0x3ACACBEB9B5A50,0x2AF230CA37C5},{0x12DC48ED6CA61D,0x4268D08AB4929C,0xF102B48513279B,0x888D1F076032,0x7D876921948276,0x1B294857817A60,0xCC0139360E35},{0x1F12ABAAD0139B,0xCD78C07BA4D8E5,0xEC271786CB0ED7,0xC753DD494DE086,0xE5B05E8E200B98,0x2E870043BEBA3C,0xC88727648066}},
+    {{0x9129CB1B317DF3,0x972D16287B58AB,0xF6F03D9570A2EE,0x6C701E33514D83,0x3A6C7E8E9F704D,0x519A1170E3B606,0xFF68D28A682},{0xC7BDF7BF0F321D,0x830C4A312604A5,0x59E686CB2A623,0x7BB998825EAE94,0xF4BC2513C0D049,0x8CDC67E158718A,0x3A77E75AC85},{0xF24082DEA8B26D,0xBF577222894CA,0xCB91FB15757CC2,0x4457570D26E736,0xD87BE403703276,0x7840DD744AC3DC,0xF3E83BD6A054}},
+    {{0x65D32559549B4B,0x2BBDBE2A8C4668,0x8A5CA0E3EBC90B,0x131263A0C7783D,0xDDA6196A9F0602,0x3742E58D15E194,0x78D62A12E858},{0x2EC473AD4EE529,0x86F5F6DB2738D3,0x40E294631ED4B2,0x186088536014D7,0xC538D6D32CF642,0x984EB10D7F77C,0xAA26248DA2F3},{0xE04CDD36EDC91A,0x7E1FD11A174224,0xAFED155E27668C,0xE9D7ADCDDC4619,0x9B2C02513D7495,0x7B9FFF8A97DA07,0x78AC9F13293F}},
+    {{0xCC33EBF42C8C1F,0xD90ACB5D30D952,0x1D07645CD6340E,0xA7F93D8E78D48F,0x5F371CCBE3C0BB,0x46F8C376D05745,0xA3707A8F5E04},{0x1D60A144B46C87,0x8B1F9E8FAC69DD,0x33BCB5B9B2226E,0xF2576035BC0C47,0x45E607E198E8D1,0x862A475A4676C7,0x6E6459E7CE68},{0xEDFAFB78771C2C,0xA7880A9179B69D,0x4D2DEF5D2B1AC7,0x8DA2D4AC8FC8A7,0x634D4214B2DF15,0x2D6668F6D62C60,0xE03BA5E53289}},
+    {{0xCD44BB28231B8D,0x489F8178DC1352,0x472176F953EF61,0xB582CD0CB7AAD5,0x51FEE48C27BED9,0xC10616FFD014,0xB28D48035EBD},{0xBF0BEA65C12CD6,0xFBBFB2CB36C6DE,0xF42E4620CB236C,0xD4B04D566EC4B4,0x51552A4F53CAC,0x18A29992FD584,0x6E8F4A662D9E},{0x3B758BDB7C9924,0x7CFDE017DE5BCC,0x62B25638AF4EC5,0x6220EE0D8E0A6D,0x2709598E522D9B,0x84C02EEF91D56C,0xAFB420CFF56A}},
+    {{0x637AC27FB348A7,0xBBF04B6F003EF7,0xE9CED568B79716,0x20DB53FECFF9A9,0xD41A261D946651,0x33E925090AAB04,0x34FA20A3E00E},{0xDE873AB540590E,0x3D9EC3390B5BDB,0x6C925CF2E89A89,0x7B844312B0BCC8,0x740B32DE45BBD6,0x5EA82B5A071759,0x1928E084C49D},{0x126E3D905BCEDA,0x347C1E156DACE7,0x127C9744143437,0x55C0FCED829D29,0xC95B75172FC6D5,0x624A8CA61F1E9C,0x24A43450F266}},
+    {{0x715A9C3309CD89,0xF6ED0BA51BC7F6,0xD6397F08ABA927,0x3BF46E85292249,0x3C04DCFAEBBBC3,0x2F1387B519F83F,0x502078F61115},{0x9D504DDAC84892,0x8A372D09BC3503,0x5B1FBB0B64CB6B,0xC691B98A45E765,0xBE4CE256C91C79,0x7283E422E52055,0xD651A099E3B1},{0xE7428AA9F9FDF2,0xB6F0EE341F7C0B,0xD52E36B5E9A50C,0x8F378F0A1C16DA,0xF383AA6DE45F53,0x28E1D510EE6766,0xFC10B10AE08B}},
+    {{0x51FC81A02BE225,0xD16932D8EF15EB,0xC7E219F8D9E394,0x5EF057F9495EF1,0x5947A2951E27FE,0xDB6DECD7165FB9,0xF7576C2F8CA9},{0x3CB280299DAB52,0x5467B53885EB8A,0x61E379FE8CC224,0xF85E3C4BCB33CB,0xAEE0CDC3547104,0xA8E80B3191E744,0xB969808A1A7},{0x5B9A2A42165DAF,0xDEB1F056ED4333,0x7D6BE89756A5AF,0x6872949D86FC7F,0x4934F4B7634C16,0x5B65E4D0BE1F4D,0x9541A39A6809}},
+    {{0x7F6CD1613E30FD,0x81E34A1513D9C6,0xE0441E4D806870,0x79C7E1BA440F71,0xD1AA0D6272125A,0x24AEEF1E48E775,0xB5CB8342104D},{0x4D3435C95357FD,0xC4E37A82399170,0x70980DDEB46434,0x7BFAED31DBBD9C,0xF132BFE578E4CB,0xCF27CF317ADE5E,0x21FA8A415187},{0x33A9972270D727,0x29DCD0637F2914,0xDA9BD8B554725,0x1A8EA15F8A82DB,0x38CBC76A21E935,0x47F3FB94000767,0xC2D4EDE82E2C}},
+    {{0x85B294D71385F5,0x2AE0DD4691B925,0xC966A3BEE39F9B,0x960C7B982A25AA,0x191C855A08FAA8,0x345D3F4F063BE2,0x8E44AEEA620D},{0x6ECB421A0ED48,0x8B1A3FE6E9A075,0x23DB0E6F39EBB6,0x1172637797044A,0xD207DEBEE45356,0x2DFC3D0BB0E094,0x4C1DC9103644},{0xC8BD92976AB809,0x5883B14275B5C1,0xBF44935FC66146,0xE8CA754BEF6ECB,0x1CF089330864F9,0xD017B5D6469D32,0xA8684A6D8AE5}},
+    {{0xDF186DCF8AB757,0x3689E26EE4B161,0x7A6044538B0B32,0xC7AC6ABD205D99,0x3CB6863E0BF2E0,0x31F553AE86A189,0xD3A0D9F6D3BC},{0xA68B751D86BA83,0x405AC54AC3236,0x50D71661890872,0x9CB7DEF45FB5C9,0xB1F8931A67428C,0xC41028AC8AA9D4,0x635B83A37898},{0x80AF2FC16C4B,0x35D1A444C4C3E8,0x2AE381D9C6B08E,0x1F1996406F9853,0xA86A22E99781A8,0xE0EA765F918D83,0xFC5B2B93090F}}
+};
+/* End of comb table */
 #endif
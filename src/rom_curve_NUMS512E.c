@@ -37,6 +37,139 @@ const BIG_512_29 CURVE_B_NUMS512E= {0x1FFECBEF,0x1FFFFFFF,0x1FFFFFFF,0x1FFFFFFF,
 const BIG_512_29 CURVE_Order_NUMS512E= {0x1BEED46D,0x1A3467A8,0x1BFB3FD9,0xC0AF0DB,0x86F52A4,0xC64B85B,0x6EA78FF,0xDA5F9F2,0x1FB4F063,0x1FFFFFFF,0x1FFFFFFF,0x1FFFFFFF,0x1FFFFFFF,0x1FFFFFFF,0x1FFFFFFF,0x1FFFFFFF,0x1FFFFFFF,0x1FFFF};
 const BIG_512_29 CURVE_Gx_NUMS512E= {0x19EC57FE,0xDCD594C,0x113C0571,0xA4A84F9,0x104AD0FE,0x4C92B44,0xC3DE2F7,0x9DDC8CE,0x74621C1,0x1139DC0A,0x9E85FAF,0x1B894704,0x1D1E79F4,0x9E29997,0x32DE223,0x16D38F43,0x116D128D,0x6FC71};
 const BIG_512_29 CURVE_Gy_NUMS512E= {0x1E2F5E1,0x136EF606,0x1C7407CC,0xDA71537,0xC1FD026,0x3431576,0x15898068,0x1E5D32C6,0x120CA53,0xC84F41A,0xA4ADAE5,0x104B3A45,0x76F726D,0x1512B772,0x3D5DEA0,0x194E3316,0x1FF39D49,0x3684D};
+/* Fixed base comb table for ECP_genmul - generated by scripts/combtable.py */
+const BIG_512_29 CURVE_Comb_NUMS512E[128][3]=
+{
+    {{0x19EC57FE,0xDCD594C,0x113C0571,0xA4A84F9,0x104AD0FE,0x4C92B44,0xC3DE2F7,0x9DDC8CE,0x74621C1,0x1139DC0A,0x9E85FAF,0x1B894704,0x1D1E79F4,0x9E29997,0x32DE223,0x16D38F43,0x116D128D,0x6FC71},{0x1E2F5E1,0x136EF606,0x1C7407CC,0xDA71537,0xC1FD026,0x3431576,0x15898068,0x1E5D32C6,0x120CA53,0xC84F41A,0xA4ADAE5,0x104B3A45,0x76F726D,0x1512B772,0x3D5DEA0,0x194E3316,0x1FF39D49,0x3684D},{0x848E2BD,0x1694CE1C,0x30AD126,0x908A927,0x45725CE,0xDD10F1E,0xA8A39F6,0x403CADA,0xC4D8E35,0x22A9A31,0x13407BA7,0xFD7BD73,0x17307BB5,0x1BFF97A9,0xADEDF55,0xFE4A2DE,0x15912B3F,0x6A158}},
+    {{0x66BFE7E,0x6F007DD,0x5E5AF17,0x15105C06,0x18D3A058,0x2F06728,0x123FC28F,0xE5457C,0x1E0945AF,0x1ABC34B0,0x193F4F00,0x45940A8,0xF3A1443,0x1475B8BC,0x1071434A,0x53DD819,0x8075ED8,0xC494},{0x2C1159,0x9E85D6F,0xCD00398,0x1DC8E8FE,0x24D97B2,0xB3200F4,0x811A6F9,0x18F8A8CC,0x73D0C2B,0x12592A3A,0xBF1C367,0x114FD320,0x171923A1,0x15C76B73,0x249A7E9,0x128F53DF,0xAA150E6,0x6C2C1},{0x8638F59,0x705FFEF,0xE2244FE,0x281129C,0x1B7C9F6F,0x13465E5F,0x5CC783E,0x1F6FF2F,0xFF5BDAC,0x1C5D172,0x1C02FBB3,0xEB276C0,0xF94F7AF,0x1A61821F,0xE75DAF3,0x16301498,0x506757C,0x56858}},
+    {{0x19CCD09B,0x1D1DA64B,0x66FD4FE,0x8C1A139,0x11FD2D4D,0x1B44A90B,0x45D481D,0xD6C6952,0x96D4539,0x12E03194,0x36C5EBF,0xE3BE193,0x10CE5DD2,0x95D5255,0x6191740,0x103F69D6,0x1451FB90,0x3C33E},{0x13C27BBD,0x1407552,0xBF0A8B2,0x18093169,0x8CEC8AF,0x118039BF,0x6177018,0x11CD91B2,0x19248E4C,0x197E055E,0x1D2D708,0xF3123C0,0x127086E5,0x1AD923A6,0x9F54D36,0x1D410390,0x1A5685FD,0x7C0AF},{0x17FFA314,0x3D2534B,0xBC3EAC9,0x1559EEA1,0xE697F00,0x100A83CE,0x87553F8,0xD074642,0xFD83313,0x1377A877,0x92AC4C0,0x125DF480,0x12E3DEFA,0x9F9E21C,0x3BC1E19,0x180FFBB3,0x11814B65,0x7827E}},
+    {{0x1BAEE5BC,0x6D9A167,0xF4656BE,0x7AF0468,0x1C9F5A0D,0x1E9AF53A,0x43EEFB2,0x1A8266CF,0x1200A7AF,0x1EFB2EE9,0xDE6683F,0x155E2C8,0x18F6C58B,0x13D79C9C,0x1E0A4AC2,0xE33509E,0x14B2319A,0x67F39},{0x1D3A5872,0x18DF5113,0x125237E4,0x18C2B3B4,0x1EAA2E8B,0xB645AA5,0x1CF5B270,0x1D9DC3EA,0xCAD748C,0x7678F83,0x644A7DA,0x1D862BEC,0x368CA,0x3C3B6B8,0x3D932BD,0x5948B09,0x1E72D492,0x25FE9},{0xD8ECCD8,0x4698D8C,0xBCB03C6,0x1086289F,0x6EAC393,0xDCB00D,0x115C0CB5,0xD64BF2D,0x9B2CC56,0x8809202,0x145D595,0x1FD9E29D,0xD611E9,0x178B4318,0x111428C1,0x11FA54A2,0x1DEDD3FF,0x654E}},
+    {{0xEB7B16D,0x1DB995BD,0xB4F9AD0,0xBE7D0A4,0x18350653,0x1AFD39C3,0x13A16086,0x9DFF202,0xA0748E2,0x6C64BCC,0x2694188,0x50F9EC1,0x4787257,0x1A129DE8,0x12A1CBD,0x1E340DBF,0xB7E2433,0x6494},{0x1664C5B1,0x27B6F38,0xA3795D5,0x1051D19F,0x1E8DEDE2,0x1E603AA4,0xEA0D715,0xC9C1FE8,0xFAA9BCB,0x6976BAD,0xE5FCA7D,0x78A0A90,0xFF9B832,0x867DBE4,0x153C1106,0x8C2F9A2,0x1CBFB5AA,0x4DFED},{0x152B5CBC,0x14344FF0,0x1CB07557,0x1830C78D,0x19A00627,0x18F601A4,0x16081EA5,0xDF0923F,0x1FD3E6C8,0xCAD7B5B,0xCDE078F,0x1ACF0502,0x1BB5342,0x1E5A456B,0xBAE6A18,0x3AFB74D,0xEF21304,0x49B14}},
+    {{0x1B8E2D4C,0x11C7780A,0x765CE07,0x1CBDC395,0x3801038,0x2D791FA,0x159AD639,0xCF8DBF9,0x18303176,0x17E41E7E,0x168E74A,0x12837BAE,0x1EB62665,0x12375CFA,0xEBC1D72,0x1F2E2D52,0x9F7A9E6,0x1E9A7},{0x14BD9323,0xC9A6D9E,0x1CC20142,0x3035922,0x1FDA0FD2,0x11B58FB7,0xD092B32,0x113D32F1,0x1FA3D0E7,0xE9D5EE1,0x9E89BDA,0x5AA9FC0,0x94949C,0x117A71B8,0xC4557DF,0x52F4738,0x18BA4E9E,0xBD32},{0x11BA2E78,0xB7DDE49,0xA244A80,0x4D80067,0x9CC9640,0xECCEF74,0xBDB0C6C,0xA7F9003,0x8DAF16E,0x1048A2C9,0x42EFA9B,0xF780DB6,0x47CF0A7,0x11576CAC,0x15F854EE,0x99E659D,0x12695DCF,0x76E3A}},
+    {{0x1D063C72,0x1BA967BE,0x11E4561E,0x8FA1E66,0x14EFA512,0xC4B6DC0,0x3D2510F,0x17E8A853,0x6805489,0x7D407D6,0x17E6FB18,0x5456EF5,0xE702CA4,0x17A99A0F,0x2DDA2BD,0xAF5102C,0x11B38A05,0x58C06},{0x1CF629C1,0x3DEBC4C,0x1E03C5D6,0x1360BD68,0x1E18DE3A,0x1FFCEC42,0xAF0DFC,0x2931043,0x16C8A46,0xCC9E1CB,0x1E9B82FC,0xE160262,0xE9AD237,0x94688A3,0xAB3283F,0x86A4C21,0xB340B2A,0x1092A},{0xDB0CD51,0xFC99426,0x81DA917,0x1BE233C6,0x1C512284,0x1B72E15D,0xC373D70,0x39C70C9,0x1CE094AF,0x531677E,0xE82F74A,0x1447E827,0x16F4D5D8,0x12BD41D8,0x16128FB7,0x6C0138F,0x7DFB6AA,0x27136}},
+    {{0x11A18F67,0x13D2ED30,0x1C0EB30A,0x15EB2F9F,0x18220B8,0x12BE9ABC,0x7E14DCB,0x1CC678EF,0x1587701D,0x6509582,0x13FA114F,0x144F57E1,0x8857333,0x740A692,0x108E035E,0x1EFBD1EE,0x1E7EA7FF,0x1B5FD},{0xC2A961B,0xC51815E,0xA507FFF,0x9BE1B58,0x9EA2DD9,0x1C778E5E,0x8430EAE,0x15D1AD8E,0x1FA7D0A1,0x13846931,0x240F1,0x1814E1A3,0x1A5B4585,0x3A4084F,0x116FC861,0xB312C7D,0x1213978D,0x628B8},{0xAC51D92,0xD4B6BB8,0xE30BA29,0x185BBE6C,0x18C7458B,0x4A2270D,0x11B50C87,0x11AB20DE,0xED3D0DE,0xD7A7592,0x1A2FA7B8,0xDA6FAE0,0x1280583B,0x90E9778,0x12BC6AA5,0x196BD1F1,0x124071A0,0x704FA}},
+    {{0x1C98C369,0x139BA633,0x445D911,0x16672796,0x1947EDFC,0x15F6AB9F,0xA54EEAA,0x66FF084,0x1AE30ED0,0x9835E73,0x1803E2DF,0x960C86E,0x1C5FEC3,0x1CB957F8,0x1EB0927,0x5E6AB32,0x103A496E,0x3CFBF},{0x381A1BE,0x109D92A4,0x1C637389,0x12CA84AE,0x111832C7,0x2001014,0x125655A7,0xF69A7AD,0x1A2401D5,0x5F60025,0x122DB7BB,0x12AAFF20,0xF402E5,0x1BACD83A,0xF41D72C,0x13BAAFC3,0x1B529EEA,0x6984D},{0x1AFA26B5,0xA2053DB,0x1BC92D09,0x6D46CB,0x1269DDB6,0x1CAC534A,0x17A5AAF6,0x178A06A5,0x40E1BD7,0xA3FCC13,0x24B7600,0x11331E60,0xD769621,0x1D9519D3,0x780D785,0x12CE8270,0x14DE7945,0x7562F}},
+    {{0x1EC8A601,0x85DB92C,0x1CE3594,0x1380E84A,0x13009205,0x1A0E6573,0xAEEA13F,0x139663D5,0x62BD86,0xC75B41D,0xCDB5A57,0xC27225A,0x1A76944F,0x882AB96,0x105C8145,0x1C4F08BB,0x1FEFB054,0x3ED11},{0xE027E37,0x1C2C0CF5,0x23992B0,0x3F0641E,0x136A6D47,0x199BD5A1,0xCC0394C,0x10F9FFC2,0x15D2A241,0x1C543788,0x1E988312,0xB44736A,0x1FFA6003,0x8E7CAED,0x630D733,0x32F453A,0x62EC9DB,0x39C4C},{0x1179D1F6,0xA4638F0,0xE9634B6,0x135D51D5,0x144E1B4E,0xC28FFAC,0x1A3FF97B,0x1FA985B2,0x747CB55,0xCC7A343,0x9FFD0FE,0x1E9B72D4,0x9A9EF8,0x1CE093FF,0xDD09186,0x183CA57F,0x3F17009,0xCA9E}},
+    {{0xADF18BE,0x1B8135F0,0x11CDE6CD,0x1BC2815C,0x18682C1E,0x958B78D,0x1D0B563A,0xF2DB4B4,0x109A9E71,0x11BDB2C,0x5910B1D,0x14FE5DA7,0x18874D9C,0x1877D398,0x1B59C009,0x15393C57,0xC3C3138,0x6FBD8},{0x1CAA7F32,0xD028645,0xAA60551,0xC61F5A0,0x11D6FF08,0xB3D1CA0,0x1B935CE3,0x1CD196D5,0x151BB513,0x1733120D,0x73294BD,0x90A0D2E,0xD9E95C0,0xEF9792C,0x1BC9D77A,0x4567BD4,0x4D6793F,0x568AE},{0x1345F4B3,0x568AF99,0x601888A,0x18F528C5,0x1162ECDF,0x8C9DC5F,0x1B5C0B2E,0x7DF5488,0x1BF12E4D,0xB51F383,0x1729B9EB,0x37F2346,0x15BC3E7D,0xBBA78E,0x1E977582,0xB67458D,0x7F1A2C6,0xA858}},
+    {{0x8FB6AA,0x17517D6D,0x17907C2A,0x6C78CEF,0x5723124,0x1739EA14,0x9B4EEAC,0x1BAB1D3D,0x5A432D,0x1062AA1,0x1C981967,0x4FB3B1D,0xDF4327A,0x66EDECA,0x8E71356,0x3D41D36,0x161F356C,0x22B54},{0x107DCBFD,0xEB4D02,0x82D5351,0x185065E0,0x1592C150,0xC96C95B,0x8C564F1,0x1CE2073F,0x20AC52F,0xB385035,0xB2F0303,0xF4CA8C8,0xDBD4AD6,0x70D6B84,0x1E65ABB9,0xF442A72,0x50AF303,0x722FB},{0xF5F4D71,0x195941DD,0x1D406511,0x46F1C3A,0xF7A34CD,0xE732940,0xC0BD466,0x17736111,0x1B2DB548,0x139B1E4C,0x1B913604,0x18D803CB,0x75A5E38,0x19D5A30C,0x116AC80D,0x180062C,0x1B9FEDE9,0xC6B3}},
+    {{0xEAB0B97,0x13BD3AFA,0xF11583,0x18F65265,0x191CC438,0x1DF21E31,0x82049B9,0x1B8B3309,0x668BAF9,0x94C28DF,0x10FE2AE5,0x12610885,0xCD89395,0x2117953,0x5C6AB4C,0x64C524C,0xD6304FE,0x79317},{0xCB3FF13,0x1B3E2319,0xBC334A6,0xB5E47F8,0x673E4C5,0x14EFBA69,0x97381D2,0xD3948DD,0x3FDCE67,0x107308BA,0x11EBC47,0x1F1F8703,0x1424B9C7,0x1C02C6D0,0x122FAB6C,0x198EFB58,0xBEDC519,0xD9AD},{0x70F074C,0x199BBB33,0xAE9F4B9,0x1655198C,0x15D02738,0x1CFC7EF3,0x1B877189,0x1469690,0x10BF1099,0x147E15C7,0x1A1A049C,0x10625C66,0x7504E2C,0x1B196ADC,0x12D36604,0xBF57CE1,0xC9D156,0x6DA75}},
+    {{0x15695D84,0x1785C7E7,0x6D4A3FC,0x13C0190,0xB717981,0x1F503456,0xDEB41C3,0x1291F929,0x13036BB1,0x8F6B21E,0x507633D,0x56A7F00,0x1386C1DD,0xA385642,0x123E0F89,0x11240181,0xEB266A9,0x366D0},{0x741A7CA,0x18B6711F,0x1CAE12D8,0x1409AA1E,0x12C07B73,0x2AAECA,0x239DA4,0x1285A8A0,0xEE949D9,0xFB648BD,0x11AC70D,0x16D92C1F,0x19C441B2,0x1308C49D,0x18585668,0xE336669,0x16E38AF0,0x14E0},{0x9CF912A,0x1872299E,0x1C5B6BF9,0x1E1C6719,0xAE3280,0xC3572B3,0x120699B7,0x1209330A,0x199A8A36,0x883F57E,0x19EDC8D2,0x18A1328D,0x1353BBBC,0x1190E79D,0x1443D3E3,0x19ACC3B8,0x1765EB2,0x1FA62}},
+    {{0x9FE4D81,0xB7B8DD9,0x1CCD2ED6,0x8E5269D,0xCD01A03,0x1F049A1E,0x1B59873A,0x19037FE8,0x1CA79CC6,0x18DC47B1,0x4C84101,0xE349B2A,0xEE8D9DB,0x162C3FA7,0x17872BB6,0xD5CF4D1,0x1E836A61,0x8EA4},{0x1F51B16C,0x93E4655,0x14B29452,0x115F57,0x4434D77,0xE8442A0,0x3E8468F,0x1C3EEE5D,0x1EB8F0AC,0x14BBED86,0x1B6A9E9B,0x14D22FDF,0x13EFA0FB,0x121F0B32,0x8FEF2AC,0x1E0403D3,0x514ECCE,0x45626},{0x1F07D62,0xAB33A0,0x8F2099A,0x699E965,0xE317BEE,0xA37AC3A,0x1F8CC43B,0xBD40D87,0xD002AF7,0x2DF7755,0x2B19BA6,0xC45A8EF,0x15427F8C,0x13469E0,0x155403DA,0x42885C1,0x10BE048,0x519C7}},
+    {{0x1C586B61,0xA55C1DC,0x15405A3,0x12F82998,0x18AECC16,0x1FBFCC57,0x136323F7,0x1AFA7032,0x1EAC1185,0xCE4BD6F,0x1D1B7399,0x11A29650,0x2F25CC,0x4C768A9,0xA7FE6F1,0x170C5985,0x15929A87,0x4D878},{0x9B23B89,0xB87AAEC,0x143F39E0,0xEF0DFCB,0x1DAB3411,0x1EFE920F,0x2D95E8C,0xDDB807E,0x1DDE6F21,0x1C2CA699,0x13A7FE98,0x87C1C97,0x148B6DDB,0xA2E3EBD,0x10A037BF,0x14A637F3,0xC6F6CCF,0x70DEC},{0x1A92D70,0x1B0E44F0,0xBDE45ED,0x15B43B6E,0x1ED3364A,0x1A24E6D8,0x1278E39C,0x18DF2094,0xC11B4A6,0x1339F465,0x1EA06E47,0x482A746,0x129101DC,0x15B43596,0x12E915A2,0x75B1F95,0xB98AAFB,0x75E0}},
+    {{0x7F6D474,0x1641D012,0xCAD818B,0x10C12D1C,0x1F8FDEEC,0x607DF3D,0x4CF143A,0x1A8EF35A,0x1ABD9A37,0x1A5D9419,0x13B80399,0x1AE140AE,0x119FE74F,0x1C6CCF15,0xB8EC7,0x51A067E,0x1B916EE8,0x68ABE},{0x18E854D5,0x5601A87,0x13B1C158,0x10366F13,0x1EA341A1,0x3F0ECE0,0xE4B78B2,0xB64C24,0x1B39CC28,0x195DC127,0x1880DCC5,0x1B67B166,0x1F57968F,0x167DB173,0xAE3DB84,0xD436D5C,0x1A24BE4D,0x19E78},{0xA0C47C7,0xC5221BF,0x145067D6,0x4C24B8B,0x365E3C9,0x1B66DAF0,0x114FE769,0x1383CDC,0x2E8C19A,0x15EBCCF9,0x65A8C92,0x123E50DA,0x1124FB49,0xD6E80B4,0x1A9F6559,0x90C9BDE,0x8FD9809,0x4FDAE}},
+    {{0x1D6DBA9C,0x486D0A2,0x14DAF995,0xC1F3F56,0x1694404C,0x19AF84D5,0x1573F3CB,0x5E6D8D6,0x1E22A06A,0x58AC9C4,0x674296A,0x80D3FA4,0x2BFB25,0x18B55D15,0x1A18422,0x1AD097FD,0xDCED13F,0x41803},{0xCF147C6,0x6B42BD2,0x16BCF805,0xE952C13,0x11039546,0xF59DD6F,0x4FA9BD8,0xEE6C9E5,0x1205BCB4,0x186021E9,0x1CC0EE5E,0x262B5D8,0xA5D594A,0x1C7F68DE,0x869DED7,0x1928F15F,0x6070A02,0x33DE1},{0x14A82B13,0x1C6B8B3E,0x169E9F5D,0x1CCC996,0xBD8B11A,0x13D4350F,0x1C4BEDB7,0x8F2939E,0xF87D33F,0x4143388,0x196D7694,0x19D10B22,0x78ED308,0x3F685E3,0xA55A3F7,0x19537C02,0x8C5A60,0x58AC9}},
+    {{0x9DDBD1B,0x18C7CB9F,0xA1F0907,0x100B9D89,0x9D058C4,0x22B6FE3,0xDAF5106,0x759B2D1,0xC65045A,0x18787453,0x1DE63DF5,0x19F83126,0x1DF60644,0x1CEDA5D4,0x80D2465,0xA81291E,0x50516FB,0x51E9F},{0x400A806,0xDAA06D2,0xC3751C,0x1A099832,0xA537805,0x169826B4,0xA16DF3E,0x148A4305,0x2EBD1C9,0x3E0CEC2,0x52EBB9C,0xF247F4B,0xF00C59B,0x13E2CAAD,0x4856830,0x1A1C2878,0x1ACC2203,0x76138},{0x15A62193,0xB525F3,0xBDF70D,0x1197EDF4,0xF3503E6,0x19AAC19D,0x57B2355,0x15C66C31,0x152FD8EB,0xF4BD793,0xFD8BBE8,0x4CA5317,0x10118452,0xCF2B7B7,0xD448329,0xEDD3D38,0x806D705,0x6C8A5}},
+    {{0x1DF02046,0x17DADB3D,0x1F4B940D,0x11B4BF12,0x1647CA00,0x1F64139A,0x1824977E,0x1D4A0CD3,0xEB2D7FA,0x1160EC71,0x1AA56D66,0x1DE406E5,0x1BF869D,0x2DFCF4E,0x1CE8C9E0,0x1DDCC2FA,0x16E324BE,0x52EFA},{0x1667E2DF,0xD936F11,0xD3ED5FA,0x1F7EDEA9,0x52FAD9F,0x5296BBA,0x12129EA5,0x1074CB47,0x18C9F187,0x13D4E3D1,0x71FD831,0x1D75E66,0x1B8EB06A,0x95E3D66,0x10E79D53,0x183357A9,0x8C90F38,0x2DF25},{0x468ED50,0x12CE4831,0x18C0E0A0,0x147DEDB7,0x17A95B94,0x1D0BFF1E,0x11FD7DCE,0x3F29F95,0x12B1D5A5,0x1652ED53,0x17575D72,0xBD531C4,0x1037461D,0x175412EA,0x2577B00,0x1FA316F7,0x1F5781B8,0x7711E}},
+    {{0x14DF7E3F,0x13705140,0x1955E072,0x9B4A74C,0x12D47C70,0x8A275C5,0x1591AB1B,0x11EAAD58,0x564285A,0x17A0BE0,0x107A389C,0x980F3D6,0xF409F78,0x1127882B,0x14ED1B,0xF97DFE2,0xAB0DC8B,0x2ED7A},{0x16522795,0x618D1C6,0xCEBDF1F,0x153554FB,0x147CE09C,0xB6DCB5C,0x13461640,0xC134381,0x1FD1FB50,0xF758A5E,0xB8A829F,0xF1127A2,0x1F4E4E33,0x1FC2DCBC,0x488F75F,0x18C20990,0x12B286B1,0x2609C},{0x12344DAF,0x165A827C,0xDF2FF2E,0x1D9274F5,0x8F13132,0x153942F3,0xF485302,0x11C72167,0x2C11DF9,0x10A06AD6,0x144112CE,0x18329155,0xFED01A6,0x104D138,0xA06CD1A,0x1EBF28E6,0x11E8E65F,0x11659}},
+    {{0x174A0DBC,0x1C436BDA,0x2FB59F6,0x77DDE82,0x157524EC,0x4943E99,0x1E55649F,0x1D720ADA,0x19486549,0x187A979,0xCDE2E0A,0x1505F9D4,0x19FB37BE,0x19F9495A,0x11BD3009,0x1ADBC897,0xB094F0B,0x3B819},{0x147D9CDF,0x19F26A6,0x1B9DBA20,0x976534F,0xDE5E251,0x111BA955,0x879647D,0x8034BDF,0x8DD5A0F,0xB35C7EB,0x1A563214,0x1A209421,0xCA9C22B,0xA919619,0x14C733B9,0x19A50719,0x1593DCF3,0x23C91},{0x1FB676CE,0x16698E91,0x590A16,0xDDC2570,0x1D67173A,0x1E339A1C,0x8214AB8,0x1A3D2E44,0x1F4071EB,0x99BAB40,0x20AC269,0x88A8CA5,0xF6C329F,0x4CCA8A9,0x82168FA,0x12877350,0x85F4344,0x5833}},
+    {{0x1F661125,0xED71167,0xAFE22FD,0x1CD3BC52,0x1D091778,0x26DF8AF,0x1701606A,0x101C052A,0xBA9C69E,0x16432982,0x187F928F,0xF6B6509,0xDB9FEE0,0x7BCC519,0x1BE06C20,0x1C3C67CC,0x988797E,0x11419},{0x17BCF734,0x1C9983CB,0x11B04753,0x1E287C4C,0x363D32E,0x1BC2A570,0xE2A6B15,0x14889040,0x120D4D0A,0xAD4A7D2,0x9775B69,0x1337DA87,0x144E6533,0x18DDB63B,0x1969639B,0x120CA00A,0x1DCA2183,0x66DB3},{0xFBB7707,0x1E6527E4,0x11DFD9B6,0xDBB2E1B,0xEA6CE7F,0x3849642,0x10A3D2E,0x161C7D85,0x497F10C,0x1E8E9DE,0x94025D4,0xC73398F,0x127F0080,0x1557C159,0x14F881A8,0x11A5E6AC,0x116AFF08,0x52AF0}},
+    {{0x31255D0,0x84229F0,0x183764C0,0x11DC8F23,0x1E10AF29,0x1E2170F2,0x1A790EB3,0xD9FDC50,0x1376CFA2,0x11AC01D8,0xD71E6FC,0x1518F22F,0x1EA676FB,0x1A3F444C,0x1923D8B8,0x12466581,0x1B51524,0x154BF},{0x111202F1,0x1E9F5A03,0xCD682B3,0x7252877,0x172E305A,0x1A02DA3D,0x14B38C2F,0x1CF1DBFB,0x7B0EA5B,0x13DAFC83,0x12675E51,0x182B7ECE,0xFBED9E3,0xA91BF4A,0x152B6CA2,0x2024B8,0x8B6DD1F,0x495A},{0x1550283,0x7A884E7,0x6162F1E,0x2F2BD9F,0x9C456FF,0x136C82D3,0x140AEAAE,0xDFA1520,0x292750B,0x184857FE,0xFC0281A,0x256557B,0x4BF6D4F,0x16B616AB,0x1E7A6B60,0x1B3983CA,0x3297DB4,0x65119}},
+    {{0xA53B475,0x1E119525,0x6DBF690,0x11B2A8A5,0x1CA7AA8F,0x9BE6726,0x2F2154E,0x44A70BA,0x9C61AA2,0x1A96A690,0x1609FDA6,0x87AC15B,0x778B9F0,0xDA9EAAF,0x92D83A9,0xBE4DFAB,0x1FC3369F,0x7090B},{0x13855563,0x141EE9DB,0x14404E5D,0x134D23CC,0x11AF9D35,0xF004E61,0x47A3FCA,0xD39CF63,0x10A50357,0xFB44BC1,0x1349A5BD,0x106107E,0xBEEB297,0xE0E1E7B,0x1D96206B,0xC16A1FD,0x1501EE8C,0x38290},{0xE514724,0x19ABF29D,0x565E9DC,0xF51A279,0x9D4F82A,0x1ED9E136,0x1B85825D,0x39A4153,0x14DFA27B,0x12E410AA,0x166B301D,0x1BF672B9,0x13A1BA07,0xD930375,0x6B8F57A,0x1B69053E,0x11E7FC59,0x6AF1C}},
+    {{0x42F2F1C,0x6052D74,0x64C05B3,0x15529AB4,0xAD3F572,0x25D1B5F,0x1D759089,0xA3CB2C3,0x7E4EDBC,0xE2D78B2,0xF16CD88,0x2940B3D,0x3739210,0x55D3147,0xBD34F5E,0x14A3C863,0x181050FC,0x2C499},{0xCCA4EBE,0x6C63BEB,0x1FE7502B,0x50BAB17,0x176BF9AA,0x1DAE634B,0x2DC9475,0x12A11972,0xAE32630,0xE20C6A9,0xF51EB82,0x152E4E09,0x1CFE8790,0xDC9659E,0x971680E,0x21A6D74,0x2F9A9F1,0x64FBE},{0x168A801F,0x16B9D5C4,0xF703947,0x7F55224,0x5F31484,0xE76A77D,0x276F516,0xB4CF48D,0x95EEE3F,0x4012F6F,0x9144E8,0xEAB10B6,0x18C82859,0x1EA68837,0x1C3B1CFF,0x8490AC,0x599E501,0x7BF19}},
+    {{0x148CA362,0x12147895,0xF6BC9B6,0x18E7B456,0x5675EDC,0x1E22BA41,0x1D240BA0,0x1CE02CFC,0x5329781,0xCA7A9F7,0x126ECD2A,0x12408256,0x114D4621,0x32647FA,0x54342FF,0x155EDE98,0x8FE6D8D,0x666D7},{0x179FA761,0x2B0E5CB,0xC7FDAD3,0x18C4EC5A,0x3D38E06,0xC8DE4F6,0x1F491C9F,0x4213E20,0x1BA7EFA1,0x1EF4EB84,0x1202E85E,0xED563C8,0x1C7785B8,0x1495C945,0xA5FAA48,0x146635E1,0x1CB595B5,0x61207},{0x17582B23,0x12B72775,0x124274F,0x1CB9AE89,0xE25B1B0,0xEA98DD9,0x31F15B0,0xA8A9221,0x17A459AD,0x1451C795,0xD726C8F,0x12CE8592,0xA40D811,0x99DCD9D,0xB2A0CFE,0x1860DAB7,0xCB1600A,0x4B641}},
+    {{0xC814AAD,0x1EC57F0,0xE973B54,0x96456C,0x162D209D,0x1247DB45,0x1BC835C3,0x1A742F38,0x3AA384C,0x1D9025C6,0xABA73A5,0xD6DCC85,0x1B14FEBF,0xB6077B7,0xA98808C,0x11246438,0xB7FE27D,0x2B9D4},{0x162A7D22,0xCDC775A,0xC0CF9AA,0x19183B3F,0x1851E1F0,0x128C9C18,0x10003090,0x19468D6A,0xECCFCE,0x18194448,0x1A1538FF,0x17B9FC40,0xD6DF887,0x1EC24859,0x17C8B6B7,0x160F7C97,0xB56A745,0x7C6D1},{0x1889D77A,0xC9E6135,0x1BE102F9,0x4989F2,0x76E78C9,0x189B5AA8,0x43105C3,0x1DEA7CF9,0x1DD56CEC,0x15520944,0x698F02B,0x597B0EB,0x1B1056B,0x53E8518,0x13005DA0,0x51AFEF1,0xC06E353,0x25170}},
+    {{0x1BC818B9,0xBDDE548,0x23DB5BB,0xA0BA87C,0x1C3818FA,0x170C02,0x45A8FD7,0x1063D08A,0x69DBA60,0x12DB3B69,0x17E16CCB,0x15C2D567,0x1B9C7579,0x1C350AE3,0x1B9CE4C,0x38CA7BE,0x170EB756,0x5D379},{0x27A26E8,0x1CC164C,0x1FAEC10A,0x162F551F,0x6653DFA,0x4EAB515,0x1F1C87A7,0x125E30E9,0x1E1EDAF1,0x6CDFE2B,0x1BDF8635,0x4E9389B,0x9596150,0x14BFC35A,0x51C78AB,0x180840D2,0x30918DC,0x3633B},{0x17435434,0x3089E80,0x1367A195,0x1F28BBA7,0xC3059C4,0x186FBB48,0x1123AD52,0x9A30A1C,0x17B66762,0x64952F,0xC2730A3,0x1CD115F3,0x1C555D20,0xD2E0FC0,0xE2CB556,0x1CFE0CE0,0x22AB92A,0x5CE7D}},
+    {{0xFF28684,0x153D3CF5,0x15193221,0xBEED51D,0x114CB6CC,0x18015236,0x1552E3B6,0x1978F3FA,0x1E6B1460,0x1EDE7CC5,0x119BFC94,0x6FE495E,0x12C40D2C,0xF375E3A,0xF8179C0,0x15EE2604,0xB2E1F8C,0x41795},{0xAC0D65F,0xFFFBB91,0x10EA87AD,0x6642275,0x7E12421,0x1F2D2DB1,0xE56D5A1,0x7CA98E7,0x9483D23,0x158F236E,0x84CF1ED,0x1E40258,0xF94703A,0x1627A995,0x1382FD4F,0x190B86D9,0x12DB1A12,0x41116},{0x129DE3F7,0x828CF55,0x1C57310F,0xCFB8C6A,0x14A56F38,0x87ABE35,0x15397807,0xC69E3B4,0x2B05910,0xC4EE01C,0x1DC547A6,0x1384E6DB,0x10E5352A,0x1484C7FB,0xFB9BE45,0x129CBD67,0x11904813,0x53A36}},
+    {{0x1485AC9B,0x13D9D280,0x10E2E70A,0x14038B94,0xF64C61D,0xE91E409,0x1ADFE1DA,0xE98D85D,0x3789DCA,0x17A0946D,0x3493B7D,0x733A481,0x14B07DB1,0x7E2DBA6,0xFAD352,0x1F95CBB5,0x1436346D,0x698A7},{0x2A02833,0x1A55FDDD,0x62AD36C,0x18B5797B,0x1B1031E9,0x17E87597,0x1F1A7790,0x17F452FB,0xE183E71,0x7286E30,0x3D1C545,0x13EAEC65,0x1B0C95D8,0x12882E62,0x10D5A5BB,0xB29791D,0x14A725EA,0x42F3F},{0x1F82586A,0x12125186,0xC946E94,0x10FE0BA,0x1DE59BEA,0x163D4D58,0x4CC2A65,0x15AE3304,0x1487D649,0x19C47899,0x11DC6482,0xCF9C58A,0x189254E,0x49B08A7,0x1CD47770,0xFE5F399,0xB3CA106,0x534E0}},
+    {{0x7CE5DA5,0x3278C8D,0x1E1BE90A,0x150B1941,0xCE20A8B,0x199D7613,0x30677F0,0x10723CC6,0x1C157DAB,0x7F6B01E,0xFDCBBA8,0xAE4D925,0xECBD5EB,0x7435E0B,0x9CDEDDB,0x158218FC,0x11AD5C75,0x5FFEE},{0x151F99C6,0x57EEFB6,0xF659FB4,0xFC812C7,0xB689656,0xF501B18,0x12F6C94D,0x108E3883,0x22FC3C0,0xA2673F3,0x3B537C2,0x1BC8720D,0x1262BE99,0x1DF22B3A,0xDBA5940,0xCDB3F81,0x77A5CB6,0x63F31},{0x1F797218,0x1B3F089A,0x10293561,0x7451EDF,0x58847D1,0x84E18E3,0x3DC7A38,0x1FA0B10F,0x181442D4,0x11FFB95B,0x1CBA3766,0xA8C2795,0x141D4F73,0xEDDBCAC,0xF3B5940,0x16D8097E,0x479A131,0x30604}},
+    {{0x15202305,0x1312D6EB,0x1EA278B0,0x1CA0BC21,0x989DF,0x1F68C746,0xA668EB7,0xD42EBCC,0x1605E041,0x8D1F8FF,0x6604FFF,0x7ACCA29,0x1B93C624,0x25F58D3,0x1F90F560,0xA05F86E,0x1D0B3ACF,0x39649},{0x4A23CC,0xC97FC61,0x1D74EA8E,0xE387B5F,0x1D8EB104,0x6EF2CC2,0x166B73CD,0x323F166,0x8EB7D47,0x1C4858F3,0x190F519D,0x10CEB74C,0x164CB4FC,0x1F2A8676,0x18CCD937,0x1193E13B,0x161E5CC8,0x15570},{0x4EE9BD1,0xCA94DBA,0x1C1D050B,0x19A9EE51,0x73F5C3F,0x18323BEC,0x1AA7D131,0x1C208655,0x1446700D,0x3EB9509,0x1314983C,0xA8EC48D,0x1AF6A1D5,0x185ACBC0,0xC8E59C4,0x1A2FDEB2,0x112BFB1,0x12FAA}},
+    {{0x19AD6EDD,0x60E74F1,0x7248A15,0xA6138DA,0x1B0A04FD,0x1938FA7C,0x4664A9D,0xDFEF84B,0x643B51E,0x19E02E51,0x89CEB7A,0x189FC7E7,0xBA9D18E,0x3C9A54E,0xB7D9741,0x1C708200,0x11E470EC,0xD791},{0x1CA30C93,0x13E35A3A,0x16CC21C5,0x9F84BBC,0x1FD68B99,0x1DBD1DCC,0x4A10485,0x500AA86,0x152001FB,0x15A6AD67,0x17C7682,0xFF5C4FC,0x15A7A0F2,0x1F3023F,0x19DB70D4,0x1A620A00,0xCFB0C46,0xC0BB},{0x15A72FB,0x1920148B,0x755E850,0x113E014D,0x1787D598,0x1C1F477C,0x1D5DD9D0,0x17FDEB4E,0x9631CE2,0x1F896B1F,0x166A80B8,0xBDC9FF1,0x18B3DAD5,0x620AF38,0x18315D9F,0x18F9D675,0x6401A44,0x48DF4}},
+    {{0x1FB52693,0x9EEE306,0x1189F621,0x16EF7541,0x1FC4980E,0x1CC00C8E,0x9EF2E44,0x1CA08529,0x1303337A,0x3C675C8,0x1B2CAF17,0x1E4E750C,0x104ACA75,0x1BBEBDE6,0xB760626,0xA3E436,0x11283CC9,0x283B1},{0x6BB6211,0x98FED41,0x13DF647A,0x11931701,0x190E9B6F,0x4D54343,0x166AD279,0x136A3D5E,0x87424BC,0x14DF8563,0x13F7893D,0x1C8C3AEC,0xA77B6E6,0x1DCA32D0,0x116F47D,0x1ED992D5,0xD134CED,0x2D07D},{0x1E134A45,0x1591BA65,0x19622B4F,0x36571C3,0xD5D1DB6,0x7EADA04,0xC6956D4,0x636A325,0x136451EC,0x8EB3DFC,0x1BA010B7,0xDB50979,0x1323406C,0x5CF22AC,0xF1132C9,0x5F3A050,0xF2F438C,0xA825}},
+    {{0xED09D24,0x3385770,0x11328D03,0x16216E6A,0x1C56193A,0xA737539,0x17D71D43,0xAC57B18,0xFFAA581,0x1A3257EF,0x19003C50,0x9212596,0x3919209,0xDC396B6,0x13BA5CC1,0x149D26B7,0x15045461,0x55E3D},{0x1125295F,0x17A997E7,0x8A2BE5A,0x4FC7E8C,0xD34317E,0x19A15D08,0x8A6C62A,0x1795C12E,0xBD883FA,0x6B0A7F8,0x1F9EFE0C,0x9191035,0x1183022F,0x132A7C05,0x7C309C1,0xB3C823E,0x14A4D8FE,0xDC},{0x1423B43A,0x14710429,0x13F56287,0x5035402,0x1AE706BA,0xCD00765,0x192CA0C3,0xAC30CCC,0xEEA8CE1,0xFEFED70,0x1EFF7E6E,0xFB9073C,0x181E9A43,0x12EA15D6,0x8FD93A9,0x1E112AD4,0x68B5758,0x7E129}},
+    {{0x66A02E1,0x8A9C5E7,0x1DF4D1C,0x89DF16F,0x135D583C,0x16D7EADB,0x10D33C32,0x1551DAE0,0x6372D98,0x1EF7CD4F,0x33BEAFE,0x33976CC,0x7480394,0x148DAA4,0x882F3DA,0x187F1641,0x2D10C76,0x7ECDB},{0x8CD89E3,0xDE6C2C7,0xE6C4798,0xD555F9B,0x1EB8C4B7,0xE5D42DB,0x1AA40BBE,0xF9456F9,0x1661F72,0x7FB3D3,0x1ECAD6BA,0x140556C9,0x1209E258,0x13A77BE3,0x99E6829,0x1E79F45D,0x1AA18E13,0xDC57},{0xDAB0F31,0x9755E31,0xB7C8126,0xAE81E68,0xC4EC376,0x185F22D6,0x1A5A3624,0x90C559A,0x99179B2,0x5AADCE2,0x9877E59,0xCA65CE0,0x14E259EA,0x14C47FB7,0x10C09011,0x8652FE9,0x148FEC8,0x52A67}},
+    {{0x1F72667C,0x18B7D81,0x72273E1,0x17B39157,0xEDCFA3D,0x618A503,0x9088806,0x412A2DA,0xB3EB99B,0x123308DF,0x9CF6AD3,0x194AA23D,0xBCA410,0x8E48A03,0x17FD7D25,0x13135984,0x11CDCA0D,0x5EE54},{0x1950941,0x6AD80E7,0x1E485705,0x19682559,0x1D070FF3,0x2A5FE14,0x3858834,0xDE546AA,0x1F129C4B,0x13B4AC1E,0x4B05B4C,0xC866087,0x193EC74B,0x1D0DC30,0x17B0C2DD,0x1008D2DA,0x11BC89C2,0xD953},{0x77EF2A6,0x1ED286F2,0x7A3B5E3,0x2871C5C,0x1C90986E,0x19380806,0x1C032F26,0x69C309F,0x16B61723,0x146974FB,0xE9996D8,0x1AF3429A,0xD1C3D40,0x5FDC117,0x1E87CBFE,0x18523F7,0x1DA15F5E,0x2E4EA}},
+    {{0x301F48B,0x17C6E8AC,0x2B7CE78,0xDB0F081,0x8B52303,0x8C4F3D8,0x15EB23F5,0x16570A33,0x1A49D8B9,0x10869D98,0xF347C1D,0xCF66E,0x17BB046A,0x173FADCD,0x165E6B37,0x1053E7F7,0x1F880ADF,0x1E9},{0x1B5DFCA2,0x61C86FE,0x3399908,0x438DB44,0xFB82DF0,0x1C364C77,0x919542A,0x61AA44D,0xFBFCA54,0x118213C6,0x1589EBBC,0x1C4F8F87,0xA74CF3,0x148A63C1,0x7B8E0C1,0x1E183C93,0x15B68D8F,0x7D1EE},{0x7099A3D,0x193C04B7,0x1D549DBC,0x4A9A7D2,0x17A27292,0x14A4646C,0x1E60E09A,0xA74F576,0x11D0C035,0x17AF64B4,0x16B803A7,0x12CA6C9C,0x175B9552,0x1F135757,0x1C85D85D,0x1E983693,0x5DB66CE,0x613AE}},
+    {{0x24232A3,0xD119913,0x1BE0D976,0x1D5CE40F,0xDABA728,0x853CCCA,0x671A432,0x166706CB,0xB6233E8,0x27CAF3F,0x188CF74A,0xF6BC5C9,0x82953D3,0x64C124F,0x6A06B9C,0x67BFCB,0xB84C08E,0x65594},{0xF5722DF,0x16BA0A2C,0xAD575B5,0x1AE721B6,0x7381EC3,0x11E3B466,0x1BE362B2,0x1C54CBDE,0x849B2A7,0x7B204DF,0x18B38147,0x15F8B619,0x1DF0A24C,0x1776566B,0xD70C931,0x388437E,0x7EA3063,0xB49A},{0x103CB646,0x1253AB42,0x9D40A54,0x1EAB5B07,0x18E7A16F,0x1695C157,0x1C427561,0xBFC1178,0x6CC1394,0x1501C0A7,0x8045843,0xB6381A0,0x1AF69854,0xEA57D76,0xE261213,0x1A7C0510,0x191790EC,0x50827}},
+    {{0xA971160,0x1D4FBAA0,0x1641F7E6,0x12777886,0xBD52E42,0x1A8D6484,0x160EB9FA,0x1B613E3E,0x120E9FF8,0x146E3141,0x16B31451,0x48B29AE,0x1B1E5689,0x10562226,0x17C15A8,0x6711AA9,0x17AC7355,0x58CB4},{0xFCC1062,0x51451D1,0x1EF719AF,0x8634D78,0xDC2EDEB,0xBFC2781,0x1EDFD84E,0x72A9465,0x1B6F875A,0xD6957C7,0x84B722D,0xB02F3BD,0x165BC969,0xE4784AA,0x8B721FB,0x1619E876,0x178669EC,0x1891D},{0x1C04ACAC,0x942A548,0x169B13EB,0x5EA3D15,0xD5CF828,0x11C897BC,0x9A32234,0x17439571,0x10519468,0x1535A4EE,0x13559638,0xB13C803,0x6FEEC14,0x122AD440,0x1A6B445D,0x265B0A9,0x143A3852,0x51C5A}},
+    {{0x12D180A4,0xB47C129,0x149F0B43,0x457BEAB,0x1B93CEA9,0x114019A9,0x10599174,0xA4990D7,0xDD3428A,0x92B78AE,0xDFA5791,0x11BEB7AD,0x1987FB11,0xDEF42E7,0x8A4A60B,0x310570D,0xB8E720C,0x5FECB},{0x1D396094,0x139AE5C7,0x1C5E7729,0xF2F38B6,0x1A99A2FB,0x31B4BB0,0x1DEA0A14,0x5FC81F,0xC9FC611,0x362FF77,0x185042DF,0xD762AE,0xC0DD312,0x87F1B21,0x17EDEAC0,0x16A407EE,0x117784C7,0x1234},{0x1A7D227F,0x83FBCD7,0x1940FC0C,0x23BA308,0x17763012,0x1E1F2EEA,0x105CE72F,0x12B6D952,0x187338B2,0x1F53AC17,0x11417F3E,0x4828AA5,0x15EECC93,0x3BAEF84,0x1B1847FA,0x16BD568B,0x4CB0A17,0x5778}},
+    {{0x11D8B4A1,0x1504D035,0xBE1DD34,0xBCE8AEC,0xFE904E2,0xD94C141,0x869B904,0x1B832003,0xC9043B2,0x16DBF1F2,0x1BC1DFE9,0x1DAA5C13,0x111B2376,0x1FD7CBE1,0x187EF7A8,0x1862B358,0x117E4416,0xA17B},{0x1FA2772F,0x729ED9D,0xD176FD1,0x749D931,0x108B8185,0x1FBC2EA7,0x1354320B,0xEE91C78,0x187782EF,0x1753E530,0x252C288,0xE68635A,0x44DBB28,0x3460A07,0x17A7BF29,0x539FA61,0x1651F80D,0x37668},{0x1EB788F3,0x824415A,0xE2E70B5,0x61635DC,0x1AC38D48,0x80FFD2D,0xB0F443E,0xB83B6F5,0x1C607332,0x4FCAF33,0x1D4EC95B,0x28A302F,0xA042D39,0xCFF5349,0x3CD5DF9,0x9EF451A,0x4027EEA,0x2DA83}},
+    {{0x19E18E73,0xBD3CABA,0x19C5B5DF,0x1D63AE4F,0x18281FCA,0x3757627,0xBC9752A,0x36855D,0x4209880,0xEE6D18B,0x103AB4B8,0xAB7CCC1,0x14E757DF,0x1630C012,0x1A4D02D3,0x424077E,0x137F2EEA,0x6D5D1},{0x1E375D51,0x1B7AF1AB,0xD03457C,0x616C120,0x1C32274C,0x5A49F4F,0x144508FE,0x1F83B45C,0x8B6DFC6,0x1536C822,0x113EAE34,0x12BC9C4F,0xB826008,0x191C422B,0x1C22259E,0xDF0F168,0xED23126,0x5FFCD},{0x1AEE0EBD,0x61EA841,0x4EB02DD,0xF35FBC0,0x5F262D6,0x1B3B3814,0x361C4C,0x4E97AAA,0x88BA093,0x1A081DFC,0x1EC4680D,0x337AF96,0xEA2BA0B,0x189DF981,0xA6B6817,0x1DF9B6DE,0x1EF910CB,0x9CDC}},
+    {{0x1BD29E1C,0x1684CA39,0x7D8B20B,0x759D90D,0x1C402079,0xCA0FBD4,0x4FD6B7B,0x16E5E10C,0x6513E5E,0xD12178C,0x291D080,0x1BA6D4ED,0xEE948BA,0x4907E2D,0xB63D646,0x3D2B510,0xB60CE9E,0x74521},{0x52A73C1,0x29BDC75,0x42DCE8D,0x1B8ECAC6,0x18134DD9,0xCE037FB,0x833F9F1,0x1E341E04,0x1602B1F6,0x119CD33F,0x4BF7780,0x1FFA8DC5,0x42DDA8,0x206F4E1,0x191C24E2,0x18078DDE,0x46A2EF,0x31C10},{0x5ACA2E5,0x11A038D7,0x4A65092,0xABE8BFF,0x1CB2480C,0x1552D7C6,0x4E8B817,0x33E28BF,0x30F2965,0xADEC41D,0xA02F6BD,0x1C5344AA,0x16A2B665,0x19A7D590,0x75FB72F,0x1C4D296,0x1D7829F,0x25E83}},
+    {{0x1BD774F0,0x9D0B1A6,0x19E6E284,0x1AA72E40,0xD9DE1C8,0x1D3CD901,0xB8AFD1A,0x4301731,0xF211B5A,0xEA90C51,0x17C7C72C,0x1B121B9C,0x1A25E50A,0x7A9D4B2,0x1CA80CE1,0x164D4D21,0x1E073E59,0x59063},{0x14F873C7,0xA8F9D07,0xA6EF526,0xFDABD36,0x1F8D8778,0xD0C3B5A,0xCC4CCAA,0x9A8DBA1,0x65A2EF7,0x1CC8B9C7,0x12A825CF,0xE818DDD,0x1BF8190F,0x8D424B3,0x1D891B6B,0x1AD1D508,0x1896E78B,0x69FD4},{0x157D53B6,0x1CC05A59,0x18678F12,0x82FDACB,0x10813CA2,0xE7EAAD4,0x17F4A77A,0x1483D460,0x1DE09FE1,0x615FA2E,0x3CB5B24,0x1BCE7E27,0x1162290D,0x2AC156F,0xE9635C2,0x7B68595,0xA1C8E65,0x6E850}},
+    {{0x16022093,0x1D2F872A,0xE74A2D4,0x1569AD46,0x1931217F,0xFFF2F39,0x13D8E0E4,0x1E68D2BC,0x1FADE329,0x1E87632B,0x13A7BDA4,0xAE0AB10,0x648B3D7,0x189AA631,0x181FDC04,0x5ADC03F,0x1927B580,0x4432D},{0x135B4639,0x11E31590,0x4726649,0x4EE1998,0xD22A71E,0x133979E,0x7A4CA2B,0x10DBAF57,0x1F05449D,0x369BE50,0xDEFF4C6,0x5411E24,0x1A96C65C,0x146BB3B2,0x53A2863,0x1590B379,0x17E9A694,0x49C29},{0xF855399,0x113820A6,0x1CE19660,0x15E8F51,0x1412BCD7,0x34DD525,0x93F682F,0x1A7BE67B,0x1186C21E,0x10AD1EB0,0x10DC801D,0x60CAB93,0x11A803B4,0x16D0B542,0xBE1B7AB,0x11F75EA,0xD4771C6,0x5CF1F}},
+    {{0xE8F5C5E,0x113802ED,0xEB77382,0x3FEF607,0x17FB544C,0x16DCBFF7,0x305986C,0x1FE478FE,0xAF4B54F,0x1F266682,0xD7B537A,0x10453B06,0x1A59F8A4,0x1C0C6207,0x103284F8,0x5BA8A20,0x1FAFCCB1,0xB490},{0x1F525B46,0x116211BE,0x1482BDB5,0x139C7237,0x1532B78,0xB065267,0x9CB7D50,0x22EFA9F,0x1D266BDE,0xFF990A7,0x180694EF,0x1A567633,0xDBF4C6E,0x99198A2,0x8C396FA,0xFB05B50,0xBF1EEC5,0x46801},{0xFD1F5CC,0x17D59BCA,0xD4C89F0,0x1A51F9CA,0x1614ABD5,0x6A3484,0xF2F5A62,0x4910761,0x12252F4,0x9EF7BAB,0x6475C94,0x1BBFF3BE,0xDF941B8,0x1894A93B,0xFDE80B0,0x3AF8B66,0x7172217,0x495BA}},
+    {{0x1245AD8B,0x1D4A7BE2,0xAB67D8,0x1F0926A8,0x1F8DC731,0x3E8126E,0xBADF21,0xEF76044,0xC3AD873,0x101F71B1,0x4E6B9D3,0xA8B95E4,0x143B6658,0x198E3912,0x13531863,0x18056BA0,0x695DD88,0x41EB7},{0xAA8591B,0x117E0F20,0x181661E0,0x26F5DA9,0x942F966,0x58CF34F,0xC87384A,0x130ED0DA,0xD5849A0,0x1AD52A70,0x132B705D,0x11627DC,0xB414959,0x101F308B,0xD916A6F,0x2FAD8FC,0x1021B379,0x288E8},{0x73F97F1,0x1BF736E6,0x16D89F6D,0x1D51FACF,0x144E79F8,0xD3214EF,0x134EC229,0x18DC9007,0xD596DD7,0x131A8E0F,0x117E3983,0x1A2203CD,0x1DC2B95D,0xCCB7D16,0x1F676D37,0x12646964,0xEE38588,0x522D6}},
+    {{0xD7055B2,0x250C673,0x699FB89,0x19A25E82,0x16CD983B,0x97777EC,0x2D52A98,0x10E31404,0x1C4899CA,0x4DB7708,0x17A06317,0x11186578,0x7D9DFE7,0x2F0F658,0x494D3B6,0xF42976,0x1442EF99,0x3696C},{0x7895EB4,0xC5ECD2E,0x6A4F626,0x7BBBB72,0x77915ED,0xB6F43F,0x14D40570,0xFDDF33,0x1383F79A,0x128F2BF3,0xD535A46,0x3D850F8,0x14201906,0x10C33142,0x901B0A1,0x1A289452,0xFA96996,0x24646},{0x1A5EF044,0xF85CE7C,0x1659D6B4,0x44A1899,0xCCF121F,0xBE11DD5,0xE866028,0x19773556,0x1FCB6C49,0x9BA9B28,0x131067CA,0x964E3CF,0xB1A8BB8,0x1B174C55,0x1B03DEED,0x16E257F6,0xF960B41,0x69B43}},
+    {{0x18A38498,0x6DECDD3,0x7A705A8,0x1B1D1ADA,0x1BE4FC4E,0x739A5BF,0x13A1618E,0x27B6DA6,0xA1298A8,0x1A1A6707,0x1FB3A3FF,0x62C0FDC,0x12499B47,0x80DF4FD,0x475FB01,0x1CFD486,0x10417145,0xDD84},{0x5F36573,0x14FC083F,0x14B5CC41,0x8544DB0,0x1FB9AC44,0x641E175,0x4219B3E,0x876E864,0x124E59DD,0x1BB0A3E0,0x166D4ACB,0x19AA34FE,0xF3AEEC7,0x1012B9,0x1A8D0DD,0x18EB1E56,0x14360E51,0x32C26},{0x62CD035,0x1B8DB1ED,0x19474D3E,0xD7B4BEE,0x1490D018,0xF48FA88,0x75519E0,0x77CB905,0x15122E4B,0x146B755A,0x37289BD,0x1D135317,0xC78BA59,0x202DEAF,0x6D7FA6F,0x18C2CB06,0x11350EAF,0x7A0D}},
+    {{0x1DB1F4F6,0x23333D1,0x1DEDE018,0x17C29ED,0x147AC45D,0x108A9D95,0xD0BE083,0x6FD357B,0x79F6093,0x918E5A0,0xF163D83,0x19369107,0x19F9F16,0x4B2EC03,0x7896A5E,0x183A9735,0x80F2723,0x160D},{0x6CF45B1,0xFAAC2FB,0x19FCE6BB,0xE7933D9,0xB4132A1,0x124F66A1,0x1BB88B1A,0x1F8DDE4E,0x66FE3E0,0xEFF47A5,0xB98AFE4,0xF5DF7CC,0x13F2BAFA,0xB4718F5,0xA306CDB,0x635ABAD,0x19726EF0,0x7D1BD},{0x14BF45EC,0x22D5E25,0x44CD675,0x1EBAD80B,0xD0A114E,0x13B59924,0x13F4B464,0x3AB2419,0x1E516263,0xE1C14B1,0x1D7BA26,0xAA359B6,0x143B24B7,0xA4E839D,0xB03E406,0x1CD42378,0x281C650,0xFB01}},
+    {{0x69A98,0x1ECA28ED,0x155659F3,0x13832632,0x117D376B,0x8EAA768,0x418324,0x8990246,0xF91A65D,0x1754FBEF,0x1FFB526F,0xB905AF,0x1D28A215,0x363F81C,0x19E5AB92,0x1CFFEEC0,0xCCD0C8A,0x317A7},{0x115AB379,0x44B5CF6,0x467A3C,0x1EEFF314,0x149F630C,0x197B0083,0x11BCAD98,0x1F2B5549,0x1DFEEC6,0x14246940,0x16C8380A,0x8C814A,0x143C51D3,0x186E7F50,0x1DCFEB08,0x11DDC6C4,0xE434357,0x277E6},{0x13490AA4,0xAD2D13B,0x5FDD122,0x1360C6F8,0x1138DF65,0x17EA13B7,0xEFBE9BF,0x164EAF26,0xF06B206,0x166983F5,0x12FCC5D6,0x17063899,0xBE6A3B,0xB1B0D9B,0x1BDA3A62,0x1BDA1117,0x108F06B8,0x3337F}},
+    {{0x1674D66B,0x1160630D,0x1EE0D4DC,0xB8CA59F,0xF30DB11,0xF927653,0x4459157,0x1B0C0884,0x32CBCCB,0x2E4EE1E,0x11FBEC99,0x1970C8FA,0x1B7CECA,0x1DB28415,0x6F7ACB2,0x282F463,0x3CA70A7,0x50027},{0x1DC21C19,0x111ED85F,0x1E16DFE2,0x90C3FFA,0x16E1E094,0x1E583EAE,0x1AEDC75C,0x3A99406,0x1D458598,0xEC08FC,0x1EC35B1A,0x17E556AD,0x903A0D8,0x457F64A,0x1FEBB74F,0x11375B06,0x1553D491,0x4AA82},{0x7E156C1,0x86AB54A,0x1E6B42DC,0x4696CF2,0x155BB453,0x1D29619B,0xDCDBD8A,0x431CAE1,0x12569799,0x182D8305,0x1F52B55A,0x127BC060,0x1DDB88AB,0x42AF0C0,0x194C6DC9,0x1843F991,0x17B53AF6,0x2ECD6}},
+    {{0x14F9F90,0x774868A,0x1F4C1045,0xD9E8073,0x13D1241F,0x125AFCAB,0x11116337,0x59D91C8,0x1E7F71D7,0x4BF3F83,0x197BD32C,0x1CB0877,0x77E2C64,0x1FD87048,0x9E92E9D,0x875F34B,0x199434CE,0x5FC80},{0x2597B9A,0x6FD36C1,0x41074AF,0x13A85158,0xFAB69AF,0x13FBAF60,0x15E34F55,0x64F63F0,0x77937DD,0x446E7FB,0x8A1EE2B,0x1E34E8EB,0x1EF74FF8,0x1E27C1C9,0x2DDA32C,0x1F20C034,0x1F38EF58,0x58D83},{0x7CAE6F,0x14EFC8E9,0x9853A1E,0xC529260,0x1D72C6DA,0x1A504E40,0x86ED66,0xB6429E0,0xEDDE60C,0x190398CC,0x172A6B40,0x1C16B800,0x8AF37D7,0x15894B99,0xDE08713,0x15C8C850,0x1366995D,0x57792}},
+    {{0x13DAC543,0x114FAE5E,0xE7E535F,0x52D8802,0x11E7EA3A,0x185FB6E2,0x1B12EFBF,0x182BBFEE,0x5FED868,0xA8F1A5B,0xF3B2419,0x189A5712,0x171AE44C,0x16948F63,0x65F6EC0,0x187A01D6,0xA6A9D7A,0x1243A},{0x1E235C52,0x171A6A9B,0x7854BFC,0x1BE200C0,0x6BF8791,0x454D7C5,0x14F603B,0x1A806FF3,0x4DA4CB3,0x1DEC9184,0x1DA7FFE9,0x130B5F4A,0xD18C5EE,0x1DA3B07C,0x1AA74D3B,0xFCF5CC0,0x2D1A88B,0x45CFC},{0xE72320B,0x5D7D792,0x134E5FC5,0x110BEC69,0x18E65A03,0x1C654B70,0x128770C7,0x12265930,0x3FFB3FF,0x344397,0x5C34551,0x67CED72,0x1AE4F8A3,0x1FEEB446,0x1BF4BA94,0x1944C365,0x13A8A557,0x2820A}},
+    {{0x1F9FCA64,0x1C4C2428,0x10C1D225,0x11297509,0x15E87D48,0x1763F564,0x5883FB2,0xD65A85E,0x12F9C3C8,0x4EDA161,0x14529151,0xF7A36C,0xC7BAF6A,0xFC6F6C0,0x1C7097AC,0x127A15B8,0x187B063B,0x7C537},{0x1579DC43,0xA7D0A56,0x10AC0758,0x8D2DEE,0x239FB63,0xB82644D,0x1D5AD3CC,0x1CC4557D,0x8503AF6,0x641663D,0x1CE84100,0x198D7405,0x14886DA3,0x1838806B,0x41DBEBB,0x4A1CC2,0x1A9D1C31,0x52659},{0x827D6A5,0x9D2C1EF,0x1E926B90,0x165DE6E,0x17FDE0D7,0x1B98BAF7,0x9184054,0x1233A745,0x2F85C58,0xBD17764,0x7D154DD,0x1E874482,0x9DB18E3,0x1A627FF,0x1ADC0639,0x1032A267,0x1649D01A,0x37281}},
+    {{0xFE97F1B,0x83C9F27,0x14D047FB,0x169AC15F,0x1C94468D,0x1929C1D3,0xC0094CF,0x9F4B4,0x1588EEBC,0xE807B06,0xF6A1657,0x2771C53,0x3184B3C,0x25ED640,0x1D2FBDB7,0x44DAC4D,0x13DE5A8E,0x48162},{0x88FEBF7,0x1FD73636,0x11D0E8B0,0x2F1371A,0x1A9B5502,0xD62DCA7,0x8CFC656,0x6242469,0x13D9714B,0x72A3DFC,0xBEC3285,0x141D1B03,0x53C993E,0x4D66138,0x1289250A,0x1BD3C2AC,0x104D2B14,0x37387},{0x199F143C,0x3EBF757,0x9438D16,0xADF1EDA,0x1962522,0x10250128,0x11AAED85,0x18DEBD76,0x1FFCCC0B,0xE2A4A5,0x4E8D07D,0x169A47F,0xE5C0A36,0x6083469,0x8013519,0x186F70E3,0x1F4B277A,0x115AE}},
+    {{0x1118D86D,0x154BB495,0xFF84BA9,0x1636C168,0x9724975,0x1D212A4C,0x1442168E,0x19AAF75,0x1DF58D60,0x1806693F,0x1CCB75AD,0xACC6B0C,0x16686CD,0x1B4810EA,0xD0DEDB7,0x6A89BC1,0x17B0B9CE,0x5AD6E},{0x114D55F7,0xB2F3E39,0x1066B651,0x10C89341,0x176B6C6D,0xDBEA181,0xE5780FD,0x2FB9F7,0x15F33D0A,0xED8E5FA,0x13872081,0x195E2113,0x978F9DC,0x1067F059,0x8FB44F4,0xCAE2C3D,0xCCDAF74,0x106E9},{0x691AEAB,0x1DEE0711,0xFE6B492,0xFE6CE36,0x1CB60BD0,0x22AC3A,0x74E1F65,0x1EC7A4DA,0xBE96EDB,0x1A12D1E7,0x1DA8FFCA,0x963463C,0x1932AF07,0xA45CB68,0x77E4CD3,0xD882650,0x60A843F,0x31016}},
+    {{0x1C8C1C92,0x56A8D97,0x5D4A984,0x19AF81C1,0x13B23068,0x1D048E06,0x15C3E936,0xD444181,0x1700F9DC,0x7ACF828,0x551D457,0x782020D,0x1FA05E9A,0x15CF52E9,0xD02A7DC,0x1BEB1F32,0x1F2B1609,0x6F34},{0x1B8208FE,0xCC7D9B0,0x196E9069,0x1243A0EA,0x5853CA8,0xA11ACB4,0x1598E687,0xACFACBB,0x43A9597,0x12C26707,0x5739505,0x58DBA2D,0x147547AC,0x110B6645,0x12397BB2,0x803E952,0x126C0689,0x27FB9},{0xB609C69,0x14C2C94,0x1D2F678A,0x15F019FB,0x75818FD,0x1D907568,0x8001176,0xDEA7FCA,0x8937BE5,0x169CB111,0x1977EB54,0x1C5EAD38,0x6DE46EF,0xB11423A,0x689BF14,0x15F705BE,0x15D1DACF,0x60CA3}},
+    {{0xC5A2E0E,0xCB51763,0x4BAD607,0x84335B0,0x2A7C90D,0xA3BE61F,0x3CA31E6,0x6009EA9,0x15B3AE10,0x6FA1A65,0x17D81380,0x19800EF7,0x1E027B00,0x95037A3,0x1AAF32F6,0x6733E4B,0x1C9C818A,0x4D06A},{0x6864D04,0xA21C73B,0x527DFB6,0x10C01C1A,0x17E78951,0x5C0A89F,0xF379959,0x17A7AC48,0x1826FDDE,0x1234C707,0x165878D5,0xAC0E3EA,0x1E5CF463,0x16F55835,0x468EE2A,0x18380055,0xE80E361,0x6106D},{0x477E12D,0x17257124,0x1CBDDB4D,0xEFC0119,0x47DB104,0x8D7401A,0x1DBDCDD5,0x1F7B9A7E,0xE004A71,0x1293C82F,0x14CB6585,0xDB6D9B9,0xDD945,0xDADE26B,0xC60D4B8,0x9D388A5,0xCE0681,0x245DA}},
+    {{0x3B2D94E,0x1C0089C0,0x33AFD97,0x1A7CDB4A,0x1275EE39,0x14FFAF3F,0x9F4F06A,0x5BA9D59,0x1C9C0BF2,0xAFBEAFA,0x140A8298,0x1CD2E59B,0x1CAB31BF,0xB306096,0x195A73EF,0x8479C60,0x1795DF1B,0xD599},{0x782169B,0x264A6B9,0xD53F5D8,0xD1D43A1,0x1CAB6723,0x55EB998,0x86030DE,0x6B3BB97,0x1B5B29DD,0x185F30B0,0x270D622,0xE516F6B,0xA817CE3,0x47B51C,0x1D158685,0x1B5729B2,0x1DFA1E39,0x79F66},{0x96557CE,0x14A2CEDA,0x12E8A7FA,0x387098A,0x22DDB60,0xE2BE2AC,0x10A0242D,0x1863188D,0x91C1A30,0x3AF6F41,0x1AC018B7,0x3AF04E3,0xA3D9F58,0x128E2A42,0x1E409C9A,0x97F5BA6,0xE678C2D,0x4FBE6}},
+    {{0x16BE605A,0x9363C8D,0x1D92F485,0x12FDBE94,0x124A65E,0x191B8732,0x1E7115E2,0x10238E4,0x551766C,0x191B0125,0x21A9C0B,0x1E06A578,0x14CFAF73,0xD55153C,0xB1ACA6C,0x1D584893,0x1D0946B1,0x62AC1},{0x1B484C28,0x23D71E9,0x1361F62F,0x1896D05E,0x10C5DAC4,0xFA9B003,0x12D7DDF3,0x1A0A4A19,0x51DF05E,0x154AC05C,0x2C5468C,0xB71C3FF,0x1E092A9F,0xD177D20,0x1C4EFC6C,0xD0264A9,0x1A344EC0,0x357},{0x1D729E50,0x185EF00A,0x1B056ECC,0xD8983F,0xBB1AD48,0x11D4F577,0x1A58598D,0x1657F83D,0x1BE8340B,0xFB70346,0x1C2869E4,0xEBF12A9,0xBBE86F6,0x9CF6066,0x1898D524,0x7036684,0x17C01255,0x1AC46}},
+    {{0x1BABAD7E,0x59FB8E3,0x1B4D8F5E,0x1CD65DBE,0x1933E351,0xAD5395E,0xDB1C4F8,0x4F0F115,0xF769451,0x1B1EEED8,0x1DDBD895,0x15AB1846,0x1BFEF1CC,0x1CFBD5B2,0x136E2A69,0x9F3B243,0x122C5EAC,0x4CB4C},{0x1119613E,0xCBC02FC,0x8CBE015,0x97928CA,0x12B587DC,0x1818B48D,0x1EF9369A,0xC704A8D,0x12189B6,0x1C92FFB5,0x94A9E68,0xB754E05,0x3E2BB55,0xC06D4FB,0xDC7B59A,0x8CF0EBB,0xBFF76A6,0x3F98},{0x174796CC,0x9AB7410,0x1C1EC0A5,0x7139431,0x1A8C2BFC,0x1849CBB0,0x177461FD,0x182333F0,0x1138FDB8,0xED52DC1,0xE8F7674,0x128FC590,0x1A86C02D,0x9E8D2E6,0xFBF33CA,0x1BE37B1E,0x1B8477D0,0x538C2}},
+    {{0x1664E300,0x17653C0D,0x1FF79D92,0x102EF4F,0x1A78AD4E,0xB34638C,0xAEF0429,0x1A6DC124,0x17ED2FD5,0x17AFF31B,0xA47C1A,0x1ADD4341,0x11BAB947,0x1D3F29EF,0xDC45E9D,0x114619DC,0x1B4358F3,0x3CC28},{0x4C5853,0x9B82458,0x149BFC92,0x6D3486E,0x37AAA4F,0x12360735,0x50FA8AF,0xDD98B3D,0x116987BA,0x1C527C67,0x65319E0,0x4684720,0x668AB73,0x64C0F4F,0x19C67F5C,0x116E49BC,0x17AAE39A,0x67852},{0x29A1702,0x868A763,0xB30CAB6,0x682B36B,0x1B099962,0x78894FE,0xD7D90FD,0x1BB961BF,0x7C14D19,0xB01E0D4,0x1E6ABF2A,0x15BD6741,0x86B5C8B,0x1E86A4C4,0x135479E5,0x16870FA6,0x1E476476,0x60526}},
+    {{0x5F11E7,0x6E07C86,0xC8F7FEC,0x14EDE823,0x427B162,0x1FD14849,0x1B3AF63E,0x1EFF121F,0x119A8300,0xB480FD2,0x2F1E1,0x142C53A9,0xAAFCC9,0xB0ED6C9,0x1AF11FD4,0x14D758D,0x1A266AC5,0x201BF},{0x105DD29F,0x1A5CEC55,0xBDBF7CA,0x191B0546,0x1F388CCE,0x2FA4243,0xBB86B6A,0xBADF549,0x5AC9ECE,0x3946B80,0x8BBAD36,0xDFDB6C1,0xA76D8C6,0x1FA2276B,0x19E8C826,0xFB7F771,0xDC526CB,0x6CB32},{0x3C982E8,0x1D83BC46,0x14C020A1,0xB040E74,0x18BF423F,0x1E4737CB,0x16D6A895,0x188887D1,0xCE002C1,0x1A9E6F8F,0x1E89D7B4,0x1774A0C1,0x1C63DF76,0x15E295E2,0x15E78BE2,0x2DB398C,0x8C9A2B9,0xDB60}},
+    {{0x597F25D,0x1AFD49EF,0xD9DBD6A,0x3F5189B,0x1A2B1B44,0x1B8C43DE,0x1EB86B35,0x4204CB3,0x1F6B14E3,0x2D97F46,0x578EE73,0x1CB96BAD,0x10B6D0C9,0x195B520,0x904857A,0x4DDEE4E,0x3ADBB92,0x34C34},{0x1600D6A9,0x19767D4E,0x107AA9CF,0x14910504,0x1A92CBB2,0x180DFCC2,0x174C793F,0xA877671,0x17D22642,0x1B07762,0x281F25E,0x146F1F7D,0x1974B0,0x43068E,0xA950DAF,0x197C874E,0x953AC3E,0x10F7},{0xB59862F,0x15DAB449,0x68F956,0x11E224B2,0x2B50ACE,0xDD11C19,0x1EF86554,0xCA57A8B,0x1F45E7A8,0x18DD1E07,0x1AC2D06A,0x24725E1,0x47E21BA,0x11106777,0x12CF670D,0x761D2CA,0x10C29018,0x6BCEC}},
+    {{0x1EDA6BF6,0x118F4CC3,0x11E617A7,0x14EB424C,0x1443A5A1,0x1E2754BF,0x17DB3615,0x19E8EB01,0xBFA9821,0x147A5773,0x146B4E69,0x4103D4,0xAA8BE3A,0xFD5E285,0x1DB16DB9,0x2610598,0x158D0E6D,0x290ED},{0x8C65CB1,0xE5438A2,0x196A81F5,0x1773373E,0x45789FB,0x119444C4,0x7C76379,0x140F220E,0x4DD5AA3,0x14DD55BF,0x1BCD0EDE,0xF5FBDC8,0x1552CE9A,0x120C4F86,0x1F1B9D9,0x376D31D,0x150C0BFF,0x2BFE6},{0x15355F29,0x119FD62A,0x18350D59,0x3D7EDAD,0xC0FBC64,0xC77C0A8,0x11BF07C5,0x1945E5C9,0x1DC5520C,0x13B186A4,0x1BE40DC8,0xAF1E7C2,0x2118ABF,0x42B8202,0x285DC0F,0x61E5D8D,0xE5C077E,0x215E5}},
+    {{0x16A328B9,0x76E152E,0xC57FFAD,0x29C2B38,0x85C0E62,0x51A59A8,0xBDCF8EA,0x5CEAF39,0xFB65C2A,0xFD24612,0x199633F9,0xAC6B83C,0x4B49977,0xA624D40,0x1EAD06BD,0x38EB78B,0x18E2E3AC,0x7D4AC},{0xB30EE17,0x1639B02D,0x32E47CF,0x13DAC8,0x1C27CD87,0x1EDE5D3F,0x119E24D3,0xE300692,0x407DD4D,0xD8C380E,0x18A6382D,0xA806A0D,0x1ED0F202,0xE811C88,0x14B262E3,0x17F936DF,0x19076536,0x7DFEB},{0x119E239F,0xDEB563E,0xD8FD15B,0x948A388,0x1D0030E8,0x5CABC65,0x1D66C0E1,0x1015F8DB,0x173322BD,0xA98CB0D,0x9E8DAF5,0xBBE0C8A,0x1BD2F30,0xF2C519E,0xA850425,0x1C7B99C1,0x10DA8AB4,0x2C5BE}},
+    {{0x1DDC7B3B,0x13EC169,0x12BBD4E8,0x5A7A11B,0x1C775C4A,0x4A3C626,0xC518482,0xCE7E5F,0x1997D933,0x199457CE,0x1C662FC0,0x14C907CD,0x1C46BEF3,0xDF732A2,0x112110CB,0x14FF7F94,0x22202F0,0x37110},{0x1CD4B6BC,0x1CEB9CDC,0x1A552EA1,0x130E781E,0x9B683F9,0x43C2C4A,0x1ECD18A0,0x1469C8B8,0x1A110810,0x61D2538,0x1EFFD0B,0x1488C52A,0x38A7B4B,0x127CE1B2,0x11D25F7D,0xA74EAAE,0x18CA946C,0x77E9B},{0x1C824BF,0xBDA5AD3,0x170733BB,0x1711C476,0x162106A2,0x18251FD8,0x1BD73C14,0x158AA837,0x1F0D2A37,0x146F3CFB,0x1CE54A61,0x1D9EC0B5,0x101DBE48,0x17FF7DEB,0x381A2D6,0x2DE14B1,0x186DAF1,0x287}},
+    {{0x101A6002,0x1E525A8B,0x1655DB3,0x1C9BDC46,0x4B034D7,0x19ED41E4,0x52BA055,0x4C07125,0x11A86B38,0x164D4682,0x1D53C85F,0xFBD741C,0x13EC84D4,0x8F36C3,0x1DF85481,0x1A36924E,0x162168F7,0x5A95F},{0x6B0D720,0x11AE2EC6,0xD636A73,0x15B4B7C4,0xA29FAB6,0x1983A297,0x5C5E38F,0x19F8DFF8,0x555BFF0,0x1B0F7471,0x126FE9D0,0x1AB132AA,0x1082A78B,0x131B59C2,0x1703805F,0xF6E1235,0x149BC10E,0x3A506},{0x19A7C92A,0x7B73C9F,0x1A8E1052,0x16F071E8,0x1C7E2090,0x79DF134,0x103237D0,0x1F583A30,0x981006F,0x16DE2987,0xCC004F3,0x19F1674D,0x568C7A4,0x10D4E5BD,0x16244227,0x1757D5A5,0xEFE5411,0x6041A}},
+    {{0x15D03271,0x126CF892,0x12E83ADE,0x3407C21,0x17C1FC3C,0x1DA0681E,0x13D123,0x1720E6E6,0x15685E46,0x2D44F25,0x2140A9F,0x1BADF3F6,0x1E38AF3,0x1629AB32,0x1B6A61FB,0x9028760,0x4F74093,0x4E7EA},{0x7E2C0B9,0xF6AB46D,0x15F4DAF0,0xBC1F9F0,0x1E9D12CE,0x1390383B,0x1E0AF8,0x13A2CD62,0xE44F0F5,0x1E5EF3B2,0xCA7E51C,0x16150D77,0xB2F2D30,0xA0CF3AA,0x56A4008,0x1258EB5,0x188E2F1C,0x14A02},{0x11EDC768,0xB676703,0xD00707B,0x111D7AC1,0xEEC9145,0x5868008,0xB258C4D,0x7B78C8A,0x8DE9739,0x1228523E,0x1EB970A9,0xFCDF03B,0x399CE3B,0x3A086CA,0x1439F4A,0x1EC7BAA9,0x141FE924,0xCEDC}},
+    {{0x1049EF8B,0x188DA1BD,0x102CA20B,0xED971CE,0x1FFEA9D8,0xE94E2F,0x499AFA5,0x1D855CE9,0x17D7DE95,0x1AAF5206,0x9F3C15F,0x1E3091B7,0x774778E,0x1E1B4C4,0xC3EC9F8,0x1F1E14B,0x1B521ABA,0x38BD8},{0xF5DADC4,0x1A3DCE,0x6E626C0,0xE5C31A5,0x10DE714,0x142D038,0xDCF94C9,0x8BFB1A0,0xE351C2A,0xB7EFAC6,0x5C1A24,0xB9DFA8D,0x1405D946,0x90C1418,0x1B18087F,0x30E4E43,0xB66B3F8,0x7101C},{0x1C8A2813,0x1BE2B294,0x11F0A32,0x55ED94D,0x178E239D,0x1985F9B2,0x5F8F3B4,0x17EDA54A,0x18F1F4D0,0x1708AC19,0x13E5BF52,0xCAAB24F,0x113BCF30,0x175FDFF4,0xB36FC44,0xB664554,0x12078D6,0x5B3F}},
+    {{0x179A5090,0x19CA8E10,0xA13A255,0x194D27CF,0x330E6B7,0x6D72944,0x55C8A67,0x4E97D0B,0x10DDB0BA,0xA73990F,0x13091901,0x1B024D81,0x167750F4,0x64A1F02,0xEA5F526,0x1EF42A21,0x994B19D,0x38A50},{0xA6EDF98,0x3540DDF,0x7109498,0x7685FC2,0x1F2B99BC,0x17E1D2FB,0x35607A9,0x7135D9F,0x15D162E0,0xF9CD16A,0x1451BD1E,0x3D66155,0x12539DF3,0xBB2F16A,0x19954F34,0x774890,0x5ED3933,0x40241},{0x9259CBE,0x1A3361E9,0x28E5B5,0x35DCB5E,0x16F3A3F,0x9E6F913,0x1B280886,0x3747C8F,0x1C04E29E,0x1437DE76,0xC81B726,0x1C7684A1,0x3A7DE18,0x641F869,0x84B7AF5,0x1BB04C9E,0x86A1D93,0x2A517}},
+    {{0x8A49510,0x6FA2F37,0xFC305C9,0xAD65DBF,0x131CD568,0x8686EF4,0x1FE5D345,0x3FCC532,0x427A6BA,0x2BB9FFE,0xA22EACA,0x5528D1A,0x12B5097C,0x197F49E5,0x112BDAA6,0xA4977BE,0xE161D9,0x4FFE0},{0x18B4455F,0x14F875B4,0x140299BF,0x14E4E586,0x18BC8FF5,0x1C3D692C,0x5E6626F,0x12B110C2,0x13DDEED8,0x897B87A,0x3D29D44,0xBC042CB,0x64B4A8F,0x18806CE3,0x58ADAB5,0x4903902,0xA7A72C0,0x3960C},{0x11172F80,0x13F139A2,0xBE55BC9,0x1F78CDDA,0x1CA0405B,0xB2F91EB,0x30376C2,0x1CDF00FE,0x34C43F,0x5B8DA3F,0x17AC81C6,0x56A86E4,0x147FE509,0x55C2B9C,0xFB68C3A,0x390D393,0x149A5D30,0x902B}},
+    {{0x158C0E5B,0x118E9B97,0x21BA80E,0x1C600099,0x477FF59,0xE23C930,0x1FFC9C7E,0x1ACAF5F9,0x11851668,0x14E9A6F5,0xDD4CFEF,0x8C26421,0x12C32C3F,0x1CC46A74,0x1B7ED74E,0x10799F6C,0x102E2E8E,0x626BC},{0xD6E5CA1,0x1CB350C2,0x57CB0F2,0xD70F32F,0x1FAB1F3E,0x16D48300,0xBE54EB5,0x1583ED57,0x1DD7ADC,0x1DBE0560,0x166BEAC1,0x189162E6,0x1E4D2CB1,0x5510232,0x5AEA06C,0x1C104695,0xF04F626,0x748CA},{0x678BAD4,0xE68EBB4,0x73E54F8,0x477FDED,0x12689605,0x1571E487,0x1A268E99,0x13A6FB0E,0x73C6D52,0x1C005393,0x1D8F0D37,0x7F918B4,0x10A5E275,0x4EE89E,0x16991715,0xEA13928,0x117CF5C3,0x56061}},
+    {{0x14F9A35F,0x1818BD7E,0x1E294215,0x103A2AD5,0xCF1B973,0x17B2E00B,0x13918FD7,0x8C6ACC1,0xF134B09,0x5ADF2C9,0xCF6F5F0,0xC2219,0x104D7158,0x13CE3BB1,0x9343886,0x1ABEA181,0x1EF1C2C4,0x29077},{0x8704A4C,0xD77ACED,0x19077E35,0x197A85A8,0x352386D,0x1E9CD26F,0x12098537,0xDB77CD6,0xEFA4B9D,0xB901612,0x1CA033F5,0x1503528B,0x11B5D54F,0x493450,0x963B65E,0xF439B5B,0x69C2EA6,0x53348},{0x1DDC599C,0x88BBF6C,0x1AE53E20,0x11E6E952,0x135D4373,0xAFEBA79,0x1CD51D50,0x11AF4690,0x1B9237C6,0x1ED91DB5,0xCFEFDF0,0x1DC98F8C,0x1E9E12AB,0x1809BDC7,0x4F083E7,0x1296AF2,0x11B38740,0x5D1A9}},
+    {{0x1F8B08D5,0x1652506A,0x8D84A0A,0xEDDE01C,0x1229364F,0x150C65F8,0x81E5919,0x8BF2C49,0x165EAF11,0x96036B,0x17F06FA6,0x8BAB642,0x2349592,0x10156995,0x1071AE38,0x6F6FEF1,0x160740EC,0xEA5E},{0xE72121,0x11936176,0x166AFEF6,0x54E664F,0x1D7CC929,0x1367AEF1,0xCF50839,0x10C3A0E4,0xA811943,0x93D6275,0x6532B50,0xFE3C467,0x181EEB1B,0x3C4C02C,0x17D6C4E5,0xC594EA0,0x16D18430,0x7F645},{0xA6DF07C,0x53B3CD9,0x11ED3E8B,0x1B45A4AF,0x15E020D8,0x1753427B,0xECB7AF5,0x2228BCB,0x2A31404,0x1FCF6DE9,0x94239EC,0x1469638A,0x28AC3F,0x7ED70E2,0x93A26C2,0x1C746433,0x652ADB2,0x15A06}},
+    {{0x1BCD48A6,0x17AACAE6,0x1458F156,0x1DECB9DA,0x2DFF010,0x78153F8,0x117FC429,0x1CB65216,0x12AAF7BB,0x1AA2ED9F,0x9F0381F,0x36D0F7C,0xD4E45BC,0xE658AD2,0xD197AF2,0x3609A26,0xA2B2B75,0x674D7},{0x3E56401,0x7070D5C,0x626028,0x18F3B38C,0x1F825028,0x1A6AE573,0x18FAECB6,0x1B37A6C5,0x16D6354A,0x495F18B,0x9E549B2,0x1B221442,0xAD93028,0x1F201C94,0x2FA9D58,0x1BEEA5AB,0xFCBD13C,0x60B71},{0x1C346E8F,0x1004D235,0x126F2B78,0x80AF496,0x4986F9A,0x137A45AA,0x1C31612B,0xE2CC058,0x6506410,0x16656F4A,0xD63363B,0x1BB850CB,0x7E46131,0x456E553,0xA4BED1D,0x11A0D5C5,0x40BB232,0x7F897}},
+    {{0x1ADCF1E4,0x1AB14CA5,0x87A806D,0x102AF5B5,0x56B88A6,0x1B7F0F45,0x1D1F24C3,0x2171B3E,0x63FBCFB,0x19408152,0xE0C3DA3,0x82A963D,0x6C20FA7,0x36EFB87,0x1E311545,0x810563A,0xC5A5511,0x9F6E},{0x6DE4870,0x4EF540C,0x1EE02C,0x1C2C304C,0xE9DC007,0x1E2BC2AD,0xD5F14FC,0x1866CA96,0x1D3EC7EA,0xBC7E2D7,0x106D4BC0,0x7BFA1F1,0x77748AF,0xB273C13,0x1717384,0x973EB75,0x1B7C4FE2,0x14D62},{0xE4F0714,0x17512819,0x1FFAF7B4,0x18F1ADB3,0xAF79224,0x1E8CB378,0xCD92FCD,0xDCE7915,0x11410073,0x11B85BA6,0x1C2141D2,0x3AC3B02,0x12C946CA,0x6F05DA1,0x19C5AFBB,0x137404D5,0xA7BF310,0x38E69}},
+    {{0xEA899CE,0x11BA859F,0x22E72B,0x1AF54194,0x560B01E,0xD1FF663,0x20C3E7B,0x1F21831D,0x51CEC9A,0x2BC03EA,0x49CFF1B,0xB79D094,0x12B9B130,0x11EFA2CC,0x190F6C0F,0x1F6D22A5,0x1E6C3F2C,0x5F552},{0x9AC928B,0x1B6AE68C,0xA837534,0x1CF4DECB,0x1EAF054E,0xAC0CB35,0x1203B4D2,0x17228C,0x1B100F62,0x7758781,0x1C1BD409,0x4BCFE70,0x1C03E025,0x22FC363,0x190CBF73,0x180B7AFF,0x9644D97,0xA316},{0x14B293A4,0x176B670A,0x10248389,0x1969A8F,0xA975CEA,0x14ADBDC3,0x5316BC9,0x1118BEF8,0x1B7F86BD,0xB554F99,0x12313AB1,0x1E241C85,0xB180009,0x253B348,0x14FC5640,0x179C965F,0x626713E,0x77787}},
+    {{0x1494A3F6,0x18FC9681,0xED36B85,0x13A1419A,0xC3860A6,0x148AB64C,0xDD6B263,0x1D2EB6AE,0xAB9165A,0x14450A23,0x6F53B08,0x1DB75038,0x1A64BA11,0x5E1CFA2,0x14262ED9,0x116DDE4F,0x65D2B7A,0x7AB2},{0xCD50009,0x1D6215E7,0x1B8AA588,0xC5798B1,0x426EC15,0x44F5AE1,0x167A6495,0x1869A5C7,0x5B1CEDB,0xA9BF25F,0x12D92EC2,0x1157095E,0x9AAD6CE,0x1BCB2614,0x1D5B1FC2,0x1D8D8BA1,0xBAF11CC,0x568C4},{0xDD3B243,0xD1CB247,0x1924CB85,0x7A2C541,0x19A5075A,0x119333F4,0x1585A755,0x10B02551,0x13212558,0x1AD40426,0x18F799E2,0x1F61926A,0x13D975F3,0x5D8D249,0x56C6BB2,0xC3A2E02,0x1508CA0D,0x63FC0}},
+    {{0xBF47595,0xCC67052,0x452FE42,0x9E4F026,0x108EC099,0x8F6BBB6,0x1ADA94E5,0x197A0E30,0x10098325,0x10278CE,0x12DD8199,0x1A6301E3,0x134509E4,0x1293B5C3,0xF011720,0x10DB4F11,0x596510C,0x3461D},{0x10E1E07A,0x1EA75311,0x19416BFC,0xBAEFFEC,0x128868E5,0xB8EA5B9,0xDC63043,0x6C454AB,0x15B272E4,0x9CFC4A2,0x1EAD5B2B,0x1D89E86B,0xC249655,0xF7BE88E,0x16B5E5CC,0x16D431CF,0x67B1C34,0x76613},{0x16EDC5DE,0xDCB023,0x6573F80,0x4A31A1F,0xF0DC55B,0xC6C00D,0x112AE90C,0x5C55159,0x1197BD7B,0x14B84801,0x14F8FF87,0x161E661E,0x19ACBA3E,0x1ED13166,0x42F32CC,0x1DB40742,0x3BA1D74,0x3A110}},
+    {{0x1E65A5F6,0x8E86274,0x1CA933CC,0xCDF4727,0x112EB74A,0x41CA0FF,0x1F09C4EB,0x80D75E6,0xD61703F,0x103480BF,0x12403996,0x140F8284,0x17ADFFA,0x1E8A295,0x10B0AA67,0x1DC9596A,0x126F319A,0x69465},{0x1E44F7F2,0x19699DE1,0x1F00BDDA,0xCCFE4F6,0x73F97DC,0x686F916,0x19D32833,0x151ADB40,0x5276F69,0x48DA688,0x1ACB95E,0x4498366,0xE260EBF,0x8B94D2E,0x2CC47D1,0x19ADA9E8,0xF03A06B,0x4DB50},{0xD7F79D6,0xA87CBB2,0x15468911,0x85E0B29,0x13B7CE61,0x1ED803AC,0x11834AF9,0x90E594E,0x12B1D4EE,0x18C5FA90,0x14F834D4,0x860168A,0x1CDEE74F,0x1E419268,0x1C85E430,0x6AB9EE,0x15DCCF19,0x3527E}},
+    {{0x1EEF7FBD,0x12C61F94,0xF919EF4,0x13DFC8D4,0x1ACE25FE,0x9105204,0x735CAA5,0x1C9EA7B6,0x1D5DC75C,0x1D0F0981,0x10AF93BC,0x3FFF491,0x38FB8D0,0x1D12623F,0xFDE989B,0x115F76ED,0x19A4946D,0x4ED8D},{0x15617F75,0x1338CE2F,0x1253922B,0x1DCA8C79,0xD7BE0C8,0x5B39BBC,0x16531D36,0x68C7FC4,0x3D9E87,0x1BE00F5D,0x1E25927F,0x1EB89564,0x198A9F66,0xC003845,0x1D532ADE,0xA1A708B,0x3FD37D2,0xFD5C},{0x1C52D1BB,0x9AFF5B7,0x1D912EBA,0x521A2CC,0xA3F999,0x64BB189,0xBE2BBE4,0xFA743CC,0x1B3F9248,0x1CCC129C,0x18C491A2,0x1F2985EC,0x1E69A0E2,0x1019661C,0x31E3B1F,0xA7C52C2,0x1D44D613,0x1FB82}},
+    {{0x67F9585,0xB3D38D9,0x16BEF3F4,0x1E7C3F48,0xB9092E9,0xA1BD2D,0x6B4F1DB,0x3BDD15B,0x1B2F4276,0x2628207,0x17F17FFD,0xFB122DE,0x27B9D2C,0x77CFB9B,0x13BFC91C,0x1856C968,0x18CD51BE,0x70C42},{0x1D907170,0x12F61E23,0x18EA34ED,0x19C139EC,0x1162B1A1,0xE6CAA45,0x11464525,0x5C5523B,0x66C0730,0x1D5C553D,0x1C6CB0DE,0x13757151,0x7B1BD9E,0x1576E451,0x12C95B4,0x18DBEE53,0x1FCC5D55,0xC8FD},{0x17DE4C4F,0x7B5483D,0x158EFC5E,0x1D413D76,0x1226EC6E,0x87AB402,0x1C4CE94F,0x13EAF9C9,0x1642E62E,0x1F4BAD24,0x4C57758,0x1E5FAA30,0x1C7A3C38,0x16564206,0x44F9749,0x5C342DC,0x1801E050,0x48F98}},
+    {{0x59DF046,0x10A208DA,0x1F4DFCA4,0x167C7C21,0xB7B96A3,0x1E53E6E0,0x19E9717A,0x144C1F35,0x1F83B03B,0x4254D42,0x161581E5,0x19EC336B,0x2334D79,0x8266229,0x1675BEA1,0x1DBBD231,0x27C3C76,0x16CE1},{0x5974509,0x1C75AEC,0xC23032,0xEA34D02,0xD4465CE,0x8827FB2,0xB2BF286,0x1CE330FD,0x1FAC5D61,0x966D56D,0x16E1151C,0x1F49F44E,0x194D08ED,0x44AD549,0x10BD991C,0x52757A3,0x9DB3BB8,0x28222},{0x6CE6800,0x13655653,0xA437FD,0x13C6AF5F,0x3AFA781,0x1D9B00B7,0xAE99FD4,0xFFF79A9,0x9FA8EE9,0xEB846F6,0x11630A7E,0xBBDB497,0xB3C6389,0x6D35AD7,0x1A23B901,0x1411FB9D,0x1825D759,0x27111}},
+    {{0x1F329C77,0x1E96EE4F,0x67DFFB1,0x165480D5,0x4A98A88,0x3991969,0x1B52503,0x6FC4C3B,0xF0D79DA,0x66BED6B,0x8DAB968,0x1F74DAB,0x66BC894,0x7D0601F,0x105D1772,0xD46F5F6,0xA983A70,0x61FAA},{0xF1FDA5E,0x12E55AE0,0x1F8EE2B9,0x28A702A,0x1E966A0F,0x88FAD98,0x25982A0,0x1175202,0x1A68DB6D,0x7E534C7,0xDC7AAE9,0x154DCC57,0x1D78D1B5,0x36E6D2C,0x136F40DB,0xD9AEB77,0x1FE10940,0x4D418},{0xE325E8F,0x15B50B13,0x81AFE93,0xC3F7751,0x7BD65CA,0x49BB2BF,0x11CBD05,0x81726E8,0x1D8E94AB,0x17CA7CAA,0x6FA526F,0x153FDB6C,0x60B8E8,0x1688C8B5,0x30FCED2,0x7FBCAEF,0x45D660D,0x1050}},
+    {{0x114795A7,0x373DBD4,0x6A4365D,0x194506E2,0x7766D13,0x135B8FF4,0x131AD6D3,0x12F6F681,0xD36E2C9,0xD51876F,0x67F73FF,0xBD3C1EC,0x1DDF7FCE,0x17BFA7F6,0x816BA99,0x1652667E,0xC7F0636,0x4C763},{0x12F61B7E,0xA26C830,0x22CFA97,0xBA74696,0x189F9527,0x159787F6,0x1BD352A7,0x387C240,0xC2EF4F9,0x1D3B0568,0x3C81213,0x19F4EF01,0x1D1470A2,0x1A1F64D8,0x43E860,0x6E8F690,0x15D94AF0,0x3F7C6},{0x1F84CCE6,0xAA60800,0x5E579EE,0x18487630,0xE08B1ED,0x5254219,0x15781CFA,0x161D551F,0x10B3C6AC,0x179022A,0x1517DDEF,0xB147B5C,0x77A590B,0x13DA16D2,0x1BFF13FF,0xB39BF2E,0x1BACF4F2,0x37AE8}},
+    {{0x18432449,0xE08660,0x91216A8,0x9337A18,0xBAFEB53,0x116EEF6F,0xDB15F99,0x82C7BB0,0x1A482D8F,0xCAFA576,0x17EFDCC6,0xE7F293B,0x1C615A80,0xEF779A1,0x19BED3A7,0x9870B8F,0x16E60904,0x216A4},{0x175D19A3,0xFFEFE83,0x14F7A242,0x8DF3CE3,0x4E1A5D1,0x20B00AC,0x16E78D69,0x194DA77,0xD71990,0x9B76898,0x1A061E32,0x7FC164E,0x1998A3AD,0xB2A0DBE,0xD469B95,0x2717E79,0x7691FC9,0x52B6C},{0x9EC1D36,0xE78332F,0x14258817,0x2C944DB,0x18855800,0x328325E,0x148F0A45,0x19590E2C,0x13B5B4C4,0xC1C628D,0x1B6159D9,0x45B763B,0x1FBF02D6,0x20319C0,0x13DA73E5,0x1E9652E1,0x1B692779,0x29515}},
+    {{0x17EAB3CC,0x1D5DD227,0xC084D7F,0x137BF865,0x1B32BFFE,0x1F759B51,0xDC4A8A6,0x18321E3,0x154B32C3,0x24EBD6,0x15045C3A,0x120099F8,0x17F57740,0x4A049CE,0xAEDA9D2,0x1AA3072,0x1D64E4BE,0x516CE},{0x183A3069,0x1E4F208F,0x7D14210,0x15E767B9,0x7483CFD,0x15DC4E76,0x186EB115,0x16DC2077,0x2431C8F,0x1DFDD2E4,0x1409EDE6,0x2D938BE,0xB5EC2D1,0xB0F8783,0x15080401,0x1667D1BB,0x14D5D36,0x5CDC6},{0xB80F874,0x1F52273A,0x1E25F86A,0x187061B9,0x9217B24,0x11F7FD4A,0xC5B432A,0x17D106A8,0x18A4BCFF,0xEF73692,0x1DE44FC2,0x1DB7C741,0x19A2CD23,0x1D591AD4,0x1C99E141,0x1DB808B2,0x12D907DC,0x766BA}},
+    {{0x1B86F050,0x14FDB8B7,0x1E0BE75D,0x1A6CA009,0x1812F6CA,0x1814D92F,0x2519FDB,0x16BADB4E,0xFAD5445,0x65FC80B,0x5BFDCA5,0xD8F39C2,0xE3450DD,0x14362181,0x1C7FF45B,0xDFFCBA9,0x9BBA99E,0x7E788},{0x1AAF9746,0xC1EAA99,0x1F9E2E65,0x14F7C320,0x3BF5296,0x1448CC96,0x911D781,0xAD9D6F8,0x1D2CECC6,0x3508754,0x1EB2D427,0x8842D7B,0xFFFD0E5,0xFCC95BF,0x283FE4B,0x128F59C8,0x1A306476,0x60509},{0x7F696D2,0x20A7558,0xB73764B,0x2B63912,0x135637CA,0xD91BF14,0x154A66F7,0x9C70164,0x52780E7,0x7E0DA31,0x483EB64,0x1467BCE2,0x620E527,0x1A75BCF6,0x16D9D6B3,0x15D80294,0x969A896,0x3AACB}},
+    {{0x793698D,0x15A3BE6B,0x1B658D3C,0x1DA0CC74,0x1D7CF42E,0x196715CE,0x118E9F93,0x12BA0D9E,0x2FB2283,0x81239F6,0x1210ACE8,0x8C7BE6C,0x1D4A09A,0x106759F2,0x1A48701C,0x1435C0E7,0x1033E42,0xB8AA},{0x5F07DA8,0x534A489,0xAB54FA0,0xB4785C1,0xF71E2A7,0x1D3636B9,0x4195F53,0x58F4C8F,0x5C7CEB2,0x1BE3EFE1,0xA4B7D0B,0x1FA83572,0x1664BE67,0x15B64B0A,0x14FCAB57,0xE9E602A,0xE2D4AEF,0x7816A},{0xE113066,0x1116FA3C,0x1D94C841,0x8BCE825,0xCC4477C,0xEA038D4,0x91F1FDE,0x172481B0,0x14B288A5,0x68E58FE,0x3503CD0,0x1B645308,0x55F89DE,0x15F7A02E,0x34A2C38,0xDB2387A,0x1BCBBC11,0x331F0}},
+    {{0x16D9B1EE,0x1EE7395A,0xCE8803C,0x7389AB3,0xECFF19C,0xB178FCE,0xD50D289,0x1A9F6FBE,0x5269105,0x1283F90A,0x9D700A1,0x84A9526,0x815661E,0x14FEE970,0x1DD3215A,0x1452B816,0x11B250F5,0x2E9C5},{0x140D43CF,0x1DCAB0D2,0x1D2DE1EA,0xB9CDEC1,0x134375D8,0x5E895AF,0xA640FB8,0x191F9686,0x1F64B57B,0x1E6292B7,0xD104BFA,0x1049DB8E,0x1F72CE3C,0x1915FD96,0x1A69BB90,0x1CE3B3B1,0x1824020E,0x172BE},{0x397556,0x1191D24C,0x39C8C54,0x7914EE4,0x104E5038,0x1CE3487E,0x169A409B,0x18318023,0x11758ED6,0xE5923E7,0x1F49369B,0x1382E9DA,0x4567096,0x1B312717,0x1EF620A9,0x1A66DB11,0x1B5F0FCA,0x3010B}},
+    {{0x14193F47,0x1DEBD784,0x1100E0D9,0x1244F2C0,0x148B19F8,0x1BC1587D,0x1911044A,0x1531FEB,0x1F23796F,0x91AE796,0xA1742C0,0x1D96C251,0xACE3D55,0x193DCAEB,0x83DA909,0xE2CF6A7,0x17608387,0x3C2F1},{0x1461D106,0xCD0C7BC,0x1399D25A,0x17B6A66,0x14391049,0xA165729,0x9A884EA,0x8937015,0x15B3EB28,0x1FE2C8A8,0x16ACC51C,0x12915176,0x13346CEA,0x1356E451,0x7801789,0x33B5B0D,0x12D25E2B,0x85D2},{0x14DC7597,0x1CE75A99,0x1B152891,0xFFDF445,0x3B3E7F6,0x1962AD4C,0x1DCACAE7,0x19AC00DD,0xB13CB17,0x1919EC25,0x1F39ACCC,0x4C0251A,0x13B5CCFE,0x1D7EDEA7,0x1D30AD28,0x1DACE241,0x763598D,0x587B7}},
+    {{0x11E84FD3,0x12D29FC6,0x18F0DB18,0xDF233E2,0x1CAF69E9,0x145AA7CF,0x7158226,0xC5181A3,0x1099D550,0x10C29E34,0x1B98217F,0x18318BE6,0x3587B34,0x39F0378,0x2F78BCF,0x113DD34E,0x11DAF53A,0x29FC7},{0x122BC4C3,0x81AA6F4,0x618F913,0x1BB4EC08,0x1DFAAD64,0xEBFB920,0x1A74D5E1,0xC2C74E2,0x108A1275,0x11D83CA9,0xCE2182,0x1C7C6E2,0x14E76C01,0x15426F69,0xC1B6B65,0x352918D,0x4343810,0x4AA5D},{0x8ED69BB,0xEA93E3,0x49C6A3,0xD3C772F,0x17320693,0x1416C9D7,0x1D626026,0x8B52B90,0x1FC9E009,0x141157B2,0x159EC754,0x10B13B08,0xF359E5C,0xD305CBA,0xBDDF943,0x1DA30EC7,0x1DE75239,0x4CF13}},
+    {{0x175A1B3D,0xBB8CA79,0x84FB1EE,0x239A6E4,0x1CAC0893,0xD32652F,0xB72F777,0xE5A7E42,0x1B1B0A78,0x13C79651,0x11DD96E3,0x1AE5EF87,0xE447368,0x19711C86,0x9CFC40C,0xA88BDEA,0x1BD48AD2,0x66A51},{0x947A8D2,0x604FF8C,0x1FA9D1CB,0x2BE2C24,0x1C3F5F8C,0x1764365,0x9AD500C,0xFF9E7FD,0x10B0CBE1,0xE11736B,0x968848B,0x1F061F88,0x1982FFA7,0xDF198DF,0x62BCE21,0x124AC48F,0x14C908A9,0x5A683},{0x188C8C84,0x19AFD64A,0x1E9EFF87,0x370D0A3,0x1221135A,0x188E6CE7,0x867A2CA,0x19A58E4,0x29E6EF0,0x3C48D49,0xEB5D11C,0x144280B2,0xCCE3765,0x18FA4898,0x7EE5C27,0x1AB3F8BD,0xFFBBE90,0x2E2F8}},
+    {{0x17DA9BF6,0x1707C07F,0x195B9943,0x634F028,0x1421482,0x31A8A64,0x1507C771,0x11DE9F32,0x1C1B4B79,0x11B99EEC,0x9C3989F,0x1F340D11,0x1BE45C1A,0x18B0AF0D,0x16D89E3D,0x1470A159,0x1B4C865E,0x1D347},{0x1947B91F,0x77B3F6E,0x4913FBA,0x1F626368,0x47FFAFB,0x11B80E17,0x19C71B0,0x9F00D22,0x10529A11,0x31397A9,0x18AC7647,0x1E2A7A4,0x8AB2F9F,0xCADC3D2,0xF4C9A76,0x14EF7CF3,0x182B00B2,0x302C5},{0x8036532,0x9E7F1CD,0x1619F199,0x46D32CC,0xEDC834A,0x1425CF55,0x1985EE7B,0x4087B47,0xEA1E41,0x14F6766B,0x4102174,0x1F202848,0x194E1560,0x11D03A2D,0x1E436977,0xBBD3A2,0x4BBB6E1,0x6A040}},
+    {{0x18389D3D,0x1F767281,0xC695989,0x1AE02E0B,0x323B3FE,0x17E26A96,0x15FF57D4,0x17DE0ECA,0x15EFA9C7,0x12F9F74C,0x132724D7,0x60D4462,0x13D61A98,0x1CBCD1D2,0x289CBA2,0x1278028A,0x12EE045E,0x386EF},{0x35C5D50,0x1EACD147,0xA9F38C2,0x1B80F02F,0x31A635A,0x1FFD9DC8,0x11806CAB,0xBDF580C,0x14D60105,0x14518530,0x167DE3A9,0x107F1DF7,0xC500A2A,0x904D427,0x1CA62F8A,0x132A354C,0x1F91F137,0x6077A},{0x565407,0x1230AA55,0x1AD1367E,0x1835B8E2,0x16563041,0x5358320,0x7DE913D,0x58E7A76,0x16223136,0xA47C065,0x189B1E86,0x44EFA6A,0xC24C528,0x3E69063,0x1D6AB484,0x1ED66CA8,0x510742C,0x3A3A7}},
+    {{0x1130A6BB,0x1AB33CFA,0xFBA8400,0x17CF55F6,0x1E478C85,0x22F8B76,0x10141EEF,0xAACE53F,0x13652D84,0x17A2673A,0x1676F6AD,0xFE6811F,0xFE23623,0x106DFAFE,0x562F3EE,0x17D7AC68,0xB3CD7B2,0x3C416},{0x15A273A7,0x4959CA8,0x124B42B4,0x1A721EB0,0x1305D217,0x1A17811C,0xBAA5F84,0x32C5C25,0xA5A4889,0x39CED08,0x1EA56891,0x845CF22,0x1AFA96EE,0x6D846DA,0x1B29390,0x11EAB28B,0xE7EB010,0x5328},{0x1864FCB4,0x1A185CAB,0x1FB228B4,0xB4AD9C6,0x1D1E59CF,0x175F3DDD,0x1246495,0x1CC889F6,0x19E82EB9,0x1AE4FCF4,0x1B132B1D,0x9DD0A5C,0x1693AF11,0x36AE63,0x1DB92B63,0x19E02AFE,0x129E9BD9,0x63117}},
+    {{0xB770BCE,0x1832759,0x17E46A9B,0x14099359,0x850D077,0x3002795,0x80EB39B,0x640E742,0x8FB891E,0x16EAADB6,0x9C2FBF0,0xDC8F966,0xF6A9570,0x1F31DB5A,0x95446AC,0xE07A9CB,0x10407ED9,0x726CF},{0xCB6F38C,0xFC25A31,0x9D52F34,0x1B97EE2A,0x16107F3E,0x1B7E76CC,0x1C8DBD86,0x6F01252,0x10A83D3A,0x1C4DB62,0x9089EE9,0x1885147C,0x122B052,0xB4A6513,0x310AB71,0x1E31CC73,0x7A417AC,0x69FDD},{0xA533D47,0xB7BB93E,0x12A3CC76,0xD9A51A9,0xF91B6D,0x10AE31FD,0x1A2BA61E,0x1DD96C85,0x107C9890,0x1DFF8F2,0x1B61F4E9,0x2E4D6E2,0x1DB24C41,0x8C6C164,0x1989FA39,0xBCF41EE,0x567DA52,0x606C3}},
+    {{0xDD24B6B,0x105BBDBC,0x191519D6,0x149218E5,0x17799EB9,0x58D6BE2,0x14877976,0xC1ECEB7,0x1EE313AE,0xEE4069D,0x113BF786,0x13993674,0x1D6824D1,0x66B3C22,0x1A417E4,0xB4A84AF,0x2429DDF,0x1231},{0x16395180,0x6512B76,0x19B5DFDF,0x5FC35F6,0x1CBB715,0x68D009B,0xEADF87,0x46B96E9,0x7C26EDF,0x101E1F88,0x1E6E75FB,0x1B7BDB0,0x1F430A2C,0x1A83EF65,0x11403B90,0x9EA6B6B,0x16AA3D37,0x7070C},{0x135904E3,0x1413F1F2,0x1D69ED1,0x13E7E710,0x1F5845B4,0x1605E497,0x76B4CF6,0x1ABE36E1,0xBC9EC99,0xF9563CA,0xC97825E,0x1B87CA6B,0x5016062,0x1AED0314,0xF785A96,0x17E2B3A9,0xA66811F,0x22406}},
+    {{0x2F6403D,0xE762384,0xA4D464C,0xF5A87DC,0xB952F77,0x165CE43B,0x990F791,0xBC945EF,0x4ACB289,0x14F3B8,0x96E7C9F,0x8FC003A,0xE75E046,0x16C259A6,0x13E9F137,0xEAB0EA,0x18C35036,0x7C761},{0x867857D,0x1F83D997,0x1F75EBEA,0x18425DF4,0x1FA37188,0x24EEB16,0xB52AF81,0xE90008D,0x47E3F0E,0xAD586B6,0x1EEC67CF,0xE587E6B,0xCE55199,0x1F3870A,0x161E5313,0x1BF04591,0xFD36F,0x71540},{0xA469BEC,0x6A431C1,0x1B144780,0x8F53C31,0x3382245,0x190DF484,0x7A5AAF9,0x155F2FE4,0x1C7329DE,0x1248D0B2,0x3AD17B2,0x23131BB,0x123BE11D,0xA52117A,0xF94FF7E,0xDE0AE62,0x16D9D42,0x419F4}},
+    {{0xEEA7D55,0x130A16A3,0x1AD93441,0x19DE006F,0x7E7ED26,0x1E5D3566,0x19F20850,0xA10EB00,0x3708319,0x3A2A063,0xB348CDC,0x7CA23B8,0x11340C28,0x1D4761D0,0x1A8E747,0x52FA4FA,0x17FE5616,0x1DC9},{0x18EE8AA6,0x2E4E733,0x14408CC3,0x3F5AFB7,0x8645894,0x1AA3F148,0x45B42B7,0x1B163F92,0x12311880,0x1202F67F,0x8D0A8D,0x9EC01EB,0x122D9297,0x11081BAD,0xD5BE8F0,0x7DCB8E0,0x1E2A5524,0x7509A},{0x10ACCD7B,0x18A155B3,0xB67F69,0xBDE39C7,0x4A2E795,0x17F982E5,0xF7CEA92,0x1D0436A8,0x86357C2,0x16D50AF5,0x1C821B5,0x1AE2D9D,0x1CB39D85,0x398CE7A,0x176F1983,0x1F0860EE,0x81B06FF,0x13795}},
+    {{0x120EF661,0xBF98AB0,0x1DB92200,0x1747444B,0x18CD4E91,0x154D2B37,0x7185824,0x54F46DB,0x8C19A02,0x1BD760B2,0x5FBC796,0x9EE6ACF,0x1BA43076,0x1573B229,0xB6F6C,0x29123D4,0x8138C63,0x328BA},{0x842A41C,0x1400BDC,0x7A99A33,0xAB93974,0xA726D80,0xA09A287,0x1296E978,0x40D9A5F,0x1B5DD442,0x10960FA8,0x906C2E2,0x4E78814,0x60F765E,0xD9F6133,0x17525D1,0x10E0B05E,0x662976D,0x43314},{0x4A8A08,0x1B6618A,0xE6E79FA,0x8B51DDD,0x119030BC,0x1E93E4C4,0x9515083,0x1374BC9D,0x78BB5CD,0x17F17311,0x1857ED82,0x902DFAC,0x1E32E166,0x19FBB73,0x7F968E6,0x5B9D3AB,0xB983C07,0x3D8CC}},
+    {{0xA9E439C,0x795BE13,0x1BA9DADF,0x64DF5C,0x4C5869B,0xF9003E6,0x1839F817,0x1378034E,0xB71A838,0x128B622D,0xE697AD2,0xC8F3B84,0xD09D44,0x18C7E732,0x7A56785,0x9D81A90,0x167512AC,0x7EB03},{0x95D78D4,0x761D8AB,0x120600E6,0x63FA32C,0xC6ED01,0x1093B5E8,0x13E3E3BE,0x7F4CB0E,0x1B81285B,0x13D345C3,0x1C4F6FDC,0xD114A1C,0xF5E946,0x690F8C8,0x333FB6C,0x3CB6393,0x1550AA4E,0x30080},{0x158BE179,0x170B2596,0x207970,0x6A00921,0xF3A0587,0xFDF826D,0xBDF287C,0x16C4E01C,0x1D2CEE27,0x16EC51A9,0xFC59C54,0x1AA1B3DA,0xA4E403C,0x6FF6734,0xE7BBA0B,0xB33B9F7,0x15F754A3,0x201E9}},
+    {{0x10EDEC6C,0x15082F9A,0x1AB47AAB,0x81B8D4D,0x6BE60EE,0x1AA4DF6E,0x1FB0923B,0x18797961,0x15DCFE9A,0x3E45C5E,0x155B385A,0x1BD062AA,0x1D9D2CA1,0x270BCAB,0x109CDBB8,0xEF19293,0x1D259DBC,0x55EF3},{0x100E4C5F,0x104CE266,0x17D6DFDB,0x5EE7242,0x57D24C1,0x13CF11E6,0x1ACC6BF0,0x4562A40,0x1AE6936B,0xF46D2F1,0x2103A1D,0xAD0967C,0xED89A08,0xF638EA4,0xECFE208,0x488A103,0x4E9F6F5,0x43E73},{0x1C2BFD3F,0x832BCDC,0x7352B5E,0x14F17227,0x1231BBA4,0x4FEA1F6,0xF34B5D6,0x10F5C14B,0x1CB488EC,0xEE80116,0xE4B6A3C,0xFBD782E,0x16EBAD96,0x51C7DD3,0x1D3F6737,0xB4DBC2,0x1E41028,0xCD79}},
+    {{0xCAE7419,0x568363D,0x7CF57A4,0x166F7B2F,0x1E87954,0x12018A48,0x8CA35B7,0x4238B2E,0x17554320,0x15319320,0x19BF7709,0xB0C1619,0x1B1FE0D8,0x1EF29D4C,0x3151B1F,0x184C8DE2,0x6EB558E,0x3483E},{0x1F0B517E,0xE83D91F,0x11BDCBC3,0x1771427D,0x1A0315A5,0xA663E82,0x1D6E0DD5,0x452F3D9,0x1865C1A,0xDF136F4,0x4B65AC3,0x19A52350,0x6518D2F,0x10573594,0x10983AA4,0xF1F5A80,0x1BDE4D18,0x28059},{0x140E5C16,0x8D2C494,0x16BDE756,0x1E3DEED0,0x5BA87F5,0x108A4215,0xAE8A206,0x12DB60D6,0x7009029,0x15A6BCFA,0x16ECC0F5,0x11C6EB9C,0x1F8ECAA9,0xC5207DA,0x28C1A21,0x296509F,0x7BEF05F,0x73E35}},
+    {{0xB59CC5C,0x9E2AC6B,0x48F3028,0x12C24A7,0x19FCF4E2,0x5DD5BC9,0x9F2487,0xCC4D77A,0x1454712,0x1BEA58FC,0x1AA9E7E,0x69F7CF8,0x1029B58A,0x53CC672,0x3DA816E,0x1C2D796,0x35BC8A9,0x40B44},{0x177B06CA,0x1F59585A,0x1784546D,0x185D1A39,0x12EEDC34,0xF898CE2,0x1C937B9E,0x1DB631C3,0x19AAC986,0x10234493,0x1F718A08,0x1A121E1C,0xD38EB6,0x4208FF1,0x2304012,0x16D62DC1,0x15F26A63,0x44574},{0xEF32A53,0x1E67DEB0,0x113208CE,0x191969D0,0x39023CF,0x1FF1B8E2,0x1E9CD0AB,0x9C47A52,0x1820C9C3,0x4C8959,0x1CB4A1EB,0x67BB172,0xBB51955,0x1E862B91,0xE90EB93,0x5417E68,0x1D513DB1,0x7ED0E}},
+    {{0x110C9199,0x1DC71A05,0x68C2935,0x1EDDEAE0,0x8E45C0B,0x150B5CE4,0x9E41D8F,0xF6ADE5D,0xBE6E67,0x17610C7D,0x159F8164,0x156A8BCD,0xC098DC2,0x9E8D38F,0x118EA783,0x11639B22,0x153CBD83,0x1408C},{0x1D900F67,0x1B772756,0x1A8A865D,0x167A48C6,0xAC2405A,0xEAD810B,0x4D2EC74,0x663FD26,0x114380A0,0x83620C3,0xE75502B,0x129D9D40,0x15AFEBFB,0x72BD2FB,0xCB28994,0x137675D2,0x529AC77,0x5D38},{0xE83EB19,0x27FF73,0x12695250,0x10DCBF39,0x9FD2590,0x6474E94,0xBE822C5,0x10C303E3,0x784863D,0xB4D84A1,0xA35FA85,0x1E14BC1F,0xFE2E4ED,0x1DEFC1AB,0x1281B76,0x1AA352BE,0x1DB9C990,0x5D0B0}},
+    {{0x16B489BB,0x13844428,0x43E6E24,0x18D374CC,0x1A704A7A,0x1DA926B9,0x1811DD85,0x912E2F8,0x67A6A9F,0x16044CFD,0x1FBA8ED9,0x159EC30B,0x794CAB0,0x635D7CC,0x1F2F7C50,0xFBB0D62,0x1BC5C3D0,0x304AE},{0xF4D1B6C,0x68D6DFE,0x4FF282B,0x19AF4E2F,0xBC83464,0xB75D343,0xC29C563,0xBD304BF,0x3B7BBA4,0x1169F506,0x618E85C,0xA49526B,0xC61DF7E,0x2C51AED,0x1FE2262D,0x965FE28,0x8E8C5A2,0x7C3C5},{0x58587D1,0x784BEA7,0x1868C9AC,0x374487D,0x108DFB13,0x40F04EE,0x118575D0,0x58ACD67,0x894629A,0x627E31E,0xBAB5859,0x2693017,0x1E281331,0x831692C,0x196B5A89,0x1482FDBC,0xCB517F4,0x31B1F}},
+    {{0xAA13868,0x1560C25C,0x1A6E099E,0xE8C9219,0x1CC3118B,0x1AAC13F4,0x933FB43,0xF976246,0x1E717A71,0x105DD6F,0x1884E562,0x4E957B3,0x19459BC4,0x1E919B30,0x14E7C51C,0x70F7443,0x19175E13,0x168C2},{0xCB0379D,0x361FE82,0x14054ECC,0x3DD0D56,0xBF4CE4E,0xEE828C5,0x1DA4952C,0x591B923,0x92530AB,0x8A83305,0xF62BDE2,0xDB7E017,0x11B29DE8,0x1C76F5F4,0x1C11794D,0x1EBA2D3B,0x6BACA82,0x3D2B3},{0xEC687CB,0x183A31AE,0x10F56E41,0x1BF42D5,0x171A1A68,0x1634A5F3,0x16040536,0x9120B05,0x9DA86AF,0x7170E80,0x1CBA216B,0x97FACEB,0xB492970,0x1ED75194,0xE678BD8,0x12313273,0x14A9F5CA,0x46A17}},
+    {{0x1DE4BC12,0x14AC2648,0x1CE16D6F,0x3AF85C4,0x219439B,0x26873DD,0x84961E1,0xB14725A,0x14573F5,0xBC4E289,0xEE67881,0x350E9DC,0x166FC915,0x823690A,0xD2B1E2A,0x3B80FAC,0x75CD8B6,0x243EF},{0xFBF01CF,0x10B785DF,0x1DA5A8F8,0x1872DD13,0x35FDE79,0x1B2903DF,0x12260409,0x14595BD8,0x83DD439,0xA132A4F,0x4A43105,0x348F614,0x1294EB,0x665AD94,0x1A5D7EA0,0x1DCC0AEF,0x11CBABB8,0x4677},{0x1A974803,0x15338A3D,0xB9BA7D0,0x11883DB8,0x1672B20D,0xCFBFBED,0x1BA7C37,0x1AD5091B,0x1C3F6C02,0x2F29E44,0xC9AD974,0x129D0A2E,0xFF27BFE,0x1B97134C,0x14314419,0x128AC0BF,0x1229B566,0x2D0E3}},
+    {{0xA9B4F14,0x169470A1,0x1CF42331,0xA185911,0x17AC7FF9,0xEF4BC7,0x767617E,0x10D1BA4D,0x1C57272E,0x1590BA99,0x188CE929,0x81D1B8C,0x135003A,0x1807EBEC,0x1EAF0EDE,0x1D7CB331,0x17A5B1DC,0x5E0D4},{0x149FA1E2,0x2B460D0,0x25C57B,0x157C80BC,0xF8594E,0x12B7B31F,0x45897D4,0x62D2B95,0x1BA86A5F,0x1EF5D14F,0xBCED156,0x146D0924,0x73614F7,0x14DE0146,0x17B29DC5,0x1114B23E,0x16CE4A8B,0x77B81},{0x106766D3,0x18C3E849,0xA43D002,0x2073FA8,0x1B42562F,0x47A0EF8,0xC66325D,0x1912F674,0x17D097B4,0x1287734E,0x884F3A0,0xC121A7,0x102B4ED8,0x1202BDAE,0x75A541B,0x1DBFAC35,0x6039263,0x6CEB6}},
+    {{0x63485AE,0xD5C6085,0x2C32EDE,0xBE64D0E,0x8530E0F,0xC3FD7E2,0x1DAC41C3,0x4585243,0x16ECE154,0x16082E29,0x12AB4B15,0xFC9C8EE,0x156F5B49,0xE000C89,0x1E86111A,0x18ABE71C,0x303BCF1,0x28F0B},{0x10BB993,0x128C5917,0x5185A09,0x71B620,0x8EFBCC7,0x3B5C4DD,0xBF89349,0x1D22BBF0,0x7F2B87E,0xE949550,0x6BD6BBC,0x1B2BEA48,0x1CB50B63,0x1D174342,0xE8FC634,0x16CE465B,0x1C8BD11A,0x63D21},{0x6FDA23E,0x1C6FB0B0,0x1967EC9C,0x90A53E2,0x147A768E,0x7B43AAA,0xC6F0C48,0x23D9A1E,0xA93D729,0xB24B0EE,0xFFE81D0,0xE59EDC0,0x1494C068,0x32D6662,0x8234CA3,0xB2A8EB,0x11114D4B,0x4FD1B}},
+    {{0x68A097B,0x1015210E,0x15E39731,0x1010FD0B,0x1E812AC,0x1715D8B3,0x1B4604C5,0xCFAEE39,0x116636E7,0x15875722,0x6FCCAF5,0xE7A31A4,0x2F965CF,0x17D5884E,0xC59CA2A,0x1A7F5B0B,0x110852AC,0x20F38},{0x1D1FBC8A,0x49FE9B0,0x101F9E05,0x1CDA0603,0x1C7C2986,0x75E7A46,0xDBFF94,0x1637603C,0x18D1C340,0x1E68676F,0x1E6235AB,0xC345734,0x6C0C78A,0x17B15DCF,0xC35AC64,0x113C7291,0xC0079BA,0x5201C},{0x12DA0A56,0xA41869E,0x1817CA16,0xD89E627,0x25A9D0,0x16CAFA91,0x5A2AB5D,0x54BE144,0x18E4C7B9,0x4600F42,0x16A9E952,0xF86707,0x1E1623B0,0x7F47FC8,0x1065596B,0x7E376B2,0x8F3BDC8,0x4D8FA}},
+    {{0xBDA8B00,0xE63C912,0x1EAFCDBF,0x461368A,0x1FC41714,0x714D750,0x8C38691,0x15D9AF81,0x1DFC1B0E,0xF86F555,0x1F556B9D,0x19E53AE,0x6A11261,0x812E92D,0x1FD0DB70,0x9D2D2B7,0x21DB4BC,0x48519},{0x13B522D8,0x229AA3A,0x1AE5C165,0x168B634,0x15971680,0x1284CFC8,0x1B230F21,0x13617185,0xAF0A342,0x153199DF,0x1E8FB0AA,0x1C91F86B,0xD473ABC,0x1E75E8D0,0x6E69A0B,0x15367BDA,0xE5912D4,0x1C536},{0xD5E3360,0x53FD94,0x1BE59C21,0x13C0176D,0x510E035,0x16AC291F,0x162AA32C,0x1A6EC389,0x1FD45BC7,0x1F07C85A,0x164CD74B,0x15ADEC00,0x57401D4,0x1E52D34E,0x1B238824,0x19B78306,0x17257BE,0x5EE29}},
+    {{0x1741A1EE,0x92D486F,0xFA605C3,0x12F3715B,0x6C24BF5,0xEB42C18,0x133BC09B,0x1679FD90,0x1837FEA8,0xB8FED8F,0x19C8C61A,0x163B99A8,0x1C0433C,0x1ABC45B1,0xD39ED36,0x5FA9D49,0x1BEBF6E9,0x48E10},{0x125211F8,0x24CA867,0xB23C039,0x18BBCD44,0x1CEE26A,0x19E77EEB,0x4315F58,0xA92B36B,0x6F0DA69,0x98EBDE7,0x149764BD,0x1402B62A,0xC4686C6,0x1D17BF6E,0xCC60CF2,0xF869813,0xFD28381,0x3612E},{0xBC6F6C1,0x14081AE2,0x7ABFBE5,0x1559F0B5,0x77B7A6B,0x36B7923,0x89B900F,0x2FA5F27,0xFCC3078,0x17D78724,0x1B519B44,0xA7A13AB,0x2944EC6,0x1673CAAD,0x1C46EA01,0x1BC9872C,0x8FD7133,0x7563B}},
+    {{0xB5B512F,0x10B6ABB9,0x111266B8,0x296F203,0x920CF00,0xD73AD64,0x1CD6E171,0xB8B4249,0x1506DE37,0x177EEAA4,0xB2FEC9C,0x1DAFF987,0x16AA6C07,0x15CC54C9,0x892408E,0x1506052A,0x1431B301,0x61F87},{0x15E370F3,0x16C60A3D,0xE0A211F,0x19480FA3,0x1548190,0x1B628E,0x1FE9C778,0x1C064446,0x18AEB9A,0x132EA890,0x147BC894,0x2F79F51,0x25F7176,0x1EBD3C3F,0x9E38129,0x1756576E,0x118FD2BF,0x7041F},{0x49B8E81,0x17BC104,0x19EE1EB3,0x10FFFC4D,0x1C613709,0x17D9C2DA,0xBF3378F,0x3C2216C,0xC67F27E,0x1FF8E197,0x1238A6C6,0x19F23DB4,0x1DD7617B,0x10908FA1,0x3BF2D42,0x7F7F838,0x13A6F1CD,0x5647F}},
+    {{0x10F6F4BB,0x18F4D081,0x14376027,0xCA4E460,0x18CEB4B2,0xE550003,0x1EAFB511,0xEBAA5B3,0x1032C13A,0x436216A,0x15059631,0xEA04BF0,0x1C52C7D1,0x1095F21D,0x1FDD6B16,0x19A7B80D,0xA2C8CDF,0x7031},{0x3B1B743,0x1CCA5F17,0x144C6212,0x1EEA6F2D,0x1B785712,0x1B1E70F5,0xECCE676,0x179D9BE5,0xDAC2512,0x1D3F74A7,0xDBB06F6,0x1F5F2877,0x16F040BC,0x4F7A7D9,0xFF2B010,0x9EC09D8,0xB974DBB,0x62F82},{0x12F2980C,0x10E560D7,0x625682C,0x1C3072DD,0xF6A2977,0x1E0BE106,0x846C680,0x182FD453,0x1C381B6A,0x14D89338,0x31C5DC1,0x9EE5F0,0x1168A99,0x1D9F5B2B,0x8092A42,0x1841C21A,0x13BB1397,0x23FCB}},
+    {{0xF8BE778,0x1159B846,0x1C1B82D0,0x4A70F2,0xFB3E049,0x89475F1,0x1CE3C662,0xD2393D9,0x1343BD1B,0x1A4A61E3,0x8403692,0x19BB5B2D,0x4220FB7,0x33FAC92,0x137697A8,0x11F7235D,0x1EAD1D28,0x38694},{0x3AFB678,0x43FE24A,0x118300C3,0x1F082401,0xA67565C,0x150F2B2E,0xCF176EB,0x1DFBFA87,0x6C01CE7,0x70251BA,0x3FA2514,0x1EB8DA0F,0x8664ECC,0x1786FF23,0x1FB27A4A,0x15FD56D2,0x1A533552,0x2E4A4},{0x133E6311,0x1FA2DB2A,0xA1B74A,0x141A08B5,0x19989921,0x1559C71E,0x1655FD56,0x1593D2B8,0x7641CBA,0x63145C8,0x2784037,0x39E7A8F,0x1212FC70,0x1F2799EC,0x1570F4CD,0x1287D68E,0x143A4274,0x60C56}},
+    {{0x1A5619E7,0x199FF658,0x1631743E,0x87F5F51,0x88DBEC6,0xC5C6C8,0x1C3C6D84,0x16813810,0x1CF3836B,0x1A23F56E,0x1216D444,0x106152FA,0x112A76EB,0xE8B66BD,0x548D52D,0x1569845C,0x1B0C57E8,0x2414},{0xABBF80F,0x1E2C4D91,0xF0E168D,0xF397045,0x1E7AC671,0x1938106E,0x18D9EB8D,0xFBA43AA,0x1058C703,0x193D9D1F,0x1C4DE28D,0x188A9266,0x13CF6CB7,0x153BED2,0x1BBC40F8,0x1E55CCF3,0x1CB17311,0x49990},{0x6D1BBC0,0x56332F0,0xC1888CE,0x11C5B6DF,0x190E0EF0,0xA098344,0x1F7B7B5D,0x182756EF,0x11D2679C,0x130F7A67,0x7EB13A2,0xF51BFE2,0x14F31ABA,0x1222E19C,0x16C4C380,0x1BACF12B,0x127A53A4,0xBFDF}},
+    {{0x4FDC0B8,0x41E4431,0x4D3628B,0x11A42B0B,0x11921CD4,0xF5377C6,0x1C617260,0x155304E5,0x14978E6D,0xC05ACDE,0x976A844,0x8600F0C,0xBAE8B63,0xACF79C4,0x1E6C0970,0x161EEF33,0x186EC794,0x57D56},{0x1465190,0x1CA96F02,0x80F246,0xB730FA6,0xFDA3138,0x2F6B195,0x1643E569,0x14376F51,0x15589D2D,0x1C77A9E8,0x1D72D4F9,0x1376C93,0x3575940,0x801C3DA,0xF37712C,0xB2AF427,0x15317E49,0x62B63},{0x1CC448A0,0x1963283F,0x27E1A0A,0x129C125A,0xBF6DF92,0x83A817E,0xBCD5F87,0xC09FF99,0x1D550EE8,0x1A42D54A,0x17894965,0xE8AE491,0x5259EB,0x17F6831F,0x8F25AE9,0x1EBF099E,0x1C719485,0x75626}},
+    {{0x1CC07A55,0x13B72BC8,0x6AAED53,0x9994371,0xA0DEF9E,0x25564A7,0xCD97820,0x1E9B3B98,0x7787387,0xD3D5D61,0x17AD1F5B,0x3BF3663,0xBA7C7BB,0xBF44430,0x128C403F,0x8EE7E04,0x197347F7,0x3A05A},{0xE22E446,0x4B13224,0x179FB57F,0xEC66BD5,0x1A2C3619,0x1D07B5A6,0x2318BDF,0x806636A,0x15094EB3,0x195FE309,0xB980685,0xFE462F0,0x1B46FA68,0x168D4B82,0xE3E73B3,0x157AE01B,0x6D9B3BB,0x40207},{0xE72A252,0x11A0F1BB,0x14D3C996,0x100F34A,0xAC2F08A,0x99A5ADA,0xEF7F3BD,0x1A31AB0F,0x154B5458,0xD922603,0x8E1F64B,0x1BC856B9,0x15FC326A,0x19BDEA5D,0x8C5F9A0,0x22032E6,0xF0F59F4,0x43726}},
+    {{0x2634577,0x14D51503,0x9397F74,0x1B819E1A,0x1B5C82B5,0xA79A94F,0xCBC8715,0x154FE492,0xF03CCC6,0x178CB131,0x15726DA4,0x1FC5C470,0xC31B554,0x1F1268BE,0x1E528084,0x1973CEAB,0x4ECA1BD,0x363C9},{0x4C25784,0x850603E,0x145A958D,0xD3A34E9,0x1BAA3FFF,0xD7E5A59,0x1FF1A7C6,0x1B25C18C,0x6B63ACC,0x7C0DDED,0x5F4A91D,0x146EE6D5,0x1D223002,0xFC81383,0x41F5AF4,0x13752A39,0x4E948B,0x7739F},{0x1BBC7FFB,0x4BA8E3,0xC2D9FCB,0xD605409,0x1DA3E55D,0x145A16EB,0x6BB428A,0x1EE9E569,0x999D522,0x17E56D30,0xE0FF4BC,0x4E4F433,0x19D6974C,0x6A9BB1,0xCE81D9,0x1EE032E5,0x1758334B,0x24358}},
+    {{0x1DB5CF1B,0x5C8E919,0xD3F09AC,0x1AD8ABD5,0x1E95990,0x1B6AEF23,0xA0FCAC8,0x1B41B8CE,0x1242D3F,0x734E117,0x12CFC514,0xF944AE4,0x1058FD39,0x9BA75E0,0x676B3F8,0x16BE510E,0xDEF208F,0x346EA},{0x17F0E8C,0xCB67C,0xF9CC84F,0xDC09121,0x14F16B73,0xCB109FA,0x5BAFBED,0x1A455CA5,0x10A7FDBF,0x199B4060,0x19A2BF1F,0xF381171,0x7FAEC12,0x11040C51,0xF4BD27A,0x1EB59EB7,0x1767BF06,0x2932D},{0xD2A5F1D,0x7CDFCA8,0x10FE8F35,0x19E2E30F,0x1B096123,0xB2D7E7A,0xC7530AC,0x1CD80A52,0x1F7CE3B4,0x1F5CC880,0x18F4B216,0x13F02D6C,0x1BD3139D,0x3C1820,0x13498915,0x22133A1,0xF6F64D3,0x70691}},
+    {{0x199DD74D,0x146CDFD3,0x9C416D3,0x11902F6D,0x6E1D722,0x10FABBBA,0x594BF09,0x3977CBD,0xCEA464D,0x13169906,0x3D4267B,0xE18CE17,0x7FAB3D0,0xDA8ABCF,0x172E29E1,0x13EF3BCD,0x1722BF81,0x126EC},{0xF037726,0xF79CB1A,0x362B445,0x7B737C7,0x1C423C84,0x49312FE,0x17656103,0x3CBDADE,0x2144E2B,0x1F99FF54,0x94566A3,0x6D24733,0x1219518C,0x1569C56B,0x148B648C,0xC8892C3,0x1CC478D5,0x522DA},{0x1262DD83,0x4D74E18,0xBDA93BA,0x18982EB0,0x6D1F0C4,0xB7683CE,0x477C35B,0x7542FC1,0x2FD70F,0x14E387EF,0x18F6956D,0xEAACF36,0x57B3194,0xB2878F2,0x6A55B35,0x176C77F4,0x14813257,0x49C13}},
+    {{0x3D602F9,0x47D0CCD,0x1D6B9F77,0x1A6B2C61,0xF0E01AC,0x1316A8B7,0xF5DFCE2,0x5276F5C,0x1A0DE89C,0x1D5B926,0x10022BDC,0x60D0D99,0x1912CFFA,0x5A8256C,0xC81B2F2,0xD9DD041,0x16D68724,0xE475},{0x1D33536C,0x10CF3A60,0x16A917C1,0x1234DF85,0xF5F2D44,0xCB47297,0x1D7E7787,0x1C124159,0x3ED75F6,0x117CD907,0x1E3B08BA,0x142F1BD5,0x50D5725,0x12D47147,0xEE7534B,0x19895BCC,0x17251BD3,0x7E84E},{0x1C53D8A9,0x12518D80,0x669F1DA,0x18C5E1DC,0x190B0900,0xB87F257,0x13E9B484,0x9A22969,0x838A1EF,0x181BE96F,0x19131B05,0xC33578F,0x19129A,0x19945A3F,0x12EA1CD6,0x12AF9EAB,0x1EFB773D,0x40108}}
+};
+/* End of comb table */
 #endif
 
 #if CHUNK==64
@@ -49,4 +182,137 @@ const BIG_512_56 CURVE_B_NUMS512E= {0xFFFFFFFFFECBEFL,0xFFFFFFFFFFFFFFL,0xFFFFFF
 const BIG_512_56 CURVE_Order_NUMS512E= {0x468CF51BEED46DL,0x5786DEFECFF67L,0xC970B686F52A46L,0x2FCF91BA9E3FD8L,0xFFFFFFB4F0636DL,0xFFFFFFFFFFFFFFL,0xFFFFFFFFFFFFFFL,0xFFFFFFFFFFFFFFL,0xFFFFFFFFFFFFFFL,0x3FL};
 const BIG_512_56 CURVE_Gx_NUMS512E= {0xB9AB2999EC57FEL,0x25427CC4F015C5L,0x92568904AD0FE5L,0xEE46730F78BDC9L,0x3B81474621C14EL,0xA38227A17EBE27L,0x332FD1E79F4DC4L,0x7A18CB7888D3C5L,0x8E316D128DB69CL,0xDFL};
 const BIG_512_56 CURVE_Gy_NUMS512E= {0x6DDEC0C1E2F5E1L,0xD38A9BF1D01F32L,0x862AECC1FD0266L,0xE9963562601A06L,0x9E834120CA53F2L,0x9D22A92B6B9590L,0x6EE476F726D825L,0x98B0F577A82A25L,0x9BFF39D49CA71L,0x6DL};
+/* Fixed base comb table for ECP_genmul - generated by scripts/combtable.py */
+const BIG_512_56 CURVE_Comb_NUMS512E[128][3]=
+{
+    {{0xB9AB2999EC57FE,0x25427CC4F015C5,0x92568904AD0FE5,0xEE46730F78BDC9,0x3B81474621C14E,0xA38227A17EBE27,0x332FD1E79F4DC4,0x7A18CB7888D3C5,0x8E316D128DB69C,0xDF},{0x6DDEC0C1E2F5E1,0xD38A9BF1D01F32,0x862AECC1FD0266,0xE9963562601A06,0x9E834120CA53F2,0x9D22A92B6B9590,0x6EE476F726D825,0x98B0F577A82A25,0x9BFF39D49CA71,0x6D},{0xD299C38848E2BD,0x8454938C2B449A,0xA21E3C45725CE4,0x1E56D2A28E7D9B,0x53462C4D8E3520,0xDEB9CD01EE9C45,0x2F537307BB57EB,0x16F2B7B7D577FF,0x2B15912B3F7F25,0xD4}},
+    {{0xDE00FBA66BFE7E,0x882E031796BC5C,0xE0CE518D3A058A,0x2A2BE48FF0A3C5,0x86961E0945AF07,0xA05464FD3C0357,0x7178F3A144322C,0xC0CC1C50D2A8EB,0x9288075ED829EE,0x18},{0x3D0BADE02C1159,0xE4747F33400E61,0x6401E824D97B2E,0xC546620469BE56,0x2547473D0C2BC7,0xE9902FC70D9E4B,0xD6E771923A18A7,0x9EF89269FA6B8E,0x582AA150E6947A,0xD8},{0xE0BFFDE8638F59,0x40894E388913F8,0x8CBCBFB7C9F6F1,0xB7F979731E0FA6,0xBA2E4FF5BDAC0F,0x3B60700BEECC38,0x43EF94F7AF759,0xA4C39D76BCF4C3,0xB0506757CB180,0xAD}},
+    {{0xA3B4C979CCD09B,0x60D09C99BF53FB,0x8952171FD2D4D4,0x634A9117520776,0x632896D45396B,0xF0C98DB17AFE5C,0xA4AB0CE5DD271D,0x4EB18645D012BA,0x67D451FB9081FB,0x78},{0x280EAA53C27BBD,0x498B4AFC2A2C8,0x737E8CEC8AFC,0x6C8D9185DC0623,0xC0ABD9248E4C8E,0x91E0074B5C232F,0x474D27086E5798,0x1C827D534DB5B2,0x15FA5685FDEA08,0xF8},{0x7A4A6977FFA314,0xACF750AF0FAB24,0x15079CE697F00A,0x3A32121D54FE20,0xF50EEFD8331368,0xFA4024AB13026E,0xC4392E3DEFA92E,0xDD98EF078653F3,0x4FD1814B65C07F,0xF0}},
+    {{0xDB342CFBAEE5BC,0xD782343D195AF8,0x35EA75C9F5A0D3,0x1336790FBBECBD,0x65DD3200A7AFD4,0xF1643799A0FFDF,0x39398F6C58B0AA,0x84F78292B0A7AF,0xE734B2319A719A,0xCF},{0x1BEA227D3A5872,0x6159DA4948DF93,0xC8B54BEAA2E8BC,0xEE1F573D6C9C16,0xF1F06CAD748CEC,0x15F619129F68EC,0x6D7000368CAEC3,0x5848F64CAF4787,0xFD3E72D4922CA4,0x4B},{0x8D31B18D8ECCD8,0x43144FAF2C0F18,0xB9601A6EAC3938,0x25F96C57032D41,0x124049B2CC566B,0xF14E8517565510,0x86300D611E9FEC,0xA514450A306F16,0xA9DDEDD3FF8FD2,0xC}},
+    {{0xB732B7AEB7B16D,0xF3E8522D3E6B43,0xFA738783506535,0xFF9014E85821B5,0xC9798A0748E24E,0xCF6089A50620D8,0x3BD04787257287,0x6DF84A872F7425,0x928B7E2433F1A0,0xC},{0x4F6DE71664C5B1,0x28E8CFA8DE5754,0xC07549E8DEDE28,0xE0FF43A835C57C,0xED75AFAA9BCB64,0x548397F29F4D2,0xB7C8FF9B8323C5,0xCD154F044190CF,0xFDBCBFB5AA4617,0x9B},{0x8689FE152B5CBC,0x1863C6F2C1D55E,0xEC03499A00627C,0x8491FD8207A971,0xAF6B7FD3E6C86F,0x828133781E3D95,0x8AD61BB5342D67,0xBA6AEB9A863CB4,0x628EF213041D7D,0x93}},
+    {{0x38EF015B8E2D4C,0x5EE1CA9D97381E,0xAF23F43801038E,0xC6DFCD66B58E45,0x83CFD830317667,0xBDD705A39D2AFC,0xB9F5EB62665941,0x6A93AF075CA46E,0x34E9F7A9E6F971,0x3D},{0x934DB3D4BD9323,0x81AC9173080509,0x6B1F6FFDA0FD21,0xE9978B424ACCA3,0xABDC3FA3D0E789,0x4FE027A26F69D3,0xE370094949C2D5,0x39C31155F7E2F4,0xA658BA4E9E297A,0x17},{0x6FBBC931BA2E78,0x6C0033A8912A01,0x99DEE89CC96402,0xFC801AF6C31B1D,0x145928DAF16E53,0x6DB10BBEA6E09,0xD95847CF0A77BC,0x2CED7E153BA2AE,0xC752695DCF4CF3,0xED}},
+    {{0x752CF7DD063C72,0x7D0F334791587B,0x96DB814EFA5124,0x454298F49443D8,0x80FAC6805489BF,0xB77ADF9BEC60FA,0x341EE702CA42A2,0x8160B768AF6F53,0x80D1B38A0557A8,0xB1},{0x7BD7899CF629C1,0xB05EB4780F1758,0xF9D885E18DE3A9,0x9882182BC37F3F,0x3C39616C8A4614,0x1317A6E0BF199,0x1146E9AD23770B,0x610AACCA0FD28D,0x254B340B2A4352,0x21},{0xF93284CDB0CD51,0xF119E32076A45D,0xE5C2BBC512284D,0xE3864B0DCF5C36,0x2CEFDCE094AF1C,0xF413BA0BDD28A6,0x83B16F4D5D8A23,0x9C7D84A3EDE57A,0x26C7DFB6AA3600,0x4E}},
+    {{0x7A5DA611A18F67,0xF597CFF03ACC2A,0x7D357818220B8A,0x33C779F85372E5,0x12B05587701DE6,0xABF0CFE8453CCA,0x4D248857333A27,0x8F742380D78E81,0xBFBE7EA7FFF7DE,0x36},{0x8A302BCC2A961B,0xDF0DAC2941FFFD,0xEF1CBC9EA2DD94,0x8D6C7210C3ABB8,0x8D263FA7D0A1AE,0x70D1800903C670,0x109FA5B4585C0A,0x63EC5BF2184748,0x171213978D5989,0xC5},{0xA96D770AC51D92,0x2DDF3638C2E8A5,0x444E1B8C7458BC,0x5906F46D4321C9,0x4EB24ED3D0DE8D,0x7D7068BE9EE1AF,0x2EF1280583B6D3,0x8F8CAF1AA9521D,0x9F524071A0CB5E,0xE0}},
+    {{0x7374C67C98C369,0x3393CB11176446,0xED573F947EDFCB,0x7F8422953BAAAB,0x6BCE7AE30ED033,0x6437600F8B7D30,0xAFF01C5FEC34B0,0x59907AC249F972,0xF7F03A496E2F35,0x79},{0x13B2548381A1BE,0x654257718DCE26,0x202911832C79,0x4D3D6C959569C4,0xC004BA2401D57B,0x7F9048B6DEECBE,0xB0740F402E5955,0x7E1BD075CB3759,0x9BB529EEA9DD5,0xD3},{0x440A7B7AFA26B5,0x36A365EF24B425,0x58A695269DDB60,0x50352DE96ABDB9,0xF982640E1BD7BC,0x8F30092DD80147,0x33A6D769621899,0x1381E035E17B2A,0xC5F4DE79459674,0xEA}},
+    {{0xBB7259EC8A601,0xC074250738D651,0x1CCAE730092059,0xB31EAABBA84FF4,0xB683A062BD869C,0x912D336D695D8E,0x572DA76944F613,0x45DC1720515105,0xA23FEFB054E278,0x7D},{0x85819EAE027E37,0xF8320F08E64AC3,0x37AB4336A6D471,0xCFFE13300E5333,0x86F115D2A24187,0x39B57A620C4B8A,0x95DBFFA60035A2,0x29D18C35CCD1CF,0x89862EC9DB197A,0x73},{0x48C71E1179D1F6,0xAEA8EABA58D2D9,0x51FF5944E1B4E9,0x4C2D968FFE5ED8,0xF4686747CB55FD,0xB96A27FF43F998,0x27FE09A9EF8F4D,0x2BFB742461B9C1,0x53C3F17009C1E5,0x19}},
+    {{0x7026BE0ADF18BE,0xE140AE47379B37,0xB16F1B8682C1ED,0x6DA5A742D58E92,0x7B65909A9E7179,0x2ED396442C7423,0xA7318874D9CA7F,0xE2BED6700270EF,0x7B0C3C3138A9C9,0xDF},{0xA050C8BCAA7F32,0x30FAD02A981545,0x7A39411D6FF086,0x8CB6AEE4D738D6,0x6241B51BB513E6,0x6971CCA52F6E6,0xF258D9E95C0485,0xDEA6F275DE9DF2,0x15C4D6793F22B3,0xAD},{0xAD15F33345F4B3,0x7A946298062228,0x93B8BF162ECDFC,0xFAA446D702CB91,0x3E707BF12E4D3E,0x91A35CA6E7AD6A,0x4F1D5BC3E7D1BF,0x2C6FA5DD608177,0xB07F1A2C65B3A,0x15}},
+    {{0xEA2FADA08FB6AA,0x63C677DE41F0AA,0x73D42857231243,0x58E9EA6D3BAB2E,0xC554205A432DDD,0x9D8EF260659C20,0xBD94DF4327A27D,0xE9B239C4D58CDD,0x6A961F356C1EA0,0x45},{0x1D69A0507DCBFD,0x2832F020B54D44,0x2D92B7592C150C,0x1039FA31593C59,0xA06A20AC52FE7,0x54642CBC0C0D67,0xD708DBD4AD67A6,0x5397996AEE4E1A,0x5F650AF3037A21,0xE4},{0x2B283BAF5F4D71,0x378E1D75019447,0xE65280F7A34CD2,0x9B088B02F5199C,0x63C99B2DB548BB,0x1E5EE44D81273,0x461875A5E38C6C,0x31645AB20373AB,0xD67B9FEDE90C00,0x18}},
+    {{0x77A75F4EAB0B97,0x7B293283C4560E,0xE43C6391CC438C,0x59984A08126E7B,0x851BE668BAF9DC,0x8442C3F8AB9529,0xF2A6CD89395930,0x926171AAD30422,0x62ED6304FE3262,0xF2},{0x67C4632CB3FF13,0xAF23FC2F0CD29B,0xDF74D2673E4C55,0xCA46EA5CE074A9,0x611743FDCE6769,0xC381847AF11E0E,0x8DA1424B9C7F8F,0xDAC48BEADB3805,0x35ABEDC519CC77,0x1B},{0x337766670F074C,0x2A8CC62BA7D2E7,0xF8FDE75D02738B,0x34B486E1DC6279,0xC2B8F0BF10990A,0x2E33686812728F,0xD5B87504E2C831,0xE70CB4D9813632,0x4EA0C9D1565FAB,0xDB}},
+    {{0xF0B8FCF5695D84,0x9E00C81B528FF2,0xA068ACB7179810,0x8FC94B7AD070FE,0xD643D3036BB194,0x3F80141D8CF51E,0xAC85386C1DD2B5,0xC0C8F83E25470,0xDA0EB266A98920,0x6C},{0x16CE23E741A7CA,0x4D50F72B84B63,0x555D952C07B73A,0x2D450008E76900,0xC917AEE949D994,0x960F846B1C35F6,0x893B9C441B2B6C,0x334E16159A2611,0x9C16E38AF0719B,0x2},{0xE4533C9CF912A,0xE338CF16DAFE7,0x6AE5660AE3280F,0x49985481A66DD8,0x7EAFD99A8A3690,0x9946E7B7234910,0xCF3B353BBBCC50,0x1DC510F4F8E321,0x4C41765EB2CD66,0x3F}},
+    {{0x6F71BB29FE4D81,0x72934EF334BB59,0x9343CCD01A034,0x1BFF46D661CEBE,0x88F63CA79CC6C8,0x4D95132104071B,0x7F4EEE8D9DB71A,0xA68DE1CAEDAC58,0xD49E836A616AE7,0x11},{0x27C8CABF51B16C,0x8AFABD2CA5149,0x885404434D770,0xF772E8FA11A3DD,0x7DB0DEB8F0ACE1,0x17EFEDAA7A6E97,0x16653EFA0FBA69,0x1E9A3FBCAB243E,0xC4C514ECCEF020,0x8A},{0x15667401F07D62,0x4CF4B2A3C82668,0x6F5874E317BEE3,0xA06C3FE3310ED4,0xEEEAAD002AF75E,0xD4778AC66E985B,0xD3C15427F8C622,0x2E0D5500F68268,0x38E10BE0482144,0xA3}},
+    {{0x4AB83B9C586B61,0x7C14CC0550168D,0x7F98AF8AECC169,0xD38194D8C8FDFF,0x97ADFEAC1185D7,0x4B28746DCE659C,0xD15202F25CC8D1,0xCC2A9FF9BC498E,0xF15929A87B862,0x9B},{0x70F55D89B23B89,0x786FE5D0FCE781,0xFD241FDAB34117,0xDC03F0B657A33D,0x94D33DDE6F216E,0xE4BCE9FFA6385,0x7D7B48B6DDB43E,0xBF9C280DEFD45C,0xBD8C6F6CCFA531,0xE1},{0x61C89E01A92D70,0xDA1DB72F7917B7,0x49CDB1ED3364AA,0xF904A49E38E734,0x3E8CAC11B4A6C6,0x53A37A81B91E67,0x6B2D29101DC241,0xFCACBA4568AB68,0xBC0B98AAFB3AD8,0xE}},
+    {{0xC83A0247F6D474,0x60968E32B6062E,0xFBE7BF8FDEEC8,0x779AD133C50E8C,0xB2833ABD9A37D4,0xA0574EE00E674B,0x9E2B19FE74FD70,0x33F002E3B1F8D9,0x57DB916EE828D0,0xD1},{0xAC0350F8E854D5,0x1B3789CEC70560,0xE1D9C1EA341A18,0xB2612392DE2C87,0xB824FB39CC2805,0xD8B3620373172B,0x62E7F57968FDB3,0x6AE2B8F6E12CFB,0xCF1A24BE4D6A1B,0x33},{0x8A4437EA0C47C7,0x6125C5D1419F59,0xCDB5E0365E3C92,0xC1E6E453F9DA76,0x799F22E8C19A09,0x286D196A324ABD,0x169124FB4991F,0xDEF6A7D9565ADD,0xB5C8FD98094864,0x9F}},
+    {{0x90DA145D6DBA9C,0xF9FAB536BE654,0x5F09AB694404C6,0x36C6B55CFCF2F3,0x59389E22A06A2F,0x9FD219D0A5A8B1,0xBA2A02BFB25406,0xBFE8686108B16A,0x6DCED13FD684,0x83},{0xD6857A4CF147C6,0x4A9609DAF3E014,0xB3BADF10395467,0x364F293EA6F61E,0x43D3205BCB477,0x5AEC7303B97B0C,0xD1BCA5D594A131,0x8AFA1A77B5F8FE,0xBC26070A02C947,0x67},{0x8D7167D4A82B13,0xE664CB5A7A7D77,0xA86A1EBD8B11A0,0x949CF712FB6DE7,0x86710F87D33F47,0x859165B5DA5082,0xBC678ED308CE8,0xE0129568FDC7ED,0x59208C5A60CA9B,0xB1}},
+    {{0x18F973E9DDBD1B,0x5CEC4A87C241F,0x56DFC69D058C48,0xCD968B6BD44184,0xE8A6C65045A3A,0x18937798F7D70F,0x4BA9DF60644CFC,0x48F203491979DB,0xD3E50516FB5409,0xA3},{0xB540DA4400A806,0x4CC19030DD471,0x304D68A537805D,0x52182A85B7CFAD,0x19D842EBD1C9A4,0x3FA594BAEE707C,0x955AF00C59B792,0x43C1215A0C27C5,0x271ACC2203D0E1,0xEC},{0x16A4BE75A62193,0xCBF6FA02F7DC34,0x55833AF3503E68,0x3361895EC8D573,0x7AF2752FD8EBAE,0x298BBF62EFA1E9,0x6F6F0118452265,0xE9C35120CA59E5,0x14A806D70576E9,0xD9}},
+    {{0xFB5B67BDF02046,0xDA5F897D2E5036,0xC82735647CA008,0x50669E0925DFBE,0x1D8E2EB2D7FAEA,0x372EA95B59A2C,0x9E9C1BF869DEF2,0x17D73A327805BF,0xDF56E324BEEEE6,0xA5},{0xB26DE23667E2DF,0xBF6F54B4FB57E9,0x52D77452FAD9FF,0xA65A3C84A7A94A,0x9C7A38C9F18783,0xAF331C7F60C67A,0x7ACDB8EB06A0EB,0xBD4C39E754D2BC,0xE4A8C90F38C19A,0x5B},{0x59C9062468ED50,0x3EF6DBE3038282,0x17FE3D7A95B94A,0x94FCAC7F5F73BA,0x5DAA72B1D5A51F,0x98E25D5D75CACA,0x25D5037461D5EA,0xB7B895DEC02EA8,0x23DF5781B8FD18,0xEE}},
+    {{0x6E0A2814DF7E3F,0xDA53A6655781CA,0x44EB8B2D47C704,0x556AC5646AC6D1,0x417C0564285A8F,0x79EB41E8E2702F,0x1056F409F784C0,0xFF10053B46E24F,0xAF4AB0DC8B7CBE,0x5D},{0xC31A38D6522795,0x9AAA7DB3AF7C7C,0xDB96B947CE09CA,0x9A1C0CD1859016,0xB14BDFD1FB5060,0x93D12E2A0A7DEE,0xB979F4E4E33788,0x4C81223DD7FF85,0x1392B286B1C610,0x4C},{0xCB504F92344DAF,0xC93A7AB7CBFCBA,0x7285E68F13132E,0x390B3BD214C0AA,0xD5AC2C11DF98E,0x48AAD1044B3A14,0xA270FED01A6C19,0x473281B3468209,0xCB31E8E65FF5F9,0x22}},
+    {{0x886D7B574A0DBC,0xBEEF410BED67DB,0x287D3357524EC3,0x9056D7955927C9,0xF52F39486549EB,0xFCEA3378B82830,0x92B59FB37BEA82,0x44BC6F4C0273F2,0x32B094F0BD6DE,0x77},{0x33E4D4D47D9CDF,0xBB29A7EE76E880,0x3752AADE5E2514,0x1A5EFA1E591F62,0xB8FD68DD5A0F40,0x4A10E958C85166,0x2C32CA9C22BD10,0x38CD31CCEE5523,0x923593DCF3CD28,0x47},{0xCD31D23FB676CE,0xEE12B80164285A,0x673439D67173A6,0xE972220852AE3C,0x75681F4071EBD1,0x4652882B09A533,0x5152F6C329F445,0x9A82085A3E8999,0x6685F4344943B,0xB}},
+    {{0xDAE22CFF661125,0x69DE292BF88BF5,0xDBF15FD091778E,0xE02955C0581A84,0x65304BA9C69E80,0xB284E1FE4A3EC8,0x8A32DB9FEE07B5,0x3E66F81B080F79,0x832988797EE1E3,0x22},{0x93307977BCF734,0x143E2646C11D4F,0x854AE0363D32EF,0x4482038A9AC577,0x94FA520D4D0AA4,0xED43A5DD6DA55A,0x6C7744E653399B,0x565A58E6F1BB,0xB67DCA21839065,0xCD},{0xCCA4FC8FBB7707,0xDD970DC77F66DB,0x92C84EA6CE7F6,0xE3EC28428F4B87,0x1D3BC497F10CB0,0x9CC7A50097503D,0x82B327F0080639,0x35653E206A2AAF,0x5E116AFF088D2F,0xA5}},
+    {{0x8453E031255D0,0xEE4791E0DD9301,0x42E1E5E10AF298,0xFEE2869E43ACFC,0x803B1376CFA26C,0x7917B5C79BF235,0x8899EA676FBA8C,0x2C0E48F62E347E,0x97E1B515249233,0x2A},{0xD3EB40711202F1,0x92943BB35A0ACF,0x5B47B72E305A3,0x8EDFDD2CE30BF4,0x5F9067B0EA5BE7,0xBF67499D79467B,0x7E94FBED9E3C15,0x25C54ADB289523,0x2B48B6DD1F0101,0x9},{0xF5109CE1550283,0x795ECF9858BC78,0xD905A69C456FF1,0xD0A90502BAABA6,0xAFFC292750B6F,0x2ABDBF00A06B09,0x2D564BF6D4F12B,0x1E579E9AD82D6C,0x2323297DB4D9CC,0xCA}},
+    {{0xC232A4AA53B475,0xD954529B6FDA43,0x7CCE4DCA7AA8F8,0x5385D0BC855393,0xD4D209C61AA222,0x60ADD827F69B52,0xD55E778B9F043D,0xFD5A4B60EA5B53,0x217FC3369F5F26,0xE1},{0x83DD3B73855563,0xA691E651013976,0x9CC31AF9D359,0xCE7B191E8FF29E,0x897830A5035769,0x83F4D2696F5F6,0x3CF6BEEB297083,0xFEF65881ADC1C,0x521501EE8C60B5,0x70},{0x357E53AE514724,0xA8D13C9597A773,0xB3C26C9D4F82A7,0xD20A9EE160977D,0x821554DFA27B1C,0x395CD9ACC0765C,0x6EB3A1BA07DFB,0x29F1AE3D5E9B26,0xE391E7FC59DB48,0xD5}},
+    {{0xC0A5AE842F2F1C,0xA94D5A193016CC,0xBA36BEAD3F572A,0xE5961F5D642244,0xAF1647E4EDBC51,0x59EBC5B3621C5,0x628E373921014A,0x431AF4D3D78ABA,0x93381050FCA51E,0x58},{0xD8C77D6CCA4EBE,0x85D58BFF9D40AC,0x5CC69776BF9AA2,0x8CB90B7251D7B,0x18D52AE3263095,0x2704BD47AE09C4,0xCB3DCFE8790A97,0x6BA25C5A039B92,0xF7C2F9A9F110D3,0xC9},{0xD73AB8968A801F,0xFAA9123DC0E51E,0xED4EFA5F314843,0x67A4689DBD459C,0x25EDE95EEE3F5A,0x885B024513A080,0x106F8C82859755,0x85670EC73FFD4D,0xE32599E5010424,0xF7}},
+    {{0x428F12B48CA362,0x73DA2B3DAF26DA,0x4574825675EDCC,0x167E74902E83C,0xF53EE5329781E7,0x412B49BB34A994,0x8FF514D4621920,0xF4C150D0BFC64C,0xDAE8FE6D8DAAF6,0xCC},{0x561CB9779FA761,0x62762D31FF6B4C,0x1BC9EC3D38E06C,0x9F107D24727D9,0x9D709BA7EFA121,0xB1E4480BA17BDE,0x928BC7785B876A,0xAF0A97EA92292B,0x40FCB595B5A331,0xC2},{0x56E4EEB7582B23,0x5CD74484909D3E,0x531BB2E25B1B0E,0x549108C7C56C1D,0x38F2B7A459AD54,0x42C935C9B23E8A,0x9B3AA40D811967,0xD5BACA833F933B,0xC82CB1600AC306,0x96}},
+    {{0x3D8AFE0C814AAD,0x4B22B63A5CED50,0x8FB68B62D209D0,0xA179C6F20D70E4,0x4B8C3AA384CD3,0xE642AAE9CE97B2,0xEF6FB14FEBF6B6,0x21C2A6202316C0,0x3A8B7FE27D8923,0x57},{0x9B8EEB562A7D22,0x8C1D9FB033E6A9,0x193831851E1F0C,0x346B54000C2425,0x288900ECCFCECA,0xFE206854E3FF03,0x90B2D6DF887BDC,0xE4BDF22DADFD84,0xDA2B56A745B07B,0xF8},{0x93CC26B889D77A,0x24C4F96F840BE5,0x36B55076E78C90,0x53E7C90C4170F1,0x41289DD56CECEF,0xD8759A63C0AEAA,0xA301B1056B2CB,0xF78CC017680A7D,0x2E0C06E35328D7,0x4A}},
+    {{0x7BBCA91BC818B9,0x5D43E08F6D6ED,0x2E1805C3818FA5,0x1E845116A3F5C0,0x676D269DBA6083,0x6AB3DF85B32E5B,0x15C7B9C7579AE1,0x3DF06E7393386A,0x6F370EB7561C65,0xBA},{0x3982C9827A26E8,0x17AA8FFEBB0428,0xD56A2A6653DFAB,0xF1874FC721E9C9,0xBFC57E1EDAF192,0x9C4DEF7E18D4D9,0x86B49596150274,0x691471E2AE97F,0x67630918DCC042,0x6C},{0x6113D017435434,0x945DD3CD9E8654,0xDF7690C3059C4F,0x1850E448EB54B0,0x92A5F7B667624D,0x8AF9B09CC28C0C,0x1F81C555D20E68,0x67038B2D559A5C,0xCFA22AB92AE7F0,0xB9}},
+    {{0xA7A79EAFF28684,0xF76A8ED464C886,0x2A46D14CB6CC5,0xC79FD554B8EDB0,0xCF98BE6B1460CB,0x24AF466FF253DB,0xBC752C40D2C37F,0x3023E05E701E6E,0xF2AB2E1F8CAF71,0x82},{0xFFF7722AC0D65F,0x32113AC3AA1EB5,0x5A5B627E124213,0x54C73B95B5687E,0xE46DC9483D233E,0x12C2133C7B6B1,0x532AF94703A0F2,0x36CCE0BF53EC4F,0x22D2DB1A12C85C,0x82},{0x519EAB29DE3F7,0x7DC635715CC43D,0xF57C6B4A56F386,0x4F1DA54E5E01D0,0xDC0382B0591063,0x736DF7151E9989,0x8FF70E5352A9C2,0xEB3BEE6F916909,0x46D190481394E5,0xA7}},
+    {{0x7B3A501485AC9B,0x1C5CA438B9C2A,0x23C812F64C61DA,0xC6C2EEB7F8769D,0x128DA3789DCA74,0xD2408D24EDF6F4,0xB74D4B07DB1399,0x5DA83EB4D48FC5,0x14F436346DFCAE,0xD3},{0x4ABFBBA2A02833,0x5ABCBD98AB4DB3,0xD0EB2FB1031E9C,0xA297DFC69DE42F,0xDC60E183E71BF,0x76328F471514E5,0x5CC5B0C95D89F5,0xC8EC35696EE510,0xE7F4A725EA594B,0x85},{0x424A30DF82586A,0x87F05D3251BA52,0x7A9AB1DE59BEA0,0x719821330A996C,0x8F133487D649AD,0xE2C54771920B38,0x114E189254E67C,0x9CCF351DDC0936,0x9C0B3CA1067F2F,0xA6}},
+    {{0x64F191A7CE5DA5,0x858CA0F86FA428,0x3AEC26CE20A8BA,0x91E630C19DFC33,0xD603DC157DAB83,0x6C92BF72EEA0FE,0xBC16ECBD5EB572,0xC7E2737B76CE86,0xFDD1AD5C75AC10,0xBF},{0xAFDDF6D51F99C6,0xE40963BD967ED0,0xA03630B6896567,0x71C41CBDB2535E,0xCE7E622FC3C084,0x39068ED4DF0944,0x5675262BE99DE4,0xFC0B6E96503BE4,0xE6277A5CB666D9,0xC7},{0x67E1135F797218,0xA28F6FC0A4D587,0x9C31C658847D13,0x58878F71E8E10,0xF72B781442D4FD,0x13CAF2E8DD9A3F,0x795941D4F73546,0x4BF3CED6501DBB,0xC08479A131B6C0,0x60}},
+    {{0x625ADD75202305,0x505E10FA89E2C2,0xD18E8C00989DFE,0x175E6299A3ADFE,0x3F1FF605E0416A,0x651499813FFD1A,0xB1A7B93C6243D6,0xC377E43D5804BE,0xC93D0B3ACF502F,0x72},{0x92FF8C204A23CC,0x1C3DAFF5D3AA39,0xDE5985D8EB1047,0x1F8B359ADCF34D,0xB1E68EB7D4719,0x5BA6643D467789,0xCED64CB4FC867,0x9DE33364DFE55,0xAE161E5CC88C9F,0x2A},{0x9529B744EE9BD1,0xD4F728F074142D,0x6477D873F5C3FC,0x432AEA9F44C70,0x72A13446700DE1,0x6246CC5260F07D,0x9781AF6A1D5547,0xF59323967130B5,0xF54112BFB1D17E,0x25}},
+    {{0xC1CE9E39AD6EDD,0x309C6D1C922854,0x71F4F9B0A04FD5,0xF7C2591992A772,0x5CA2643B51E6F,0xE3F3A273ADEB3C,0x4A9CBA9D18EC4F,0x1002DF65D04793,0xF231E470ECE384,0x1A},{0x7C6B475CA30C93,0xFC25DE5B308716,0x7A3B99FD68B994,0x554312841217B,0xD5ACF52001FB28,0xE27E05F1DA0AB4,0x47F5A7A0F27FA,0x500676DC3503E6,0x176CFB0C46D310,0x18},{0x240291615A72FB,0x9F00A69D57A143,0x3E8EF9787D5988,0xEF5A7757767438,0x2D63E9631CE2BF,0x4FF8D9AA02E3F1,0x5E718B3DAD55EE,0xB3AE0C5767CC41,0xBE86401A44C7CE,0x91}},
+    {{0x3DDC60DFB52693,0x77BAA0C627D885,0x80191DFC4980EB,0x4294A7BCB9139,0xCEB91303337AE5,0x3A866CB2BC5C78,0x7BCD04ACA75F27,0x21B2DD8189B77D,0x7631283CC9051F,0x50},{0x31FDA826BB6211,0xC98B80CF7D91E9,0xAA868790E9B6F8,0x51EAF59AB49E49,0xF0AC687424BC9B,0x1D764FDE24F69B,0x65A0A77B6E6E46,0x96A845BD1F7B94,0xFAD134CEDF6CC,0x5A},{0xB2374CBE134A45,0xB2B8E1E588AD3E,0xD5B408D5D1DB61,0xB5192B1A55B50F,0x67BF936451EC31,0x84BCEE8042DD1D,0x4559323406C6DA,0x283C44CB24B9E,0x4AF2F438C2F9D,0x15}},
+    {{0x670AEE0ED09D24,0x10B73544CA340C,0xE6EA73C56193AB,0x2BD8C5F5C750D4,0x4AFDEFFAA58156,0x92CB6400F14346,0x2D6C3919209490,0x35BCEE97305B87,0xC7B5045461A4E9,0xAB},{0xF532FCF125295F,0x7E3F46228AF96A,0x42BA10D34317E2,0xAE097229B18AB3,0x14FF0BD883FABC,0x881AFE7BF830D6,0xF80B183022F48C,0x11F1F0C2706654,0x1B94A4D8FE59E4,0x0},{0x8E20853423B43A,0x81AA014FD58A1E,0xA00ECBAE706BA2,0x1866664B2830D9,0xFDAE0EEA8CE156,0x839E7BFDF9B9FD,0x2BAD81E9A437DC,0x56A23F64EA65D4,0x25268B5758F089,0xFC}},
+    {{0x1538BCE66A02E1,0x4EF8B7877D3471,0xAFD5B735D583C4,0x8ED70434CF0CAD,0xF9A9E6372D98AA,0xBB660CEFABFBDE,0xB548748039419C,0xB20A20BCF68291,0x9B62D10C76C3F8,0xFD},{0xBCD858E8CD89E3,0xAAAFCDB9B11E61,0xBA85B7EB8C4B76,0xA2B7CEA902EF9C,0xF67A61661F727C,0xAB64FB2B5AE80F,0xF7C7209E258A02,0xA2EA679A0A674E,0x8AFAA18E13F3CF,0x1B},{0x2EABC62DAB0F31,0x740F342DF20499,0xBE45ACC4EC3765,0x62ACD6968D8930,0x5B9C499179B248,0x2E70261DF964B5,0xFF6F4E259EA653,0x7F4C3024046988,0x4CE148FEC84329,0xA5}},
+    {{0x316FB03F72667C,0xD9C8AB9C89CF84,0x314A06EDCFA3DB,0x9516D24222018C,0x611BEB3EB99B20,0x511EA73DAB4E46,0x14060BCA410CA5,0xCC25FF5F4951C9,0xCA91CDCA0D989A,0xBD},{0xD5B01CE1950941,0xB412ACF9215C14,0x4BFC29D070FF3C,0x2A3550E1620D05,0x9583DF129C4B6F,0x304392C16D3276,0xB86193EC74B643,0x96D5EC30B743A1,0x2A71BC89C28046,0x1B},{0xDA50DE477EF2A6,0x438E2E1E8ED78F,0x70100DC90986E1,0xE184FF00CBC9B2,0x2E9F76B6172334,0xA14D3A665B628D,0x822ED1C3D40D79,0x1FBFA1F2FF8BFB,0x9D5DA15F5E0C29,0x5C}},
+    {{0xF8DD158301F48B,0xD878408ADF39E2,0x89E7B08B523036,0xB8519D7AC8FD51,0xD3B31A49D8B9B2,0x7B373CD1F07610,0x5B9B7BB046A006,0x3FBD979ACDEE7F,0x3D3F880ADF829F,0x0},{0xC390DFDB5DFCA2,0x1C6DA20CE66420,0x6C98EEFB82DF02,0xD5226A46550AB8,0x4278CFBFCA5430,0xC7C3D627AEF230,0xC7820A74CF3E27,0xE499EE38306914,0x3DD5B68D8FF0C1,0xFA},{0x278096E7099A3D,0x54D3E9755276F3,0x48C8D97A272922,0xA7ABB7983826A9,0xEC9691D0C03553,0x364E5AE00E9EF5,0xAEAF75B9552965,0xB49F2176177E26,0x75C5DB66CEF4C1,0xC2}},
+    {{0xA23322624232A3,0xAE7207EF8365D9,0xA79994DABA728E,0x3836599C690C90,0x95E7EB6233E8B3,0xE2E4E233DD284F,0x249E82953D37B5,0xFE59A81AE70C98,0xB28B84C08E033D,0xCA},{0xD741458F5722DF,0x7390DB2B55D6D6,0xC768CC7381EC3D,0xA65EF6F8D8ACA3,0x409BE849B2A7E2,0x5B0CE2CE051CF6,0xACD7DF0A24CAFC,0x1BF35C324C6EEC,0x9347EA30631C42,0x16},{0x4A7568503CB646,0x55AD83A7502952,0x2B82AF8E7A16FF,0xE08BC7109D586D,0x3814E6CC13945F,0xC0D02011610EA0,0xFAEDAF698545B1,0x2883898484DD4A,0x4F91790ECD3E0,0xA1}},
+    {{0xA9F7540A971160,0x3BBC435907DF9B,0x1AC908BD52E429,0x9F1F583AE7EB5,0xC628320E9FF8DB,0x94D75ACC51468D,0x444DB1E5689245,0xD5485F056A20AC,0x9697AC73553388,0xB1},{0xA28A3A2FCC1062,0x31A6BC7BDC66BC,0xF84F02DC2EDEB4,0x54A32FB7F61397,0x2AF8FB6F875A39,0x79DEA12DC8B5AD,0x95565BC969581,0x43B22DC87EDC8F,0x23B78669ECB0CF,0x31},{0x2854A91C04ACAC,0xF51E8ADA6C4FAD,0x912F78D5CF8282,0x1CAB8A68C88D23,0xB49DD0519468BA,0xE401CD5658E2A6,0xA8806FEEC14589,0x854E9AD1176455,0x8B543A3852132D,0xA3}},
+    {{0x68F82532D180A4,0x2BDF55D27C2D0D,0x803353B93CEA92,0x4C86BC16645D22,0x6F15CDD3428A52,0x5BD6B7E95E4525,0x85CF987FB118DF,0xB86A292982DBDE,0xD96B8E720C1882,0xBF},{0x735CB8FD396094,0x979C5B7179DCA6,0x369761A99A2FB7,0xFE40FF7A828506,0x5FEEEC9FC61102,0xB15761410B7C6C,0x3642C0DD31206B,0x3F75FB7AB010FE,0x46917784C7B520,0x2},{0x7F79AFA7D227F,0x1DD1846503F031,0x3E5DD577630121,0xB6CA941739CBFC,0x7582F87338B295,0x4552C505FCFBEA,0xDF095EECC93241,0xB45EC611FE8775,0xEF04CB0A17B5EA,0xA}},
+    {{0xA09A06B1D8B4A1,0xE745762F8774D2,0x298282FE904E25,0x19001A1A6E411B,0x7E3E4C9043B2DC,0x2E09EF077FA6DB,0x97C311B2376ED5,0x9AC61FBDEA3FAF,0x2F717E4416C315,0x14},{0xE53DB3BFA2772F,0xA4EC98B45DBF44,0x785D4F08B81853,0x48E3C4D50C82FF,0x7CA6187782EF77,0x31AD094B0A22EA,0x140E44DBB28734,0xD30DE9EFCA468C,0xCD1651F80D29CF,0x6E},{0x4882B5EB788F3,0xB1AEE38B9C2D5,0x1FFA5BAC38D483,0x1DB7AAC3D10F90,0x95E67C6073325C,0x1817F53B256C9F,0xA692A042D39145,0x28D0F3577E59FE,0x5064027EEA4F7A,0x5B}},
+    {{0x7A795759E18E73,0xB1D727E716D77D,0xEAEC4F8281FCAE,0xB42AEAF25D4A86,0xDA316420988001,0xE660C0EAD2E1DC,0x80254E757DF55B,0x3BF69340B4EC61,0xBA337F2EEA2120,0xDA},{0x6F5E357E375D51,0xB6090340D15F3,0x493E9FC32274C3,0x1DA2E511423F8B,0xD90448B6DFC6FC,0x4E27C4FAB8D2A6,0x8456B82600895E,0x8B47088967B238,0xF9AED231266F87,0xBF},{0xC3D5083AEE0EBD,0x9AFDE013AC0B74,0x7670285F262D67,0x4BD5500D871336,0x3BF888BA09327,0xD7CB7B11A03741,0xF302EA2BA0B19B,0xB6F29ADA05F13B,0x9B9EF910CBEFCD,0x13}},
+    {{0xD099473BD29E1C,0xACEC869F62C82E,0x41F7A9C4020793,0x2F08613F5ADED9,0x42F186513E5EB7,0x6A768A474201A2,0xFC5AEE948BADD3,0xA882D8F5918920,0xA42B60CE9E1E95,0xE8},{0x537B8EA52A73C1,0xC7656310B73A34,0xC06FF78134DD9D,0xA0F0220CFE7C59,0x9A67F602B1F6F1,0x46E292FDDE0233,0xE9C2042DDA8FFD,0x6EF6470938840D,0x820046A2EFC03C,0x63},{0x34071AE5ACA2E5,0x5F45FF9299424A,0xA5AF8DCB2480C5,0xF145F93A2E05EA,0xD883A30F296519,0xA255280BDAF55B,0xAB216A2B665E29,0x94B1D7EDCBF34F,0xD061D7829F0E26,0x4B}},
+    {{0x3A1634DBD774F0,0x539720679B8A11,0x79B202D9DE1C8D,0x80B98AE2BF46BA,0x218A2F211B5A21,0xDCE5F1F1CB1D5,0xA965A25E50AD89,0x690F2A03384F53,0xC7E073E59B26A,0xB2},{0x51F3A0F4F873C7,0xED5E9B29BBD499,0x1876B5F8D87787,0x46DD0B31332A9A,0x1738E65A2EF74D,0xC6EECAA0973F99,0x4967BF8190F740,0xA8476246DAD1A8,0xFA9896E78BD68E,0xD3},{0x980B4B357D53B6,0x17ED65E19E3C4B,0xFD55A90813CA24,0x1EA305FD29DE9C,0xBF45DDE09FE1A4,0x3F138F2D6C90C2,0x2ADF162290DDE7,0x2CABA58D708558,0xA0A1C8E653DB4,0xDD}},
+    {{0xA5F0E556022093,0xB4D6A339D28B53,0xFE5E73931217FA,0x4695E4F638391F,0xEC657FADE329F3,0x55884E9EF693D0,0x4C62648B3D7570,0x1FE07F7013135,0x65B927B5802D6E,0x88},{0x3C62B2135B4639,0x770CCC11C99926,0x672F3CD22A71E2,0xDD7AB9E9328AC2,0x37CA1F05449D86,0x8F1237BFD3186D,0x6765A96C65C2A0,0x9BC94E8A18E8D7,0x8537E9A694AC85,0x93},{0x270414CF855399,0xAF47A8F3865982,0x9BAA4B412BCD70,0xDF33DA4FDA0BC6,0xA3D61186C21ED3,0x55C9C372007615,0x6A851A803B4306,0xAF52F86DEAEDA1,0xE3ED4771C608FB,0xB9}},
+    {{0x27005DAE8F5C5E,0xFF7B03BADDCE0A,0xB97FEF7FB544C1,0x23C7F0C1661B2D,0xCCD04AF4B54FFF,0x9D8335ED4DEBE4,0xC40FA59F8A4822,0x51040CA13E3818,0x921FAFCCB12DD4,0x16},{0x2C4237DF525B46,0xCE391BD20AF6D6,0xCA4CE1532B789,0x77D4FA72DF5416,0x3214FD266BDE11,0x3B19E01A53BDFF,0x3144DBF4C6ED2B,0xDA8230E5BE9323,0x2BF1EEC57D82,0x8D},{0xFAB3794FD1F5CC,0x28FCE5353227C2,0xD46909614ABD5D,0x883B0BCBD69880,0xEF75612252F424,0xF9DF191D72513D,0x5276DF941B8DDF,0x5B33F7A02C3129,0xB7471722171D7C,0x92}},
+    {{0xA94F7C5245AD8B,0x84935402AD9F63,0xD024DDF8DC731F,0xBB02202EB7C847,0xEE362C3AD87377,0xCAF2139AE74E03,0x722543B6658545,0x5D04D4C618F31C,0xD6E695DD88C02B,0x83},{0x2FC1E40AA8591B,0x37AED4E0598782,0x19E69E942F9661,0x7686D321CE128B,0xA54E0D5849A098,0x13EE4CADC1775A,0x6116B41495908B,0xC7E3645A9BE03E,0x1D1021B37917D6,0x51},{0x7EE6DCC73F97F1,0xA8FD67DB627DB7,0x6429DF44E79F8E,0xE4803CD3B08A5A,0x51C1ED596DD7C6,0x1E6C5F8E60E63,0xFA2DDC2B95DD11,0x4B27D9DB4DD996,0x5ACEE385889323,0xA4}},
+    {{0x4A18CE6D7055B2,0xD12F411A67EE24,0xEEEFD96CD983BC,0x18A020B54AA612,0x6EE11C4899CA87,0x32BC5E818C5C9B,0xECB07D9DFE788C,0x4BB12534ED85E1,0x2D9442EF9907A1,0x6D},{0x8BD9A5C7895EB4,0xDDDDB91A93D899,0x6DE87E77915ED3,0xEEF99D35015C01,0xE57E7383F79A07,0x287C354D691A51,0x628542019061EC,0xA292406C286186,0xC8CFA96996D144,0x48},{0xF0B9CF9A5EF044,0x250C4CD9675AD1,0xC23BAACCF121F2,0xB9AAB3A1980A17,0x53651FCB6C49CB,0x71E7CC419F2937,0x98AAB1A8BB84B2,0xBFB6C0F7BB762E,0x686F960B41B712,0xD3}},
+    {{0xDBD9BA78A38498,0x8E8D6D1E9C16A0,0x734B7FBE4FC4ED,0xDB6D34E858638E,0x4CE0EA1298A813,0x7EE7ECE8FFF43,0xE9FB2499B47316,0xA4311D7EC0501B,0xB0904171450E7E,0x1B},{0x9F8107E5F36573,0x2A26D852D73106,0x83C2EBFB9AC444,0xB743210866CF8C,0x147C124E59DD43,0x1A7F59B52B2F76,0x2572F3AEEC7CD5,0xF2B06A34374020,0x84D4360E51C758,0x65},{0x71B63DA62CD035,0xBDA5F7651D34FB,0x91F511490D0186,0xE5C829D546781E,0x6EAB55122E4B3B,0xA98B8DCA26F68D,0xBD5EC78BA59E89,0x5831B5FE9BC405,0x41B1350EAFC616,0xF}},
+    {{0x46667A3DB1F4F6,0xBE14F6F7B78060,0x153B2B47AC45D0,0xE9ABDB42F820E1,0x1CB4079F609337,0x4883BC58F60D23,0xD80619F9F16C9B,0xB9A9E25A978965,0xC1A80F2723C1D4,0x2},{0xF5585F66CF45B1,0x3C99ECE7F39AED,0x9ECD42B4132A17,0x6EF276EE22C6A4,0xE8F4A66FE3E0FC,0xFBE62E62BF91DF,0x31EB3F2BAFA7AE,0x5D6A8C1B36D68E,0x37B9726EF031AD,0xFA},{0x45ABC4B4BF45EC,0x5D6C05913359D4,0x6B3248D0A114EF,0x5920CCFD2D1927,0x82963E5162631D,0xACDB075EE899C3,0x73B43B24B7551,0x1BC2C0F901949D,0x602281C650E6A1,0x1F}},
+    {{0xD9451DA0069A98,0xC19319555967CF,0xD54ED117D376B9,0xC812301060C911,0x9F7DEF91A65D44,0x82D7FFED49BEEA,0xF039D28A21505C,0x7606796AE486C7,0xF4ECCD0C8AE7FF,0x62},{0x896B9ED15AB379,0x77F98A0119E8F0,0xF6010749F630CF,0x5AAA4C6F2B6632,0x8D2801DFEEC6F9,0x40A55B20E02A84,0xFEA143C51D3046,0x362773FAC230DC,0xFCCE4343578EEE,0x4E},{0x5A5A2773490AA4,0xB0637C17F74489,0xD4276F138DF659,0x757933BEFA6FEF,0x307EAF06B206B2,0x1C4CCBF3175ACD,0x1B360BE6A3BB83,0x88BEF68E989636,0x6FF08F06B8DED0,0x66}},
+    {{0x2C0C61B674D66B,0xC652CFFB835372,0x24ECA6F30DB115,0x604421116455DF,0x9DC3C32CBCCBD8,0x647D47EFB2645C,0x82A1B7CECACB8,0xA319BDEB2CBB65,0x4E3CA70A71417,0xA0},{0x23DB0BFDC21C19,0x861FFD785B7F8A,0xB07D5D6E1E0944,0x4CA036BB71D73C,0x811F9D4585981D,0xAB56FB0D6C681D,0xEC94903A0D8BF2,0xD837FAEDD3C8AF,0x505553D49189BA,0x95},{0xD56A947E156C1,0x34B67979AD0B71,0x52C33755BB4532,0x8E570B736F62BA,0xB060B256979921,0xE0307D4AD56B05,0xE181DDB88AB93D,0xCC8E531B724855,0x9AD7B53AF6C21F,0x5D}},
+    {{0xEE90D1414F9F90,0xCF4039FD304114,0xB5F9573D1241F6,0xEC8E444458CDE4,0xE7F07E7F71D72C,0x843BE5EF4CB097,0xE09077E2C640E5,0x9A5A7A4BA77FB0,0x90199434CE43AF,0xBF},{0xDFA6D822597B9A,0xD428AC1041D2BC,0xF75EC0FAB69AF9,0x7B1F8578D3D567,0xDCFF677937DD32,0x7475A287B8AC88,0x8393EF74FF8F1A,0x1A0B768CB3C4F,0xB07F38EF58F906,0xB1},{0x9DF91D207CAE6F,0x2949302614E87A,0xA09C81D72C6DA6,0x214F0021BB59B4,0x73198EDDE60C5B,0x5C005CA9AD0320,0x97328AF37D7E0B,0x42837821C4EB12,0xF25366995DAE46,0xAE}},
+    {{0x29F5CBD3DAC543,0x96C40139F94D7E,0xBF6DC51E7EA3A2,0x5DFF76C4BBEFF0,0xE34B65FED868C1,0x2B893CEC906551,0x1EC771AE44CC4D,0xEB197DBB02D29,0x874A6A9D7AC3D0,0x24},{0xE34D537E235C52,0xF100601E152FF2,0xA9AF8A6BF8791D,0x37F9853D80EC8,0x923084DA4CB3D4,0xAFA5769FFFA7BD,0x60F8D18C5EE985,0xE606A9D34EFB47,0x9F82D1A88B7E7A,0x8B},{0xBAFAF24E72320B,0x85F634CD397F14,0xCA96E18E65A038,0x32C984A1DC31F8,0x8872E3FFB3FF91,0x76B9170D154406,0x688DAE4F8A333E,0x1B2EFD2EA53FDD,0x4153A8A557CA26,0x50}},
+    {{0x8984851F9FCA64,0x94BA84C3074897,0xC7EAC95E87D488,0x2D42F1620FECAE,0xB42C32F9C3C86B,0xD1B6514A45449D,0xED80C7BAF6A07B,0xADC71C25EB1F8D,0xA6F87B063B93D0,0xF8},{0x4FA14AD579DC43,0x4696F742B01D61,0x4C89A239FB630,0x22ABEF56B4F317,0x2CC7A8503AF6E6,0xBA02F3A10400C8,0xD74886DA3CC6,0xE611076FAEF071,0xCB3A9D1C310250,0xA4},{0x3A583DE827D6A5,0xB2EF377A49AE41,0x3175EF7FDE0D70,0x9D3A2A46101537,0x2EEC82F85C5891,0xA2411F4553757A,0x4FFE9DB18E3F43,0x133EB7018E434C,0x503649D01A8195,0x6E}},
+    {{0x793E4EFE97F1B,0x4D60AFD3411FED,0x5383A7C94468DB,0x4FA5A3002533F2,0xF60D588EEBC00,0x8E29BDA8595DD0,0xAC803184B3C13B,0x626F4BEF6DC4BD,0x2C53DE5A8E226D,0x90},{0xFAE6C6C88FEBF7,0x789B8D4743A2C3,0xC5B94FA9B55021,0x21234A33F1959A,0x47BF93D9714B31,0x8D81AFB0CA14E5,0xC27053C993EA0E,0x1564A2494289AC,0x70F04D2B14DE9E,0x6E},{0x7D7EEAF99F143C,0x6F8F6D250E3458,0x4A025019625225,0xF5EBB46ABB6160,0x5494BFFCCC0BC6,0xD23F93A341F41C,0x68D2E5C0A360B4,0x871A004D464C10,0xB5DF4B277AC37B,0x22}},
+    {{0xA97692B118D86D,0x1B60B43FE12EA6,0x4254989724975B,0xD57BAD1085A3BA,0xCD27FDF58D600C,0x3586732DD6B700,0x21D416686CD566,0xDE0B437B6DF690,0xADD7B0B9CE3544,0xB5},{0x65E7C7314D55F7,0x6449A0C19AD945,0x7D430376B6C6D8,0x7DCFBB95E03F5B,0x1CBF55F33D0A01,0x1089CE1C8205DB,0xE0B2978F9DCCAF,0x61EA3ED13D20CF,0xDD2CCDAF746571,0x20},{0xBDC0E22691AEAB,0xF3671B3F9AD24B,0x455875CB60BD07,0x3D26D1D387D940,0x5A3CEBE96EDBF6,0xA31E76A3FF2B42,0x96D1932AF074B1,0x3281DF9334D48B,0x2C60A843F6C41,0x62}},
+    {{0xAD51B2FC8C1C92,0xD7C0E09752A610,0x91C0D3B23068C,0x220C0D70FA4DBA,0x9F051700F9DC6A,0x1069547515CF5,0xA5D3FA05E9A3C1,0xF99340A9F72B9E,0xE69F2B1609DF58,0xD},{0x98FB361B8208FE,0x21D07565BA41A5,0x2359685853CA89,0x7D65DD6639A1D4,0x4CE0E43A959756,0xDD1695CE541658,0xCC8B47547AC2C6,0x4A948E5EECA216,0xF7326C0689401F,0x4F},{0x2985928B609C69,0xF80CFDF4BD9E28,0x20EAD075818FDA,0x53FE5200045DBB,0x962228937BE56F,0x569C65DFAD52D3,0x84746DE46EFE2F,0x2DF1A26FC51622,0x9475D1DACFAFB8,0xC1}},
+    {{0x96A2EC6C5A2E0E,0x219AD812EB581D,0x77CC3E2A7C90D4,0x4F548F28C7994,0x434CB5B3AE1030,0x77BDF604E00DF,0x6F47E027B00CC0,0xF25EABCCBD92A0,0xD5C9C818A3399,0x9A},{0x4438E766864D04,0x600E0D149F7ED9,0x81513F7E789518,0x3D6243CDE6564B,0x98E0F826FDDEBD,0x71F55961E35646,0xB06BE5CF463560,0x2A91A3B8AADEA,0xDAE80E361C1C0,0xC2},{0xE4AE248477E12D,0x7E008CF2F76D36,0xAE803447DB1047,0xDCD3F76F737551,0x7905EE004A71FB,0x6CDCD32D961652,0xC4D600DD9456DB,0x452B18352E1B5B,0xBB40CE06814E9C,0x48}},
+    {{0x80113803B2D94E,0x3E6DA50CEBF65F,0xFF5E7F275EE39D,0xD4EACA7D3C1AA9,0x7D5F5C9C0BF22D,0x72CDD02A0A615F,0xC12DCAB31BFE69,0xE306569CFBD660,0xB33795DF1B423C,0x1A},{0x4C94D72782169B,0x8EA1D0B54FD760,0xBD7331CAB67236,0x9DDCBA180C378A,0xE6161B5B29DD35,0xB7B589C3588B0B,0x6A38A817CE3728,0x4D974561A1408F,0xECDDFA1E39DAB9,0xF3},{0x9459DB496557CE,0xC384C54BA29FEA,0x57C55822DDB601,0x18C46C28090B5C,0xEDE8291C1A30C3,0x8271EB0062DC75,0x5484A3D9F581D7,0xDD37902726A51C,0x7CCE678C2D4BFA,0x9F}},
+    {{0x26C791B6BE605A,0x7EDF4A764BD215,0x370E64124A65E9,0x11C7279C4578B2,0x6024A551766C08,0x52BC086A702F23,0x2A794CFAF73F03,0x449AC6B29B1AAA,0x583D0946B1EAC2,0xC5},{0x47AE3D3B484C28,0x4B682F4D87D8BC,0x5360070C5DAC4C,0x5250CCB5F77CDF,0x580B851DF05ED0,0xE1FF8B151A32A9,0xFA41E092A9F5B8,0x254F13BF1B1A2E,0x6AFA344EC06813,0x0},{0xBDE015D729E50,0x6C4C1FEC15BB33,0xA9EAEEBB1AD480,0xBFC1EE96166363,0xE068DBE8340BB2,0x8954F0A1A791F6,0xC0CCBBE86F675F,0x3426263549139E,0x88D7C01255381B,0x35}},
+    {{0xB3F71C7BABAD7E,0x6B2EDF6D363D78,0xAA72BD933E351E,0x8788AB6C713E15,0xDDDB0F76945127,0x8C23776F625763,0xAB65BFEF1CCAD5,0x921CDB8A9A79F7,0x69922C5EAC4F9D,0x99},{0x97805F9119613E,0xBC9465232F8055,0x31691B2B587DC4,0x82546FBE4DA6B0,0x5FF6A12189B663,0xA702A52A79A392,0xA9F63E2BB555BA,0x75DB71ED66980D,0xF30BFF76A64678,0x7},{0x356E82174796CC,0x89CA18F07B0295,0x939761A8C2BFC3,0x199F85DD187F70,0xA5B83138FDB8C1,0xE2C83A3DD9D1DA,0xA5CDA86C02D947,0xD8F3EFCCF293D1,0x185B8477D0DF1B,0xA7}},
+    {{0xECA781B664E300,0x8177A7FFDE764A,0x68C719A78AD4E0,0x6E0922BBC10A56,0xFE6377ED2FD5D3,0xA1A08291F06AF5,0x53DF1BAB947D6E,0xCEE37117A77A7E,0x851B4358F38A30,0x79},{0x37048B004C5853,0x69A437526FF249,0x6C0E6A37AAA4F3,0xCC59E943EA2BE4,0x4F8CF16987BA6E,0x2390194C67838A,0x1E9E668AB73234,0x4DE6719FD70C98,0xA57AAE39A8B72,0xCF},{0xD14EC629A1702,0x4159B5ACC32AD9,0x1129FDB0999623,0xCB0DFB5F643F4F,0x3C1A87C14D19DD,0xB3A0F9AAFCA960,0x498886B5C8BADE,0x7D34D51E797D0D,0xA4DE476476B438,0xC0}},
+    {{0xDC0F90C05F11E7,0x76F411B23DFFB0,0xA29092427B162A,0xF890FECEBD8FBF,0x1FA519A8300F7,0x29D4800BC78569,0xAD920AAFCC9A16,0xAC6EBC47F5161D,0x37FA266AC50A6B,0x40},{0x4B9D8AB05DD29F,0x8D82A32F6FDF2B,0xF48487F388CCEC,0x6FAA4AEE1ADA85,0x8D7005AC9ECE5D,0xDB60A2EEB4D872,0x4ED6A76D8C66FE,0xBB8E7A3209BF44,0x664DC526CB7DBF,0xD9},{0xB07788C3C982E8,0x82073A53008287,0x8E6F978BF423F5,0x443E8DB5AA257C,0xCDF1ECE002C1C4,0x5060FA275ED353,0x2BC5C63DF76BBA,0xCC6579E2F8ABC5,0x6C08C9A2B916D9,0x1B}},
+    {{0x5FA93DE597F25D,0xFA8C4DB676F5AB,0x1887BDA2B1B441,0x2659FAE1ACD77,0x2FE8DF6B14E321,0xB5D695E3B9CC5B,0x6A410B6D0C9E5C,0x727241215E832B,0x8683ADBB9226EF,0x69},{0x2ECFA9D600D6A9,0x48828241EAA73F,0x1BF985A92CBB2A,0x3BB38DD31E4FF0,0xEEC57D2264254,0x8FBE8A07C97836,0xD1C01974B0A37,0x3A72A5436BC086,0x1EE953AC3ECBE4,0x2},{0xBB56892B59862F,0xF1125901A3E55A,0xA238322B50ACE8,0x2BD45FBE19551B,0xA3C0FF45E7A865,0x92F0EB0B41AB1B,0xCEEE47E21BA123,0x9654B3D9C36220,0x9D90C290183B0E,0xD7}},
+    {{0x31E9987EDA6BF6,0x75A12647985E9E,0x4EA97F443A5A1A,0x47580DF6CD857C,0x4AEE6BFA9821CF,0x81EA51AD39A68F,0xC50AAA8BE3A020,0x2CC76C5B6E5FAB,0x1DB58D0E6D1308,0x52},{0xCA871448C65CB1,0xB99B9F65AA07D5,0x28898845789FBB,0x791071F1D8DE63,0xAAB7E4DD5AA3A0,0xDEE46F343B7A9B,0x9F0D552CE9A7AF,0x98E87C6E766418,0xFCD50C0BFF1BB6,0x57},{0x33FAC555355F29,0xEBF6D6E0D43566,0xEF8150C0FBC641,0x2F2E4C6FC1F158,0x30D49DC5520CCA,0xF3E16F90372276,0x4042118ABF578,0xEC68A17703C857,0xBCAE5C077E30F2,0x42}},
+    {{0xEDC2A5D6A328B9,0x4E159C315FFEB4,0x34B35085C0E621,0x7579CAF73E3A8A,0x48C24FB65C2A2E,0x5C1E6658CFE5FA,0x9A804B49977563,0xBC5FAB41AF54C4,0x9598E2E3AC1C75,0xFA},{0xC73605AB30EE17,0x9ED640CB91F3E,0xBCBA7FC27CD870,0x803494678934FD,0x8701C407DD4D71,0x3506E298E0B5B1,0x3911ED0F202540,0xB6FD2C98B8DD02,0xFD79076536BFC9,0xFB},{0xBD6AC7D19E239F,0xA451C4363F456D,0x9578CBD0030E84,0xAFC6DF59B0384B,0x1961B73322BD80,0x64527A36BD553,0xA33C1BD2F305DF,0xCE0AA141095E58,0xB7D0DA8AB4E3DC,0x58}},
+    {{0x27D82D3DDC7B3B,0xD3D08DCAEF53A0,0x478C4DC775C4A2,0x73F2FB14612089,0x8AF9D997D93306,0x83E6F198BF0332,0x6545C46BEF3A64,0xFCA4484432DBEE,0x22022202F0A7FB,0x6E},{0x9D739B9CD4B6BC,0x873C0F6954BA87,0x7858949B683F99,0x4E45C7B3462808,0xA4A71A110810A3,0x629507BFF42CC3,0xC36438A7B4BA44,0x55747497DF64F9,0xD378CA946C53A7,0xEF},{0x7B4B5A61C824BF,0x88E23B5C1CCEED,0x4A3FB162106A2B,0x5541BEF5CF0530,0xE79F7F0D2A37AC,0x605AF39529868D,0xFBD701DBE48ECF,0xA588E068B5AFFE,0x50E186DAF116F0,0x0}},
+    {{0xCA4B51701A6002,0x4DEE23059576CF,0xDA83C84B034D7E,0x389294AE81573,0xA8D051A86B3826,0xBA0E754F217EC9,0x6D873EC84D47DE,0x92777E1520411E,0x2BF62168F7D1B4,0xB5},{0x35C5D8C6B0D720,0xDA5BE2358DA9CE,0x7452EA29FAB6A,0xC6FFC17178E3F3,0xEE8E2555BFF0CF,0x995549BFA74361,0xB385082A78BD58,0x91ADC0E017E636,0xA0D49BC10E7B70,0x74},{0xF6E793F9A7C92A,0x7838F46A384148,0x3BE269C7E2090B,0xC1D1840C8DF40F,0xC530E981006FFA,0xB3A6B30013CEDB,0xCB7A568C7A4CF8,0xAD2D891089E1A9,0x834EFE5411BABE,0xC0}},
+    {{0x4D9F1255D03271,0xA03E10CBA0EB7A,0x40D03D7C1FC3C1,0x7373004F448FB,0x89E4B5685E46B9,0xF9FB08502A7C5A,0x56641E38AF3DD6,0x3B06DA987EEC53,0xFD44F740934814,0x9C},{0xED568DA7E2C0B9,0xE0FCF857D36BC1,0x207077E9D12CE5,0x166B100782BE27,0xDE764E44F0F59D,0x86BBB29F9473CB,0xE754B2F2D30B0A,0x75A95A90021419,0x40588E2F1C092C,0x29},{0x6CECE071EDC768,0x8EBD60B401C1ED,0xD0010EEC91458,0xBC6452C963134B,0xA47C8DE97393D,0xF81DFAE5C2A645,0xD94399CE3B7E6,0xD54850E7D28741,0xDB941FE924F63D,0x19}},
+    {{0x11B437B049EF8B,0x6CB8E740B2882F,0xD29C5FFFEA9D87,0x2AE749266BE941,0xEA40D7D7DE95EC,0x48DBA7CF057F55,0x6988774778EF18,0xA5B0FB27E03C3,0x7B1B521ABA0F8F,0x71},{0x347B9CF5DADC4,0x2E18D29B989B00,0x85A07010DE7147,0xFD8D0373E53242,0xDF58CE351C2A45,0xFD46817068916F,0x2831405D9465CE,0x721EC6021FD218,0x38B66B3F81872,0xE2},{0x7C56529C8A2813,0xAF6CA6847C28CB,0xBF36578E239D2,0x6D2A517E3CED33,0x158338F1F4D0BF,0x5927CF96FD4AE1,0xBFE913BCF30655,0x2AA2CDBF112EBF,0x67E12078D65B32,0xB}},
+    {{0x3951C2179A5090,0xA693E7A84E8957,0xAE5288330E6B7C,0x4BE859572299CD,0x7321F0DDB0BA27,0x26C0CC2464054E,0x3E0567750F4D81,0x510BA97D498C94,0x4A0994B19DF7A1,0x71},{0x6A81BBEA6EDF98,0xB42FE11C425260,0xC3A5F7F2B99BC3,0x9AECF8D581EA6F,0x9A2D55D162E038,0x30AAD146F479F3,0xE2D52539DF31EB,0x44866553CD1765,0x4825ED393303BA,0x80},{0x466C3D29259CBE,0xAEE5AF00A396D7,0xCDF22616F3A3F1,0xA3E47ECA022193,0xFBCEDC04E29E1B,0x4250B206DC9A86,0xF0D23A7DE18E3B,0x64F212DEBD4C83,0xA2E86A1D93DD82,0x54}},
+    {{0xDF45E6E8A49510,0x6B2EDFBF0C1724,0xD0DDE931CD5685,0xE62997F974D150,0x73FFC427A6BA1F,0x468D288BAB2857,0x93CB2B5097C2A9,0xBDF44AF6A9B2FE,0xFC00E161D9524B,0x9F},{0x9F0EB698B4455F,0x7272C3500A66FE,0x7AD2598BC8FF5A,0x88861179989BF8,0xF70F53DDEED895,0x21658F4A751112,0xD9C664B4A8F5E0,0xC81162B6AD7100,0xC18A7A72C02481,0x72},{0x7E273451172F80,0xBC66ED2F956F26,0x5F23D7CA0405BF,0xF807F0C0DDB096,0x1B47E034C43FE6,0x43725EB20718B7,0x573947FE5092B5,0x9C9BEDA30E8AB8,0x5749A5D301C86,0x12}},
+    {{0x31D372F58C0E5B,0x30004C886EA03A,0x479260477FF59E,0x57AFCFFF271F9C,0x34DEB1851668D6,0x3210B7533FBE9D,0xD4E92C32C3F461,0xFB66DFB5D3B988,0xD7902E2E8E83CC,0xC4},{0x966A184D6E5CA1,0xB8799795F2C3CB,0xA90601FAB1F3E6,0x1F6ABAF953AD6D,0xC0AC01DD7ADCAC,0xB17359AFAB07B7,0x465E4D2CB1C48,0x34A96BA81B0AA2,0x194F04F626E082,0xE9},{0xCD1D768678BAD4,0x3BFEF69CF953E1,0xE3C90F26896052,0x37D87689A3A66A,0xA72673C6D529D,0x8C5A763C34DF80,0xD13D0A5E2753FC,0xC945A645C5409D,0xC317CF5C37509,0xAC}},
+    {{0x317AFD4F9A35F,0x1D156AF8A50857,0x65C016CF1B9738,0x35660CE463F5EF,0xBE592F134B0946,0x110CB3DBD7C0B5,0x776304D7158006,0xC0A4D0E21A79C,0xEFEF1C2C4D5F5,0x52},{0xAEF59DA8704A4C,0xBD42D4641DF8D5,0x39A4DE352386DC,0xBBE6B482614DFD,0x2C24EFA4B9D6D,0xA945F280CFD572,0x68A11B5D54FA81,0xDADA58ED978092,0x69069C2EA67A1C,0xA6},{0x1177ED9DDC599C,0xF374A96B94F881,0xFD74F335D43738,0x7A348735475415,0x23B6BB9237C68D,0xC7C633FBF7C3DB,0x7B8FE9E12ABEE4,0x57913C20F9F013,0x3531B38740094B,0xBA}},
+    {{0xCA4A0D5F8B08D5,0x6EF00E2361282A,0x18CBF1229364F7,0xF9624A0796466A,0xC06D765EAF1145,0x5B215FC1BE9812,0xD32A234959245D,0xF78C1C6B8E202A,0x4BD60740EC37B7,0x1D},{0x326C2EC0E72121,0xA73327D9ABFBDA,0xCF5DE3D7CC9292,0x1D07233D420E66,0xAC4EAA81194386,0xE233994CAD4127,0x805981EEB1B7F1,0x7505F5B1394789,0xC8B6D1843062CA,0xFE},{0xA7679B2A6DF07C,0xA2D257C7B4FA2C,0xA684F75E020D8D,0x145E5BB2DEBD6E,0xEDBD22A3140411,0xB1C52508E7B3F9,0xE1C4028AC3FA34,0x219A4E89B08FDA,0x40C652ADB2E3A3,0x2B}},
+    {{0xF5595CDBCD48A6,0xF65CED5163C55A,0x2A7F02DFF010E,0xB290B45FF10A4F,0x5DB3F2AAF7BBE5,0x87BE27C0E07F54,0x15A4D4E45BC1B6,0xD133465EBC9CCB,0x9AEA2B2B751B04,0xCE},{0xE0E1AB83E56401,0x79D9C6018980A0,0xD5CAE7F825028C,0xBD362E3EBB2DB4,0xBE3176D6354AD9,0xA21279526C892,0x3928AD93028D91,0x2D58BEA7563E40,0x6E2FCBD13CDF75,0xC1},{0x9A46BC346E8F,0x57A4B49BCADE2,0xF48B544986F9A4,0x6602C70C584AE6,0xADE94650641071,0x2865B58CD8EECC,0xCAA67E46131DDC,0xAE2A92FB4748AD,0x12E40BB2328D06,0xFF}},
+    {{0x562994BADCF1E4,0x157ADAA1EA01B7,0xFE1E8A56B88A68,0xB8D9F747C930F6,0x102A463FBCFB10,0x4B1EB830F68F28,0xF70E6C20FA7415,0xB1D78C455146DD,0xEDCC5A55114082,0x13},{0x9DEA8186DE4870,0x161826007B80B0,0x57855AE9DC007E,0x3654B357C53F3C,0xFC5AFD3EC7EAC3,0xD0F8C1B52F0178,0x782677748AF3DF,0x5BA85C5CE1164E,0xAC5B7C4FE24B9F,0x29},{0xEA25032E4F0714,0x78D6D9FFEBDED2,0x1966F0AF79224C,0x73C8AB364BF37D,0xB74D14100736E,0x1D817085074A37,0xBB432C946CA1D6,0x26AE716BEECDE0,0xCD2A7BF3109BA0,0x71}},
+    {{0x3750B3EEA899CE,0x7AA0CA008B9CAE,0x3FECC6560B01ED,0xC18E8830F9EDA,0x807D451CEC9AF9,0xE84A1273FC6C57,0x45992B9B1305BC,0x152E43DB03E3DF,0xAA5E6C3F2CFB69,0xBE},{0x6D5CD189AC928B,0x7A6F65AA0DD4D3,0x81966BEAF054EE,0xB9146480ED3495,0xB0F03B100F6200,0x7F38706F5024EE,0x86C7C03E02525E,0xD7FE432FDCC45F,0x62C9644D97C05B,0x14},{0xED6CE154B293A4,0xCB4D47C0920E26,0x5B7B86A975CEA0,0xC5F7C14C5AF269,0xA9F33B7F86BD88,0xE42C8C4EAC56A,0x6690B180009F12,0xB2FD3F159004A7,0xF0E626713EBCE4,0xEE}},
+    {{0x1F92D03494A3F6,0xD0A0CD3B4DAE17,0x156C98C3860A69,0x75B57375AC98E9,0xA1446AB9165AE9,0xA81C1BD4EC2288,0x9F45A64BA11EDB,0xF27D098BB64BC3,0x56465D2B7A8B6E,0xF},{0xAC42BCECD50009,0x2BCC58EE2A9623,0x9EB5C2426EC156,0x4D2E3D9E992548,0x7E4BE5B1CEDBC3,0x84AF4B64BB0953,0x4C289AAD6CE8AB,0x5D0F56C7F0B796,0x188BAF11CCEC6C,0xAD},{0xA39648EDD3B243,0xD162A0E4932E15,0x2667E99A5075A3,0x812A8D6169D563,0x8084D321255885,0xC93563DE678B5A,0xA4933D975F3FB0,0x70115B1AEC8BB1,0xF81508CA0D61D1,0xC7}},
+    {{0x98CE0A4BF47595,0xF27813114BF909,0xED776D08EC0994,0xD07186B6A53951,0x4F19D0098325CB,0x80F1CB76066420,0x6B8734509E4D31,0x788BC045C82527,0xC3A596510C86DA,0x68},{0xD4EA6230E1E07A,0xD77FF66505AFF3,0x1D4B7328868E55,0x22A55B718C10D7,0xF89455B272E436,0xF435FAB56CAD39,0xD11CC249655EC4,0x8E7DAD79731EF7,0xC2667B1C34B6A1,0xEC},{0x1B960476EDC5DE,0x518D0F995CFE00,0x8D801AF0DC55B2,0x2A8ACC4ABA4301,0x9003197BD7B2E,0x330F53E3FE1E97,0x62CD9ACBA3EB0F,0x3A110BCCB33DA2,0x2203BA1D74EDA0,0x74}},
+    {{0x1D0C4E9E65A5F6,0x6FA393F2A4CF31,0x3941FF12EB74A6,0x6BAF37C2713AC8,0x9017ED61703F40,0xC1424900E65A06,0x452A17ADFFAA07,0xCB542C2A99C3D1,0x8CB26F319AEE4A,0xD2},{0x2D33BC3E44F7F2,0x67F27B7C02F76B,0xDF22C73F97DC6,0xD6DA0674CA0CCD,0xB4D105276F69A8,0xC1B306B2E57891,0x9A5CE260EBF224,0x4F40B311F45172,0x6A0F03A06BCD6D,0x9B},{0x50F9764D7F79D6,0x2F0594D51A2445,0xB007593B7CE614,0x72CA7460D2BE7D,0xBF5212B1D4EE48,0xB4553E0D35318,0x24D1CDEE74F430,0xCF7721790C3C83,0x4FD5DCCF190355,0x6A}},
+    {{0x58C3F29EEF7FBD,0xEFE46A3E467BD2,0x20A409ACE25FE9,0xF53DB1CD72A952,0xE1303D5DC75CE4,0xFA48C2BE4EF3A1,0xC47E38FB8D01FF,0xB76BF7A626FA24,0xB1B9A4946D8AFB,0x9D},{0x6719C5F5617F75,0xE5463CC94E48AE,0x673778D7BE0C8E,0x63FE2594C74D8B,0x1EBA03D9E8734,0x4AB2789649FF7C,0x708B98A9F66F5C,0x845F54CAB79800,0xAB83FD37D250D3,0x1F},{0x35FEB6FC52D1BB,0x90D1667644BAE9,0x9763120A3F9992,0x3A1E62F8AEF90C,0x82539B3F92487D,0xC2F66312468B99,0xCC39E69A0E2F94,0x9610C78EC7E032,0x705D44D61353E2,0x3F}},
+    {{0x67A71B267F9585,0x3E1FA45AFBCFD1,0x437A5AB9092E9F,0xEE8AD9AD3C76C1,0x5040FB2F42761D,0x916F5FC5FFF44C,0xF73627B9D2C7D8,0x4B44EFF2470EF9,0x8858CD51BEC2B6,0xE1},{0x5EC3C47D907170,0xE09CF663A8D3B6,0xD9548B162B1A1C,0x2A91DC5191495C,0x8AA7A66C07302E,0xB8A8F1B2C37BAB,0xC8A27B1BD9E9BA,0x72984B256D2AED,0x1FBFCC5D55C6DF,0x19},{0xF6A907B7DE4C4F,0xA09EBB563BF178,0xF56805226EC6EE,0x57CE4F133A53D0,0x75A49642E62E9F,0xD5181315DD63E9,0x840DC7A3C38F2F,0x16E113E5D26CAC,0xF31801E0502E1A,0x91}},
+    {{0x14411B459DF046,0x3E3E10FD37F292,0xA7CDC0B7B96A3B,0x60F9AE7A5C5EBC,0xA9A85F83B03BA2,0x19B5D856079484,0xC4522334D79CF6,0x918D9D6FA8504C,0x9C227C3C76EDDE,0x2D},{0x38EB5D85974509,0x51A6810308C0C8,0x4FF64D4465CE7,0x1987EACAFCA191,0xDAADBFAC5D61E7,0xFA275B8454712C,0xAA9394D08EDFA4,0xBD1C2F66470895,0x4449DB3BB8293A,0x50},{0x6CAACA66CE6800,0xE357AF8290DFF6,0x36016E3AFA7819,0xFBCD4ABA67F53B,0x8DEC9FA8EE97F,0xDA4BC58C29F9D7,0xB5AEB3C63895DE,0xDCEE88EE404DA6,0x223825D759A08F,0x4E}},
+    {{0xD2DDC9FF329C77,0x2A406A99F7FEC7,0x3232D24A98A88B,0xE261D86D4940C7,0x7DAD6F0D79DA37,0xA6D5A36AE5A0CD,0xC03E66BC8940FB,0xAFB41745DC8FA0,0xF54A983A706A37,0xC3},{0x5CAB5C0F1FDA5E,0x4538157E3B8AE6,0x1F5B31E966A0F1,0xBA90109660A811,0xA698FA68DB6D08,0xE62BB71EABA4FC,0xDA59D78D1B5AA6,0x5BBCDBD036C6DC,0x831FE109406CD7,0x9A},{0xB6A1626E325E8F,0x1FBBA8A06BFA4E,0x37657E7BD65CA6,0xB93740472F4149,0x4F955D8E94AB40,0xEDB61BE949BEF9,0x916A060B8E8A9F,0x5778C3F3B4AD11,0xA045D660D3FDE,0x2}},
+    {{0x6E7B7A914795A7,0xA283711A90D974,0xB71FE87766D13C,0xB7B40CC6B5B4E6,0x30EDED36E2C997,0xE0F619FDCFFDAA,0x4FEDDDF7FCE5E9,0x33F205AEA66F7F,0xEC6C7F0636B293,0x98},{0x44D90612F61B7E,0xD3A34B08B3EA5D,0x2F0FED89F95275,0x3E1206F4D4A9EB,0x60AD0C2EF4F91C,0x77808F20484FA7,0xC9B1D1470A2CFA,0xB48010FA18343E,0xF8D5D94AF03747,0x7E},{0x54C1001F84CCE6,0x243B181795E7B9,0x4A8432E08B1EDC,0xEAA8FD5E073E8A,0x204550B3C6ACB0,0x3DAE545F77BC2F,0x2DA477A590B58A,0xF976FFC4FFE7B4,0x5D1BACF4F259CD,0x6F}},
+    {{0x1C10CC18432449,0x99BD0C24485AA0,0xDDDEDEBAFEB534,0x63DD836C57E662,0xF4AEDA482D8F41,0x949DDFBF731995,0xF343C615A8073F,0x5C7E6FB4E9DDEE,0xD496E609044C38,0x42},{0xFFDFD0775D19A3,0x6F9E71D3DE8909,0x1601584E1A5D14,0xA6D3BDB9E35A44,0xED1300D719900C,0xB27681878C936,0x1B7D998A3AD3FE,0xF3CB51A6E55654,0x6D87691FC9138B,0xA5},{0xCF0665E9EC1D36,0x64A26DD096205D,0x5064BD88558001,0xC8716523C29146,0x8C51B3B5B4C4CA,0xBB1DED85676583,0x3381FBF02D622D,0x970CF69CF94406,0xA2BB692779F4B2,0x52}},
+    {{0xABBA44F7EAB3CC,0xBDFC32B02135FF,0xEB36A3B32BFFE9,0x190F1B712A29BE,0x9D7AD54B32C30C,0x4CFC541170E804,0x939D7F57740900,0x8392BB6A748940,0xD9DD64E4BE0D51,0xA2},{0xC9E411F83A3069,0xF3B3DC9F450843,0xB89CEC7483CFDA,0xE103BE1BAC456B,0xBA5C82431C8FB6,0x9C5F5027B79BBF,0xF06B5EC2D116C,0x8DDD420100561F,0xB8C14D5D36B33E,0xB9},{0xEA44E74B80F874,0x3830DCF897E1AB,0xEFFA949217B24C,0x88354316D0CAA3,0xE6D258A4BCFFBE,0xE3A0F7913F09DE,0x35A99A2CD23EDB,0x45972678507AB2,0xD752D907DCEDC0,0xEC}},
+    {{0x9FB716FB86F050,0x365004F82F9D76,0x29B25F812F6CAD,0xD6DA709467F6F0,0xF9016FAD5445B5,0x9CE116FF7294CB,0x4302E3450DD6C7,0x5D4F1FFD16E86C,0xF109BBA99E6FFE,0xFC},{0x83D5533AAF9746,0x7BE1907E78B995,0x91992C3BF5296A,0xCEB7C24475E068,0x10EA9D2CECC656,0x16BDFACB509C6A,0x2B7EFFFD0E5442,0xCE40A0FF92DF99,0xA13A306476947A,0xC0},{0x414EAB07F696D2,0x5B1C892DCDD92C,0x237E2935637CA1,0x380B255299BDDB,0x1B46252780E74E,0xDE71120FAD90FC,0x79EC620E527A33,0x14A5B675ACF4EB,0x596969A896AEC0,0x75}},
+    {{0xB477CD6793698D,0xD0663A6D9634F2,0xCE2B9DD7CF42EE,0xD06CF463A7E4F2,0x473EC2FB228395,0xDF364842B3A102,0xB3E41D4A09A463,0x73E921C0720CE,0x1541033E42A1AE,0x17},{0xA6949125F07DA8,0xA3C2E0AAD53E80,0x6C6D72F71E2A75,0x7A64790657D4FA,0x7DFC25C7CEB22C,0x1AB9292DF42F7C,0x9615664BE67FD4,0x1553F2AD5EB6C,0x2D4E2D4AEF74F3,0xF0},{0x22DF478E113066,0x5E7412F6532106,0x4071A8CC4477C4,0x240D8247C7F79D,0xCB1FD4B288A5B9,0x29840D40F340D1,0x405C55F89DEDB2,0xC3D0D28B0E2BEF,0x3E1BCBBC116D91,0x66}},
+    {{0xDCE72B56D9B1EE,0x9C4D59B3A200F3,0x2F1F9CECFF19C3,0xFB7DF35434A256,0x7F2145269105D4,0x4A93275C028650,0xD2E0815661E425,0xC0B774C856A9FD,0x38B1B250F5A295,0x5D},{0xB9561A540D43CF,0xCE6F60F4B787AB,0xD12B5F34375D85,0xFCB4329903EE0B,0x5256FF64B57BC8,0xEDC734412FEBCC,0xFB2DF72CE3C824,0x9D8E9A6EE4322B,0x57D824020EE71D,0x2E},{0x323A4980397556,0xC8A7720E723152,0xC690FD04E50383,0x8C011DA69026F9,0x247CF1758ED6C1,0x74ED7D24DA6DCB,0x4E2E45670969C1,0xD88FBD882A7662,0x217B5F0FCAD336,0x60}},
+    {{0xBD7AF094193F47,0x22796044038367,0x82B0FB48B19F89,0x98FF5E444112B7,0x5CF2DF23796F0A,0x6128A85D0B0123,0x95D6ACE3D55ECB,0xB53A0F6A42727B,0x5E376083877167,0x78},{0x9A18F79461D106,0xBDB5334E674969,0x2CAE5343910490,0x9B80AA6A213A94,0x591515B3EB2844,0xA8BB5AB31473FC,0xC8A33346CEA948,0xD869E005E266AD,0xBA52D25E2B19DA,0x10},{0x9CEB5334DC7597,0xFEFA22EC54A247,0xC55A983B3E7F67,0x6006EF72B2B9F2,0x3D84AB13CB17CD,0x128D7CE6B33323,0xBD4F3B5CCFE260,0x120F4C2B4A3AFD,0xF6E763598DED67,0xB0}},
+    {{0x5A53F8D1E84FD3,0xF919F163C36C62,0xB54F9FCAF69E96,0x8C0D19C56089A8,0x53C69099D55062,0xC5F36E6085FE18,0x6F03587B34C18,0x9A70BDE2F3C73E,0xF8F1DAF53A89EE,0x53},{0x354DE922BC4C3,0xDA76041863E44D,0x7F7241DFAAD64D,0x63A7169D35785D,0x795308A127561,0xE3710338860A3B,0xDED34E76C010E3,0x8C6B06DAD96A84,0x4BA43438101A94,0x95},{0x1D527C68ED69BB,0x9E3B9781271A8C,0x2D93AF73206936,0xA95C87589809A8,0x2AF65FC9E00945,0x9D84567B1D5282,0xB974F359E5C858,0x763AF77E50DA60,0xE27DE75239ED18,0x99}},
+    {{0x77194F375A1B3D,0x1CD372213EC7B9,0x64CA5FCAC08931,0xD3F212DCBDDDDA,0xF2CA3B1B0A7872,0xF7C3C7765B8E78,0x390CE447368D72,0xEF5273F10332E2,0x4A3BD48AD25445,0xCD},{0xC09FF18947A8D2,0x5F16127EA7472C,0xEC86CBC3F5F8C1,0xCF3FEA6B540302,0x2E6D70B0CBE17F,0xFC425A2122DC2,0x31BF982FFA7F83,0x24798AF3885BE3,0xD074C908A99256,0xB4},{0x35FAC9588C8C84,0xB86851FA7BFE1F,0x1CD9CF221135A1,0xD2C72219E8B2B1,0x91A9229E6EF00C,0x40593AD7447078,0x9130CCE3765A21,0xC5E9FB9709F1F4,0x5F0FFBBE90D59F,0x5C}},
+    {{0xE0F80FF7DA9BF6,0x1A7814656E650E,0x3514C814214823,0xF4F99541F1DC46,0x33DD9C1B4B798E,0x688A70E627E37,0x5E1BBE45C1AF9A,0xACDB6278F7161,0x68FB4C865EA385,0x3A},{0xEF67EDD947B91F,0xB131B41244FEE8,0x701C2E47FFAFBF,0x806910671C6C23,0x72F530529A114F,0x53D262B1D91C62,0x87A48AB2F9F0F1,0xE79BD3269D995B,0x58B82B00B2A77B,0x60},{0x3CFE39A8036532,0x3699665867C665,0x4B9EAAEDC834A2,0x43DA3E617B9EE8,0xCECD60EA1E4120,0x1424104085D29E,0x745B94E1560F90,0x9D1790DA5DE3A0,0x804BBB6E105DE,0xD4}},
+    {{0xEECE5038389D3D,0x701705B1A56627,0xC4D52C323B3FED,0xF076557FD5F52F,0x3EE995EFA9C7BE,0xA2314C9C935E5F,0xA3A53D61A98306,0x1450A272E8B979,0xDDF2EE045E93C0,0x70},{0xD59A28E35C5D50,0xC07817AA7CE30B,0xFB3B9031A635AD,0xFAC064601B2AFF,0x30A614D601055E,0x8EFBD9F78EA68A,0xA84EC500A2A83F,0xAA67298BE29209,0xEF5F91F1379951,0xC0},{0x46154AA0565407,0x1ADC716B44D9FA,0x6B06416563041C,0x73D3B1F7A44F4A,0xF80CB62231362C,0x7D35626C7A1948,0x20C6C24C528227,0x65475AAD2107CD,0x74E510742CF6B3,0x74}},
+    {{0x56679F5130A6BB,0xE7AAFB3EEA1003,0x5F16EDE478C85B,0x6729FC0507BBC4,0x4CE753652D8455,0x408FD9DBDAB6F4,0xF5FCFE236237F3,0x634158BCFBA0DB,0x82CB3CD7B2BEBD,0x78},{0x92B39515A273A7,0x390F58492D0AD0,0x2F0239305D217D,0x62E12AEA97E134,0x9DA10A5A488919,0xE7917A95A24473,0x8DB5AFA96EE422,0x94586CA4E40DB0,0x650E7EB0108F55,0xA},{0x430B957864FCB4,0xA56CE37EC8A2D3,0xBE7BBBD1E59CF5,0x444FB04919256E,0x9F9E99E82EB9E6,0x852E6C4CAC775C,0x5CC7693AF114EE,0x57F76E4AD8C06D,0x22F29E9BD9CF01,0xC6}},
+    {{0x3064EB2B770BCE,0x4C9ACDF91AA6C,0x4F2A850D077A,0x73A1203ACE6C6,0x55B6C8FB891E32,0x7CB3270BEFC2DD,0xB6B4F6A95706E4,0x4E5A5511AB3E63,0xD9F0407ED9703D,0xE4},{0xF84B462CB6F38C,0xCBF7152754BCD1,0xFCED996107F3ED,0x809297236F61B6,0x9B6C50A83D3A37,0x8A3E24227BA438,0xCA26122B052C42,0x6398C42ADC5694,0xFBA7A417ACF18E,0xD3},{0x6F7727CA533D47,0xCD28D4CA8F31D9,0x5C63FA0F91B6D6,0xCB642E8AE987A1,0xFF1E507C9890EE,0x6B716D87D3A43B,0x82C9DB24C41172,0xF76627E8E518D,0xD86567DA525E7A,0xC0}},
+    {{0xB77B78DD24B6B,0x490C72E454675A,0x1AD7C57799EB9A,0xF675BD21DE5D8B,0x80D3BEE313AE60,0x9B3A44EFDE19DC,0x7845D6824D19CC,0x25786905F90CD6,0x4622429DDF5A54,0x2},{0xCA256ED6395180,0xFE1AFB66D77F7C,0x1A01361CBB7152,0x5CB7483AB7E1CD,0xC3F107C26EDF23,0xDED879B9D7EE03,0xDECBF430A2C0DB,0x5B5C500EE43507,0xE196AA3D374F53,0xE0},{0x827E3E535904E3,0xF3F388075A7B46,0xBC92FF5845B49,0xF1B709DAD33DAC,0xAC794BC9EC99D5,0xE535B25E0979F2,0x6285016062DC3,0x9D4BDE16A5B5DA,0x80CA66811FBF15,0x44}},
+    {{0xCEC47082F6403D,0xAD43EE29351931,0xB9C876B952F777,0x4A2F7A643DE46C,0x9E7704ACB2895E,0x1D25B9F27C02,0xB34CE75E04647E,0x8754FA7C4DED84,0xEC38C350360755,0xF8},{0xF07B32E867857D,0x212EFA7DD7AFAB,0x9DD62DFA37188C,0x80046AD4ABE044,0xB0D6C47E3F0E74,0x3F35FBB19F3D5A,0xE14CE5519972C,0x2C8D8794C4C3E7,0xA8000FD36FDF82,0xE2},{0xD486382A469BEC,0x7A9E18EC511E00,0x1BE90833822454,0xF97F21E96ABE72,0x1A165C7329DEAA,0x98DD8EB45ECA49,0x22F523BE11D118,0x7313E53FDF94A4,0x3E816D9D426F05,0x83}},
+    {{0x6142D46EEA7D55,0xEF0037EB64D106,0xBA6ACC7E7ED26C,0x8758067C82143C,0x540C6370831950,0x11DC2CD2337074,0xC3A11340C283E5,0x27D06A39D1FA8E,0xB937FE5616297D,0x3},{0x5C9CE678EE8AA6,0xFAD7DBD102330C,0x47E29086458941,0xB1FC9116D0ADF5,0x5ECFF2311880D8,0xF582342A3640,0x375B22D92974F6,0xC70356FA3C2210,0x135E2A55243EE5,0xEA},{0x142AB670ACCD7B,0xEF1CE382D9FDA7,0xF305CA4A2E7955,0x21B543DF3AA4AF,0xA15EA86357C2E8,0x16CE872086D6DA,0x9CF5CB39D850D7,0x775DBC660C731,0xF2A81B06FFF843,0x26}},
+    {{0x7F3156120EF661,0xA3A225F6E48801,0x9A566F8CD4E91B,0x7A36D9C616092A,0xEC1648C19A022A,0x356797EF1E5B7A,0x6453BA430764F7,0x1EA002DBDB2AE7,0x1748138C631489,0x65},{0x28017B8842A41C,0x5C9CBA1EA668CC,0x13450EA726D805,0x6CD2FCA5BA5E14,0xC1F51B5DD44220,0xC40A241B0B8A12,0xC26660F765E273,0x82F05D49745B3E,0x628662976D8705,0x86},{0x36CC31404A8A08,0x5A8EEEB9B9E7E8,0x27C98919030BC4,0xA5E4EA545420FD,0x2E62278BB5CD9B,0x6FD6615FB60AFE,0x76E7E32E166481,0x9D59FE5A39833F,0x198B983C072DCE,0x7B}},
+    {{0xF2B7C26A9E439C,0x326FAE6EA76B7C,0x2007CC4C5869B0,0xC01A760E7E05DF,0x6C45AB71A8389B,0x9DC239A5EB4A51,0xCE640D09D44647,0xD481E959E1718F,0x60767512AC4EC0,0xFD},{0xEC3B15695D78D4,0x1FD19648180398,0x276BD00C6ED013,0xA65874F8F8EFA1,0x68B87B81285B3F,0xA50E713DBF727A,0xF1900F5E946688,0x1C98CCFEDB0D21,0x101550AA4E1E5B,0x60},{0xE164B2D58BE179,0x5004908081E5C2,0xBF04DAF3A05873,0x2700E2F7CA1F1F,0x8A353D2CEE27B6,0xD9ED3F167152DD,0xCE68A4E403CD50,0xCFBB9EEE82CDFE,0x3D35F754A3599D,0x40}},
+    {{0xA105F350EDEC6C,0xDC6A6EAD1EAAE,0x49BEDC6BE60EE4,0xCBCB0FEC248EF5,0x8B8BD5DCFE9AC3,0x3155556CE1687C,0x7957D9D2CA1DE8,0x949C2736EE04E1,0xDE7D259DBC778C,0xAB},{0x99C4CD00E4C5F,0xF739215F5B7F6E,0x9E23CC57D24C12,0xB15206B31AFC27,0xDA5E3AE6936B22,0x4B3E0840E875E8,0x1D48ED89A08568,0x81BB3F8821EC7,0xCE64E9F6F52445,0x87},{0x6579B9C2BFD3F,0x78B9139CD4AD79,0xFD43ED231BBA4A,0xAE0A5BCD2D7589,0x22DCB488EC87,0xBC17392DA8F1DD,0xFBA76EBAD967DE,0xDE174FD9CDCA38,0xAF21E4102805A6,0x19}},
+    {{0xAD06C7ACAE7419,0x37BD979F3D5E90,0x314901E87954B,0x1C5972328D6DE4,0x32641755432021,0xB0CE6FDDC26A6,0x3A99B1FE0D8586,0x6F10C546C7FDE5,0x7C6EB558EC264,0x69},{0xD07B23FF0B517E,0xB8A13EC6F72F0D,0xCC7D05A0315A5B,0x979ECF5B837554,0x26DE81865C1A22,0x91A812D96B0DBE,0x6B286518D2FCD2,0xD404260EA920AE,0xB3BDE4D1878FA,0x50},{0x1A5892940E5C16,0x1EF7685AF79D59,0x14842A5BA87F5F,0xDB06B2BA2881A1,0xD79F4700902996,0x75CE5BB303D6B4,0xFB5F8ECAA98E3,0x84F8A3068858A4,0xC6A7BEF05F14B2,0xE7}},
+    {{0x3C558D6B59CC5C,0x961253923CC0A1,0xBAB7939FCF4E20,0x26BBD027C921CB,0x4B1F8145471266,0xBE7C06AA79FB7D,0x8CE5029B58A34F,0xBCB0F6A05B8A79,0x68835BC8A90E16,0x81},{0xEB2B0B577B06CA,0x2E8D1CDE1151B7,0x1319C52EEDC34C,0xB18E1F24DEE79F,0x689279AAC986ED,0xF0E7DC6282204,0x1FE20D38EB6D09,0x6E088C10048841,0xAE95F26A63B6B1,0x88},{0xCCFBD60EF32A53,0x8CB4E844C8233B,0xE371C439023CFC,0x23D297A7342AFF,0x912B3820C9C34E,0xD8B972D287AC09,0x5722BB5195533D,0xF343A43AE4FD0C,0xA1DD513DB12A0B,0xFD}},
+    {{0xB8E340B10C9199,0x6EF5701A30A4D7,0x16B9C88E45C0BF,0x56F2EA790763EA,0x218FA0BE6E677B,0x45E6D67E0592EC,0xA71EC098DC2AB5,0xD91463A9E0D3D1,0x11953CBD838B1C,0x28},{0x6EE4EADD900F67,0x3D24636A2A1977,0x5B0216AC2405AB,0x1FE93134BB1D1D,0xC418714380A033,0xCEA039D540AD06,0xA5F75AFEBFB94E,0xAE932CA2650E57,0xA70529AC779BB3,0xB},{0x4FFEE6E83EB19,0x6E5F9CC9A54940,0x8E9D289FD25908,0x181F1AFA08B14C,0xB0942784863D86,0x5E0FA8D7EA1569,0x8356FE2E4EDF0A,0x95F04A06DDBBDF,0x161DB9C990D51A,0xBA}},
+    {{0x70888516B489BB,0x69BA6610F9B892,0x524D73A704A7AC,0x9717C60477617B,0x899FA67A6A9F48,0x6185FEEA3B66C0,0xAF98794CAB0ACF,0x6B17CBDF140C6B,0x95DBC5C3D07DD8,0x60},{0xD1ADBFCF4D1B6C,0xD7A71793FCA0AC,0xEBA686BC83464C,0x9825FB0A7158D6,0x3EA0C3B7BBA45E,0xA9359863A1722D,0x35DAC61DF7E524,0xF147F8898B458A,0x78A8E8C5A24B2F,0xF8},{0xF097D4E58587D1,0xBA243EE1A326B0,0x1E09DD08DFB131,0x566B3C615D7408,0xFC63C894629A2C,0x980BAEAD6164C4,0xD259E281331134,0xEDE65AD6A25062,0x63ECB517F4A417,0x63}},
+    {{0xAC184B8AA13868,0x46490CE9B8267A,0x5827E9CC3118B7,0xBB12324CFED0F5,0xBBADFE717A717C,0xABD9E213958820,0x36619459BC4274,0xA21D39F1473D23,0x1859175E13387B,0x2D},{0x6C3FD04CB0379D,0xEE86AB50153B30,0xD0518ABF4CE4E1,0x8DC91F69254B1D,0x660A92530AB2C,0xF00BBD8AF78915,0xEBE91B29DE86DB,0x69DF045E5378ED,0x5666BACA82F5D1,0x7A},{0x74635CEC687CB,0xDFA16AC3D5B907,0x694BE771A1A680,0x90582D81014DAC,0xE1D009DA86AF48,0xD675F2E885ACE2,0xA328B4929704BF,0x939B99E2F63DAE,0x42F4A9F5CA9189,0x8D}},
+    {{0x9584C91DE4BC12,0xD7C2E27385B5BE,0xD0E7BA219439B1,0xA392D212587844,0x9C51214573F558,0x74EE3B99E20578,0xD21566FC9151A8,0x7D634AC78A9046,0x7DE75CD8B61DC0,0x48},{0x16F0BBEFBF01CF,0x396E89F696A3E2,0x5207BE35FDE79C,0xCADEC489810276,0x6549E83DD439A2,0x7B0A1290C41542,0x5B2801294EB1A4,0x577E975FA80CCB,0xCEF1CBABB8EE60,0x8},{0xA67147BA974803,0xC41EDC2E6E9F42,0xF7F7DB672B20D8,0xA848D86E9F0DD9,0x53C89C3F6C02D6,0x8517326B65D05E,0x2698FF27BFE94E,0x5FD0C5106772E,0x1C7229B5669456,0x5A}},
+    {{0xD28E142A9B4F14,0xC2C88F3D08CC6,0xDE978F7AC7FF95,0x8DD269D9D85F81,0x17533C57272E86,0x8DC66233A4A6B2,0xD7D8135003A40E,0x998FABC3B7B00F,0x1A97A5B1DCEBE5,0xBC},{0x568C1A149FA1E2,0xBE405E009715EC,0x6F663E0F8594EA,0x695CA91625F525,0xBA29FBA86A5F31,0x84922F3B455BDE,0x28C73614F7A36,0x91F5ECA77169BC,0x7036CE4A8B88A5,0xEF},{0x187D09306766D3,0x39FD4290F400B,0xF41DF1B42562F1,0x97B3A3198C9748,0xEE69D7D097B4C8,0x90D3A213CE8250,0x7B5D02B4ED8060,0x61A9D69506E405,0xD6C6039263EDFD,0xD9}},
+    {{0xAB8C10A63485AE,0xF326870B0CBB79,0x7FAFC48530E0F5,0xC2921F6B1070D8,0x5C536ECE15422,0xE4774AAD2C56C1,0x191356F5B497E4,0x38E7A184469C00,0xE16303BCF1C55F,0x51},{0x518B22E10BB993,0x38DB1014616826,0x6B89BA8EFBCC70,0x15DF82FE24D247,0x92AA07F2B87EE9,0xF5241AF5AEF1D2,0x8685CB50B63D95,0x32DBA3F18D3A2E,0xA43C8BD11AB672,0xC7},{0x8DF61606FDA23E,0x8529F1659FB273,0x68755547A768E4,0xECD0F31BC3120F,0x961DCA93D72911,0xF6E03FFA074164,0xCCC5494C06872C,0x475A08D328C65A,0xA371114D4B0595,0x9F}},
+    {{0x2A421C68A097B,0x87E85D78E5CC6,0x2BB1661E812AC8,0xD771CED181316E,0xEAE4516636E767,0x18D21BF32BD6B0,0x109C2F965CF73D,0xD85B16728AAFAB,0xE7110852ACD3FA,0x41},{0x93FD361D1FBC8A,0x6D0301C07E7814,0xBCF48DC7C2986E,0xBB01E036FFE50E,0xCEDF8D1C340B1,0x2B9A7988D6AFCD,0xBB9E6C0C78A61A,0x948B0D6B192F62,0x38C0079BA89E3,0xA4},{0x4830D3D2DA0A56,0xC4F313E05F2859,0x95F522025A9D06,0x5F0A2168AAD76D,0x1E858E4C7B92A,0x3383DAA7A5488C,0xFF91E1623B007C,0xB59419565ACFE8,0x1F48F3BDC83F1B,0x9B}},
+    {{0xCC79224BDA8B00,0x309B457ABF36FD,0x29AEA1FC417142,0xCD7C0A30E1A44E,0xDEAABDFC1B0EAE,0x29D77D55AE75F0,0xD25A6A112610CF,0x95BFF436DC1025,0xA3221DB4BC4E96,0x90},{0x45354753B522D8,0xB45B1A6B970594,0x99F9159716800,0xB8C2EC8C3C865,0x333BEAF0A3429B,0xFC35FA3EC2AAA6,0xD1A0D473ABCE48,0xDED1B9A682FCEB,0xA6CE5912D4A9B3,0x38},{0xA7FB28D5E3360,0xE00BB6EF967084,0x58523E510E0359,0x761C4D8AA8CB2D,0xF90B5FD45BC7D3,0xF60059335D2FE0,0xA69C57401D4AD6,0x1836C8E2093CA5,0xC5217257BECDBC,0xBD}},
+    {{0x25A90DF741A1EE,0x79B8ADBE98170D,0x6858306C24BF59,0xCFEC84CEF026DD,0xFDB1F837FEA8B3,0xCCD46723186971,0x8B621C0433CB1D,0xEA4B4E7B4DB578,0xC21BEBF6E92FD4,0x91},{0x49950CF25211F8,0x5DE6A22C8F00E4,0xCEFDD61CEE26AC,0x959B590C57D633,0xD7BCE6F0DA6954,0x5B15525D92F531,0x7EDCC4686C6A01,0xC09B31833CBA2F,0x25CFD283817C34,0x6C},{0x81035C4BC6F6C1,0xACF85A9EAFEF96,0xD6F24677B7A6BA,0xD2F93A26E403C6,0xF0E48FCC307817,0x9D5ED466D12FA,0x955A2944EC653D,0x396711BA806CE7,0xC768FD7133DE4C,0xEA}},
+    {{0x16D5772B5B512F,0x4B7901C4499AE2,0xE75AC8920CF001,0x5A124F35B85C5A,0xDD549506DE375C,0xFCC3ACBFB272EF,0xA9936AA6C07ED7,0x2952249023AB98,0xF0F431B301A830,0xC3},{0xD8C147B5E370F3,0xA407D1B828847E,0x36C51C1548190C,0x322237FA71DE00,0xD512018AEB9AE0,0xCFA8D1EF225265,0x787E25F717617B,0xBB7278E04A7D7A,0x83F18FD2BFBAB2,0xE0},{0x2F7820849B8E81,0x7FFE26E7B87ACC,0xB385B5C6137098,0x110B62FCCDE3EF,0x1C32EC67F27E1E,0x1EDA48E29B1BFF,0x1F43DD7617BCF9,0xC1C0EFCB50A121,0x8FF3A6F1CD3FBF,0xAC}},
+    {{0x1E9A1030F6F4BB,0x52723050DD809F,0xAA00078CEB4B26,0xD52D9FABED445C,0xC42D5032C13A75,0x25F8541658C486,0xE43BC52C7D1750,0xC06FF75AC5A12B,0x62A2C8CDFCD3D,0xE},{0x994BE2E3B1B743,0x753796D131884B,0x3CE1EBB785712F,0xECDF2BB3399DB6,0xEE94EDAC2512BC,0x943BB6EC1BDBA7,0x4FB36F040BCFAF,0x4EC3FCAC0409EF,0xF04B974DBB4F60,0xC5},{0x1CAC1AF2F2980C,0x18396E9895A0B2,0x17C20CF6A2977E,0x7EA29A11B1A03C,0x12671C381B6AC1,0x72F80C7177069B,0xB6561168A9904F,0x10D2024A90BB3E,0xF973BB1397C20E,0x47}},
+    {{0x2B3708CF8BE778,0x253879706E0B42,0x28EBE2FB3E0490,0x1C9ECF38F19891,0x4C3C7343BD1B69,0xAD96A100DA4B49,0x59244220FB7CDD,0x1AECDDA5EA067F,0xD29EAD1D288FB9,0x70},{0x87FC4943AFB678,0x841200C60C030C,0x1E565CA67565CF,0xDFD43B3C5DBAEA,0x4A3746C01CE7EF,0x6D078FE89450E0,0xFE468664ECCF5C,0xB697EC9E92AF0D,0x949A533552AFEA,0x5C},{0xF45B65533E6311,0xD045A8286DD2B,0xB38E3D9989921A,0x9E95C5957F55AA,0x28B907641CBAAC,0x3D4789E100DCC6,0x33D9212FC701CF,0xB4755C3D337E4F,0x8AD43A4274943E,0xC1}},
+    {{0x33FECB1A5619E7,0x3FAFA8D8C5D0FB,0x8B8D9088DBEC64,0x9C0870F1B6101,0x7EADDCF3836BB4,0xA97D485B511344,0xCD7B12A76EB830,0x22E152354B5D16,0x829B0C57E8AB4C,0x4},{0xC589B22ABBF80F,0x9CB822BC385A37,0x7020DDE7AC6717,0xD21D56367AE372,0xB3A3F058C7037D,0x493371378A3727,0x7DA53CF6CB7C45,0x679EEF103E02A7,0x321CB17311F2AE,0x93},{0xAC665E06D1BBC0,0xE2DB6FB0622338,0x13068990E0EF08,0x3AB77FDEDED754,0xEF4CF1D2679CC1,0xDFF11FAC4E8A61,0xC3394F31ABA7A8,0x895DB130E02445,0xFBF27A53A4DD67,0x17}},
+    {{0x83C88624FDC0B8,0xD21585934D8A2C,0xA6EF8D1921CD48,0x98272F185C981E,0xB59BD4978E6DAA,0x78625DAA11180,0xF388BAE8B63430,0x799F9B025C159E,0xAAD86EC794B0F7,0xAF},{0x952DE041465190,0xB987D30203C91B,0xED632AFDA31385,0xBB7A8D90F95A45,0xF53D15589D2DA1,0xB649F5CB53E78E,0x87B4357594009B,0xA13BCDDC4B1003,0x6C75317E495957,0xC5},{0x2C6507FCC448A0,0x4E092D09F8682B,0x7502FCBF6DF929,0x4FFCCAF357E1D0,0x5AA95D550EE860,0x7248DE25259748,0x63E05259EB745,0x4CF23C96BA6FED,0xC4DC719485F5F8,0xEA}},
+    {{0x76E5791CC07A55,0xCCA1B89AABB54E,0xAAC94EA0DEF9E4,0xD9DCC3365E0804,0xABAC27787387F4,0x9B31DEB47D6DA7,0x8860BA7C7BB1DF,0xF024A3100FD7E8,0xB597347F74773,0x74},{0x9626448E22E446,0x6335EADE7ED5FC,0xF6B4DA2C36197,0x331B508C62F7FA,0xFC6135094EB340,0x31782E601A172B,0x9705B46FA687F2,0xDB8F9CECED1A,0x40E6D9B3BBABD7,0x80},{0x341E376E72A252,0x8079A5534F265A,0x34B5B4AC2F08A0,0x8D587BBDFCEF53,0x44C0754B5458D1,0x2B5CA387D92DB2,0xD4BB5FC326ADE4,0x9732317E68337B,0xE4CF0F59F41101,0x86}},
+    {{0x9AA2A062634577,0xC0CF0D24E5FDD2,0xF3529FB5C82B5D,0x7F24932F21C554,0x96262F03CCC6AA,0xE23855C9B692F1,0xD17CC31B554FE2,0x755F94A0213E24,0x7924ECA1BDCB9E,0x6C},{0xA0C07C4C25784,0x9D1A74D16A5635,0xFCB4B3BAA3FFF6,0x2E0C67FC69F19A,0x1BBDA6B63ACCD9,0x736A97D2A474F8,0x2707D223002A37,0x51C907D6BD1F90,0x73E04E948B9BA9,0xEE},{0x9751C7BBC7FFB,0xB02A04B0B67F2C,0xB42DD7DA3E55D6,0x4F2B49AED0A2A8,0xADA60999D522F7,0x7A19B83FD2F2FC,0x37639D6974C272,0x972833A07640D5,0x6B1758334BF701,0x48}},
+    {{0xB91D233DB5CF1B,0x6C55EAB4FC26B0,0xD5DE461E95990D,0xDC67283F2B236,0x9C22E1242D3FDA,0x25724B3F1450E6,0xEBC1058FD397CA,0x88719DACFE1374,0xDD4DEF208FB5F2,0x68},{0x196CF817F0E8C,0xE04890BE73213C,0x6213F54F16B736,0x2AE5296EBEFB59,0x680C10A7FDBFD2,0x8B8E68AFC7F33,0x18A27FAEC1279C,0xF5BBD2F49EA208,0x65B767BF06F5AC,0x52},{0xF9BF950D2A5F1D,0xF17187C3FA3CD4,0x5AFCF5B096123C,0xC052931D4C2B16,0x99101F7CE3B4E6,0x16B663D2C85BEB,0x3041BD3139D9F8,0x9D0CD262454078,0xD22F6F64D31109,0xE0}},
+    {{0x8D9BFA799DD74D,0xC817B6A7105B4E,0xF577746E1D7228,0xBBE5E9652FC261,0xD320CCEA464D1C,0x670B8F5099EE62,0x579E7FAB3D070C,0xDE6DCB8A785B51,0xDD9722BF819F79,0x24},{0xEF39634F037726,0xDB9BE38D8AD115,0x2625FDC423C843,0x5ED6F5D95840C9,0x3FEA82144E2B1E,0x2399A5159A8FF3,0x8AD7219518C369,0x961D22D9232AD3,0x5B5CC478D56444,0xA4},{0x9AE9C31262DD83,0x4C17582F6A4EE8,0xED079C6D1F0C4C,0xA17E091DF0D6D6,0x70FDE02FD70F3A,0x679B63DA55B69C,0xF1E457B3194755,0xBFA1A956CD5650,0x8274813257BB63,0x93}},
+    {{0x8FA199A3D602F9,0x359630F5AE7DDC,0x2D516EF0E01ACD,0x3B7AE3D77F38A6,0xB724DA0DE89C29,0x86CCC008AF703A,0x4AD9912CFFA306,0x820B206CBC8B50,0x8EB6D687246CEE,0x1C},{0x19E74C1D33536C,0x1A6FC2DAA45F06,0x68E52EF5F2D449,0x920ACF5F9DE1D9,0x9B20E3ED75F6E0,0x8DEAF8EC22EA2F,0xE28E50D5725A17,0xDE63B9D4D2E5A8,0x9D7251BD3CC4A,0xFD},{0x4A31B01C53D8A9,0x62F0EE19A7C76A,0xFE4AF90B0900C,0x114B4CFA6D2117,0x7D2DE838A1EF4D,0xABC7E44C6C1703,0xB47E019129A619,0xF55CBA8735B328,0x211EFB773D957C,0x80}}
+};
+/* End of comb table */
 #endif
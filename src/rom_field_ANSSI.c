@@ -42,3 +42,7 @@ const BIG_256_56 R2modp_ANSSI= {0x18D2374288CC9CL,0x4929E67646BD2BL,0x220E6C1D6F
 const chunk MConst_ANSSI= 0x97483A164E1155L;
 #endif
 
+/* Addition chain for the fixed exponent used by FP_sqrt - generated by scripts/addchain.py */
+// 251 squarings and 56 multiplications, 10 temporaries
+const sign16 PChain_ANSSI[]= {59,1,0,1,-1,2,0,0,1,3,2,0,1,4,3,0,1,5,4,0,1,6,5,0,1,7,6,0,1,8,7,0,1,9,8,0,-1,9,9,4,0,9,9,4,8,9,9,4,7,9,9,4,0,9,9,5,8,9,9,5,2,9,9,9,3,9,9,4,5,9,9,4,7,9,9,5,7,9,9,5,6,9,9,7,8,9,9,4,0,9,9,11,5,9,9,6,7,9,9,4,6,9,9,4,7,9,9,5,2,9,9,4,2,9,9,4,5,9,9,8,5,9,9,6,2,9,9,4,3,9,9,4,6,9,9,5,4,9,9,6,6,9,9,6,2,9,9,4,3,9,9,4,6,9,9,4,4,9,9,4,5,9,9,4,3,9,9,4,4,9,9,4,5,9,9,5,2,9,9,5,3,9,9,6,7,9,9,4,6,9,9,4,7,9,9,5,2,9,9,4,8,9,9,6,8,9,9,4,2,9,9,4,3,9,9,5,4,9,9,4,6,9,9,8,7,9,9,4,7,9,9,5,4,9,9,8,-1};
+/* End of addition chain */
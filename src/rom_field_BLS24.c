@@ -49,3 +49,8 @@ const BIG_480_56 Frb_BLS24= {0xE81A1C8E0CA60EL,0xDFEA2B20C0DF4AL,0x25327A5B7F5FA
 
 
 #endif
+
+/* Addition chain for the fixed exponent used by FP_sqrt - generated by scripts/addchain.py */
+// 477 squarings and 88 multiplications, 18 temporaries
+const sign16 PChain_BLS24[]= {91,1,0,1,-1,2,0,0,1,3,2,0,1,4,3,0,1,5,4,0,1,6,5,0,1,7,6,0,1,8,7,0,1,9,8,0,1,10,9,0,1,11,10,0,1,12,11,0,1,13,12,0,1,14,13,0,1,15,14,0,1,16,15,0,1,17,0,0,-1,17,17,6,11,17,17,6,12,17,17,15,8,17,17,13,8,17,17,7,13,17,17,5,9,17,17,6,14,17,17,5,11,17,17,6,0,17,17,5,13,17,17,5,11,17,17,5,14,17,17,5,2,17,17,6,15,17,17,10,0,17,17,5,16,17,17,7,12,17,17,7,15,17,17,5,16,17,17,7,10,17,17,10,14,17,17,5,11,17,17,6,0,17,17,5,3,17,17,9,8,17,17,7,12,17,17,7,13,17,17,5,11,17,17,5,7,17,17,6,4,17,17,6,0,17,17,6,8,17,17,7,4,17,17,5,13,17,17,7,9,17,17,9,2,17,17,6,2,17,17,6,2,17,17,5,10,17,17,7,9,17,17,7,2,17,17,6,16,17,17,9,7,17,17,6,3,17,17,8,13,17,17,6,9,17,17,6,14,17,17,5,8,17,17,6,4,17,17,8,12,17,17,6,6,17,17,5,14,17,17,5,7,17,17,5,11,17,17,7,13,17,17,5,0,17,17,6,16,17,17,5,16,17,17,5,9,17,17,6,15,17,17,9,6,17,17,6,10,17,17,6,2,17,17,5,7,17,17,6,16,17,17,5,0,17,17,8,10,17,17,9,6,17,17,7,15,17,17,5,3,17,17,8,2,17,17,9,11,17,17,5,3,17,17,1,-1};
+/* End of addition chain */
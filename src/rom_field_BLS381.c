@@ -47,3 +47,8 @@ const BIG_384_58 Fra_BLS381= {0x10775ED92235FB8L,0x3A94F58F9E04F63L,0x3D784BAB9C
 const BIG_384_58 Frb_BLS381= {0xF78A126DDC4AF3L,0x356B0535B1FB08BL,0xEC971F63C5F282L,0x21EDB1ECDBFB032L,0x2231F9FB854A147L,0x1B1380CA23A7A40L,0xFC3E2B3L};
 
 #endif
+
+/* Addition chain for the fixed exponent used by FP_sqrt - generated by scripts/addchain.py */
+// 376 squarings and 81 multiplications, 18 temporaries
+const sign16 PChain_BLS381[]= {84,1,0,1,-1,2,0,0,1,3,2,0,1,4,3,0,1,5,4,0,1,6,5,0,1,7,6,0,1,8,7,0,1,9,8,0,1,10,9,0,1,11,10,0,1,12,11,0,1,13,12,0,1,14,13,0,1,15,14,0,1,16,15,0,1,17,7,0,-1,17,17,9,0,17,17,8,9,17,17,5,15,17,17,6,9,17,17,5,13,17,17,5,8,17,17,5,16,17,17,5,10,17,17,6,10,17,17,5,5,17,17,5,3,17,17,5,9,17,17,5,12,17,17,6,10,17,17,5,14,17,17,6,13,17,17,8,7,17,17,6,6,17,17,5,11,17,17,5,10,17,17,6,12,17,17,6,13,17,17,6,4,17,17,6,15,17,17,7,12,17,17,5,0,17,17,6,8,17,17,5,4,17,17,7,3,17,17,7,5,17,17,6,12,17,17,5,15,17,17,5,10,17,17,5,10,17,17,8,7,17,17,7,11,17,17,7,2,17,17,5,14,17,17,5,6,17,17,6,2,17,17,5,14,17,17,7,5,17,17,8,4,17,17,5,11,17,17,5,6,17,17,5,16,17,17,5,16,17,17,5,16,17,17,5,6,17,17,6,3,17,17,6,10,17,17,5,16,17,17,5,16,17,17,5,16,17,17,5,14,17,17,5,10,17,17,5,16,17,17,5,12,17,17,5,16,17,17,5,16,17,17,5,16,17,17,5,16,17,17,5,16,17,17,5,16,17,17,6,11,17,17,6,11,17,17,1,-1};
+/* End of addition chain */
@@ -47,3 +47,8 @@ const BIG_384_58 Fra_BLS383= {0x52D72D3311DAC1L,0x24D203F99DCF806L,0x344AE550D8C
 const BIG_384_58 Frb_BLS383= {0x1E446375298D5EAL,0xC2AA22FF4452F0L,0x3B684104C2BD72L,0x16ACEAE2A2CA76DL,0x15ECF3F939260D9L,0x8B017E5B388380L,0x32B880D66L};
 
 #endif
+
+/* Addition chain for the fixed exponent used by FP_sqrt - generated by scripts/addchain.py */
+// 381 squarings and 79 multiplications, 18 temporaries
+const sign16 PChain_BLS383[]= {82,1,0,1,-1,2,0,0,1,3,2,0,1,4,3,0,1,5,4,0,1,6,5,0,1,7,6,0,1,8,7,0,1,9,8,0,1,10,9,0,1,11,10,0,1,12,11,0,1,13,12,0,1,14,13,0,1,15,14,0,1,16,15,0,1,17,0,0,-1,17,17,6,11,17,17,6,13,17,17,6,11,17,17,5,7,17,17,7,11,17,17,6,13,17,17,7,11,17,17,6,14,17,17,6,15,17,17,5,7,17,17,5,7,17,17,11,14,17,17,5,7,17,17,6,14,17,17,5,9,17,17,7,2,17,17,5,16,17,17,5,11,17,17,5,5,17,17,5,3,17,17,5,0,17,17,5,3,17,17,10,11,17,17,5,11,17,17,5,2,17,17,7,6,17,17,6,8,17,17,7,14,17,17,6,6,17,17,5,5,17,17,6,9,17,17,5,2,17,17,5,6,17,17,5,0,17,17,5,9,17,17,5,12,17,17,11,0,17,17,5,7,17,17,6,6,17,17,8,5,17,17,6,5,17,17,5,15,17,17,6,4,17,17,5,11,17,17,5,2,17,17,8,8,17,17,5,13,17,17,5,5,17,17,5,9,17,17,6,10,17,17,6,5,17,17,5,0,17,17,5,5,17,17,5,6,17,17,5,14,17,17,6,9,17,17,5,12,17,17,6,4,17,17,5,6,17,17,6,5,17,17,8,6,17,17,6,11,17,17,5,6,17,17,9,11,17,17,1,-1};
+/* End of addition chain */
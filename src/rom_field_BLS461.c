@@ -48,3 +48,8 @@ const BIG_464_60 Frb_BLS461= {0xB3AE8410F298071L,0x7E39D4CAFBAE6A9L,0x104404777A
 
 
 #endif
+
+/* Addition chain for the fixed exponent used by FP_sqrt - generated by scripts/addchain.py */
+// 455 squarings and 84 multiplications, 18 temporaries
+const sign16 PChain_BLS461[]= {87,1,0,1,-1,2,0,0,1,3,2,0,1,4,3,0,1,5,4,0,1,6,5,0,1,7,6,0,1,8,7,0,1,9,8,0,1,10,9,0,1,11,10,0,1,12,11,0,1,13,12,0,1,14,13,0,1,15,14,0,1,16,15,0,1,17,11,0,-1,17,17,6,11,17,17,6,11,17,17,6,11,17,17,8,11,17,17,6,11,17,17,5,5,17,17,5,11,17,17,5,7,17,17,5,3,17,17,6,11,17,17,5,7,17,17,7,11,17,17,6,15,17,17,5,7,17,17,5,3,17,17,6,0,17,17,5,5,17,17,6,5,17,17,5,11,17,17,5,16,17,17,5,8,17,17,5,6,17,17,5,8,17,17,7,8,17,17,8,13,17,17,6,14,17,17,7,6,17,17,5,11,17,17,5,10,17,17,5,3,17,17,7,9,17,17,5,15,17,17,5,9,17,17,5,5,17,17,5,0,17,17,7,9,17,17,5,7,17,17,5,0,17,17,6,11,17,17,8,14,17,17,5,16,17,17,5,15,17,17,7,12,17,17,7,2,17,17,5,10,17,17,14,8,17,17,6,5,17,17,5,11,17,17,6,11,17,17,7,9,17,17,6,11,17,17,5,6,17,17,5,16,17,17,10,0,17,17,17,0,17,17,21,3,17,17,6,11,17,17,6,11,17,17,6,11,17,17,5,3,17,17,6,11,17,17,6,11,17,17,6,11,17,17,5,6,17,17,23,11,17,17,6,11,17,17,6,11,17,17,6,11,17,17,6,11,17,17,1,-1};
+/* End of addition chain */
@@ -49,3 +49,8 @@ const BIG_560_58 Fra_BLS48= {0x2623CFD9325BF89L,0x341FA8DCCD0A56FL,0x1952FBA0E83
 const BIG_560_58 Frb_BLS48= {0x2623CFD9325BF89L,0x341FA8DCCD0A56FL,0x1952FBA0E83BCCAL,0xBE3C26F8D1D297L,0x27F84ABE7AB9F2CL,0x13BDE945C9DECEBL,0x3B3213C83C0F60BL,0x3B7F0411FF27FF7L,0x80089C089BB36CL,0xA62E01EEL};
 
 #endif
+
+/* Addition chain for the fixed exponent used by FP_sqrt - generated by scripts/addchain.py */
+// 552 squarings and 105 multiplications, 18 temporaries
+const sign16 PChain_BLS48[]= {108,1,0,1,-1,2,0,0,1,3,2,0,1,4,3,0,1,5,4,0,1,6,5,0,1,7,6,0,1,8,7,0,1,9,8,0,1,10,9,0,1,11,10,0,1,12,11,0,1,13,12,0,1,14,13,0,1,15,14,0,1,16,15,0,1,17,4,0,-1,17,17,5,15,17,17,8,12,17,17,5,14,17,17,5,0,17,17,9,12,17,17,5,16,17,17,5,13,17,17,5,16,17,17,7,6,17,17,6,13,17,17,7,7,17,17,5,13,17,17,5,5,17,17,6,0,17,17,7,8,17,17,5,5,17,17,5,6,17,17,6,13,17,17,6,2,17,17,5,4,17,17,8,11,17,17,5,3,17,17,5,6,17,17,6,7,17,17,6,9,17,17,5,0,17,17,7,0,17,17,6,10,17,17,5,7,17,17,5,15,17,17,8,0,17,17,6,15,17,17,5,11,17,17,7,11,17,17,9,11,17,17,5,14,17,17,6,7,17,17,6,11,17,17,5,11,17,17,5,10,17,17,5,8,17,17,7,14,17,17,5,9,17,17,5,3,17,17,10,10,17,17,10,3,17,17,5,11,17,17,7,16,17,17,9,0,17,17,6,6,17,17,5,5,17,17,8,3,17,17,5,5,17,17,8,0,17,17,6,0,17,17,8,7,17,17,5,0,17,17,5,14,17,17,5,6,17,17,5,3,17,17,5,14,17,17,6,0,17,17,6,7,17,17,5,15,17,17,6,10,17,17,7,4,17,17,5,0,17,17,5,11,17,17,5,0,17,17,6,3,17,17,5,0,17,17,11,3,17,17,6,6,17,17,5,4,17,17,13,10,17,17,5,5,17,17,5,10,17,17,9,15,17,17,5,16,17,17,5,4,17,17,5,12,17,17,5,8,17,17,6,14,17,17,5,10,17,17,10,16,17,17,5,16,17,17,6,8,17,17,5,7,17,17,5,6,17,17,7,0,17,17,1,-1};
+/* End of addition chain */
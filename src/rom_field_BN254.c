@@ -54,3 +54,7 @@ const BIG_256_56 Fra_BN254= {0x7DE6C06F2A6DE9L,0x74924D3F77C2E1L,0x50A846953F850
 const BIG_256_56 Frb_BN254= {0x82193F90D5922AL,0x8B6DB2C08850C5L,0x2F57B96AC8DC17L,0x1ED1837503EAB2L,0x9EBEE69L};
 #endif
 
+/* Addition chain for the fixed exponent used by FP_sqrt - generated by scripts/addchain.py */
+// 249 squarings and 24 multiplications, 9 temporaries
+const sign16 PChain_BN254[]= {27,1,0,1,-1,2,0,0,1,3,2,0,1,4,3,0,1,5,4,0,1,6,5,0,1,7,6,0,1,8,5,0,-1,8,8,5,5,8,8,4,0,8,8,4,6,8,8,6,5,8,8,9,5,8,8,33,7,8,8,4,7,8,8,7,7,8,8,7,5,8,8,4,6,8,8,36,0,8,8,6,2,8,8,8,5,8,8,5,0,8,8,47,5,8,8,4,7,8,8,5,4,8,8,52,0,8,8,2,-1};
+/* End of addition chain */
@@ -55,3 +55,7 @@ const BIG_256_56 Fra_BN254CX= {0xD9083355C80EA3L,0x7326F173F8215BL,0x8AACA718986
 const BIG_256_56 Frb_BN254CX= {0x8D1BBC06534710L,0x63C7269546C062L,0xD9CDBC4E3ABBD8L,0x623628A900DC53L,0x10A6F7D0L};
 #endif
 
+/* Addition chain for the fixed exponent used by FP_sqrt - generated by scripts/addchain.py */
+// 249 squarings and 48 multiplications, 18 temporaries
+const sign16 PChain_BN254CX[]= {51,1,0,1,-1,2,0,0,1,3,2,0,1,4,3,0,1,5,4,0,1,6,5,0,1,7,6,0,1,8,7,0,1,9,8,0,1,10,9,0,1,11,10,0,1,12,11,0,1,13,12,0,1,14,13,0,1,15,14,0,1,16,15,0,1,17,5,0,-1,17,17,31,0,17,17,7,4,17,17,11,11,17,17,7,2,17,17,6,14,17,17,9,12,17,17,5,12,17,17,6,16,17,17,6,13,17,17,7,8,17,17,6,10,17,17,8,14,17,17,7,14,17,17,6,10,17,17,6,5,17,17,9,16,17,17,5,15,17,17,6,14,17,17,5,12,17,17,6,2,17,17,11,5,17,17,6,8,17,17,5,12,17,17,6,2,17,17,6,16,17,17,7,13,17,17,5,9,17,17,8,16,17,17,5,8,17,17,6,12,17,17,10,14,17,17,6,11,17,17,6,14,17,17,2,-1};
+/* End of addition chain */
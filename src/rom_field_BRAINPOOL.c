@@ -42,3 +42,7 @@ const BIG_256_56 R2modp_BRAINPOOL= {0x9E04F49B9A3787L,0x29317218F3CF49L,0x54E8C3
 const chunk MConst_BRAINPOOL= 0xA75590CEFD89B9L;
 #endif
 
+/* Addition chain for the fixed exponent used by FP_sqrt - generated by scripts/addchain.py */
+// 252 squarings and 56 multiplications, 18 temporaries
+const sign16 PChain_BRAINPOOL[]= {58,1,0,1,-1,2,0,0,1,3,2,0,1,4,3,0,1,5,4,0,1,6,5,0,1,7,6,0,1,8,7,0,1,9,8,0,1,10,9,0,1,11,10,0,1,12,11,0,1,13,12,0,1,14,13,0,1,15,14,0,1,16,15,0,1,17,3,0,-1,17,17,5,5,17,17,5,16,17,17,5,7,17,17,6,12,17,17,5,14,17,17,6,15,17,17,6,2,17,17,5,14,17,17,5,11,17,17,6,10,17,17,5,8,17,17,7,4,17,17,5,13,17,17,5,10,17,17,8,3,17,17,5,5,17,17,8,5,17,17,5,14,17,17,8,4,17,17,5,2,17,17,6,12,17,17,6,5,17,17,5,12,17,17,5,2,17,17,5,12,17,17,5,15,17,17,5,9,17,17,7,8,17,17,6,11,17,17,6,5,17,17,5,9,17,17,10,3,17,17,6,0,17,17,13,10,17,17,5,5,17,17,11,15,17,17,8,16,17,17,5,7,17,17,5,13,17,17,6,10,17,17,6,15};
+/* End of addition chain */
@@ -53,3 +53,7 @@ const BIG_256_56 Frb_FP256BN= {0xB32AB2FF3EFF0DL,0xF4A9F45D57F35EL,0xD113693CCFD
 
 #endif
 
+/* Addition chain for the fixed exponent used by FP_sqrt - generated by scripts/addchain.py */
+// 255 squarings and 56 multiplications, 18 temporaries
+const sign16 PChain_FP256BN[]= {59,1,0,1,-1,2,0,0,1,3,2,0,1,4,3,0,1,5,4,0,1,6,5,0,1,7,6,0,1,8,0,1,0,9,8,2,8,10,9,1,0,11,10,5,10,12,11,1,0,13,12,11,12,14,13,1,0,15,14,23,14,16,10,1,0,17,15,0,-1,17,17,6,9,17,17,6,2,17,17,4,2,17,17,4,3,17,17,4,0,17,17,4,6,17,17,4,5,17,17,6,10,17,17,6,5,17,17,5,9,17,17,4,4,17,17,4,4,17,17,5,4,17,17,7,7,17,17,6,5,17,17,7,10,17,17,6,2,17,17,4,2,17,17,4,4,17,17,4,0,17,17,4,5,17,17,7,16,17,17,3,2,17,17,4,0,17,17,5,3,17,17,4,2,17,17,8,0,17,17,4,3,17,17,9,6,17,17,5,5,17,17,4,5,17,17,5,5,17,17,6,6,17,17,4,4,17,17,5,7,17,17,4,7,17,17,4,4,17,17,5,7,17,17,4,2,17,17,4,2,17,17,8,0,17,17,2,-1};
+/* End of addition chain */
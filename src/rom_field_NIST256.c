@@ -44,3 +44,7 @@ const chunk MConst_NIST256= 0x1L;
 
 #endif
 
+/* Addition chain for the fixed exponent used by FP_sqrt - generated by scripts/addchain.py */
+// 251 squarings and 39 multiplications, 10 temporaries
+const sign16 PChain_NIST256[]= {41,1,0,1,-1,2,0,0,1,3,2,0,1,4,3,0,1,5,4,0,1,6,5,0,1,7,6,0,1,8,7,0,1,9,8,0,-1,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8,9,9,32,0,9,9,98,2,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8,9,9,4,8};
+/* End of addition chain */
@@ -43,4 +43,7 @@ const chunk MConst_NIST384= 0x100000001L;
 
 #endif
 
-
+/* Addition chain for the fixed exponent used by FP_sqrt - generated by scripts/addchain.py */
+// 382 squarings and 17 multiplications, 17 temporaries
+const sign16 PChain_NIST384[]= {18,1,0,1,0,2,1,1,0,3,2,3,2,4,3,1,0,5,4,7,4,6,5,1,0,7,6,15,6,8,7,1,0,9,8,31,8,10,9,1,0,11,10,63,10,12,11,1,0,13,12,127,12,14,13,1,0,15,8,1,0,16,14,0,-1,16,16,33,15,16,16,94,7};
+/* End of addition chain */
@@ -45,3 +45,7 @@ const chunk MConst_SECP256K1= 0x38091DD2253531L;
 
 #endif
 
+/* Addition chain for the fixed exponent used by FP_sqrt - generated by scripts/addchain.py */
+// 254 squarings and 26 multiplications, 19 temporaries
+const sign16 PChain_SECP256K1[]= {28,1,0,1,-1,2,0,0,1,3,2,0,1,4,3,0,1,5,0,1,0,6,5,1,0,7,6,3,6,8,7,6,7,9,8,1,0,10,9,13,9,11,10,1,0,12,11,27,11,13,12,1,0,14,13,55,13,15,14,1,0,16,15,111,15,17,16,1,0,18,17,0,-1,18,18,2,0,18,18,3,4,18,18,3,4,18,18,3,4,18,18,3,4,18,18,3,4,18,18,3,4,18,18,3,4,18,18,5,0,18,18,3,2};
+/* End of addition chain */
@@ -111,7 +111,7 @@ const BIG_384_29 SSWU_A2im_BLS381 = {0x000000f0, 0x00000000, 0x00000000, 0x00000
 const BIG_384_29 SSWU_B2re_BLS381 = {0x000003f4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0};
 const BIG_384_29 SSWU_B2im_BLS381 = {0x000003f4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0};
 const BIG_384_29 SSWU_Z2re_BLS381 = {0x1fffaaa9, 0x0ff7ffff, 0x14ffffee, 0x17fffd62, 0x0f6241ea, 0x9507b58, 0x0afd9cc3, 0x109e70a2, 0x1764774b, 0x121a5d66, 0x12c6e9ed, 0x12ffcd34, 0x00111ea3, 0xd};
-const BIG_384_29 SSWU_Z2re_BLS381 = {0x1fffaaaa, 0x0ff7ffff, 0x14ffffee, 0x17fffd62, 0x0f6241ea, 0x9507b58, 0x0afd9cc3, 0x109e70a2, 0x1764774b, 0x121a5d66, 0x12c6e9ed, 0x12ffcd34, 0x00111ea3, 0xd};
+const BIG_384_29 SSWU_Z2im_BLS381 = {0x1fffaaaa, 0x0ff7ffff, 0x14ffffee, 0x17fffd62, 0x0f6241ea, 0x9507b58, 0x0afd9cc3, 0x109e70a2, 0x1764774b, 0x121a5d66, 0x12c6e9ed, 0x12ffcd34, 0x00111ea3, 0xd};
 
 const BIG_384_29 ISO3_XNUMre_BLS381[4] = {
   {0x0aaa97d6, 0x11c55555, 0x1671c718, 0x0c71c687, 0x0e15d5c2, 0x0211e285, 0x10aa22d6, 0x073fa740, 0x0532c52d, 0x123ebf6c, 0x0ed6dea6, 0x1d1c667d, 0x1c759507, 0x2},
@@ -159,6 +159,128 @@ const BIG_384_29 ISO3_YDENim_BLS381[3] = {
   {0x1fffaa99, 0x0ff7ffff, 0x14ffffee, 0x17fffd62, 0x0f6241ea, 0x09507b58, 0x0afd9cc3, 0x109e70a2, 0x1764774b, 0x121a5d66, 0x12c6e9ed, 0x12ffcd34, 0x00111ea3, 0xd}
 };
 
+// SSWU and isogeny constants in Montgomery form, for ECP_BLS381_map2point and ECP2_BLS381_map2point
+const BIG_384_29 SSWU_A1_NRES_BLS381 = {0x13bc8072, 0x1285ebe0, 0x048d105f, 0x0883192e, 0x01b8e055, 0x1d85c751, 0x05a83692, 0x0cd3568f, 0x105f086f, 0x1811b62c, 0x0a2b0fdf, 0x0f0771a0, 0x1de65f56, 0x0};
+const BIG_384_29 SSWU_B1_NRES_BLS381 = {0x0ef0a90a, 0x0b0c456e, 0x16d1f00b, 0x079c5aff, 0x0e331e91, 0x02b6c169, 0x10d3fa0f, 0x1f6414e2, 0x1caa1a90, 0x15e94ca2, 0x102a5e01, 0x1d93db20, 0x07350e2e, 0x0};
+const BIG_384_29 SSWU_Z1_NRES_BLS381 = {0x08507954, 0x00204831, 0x05cbe2eb, 0x08db3164, 0x0f99c38b, 0x123b5c94, 0x16d18086, 0x19b837b4, 0x132171cc, 0x12a13909, 0x14ac92ec, 0x17d3ff11, 0x117c6c8a, 0x1};
+const BIG_384_29 SSWU_C1_NRES_BLS381 = {0x10da6d79, 0x07c76e4b, 0x069bbeec, 0x009ffb39, 0x05d235b0, 0x00a42b8a, 0x0e5be976, 0x1c8918a1, 0x05cdaf0a, 0x0a643055, 0x0f7bc2cb, 0x1a6ab90a, 0x15420bcd, 0x0};
+
+const BIG_384_29 ISO11_XNUM_NRES_BLS381[12] = {
+  {0x19533850, 0x1fde0061, 0x1658849c, 0x0468a403, 0x03312074, 0x0755dadb, 0x0f9d5f6a, 0x0d765d96, 0x1f3db0eb, 0x027072a2, 0x0cd72ecf, 0x192a1295, 0x0b9df03d, 0x0},
+  {0x08a13a19, 0x0e61b7a9, 0x10c7b287, 0x19352d6c, 0x19fcef3a, 0x1bd60694, 0x0b00008b, 0x14ac9157, 0x1bfc81b7, 0x0cf31437, 0x1f7ef30c, 0x174125b4, 0x16bc996b, 0x3},
+  {0x1d34d585, 0x001816fd, 0x0697e05d, 0x0bd01a7f, 0x06319923, 0x0526b67e, 0x127cdfde, 0x1c4ccaed, 0x16999bd6, 0x1dc05cf6, 0x0c798715, 0x1b067cad, 0x0e1b22d3, 0x1},
+  {0x05b95fd0, 0x1561eeae, 0x0708c4e2, 0x1ca04592, 0x0a64d8b5, 0x161de6c8, 0x0ed13a80, 0x1c0b9393, 0x1f81aea0, 0x1f7805d0, 0x1f7443d4, 0x0410f2d9, 0x12d9db9f, 0x4},
+  {0x19f42c99, 0x19554edb, 0x01bb4832, 0x08df9f46, 0x1aa4ed11, 0x0c014ee5, 0x0503d165, 0x024ff2c0, 0x014d2026, 0x038449cb, 0x004265ae, 0x075ca7f4, 0x0abdbe88, 0xc},
+  {0x06e086cb, 0x12e06cf1, 0x1010c3f7, 0x097dc760, 0x009ce362, 0x1fdead02, 0x03b2a43c, 0x13dc159a, 0x12f1e75f, 0x0c59d18b, 0x0993cd0d, 0x17aada76, 0x0f653a62, 0xa},
+  {0x05f32e93, 0x04de80d5, 0x0257dd44, 0x1b3fa578, 0x08ad968d, 0x18f7fcf4, 0x135a2c12, 0x1b3437df, 0x1bf48b7f, 0x027e482c, 0x10ad5b95, 0x1f53c6ec, 0x13593fac, 0xc},
+  {0x100e8415, 0x00260d8a, 0x0416be13, 0x002f5de8, 0x12f06c69, 0x0614ac97, 0x078c4e2c, 0x0f0e1a44, 0x12527cbf, 0x1aa0dad8, 0x1b9d18c9, 0x03052990, 0x06c178c5, 0x8},
+  {0x020e35ff, 0x1509aba1, 0x011197a7, 0x07424063, 0x00fdf22a, 0x1cdffda5, 0x15e86ee3, 0x0dc72f5e, 0x085ed13b, 0x17a167e6, 0x1d4f68a3, 0x12bc0758, 0x0da1d102, 0xb},
+  {0x16f92abf, 0x1d97eb20, 0x03799de9, 0x0afdfcdb, 0x0593e7ab, 0x1c07c98e, 0x113c6b21, 0x0c6c4382, 0x15178c4b, 0x004d295b, 0x160c0213, 0x0b223d3c, 0x138a06ae, 0x5},
+  {0x0d584f0e, 0x13abb276, 0x114fd2fd, 0x13587172, 0x1c078395, 0x19d77f56, 0x14ed4ae3, 0x134b5001, 0x07368705, 0x08ccfc06, 0x169d5582, 0x04364b97, 0x1e36a0ac, 0xc},
+  {0x1e2dc07e, 0x14fb1b8e, 0x1d54c7fd, 0x1ffe9f96, 0x1d9e8c8e, 0x082c550d, 0x10f80cc9, 0x0fbb5189, 0x1731633c, 0x0d2b8d78, 0x1142fdc6, 0x0a530186, 0x09b1edb4, 0x3}
+};
+
+const BIG_384_29 ISO11_XDEN_NRES_BLS381[10] = {
+  {0x16aada94, 0x121b61fb, 0x17d25789, 0x00ea9a1b, 0x01f559e5, 0x1977be06, 0x17199839, 0x0b55fcac, 0x001b9b0e, 0x101b75eb, 0x0b9bd0a9, 0x1276bf47, 0x14703656, 0x2},
+  {0x109ff044, 0x10ea0db9, 0x1f93b8bd, 0x1ef8d6d2, 0x1ad8ab3c, 0x1cd635f7, 0x1ebd2c90, 0x01e90c38, 0x12519856, 0x1002aed7, 0x0d3b5c6f, 0x0cb89003, 0x0ed3e5c4, 0xa},
+  {0x0f77e4d1, 0x08f1403d, 0x1b1578a2, 0x134e8b79, 0x11c5fe2a, 0x1af37000, 0x061d1654, 0x0f79cc45, 0x1fcafbd1, 0x00394301, 0x1c85638f, 0x02143baa, 0x0fd37998, 0x7},
+  {0x16688f1e, 0x1834f256, 0x033c4e2e, 0x1b7c3ab5, 0x0aef9a87, 0x16e2b034, 0x04ea8170, 0x0b5ed828, 0x109f419c, 0x1b1ce49f, 0x0b8d1767, 0x1f6a5c83, 0x08c7b891, 0xc},
+  {0x0cfbd1b4, 0x13f5968c, 0x04d98113, 0x078bb5a2, 0x0a047c3a, 0x1f58a89a, 0x14970a3f, 0x070dc778, 0x05a639fa, 0x1e4df2a1, 0x15236253, 0x006cbe19, 0x0747e1aa, 0x0},
+  {0x1ba56c55, 0x0da2285e, 0x1bdde522, 0x1323e0bf, 0x14fcd4df, 0x160d9669, 0x126e3cb8, 0x1ae38ab4, 0x043ccd6c, 0x1c50479d, 0x03ccf828, 0x14a8dc86, 0x0baa345e, 0x5},
+  {0x1763cc52, 0x1af364d0, 0x0d599836, 0x01b13b47, 0x19625c2c, 0x0c93c70f, 0x1981cf56, 0x16ce23d0, 0x116786d9, 0x1b64f75f, 0x0396c2e5, 0x17ce2455, 0x137ac25c, 0xc},
+  {0x135eaa4e, 0x11a0ee2c, 0x1c8ae208, 0x04908755, 0x0742ff48, 0x1aa65057, 0x1ccabcc6, 0x0ca2e07c, 0x0a7fdbf0, 0x065f3fd1, 0x09b8d593, 0x11ab564e, 0x1b009d39, 0xa},
+  {0x04b0c530, 0x0ab8267d, 0x03c5d708, 0x0859392a, 0x05ae9638, 0x1db0f3d5, 0x0b1bdfc7, 0x0c8c0cf0, 0x192090dd, 0x0f85b4e6, 0x09cb08bd, 0x0e6aeeeb, 0x05feaf09, 0x5},
+  {0x0ee55d76, 0x0fe759f8, 0x16bac213, 0x04ced8e4, 0x097e4bac, 0x19215e96, 0x1d46ea21, 0x145404ae, 0x11ade63f, 0x0c8756c9, 0x031fc337, 0x15c18a0e, 0x1fcb94ac, 0x5}
+};
+
+const BIG_384_29 ISO11_YNUM_NRES_BLS381[16] = {
+  {0x0b562e5f, 0x1edd073b, 0x15ed6da0, 0x0988f118, 0x0ddfa739, 0x125d94e8, 0x003c1a9a, 0x0acc9108, 0x1b2de435, 0x009cd507, 0x0454f8ee, 0x1fdd2cf0, 0x0dcd5c4f, 0x4},
+  {0x181f0243, 0x190284d7, 0x0862b516, 0x0023aea2, 0x09d71104, 0x1f047ce5, 0x1757a33f, 0x0cdb9266, 0x090e6ff8, 0x03bce62b, 0x0ff1df5d, 0x1d0849c4, 0x1e947940, 0xa},
+  {0x0f70f454, 0x1c74ba6f, 0x00998537, 0x178c74bc, 0x0b7defa6, 0x08b27cfc, 0x0bdc130a, 0x1794bd91, 0x1ff1d6f6, 0x1be3acf9, 0x11a31ddf, 0x16a3c271, 0x196a0c9b, 0x0},
+  {0x0adfb92c, 0x0f5f5fc8, 0x0bbe0d88, 0x1a8b3c9a, 0x1ab211e6, 0x1ff2f2e4, 0x05c8e63c, 0x1fa3fc70, 0x1446e10e, 0x0694971e, 0x0c471f80, 0x1042435c, 0x02e73d99, 0x4},
+  {0x13d41be9, 0x022714b9, 0x0d287f0f, 0x18129307, 0x0c11b648, 0x06c075ec, 0x0d6a03c2, 0x1676cd23, 0x18911911, 0x0010d034, 0x0095d895, 0x003c1f93, 0x174481f8, 0x2},
+  {0x19885db6, 0x19123786, 0x14a8da09, 0x09db4643, 0x1f11f1c5, 0x147bfb9e, 0x17ca38f7, 0x12045852, 0x06a9e951, 0x09ad1d16, 0x09c2525c, 0x08e42222, 0x00c833f8, 0x6},
+  {0x12f92bab, 0x19a74fe6, 0x0caf6778, 0x0c97f667, 0x1a371832, 0x0674dca5, 0x0fdfa163, 0x0be02b36, 0x0364d6f4, 0x01d55bc5, 0x17aab179, 0x00c3030b, 0x04fe7503, 0x5},
+  {0x0c057247, 0x1f4789e1, 0x1410a071, 0x18f1e7ce, 0x145dbf15, 0x1cfb95b5, 0x185aac05, 0x162b76cb, 0x0bd8a94d, 0x0c43c58e, 0x1e105956, 0x16340caa, 0x02e210c1, 0x2},
+  {0x1dc36c81, 0x0c841b45, 0x1b890ed2, 0x1558a1dd, 0x1a450771, 0x0d3b3fb3, 0x189e5900, 0x1ebbf27e, 0x1d2dd460, 0x0da328f1, 0x1962016a, 0x138fc8cb, 0x1516f7cd, 0x9},
+  {0x07d8a93e, 0x02a825c4, 0x1a7d15b5, 0x11ff7171, 0x018126bc, 0x10318962, 0x1ffd5c70, 0x12504388, 0x113350c6, 0x1805c7da, 0x04991525, 0x1c465cc0, 0x1389b8ae, 0x2},
+  {0x11bbed0a, 0x1c23e2d3, 0x09858a8d, 0x1db7604f, 0x1af84d04, 0x1150e938, 0x0af6da02, 0x055e2c34, 0x069ba88f, 0x05539ac0, 0x15c472b1, 0x18b3e74d, 0x1f940028, 0x3},
+  {0x1f9d2621, 0x1cff148a, 0x0ab71b97, 0x03cdfcd9, 0x044b66f9, 0x1043f639, 0x0b29e887, 0x0a6a335a, 0x118c16ba, 0x14839731, 0x1aaa1110, 0x052e8b92, 0x0ec784c3, 0x1},
+  {0x177f85cb, 0x05068c4e, 0x127902ea, 0x1c1fa404, 0x15a72b29, 0x1e34c739, 0x10f47faa, 0x1ac6c7aa, 0x07a2dbee, 0x16cc76dc, 0x04608046, 0x0ba1d060, 0x103439db, 0x3},
+  {0x03bbb6d6, 0x0661aca9, 0x13ee9a8f, 0x16f214d6, 0x08bcd49c, 0x0993bf04, 0x0924c855, 0x199bbc1b, 0x1b1a3dd2, 0x1711c0ba, 0x0b77c91e, 0x12384afd, 0x1f384b81, 0x4},
+  {0x04ba7763, 0x15948110, 0x1e5c56ed, 0x158c0e84, 0x17f6358c, 0x16e93294, 0x16d9abf1, 0x0ff26e0c, 0x0f4ee0b3, 0x0d99e73d, 0x1417f7ff, 0x160754ed, 0x0fc7db3b, 0x6},
+  {0x1fd585dd, 0x0643310c, 0x0e3640b5, 0x1ae8996e, 0x06e36492, 0x11d4295f, 0x15fea047, 0x14820edb, 0x1cda1248, 0x0050f7c9, 0x1825110d, 0x179320d4, 0x1b14d825, 0x3}
+};
+
+const BIG_384_29 ISO11_YDEN_NRES_BLS381[15] = {
+  {0x0da9594e, 0x1b3fca9b, 0x027cf957, 0x1c0d7016, 0x1a8b54fd, 0x058c7c17, 0x0029bdda, 0x0fc61f0c, 0x11c0fa81, 0x0a80accd, 0x03c9c3c9, 0x1cf50d13, 0x0aeb7381, 0x3},
+  {0x1ba8230b, 0x05a26bda, 0x0db9fda9, 0x07d37528, 0x1b6c95d4, 0x17092c6f, 0x0d89ba89, 0x09167d79, 0x045fc21c, 0x19fb2730, 0x08b7bd44, 0x1a563ce5, 0x1ac794a4, 0x6},
+  {0x18b3e3a0, 0x04e8e016, 0x030a6e2c, 0x1d3da584, 0x1eb4d64e, 0x111f8eaf, 0x15f0e09a, 0x1a850d5a, 0x0d403b55, 0x1bffb73d, 0x0eec2b6d, 0x1c9409f5, 0x1d7d748c, 0x2},
+  {0x169ab582, 0x1a46ebb6, 0x000490dd, 0x18dfea44, 0x0b5532b5, 0x18f13aad, 0x047ca973, 0x0ea1043c, 0x0a11d1b6, 0x1bb4990f, 0x0859c4ed, 0x1f982f9b, 0x1c2083e2, 0x1},
+  {0x10fe807e, 0x1174cff9, 0x05d421db, 0x1b571b2c, 0x19f23111, 0x0294ca8b, 0x19c6cdae, 0x185edb16, 0x1a63213f, 0x016bb615, 0x0b2da2bc, 0x00e5bcd4, 0x051e37f3, 0xc},
+  {0x14e9efb9, 0x16856bcd, 0x04fccbca, 0x135bf315, 0x1b5eedd7, 0x1728bd61, 0x09b114a2, 0x014655b5, 0x0bac621e, 0x06a256d9, 0x00686366, 0x14fe0d0c, 0x012cf752, 0x8},
+  {0x1fadbd48, 0x17ff5c31, 0x03c6778c, 0x14a739ce, 0x0716617e, 0x03df976f, 0x06a7a5e7, 0x146ee407, 0x18dd4264, 0x05fcc0fd, 0x15ac7dec, 0x1a777345, 0x17b4cabc, 0xc},
+  {0x0b2880e2, 0x0787181f, 0x045238d7, 0x1de6fbe1, 0x0980c611, 0x08e7ac86, 0x0a213615, 0x18285abb, 0x0dc6bbb0, 0x1f13d948, 0x1ea74a9d, 0x07c4add9, 0x128b8b48, 0xc},
+  {0x0d6cbbc7, 0x1b30ea09, 0x136f51cc, 0x080d9b85, 0x14dab9df, 0x1e909c41, 0x0a39b93f, 0x1384630d, 0x00a89a34, 0x18a975ba, 0x00aaa7fe, 0x16e20c79, 0x0eec57ca, 0x7},
+  {0x12433932, 0x0be3edae, 0x18245f51, 0x0122731e, 0x1daea342, 0x1e86f2d5, 0x1db0574d, 0x03a6360a, 0x182dba7e, 0x0af3db92, 0x18298d2a, 0x0be35cb4, 0x169c548a, 0x6},
+  {0x039fb7f2, 0x065bfb27, 0x0e30479e, 0x046664ce, 0x118cf41e, 0x0e56e2cb, 0x005754f5, 0x1768df97, 0x0241d34f, 0x14eedee2, 0x1e943a4b, 0x18548d26, 0x14bc000c, 0x6},
+  {0x10b860a4, 0x05987130, 0x1b05a2fc, 0x0575249c, 0x0d981364, 0x1bf7e815, 0x1ffb86a1, 0x0bb228d6, 0x1af6f7e3, 0x0db1c614, 0x1a8765e4, 0x0530ff94, 0x1c65179c, 0x1},
+  {0x14c4cda7, 0x06a68a23, 0x1e262372, 0x13a0a454, 0x1ea6e7c3, 0x1ceb6ab6, 0x1ed13ab0, 0x113f68aa, 0x0df090f9, 0x195a7fd5, 0x0a683cbf, 0x1301752d, 0x08f5c40d, 0x3},
+  {0x00c708fe, 0x0172af40, 0x1d438969, 0x1e5b5d12, 0x14ace123, 0x03c926af, 0x0eebcec2, 0x0c1e09dd, 0x0546c145, 0x1a7934c1, 0x1bc5fb5d, 0x0ce135ca, 0x026ae787, 0x2},
+  {0x16580c31, 0x07db06f4, 0x0218231d, 0x07364557, 0x0e3d7182, 0x15b20de1, 0x0bea5f32, 0x0e7e0706, 0x0a84d95f, 0x02cb022e, 0x04afa4d3, 0x00a24f15, 0x1fb15f03, 0x8}
+};
+
+const BIG_384_29 SSWU_A2re_NRES_BLS381 = {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0};
+const BIG_384_29 SSWU_A2im_NRES_BLS381 = {0x0f96cb85, 0x1b8e271b, 0x1c606e60, 0x0c22c7ae, 0x02fb1fe4, 0x1cbdfafd, 0x13f81652, 0x0b45aaef, 0x1c5776d2, 0x12c2b160, 0x0958a485, 0x0ab4c574, 0x1a70af2a, 0x1};
+const BIG_384_29 SSWU_B2re_NRES_BLS381 = {0x1ceeef82, 0x0be9f1b3, 0x03458d23, 0x1ec5da26, 0x016bb2e1, 0x103073e8, 0x056210bb, 0x18039e9a, 0x16183ca6, 0x1ce8d96f, 0x123fa9bd, 0x1231a649, 0x080bcf78, 0xc};
+const BIG_384_29 SSWU_B2im_NRES_BLS381 = {0x1ceeef82, 0x0be9f1b3, 0x03458d23, 0x1ec5da26, 0x016bb2e1, 0x103073e8, 0x056210bb, 0x18039e9a, 0x16183ca6, 0x1ce8d96f, 0x123fa9bd, 0x1231a649, 0x080bcf78, 0xc};
+const BIG_384_29 SSWU_Z2re_NRES_BLS381 = {0x18ab5e4e, 0x08aff2df, 0x1bdaedfa, 0x114c813a, 0x19eb17ac, 0x07957843, 0x1eefe10c, 0x074c334e, 0x1da5151b, 0x0f36e2c1, 0x1ad8c1f9, 0x177c418d, 0x19f2b728, 0x6};
+const BIG_384_29 SSWU_Z2im_NRES_BLS381 = {0x1c55af27, 0x0457f96f, 0x0ded76fd, 0x08a6409d, 0x1cf58bd6, 0x03cabc21, 0x0f77f086, 0x13a619a7, 0x1ed28a8d, 0x179b7160, 0x1d6c60fc, 0x0bbe20c6, 0x0cf95b94, 0x3};
+const BIG_384_29 SSWU_C2_NRES_BLS381 = {0x1019c901, 0x18e69460, 0x1f1b22a8, 0x17f50576, 0x1371b042, 0x0a70ade2, 0x0a91ce55, 0x05095444, 0x16ee8801, 0x07bd0e8c, 0x00670382, 0x179fc121, 0x16f095df, 0x1};
+
+const BIG_384_29 ISO3_XNUMre_NRES_BLS381[4] = {
+  {0x183d0033, 0x1971c13c, 0x14c768a6, 0x1e820c95, 0x112ac16c, 0x1030d8bf, 0x0dc1e2f2, 0x16c3e87f, 0x1ddd0614, 0x1e6ac4b4, 0x07233472, 0x01e81c9a, 0x1fb353bb, 0x1},
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0},
+  {0x1a381677, 0x1f82b36a, 0x0d18b69c, 0x0c77a73b, 0x13703222, 0x19978080, 0x165db165, 0x01164e6d, 0x03a113e4, 0x1d4b1b90, 0x0b8bbdf1, 0x0e024c2b, 0x0ec4a488, 0x8},
+  {0x122f08fc, 0x01438ef3, 0x0c57647d, 0x01b4a0df, 0x0fb8c09a, 0x1aabbbc6, 0x1e9af3d0, 0x11fdc31d, 0x05bed9ad, 0x130917ea, 0x0f81fb98, 0x1feaad1e, 0x13f569cb, 0xc}
+};
+const BIG_384_29 ISO3_XNUMim_NRES_BLS381[4] = {
+  {0x183d0033, 0x1971c13c, 0x14c768a6, 0x1e820c95, 0x112ac16c, 0x1030d8bf, 0x0dc1e2f2, 0x16c3e87f, 0x1ddd0614, 0x1e6ac4b4, 0x07233472, 0x01e81c9a, 0x1fb353bb, 0x1},
+  {0x0b8f2868, 0x00ea992a, 0x0fce92a3, 0x1710ac4e, 0x17e41f90, 0x1f71f5af, 0x093fd6ba, 0x1f104469, 0x0786c6ce, 0x099e83ad, 0x0e7657f7, 0x09fb0212, 0x0298f436, 0x9},
+  {0x05c79434, 0x10754c95, 0x07e74951, 0x0b885627, 0x1bf20fc8, 0x0fb8fad7, 0x149feb5d, 0x0f882234, 0x13c36367, 0x14cf41d6, 0x073b2bfb, 0x04fd8109, 0x114c7a1b, 0x4},
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0}
+};
+const BIG_384_29 ISO3_XDENre_NRES_BLS381[2] = {
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0},
+  {0x0bfa74d8, 0x0bc04ec1, 0x0cde6bdc, 0x1834ee29, 0x0206799f, 0x17c11bcb, 0x12572cc3, 0x16b08eaf, 0x0bb35e8a, 0x0d20250f, 0x0a071bdd, 0x1f15ab7f, 0x04942f99, 0xb}
+};
+const BIG_384_29 ISO3_XDENim_NRES_BLS381[2] = {
+  {0x181f42f2, 0x194e2777, 0x10c9786c, 0x1ec25b57, 0x1026b1c1, 0x095c3d50, 0x13e69ffd, 0x1b934bb0, 0x06269484, 0x1ddd520c, 0x147ed460, 0x177cca3f, 0x04ed9a39, 0xb},
+  {0x140535d3, 0x0437b13e, 0x08219412, 0x1fcb0f39, 0x0d5bc84a, 0x118f5f8d, 0x18a66fff, 0x19ede1f2, 0x0bb118c0, 0x04fa3857, 0x08bfce10, 0x13ea21b5, 0x1b7cef09, 0x1}
+};
+const BIG_384_29 ISO3_YNUMre_NRES_BLS381[4] = {
+  {0x03b4766f, 0x1f13f929, 0x1be7cb0b, 0x0e355615, 0x0aa2afae, 0x06181d5e, 0x13a84471, 0x176a233b, 0x0bd7e7ed, 0x148b6cc9, 0x11cba394, 0x024f0f99, 0x1ab78276, 0x4},
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0},
+  {0x12e3ca1a, 0x183aa64a, 0x13f3a4a8, 0x05c42b13, 0x1df907e4, 0x17dc7d6b, 0x0a4ff5ae, 0x17c4111a, 0x09e1b1b3, 0x1a67a0eb, 0x139d95fd, 0x127ec084, 0x08a63d0d, 0x2},
+  {0x0f455257, 0x1a36d059, 0x063833c4, 0x02191d18, 0x0a24ac62, 0x006c9216, 0x0b74a0d3, 0x0a9f2f98, 0x157a2ebc, 0x0bc20018, 0x02f0eb65, 0x1306e8d5, 0x1969fb5f, 0x8}
+};
+const BIG_384_29 ISO3_YNUMim_NRES_BLS381[4] = {
+  {0x03b4766f, 0x1f13f929, 0x1be7cb0b, 0x0e355615, 0x0aa2afae, 0x06181d5e, 0x13a84471, 0x176a233b, 0x0bd7e7ed, 0x148b6cc9, 0x11cba394, 0x024f0f99, 0x1ab78276, 0x4},
+  {0x00476bd9, 0x01e123ba, 0x050a90cb, 0x1e182b08, 0x0be25202, 0x134f97da, 0x1f0ec2f1, 0x0a9fac64, 0x153f3796, 0x085f3563, 0x18a2d093, 0x09bc6004, 0x16ad31ce, 0x5},
+  {0x0d1be091, 0x17bd59b5, 0x010c5b45, 0x123bd24f, 0x11693a06, 0x1173fdec, 0x00ada714, 0x18da5f88, 0x0d82c597, 0x17b2bc7b, 0x1f2953ef, 0x00810caf, 0x176ae196, 0xa},
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0}
+};
+const BIG_384_29 ISO3_YDENre_NRES_BLS381[3] = {
+  {0x10bd3c55, 0x07fcecce, 0x1bb8d2e4, 0x008e311f, 0x13fce0f6, 0x09970728, 0x0073b01f, 0x125b92f8, 0x0ff126a3, 0x18ac1947, 0x1d1668a1, 0x0dedbb76, 0x1d3c0428, 0x1},
+  {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0},
+  {0x01f80499, 0x01a87622, 0x0e4da1dc, 0x1c4f67db, 0x03a77484, 0x0a512e58, 0x00852662, 0x116a6565, 0x0a289684, 0x1195da30, 0x0c43bfde, 0x0ba0b40a, 0x16cd28c3, 0x3}
+};
+const BIG_384_29 ISO3_YDENim_NRES_BLS381[3] = {
+  {0x10bd3c55, 0x07fcecce, 0x1bb8d2e4, 0x008e311f, 0x13fce0f6, 0x09970728, 0x0073b01f, 0x125b92f8, 0x0ff126a3, 0x18ac1947, 0x1d1668a1, 0x0dedbb76, 0x1d3c0428, 0x1},
+  {0x085e7380, 0x0bfa7667, 0x085c6969, 0x0c471741, 0x11af9170, 0x0973c140, 0x05b8a671, 0x117d01cd, 0x03aacef7, 0x15633b57, 0x17eea947, 0x0076c455, 0x0ea69166, 0x7},
+  {0x1e07a612, 0x0e4f89dd, 0x06b25e12, 0x1bb09587, 0x0bbacd65, 0x1eff4d00, 0x0a787660, 0x1f340b3d, 0x0d3be0c6, 0x00848336, 0x06832a0f, 0x075f192a, 0x0943f5e0, 0x9}
+};
+
 #endif
 
 #if CHUNK==64
@@ -291,4 +413,126 @@ const BIG_384_58 ISO3_YDENim_BLS381[3] = {
   {0x1feffffffffaa99L, 0x2ffffac54ffffeeL, 0x12a0f6b0f6241eaL, 0x213ce144afd9cc3L, 0x2434bacd764774bL, 0x25ff9a692c6e9edL, 0x1a0111ea3L}
 };
 
+// SSWU and isogeny constants in Montgomery form, for ECP_BLS381_map2point and ECP2_BLS381_map2point
+const BIG_384_58 SSWU_A1_NRES_BLS381 = {0x250bd7c13bc8072L, 0x1106325c48d105fL, 0x3b0b8ea21b8e055L, 0x19a6ad1e5a83692L, 0x30236c5905f086fL, 0x1e0ee340a2b0fdfL, 0x01de65f56L};
+const BIG_384_58 SSWU_B1_NRES_BLS381 = {0x16188adcef0a90aL, 0x0f38b5ff6d1f00bL, 0x056d82d2e331e91L, 0x3ec829c50d3fa0fL, 0x2bd29945caa1a90L, 0x3b27b64102a5e01L, 0x007350e2eL};
+const BIG_384_58 SSWU_Z1_NRES_BLS381 = {0x004090628507954L, 0x11b662c85cbe2ebL, 0x2476b928f99c38bL, 0x33706f696d18086L, 0x2542721332171ccL, 0x2fa7fe234ac92ecL, 0x0317c6c8aL};
+const BIG_384_58 SSWU_C1_NRES_BLS381 = {0x0f8edc970da6d79L, 0x013ff67269bbeecL, 0x014857145d235b0L, 0x39123142e5be976L, 0x14c860aa5cdaf0aL, 0x34d57214f7bc2cbL, 0x015420bcdL};
+
+const BIG_384_58 ISO11_XNUM_NRES_BLS381[12] = {
+  {0x3fbc00c39533850L, 0x08d14807658849cL, 0x0eabb5b63312074L, 0x1aecbb2cf9d5f6aL, 0x04e0e545f3db0ebL, 0x3254252acd72ecfL, 0x00b9df03dL},
+  {0x1cc36f528a13a19L, 0x326a5ad90c7b287L, 0x37ac0d299fcef3aL, 0x295922aeb00008bL, 0x19e6286fbfc81b7L, 0x2e824b69f7ef30cL, 0x076bc996bL},
+  {0x00302dfbd34d585L, 0x17a034fe697e05dL, 0x0a4d6cfc6319923L, 0x389995db27cdfdeL, 0x3b80b9ed6999bd6L, 0x360cf95ac798715L, 0x02e1b22d3L},
+  {0x2ac3dd5c5b95fd0L, 0x39408b24708c4e2L, 0x2c3bcd90a64d8b5L, 0x38172726ed13a80L, 0x3ef00ba1f81aea0L, 0x0821e5b3f7443d4L, 0x092d9db9fL},
+  {0x32aa9db79f42c99L, 0x11bf3e8c1bb4832L, 0x18029dcbaa4ed11L, 0x049fe580503d165L, 0x0708939614d2026L, 0x0eb94fe804265aeL, 0x18abdbe88L},
+  {0x25c0d9e26e086cbL, 0x12fb8ec1010c3f7L, 0x3fbd5a0409ce362L, 0x27b82b343b2a43cL, 0x18b3a3172f1e75fL, 0x2f55b4ec993cd0dL, 0x14f653a62L},
+  {0x09bd01aa5f32e93L, 0x367f4af0257dd44L, 0x31eff9e88ad968dL, 0x36686fbf35a2c12L, 0x04fc9059bf48b7fL, 0x3ea78dd90ad5b95L, 0x193593facL},
+  {0x004c1b1500e8415L, 0x005ebbd0416be13L, 0x0c29592f2f06c69L, 0x1e1c348878c4e2cL, 0x3541b5b12527cbfL, 0x060a5321b9d18c9L, 0x106c178c5L},
+  {0x2a13574220e35ffL, 0x0e8480c611197a7L, 0x39bffb4a0fdf22aL, 0x1b8e5ebd5e86ee3L, 0x2f42cfcc85ed13bL, 0x25780eb1d4f68a3L, 0x16da1d102L},
+  {0x3b2fd6416f92abfL, 0x15fbf9b63799de9L, 0x380f931c593e7abL, 0x18d8870513c6b21L, 0x009a52b75178c4bL, 0x16447a7960c0213L, 0x0b38a06aeL},
+  {0x275764ecd584f0eL, 0x26b0e2e514fd2fdL, 0x33aefeadc078395L, 0x2696a0034ed4ae3L, 0x1199f80c7368705L, 0x086c972f69d5582L, 0x19e36a0acL},
+  {0x29f6371de2dc07eL, 0x3ffd3f2dd54c7fdL, 0x1058aa1bd9e8c8eL, 0x1f76a3130f80cc9L, 0x1a571af1731633cL, 0x14a6030d142fdc6L, 0x069b1edb4L}
+};
+
+const BIG_384_58 ISO11_XDEN_NRES_BLS381[10] = {
+  {0x2436c3f76aada94L, 0x01d534377d25789L, 0x32ef7c0c1f559e5L, 0x16abf9597199839L, 0x2036ebd601b9b0eL, 0x24ed7e8eb9bd0a9L, 0x054703656L},
+  {0x21d41b7309ff044L, 0x3df1ada5f93b8bdL, 0x39ac6befad8ab3cL, 0x03d21871ebd2c90L, 0x20055daf2519856L, 0x19712006d3b5c6fL, 0x14ed3e5c4L},
+  {0x11e2807af77e4d1L, 0x269d16f3b1578a2L, 0x35e6e0011c5fe2aL, 0x1ef3988a61d1654L, 0x00728603fcafbd1L, 0x04287755c85638fL, 0x0efd37998L},
+  {0x3069e4ad6688f1eL, 0x36f8756a33c4e2eL, 0x2dc56068aef9a87L, 0x16bdb0504ea8170L, 0x3639c93f09f419cL, 0x3ed4b906b8d1767L, 0x188c7b891L},
+  {0x27eb2d18cfbd1b4L, 0x0f176b444d98113L, 0x3eb15134a047c3aL, 0x0e1b8ef14970a3fL, 0x3c9be5425a639faL, 0x00d97c335236253L, 0x00747e1aaL},
+  {0x1b4450bdba56c55L, 0x2647c17fbdde522L, 0x2c1b2cd34fcd4dfL, 0x35c7156926e3cb8L, 0x38a08f3a43ccd6cL, 0x2951b90c3ccf828L, 0x0abaa345eL},
+  {0x35e6c9a1763cc52L, 0x0362768ed599836L, 0x19278e1f9625c2cL, 0x2d9c47a1981cf56L, 0x36c9eebf16786d9L, 0x2f9c48aa396c2e5L, 0x1937ac25cL},
+  {0x2341dc5935eaa4eL, 0x09210eabc8ae208L, 0x354ca0ae742ff48L, 0x1945c0f9ccabcc6L, 0x0cbe7fa2a7fdbf0L, 0x2356ac9c9b8d593L, 0x15b009d39L},
+  {0x15704cfa4b0c530L, 0x10b272543c5d708L, 0x3b61e7aa5ae9638L, 0x191819e0b1bdfc7L, 0x1f0b69cd92090ddL, 0x1cd5ddd69cb08bdL, 0x0a5feaf09L},
+  {0x1fceb3f0ee55d76L, 0x099db1c96bac213L, 0x3242bd2c97e4bacL, 0x28a8095dd46ea21L, 0x190ead931ade63fL, 0x2b83141c31fc337L, 0x0bfcb94acL}
+};
+
+const BIG_384_58 ISO11_YNUM_NRES_BLS381[16] = {
+  {0x3dba0e76b562e5fL, 0x1311e2315ed6da0L, 0x24bb29d0ddfa739L, 0x1599221003c1a9aL, 0x0139aa0fb2de435L, 0x3fba59e0454f8eeL, 0x08dcd5c4fL},
+  {0x320509af81f0243L, 0x00475d44862b516L, 0x3e08f9ca9d71104L, 0x19b724cd757a33fL, 0x0779cc5690e6ff8L, 0x3a109388ff1df5dL, 0x15e947940L},
+  {0x38e974def70f454L, 0x2f18e9780998537L, 0x1164f9f8b7defa6L, 0x2f297b22bdc130aL, 0x37c759f3ff1d6f6L, 0x2d4784e31a31ddfL, 0x0196a0c9bL},
+  {0x1ebebf90adfb92cL, 0x35167934bbe0d88L, 0x3fe5e5c9ab211e6L, 0x3f47f8e05c8e63cL, 0x0d292e3d446e10eL, 0x208486b8c471f80L, 0x082e73d99L},
+  {0x044e29733d41be9L, 0x3025260ed287f0fL, 0x0d80ebd8c11b648L, 0x2ced9a46d6a03c2L, 0x0021a0698911911L, 0x00783f26095d895L, 0x0574481f8L},
+  {0x32246f0d9885db6L, 0x13b68c874a8da09L, 0x28f7f73df11f1c5L, 0x2408b0a57ca38f7L, 0x135a3a2c6a9e951L, 0x11c844449c2525cL, 0x0c0c833f8L},
+  {0x334e9fcd2f92babL, 0x192feccecaf6778L, 0x0ce9b94ba371832L, 0x17c0566cfdfa163L, 0x03aab78a364d6f4L, 0x018606177aab179L, 0x0a4fe7503L},
+  {0x3e8f13c2c057247L, 0x31e3cf9d410a071L, 0x39f72b6b45dbf15L, 0x2c56ed9785aac05L, 0x18878b1cbd8a94dL, 0x2c681955e105956L, 0x042e210c1L},
+  {0x1908368bdc36c81L, 0x2ab143bbb890ed2L, 0x1a767f67a450771L, 0x3d77e4fd89e5900L, 0x1b4651e3d2dd460L, 0x271f9197962016aL, 0x13516f7cdL},
+  {0x05504b887d8a93eL, 0x23fee2e3a7d15b5L, 0x206312c418126bcL, 0x24a08711ffd5c70L, 0x300b8fb513350c6L, 0x388cb9804991525L, 0x05389b8aeL},
+  {0x3847c5a71bbed0aL, 0x3b6ec09e9858a8dL, 0x22a1d271af84d04L, 0x0abc5868af6da02L, 0x0aa7358069ba88fL, 0x3167ce9b5c472b1L, 0x07f940028L},
+  {0x39fe2915f9d2621L, 0x079bf9b2ab71b97L, 0x2087ec7244b66f9L, 0x14d466b4b29e887L, 0x29072e6318c16baL, 0x0a5d1725aaa1110L, 0x02ec784c3L},
+  {0x0a0d189d77f85cbL, 0x383f480927902eaL, 0x3c698e735a72b29L, 0x358d8f550f47faaL, 0x2d98edb87a2dbeeL, 0x1743a0c04608046L, 0x0703439dbL},
+  {0x0cc359523bbb6d6L, 0x2de429ad3ee9a8fL, 0x13277e088bcd49cL, 0x33377836924c855L, 0x2e238175b1a3dd2L, 0x247095fab77c91eL, 0x09f384b81L},
+  {0x2b2902204ba7763L, 0x2b181d09e5c56edL, 0x2dd265297f6358cL, 0x1fe4dc196d9abf1L, 0x1b33ce7af4ee0b3L, 0x2c0ea9db417f7ffL, 0x0cfc7db3bL},
+  {0x0c866219fd585ddL, 0x35d132dce3640b5L, 0x23a852be6e36492L, 0x29041db75fea047L, 0x00a1ef93cda1248L, 0x2f2641a9825110dL, 0x07b14d825L}
+};
+
+const BIG_384_58 ISO11_YDEN_NRES_BLS381[15] = {
+  {0x367f9536da9594eL, 0x381ae02c27cf957L, 0x0b18f82fa8b54fdL, 0x1f8c3e18029bddaL, 0x1501599b1c0fa81L, 0x39ea1a263c9c3c9L, 0x06aeb7381L},
+  {0x0b44d7b5ba8230bL, 0x0fa6ea50db9fda9L, 0x2e1258dfb6c95d4L, 0x122cfaf2d89ba89L, 0x33f64e6045fc21cL, 0x34ac79ca8b7bd44L, 0x0dac794a4L},
+  {0x09d1c02d8b3e3a0L, 0x3a7b4b0830a6e2cL, 0x223f1d5feb4d64eL, 0x350a1ab55f0e09aL, 0x37ff6e7ad403b55L, 0x392813eaeec2b6dL, 0x05d7d748cL},
+  {0x348dd76d69ab582L, 0x31bfd48800490ddL, 0x31e2755ab5532b5L, 0x1d42087847ca973L, 0x3769321ea11d1b6L, 0x3f305f36859c4edL, 0x03c2083e2L},
+  {0x22e99ff30fe807eL, 0x36ae36585d421dbL, 0x052995179f23111L, 0x30bdb62d9c6cdaeL, 0x02d76c2ba63213fL, 0x01cb79a8b2da2bcL, 0x1851e37f3L},
+  {0x2d0ad79b4e9efb9L, 0x26b7e62a4fccbcaL, 0x2e517ac3b5eedd7L, 0x028cab6a9b114a2L, 0x0d44adb2bac621eL, 0x29fc1a180686366L, 0x1012cf752L},
+  {0x2ffeb863fadbd48L, 0x294e739c3c6778cL, 0x07bf2ede716617eL, 0x28ddc80e6a7a5e7L, 0x0bf981fb8dd4264L, 0x34eee68b5ac7decL, 0x197b4cabcL},
+  {0x0f0e303eb2880e2L, 0x3bcdf7c245238d7L, 0x11cf590c980c611L, 0x3050b576a213615L, 0x3e27b290dc6bbb0L, 0x0f895bb3ea74a9dL, 0x1928b8b48L},
+  {0x3661d412d6cbbc7L, 0x101b370b36f51ccL, 0x3d2138834dab9dfL, 0x2708c61aa39b93fL, 0x3152eb740a89a34L, 0x2dc418f20aaa7feL, 0x0eeec57caL},
+  {0x17c7db5d2433932L, 0x0244e63d8245f51L, 0x3d0de5abdaea342L, 0x074c6c15db0574dL, 0x15e7b72582dba7eL, 0x17c6b9698298d2aL, 0x0d69c548aL},
+  {0x0cb7f64e39fb7f2L, 0x08ccc99ce30479eL, 0x1cadc59718cf41eL, 0x2ed1bf2e05754f5L, 0x29ddbdc4241d34fL, 0x30a91a4de943a4bL, 0x0d4bc000cL},
+  {0x0b30e2610b860a4L, 0x0aea4939b05a2fcL, 0x37efd02ad981364L, 0x176451adffb86a1L, 0x1b638c29af6f7e3L, 0x0a61ff29a8765e4L, 0x03c65179cL},
+  {0x0d4d14474c4cda7L, 0x274148a9e262372L, 0x39d6d56dea6e7c3L, 0x227ed155ed13ab0L, 0x32b4ffaadf090f9L, 0x2602ea5aa683cbfL, 0x068f5c40dL},
+  {0x02e55e800c708feL, 0x3cb6ba25d438969L, 0x07924d5f4ace123L, 0x183c13baeebcec2L, 0x34f26982546c145L, 0x19c26b95bc5fb5dL, 0x0426ae787L},
+  {0x0fb60de96580c31L, 0x0e6c8aae218231dL, 0x2b641bc2e3d7182L, 0x1cfc0e0cbea5f32L, 0x0596045ca84d95fL, 0x01449e2a4afa4d3L, 0x11fb15f03L}
+};
+
+const BIG_384_58 SSWU_A2re_NRES_BLS381 = {0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000L};
+const BIG_384_58 SSWU_A2im_NRES_BLS381 = {0x371c4e36f96cb85L, 0x18458f5dc606e60L, 0x397bf5fa2fb1fe4L, 0x168b55df3f81652L, 0x258562c1c5776d2L, 0x15698ae8958a485L, 0x03a70af2aL};
+const BIG_384_58 SSWU_B2re_NRES_BLS381 = {0x17d3e367ceeef82L, 0x3d8bb44c3458d23L, 0x2060e7d016bb2e1L, 0x30073d3456210bbL, 0x39d1b2df6183ca6L, 0x24634c9323fa9bdL, 0x1880bcf78L};
+const BIG_384_58 SSWU_B2im_NRES_BLS381 = {0x17d3e367ceeef82L, 0x3d8bb44c3458d23L, 0x2060e7d016bb2e1L, 0x30073d3456210bbL, 0x39d1b2df6183ca6L, 0x24634c9323fa9bdL, 0x1880bcf78L};
+const BIG_384_58 SSWU_Z2re_NRES_BLS381 = {0x115fe5bf8ab5e4eL, 0x22990275bdaedfaL, 0x0f2af0879eb17acL, 0x0e98669deefe10cL, 0x1e6dc583da5151bL, 0x2ef8831bad8c1f9L, 0x0d9f2b728L};
+const BIG_384_58 SSWU_Z2im_NRES_BLS381 = {0x08aff2dfc55af27L, 0x114c813aded76fdL, 0x07957843cf58bd6L, 0x274c334ef77f086L, 0x2f36e2c1ed28a8dL, 0x177c418dd6c60fcL, 0x06cf95b94L};
+const BIG_384_58 SSWU_C2_NRES_BLS381 = {0x31cd28c1019c901L, 0x2fea0aedf1b22a8L, 0x14e15bc5371b042L, 0x0a12a888a91ce55L, 0x0f7a1d196ee8801L, 0x2f3f82420670382L, 0x036f095dfL};
+
+const BIG_384_58 ISO3_XNUMre_NRES_BLS381[4] = {
+  {0x32e3827983d0033L, 0x3d04192b4c768a6L, 0x2061b17f12ac16cL, 0x2d87d0fedc1e2f2L, 0x3cd58969ddd0614L, 0x03d039347233472L, 0x03fb353bbL},
+  {0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000L},
+  {0x3f0566d5a381677L, 0x18ef4e76d18b69cL, 0x332f01013703222L, 0x022c9cdb65db165L, 0x3a9637203a113e4L, 0x1c049856b8bbdf1L, 0x10ec4a488L},
+  {0x02871de722f08fcL, 0x036941bec57647dL, 0x3557778cfb8c09aL, 0x23fb863be9af3d0L, 0x26122fd45bed9adL, 0x3fd55a3cf81fb98L, 0x193f569cbL}
+};
+const BIG_384_58 ISO3_XNUMim_NRES_BLS381[4] = {
+  {0x32e3827983d0033L, 0x3d04192b4c768a6L, 0x2061b17f12ac16cL, 0x2d87d0fedc1e2f2L, 0x3cd58969ddd0614L, 0x03d039347233472L, 0x03fb353bbL},
+  {0x01d53254b8f2868L, 0x2e21589cfce92a3L, 0x3ee3eb5f7e41f90L, 0x3e2088d293fd6baL, 0x133d075a786c6ceL, 0x13f60424e7657f7L, 0x12298f436L},
+  {0x20ea992a5c79434L, 0x1710ac4e7e74951L, 0x1f71f5afbf20fc8L, 0x1f10446949feb5dL, 0x299e83ad3c36367L, 0x09fb021273b2bfbL, 0x0914c7a1bL},
+  {0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000L}
+};
+const BIG_384_58 ISO3_XDENre_NRES_BLS381[2] = {
+  {0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000L},
+  {0x17809d82bfa74d8L, 0x3069dc52cde6bdcL, 0x2f823796206799fL, 0x2d611d5f2572cc3L, 0x1a404a1ebb35e8aL, 0x3e2b56fea071bddL, 0x164942f99L}
+};
+const BIG_384_58 ISO3_XDENim_NRES_BLS381[2] = {
+  {0x329c4eef81f42f2L, 0x3d84b6af0c9786cL, 0x12b87aa1026b1c1L, 0x372697613e69ffdL, 0x3bbaa4186269484L, 0x2ef9947f47ed460L, 0x164ed9a39L},
+  {0x086f627d40535d3L, 0x3f961e728219412L, 0x231ebf1ad5bc84aL, 0x33dbc3e58a66fffL, 0x09f470aebb118c0L, 0x27d4436a8bfce10L, 0x03b7cef09L}
+};
+const BIG_384_58 ISO3_YNUMre_NRES_BLS381[4] = {
+  {0x3e27f2523b4766fL, 0x1c6aac2bbe7cb0bL, 0x0c303abcaa2afaeL, 0x2ed446773a84471L, 0x2916d992bd7e7edL, 0x049e1f331cba394L, 0x09ab78276L},
+  {0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000L},
+  {0x30754c952e3ca1aL, 0x0b8856273f3a4a8L, 0x2fb8fad7df907e4L, 0x2f882234a4ff5aeL, 0x34cf41d69e1b1b3L, 0x24fd810939d95fdL, 0x048a63d0dL},
+  {0x346da0b2f455257L, 0x04323a3063833c4L, 0x00d9242ca24ac62L, 0x153e5f30b74a0d3L, 0x1784003157a2ebcL, 0x260dd1aa2f0eb65L, 0x11969fb5fL}
+};
+const BIG_384_58 ISO3_YNUMim_NRES_BLS381[4] = {
+  {0x3e27f2523b4766fL, 0x1c6aac2bbe7cb0bL, 0x0c303abcaa2afaeL, 0x2ed446773a84471L, 0x2916d992bd7e7edL, 0x049e1f331cba394L, 0x09ab78276L},
+  {0x03c247740476bd9L, 0x3c30561050a90cbL, 0x269f2fb4be25202L, 0x153f58c9f0ec2f1L, 0x10be6ac753f3796L, 0x1378c0098a2d093L, 0x0b6ad31ceL},
+  {0x2f7ab36ad1be091L, 0x2477a49e10c5b45L, 0x22e7fbd91693a06L, 0x31b4bf100ada714L, 0x2f6578f6d82c597L, 0x0102195ff2953efL, 0x1576ae196L},
+  {0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000L}
+};
+const BIG_384_58 ISO3_YDENre_NRES_BLS381[3] = {
+  {0x0ff9d99d0bd3c55L, 0x011c623fbb8d2e4L, 0x132e0e513fce0f6L, 0x24b725f0073b01fL, 0x3158328eff126a3L, 0x1bdb76edd1668a1L, 0x03d3c0428L},
+  {0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000000000L, 0x000000000L},
+  {0x0350ec441f80499L, 0x389ecfb6e4da1dcL, 0x14a25cb03a77484L, 0x22d4caca0852662L, 0x232bb460a289684L, 0x17416814c43bfdeL, 0x076cd28c3L}
+};
+const BIG_384_58 ISO3_YDENim_NRES_BLS381[3] = {
+  {0x0ff9d99d0bd3c55L, 0x011c623fbb8d2e4L, 0x132e0e513fce0f6L, 0x24b725f0073b01fL, 0x3158328eff126a3L, 0x1bdb76edd1668a1L, 0x03d3c0428L},
+  {0x17f4ecce85e7380L, 0x188e2e8285c6969L, 0x12e782811af9170L, 0x22fa039a5b8a671L, 0x2ac676ae3aacef7L, 0x00ed88ab7eea947L, 0x0eea69166L},
+  {0x1c9f13bbe07a612L, 0x37612b0e6b25e12L, 0x3dfe9a00bbacd65L, 0x3e68167aa787660L, 0x0109066cd3be0c6L, 0x0ebe32546832a0fL, 0x12943f5e0L}
+};
+
 #endif
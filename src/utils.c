@@ -130,8 +130,5 @@ int generateOTP(csprng* RNG)
 /* Generate a random Octet */
 void generateRandom(csprng *RNG,octet *randomValue)
 {
-    for (int i=0; i<randomValue->len; i++)
-    {
-        randomValue->val[i] = (char)RAND_byte(RNG);
-    }
+    RAND_bytes(RNG,randomValue->val,randomValue->len);
 }
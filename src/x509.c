@@ -189,95 +189,308 @@ static int bround(int len)
 
 }
 
-//	Input signed cert as octet, and extract signature
-//	Return 0 for failure, ECC for Elliptic Curve signature, RSA for RSA signature
-//  Note that signature type is not provided here - its the type of the public key that
-//  is used to verify it that matters, and which determines for example the curve to be used!
+/* compare len bytes of the cert at index j with an OID */
+static int is_oid(octet *O,char *b,int j,int len)
+{
+    int i;
+    if (len!=O->len) return 0;
+    for (i=0; i<len; i++)
+        if (O->val[i]!=b[j+i]) return 0;
+    return 1;
+}
 
-pktype X509_extract_cert_sig(octet *sc,octet *sig)
+// How far index_tbs goes, so that single field lookups do not walk the whole certificate
+
+#define TBS_NONE 0
+#define TBS_ISSUER 1
+#define TBS_VALIDITY 2
+#define TBS_SUBJECT 3
+#define TBS_KEY 4
+#define TBS_ALL 5
+
+static void index_init(x509_index *ix)
 {
-    int i,j,k,fin,len,rlen,sj,ex;
-    char soid[9];
-    octet SOID= {0,sizeof(soid),soid};
-    pktype ret;
+    ix->cert=ix->certlen=0;
+    ix->issuer=ix->validity=ix->subject=0;
+    ix->key=ix->keylen=0;
+    ix->keytype.type=ix->keytype.hash=0;
+    ix->keytype.curve=-1;
+    ix->ext=0;
+    ix->sigalg=ix->sigalglen=0;
+    ix->sigtype.type=ix->sigtype.hash=ix->sigtype.curve=0;
+    ix->sig=ix->siglen=0;
+}
+
+// Index the contents of a certificate clause, from j up to fin, stopping once field upto is found. Return 0 for failure
+// Fields are recorded as they are passed, so a failed index is still good up to the point of failure
+
+static int index_tbs(char *b,int j,int fin,x509_index *ix,int upto)
+{
+    int len,sj,pj,type,curve;
+
+    len=getalen(0,b,j);
+    if (len<0) return 0;
+    j+=skip(len)+len; //jump over version clause
+
+    len=getalen(INT,b,j);
+
+    if (len>0) j+=skip(len)+len; // jump over serial number clause (if there is one)
+
+    len=getalen(SEQ,b,j);
+    if (len<0) return 0;
+    j+=skip(len)+len;  // jump over signature algorithm
+
+    ix->issuer=j;
+    if (upto==TBS_ISSUER) return 1;
+    len=getalen(SEQ,b,j);
+    if (len<0) return 0;
+    j+=skip(len)+len; // skip issuer
+
+    ix->validity=j;
+    if (upto==TBS_VALIDITY) return 1;
+    len=getalen(SEQ,b,j);
+    if (len<0) return 0;
+    j+=skip(len)+len; // skip validity
+
+    ix->subject=j;
+    if (upto==TBS_SUBJECT) return 1;
+    len=getalen(SEQ,b,j);
+    if (len<0) return 0;
+    j+=skip(len)+len; // skip subject
+
+    len=getalen(SEQ,b,j);
+    if (len<0) return 0;
+    j+=skip(len);
+
+    pj=j+len; // end of public key info
+
+    len=getalen(SEQ,b,j);
+    if (len<0) return 0;
+    j+=skip(len);
+
+    sj=j+len;
+
+    len=getalen(OID,b,j);
+    if (len<0) return 0;
+    j+=skip(len);
+
+    type=0;
+    curve=-1;
+    if (is_oid(&ECPK,b,j,len)) type=ECC;
+    if (is_oid(&RSAPK,b,j,len)) type=RSA;
+    j+=len;
+
+    if (type==ECC)
+    {
+        // which elliptic curve?
+        len=getalen(OID,b,j);
+        if (len<0) return 0;
+        j+=skip(len);
+
+        if (is_oid(&PRIME25519,b,j,len)) curve=C25519;   /*****/
+        if (is_oid(&PRIME256V1,b,j,len)) curve=NIST256;
+        if (is_oid(&SECP384R1,b,j,len)) curve=NIST384;
+        if (is_oid(&SECP521R1,b,j,len)) curve=NIST521;
+    }
+
+    if (type!=0)
+    {
+        j=sj; // skip to actual Public Key
+
+        len=getalen(BIT,b,j);
+        if (len<0) return 0;
+        j+=skip(len);
+        j++;
+        len--; // skip bit shift (hopefully 0!)
+
+        if (type==RSA)
+        {
+            // Key is (modulus,exponent) - assume exponent is 65537
+            len=getalen(SEQ,b,j);
+            if (len<0) return 0;
+            j+=skip(len);
+
+            len=getalen(INT,b,j); // get modulus
+            if (len<0) return 0;
+            j+=skip(len);
+            if (b[j]==0)
+            {
+                j++;
+                len--; // remove leading zero
+            }
+            curve=8*len;
+        }
+        ix->key=j;
+        ix->keylen=len;
+        ix->keytype.type=type;
+        ix->keytype.curve=curve;
+    }
+    if (upto==TBS_KEY) return 1;
+
+    // optional unique identifiers and extensions
+    for (j=pj; j<fin;)
+    {
+        len=getalen(ANY,b,j);
+        if (len<0) return 0;
+        if ((unsigned char)b[j]==0xA3) ix->ext=j+skip(len);
+        j+=skip(len)+len;
+    }
+    return (j==fin);
+}
 
-    ret.type=0;
-    ret.hash=0;
+// Index signed cert, in one pass, with the certificate indexed up to field upto. Return 0 for failure
+
+static int index_signed_cert(octet *sc,x509_index *ix,int upto)
+{
+    int j,len,sj,res,certlen;
+
+    index_init(ix);
 
     j=0;
 
     len=getalen(SEQ,sc->val,j);		// Check for expected SEQ clause, and get length
-    if (len<0) return ret;			// if not a SEQ clause, there is a problem, exit
+    if (len<0) return 0;			// if not a SEQ clause, there is a problem, exit
     j+=skip(len);					// skip over length to clause contents. Add len to skip clause
 
-    if (len+j!=sc->len) return ret;
+    if (len+j!=sc->len) return 0;
 
     len=getalen(SEQ,sc->val,j);
-    if (len<0) return ret;
-    j+=skip(len)+len; // jump over cert to signature OID
+    if (len<0) return 0;
+    certlen=skip(len)+len;
+    if (j+certlen>sc->len) return 0; // certificate runs past the end of the signed cert
+    ix->cert=j;
+    ix->certlen=certlen;
+
+    res=1;
+    if (upto!=TBS_NONE) res=index_tbs(sc->val,j+skip(len),j+certlen,ix,upto);
+    j+=ix->certlen; // jump over cert to signature OID
 
     len=getalen(SEQ,sc->val,j);
-    if (len<0) return ret;
+    if (len<0) return 0;
     j+=skip(len);
 
     sj=j+len; // Needed to jump over signature OID
 
-// dive in to extract OID
     len=getalen(OID,sc->val,j);
-    if (len<0) return ret;
+    if (len<0) return 0;
     j+=skip(len);
 
-    fin=j+len;
-    SOID.len=len;
-    for (i=0; j<fin; j++)
-        SOID.val[i++]= sc->val[j];
+    ix->sigalg=j;
+    ix->sigalglen=len;
 
-    // check OID here..
-
-    if (OCT_comp(&ECCSHA256,&SOID))
+    if (is_oid(&ECCSHA256,sc->val,j,len))
     {
-        ret.type=ECC;
-        ret.hash=H256;
+        ix->sigtype.type=ECC;
+        ix->sigtype.hash=H256;
     }
-    if (OCT_comp(&ECCSHA384,&SOID))
+    if (is_oid(&ECCSHA384,sc->val,j,len))
     {
-        ret.type=ECC;
-        ret.hash=H384;
+        ix->sigtype.type=ECC;
+        ix->sigtype.hash=H384;
     }
-    if (OCT_comp(&ECCSHA512,&SOID))
+    if (is_oid(&ECCSHA512,sc->val,j,len))
     {
-        ret.type=ECC;
-        ret.hash=H512;
+        ix->sigtype.type=ECC;
+        ix->sigtype.hash=H512;
     }
-    if (OCT_comp(&RSASHA256,&SOID))
+    if (is_oid(&RSASHA256,sc->val,j,len))
     {
-        ret.type=RSA;
-        ret.hash=H256;
+        ix->sigtype.type=RSA;
+        ix->sigtype.hash=H256;
     }
-    if (OCT_comp(&RSASHA384,&SOID))
+    if (is_oid(&RSASHA384,sc->val,j,len))
     {
-        ret.type=RSA;
-        ret.hash=H384;
+        ix->sigtype.type=RSA;
+        ix->sigtype.hash=H384;
     }
-    if (OCT_comp(&RSASHA512,&SOID))
+    if (is_oid(&RSASHA512,sc->val,j,len))
     {
-        ret.type=RSA;
-        ret.hash=H512;
+        ix->sigtype.type=RSA;
+        ix->sigtype.hash=H512;
     }
-
-    if (ret.type==0) return ret; // unsupported type
+    if (ix->sigtype.hash==H256) ix->sigtype.curve=NIST256;
+    if (ix->sigtype.hash==H384) ix->sigtype.curve=NIST384;
+    if (ix->sigtype.hash==H512) ix->sigtype.curve=NIST521;
 
     j=sj;  // jump out to signature
 
     len=getalen(BIT,sc->val,j);
-    if (len<0)
+    if (len<0) return 0;
+    j+=skip(len);
+
+    ix->sig=j+1;
+    ix->siglen=len-1; // skip bit shift (hopefully 0!)
+
+    return res;
+}
+
+// Index signed cert, in one pass. Return 0 for failure
+
+int X509_index_signed_cert(octet *sc,x509_index *ix)
+{
+    return index_signed_cert(sc,ix,TBS_ALL);
+}
+
+// Index cert up to field upto. Return 0 for failure
+
+static int index_cert(octet *c,x509_index *ix,int upto)
+{
+    int j,len;
+
+    index_init(ix);
+
+    j=0;
+
+    len=getalen(SEQ,c->val,j);
+    if (len<0) return 0;
+    j+=skip(len);
+
+    if (len+j!=c->len) return 0;
+
+    ix->certlen=c->len;
+    return index_tbs(c->val,j,c->len,ix,upto);
+}
+
+// Index cert, in one pass. Return 0 for failure
+
+int X509_index_cert(octet *c,x509_index *ix)
+{
+    return index_cert(c,ix,TBS_ALL);
+}
+
+// Point cert at certificate inside indexed signed cert
+
+int X509_view_cert(octet *sc,x509_index *ix,octet *cert)
+{
+    if (ix->certlen==0) return 0;
+    cert->val=sc->val+ix->cert;
+    cert->len=cert->max=ix->certlen;
+    return 1;
+}
+
+//	Input signed cert as octet, and extract signature
+//	Return 0 for failure, ECC for Elliptic Curve signature, RSA for RSA signature
+//  Note that signature type is not provided here - its the type of the public key that
+//  is used to verify it that matters, and which determines for example the curve to be used!
+
+pktype X509_extract_cert_sig(octet *sc,octet *sig)
+{
+    int i,j,k,fin,len,rlen,ex;
+    x509_index ix;
+    pktype ret;
+
+    index_signed_cert(sc,&ix,TBS_NONE);
+    ret=ix.sigtype;
+
+    if (ret.type==0) return ret; // unsupported type
+    if (ix.sig==0)
     {
         ret.type=0;
         return ret;
     }
-    j+=skip(len);
-    j++;
-    len--; // skip bit shift (hopefully 0!)
+
+    j=ix.sig;
+    len=ix.siglen;
 
     if (ret.type==ECC)
     {
@@ -358,33 +571,22 @@ pktype X509_extract_cert_sig(octet *sc,octet *sig)
             sig->val[i++]= sc->val[j];
 
     }
-    if (ret.hash==H256) ret.curve=NIST256;
-    if (ret.hash==H384) ret.curve=NIST384;
-    if (ret.hash==H512) ret.curve=NIST521;
 
     return ret;
 }
 
 // Extract certificate from signed cert
+// X509_view_cert gives the same certificate without copying it
 int X509_extract_cert(octet *sc,octet *cert)
 {
-    int i,j,fin,len,k;
-
-    j=0;
-    len=getalen(SEQ,sc->val,j);
-
-    if (len<0) return 0;
-    j+=skip(len);
-
-    k=j;
+    int i;
+    x509_index ix;
 
-    len=getalen(SEQ,sc->val,j);
-    if (len<0) return 0;
-    j+=skip(len);
+    index_signed_cert(sc,&ix,TBS_NONE);
+    if (ix.certlen==0) return 0;
 
-    fin=j+len;
-    cert->len=fin-k;
-    for (i=k; i<fin; i++) cert->val[i-k]=sc->val[i];
+    cert->len=ix.certlen;
+    for (i=0; i<ix.certlen; i++) cert->val[i]=sc->val[ix.cert+i];
 
     return 1;
 }
@@ -392,203 +594,43 @@ int X509_extract_cert(octet *sc,octet *cert)
 // Extract Public Key from inside Certificate
 pktype X509_extract_public_key(octet *c,octet *key)
 {
-    int i,j,fin,len,sj;
-    char koid[12];     /*****/
-    octet KOID= {0,sizeof(koid),koid};
-    pktype ret;
-
-    ret.type=ret.hash=0;
-    ret.curve=-1;
-
-    j=0;
-
-    len=getalen(SEQ,c->val,j);
-    if (len<0) return ret;
-    j+=skip(len);
-
-    if (len+j!=c->len) return ret;
-
-    len=getalen(0,c->val,j);
-    if (len<0) return ret;
-    j+=skip(len)+len; //jump over version clause
-
-    len=getalen(INT,c->val,j);
-
-    if (len>0) j+=skip(len)+len; // jump over serial number clause (if there is one)
-
-    len=getalen(SEQ,c->val,j);
-    if (len<0) return ret;
-    j+=skip(len)+len;  // jump over signature algorithm
-
-    len=getalen(SEQ,c->val,j);
-    if (len<0) return ret;
-    j+=skip(len)+len; // skip issuer
-
-    len=getalen(SEQ,c->val,j);
-    if (len<0) return ret;
-    j+=skip(len)+len; // skip validity
-
-    len=getalen(SEQ,c->val,j);
-    if (len<0) return ret;
-    j+=skip(len)+len; // skip subject
-
-    len=getalen(SEQ,c->val,j);
-    if (len<0) return ret;
-    j+=skip(len); //
-
-    len=getalen(SEQ,c->val,j);
-    if (len<0) return ret;
-    j+=skip(len);
-
-// ** Maybe dive in and check Public Key OIDs here?
-// ecpublicKey & prime256v1, secp384r1 or secp521r1 for ECC
-// rsapublicKey for RSA
-
-    sj=j+len;
-
-    len=getalen(OID,c->val,j);
-    if (len<0) return ret;
-    j+=skip(len);
-
-    fin=j+len;
-    KOID.len=len;
-    for (i=0; j<fin; j++)
-        KOID.val[i++]= c->val[j];
-
-    ret.type=0;
-    if (OCT_comp(&ECPK,&KOID)) ret.type=ECC;
-    if (OCT_comp(&RSAPK,&KOID)) ret.type=RSA;
-
-    if (ret.type==0) return ret;
-
-    if (ret.type==ECC)
-    {
-        // which elliptic curve?
-        len=getalen(OID,c->val,j);
-        if (len<0)
-        {
-            ret.type=0;
-            return ret;
-        }
-        j+=skip(len);
-
-        fin=j+len;
-        KOID.len=len;
-        for (i=0; j<fin; j++)
-            KOID.val[i++]= c->val[j];
-
-        if (OCT_comp(&PRIME25519,&KOID)) ret.curve=C25519;   /*****/
-        if (OCT_comp(&PRIME256V1,&KOID)) ret.curve=NIST256;
-        if (OCT_comp(&SECP384R1,&KOID)) ret.curve=NIST384;
-        if (OCT_comp(&SECP521R1,&KOID)) ret.curve=NIST521;
-    }
-
-    j=sj; // skip to actual Public Key
-
-    len=getalen(BIT,c->val,j);
-    if (len<0)
-    {
-        ret.type=0;
-        return ret;
-    }
-    j+=skip(len); //
-    j++;
-    len--; // skip bit shift (hopefully 0!)
-
-// extract key
-    if (ret.type==ECC)
-    {
-        key->len=len;
-        fin=j+len;
-        for (i=0; j<fin; j++)
-            key->val[i++]= c->val[j];
-
-    }
-    if (ret.type==RSA)
-    {
-        // Key is (modulus,exponent) - assume exponent is 65537
-        len=getalen(SEQ,c->val,j);
-        if (len<0)
-        {
-            ret.type=0;
-            return ret;
-        }
-        j+=skip(len); //
+    int i;
+    x509_index ix;
 
-        len=getalen(INT,c->val,j); // get modulus
-        if (len<0)
-        {
-            ret.type=0;
-            return ret;
-        }
-        j+=skip(len); //
-        if (c->val[j]==0)
-        {
-            j++;
-            len--; // remove leading zero
-        }
+    index_cert(c,&ix,TBS_KEY);
+    if (ix.keytype.type==0) return ix.keytype;
 
-        key->len=len;
-        fin=j+len;
-        for (i=0; j<fin; j++)
-            key->val[i++]= c->val[j];
+    key->len=ix.keylen;
+    for (i=0; i<ix.keylen; i++) key->val[i]=c->val[ix.key+i];
 
-        ret.curve=8*len;
-    }
-    return ret;
+    return ix.keytype;
 }
 
 // Find pointer to main sections of cert, before extracting individual field
+// These each index the cert again, up to the field - to find several fields index it once with X509_index_cert
+
 // Find index to issuer in cert
 int X509_find_issuer(octet *c)
 {
-    int j,len;
-    j=0;
-    len=getalen(SEQ,c->val,j);
-    if (len<0) return 0;
-    j+=skip(len);
-
-    if (len+j!=c->len) return 0;
-
-    len=getalen(0,c->val,j);
-    if (len<0) return 0;
-    j+=skip(len)+len; //jump over version clause
-
-    len=getalen(INT,c->val,j);
-
-    if (len>0) j+=skip(len)+len; // jump over serial number clause (if there is one)
-
-    len=getalen(SEQ,c->val,j);
-    if (len<0) return 0;
-    j+=skip(len)+len;  // jump over signature algorithm
-
-    return j;
+    x509_index ix;
+    index_cert(c,&ix,TBS_ISSUER);
+    return ix.issuer;
 }
 
 // Find index to validity period
 int X509_find_validity(octet *c)
 {
-    int j,len;
-    j=X509_find_issuer(c);
-
-    len=getalen(SEQ,c->val,j);
-    if (len<0) return 0;
-    j+=skip(len)+len; // skip issuer
-
-    return j;
+    x509_index ix;
+    index_cert(c,&ix,TBS_VALIDITY);
+    return ix.validity;
 }
 
 // Find index to subject in cert
 int X509_find_subject(octet *c)
 {
-    int j,len;
-    j=X509_find_validity(c);
-
-    len=getalen(SEQ,c->val,j);
-    if (len<0) return 0;
-    j+=skip(len)+len; // skip validity
-
-    return j;
+    x509_index ix;
+    index_cert(c,&ix,TBS_SUBJECT);
+    return ix.subject;
 }
 
 // NOTE: When extracting cert information, we actually return just an index to the data inside the cert, and maybe its length
@@ -599,9 +641,7 @@ int X509_find_subject(octet *c)
 
 int X509_find_entity_property(octet *c,octet *SOID,int start,int *flen)
 {
-    int i,j,k,fin,len,tlen;
-    char foid[50];  /*****/
-    octet FOID= {0,sizeof(foid),foid};
+    int j,k,fin,len,tlen;
 
     j=start;
 
@@ -621,15 +661,13 @@ int X509_find_entity_property(octet *c,octet *SOID,int start,int *flen)
         len=getalen(OID,c->val,j);
         if (len<0) return 0;
         j+=skip(len);
-        fin=j+len;  // extract OID
-        FOID.len=len;
-        for (i=0; j<fin; j++)
-            FOID.val[i++]= c->val[j];
+        fin=is_oid(SOID,c->val,j,len);  // compare OID in place
+        j+=len;
         len=getalen(ANY,c->val,j);  // get text, could be any type
         if (len<0) return 0;
 
         j+=skip(len);
-        if (OCT_comp(&FOID,SOID))
+        if (fin)
         {
             // if its the right one return
             *flen=len;
@@ -641,6 +679,41 @@ int X509_find_entity_property(octet *c,octet *SOID,int start,int *flen)
     return 0;
 }
 
+// Find extension indicated by SOID, given start of extensions field. Return index in cert, flen=length of extension value
+
+int X509_find_extension(octet *c,octet *SOID,int start,int *flen)
+{
+    int j,k,nj,len,tlen;
+
+    *flen=0;
+    if (start==0) return 0;
+    j=start;
+
+    tlen=getalen(SEQ,c->val,j);
+    if (tlen<0) return 0;
+    j+=skip(tlen);
+
+    for (k=j; j<k+tlen; j=nj)
+    {
+        len=getalen(SEQ,c->val,j);
+        if (len<0) return 0;
+        j+=skip(len);
+        nj=j+len;   // next extension
+        len=getalen(OID,c->val,j);
+        if (len<0) return 0;
+        j+=skip(len);
+        if (!is_oid(SOID,c->val,j,len)) continue;
+        j+=len;
+        len=getalen(LOG,c->val,j);  // skip critical flag (if there is one)
+        if (len>=0) j+=skip(len)+len;
+        len=getalen(OCT,c->val,j);
+        if (len<0) return 0;
+        *flen=len;
+        return j+skip(len);
+    }
+    return 0;
+}
+
 // Find start date of certificate validity period
 int X509_find_start_date(octet *c,int start)
 {
@@ -0,0 +1,219 @@
+/*
+Licensed to the Apache Software Foundation (ASF) under one
+or more contributor license agreements.  See the NOTICE file
+distributed with this work for additional information
+regarding copyright ownership.  The ASF licenses this file
+to you under the Apache License, Version 2.0 (the
+"License"); you may not use this file except in compliance
+with the License.  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing,
+software distributed under the License is distributed on an
+"AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations
+under the License.
+*/
+/**
+ * @file test_drbg.c
+ * @brief Test for the HMAC_DRBG and CTR_DRBG random number generators
+ *
+ */
+
+#include "arch.h"
+#include "amcl.h"
+#include "randapi.h"
+#include "utils.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#define LINE_LEN 1000
+//#define DEBUG
+
+/* Check that bulk output of the Marsaglia & Zaman generator matches repeated RAND_byte calls */
+static int test_mz_bytes(const char *seed,int seedlen)
+{
+    int i;
+    int j;
+    char b1[200];
+    char b2[200];
+    csprng R1;
+    csprng R2;
+
+    RAND_seed(&R1,seedlen,seed);
+    RAND_seed(&R2,seedlen,seed);
+
+    for (i=0; i<200; i++)
+        b1[i]=(char)RAND_byte(&R1);
+
+    // Start off the pool boundary, then take uneven pieces
+    b2[0]=(char)RAND_byte(&R2);
+    for (i=1, j=1; i<200; i+=j, j=2*j+5)
+        RAND_bytes(&R2,b2+i,200-i<j?200-i:j);
+
+    RAND_clean(&R1);
+    RAND_clean(&R2);
+
+    return memcmp(b1,b2,200);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        printf("usage: ./test_drbg [path to test vector file] [hmac||ctr]\n");
+        exit(EXIT_FAILURE);
+    }
+
+    int i=0;
+    FILE * fp = NULL;
+    char line[LINE_LEN];
+    const char * linePtr = NULL;
+    int l1=0;
+
+    const char* EntropyStr = "EntropyInput = ";
+    const char* NonceStr = "Nonce = ";
+    const char* PersStr = "PersonalizationString = ";
+    const char* ReturnedStr = "ReturnedBits = ";
+
+    char seed[256];
+    int seedLen=0;
+    int entropyLen=0;
+    char pers[64];
+    int persLen=0;
+
+    char * Golden = NULL;
+    char * Out = NULL;
+    int OutLen=0;
+
+    csprng R;
+    int type;
+
+    if (!strcmp(argv[2], "hmac"))
+        type=RAND_HMAC_DRBG;
+    else
+        type=RAND_CTR_DRBG;
+
+    // Open file
+    fp = fopen(argv[1], "r");
+    if (fp == NULL)
+    {
+        printf("ERROR opening test vector file\n");
+        exit(EXIT_FAILURE);
+    }
+    bool readLine = false;
+
+    int lineNo=0;
+    while (fgets(line, LINE_LEN, fp) != NULL)
+    {
+        readLine = true;
+        if (!strncmp(line, EntropyStr, strlen(EntropyStr)))
+        {
+            linePtr = line + strlen(EntropyStr);
+            l1 = (int)strlen(linePtr)-1;
+            amcl_hex2bin(linePtr, seed, l1);
+            entropyLen = l1/2;
+            seedLen = entropyLen;
+        }
+
+        // HMAC_DRBG seed is entropy || nonce || personalization string
+        if (!strncmp(line, NonceStr, strlen(NonceStr)))
+        {
+            linePtr = line + strlen(NonceStr);
+            l1 = (int)strlen(linePtr)-1;
+            amcl_hex2bin(linePtr, seed+seedLen, l1);
+            seedLen += l1/2;
+        }
+
+        if (!strncmp(line, PersStr, strlen(PersStr)))
+        {
+            linePtr = line + strlen(PersStr);
+            l1 = (int)strlen(linePtr)-1;
+            amcl_hex2bin(linePtr, pers, l1);
+            persLen = l1/2;
+            if (type==RAND_HMAC_DRBG)
+            {
+                for (i=0; i<persLen; i++)
+                    seed[seedLen+i]=pers[i];
+                seedLen += persLen;
+            }
+            else
+            {
+                // CTR_DRBG without a derivation function XORs it into the entropy
+                for (i=0; i<persLen; i++)
+                    seed[i]^=pers[i];
+            }
+        }
+
+        if (!strncmp(line, ReturnedStr, strlen(ReturnedStr)))
+        {
+#ifdef DEBUG
+            printf("line %d %s\n", lineNo,line);
+#endif
+            linePtr = line + strlen(ReturnedStr);
+            l1 = (int)strlen(linePtr)-1;
+
+            free(Golden);
+            Golden = NULL;
+            free(Out);
+            Out = NULL;
+
+            OutLen = l1/2;
+            Golden = (char*) malloc(OutLen);
+            if (Golden==NULL)
+                exit(EXIT_FAILURE);
+            Out = (char*) malloc(OutLen);
+            if (Out==NULL)
+                exit(EXIT_FAILURE);
+
+            amcl_hex2bin(linePtr, Golden, l1);
+
+            // Two generate requests, compare the second
+            RAND_seed_type(&R,type,seedLen,seed);
+            RAND_bytes(&R,Out,OutLen);
+            RAND_bytes(&R,Out,OutLen);
+            RAND_clean(&R);
+
+            if (memcmp(Out,Golden,OutLen))
+            {
+                printf("TEST DRBG FAILED COMPARE RETURNED BITS LINE %d\n",lineNo);
+                exit(EXIT_FAILURE);
+            }
+
+            // Reseeding must change the output
+            RAND_seed_type(&R,type,seedLen,seed);
+            RAND_bytes(&R,Out,OutLen);
+            RAND_reseed(&R,entropyLen,seed);
+            RAND_bytes(&R,Out,OutLen);
+            RAND_clean(&R);
+
+            if (!memcmp(Out,Golden,OutLen))
+            {
+                printf("TEST DRBG FAILED RESEED LINE %d\n",lineNo);
+                exit(EXIT_FAILURE);
+            }
+
+            if (test_mz_bytes(seed,seedLen))
+            {
+                printf("TEST RAND_bytes FAILED COMPARE RAND_byte LINE %d\n",lineNo);
+                exit(EXIT_FAILURE);
+            }
+        }
+        lineNo++;
+    }
+    free(Golden);
+    Golden = NULL;
+    free(Out);
+    Out = NULL;
+    fclose(fp);
+    if (!readLine)
+    {
+        printf("ERROR Empty test vector file\n");
+        exit(EXIT_FAILURE);
+    }
+    printf("SUCCESS TEST %s DRBG PASSED\n", argv[2]);
+    exit(EXIT_SUCCESS);
+}
@@ -45,6 +45,8 @@ int main(int argc, char** argv)
 
     // For tests related to the incremental API
     hmac_sha256 ctx;
+    // For tests related to the precomputed key API
+    hmac_sha256_key key;
 
     // Variables for file parsing
     FILE *fp = NULL;
@@ -147,6 +149,18 @@ int main(int argc, char** argv)
                 printf("TEST HMAC_ONESHOT FAILED COMPARE MAC LINE %d\n",lineNo);
                 exit(EXIT_FAILURE);
             }
+
+            // Recompute the HMAC value (precomputed key API)
+            ret = HMAC_SHA256_key_init(&key, Key, KeyLen);
+            ret |= HMAC_SHA256_key_oneshot(Out, MacLen, &key, Msg, MsgLen);
+            HMAC_SHA256_key_clear(&key);
+            // Check that it matches the expected value
+            octet OutOct_key = {MacLen, MacLen, Out};
+            cmp = OCT_comp(&MacOct, &OutOct_key);
+            if (!cmp || ret) {
+                printf("TEST HMAC_KEY FAILED COMPARE MAC LINE %d\n",lineNo);
+                exit(EXIT_FAILURE);
+            }
             free(Key);
             free(Msg);
             free(Mac);
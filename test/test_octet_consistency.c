@@ -144,7 +144,102 @@ int main()
         }
     }
 
+    /* test bounds checked conversions */
+    W.max = (int)sizeof(w);
+    V.max = (int)sizeof(v);
+    for (len = 0; len <= 100; len++)
+    {
+        OCT_rand(&W,&rng,len);
+        if (OCT_toHexLen(&W,bytesHex,2*len)!=-1 || OCT_toHexLen(&W,bytesHex,2*len+1)!=2*len)
+        {
+            printf("ERROR bounds checking conversion to Hex OCTET\n");
+            exit(EXIT_FAILURE);
+        }
+        OCT_toHex(&W,originByteHex);
+        if (strcmp(bytesHex,originByteHex) || OCT_fromHexLen(&V,bytesHex,2*len)!=len || !OCT_comp(&V,&W))
+        {
+            printf("ERROR converting to and from Hex OCTET with length\n");
+            exit(EXIT_FAILURE);
+        }
+        i = 4*((len+2)/3);
+        if (OCT_tobase64Len(&W,bytes64,i)!=-1 || OCT_tobase64Len(&W,bytes64,i+1)!=i)
+        {
+            printf("ERROR bounds checking conversion to base64 OCTET\n");
+            exit(EXIT_FAILURE);
+        }
+        if (OCT_frombase64Len(&V,bytes64,i)!=len || !OCT_comp(&V,&W))
+        {
+            printf("ERROR converting to and from base64 OCTET with length\n");
+            exit(EXIT_FAILURE);
+        }
+        OCT_frombase64(&V,bytes64);
+        if (!OCT_comp(&V,&W))
+        {
+            printf("ERROR converting from bounds checked base64 OCTET\n");
+            exit(EXIT_FAILURE);
+        }
+    }
 
+    /* test known values and rejection of malformed input */
+    OCT_empty(&W);
+    OCT_jstring(&W,(char *)"foobar");
+    for (len = 0; len <= 6; len++)
+    {
+        const char *b64[7] = {"","Zg==","Zm8=","Zm9v","Zm9vYg==","Zm9vYmE=","Zm9vYmFy"};
+        W.len = len;
+        OCT_tobase64(bytes64,&W);
+        if (strcmp(bytes64,b64[len]) || OCT_frombase64Len(&V,b64[len],(int)strlen(b64[len]))!=len || !OCT_comp(&V,&W))
+        {
+            printf("ERROR base64 known value OCTET\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    OCT_frombase64(&V,"Zm9v\nYmE=\r\n");
+    W.len = 5;
+    if (!OCT_comp(&V,&W))
+    {
+        printf("ERROR base64 with white space OCTET\n");
+        exit(EXIT_FAILURE);
+    }
+    if (OCT_fromHexLen(&V,"0aBc",4)!=2 || (V.val[0]&0xff)!=0x0a || (V.val[1]&0xff)!=0xbc)
+    {
+        printf("ERROR Hex known value OCTET\n");
+        exit(EXIT_FAILURE);
+    }
+    if (OCT_fromHexLen(&V,"0g",2)!=-1 || OCT_fromHexLen(&V,"abc",3)!=-1 || V.len!=0)
+    {
+        printf("ERROR accepting malformed Hex OCTET\n");
+        exit(EXIT_FAILURE);
+    }
+    if (OCT_frombase64Len(&V,"Zm9",3)!=-1 || OCT_frombase64Len(&V,"Zm=v",4)!=-1 || OCT_frombase64Len(&V,"Z===",4)!=-1 || OCT_frombase64Len(&V,"Zm 9",4)!=-1)
+    {
+        printf("ERROR accepting malformed base64 OCTET\n");
+        exit(EXIT_FAILURE);
+    }
+    V.max = 2;
+    if (OCT_fromHexLen(&V,"000000",6)!=-1 || OCT_frombase64Len(&V,"Zm9v",4)!=-1)
+    {
+        printf("ERROR overflowing OCTET\n");
+        exit(EXIT_FAILURE);
+    }
+    V.max = (int)sizeof(v);
+
+    /* test views */
+    {
+        octet X;
+        octet Y;
+        OCT_view(&X,raw,256);
+        if (X.val!=raw || X.len!=256 || X.max!=256)
+        {
+            printf("ERROR making view OCTET\n");
+            exit(EXIT_FAILURE);
+        }
+        if (!OCT_subview(&Y,&X,10,20) || Y.val!=raw+10 || Y.len!=20 || OCT_subview(&Y,&X,250,7) || OCT_subview(&Y,&X,-1,2) || Y.val!=raw+10)
+        {
+            printf("ERROR making sub view OCTET\n");
+            exit(EXIT_FAILURE);
+        }
+    }
 
     printf("SUCCESS\n");
     return 0;
@@ -0,0 +1,206 @@
+/*
+Licensed to the Apache Software Foundation (ASF) under one
+or more contributor license agreements.  See the NOTICE file
+distributed with this work for additional information
+regarding copyright ownership.  The ASF licenses this file
+to you under the Apache License, Version 2.0 (the
+"License"); you may not use this file except in compliance
+with the License.  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing,
+software distributed under the License is distributed on an
+"AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations
+under the License.
+*/
+/**
+ * @file test_sha3.c
+ * @brief Test for SHA3 and SHAKE hash functions
+ *
+ */
+
+#include "arch.h"
+#include "amcl.h"
+#include "utils.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#define LINE_LEN 1200
+//#define DEBUG
+
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        printf("usage: ./test_sha3 [path to test vector file] [sha3-224||sha3-256||sha3-384||sha3-512||shake128||shake256]\n");
+        exit(EXIT_FAILURE);
+    }
+
+    int i=0;
+    int j=0;
+    int k=0;
+    FILE * fp = NULL;
+    char line[LINE_LEN];
+    const char * linePtr = NULL;
+    int l1=0;
+    char * Msg = NULL;
+    int MsgLen = 0;
+    const char* LenStr = "Len = ";
+    const char* MsgStr = "Msg = ";
+
+    const char* MDStr = "MD = ";
+    const char* OutputStr = "Output = ";
+    int MDLen = 0;
+    char * MD = NULL;
+
+    char * MD1 = NULL;
+
+    sha3 sh;
+    int type;
+    int xof=0;
+
+    if (!strcmp(argv[2], "sha3-224"))
+        type=SHA3_HASH224;
+    else if (!strcmp(argv[2], "sha3-256"))
+        type=SHA3_HASH256;
+    else if (!strcmp(argv[2], "sha3-384"))
+        type=SHA3_HASH384;
+    else if (!strcmp(argv[2], "sha3-512"))
+        type=SHA3_HASH512;
+    else if (!strcmp(argv[2], "shake128"))
+    {
+        type=SHAKE128;
+        xof=1;
+    }
+    else
+    {
+        type=SHAKE256;
+        xof=1;
+    }
+
+    // Open file
+    fp = fopen(argv[1], "r");
+    if (fp == NULL)
+    {
+        printf("ERROR opening test vector file\n");
+        exit(EXIT_FAILURE);
+    }
+    bool readLine = false;
+
+    int lineNo=0;
+    while (fgets(line, LINE_LEN, fp) != NULL)
+    {
+        readLine = true;
+        if (!strncmp(line, LenStr, strlen(LenStr)))
+        {
+            MsgLen = atoi(line + strlen(LenStr))/8;
+        }
+
+        if (!strncmp(line, MsgStr, strlen(MsgStr)))
+        {
+#ifdef DEBUG
+            printf("line %d %s\n", lineNo,line);
+#endif
+            // Find hex value in string
+            linePtr = line + strlen(MsgStr);
+
+            // Allocate memory
+            free(Msg);
+            Msg = NULL;
+
+            Msg = (char*) malloc(MsgLen+1);
+            if (Msg==NULL)
+                exit(EXIT_FAILURE);
+
+            // Msg binary value
+            amcl_hex2bin(linePtr, Msg, 2*MsgLen);
+        }
+
+        if (!strncmp(line, MDStr, strlen(MDStr)) || !strncmp(line, OutputStr, strlen(OutputStr)))
+        {
+#ifdef DEBUG
+            printf("line %d %s\n", lineNo,line);
+#endif
+            // Find hex value in string
+            linePtr = strstr(line, "= ") + 2;
+
+            // Allocate memory
+            l1 = (int)strlen(linePtr)-1;
+
+            // Allocate memory for digest
+            free(MD1);
+            MD1 = NULL;
+            free(MD);
+            MD = NULL;
+
+            MDLen = l1/2;
+            MD = (char*) malloc(MDLen);
+            if (MD==NULL)
+                exit(EXIT_FAILURE);
+            MD1 = (char*) malloc(MDLen);
+            if (MD1==NULL)
+                exit(EXIT_FAILURE);
+
+            octet MD1Oct= {MDLen,MDLen,MD1};
+            octet MDOct= {MDLen,MDLen,MD};
+
+            // Golden MD value
+            amcl_hex2bin(linePtr, MD1, l1);
+
+            // Byte oriented absorb
+            SHA3_init(&sh,type);
+            for (i=0; i<MsgLen; i++)
+                SHA3_process(&sh,Msg[i]);
+            if (xof)
+                SHA3_shake(&sh,MD,MDLen);
+            else
+                SHA3_hash(&sh,MD);
+
+            if (!OCT_comp(&MD1Oct,&MDOct))
+            {
+                printf("TEST SHA3 FAILED COMPARE MD LINE %d\n",lineNo);
+                exit(EXIT_FAILURE);
+            }
+
+            // Bulk absorb, starting off a lane boundary
+            j = MsgLen/3;
+            SHA3_init(&sh,type);
+            SHA3_absorb(&sh,Msg,j);
+            SHA3_absorb(&sh,Msg+j,MsgLen-j);
+            if (xof)
+            {
+                // Stream the output in uneven pieces
+                SHA3_shake(&sh,MD,MDLen<5?MDLen:5);
+                for (i=5, k=1; i<MDLen; i+=k, k=2*k+3)
+                    SHA3_squeeze(&sh,MD+i,MDLen-i<k?MDLen-i:k);
+            }
+            else
+                SHA3_hash(&sh,MD);
+
+            if (!OCT_comp(&MD1Oct,&MDOct))
+            {
+                printf("TEST SHA3 ABSORB FAILED COMPARE MD LINE %d\n",lineNo);
+                exit(EXIT_FAILURE);
+            }
+        }
+        lineNo++;
+    }
+    free(Msg);
+    Msg = NULL;
+    free(MD1);
+    MD1 = NULL;
+    free(MD);
+    MD = NULL;
+    fclose(fp);
+    if (!readLine)
+    {
+        printf("ERROR Empty test vector file\n");
+        exit(EXIT_FAILURE);
+    }
+    printf("SUCCESS TEST %s PASSED\n", argv[2]);
+    exit(EXIT_SUCCESS);
+}
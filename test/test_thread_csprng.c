@@ -0,0 +1,174 @@
+/*
+Licensed to the Apache Software Foundation (ASF) under one
+or more contributor license agreements.  See the NOTICE file
+distributed with this work for additional information
+regarding copyright ownership.  The ASF licenses this file
+to you under the Apache License, Version 2.0 (the
+"License"); you may not use this file except in compliance
+with the License.  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing,
+software distributed under the License is distributed on an
+"AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+KIND, either express or implied.  See the License for the
+specific language governing permissions and limitations
+under the License.
+*/
+/**
+ * @file test_thread_csprng.c
+ * @brief Test for the per-thread random number generators
+ *
+ */
+
+#include "arch.h"
+#include "amcl.h"
+#include "randapi.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#if !defined(_WIN32)
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
+
+#define OUT_LEN 64
+
+/* Deterministic entropy source, so the output can be predicted */
+static int counter=0;
+
+static int counter_entropy(char *b,int len)
+{
+    for (int i=0; i<len; i++) b[i]=(char)(counter++);
+    return 0;
+}
+
+static int failing_entropy(char *b,int len)
+{
+    (void)b;
+    (void)len;
+    return 1;
+}
+
+int main()
+{
+    int i;
+    char raw[RAND_THREAD_SEED_BYTES];
+    char out[OUT_LEN];
+    char expected[OUT_LEN];
+    csprng *R;
+    csprng *R2;
+    csprng REF;
+
+    // Seeded from the callback on first use
+    SET_CSPRNG_ENTROPY(counter_entropy);
+    R=THREAD_CSPRNG();
+    if (R==NULL)
+    {
+        printf("ERROR THREAD_CSPRNG failed to seed\n");
+        exit(EXIT_FAILURE);
+    }
+    RAND_bytes(R,out,OUT_LEN);
+
+    for (i=0; i<RAND_THREAD_SEED_BYTES; i++) raw[i]=(char)i;
+    RAND_seed_type(&REF,RAND_HMAC_DRBG,RAND_THREAD_SEED_BYTES,raw);
+    RAND_bytes(&REF,expected,OUT_LEN);
+    if (memcmp(out,expected,OUT_LEN))
+    {
+        printf("ERROR THREAD_CSPRNG not seeded from the entropy source\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // The same instance is returned to the same thread
+    for (i=1; i<RAND_THREAD_RESEED; i++)
+    {
+        R2=THREAD_CSPRNG();
+        if (R2!=R)
+        {
+            printf("ERROR THREAD_CSPRNG returned a different instance\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    if (counter!=RAND_THREAD_SEED_BYTES)
+    {
+        printf("ERROR THREAD_CSPRNG reseeded early\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Reseeded from the entropy source after RAND_THREAD_RESEED calls
+    R=THREAD_CSPRNG();
+    RAND_bytes(R,out,OUT_LEN);
+
+    for (i=0; i<RAND_THREAD_SEED_BYTES; i++) raw[i]=(char)(RAND_THREAD_SEED_BYTES+i);
+    RAND_reseed(&REF,RAND_THREAD_SEED_BYTES,raw);
+    RAND_bytes(&REF,expected,OUT_LEN);
+    if (memcmp(out,expected,OUT_LEN))
+    {
+        printf("ERROR THREAD_CSPRNG not reseeded from the entropy source\n");
+        exit(EXIT_FAILURE);
+    }
+    RAND_clean(&REF);
+
+    // No generator without entropy
+    KILL_THREAD_CSPRNG();
+    SET_CSPRNG_ENTROPY(failing_entropy);
+    if (THREAD_CSPRNG()!=NULL)
+    {
+        printf("ERROR THREAD_CSPRNG seeded without entropy\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Default entropy source
+    SET_CSPRNG_ENTROPY(NULL);
+    R=THREAD_CSPRNG();
+    if (R==NULL)
+    {
+        printf("ERROR THREAD_CSPRNG failed to seed from /dev/urandom\n");
+        exit(EXIT_FAILURE);
+    }
+
+#if !defined(_WIN32)
+    // A forked child must not repeat the output of its parent
+    int fd[2];
+    pid_t pid;
+    int status;
+
+    RAND_bytes(R,out,1);
+    if (pipe(fd))
+    {
+        printf("ERROR pipe failed\n");
+        exit(EXIT_FAILURE);
+    }
+    pid=fork();
+    if (pid<0)
+    {
+        printf("ERROR fork failed\n");
+        exit(EXIT_FAILURE);
+    }
+    if (pid==0)
+    {
+        RAND_bytes(THREAD_CSPRNG(),out,OUT_LEN);
+        if (write(fd[1],out,OUT_LEN)!=OUT_LEN) _exit(EXIT_FAILURE);
+        _exit(EXIT_SUCCESS);
+    }
+    RAND_bytes(THREAD_CSPRNG(),expected,OUT_LEN);
+    if (read(fd[0],out,OUT_LEN)!=OUT_LEN || waitpid(pid,&status,0)!=pid || status!=0)
+    {
+        printf("ERROR reading from child process\n");
+        exit(EXIT_FAILURE);
+    }
+    close(fd[0]);
+    close(fd[1]);
+    if (!memcmp(out,expected,OUT_LEN))
+    {
+        printf("ERROR THREAD_CSPRNG repeated output after fork\n");
+        exit(EXIT_FAILURE);
+    }
+#endif
+
+    KILL_THREAD_CSPRNG();
+
+    printf("SUCCESS\n");
+    exit(EXIT_SUCCESS);
+}